@@ -17,6 +17,19 @@ $GENERATOR \
     --output-directory=generator-test/.gen \
     --core-output-directory=. \
     --cpp.include_path=include_path_based_on_package \
+    --cpp.forward_header=forward_header_per_document \
+    --cpp.columns=columns_per_structure \
+    --cpp.shm_transport=shm_transport_per_interface \
+    --unity=true \
+    --unity-files=2 \
+    || exit 1
+
+$GENERATOR \
+    --project-file=generator-test/generator-test.compilprj \
+    --output-directory=generator-test/.gen-inline \
+    --core-output-directory=. \
+    --cpp.include_path=include_path_based_on_package \
+    --cpp.accessors=accessors_inline \
     || exit 1
 
 popd || exit 1
\ No newline at end of file
@@ -0,0 +1,123 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/document_session.h"
+
+#include <boost/make_shared.hpp>
+
+#include <sstream>
+
+namespace compil
+{
+
+DocumentSession::DocumentSession(const ISourceProviderSPtr& pSourceProvider,
+                                 const SourceIdSPtr& pSourceId)
+    : mpSourceProvider(pSourceProvider)
+    , mpSourceId(pSourceId)
+    , mResult(false)
+    , mIncremental(false)
+{
+}
+
+DocumentSession::~DocumentSession()
+{
+}
+
+void DocumentSession::open(const std::string& text)
+{
+    mTokenizer.tokenize(mpSourceId, text);
+    parse();
+}
+
+void DocumentSession::edit(size_t begin, size_t end, const std::string& text)
+{
+    if (   mTokenizer.edit(begin, end, text)
+        && mpParser
+        && mpParser->canReparse(mTokenizer.changedToken()))
+    {
+        DocumentSPtr document;
+        mResult = mpParser->reparseDocument(mTokenizer.stream(), mTokenizer.changedToken(), document);
+        mIncremental = true;
+        return;
+    }
+    parse();
+}
+
+void DocumentSession::parse()
+{
+    mpParser.reset(new Parser());
+    mIncremental = false;
+
+    DocumentSPtr document;
+    if (mTokenizer.valid())
+    {
+        mResult = mpParser->parseDocument(mpSourceProvider, mpSourceId, mTokenizer.stream(), document);
+        return;
+    }
+
+    // the tokenizer errors are reported by the regular parsing
+    mResult = mpParser->parseDocument(mpSourceProvider, mpSourceId,
+                                      boost::make_shared<std::istringstream>(mTokenizer.source()),
+                                      document);
+}
+
+const SourceIdSPtr& DocumentSession::sourceId() const
+{
+    return mpSourceId;
+}
+
+const std::string& DocumentSession::text() const
+{
+    return mTokenizer.source();
+}
+
+bool DocumentSession::result() const
+{
+    return mResult;
+}
+
+const std::vector<Message>& DocumentSession::messages()
+{
+    return mpParser->messages();
+}
+
+DocumentSPtr DocumentSession::document() const
+{
+    return mpParser->document();
+}
+
+bool DocumentSession::incremental() const
+{
+    return mIncremental;
+}
+
+}
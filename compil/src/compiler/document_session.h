@@ -0,0 +1,104 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#ifndef _COMPIL_DOCUMENT_SESSION_H__
+#define _COMPIL_DOCUMENT_SESSION_H__
+
+#include "compiler/parser.h"
+
+#include "compiler/tokenizer/incremental_tokenizer.h"
+
+#include <boost/shared_ptr.hpp>
+
+#include <string>
+#include <vector>
+
+namespace compil
+{
+
+// Keeps an edited document parsed in memory, together with its imports
+// and its tokens. An edit tokenizes again only the changed part of the
+// source and parses again the statements from the first changed one on.
+// The statements before it, the imports and their validation results are
+// kept. The whole document is parsed again only if the change reaches
+// the head of the document (the file statement, the imports and the
+// package) or the changed source does not tokenize
+class DocumentSession
+{
+public:
+    DocumentSession(const ISourceProviderSPtr& pSourceProvider,
+                    const SourceIdSPtr& pSourceId);
+    ~DocumentSession();
+
+    // parses the whole text
+    void open(const std::string& text);
+
+    // replaces the [begin, end) range of the text and parses the change
+    void edit(size_t begin, size_t end, const std::string& text);
+
+    const SourceIdSPtr& sourceId() const;
+    const std::string& text() const;
+
+    // true if there are no errors in the document
+    bool result() const;
+    const std::vector<Message>& messages();
+    DocumentSPtr document() const;
+
+    // true if the last change was parsed incrementally
+    bool incremental() const;
+
+private:
+    void parse();
+
+    ISourceProviderSPtr mpSourceProvider;
+    SourceIdSPtr mpSourceId;
+    IncrementalTokenizer mTokenizer;
+    ParserPtr mpParser;
+    bool mResult;
+    bool mIncremental;
+};
+
+typedef boost::shared_ptr<DocumentSession> DocumentSessionSPtr;
+
+}
+
+#else
+
+namespace compil
+{
+
+class DocumentSession;
+typedef boost::shared_ptr<DocumentSession> DocumentSessionSPtr;
+
+}
+
+#endif // _COMPIL_DOCUMENT_SESSION_H__
@@ -0,0 +1,106 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/document_session.h"
+
+#include "core/platform/benchmark.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// a schema of five thousand lines, every structure refers the previous one
+static std::string corpus()
+{
+    std::ostringstream source;
+    source << "compil { }\n\npackage benchmark.session;\n\n";
+    source << "structure Structure0\n{\n}\n\n";
+    for (int s = 1; s < 833; ++s)
+    {
+        source << "// the structure " << s << "\n"
+               << "structure Structure" << s << "\n"
+               << "{\n"
+               << "    integer field = " << s << ";\n"
+               << "    Structure" << s - 1 << " previous;\n"
+               << "}\n";
+    }
+    return source.str();
+}
+
+static void benchmarkEdit(const char* name, const std::string& value)
+{
+    compil::SourceIdSPtr sourceId = compil::SourceId::Builder()
+        .set_value("benchmark")
+        .set_original("benchmark.compil")
+        .finalize();
+    compil::DocumentSession session(compil::ISourceProviderSPtr(), sourceId);
+    const std::string source = corpus();
+    session.open(source);
+    ASSERT_TRUE(session.result());
+
+    // changes the value back and forth
+    const size_t offset = session.text().find(value);
+    ASSERT_NE(std::string::npos, offset);
+    const std::string changed = value + "0";
+
+    int edits = 0;
+    plt::Benchmark benchmark(std::string("compiler/document_session.") + name);
+    while (benchmark.running())
+    {
+        if (edits++ % 2)
+            session.edit(offset, offset + changed.size(), value);
+        else
+            session.edit(offset, offset + value.size(), changed);
+        benchmark.consume(session.result());
+    }
+    EXPECT_TRUE(session.incremental());
+    EXPECT_TRUE(session.result());
+
+    std::cout << "[ BENCHMARK] compiler/document_session." << name << ": "
+              << std::count(source.begin(), source.end(), '\n') << " lines, "
+              << std::fixed << std::setprecision(3)
+              << benchmark.nanosecondsPerIteration() / 1000000.0 << " ms/edit"
+              << std::endl;
+}
+
+TEST(DocumentSessionBenchmark, editInTheMiddle)
+{
+    benchmarkEdit("edit_in_the_middle", "= 416");
+}
+
+TEST(DocumentSessionBenchmark, editAtTheBeginning)
+{
+    benchmarkEdit("edit_at_the_beginning", "= 1");
+}
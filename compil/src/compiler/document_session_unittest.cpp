@@ -0,0 +1,235 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/document_session.h"
+
+#include "language/compil/all/object_factory.h"
+
+#include "gtest/gtest.h"
+
+#include <boost/make_shared.hpp>
+
+#include <sstream>
+
+class DocumentSessionTests : public ::testing::Test
+{
+public:
+    virtual void SetUp()
+    {
+        mpSourceId = compil::SourceId::Builder()
+            .set_value("session")
+            .set_original("session.compil")
+            .finalize();
+        mpSession.reset(new compil::DocumentSession(compil::ISourceProviderSPtr(), mpSourceId));
+    }
+
+    void replace(const std::string& what, const std::string& text)
+    {
+        size_t offset = mpSession->text().find(what);
+        ASSERT_NE(std::string::npos, offset) << what;
+        mpSession->edit(offset, offset + what.size(), text);
+    }
+
+    // the session has to end up with the same messages and objects as
+    // a parsing of its text from scratch
+    void expectSameAsFullParse()
+    {
+        compil::Parser parser;
+        compil::DocumentSPtr document;
+        bool result = parser.parseDocument(mpSourceId,
+                                           boost::make_shared<std::istringstream>(mpSession->text()),
+                                           document);
+        EXPECT_EQ(result, mpSession->result());
+
+        const std::vector<compil::Message>& expected = parser.messages();
+        const std::vector<compil::Message>& actual = mpSession->messages();
+        ASSERT_EQ(expected.size(), actual.size()) << mpSession->text();
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(expected[i].severity(), actual[i].severity());
+            EXPECT_EQ(expected[i].line(), actual[i].line());
+            EXPECT_EQ(expected[i].column(), actual[i].column());
+            EXPECT_EQ(expected[i].text(), actual[i].text());
+        }
+
+        std::vector<compil::ObjectSPtr> expectedObjects = parser.document()->objects();
+        std::vector<compil::ObjectSPtr> actualObjects = mpSession->document()->objects();
+        ASSERT_EQ(expectedObjects.size(), actualObjects.size());
+        for (size_t i = 0; i < expectedObjects.size(); ++i)
+        {
+            EXPECT_EQ(expectedObjects[i]->runtimeObjectId(), actualObjects[i]->runtimeObjectId());
+            EXPECT_EQ(expectedObjects[i]->line(), actualObjects[i]->line());
+            EXPECT_EQ(expectedObjects[i]->column(), actualObjects[i]->column());
+        }
+    }
+
+    compil::FieldSPtr field(size_t structure, size_t field)
+    {
+        compil::StructureSPtr pStructure =
+            compil::ObjectFactory::downcastStructure(mpSession->document()->objects()[structure]);
+        return compil::ObjectFactory::downcastField(pStructure->objects()[field]);
+    }
+
+    compil::SourceIdSPtr mpSourceId;
+    compil::DocumentSessionSPtr mpSession;
+};
+
+static const char* gText =
+    "compil { }\n"
+    "package session;\n"
+    "\n"
+    "// the first structure\n"
+    "structure S1\n"
+    "{\n"
+    "    integer i = 1;\n"
+    "}\n"
+    "\n"
+    "enum E\n"
+    "{\n"
+    "    a;\n"
+    "    b;\n"
+    "}\n"
+    "\n"
+    "structure S2\n"
+    "{\n"
+    "    S1 s1;\n"
+    "    E e;\n"
+    "}\n";
+
+TEST_F(DocumentSessionTests, open)
+{
+    mpSession->open(gText);
+    EXPECT_TRUE(mpSession->result());
+    EXPECT_FALSE(mpSession->incremental());
+    EXPECT_EQ(3U, mpSession->document()->objects().size());
+    expectSameAsFullParse();
+}
+
+TEST_F(DocumentSessionTests, editStatement)
+{
+    mpSession->open(gText);
+    compil::ObjectSPtr pS1 = mpSession->document()->objects()[0];
+
+    replace("a;\n    b;", "a;\n    b;\n    c;");
+    EXPECT_TRUE(mpSession->incremental());
+    EXPECT_TRUE(mpSession->result());
+    expectSameAsFullParse();
+
+    // the statements before the change are kept
+    EXPECT_EQ(pS1, mpSession->document()->objects()[0]);
+    EXPECT_EQ(pS1, field(2, 0)->type());
+}
+
+TEST_F(DocumentSessionTests, editIntroducesAndFixesError)
+{
+    mpSession->open(gText);
+
+    replace("S1\n{", "S0\n{");
+    EXPECT_TRUE(mpSession->incremental());
+    EXPECT_FALSE(mpSession->result());
+    EXPECT_LT(0U, mpSession->messages().size());
+    expectSameAsFullParse();
+
+    replace("S0\n{", "S1\n{");
+    EXPECT_TRUE(mpSession->incremental());
+    EXPECT_TRUE(mpSession->result());
+    EXPECT_EQ(0U, mpSession->messages().size());
+    expectSameAsFullParse();
+}
+
+TEST_F(DocumentSessionTests, forwardReference)
+{
+    mpSession->open(
+        "compil { }\n"
+        "structure A\n"
+        "{\n"
+        "    B b;\n"
+        "}\n"
+        "structure B\n"
+        "{\n"
+        "}\n");
+    ASSERT_TRUE(mpSession->result());
+
+    replace("{\n}\n", "{\n    integer i;\n}\n");
+    EXPECT_TRUE(mpSession->incremental());
+    EXPECT_TRUE(mpSession->result());
+    expectSameAsFullParse();
+
+    // the kept structure refers the reparsed one
+    EXPECT_EQ(mpSession->document()->objects()[1], field(0, 0)->type());
+}
+
+TEST_F(DocumentSessionTests, editHead)
+{
+    mpSession->open(gText);
+
+    replace("package session;", "package session.head;");
+    EXPECT_FALSE(mpSession->incremental());
+    EXPECT_TRUE(mpSession->result());
+    expectSameAsFullParse();
+}
+
+TEST_F(DocumentSessionTests, tokenizerError)
+{
+    mpSession->open(gText);
+
+    replace("// the first structure", "/* the first structure");
+    EXPECT_FALSE(mpSession->incremental());
+    EXPECT_FALSE(mpSession->result());
+    expectSameAsFullParse();
+
+    replace("/* the first structure", "// the first structure");
+    EXPECT_FALSE(mpSession->incremental());
+    EXPECT_TRUE(mpSession->result());
+    expectSameAsFullParse();
+
+    replace("integer i = 1;", "integer i = 2;");
+    EXPECT_TRUE(mpSession->incremental());
+    expectSameAsFullParse();
+}
+
+TEST_F(DocumentSessionTests, typing)
+{
+    mpSession->open(gText);
+
+    // types a new structure at the end of the document, character by
+    // character, through all the incomplete states
+    const std::string statement = "\nstructure S3 inherit S2\n{\n    integer i = 3;\n    E e3;\n}\n";
+    for (size_t i = 0; i < statement.size(); ++i)
+    {
+        mpSession->edit(mpSession->text().size(), mpSession->text().size(), statement.substr(i, 1));
+        expectSameAsFullParse();
+        if (HasFailure())
+            return;
+    }
+    EXPECT_TRUE(mpSession->incremental());
+}
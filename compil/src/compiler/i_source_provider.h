@@ -71,6 +71,10 @@ public:
     virtual boost::filesystem::path directory(const boost::filesystem::path& file) = 0;
     virtual boost::filesystem::path absolute(const boost::filesystem::path& file) = 0;
 
+    // Forgets the cached state of the sources, because they could have
+    // been changed since. The providers without a cache have nothing to do.
+    virtual void refresh() {}
+
 };
 
 typedef boost::shared_ptr<ISourceProvider> ISourceProviderSPtr;
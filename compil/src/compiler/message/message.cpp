@@ -116,6 +116,9 @@ const char* Message::p_unexpectedStatmentModificator =
 
 const char* Message::p_expectClosingAngleBracket =
     "Expect closing angle bracket";
+
+const char* Message::p_expectContainerCapacity =
+    "Expect positive integer capacity of the container";
     
 const char* Message::p_nonByReferenceFieldDefaultWithNull =
     "Only field aggregated by reference could have null default value";
@@ -141,6 +144,27 @@ const char* Message::v_partualObjectInNonPartialGenerator =
 
 const char* Message::v_baseStructureMustBeSharableForSharableStructure =
     "The base structure of a sharable structure must be shrable too";
+
+const char* Message::v_internedStructureMustBeImmutable =
+    "An interned structure must be immutable";
+
+const char* Message::v_internedStructureCanNotBeAbstract =
+    "An interned structure can not be abstract";
+
+const char* Message::v_pooledStructureCanNotBeAbstract =
+    "A pooled structure can not be abstract";
+
+const char* Message::v_pooledStructureCanNotBePartial =
+    "A pooled structure can not be partial";
+
+const char* Message::v_trackedStructureMustBeControlled =
+    "A tracked structure must be controlled";
+
+const char* Message::v_trackedStructureCanNotBeImmutable =
+    "A tracked structure can not be immutable";
+
+const char* Message::v_baseStructureMustBeTrackedForTrackedStructure =
+    "The base structure of a tracked structure must be tracked too";
     
 
 Message::Message(Severity severity, const std::string& text,
@@ -169,6 +169,7 @@ public:
     static const char* p_expectSemicolonOrAssignmentOperator;
 
     static const char* p_expectClosingAngleBracket;
+    static const char* p_expectContainerCapacity;
     
     static const char* p_nonByReferenceFieldDefaultWithNull;
     
@@ -182,6 +183,13 @@ public:
 
     static const char* v_partualObjectInNonPartialGenerator;
     static const char* v_baseStructureMustBeSharableForSharableStructure;
+    static const char* v_internedStructureMustBeImmutable;
+    static const char* v_internedStructureCanNotBeAbstract;
+    static const char* v_pooledStructureCanNotBeAbstract;
+    static const char* v_pooledStructureCanNotBePartial;
+    static const char* v_trackedStructureMustBeControlled;
+    static const char* v_trackedStructureCanNotBeImmutable;
+    static const char* v_baseStructureMustBeTrackedForTrackedStructure;
     
     Message(Severity severity, const std::string& text,
             const SourceIdSPtr& pSourceId, const Line& line, const Column& column);
@@ -60,6 +60,12 @@ void MessageCollector::addMessage(
     addMessage(Message(severity, message, pSourceId, line, column));
 }
 
+void MessageCollector::truncate(size_t count)
+{
+    if (count < mMessages.size())
+        mMessages.erase(mMessages.begin() + count, mMessages.end());
+}
+
 
 Message::Severity MessageCollector::severity()
 {
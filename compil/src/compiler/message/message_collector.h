@@ -54,6 +54,9 @@ public:
                     const SourceIdSPtr& pSourceId, const Line& line, const Column& column);
 
     const std::vector<Message>& messages();
+
+    // drops the messages added after the first count ones
+    void truncate(size_t count);
    
     Message::Severity severity();
 
@@ -33,7 +33,11 @@
 #include "compiler/parser.h"
 #include "compiler/validator/parameter_type_validator.h"
 #include "compiler/validator/structure_fields_validator.h"
+#include "compiler/validator/structure_interned_validator.h"
+#include "compiler/validator/structure_pooled_validator.h"
 #include "compiler/validator/structure_sharable_validator.h"
+#include "compiler/validator/structure_tracked_validator.h"
+#include "compiler/validator/validation_engine.h"
 
 #include "library/compil/document.h"
 
@@ -41,62 +45,84 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/foreach.hpp>
 
+#include <iterator>
+#include <sstream>
+
 #include <assert.h>
 
 namespace compil
 {
 
-static bool bInit = false;
-static ParameterTypeValidatorPtr pParameterTypeEnumerationValidator(
+// The validators are shared by all the parsers. Every validator is
+// attached to the kind of the objects it checks
+static ValidationEngineSPtr createValidationEngine()
+{
+    ParameterTypeValidatorPtr pParameterTypeEnumerationValidator(
             new ParameterTypeValidator(EObjectId::enumeration()));
-static ParameterTypeValidatorPtr pParameterTypeIdentifierValidator(
+    ParameterTypeValidatorPtr pParameterTypeIdentifierValidator(
             new ParameterTypeValidator(EObjectId::identifier()));
-static StructureFieldsValidatorPtr pStructureFieldsValidator(
-            new StructureFieldsValidator());
-static StructureSharableValidatorPtr pStructureSharableValidator(
-            new StructureSharableValidator());
 
+    DocumentSPtr document = lib::compil::CompilDocument::create();
+    std::vector<PackageElementSPtr> package_elements;
+    pParameterTypeEnumerationValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "small"));
+    pParameterTypeEnumerationValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "short"));
+    pParameterTypeEnumerationValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "integer"));
+
+    pParameterTypeIdentifierValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "small"));
+    pParameterTypeIdentifierValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "short"));
+    pParameterTypeIdentifierValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "integer"));
+    pParameterTypeIdentifierValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "long"));
+    pParameterTypeIdentifierValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "byte"));
+    pParameterTypeIdentifierValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "word"));
+    pParameterTypeIdentifierValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "dword"));
+    pParameterTypeIdentifierValidator->addAcceptableType(
+        document->findType(PackageSPtr(), package_elements, "qword"));
+
+    ValidationEngineSPtr pEngine(new ValidationEngine());
+    pEngine->addValidator(EObjectId::enumeration(), pParameterTypeEnumerationValidator);
+    pEngine->addValidator(EObjectId::identifier(), pParameterTypeIdentifierValidator);
+    pEngine->addValidator(EObjectId::structure(), StructureFieldsValidatorPtr(new StructureFieldsValidator()));
+    pEngine->addValidator(EObjectId::structure(), StructureSharableValidatorPtr(new StructureSharableValidator()));
+    pEngine->addValidator(EObjectId::structure(), StructureInternedValidatorPtr(new StructureInternedValidator()));
+    pEngine->addValidator(EObjectId::structure(), StructurePooledValidatorPtr(new StructurePooledValidator()));
+    pEngine->addValidator(EObjectId::structure(), StructureTrackedValidatorPtr(new StructureTrackedValidator()));
+    return pEngine;
+}
 
-Parser::Parser()
+static const ValidationEngineSPtr& sharedValidationEngine()
 {
-    if (!bInit)
-    {
-        bInit = true;
+    static ValidationEngineSPtr pValidationEngine;
+    if (!pValidationEngine)
+        pValidationEngine = createValidationEngine();
+    return pValidationEngine;
+}
 
-        DocumentSPtr document = lib::compil::CompilDocument::create();
-        std::vector<PackageElementSPtr> package_elements;
-        pParameterTypeEnumerationValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "small"));
-        pParameterTypeEnumerationValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "short"));
-        pParameterTypeEnumerationValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "integer"));
-
-        pParameterTypeIdentifierValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "small"));
-        pParameterTypeIdentifierValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "short"));
-        pParameterTypeIdentifierValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "integer"));
-        pParameterTypeIdentifierValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "long"));
-        pParameterTypeIdentifierValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "byte"));
-        pParameterTypeIdentifierValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "word"));
-        pParameterTypeIdentifierValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "dword"));
-        pParameterTypeIdentifierValidator->addAcceptableType(
-            document->findType(PackageSPtr(), package_elements, "qword"));
-    }
-
-    addValidator(pParameterTypeEnumerationValidator);
-    addValidator(pParameterTypeIdentifierValidator);
-    addValidator(pStructureFieldsValidator);
-    addValidator(pStructureSharableValidator);
+void Parser::initialize()
+{
+    // the validation engine creates the builtin types as well
+    sharedValidationEngine();
+}
+
+Parser::Parser()
+        : mKeepCheckpoints(false)
+        , mpValidationEngine(sharedValidationEngine())
+        , mpMessageStream(&std::cout)
+{
 }
 
 Parser::Parser(const Parser& parentParser)
+        : mKeepCheckpoints(false)
+        , mpMessageStream(parentParser.mpMessageStream)
 {
     DocumentParseContextSPtr context = boost::make_shared<DocumentParseContext>();
     *context = *boost::static_pointer_cast<DocumentParseContext>(parentParser.mContext);
@@ -112,10 +138,10 @@ Parser::~Parser()
         for (it = messages.begin(); it != messages.end(); ++it)
         {
             std::string source = it->sourceId() ? it->sourceId()->value() : "compil";
-            std::cout << source << ":"
-                      << it->line().value() << ":"
-                      << it->column().value() << " "
-                      << it->text() << "\n";
+            *mpMessageStream << source << ":"
+                             << it->line().value() << ":"
+                             << it->column().value() << " "
+                             << it->text() << "\n";
         }
     }
 }
@@ -576,16 +602,27 @@ FactorySPtr Parser::parseFactory(const CommentSPtr& pComment,
 
 FieldSPtr Parser::parseField(const CommentSPtr& pComment,
                              const std::vector<ObjectSPtr>& structureObjects,
-                             TokenPtr& pWeak)
+                             TokenPtr& pWeak,
+                             TokenPtr& pSmall)
 {
     FieldSPtr pField(new Field());
-    initilizeObject(mContext, pWeak, pField);
+    initilizeObject(mContext, pWeak ? pWeak : pSmall, pField);
     pField->set_comment(pComment);
 
     assert(mContext->mTokenizer->check(Token::TYPE_IDENTIFIER));
 
     std::vector<PackageElementSPtr> package_elements;
     TokenPtr pTypeNameToken;
+    UnaryTemplateSPtr pSmallTemplate;
+    if (pSmall)
+        pSmallTemplate = document()->findUnfinishedUnaryTemplate(mContext->mTokenizer->current()->text());
+    if (pSmall && (!pSmallTemplate || !ObjectFactory::downcastUnaryContainer(pSmallTemplate)))
+    {
+        // small is the builtin type of the field, not a container modifier
+        pTypeNameToken = pSmall;
+        pSmall.reset();
+    }
+    else
     if (!parseType(mContext, package_elements, pTypeNameToken))
         return FieldSPtr();
 
@@ -598,10 +635,16 @@ FieldSPtr Parser::parseField(const CommentSPtr& pComment,
         UnaryTemplateSPtr pUnaryTemplateClone =
             ObjectFactory::downcastUnaryTemplate(ObjectFactory::clone(pUnaryTemplate));
 
+        InitCapacityMethod initCapacityMethod;
+        UnaryContainerSPtr pUnaryContainer = ObjectFactory::downcastUnaryContainer(pUnaryTemplateClone);
+        if (pUnaryContainer)
+            initCapacityMethod = boost::bind(&UnaryContainer::set_capacity, pUnaryContainer, _1);
+
         if (!parseTypeParameter(boost::static_pointer_cast<DocumentParseContext>(mContext),
                                 boost::bind(&UnaryTemplate::set_parameterType, pUnaryTemplateClone, _1),
                                 "",
-                                mLateTypeResolve))
+                                mLateTypeResolve,
+                                initCapacityMethod))
             return FieldSPtr();
 
         pType = pUnaryTemplateClone;
@@ -612,6 +655,31 @@ FieldSPtr Parser::parseField(const CommentSPtr& pComment,
             pReference->set_weak(pWeak);
             pWeak.reset();
         }
+
+        if (pUnaryContainer)
+        {
+            // vector<T, N> holds exactly N elements and small vector<T, N>
+            // holds up to N elements inline before it spills to the heap
+            if (pSmall)
+            {
+                if (pUnaryContainer->capacity() == 0)
+                {
+                    *this << errorMessage(mContext, Message::p_expectContainerCapacity);
+                    return FieldSPtr();
+                }
+                pUnaryContainer->set_size(UnaryContainer::ESize::small());
+                pSmall.reset();
+            }
+            else
+            if (pUnaryContainer->capacity() > 0)
+            {
+                pUnaryContainer->set_size(UnaryContainer::ESize::fixed());
+            }
+            else
+            {
+                pUnaryContainer->set_size(UnaryContainer::ESize::dynamic());
+            }
+        }
     }
     else
     {
@@ -908,26 +976,35 @@ StructureSPtr Parser::parseStructure(const CommentSPtr& pComment,
                                      const TokenPtr& pAbstract,
                                      const TokenPtr& pContolled,
                                      const TokenPtr& pImmutable,
+                                     const TokenPtr& pInterned,
                                      const TokenPtr& pPartial,
+                                     const TokenPtr& pPooled,
                                      const TokenPtr& pSharable,
-                                     const TokenPtr& pStreamable)
+                                     const TokenPtr& pStreamable,
+                                     const TokenPtr& pTracked)
 {
     StructureSPtr pStructure(new Structure());
     pStructure->set_comment(pComment);
     initilizeObject(mContext, (pAbstract   ? pAbstract   :
                               (pContolled  ? pContolled  :
                               (pImmutable  ? pImmutable  :
+                              (pInterned   ? pInterned   :
                               (pPartial    ? pPartial    :
+                              (pPooled     ? pPooled     :
                               (pSharable   ? pSharable   :
-                                             pStreamable))))), pStructure);
+                              (pStreamable ? pStreamable :
+                                             pTracked)))))))), pStructure);
     pStructure->set_package(mContext->mPackage);
 
     pStructure->set_abstract(pAbstract);
     pStructure->set_controlled(pContolled);
     pStructure->set_immutable(pImmutable);
+    pStructure->set_interned(pInterned);
     pStructure->set_partial(pPartial);
+    pStructure->set_pooled(pPooled);
     pStructure->set_sharable(pSharable);
     pStructure->set_streamable(pStreamable);
+    pStructure->set_tracked(pTracked);
 
 
     mContext->mTokenizer->shift();
@@ -1086,6 +1163,7 @@ StructureSPtr Parser::parseStructure(const CommentSPtr& pComment,
 
         TokenPtr pStrong;
         TokenPtr pWeak;
+        TokenPtr pSmall;
         TokenPtr pIdentificationType;
         if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "weak"))
         {
@@ -1094,6 +1172,14 @@ StructureSPtr Parser::parseStructure(const CommentSPtr& pComment,
             skipComments(mContext);
         }
         else
+        if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "small"))
+        {
+            // could be the builtin type small as well, parseField decides
+            pSmall = mContext->mTokenizer->current();
+            mContext->mTokenizer->shift();
+            skipComments(mContext);
+        }
+        else
         if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "strong"))
         {
             pStrong = mContext->mTokenizer->current();
@@ -1193,7 +1279,7 @@ StructureSPtr Parser::parseStructure(const CommentSPtr& pComment,
         else
         if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER))
         {
-            FieldSPtr pField = parseField(pBodyComment, objects, pWeak);
+            FieldSPtr pField = parseField(pBodyComment, objects, pWeak, pSmall);
             if (!pField)
             {
                 recoverAfterError(mContext);
@@ -1231,6 +1317,7 @@ StructureSPtr Parser::parseStructure(const CommentSPtr& pComment,
 
         unexpectedStatement(pStrong);
         unexpectedStatement(pWeak);
+        unexpectedStatement(pSmall);
         unexpectedStatement(pFlags);
         unexpectedStatement(pOverride);
         unexpectedStatement(pOperatorDeclaration);
@@ -1287,21 +1374,46 @@ ParameterSPtr Parser::parseParameter(const CommentSPtr pComment)
         return ParameterSPtr();
     }
 
-    std::vector<PackageElementSPtr> package_elements;
-    TypeSPtr pType = document()->findType(mContext->mPackage,
-                                          package_elements,
-                                          mContext->mTokenizer->current()->text());
-    if (!pType)
+    // the containers of the parameters are always dynamic - vector<T>
+    UnaryTemplateSPtr pUnaryTemplate = document()->findUnfinishedUnaryTemplate(mContext->mTokenizer->current()->text());
+    if (pUnaryTemplate)
     {
-        *this << (errorMessage(mContext, Message::p_unknownClassifierType)
-                    << Message::Classifier("parameter")
-                    << Message::Type(mContext->mTokenizer->current()->text()));
-        return ParameterSPtr();
+        UnaryTemplateSPtr pUnaryTemplateClone =
+            ObjectFactory::downcastUnaryTemplate(ObjectFactory::clone(pUnaryTemplate));
+
+        mContext->mTokenizer->shift();
+        skipComments(mContext);
+
+        if (!parseTypeParameter(boost::static_pointer_cast<DocumentParseContext>(mContext),
+                                boost::bind(&UnaryTemplate::set_parameterType, pUnaryTemplateClone, _1),
+                                "",
+                                mLateTypeResolve))
+            return ParameterSPtr();
+
+        UnaryContainerSPtr pUnaryContainer = ObjectFactory::downcastUnaryContainer(pUnaryTemplateClone);
+        if (pUnaryContainer)
+            pUnaryContainer->set_size(UnaryContainer::ESize::dynamic());
+
+        pParameter->set_type(pUnaryTemplateClone);
     }
-    pParameter->set_type(pType);
+    else
+    {
+        std::vector<PackageElementSPtr> package_elements;
+        TypeSPtr pType = document()->findType(mContext->mPackage,
+                                              package_elements,
+                                              mContext->mTokenizer->current()->text());
+        if (!pType)
+        {
+            *this << (errorMessage(mContext, Message::p_unknownClassifierType)
+                        << Message::Classifier("parameter")
+                        << Message::Type(mContext->mTokenizer->current()->text()));
+            return ParameterSPtr();
+        }
+        pParameter->set_type(pType);
 
-    mContext->mTokenizer->shift();
-    skipComments(mContext);
+        mContext->mTokenizer->shift();
+        skipComments(mContext);
+    }
 
     if (!mContext->mTokenizer->expect(Token::TYPE_IDENTIFIER))
     {
@@ -1507,6 +1619,14 @@ void Parser::parseAnyStatement(const CommentSPtr& pComment)
         skipComments(mContext);
     }
 
+    TokenPtr pInterned;
+    if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "interned"))
+    {
+        pInterned = mContext->mTokenizer->current();
+        mContext->mTokenizer->shift();
+        skipComments(mContext);
+    }
+
     TokenPtr pPartial;
     if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "partial"))
     {
@@ -1515,6 +1635,14 @@ void Parser::parseAnyStatement(const CommentSPtr& pComment)
         skipComments(mContext);
     }
 
+    TokenPtr pPooled;
+    if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "pooled"))
+    {
+        pPooled = mContext->mTokenizer->current();
+        mContext->mTokenizer->shift();
+        skipComments(mContext);
+    }
+
     TokenPtr pSharable;
     if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "sharable"))
     {
@@ -1531,6 +1659,14 @@ void Parser::parseAnyStatement(const CommentSPtr& pComment)
         skipComments(mContext);
     }
 
+    TokenPtr pTracked;
+    if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "tracked"))
+    {
+        pTracked = mContext->mTokenizer->current();
+        mContext->mTokenizer->shift();
+        skipComments(mContext);
+    }
+
     TokenPtr pCast;
     if (  mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "strong")
        || mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "weak"))
@@ -1569,13 +1705,17 @@ void Parser::parseAnyStatement(const CommentSPtr& pComment)
     if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "structure"))
     {
         StructureSPtr pStructure = parseStructure(pComment, pAbstract, pControlled, pImmutable,
-                                                  pPartial, pSharable, pStreamable);
+                                                  pInterned, pPartial, pPooled, pSharable, pStreamable,
+                                                  pTracked);
         pAbstract.reset();
         pControlled.reset();
         pImmutable.reset();
+        pInterned.reset();
         pPartial.reset();
+        pPooled.reset();
         pSharable.reset();
         pStreamable.reset();
+        pTracked.reset();
         if (pStructure)
         {
             document()->addStructure(pStructure);
@@ -1635,9 +1775,12 @@ void Parser::parseAnyStatement(const CommentSPtr& pComment)
     unexpectedStatement(pAbstract);
     unexpectedStatement(pControlled);
     unexpectedStatement(pImmutable);
+    unexpectedStatement(pInterned);
     unexpectedStatement(pPartial);
+    unexpectedStatement(pPooled);
     unexpectedStatement(pSharable);
     unexpectedStatement(pStreamable);
+    unexpectedStatement(pTracked);
     unexpectedStatement(pCast);
     unexpectedStatement(pFlags);
     unexpectedStatement(pFunctionType);
@@ -1723,7 +1866,10 @@ bool Parser::parseImport()
 
 void Parser::addValidator(const ValidatorPtr& pValidator)
 {
-    mvValidator.push_back(pValidator);
+    // the shared validators are never changed
+    mpValidationEngine.reset(mpValidationEngine ? new ValidationEngine(*mpValidationEngine)
+                                                : new ValidationEngine());
+    mpValidationEngine->addValidator(pValidator);
 }
 
 void Parser::initDocumentContext()
@@ -1738,12 +1884,91 @@ void Parser::initDocumentContext()
     }
 }
 
+void Parser::setTokenCache(const TokenCacheSPtr& tokenCache)
+{
+    initDocumentContext();
+    mContext->mTokenCache = tokenCache;
+}
+
+void Parser::setDiscardComments(bool discard)
+{
+    initDocumentContext();
+    mContext->mDiscardComments = discard;
+}
+
+void Parser::setMessageStream(std::ostream& stream)
+{
+    mpMessageStream = &stream;
+}
+
+static TokenizerPtr sourceTokenizer(const MessageCollectorPtr& pMessageCollector,
+                                    const SourceIdSPtr& pSourceId,
+                                    const StreamPtr& pInput,
+                                    bool discardComments)
+{
+    TokenizerPtr tokenizer = boost::make_shared<Tokenizer>(pMessageCollector);
+    tokenizer->setDiscardComments(discardComments);
+    tokenizer->tokenize(pSourceId, pInput);
+    tokenizer->shift();
+    return tokenizer;
+}
+
+static TokenizerPtr streamTokenizer(const MessageCollectorPtr& pMessageCollector,
+                                    const SourceIdSPtr& pSourceId,
+                                    const TokenStream& stream,
+                                    size_t index,
+                                    bool discardComments)
+{
+    TokenizerPtr tokenizer = boost::make_shared<Tokenizer>(pMessageCollector);
+    tokenizer->setDiscardComments(discardComments);
+    tokenizer->replay(pSourceId, stream, index);
+    return tokenizer;
+}
+
+TokenizerPtr Parser::createTokenizer(const StreamPtr& pInput)
+{
+    if (!mContext->mTokenCache)
+        return sourceTokenizer(mContext->mMessageCollector, mContext->mSourceId, pInput,
+                               mContext->mDiscardComments);
+
+    std::string content((std::istreambuf_iterator<char>(*pInput)),
+                        std::istreambuf_iterator<char>());
+
+    TokenStream stream;
+    if (mContext->mTokenCache->load(content, stream))
+        return streamTokenizer(mContext->mMessageCollector, mContext->mSourceId, stream, 0,
+                               mContext->mDiscardComments);
+
+    // tokenize the whole source upfront, comments included, so the cached
+    // stream serves both modes. The sources with tokenizer errors are not
+    // cached, so the errors are reported from the regular tokenizer
+    MessageCollectorPtr collector = boost::make_shared<MessageCollector>();
+    Tokenizer eager(collector, mContext->mSourceId, boost::make_shared<std::istringstream>(content));
+    for (; eager.current(); eager.shift())
+        stream.tokens.push_back(eager.current());
+    stream.endLine = eager.line();
+    stream.endColumn = eager.column();
+
+    if (!collector->messages().empty())
+        return sourceTokenizer(mContext->mMessageCollector, mContext->mSourceId,
+                               boost::make_shared<std::istringstream>(content),
+                               mContext->mDiscardComments);
+
+    mContext->mTokenCache->store(content, stream);
+    return streamTokenizer(mContext->mMessageCollector, mContext->mSourceId, stream, 0,
+                           mContext->mDiscardComments);
+}
+
 bool Parser::parseDocument(const StreamPtr& pInput,
                            DocumentSPtr& resultDocument)
 {
     initDocumentContext();
-    mContext->mTokenizer = boost::make_shared<Tokenizer>(mContext->mMessageCollector, mContext->mSourceId, pInput);
+    mContext->mTokenizer = createTokenizer(pInput);
+    return parseDocumentTokens(resultDocument);
+}
 
+bool Parser::parseDocumentTokens(DocumentSPtr& resultDocument)
+{
     FileSPtr file = parseFile(mContext);
     if (!file)
         return false;
@@ -1772,8 +1997,26 @@ bool Parser::parseDocument(const StreamPtr& pInput,
         pStatementComment = lastComment(mContext);
     }
 
+    return parseStatements(file, pStatementComment, resultDocument);
+}
+
+bool Parser::parseStatements(const FileSPtr& file,
+                             CommentSPtr pStatementComment,
+                             DocumentSPtr& resultDocument)
+{
     while (mContext->mTokenizer->current())
     {
+        if (mKeepCheckpoints)
+        {
+            Checkpoint checkpoint;
+            checkpoint.token = mContext->mTokenizer->replayIndex();
+            checkpoint.comment = pStatementComment;
+            checkpoint.document = document()->mark();
+            checkpoint.messages = mContext->mMessageCollector->messages().size();
+            checkpoint.lateTypeResolve = mLateTypeResolve;
+            mCheckpoints.push_back(checkpoint);
+        }
+
         if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER))
         {
             parseAnyStatement(pStatementComment);
@@ -1807,11 +2050,8 @@ bool Parser::parseDocument(const StreamPtr& pInput,
     return true;
 }
 
-bool Parser::parseDocument(const SourceIdSPtr& sourceId,
-                           const StreamPtr& pInput,
-                           DocumentSPtr& resultDocument)
+void Parser::setDocumentSource(const SourceIdSPtr& sourceId)
 {
-    initDocumentContext();
     mContext->mSourceId = sourceId;
     
     if (!document()->sourceId())
@@ -1832,7 +2072,14 @@ bool Parser::parseDocument(const SourceIdSPtr& sourceId,
 
     assert(sourceId);
     mContext->mSources->insert(ParseContext::SourceMap::value_type(sourceId->value(), sourceId));
+}
 
+bool Parser::parseDocument(const SourceIdSPtr& sourceId,
+                           const StreamPtr& pInput,
+                           DocumentSPtr& resultDocument)
+{
+    initDocumentContext();
+    setDocumentSource(sourceId);
     return parseDocument(pInput, resultDocument);
 }
 
@@ -1852,10 +2099,116 @@ bool Parser::parseDocument(const ISourceProviderSPtr& sourceProvider,
     return parseDocument(sourceId, pStream, document);
 }
 
+bool Parser::parseDocument(const ISourceProviderSPtr& sourceProvider,
+                           const SourceIdSPtr& sourceId,
+                           const StreamPtr& pInput,
+                           DocumentSPtr& document)
+{
+    initDocumentContext();
+    mContext->mSourceProvider = sourceProvider;
+    return parseDocument(sourceId, pInput, document);
+}
+
+bool Parser::parseDocument(const ISourceProviderSPtr& sourceProvider,
+                           const SourceIdSPtr& sourceId,
+                           const TokenStream& stream,
+                           DocumentSPtr& document)
+{
+    initDocumentContext();
+    mContext->mSourceProvider = sourceProvider;
+    setDocumentSource(sourceId);
+
+    mKeepCheckpoints = true;
+    mCheckpoints.clear();
+    mContext->mTokenizer = streamTokenizer(mContext->mMessageCollector, mContext->mSourceId, stream, 0,
+                                           mContext->mDiscardComments);
+    return parseDocumentTokens(document);
+}
+
+bool Parser::canReparse(size_t changedToken) const
+{
+    return !mCheckpoints.empty() && (mCheckpoints.front().token < changedToken);
+}
+
+bool Parser::reparseDocument(const TokenStream& stream,
+                             size_t changedToken,
+                             DocumentSPtr& resultDocument)
+{
+    if (!canReparse(changedToken))
+        return false;
+
+    std::vector<Checkpoint>::iterator it = mCheckpoints.end();
+    do
+    {
+        --it;
+    }
+    while (it->token >= changedToken);
+
+    const Checkpoint checkpoint = *it;
+    mCheckpoints.erase(it, mCheckpoints.end());
+
+    document()->rollback(checkpoint.document);
+    mContext->mMessageCollector->truncate(checkpoint.messages);
+    mLateTypeResolve = checkpoint.lateTypeResolve;
+
+    mContext->mTokenizer = streamTokenizer(mContext->mMessageCollector, mContext->mSourceId, stream,
+                                           checkpoint.token, mContext->mDiscardComments);
+    return parseStatements(document()->mainFile(), checkpoint.comment, resultDocument);
+}
+
+static void skipCommentTokens(const TokenizerPtr& tokenizer)
+{
+    while (tokenizer->check(Token::TYPE_COMMENT))
+        tokenizer->shift();
+}
+
+bool Parser::parseDocumentPackage(const ISourceProviderSPtr& sourceProvider,
+                                  const SourceIdSPtr& sourceId,
+                                  PackageSPtr& package)
+{
+    initDocumentContext();
+    mContext->mSourceProvider = sourceProvider;
+    mContext->mSourceId = sourceId;
+
+    StreamPtr pStream = mContext->mSourceProvider->openInputStream(sourceId);
+    if (!pStream)
+    {
+        *this << Message(Message::SEVERITY_ERROR, Message::p_openSourceFailed, mContext->mSourceId, Line(1), Column(0));
+        return false;
+    }
+
+    mContext->mTokenizer = createTokenizer(pStream);
+    if (!parseFile(mContext))
+        return false;
+
+    skipCommentTokens(mContext->mTokenizer);
+    while (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "import"))
+    {
+        mContext->mTokenizer->shift();
+        if (!mContext->mTokenizer->expect(Token::TYPE_STRING_LITERAL))
+            return false;
+        mContext->mTokenizer->shift();
+        if (!mContext->mTokenizer->expect(Token::TYPE_DELIMITER, ";"))
+            return false;
+        mContext->mTokenizer->shift();
+        skipCommentTokens(mContext->mTokenizer);
+    }
+
+    package.reset();
+    if (mContext->mTokenizer->check(Token::TYPE_IDENTIFIER, "package"))
+    {
+        package = parsePackage(mContext);
+        if (!package)
+            return false;
+    }
+    return true;
+}
+
 void Parser::setDocumentInput(const boost::shared_ptr<std::istream>& pInput)
 {
     initDocumentContext();
-    mContext->mTokenizer = boost::make_shared<Tokenizer>(mContext->mMessageCollector, mContext->mSourceId, pInput);
+    mContext->mTokenizer = sourceTokenizer(mContext->mMessageCollector, mContext->mSourceId, pInput,
+                                           mContext->mDiscardComments);
 }
 
 void Parser::initProjectContext()
@@ -1917,17 +2270,11 @@ bool Parser::validate(const DocumentSPtr&)
 
 bool Parser::validate(const ObjectSPtr& pObject)
 {
-    bool bResult = true;
-
-    for (std::vector<ValidatorPtr>::iterator it = mvValidator.begin(); it != mvValidator.end(); ++it)
-    {
-        ValidatorPtr& pValidator = *it;
-
-        if (!pValidator->validate(pObject, mContext->mMessageCollector))
-            bResult = false;
-    }
+    // the parsers of the imports have no validators
+    if (!mpValidationEngine)
+        return true;
 
-    return bResult;
+    return mpValidationEngine->validate(pObject, mContext->mMessageCollector);
 }
 
 }
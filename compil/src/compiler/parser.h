@@ -43,11 +43,13 @@
 #include "compiler/message/message_collector.h"
 
 #include "compiler/tokenizer/tokenizer.h"
+#include "compiler/validator/validation_engine.h"
 #include "compiler/validator/validator.h"
 
 #include "language/compil/document/document.h"
 
 #include <map>
+#include <ostream>
 
 namespace compil
 {
@@ -62,6 +64,11 @@ public:
     
     Parser(const Parser& parentParser);
     ~Parser();
+
+    // Creates the builtin types and the validators shared by all the
+    // parsers. Must be called before the parsers are used on more than
+    // one thread
+    static void initialize();
     
     EnumerationValueSPtr parseEnumerationValue(const CommentSPtr& pComment,
                                                const std::vector<EnumerationValueSPtr>& values);
@@ -80,7 +87,8 @@ public:
 
     FieldSPtr parseField(const CommentSPtr& pComment, 
                          const std::vector<ObjectSPtr>& structureObjects,
-                         TokenPtr& pWeak);
+                         TokenPtr& pWeak,
+                         TokenPtr& pSmall);
     FieldOverrideSPtr parseFieldOverride(const FieldSPtr& pField, 
                                          const StructureSPtr& pStructure,
                                          const TokenPtr& pOverride);
@@ -95,9 +103,12 @@ public:
                                  const TokenPtr& pAbstract,
                                  const TokenPtr& pContolled,
                                  const TokenPtr& pImmutable,
+                                 const TokenPtr& pInterned,
                                  const TokenPtr& pPartial,
+                                 const TokenPtr& pPooled,
                                  const TokenPtr& pSharable,
-                                 const TokenPtr& pStreamable);
+                                 const TokenPtr& pStreamable,
+                                 const TokenPtr& pTracked);
                           
     bool parseImport();
 
@@ -108,6 +119,18 @@ public:
     void parseAnyStatement(const CommentSPtr& pComment);
     
     void addValidator(const ValidatorPtr& pValidator);
+
+    // The token streams of the parsed documents and all their imports
+    // are taken from (and stored in) the cache
+    void setTokenCache(const TokenCacheSPtr& tokenCache);
+
+    // The comments are skipped by the tokenizer and no Comment objects
+    // are created for the parsed documents and their imports
+    void setDiscardComments(bool discard);
+
+    // The messages are written to the stream when the parser is destroyed.
+    // std::cout by default. The parsers of the imports inherit it
+    void setMessageStream(std::ostream& stream);
     
     void initDocumentContext();
     
@@ -126,7 +149,39 @@ public:
     bool parseDocument(const ISourceProviderSPtr& pSourceProvider,
                        const SourceIdSPtr& pSourceId,
                        DocumentSPtr& document);
+    bool parseDocument(const ISourceProviderSPtr& pSourceProvider,
+                       const SourceIdSPtr& pSourceId,
+                       const StreamPtr& pInput,
+                       DocumentSPtr& document);
+
+    // Parses the document from an already tokenized source. The parser
+    // keeps a checkpoint before every top level statement of the document,
+    // so later it could be reparsed from the statement a change starts in
+    bool parseDocument(const ISourceProviderSPtr& pSourceProvider,
+                       const SourceIdSPtr& pSourceId,
+                       const TokenStream& stream,
+                       DocumentSPtr& document);
+
+    // Returns true if the statements before the given token could be kept
+    // by reparseDocument
+    bool canReparse(size_t changedToken) const;
+
+    // Drops everything parsed from the last statement starting before the
+    // changed token and parses the rest of the stream again. The tokens
+    // before the changed one must be the same as in the parsed stream.
+    // The imports and the kept statements are neither parsed nor
+    // validated again
+    bool reparseDocument(const TokenStream& stream,
+                         size_t changedToken,
+                         DocumentSPtr& document);
                
+    // Parses only the head of the document - the file statement, the
+    // imports (without opening them) and the package. The package is
+    // empty if the document does not have one.
+    bool parseDocumentPackage(const ISourceProviderSPtr& pSourceProvider,
+                              const SourceIdSPtr& pSourceId,
+                              PackageSPtr& package);
+
     void setDocumentInput(const StreamPtr& pInput);
     
     void initProjectContext();
@@ -142,14 +197,35 @@ public:
 private:
     std::vector<LateTypeResolveInfo> mLateTypeResolve;
     void lateTypeResolve(const TypeSPtr& pNewType);
+
+    // the parser state before a top level statement
+    struct Checkpoint
+    {
+        size_t token;
+        CommentSPtr comment;
+        Document::Mark document;
+        size_t messages;
+        std::vector<LateTypeResolveInfo> lateTypeResolve;
+    };
+    bool mKeepCheckpoints;
+    std::vector<Checkpoint> mCheckpoints;
     
     FileSPtr mFile;
-    std::vector<ValidatorPtr> mvValidator;
+    ValidationEngineSPtr mpValidationEngine;
+    std::ostream* mpMessageStream;
     
     Parser& operator<<(const Message& message);
 
     bool unexpectedStatement(const TokenPtr& pToken);
 
+    TokenizerPtr createTokenizer(const StreamPtr& pInput);
+
+    void setDocumentSource(const SourceIdSPtr& sourceId);
+    bool parseDocumentTokens(DocumentSPtr& document);
+    bool parseStatements(const FileSPtr& file,
+                         CommentSPtr pStatementComment,
+                         DocumentSPtr& document);
+
     bool validate(const DocumentSPtr& document);
     bool validate(const ObjectSPtr& pObject);
 };
@@ -37,6 +37,11 @@
 namespace compil
 {
 
+ParseContext::ParseContext()
+    : mDiscardComments(false)
+{
+}
+
 void ParseContext::operator<<=(const Message& message)
 {
     mMessageCollector->addMessage(message);
@@ -51,6 +56,14 @@ void ParserMixin::initilizeObject(const ParseContextSPtr& context, const TokenPt
 {
     if (!token)
     {
+        // at the end of the source
+        if (!context->mTokenizer->current())
+        {
+            object->set_sourceId(context->mSourceId);
+            object->set_line(context->mTokenizer->line());
+            object->set_column(context->mTokenizer->column());
+            return;
+        }
         initilizeObject(context, object);
         return;
     }
@@ -307,7 +320,8 @@ bool ParserMixin::convertStringElementsToPackageElements(const ParseContextSPtr&
         }
         else
         {
-            if (*eit && (*eit)->value() == *it)
+            if (   (eit != context->mSourceId->externalElements().rend())
+                && *eit && (*eit)->value() == *it)
                 ++eit;
 
             pe = boost::make_shared<PackageElement>();
@@ -46,6 +46,8 @@ namespace compil
 
 struct ParseContext
 {
+    ParseContext();
+
     void operator<<=(const Message& message);
 
     typedef std::map<std::string, SourceIdSPtr> SourceMap;
@@ -56,6 +58,8 @@ struct ParseContext
 
     MessageCollectorPtr mMessageCollector;
     TokenizerPtr        mTokenizer;
+    TokenCacheSPtr      mTokenCache;
+    bool                mDiscardComments;
 
     SourceIdSPtr        mSourceId;
     PackageSPtr         mPackage;
@@ -32,6 +32,8 @@
 
 #include "compiler/parser/type_parser-mixin.h"
 
+#include <stdlib.h>
+
 namespace compil
 {
 
@@ -64,7 +66,8 @@ bool TypeParserMixin::parseType(const ParseContextSPtr& context,
 bool TypeParserMixin::parseTypeParameter(const DocumentParseContextSPtr& context,
                                          const InitTypeMethod& initTypeMethod,
                                          const std::string& defaultTypeName,
-                                         std::vector<LateTypeResolveInfo>& lateTypeResolve)
+                                         std::vector<LateTypeResolveInfo>& lateTypeResolve,
+                                         const InitCapacityMethod& initCapacityMethod)
 {
     TypeSPtr type;
 
@@ -139,6 +142,26 @@ bool TypeParserMixin::parseTypeParameter(const DocumentParseContextSPtr& context
         type = context->mDocument->findType(context->mPackage, package_elements, nameToken->text());
     }
 
+    // the optional capacity of the container - vector<T, N>
+    if (initCapacityMethod && context->mTokenizer->check(Token::TYPE_DELIMITER, ","))
+    {
+        context->mTokenizer->shift();
+        skipComments(context);
+
+        long capacity = 0;
+        if (context->mTokenizer->check(Token::TYPE_INTEGER_LITERAL))
+            capacity = strtol(context->mTokenizer->current()->text().c_str(), NULL, 10);
+        if (capacity <= 0)
+        {
+            *context <<= errorMessage(context, Message::p_expectContainerCapacity);
+            return false;
+        }
+        initCapacityMethod(capacity);
+
+        context->mTokenizer->shift();
+        skipComments(context);
+    }
+
     if (!context->mTokenizer->expect(Token::TYPE_ANGLE_BRACKET, ">"))
     {
         *context <<= errorMessage(context, Message::p_expectClosingAngleBracket);
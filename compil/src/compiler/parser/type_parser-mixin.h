@@ -44,6 +44,7 @@ namespace compil
 {
 
 typedef boost::function1<void, const TypeSPtr&> InitTypeMethod;
+typedef boost::function1<void, long> InitCapacityMethod;
 
 struct LateTypeResolveInfo
 {
@@ -62,7 +63,8 @@ public:
     static bool parseTypeParameter(const DocumentParseContextSPtr& context,
                                    const InitTypeMethod& initTypeMethod,
                                    const std::string& defaultTypeName,
-                                   std::vector<LateTypeResolveInfo>& lateTypeResolve);
+                                   std::vector<LateTypeResolveInfo>& lateTypeResolve,
+                                   const InitCapacityMethod& initCapacityMethod = InitCapacityMethod());
 };
 
 }
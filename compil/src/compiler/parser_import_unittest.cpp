@@ -89,6 +89,12 @@ public:
                 "enum imported_enum2 { value; }");
         if (mSource == "import_type3")
             return BaseParserTests::getInput("enum imported_enum3 { value; }");
+        if (mSource == "import_package")
+            return BaseParserTests::getInput(
+                "import \"nonexistent\";\n"
+                "// comment\n"
+                "package pname1.pname2;\n"
+                "structure import_test { nonexistent_type t; }");
         if (mSource == "empty")
             return BaseParserTests::getInput("");
         if (mSource == "unopenable")
@@ -217,3 +223,27 @@ TEST_F(ParserImportTests, importType)
     EXPECT_TRUE(mDocument->mainFile());
     EXPECT_EQ(mpSourceId, mDocument->mainFile()->sourceId());
 }
+
+TEST_F(ParserImportTests, importPackageOnly)
+{
+    boost::shared_ptr<SourceProvider> pSourceProvider(new SourceProvider());
+    mpSourceId = compil::SourceId::Builder().set_value("import_package").finalize();
+    compil::PackageSPtr package;
+    ASSERT_TRUE( mpParser->parseDocumentPackage(pSourceProvider, mpSourceId, package) );
+    ASSERT_TRUE(package);
+    ASSERT_EQ(2U, package->short_().size());
+    EXPECT_STREQ("pname1", package->short_()[0]->value().c_str());
+    EXPECT_STREQ("pname2", package->short_()[1]->value().c_str());
+    // the imports are not opened
+    EXPECT_STREQ("import_package", pSourceProvider->mSource.c_str());
+    EXPECT_EQ(0U, mpParser->messages().size());
+}
+
+TEST_F(ParserImportTests, importPackageOnlyWithoutPackage)
+{
+    boost::shared_ptr<SourceProvider> pSourceProvider(new SourceProvider());
+    mpSourceId = compil::SourceId::Builder().set_value("import_type2").finalize();
+    compil::PackageSPtr package;
+    ASSERT_TRUE( mpParser->parseDocumentPackage(pSourceProvider, mpSourceId, package) );
+    EXPECT_FALSE(package);
+}
@@ -195,3 +195,34 @@ TEST_F(ParserInterfaceMethodParameterTests, interfaceMethod2ParametersClosed)
 
     ASSERT_EQ(0U, mpParser->messages().size());
 }
+
+TEST_F(ParserInterfaceMethodParameterTests, interfaceMethodVectorParameterClosed)
+{
+    ASSERT_TRUE( parseDocument(
+        "interface iname\n"
+        "{\n"
+        "  method mname\n"
+            "  {\n"
+        "    <-> vector<integer> pname;\n"
+        "  }\n"
+        "}") );
+
+    checkInterface(0, 1, 1, "iname");
+    checkMethod(0, 0, 3, 3, "mname");
+    checkParameter(0, 0, 0, 5, 5, "pname", "vector");
+
+    compil::InterfaceSPtr pInterface =
+        boost::static_pointer_cast<compil::Interface>(mDocument->objects()[0]);
+    compil::MethodSPtr pMethod =
+        boost::static_pointer_cast<compil::Method>(pInterface->objects()[0]);
+    compil::ParameterSPtr pParameter =
+        boost::static_pointer_cast<compil::Parameter>(pMethod->objects()[0]);
+    compil::UnaryContainerSPtr pUnaryContainer =
+        compil::ObjectFactory::downcastUnaryContainer(pParameter->type());
+    ASSERT_TRUE(pUnaryContainer);
+    EXPECT_EQ(compil::UnaryContainer::ESize::dynamic(), pUnaryContainer->size());
+    ASSERT_TRUE(pUnaryContainer->parameterType().lock());
+    EXPECT_STREQ("integer", pUnaryContainer->parameterType().lock()->name()->value().c_str());
+
+    ASSERT_EQ(0U, mpParser->messages().size());
+}
@@ -315,6 +315,16 @@ TEST_F(ParserStructureFieldTests, structureFieldDefaultCommentNoValue)
     EXPECT_TRUE(checkErrorMessage(1, 3, 26, compil::Message::p_expectValue));
 }
 
+TEST_F(ParserStructureFieldTests, structureFieldDefaultEOF)
+{
+    ASSERT_FALSE( parseDocument(
+        "structure name\n"
+        "{\n"
+        "  integer a =") );
+
+    ASSERT_LT(0U, mpParser->messages().size());
+}
+
 TEST_F(ParserStructureFieldTests, structureFieldOptional)
 {
     ASSERT_TRUE( parseDocument(
@@ -617,3 +627,69 @@ TEST_F(ParserStructureFieldTests, structureUnaryContainers)
     EXPECT_STREQ("name", pStructure->name()->value().c_str());
     EXPECT_EQ(2U, pStructure->objects().size());
 }
+
+TEST_F(ParserStructureFieldTests, structureUnaryContainersCapacity)
+{
+    ASSERT_TRUE( parseDocument(
+        "structure name\n"
+        "{\n"
+        "  vector<integer> d;\n"
+        "  vector<integer, 4> f;\n"
+        "  small vector<integer, 8> s;\n"
+        "  small i8;\n"
+        "}") );
+
+    EXPECT_EQ(1U, mDocument->objects().size());
+
+    compil::ObjectSPtr pObject = mDocument->objects()[0];
+    ASSERT_EQ(compil::EObjectId::structure(), pObject->runtimeObjectId());
+    compil::StructureSPtr pStructure = boost::static_pointer_cast<compil::Structure>(pObject);
+    ASSERT_TRUE(pStructure);
+    ASSERT_EQ(4U, pStructure->objects().size());
+
+    compil::UnaryContainerSPtr pContainer;
+
+    pContainer = compil::ObjectFactory::downcastUnaryContainer(
+        compil::ObjectFactory::downcastField(pStructure->objects()[0])->type());
+    ASSERT_TRUE(pContainer);
+    EXPECT_EQ(compil::UnaryContainer::ESize::dynamic(), pContainer->size());
+    EXPECT_EQ(0, pContainer->capacity());
+
+    pContainer = compil::ObjectFactory::downcastUnaryContainer(
+        compil::ObjectFactory::downcastField(pStructure->objects()[1])->type());
+    ASSERT_TRUE(pContainer);
+    EXPECT_EQ(compil::UnaryContainer::ESize::fixed(), pContainer->size());
+    EXPECT_EQ(4, pContainer->capacity());
+
+    pContainer = compil::ObjectFactory::downcastUnaryContainer(
+        compil::ObjectFactory::downcastField(pStructure->objects()[2])->type());
+    ASSERT_TRUE(pContainer);
+    EXPECT_EQ(compil::UnaryContainer::ESize::small(), pContainer->size());
+    EXPECT_EQ(8, pContainer->capacity());
+
+    compil::FieldSPtr pField = compil::ObjectFactory::downcastField(pStructure->objects()[3]);
+    EXPECT_STREQ("small", pField->type()->name()->value().c_str());
+    EXPECT_STREQ("i8", pField->name()->value().c_str());
+}
+
+TEST_F(ParserStructureFieldTests, structureUnaryContainerZeroCapacity)
+{
+    ASSERT_FALSE( parseDocument(
+        "structure name\n"
+        "{\n"
+        "  vector<integer, 0> f;\n"
+        "}") );
+
+    EXPECT_TRUE(checkErrorMessage(0, 3, 19, compil::Message::p_expectContainerCapacity));
+}
+
+TEST_F(ParserStructureFieldTests, structureSmallUnaryContainerNoCapacity)
+{
+    ASSERT_FALSE( parseDocument(
+        "structure name\n"
+        "{\n"
+        "  small vector<integer> s;\n"
+        "}") );
+
+    EXPECT_TRUE(checkErrorMessage(0, 3, 25, compil::Message::p_expectContainerCapacity));
+}
@@ -85,6 +85,51 @@ public:
         return result;
     }
     
+    bool checkStructureInterned(int sIndex, bool interned)
+    {
+        bool result = true;
+        
+        EXPECT_LT(sIndex, (int)mDocument->objects().size());
+        
+        compil::ObjectSPtr pObject = mDocument->objects()[sIndex];
+        EXPECT_EQ(compil::EObjectId::structure(), pObject->runtimeObjectId());
+        compil::StructureSPtr pStructure = 
+            boost::static_pointer_cast<compil::Structure>(pObject);
+        HF_EXPECT_EQ(interned, pStructure->interned());
+        
+        return result;
+    }
+    
+    bool checkStructurePooled(int sIndex, bool pooled)
+    {
+        bool result = true;
+        
+        EXPECT_LT(sIndex, (int)mDocument->objects().size());
+        
+        compil::ObjectSPtr pObject = mDocument->objects()[sIndex];
+        EXPECT_EQ(compil::EObjectId::structure(), pObject->runtimeObjectId());
+        compil::StructureSPtr pStructure = 
+            boost::static_pointer_cast<compil::Structure>(pObject);
+        HF_EXPECT_EQ(pooled, pStructure->pooled());
+        
+        return result;
+    }
+    
+    bool checkStructureTracked(int sIndex, bool tracked)
+    {
+        bool result = true;
+        
+        EXPECT_LT(sIndex, (int)mDocument->objects().size());
+        
+        compil::ObjectSPtr pObject = mDocument->objects()[sIndex];
+        EXPECT_EQ(compil::EObjectId::structure(), pObject->runtimeObjectId());
+        compil::StructureSPtr pStructure = 
+            boost::static_pointer_cast<compil::Structure>(pObject);
+        HF_EXPECT_EQ(tracked, pStructure->tracked());
+        
+        return result;
+    }
+    
     bool checkStructurePartial(int sIndex, bool partial)
     {
         bool result = true;
@@ -391,6 +436,94 @@ TEST_F(ParserStructureTests, structureAttributes)
     }
 }
 
+TEST_F(ParserStructureTests, structureInterned)
+{
+    ASSERT_TRUE( parseDocument(
+        "immutable interned structure name {}") );
+        
+    EXPECT_EQ(1U, mDocument->objects().size());
+    EXPECT_TRUE(checkStructure(0, 1, 1, "name"));
+    EXPECT_TRUE(checkStructureImmutable(0, true));
+    EXPECT_TRUE(checkStructureInterned(0, true));
+    EXPECT_EQ(0U, mpParser->messages().size());
+}
+
+TEST_F(ParserStructureTests, structureInternedNotImmutable)
+{
+    ASSERT_FALSE( parseDocument(
+        "interned structure name {}") );
+        
+    ASSERT_EQ(1U, mpParser->messages().size());
+    EXPECT_TRUE(checkErrorMessage(0, 1, 1, compil::Message::v_internedStructureMustBeImmutable));
+}
+
+TEST_F(ParserStructureTests, structureInternedAbstract)
+{
+    ASSERT_FALSE( parseDocument(
+        "abstract immutable interned structure name {}") );
+        
+    ASSERT_EQ(1U, mpParser->messages().size());
+    EXPECT_TRUE(checkErrorMessage(0, 1, 1, compil::Message::v_internedStructureCanNotBeAbstract));
+}
+
+TEST_F(ParserStructureTests, structurePooled)
+{
+    ASSERT_TRUE( parseDocument(
+        "immutable pooled sharable structure name {}") );
+        
+    EXPECT_EQ(1U, mDocument->objects().size());
+    EXPECT_TRUE(checkStructure(0, 1, 1, "name"));
+    EXPECT_TRUE(checkStructurePooled(0, true));
+    EXPECT_EQ(0U, mpParser->messages().size());
+}
+
+TEST_F(ParserStructureTests, structurePooledAbstract)
+{
+    ASSERT_FALSE( parseDocument(
+        "abstract pooled structure name {}") );
+        
+    ASSERT_EQ(1U, mpParser->messages().size());
+    EXPECT_TRUE(checkErrorMessage(0, 1, 1, compil::Message::v_pooledStructureCanNotBeAbstract));
+}
+
+TEST_F(ParserStructureTests, structurePooledPartial)
+{
+    ASSERT_FALSE( parseDocument(
+        "partial pooled structure name {}") );
+        
+    ASSERT_EQ(1U, mpParser->messages().size());
+    EXPECT_TRUE(checkErrorMessage(0, 1, 1, compil::Message::v_pooledStructureCanNotBePartial));
+}
+
+TEST_F(ParserStructureTests, structureTracked)
+{
+    ASSERT_TRUE( parseDocument(
+        "controlled tracked structure name {}") );
+        
+    EXPECT_EQ(1U, mDocument->objects().size());
+    EXPECT_TRUE(checkStructure(0, 1, 1, "name"));
+    EXPECT_TRUE(checkStructureTracked(0, true));
+    EXPECT_EQ(0U, mpParser->messages().size());
+}
+
+TEST_F(ParserStructureTests, structureTrackedNotControlled)
+{
+    ASSERT_FALSE( parseDocument(
+        "tracked structure name {}") );
+        
+    ASSERT_EQ(1U, mpParser->messages().size());
+    EXPECT_TRUE(checkErrorMessage(0, 1, 1, compil::Message::v_trackedStructureMustBeControlled));
+}
+
+TEST_F(ParserStructureTests, structureTrackedImmutable)
+{
+    ASSERT_FALSE( parseDocument(
+        "controlled immutable tracked structure name {}") );
+        
+    ASSERT_EQ(1U, mpParser->messages().size());
+    EXPECT_TRUE(checkErrorMessage(0, 1, 1, compil::Message::v_trackedStructureCanNotBeImmutable));
+}
+
 TEST_F(ParserStructureTests, 2structuresWithComments)
 {
     ASSERT_TRUE( parseDocument(
@@ -407,3 +540,24 @@ TEST_F(ParserStructureTests, 2structuresWithComments)
     EXPECT_EQ(0U, mpParser->messages().size());
 }
 
+TEST_F(ParserStructureTests, 2structuresWithDiscardedComments)
+{
+    mpParser->setDiscardComments(true);
+    ASSERT_TRUE( parseDocument(
+        "//comment1\n"
+        "structure name1 {}\n"
+        "/*comment2*/\n"
+        "structure name2\n"
+        "{\n"
+        "    integer field; // comment3\n"
+        "}") );
+
+    EXPECT_EQ(2U, mDocument->objects().size());
+
+    EXPECT_TRUE(checkStructure(0, 2, 1, "name1"));
+    EXPECT_TRUE(checkStructure(1, 4, 1, "name2"));
+    EXPECT_TRUE(mDocument->mainFile()->comments().empty());
+
+    EXPECT_EQ(0U, mpParser->messages().size());
+}
+
@@ -0,0 +1,228 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/tokenizer/incremental_tokenizer.h"
+#include "compiler/tokenizer/tokenizer.h"
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+
+namespace compil
+{
+
+IncrementalTokenizer::IncrementalTokenizer()
+    : mValid(false)
+    , mChangedToken(0)
+    , mTokenized(0)
+{
+}
+
+IncrementalTokenizer::~IncrementalTokenizer()
+{
+}
+
+static bool isEOL(char ch)
+{
+    return (ch == '\n') || (ch == '\r');
+}
+
+static bool isWhitespace(char ch)
+{
+    return 
+           (ch == ' ') 
+        || (ch == '\n')
+        || (ch == '\t')
+        || (ch == '\r')
+        || (ch == '\v')
+        || (ch == '\f');
+}
+
+static bool endsBefore(const IncrementalTokenizer::TokenEnd& end, size_t offset)
+{
+    return end.offset < offset;
+}
+
+// counts the lines the way the tokenizer does - "\r\n" and "\n\r" are
+// a single end of line
+static int countLines(const std::string& source, size_t begin, size_t end)
+{
+    int lines = 0;
+    for (size_t i = begin; i < end; ++i)
+    {
+        if (!isEOL(source[i]))
+            continue;
+        ++lines;
+        if ((i + 1 < end) && isEOL(source[i + 1]) && (source[i + 1] != source[i]))
+            ++i;
+    }
+    return lines;
+}
+
+bool IncrementalTokenizer::tokenize(const SourceIdSPtr& pSourceId, const std::string& source)
+{
+    mpSourceId = pSourceId;
+    mSource = source;
+    mStream = TokenStream();
+    mEnds.clear();
+    return retokenize(0, mSource.size(), 0);
+}
+
+bool IncrementalTokenizer::edit(size_t begin, size_t end, const std::string& text)
+{
+    begin = std::min(begin, mSource.size());
+    end = std::min(std::max(begin, end), mSource.size());
+    mSource.replace(begin, end - begin, text);
+
+    if (!mValid)
+        return tokenize(mpSourceId, mSource);
+
+    // the tokens keep the ones that end before the edit; the last kept
+    // token has to be followed by a white space, otherwise its end could
+    // depend on the characters after it
+    size_t kept = std::lower_bound(mEnds.begin(), mEnds.end(), begin, endsBefore) - mEnds.begin();
+    while (   (kept > 0)
+           && (   (mStream.tokens[kept - 1]->type() == Token::TYPE_COMMENT)
+               || !isWhitespace(mSource[mEnds[kept - 1].offset])))
+        --kept;
+
+    return retokenize(kept, begin + text.size(), (long long)text.size() - (long long)(end - begin));
+}
+
+bool IncrementalTokenizer::retokenize(size_t kept, size_t editEnd, long long delta)
+{
+    size_t offset = 0;
+    Line line(1);
+    Column column(1);
+    if (kept > 0)
+    {
+        offset = mEnds[kept - 1].offset;
+        line = mStream.tokens[kept - 1]->line();
+        column = mEnds[kept - 1].column;
+    }
+    const int editEndLine = line.value() + countLines(mSource, offset, std::min(editEnd, mSource.size()));
+
+    MessageCollectorPtr collector = boost::make_shared<MessageCollector>();
+    Tokenizer tokenizer(collector);
+    tokenizer.tokenize(mpSourceId, mSource, offset, line, column);
+
+    std::vector<TokenPtr> tokens;
+    std::vector<TokenEnd> ends;
+    size_t sync = mStream.tokens.size();
+    bool synced = false;
+    for (tokenizer.shift(); tokenizer.current(); tokenizer.shift())
+    {
+        const TokenPtr& token = tokenizer.current();
+        tokens.push_back(token);
+        TokenEnd end = { tokenizer.offset(), tokenizer.column() };
+        ends.push_back(end);
+
+        // after the edited lines the old tokens are reused from the first
+        // place where both the old and the new token end at the same
+        // offset and column; the column could differ within a line when an
+        // invalid character before it was consumed differently
+        if ((token->type() == Token::TYPE_COMMENT) || (token->line().value() <= editEndLine))
+            continue;
+
+        size_t oldOffset = (size_t)((long long)end.offset - delta);
+        std::vector<TokenEnd>::iterator it = std::lower_bound(mEnds.begin() + kept, mEnds.end(),
+                                                              oldOffset, endsBefore);
+        if ((it == mEnds.end()) || (it->offset != oldOffset) || (it->column != end.column))
+            continue;
+        size_t index = it - mEnds.begin();
+        if (mStream.tokens[index]->type() == Token::TYPE_COMMENT)
+            continue;
+
+        sync = index + 1;
+        synced = true;
+        break;
+    }
+
+    mTokenized = tokens.size();
+    mChangedToken = kept;
+    if (!collector->messages().empty())
+    {
+        mValid = false;
+        return false;
+    }
+
+    if (synced)
+    {
+        const int lineDelta = tokens.back()->line().value() - mStream.tokens[sync - 1]->line().value();
+        for (size_t i = sync; i < mStream.tokens.size(); ++i)
+        {
+            if (lineDelta)
+                mStream.tokens[i]->setLine(Line(mStream.tokens[i]->line().value() + lineDelta));
+            mEnds[i].offset = (size_t)((long long)mEnds[i].offset + delta);
+        }
+        mStream.endLine = Line(mStream.endLine.value() + lineDelta);
+    }
+    else
+    {
+        mStream.endLine = tokenizer.line();
+        mStream.endColumn = tokenizer.column();
+    }
+
+    mStream.tokens.erase(mStream.tokens.begin() + kept, mStream.tokens.begin() + sync);
+    mStream.tokens.insert(mStream.tokens.begin() + kept, tokens.begin(), tokens.end());
+    mEnds.erase(mEnds.begin() + kept, mEnds.begin() + sync);
+    mEnds.insert(mEnds.begin() + kept, ends.begin(), ends.end());
+    mValid = true;
+    return true;
+}
+
+const std::string& IncrementalTokenizer::source() const
+{
+    return mSource;
+}
+
+const TokenStream& IncrementalTokenizer::stream() const
+{
+    return mStream;
+}
+
+bool IncrementalTokenizer::valid() const
+{
+    return mValid;
+}
+
+size_t IncrementalTokenizer::changedToken() const
+{
+    return mChangedToken;
+}
+
+size_t IncrementalTokenizer::tokenized() const
+{
+    return mTokenized;
+}
+
+}
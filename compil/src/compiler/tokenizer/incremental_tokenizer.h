@@ -0,0 +1,114 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#ifndef _COMPIL_INCREMENTAL_TOKENIZER_H__
+#define _COMPIL_INCREMENTAL_TOKENIZER_H__
+
+#include "compiler/tokenizer/token_cache.h"
+
+#include <boost/shared_ptr.hpp>
+
+#include <string>
+#include <vector>
+
+namespace compil
+{
+
+// Keeps the token stream of a source that is edited in place. An edit
+// tokenizes again only the changed part of the source. The tokenization
+// starts after the last token that ends before the edit and is followed
+// by a white space, and stops at the first token after the edited lines
+// that ends at the same place as an old token. The rest of the old tokens
+// are kept with their lines shifted.
+class IncrementalTokenizer
+{
+public:
+    IncrementalTokenizer();
+    ~IncrementalTokenizer();
+
+    // tokenizes the whole source. Returns false if the tokenizer reported
+    // an error, the stream is not usable until the next successful
+    // tokenization then
+    bool tokenize(const SourceIdSPtr& pSourceId, const std::string& source);
+
+    // replaces the [begin, end) range of the source with the text and
+    // tokenizes the change. Returns false if the tokenizer reported an
+    // error. After such error the next edit tokenizes the whole source
+    bool edit(size_t begin, size_t end, const std::string& text);
+
+    // where the tokenizer stopped after a token
+    struct TokenEnd
+    {
+        size_t offset;
+        Column column;
+    };
+
+    const std::string& source() const;
+    const TokenStream& stream() const;
+
+    // false after a tokenizer error
+    bool valid() const;
+
+    // the index of the first token that could differ from the stream
+    // before the last edit
+    size_t changedToken() const;
+
+    // the number of the tokens produced by the last edit
+    size_t tokenized() const;
+
+private:
+    bool retokenize(size_t kept, size_t editEnd, long long delta);
+
+    SourceIdSPtr mpSourceId;
+    std::string mSource;
+    TokenStream mStream;
+    std::vector<TokenEnd> mEnds;
+    bool mValid;
+    size_t mChangedToken;
+    size_t mTokenized;
+};
+
+typedef boost::shared_ptr<IncrementalTokenizer> IncrementalTokenizerSPtr;
+
+}
+
+#else
+
+namespace compil
+{
+
+class IncrementalTokenizer;
+typedef boost::shared_ptr<IncrementalTokenizer> IncrementalTokenizerSPtr;
+
+}
+
+#endif // _COMPIL_INCREMENTAL_TOKENIZER_H__
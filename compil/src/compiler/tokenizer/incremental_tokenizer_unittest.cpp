@@ -0,0 +1,187 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/tokenizer/incremental_tokenizer.h"
+#include "compiler/tokenizer/tokenizer.h"
+
+#include "gtest/gtest.h"
+
+#include <boost/make_shared.hpp>
+
+#include <sstream>
+
+class IncrementalTokenizerTests : public testing::Test
+{
+protected:
+    // tokenizes the source from scratch, returns false on tokenizer error
+    static bool tokenize(const std::string& source, compil::TokenStream& stream)
+    {
+        compil::MessageCollectorPtr collector = boost::make_shared<compil::MessageCollector>();
+        compil::Tokenizer tokenizer(collector, compil::SourceIdSPtr(),
+                                    boost::make_shared<std::istringstream>(source));
+        for (; tokenizer.current(); tokenizer.shift())
+            stream.tokens.push_back(tokenizer.current());
+        stream.endLine = tokenizer.line();
+        stream.endColumn = tokenizer.column();
+        return collector->messages().empty();
+    }
+
+    static void expectSameStream(const compil::TokenStream& expected,
+                                 const compil::TokenStream& actual,
+                                 const std::string& source)
+    {
+        ASSERT_EQ(expected.tokens.size(), actual.tokens.size()) << source;
+        for (size_t i = 0; i < expected.tokens.size(); ++i)
+        {
+            EXPECT_EQ(expected.tokens[i]->type(), actual.tokens[i]->type()) << i << source;
+            EXPECT_EQ(expected.tokens[i]->text(), actual.tokens[i]->text()) << i << source;
+            EXPECT_EQ(expected.tokens[i]->line(), actual.tokens[i]->line()) << i << source;
+            EXPECT_EQ(expected.tokens[i]->beginColumn(), actual.tokens[i]->beginColumn()) << i << source;
+            EXPECT_EQ(expected.tokens[i]->endColumn(), actual.tokens[i]->endColumn()) << i << source;
+        }
+        EXPECT_EQ(expected.endLine, actual.endLine) << source;
+        EXPECT_EQ(expected.endColumn, actual.endColumn) << source;
+    }
+};
+
+static const char* gSource =
+    "compil { }\n"
+    "// line comment\n"
+    "package a.b;\n"
+    "\n"
+    "/* block\n"
+    "\tcomment */\n"
+    "structure S1 // trailing\n"
+    "{\r\n"
+    "    integer i = 0x1F;\n"
+    "\treal r = -1.5e+3;\n"
+    "    string s = \"a\\\"b\";\n"
+    "}\n"
+    "\n"
+    "enum E { a = 1, b = 2 | 3, }\n"
+    "factory<->x;\n"
+    "structure S2 { vector<S1> v; }\n";
+
+TEST_F(IncrementalTokenizerTests, tokenize)
+{
+    compil::IncrementalTokenizer incremental;
+    ASSERT_TRUE(incremental.tokenize(compil::SourceIdSPtr(), gSource));
+
+    compil::TokenStream expected;
+    ASSERT_TRUE(tokenize(gSource, expected));
+    expectSameStream(expected, incremental.stream(), gSource);
+    EXPECT_EQ(gSource, incremental.source());
+}
+
+TEST_F(IncrementalTokenizerTests, editInTheMiddle)
+{
+    std::ostringstream source;
+    for (int i = 0; i < 1000; ++i)
+        source << "structure S" << i << "\n{\n    integer f = " << i << ";\n}\n";
+
+    compil::IncrementalTokenizer incremental;
+    ASSERT_TRUE(incremental.tokenize(compil::SourceIdSPtr(), source.str()));
+    const size_t tokens = incremental.stream().tokens.size();
+
+    // "integer f = 500;" -> "integer field = 500;\n    long l;"
+    size_t offset = incremental.source().find("f = 500;");
+    ASSERT_TRUE(incremental.edit(offset + 1, offset + 1, "ield"));
+    offset = incremental.source().find("500;") + 4;
+    ASSERT_TRUE(incremental.edit(offset, offset, "\n    long l;"));
+
+    EXPECT_GT(10U, incremental.tokenized());
+    EXPECT_LT(500U * 9, incremental.changedToken());
+    EXPECT_EQ(tokens + 3, incremental.stream().tokens.size());
+
+    compil::TokenStream expected;
+    ASSERT_TRUE(tokenize(incremental.source(), expected));
+    expectSameStream(expected, incremental.stream(), incremental.source());
+}
+
+TEST_F(IncrementalTokenizerTests, tokenizerError)
+{
+    compil::IncrementalTokenizer incremental;
+    ASSERT_TRUE(incremental.tokenize(compil::SourceIdSPtr(), gSource));
+
+    const std::string source = gSource;
+    size_t offset = source.find("structure S2");
+    EXPECT_FALSE(incremental.edit(offset, offset, "/* open "));
+    EXPECT_EQ(source.substr(0, offset) + "/* open " + source.substr(offset), incremental.source());
+
+    EXPECT_TRUE(incremental.edit(offset, offset + 8, ""));
+    EXPECT_EQ(0U, incremental.changedToken());
+
+    compil::TokenStream expected;
+    ASSERT_TRUE(tokenize(gSource, expected));
+    expectSameStream(expected, incremental.stream(), gSource);
+}
+
+TEST_F(IncrementalTokenizerTests, randomEdits)
+{
+    static const char* insertions[] =
+    {
+        "", " ", "\t", "\n", "\r\n", "x", "_y1", "12", ".5", "e", "-", "+", "<", ">",
+        "<->", "/", "*", "//", "/*", "*/", "\"", "\\", "{", "}", ";", ",", "=", "|",
+        "structure T\n{\n}\n", "/* a\n b */", "// c\n"
+    };
+    const size_t count = sizeof(insertions) / sizeof(insertions[0]);
+
+    compil::IncrementalTokenizer incremental;
+    ASSERT_TRUE(incremental.tokenize(compil::SourceIdSPtr(), gSource));
+
+    unsigned int seed = 7;
+    for (int i = 0; i < 3000; ++i)
+    {
+        const std::string& source = incremental.source();
+        seed = seed * 1103515245 + 12345;
+        size_t begin = (seed >> 8) % (source.size() + 1);
+        seed = seed * 1103515245 + 12345;
+        size_t end = std::min(source.size(), begin + (seed >> 8) % 4);
+        seed = seed * 1103515245 + 12345;
+        const char* text = insertions[(seed >> 8) % count];
+
+        bool result = incremental.edit(begin, end, text);
+
+        compil::TokenStream expected;
+        ASSERT_EQ(tokenize(incremental.source(), expected), result) << incremental.source();
+        if (result)
+            expectSameStream(expected, incremental.stream(), incremental.source());
+        if (HasFailure())
+            return;
+
+        // keeps the source from growing or degenerating
+        if ((incremental.source().size() > 2000) || (i % 300 == 299))
+        {
+            ASSERT_EQ(tokenize(gSource, expected), incremental.tokenize(compil::SourceIdSPtr(), gSource));
+        }
+    }
+}
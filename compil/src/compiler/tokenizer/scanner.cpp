@@ -0,0 +1,213 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/tokenizer/scanner.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#  define COMPIL_SCANNER_SSE2
+#  include <emmintrin.h>
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  endif
+#endif
+
+namespace compil
+{
+
+static bool isWhiteSpace(char ch)
+{
+    return (ch == ' ') || ((ch >= '\t') && (ch <= '\r'));
+}
+
+static bool isEOL(char ch)
+{
+    return (ch == '\n') || (ch == '\r');
+}
+
+static bool isIdentifier(char ch)
+{
+    return
+           ((ch >= 'a') && (ch <= 'z'))
+        || ((ch >= 'A') && (ch <= 'Z'))
+        || ((ch >= '0') && (ch <= '9'))
+        || (ch == '_');
+}
+
+#if defined(COMPIL_SCANNER_SSE2)
+
+static int firstBit(int mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, (unsigned long)mask);
+    return (int)index;
+#else
+    return __builtin_ctz((unsigned int)mask);
+#endif
+}
+
+static __m128i set(char ch)
+{
+    return _mm_set1_epi8(ch);
+}
+
+// the characters in the range [low, low + size] have (ch - low) unsigned no
+// greater than size
+static __m128i inRange(__m128i chars, char low, char size)
+{
+    __m128i offset = _mm_sub_epi8(chars, set(low));
+    return _mm_cmpeq_epi8(_mm_min_epu8(offset, set(size)), offset);
+}
+
+static __m128i load(const char* position)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+}
+
+// the masks have the bits of the characters that stop the run set
+static int whiteSpaces(__m128i chars)
+{
+    return ~_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chars, set(' ')),
+                                          inRange(chars, '\t', '\r' - '\t'))) & 0xFFFF;
+}
+
+static int lineComment(__m128i chars)
+{
+    return _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chars, set('\n')),
+                                          _mm_cmpeq_epi8(chars, set('\r'))));
+}
+
+static int blockComment(__m128i chars)
+{
+    return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, set('\n')),
+                                                       _mm_cmpeq_epi8(chars, set('\r'))),
+                                          _mm_cmpeq_epi8(chars, set('*'))));
+}
+
+static int stringLiteral(__m128i chars, char quotationMark)
+{
+    return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, set('\n')),
+                                                       _mm_cmpeq_epi8(chars, set('\r'))),
+                                          _mm_or_si128(_mm_cmpeq_epi8(chars, set('\\')),
+                                                       _mm_cmpeq_epi8(chars, set(quotationMark)))));
+}
+
+static int identifier(__m128i chars)
+{
+    // the letters differ only in bit 5 between the cases
+    __m128i letter = inRange(_mm_or_si128(chars, set(0x20)), 'a', 'z' - 'a');
+    __m128i digit = inRange(chars, '0', '9' - '0');
+    __m128i underscore = _mm_cmpeq_epi8(chars, set('_'));
+    return ~_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letter, digit), underscore)) & 0xFFFF;
+}
+
+#endif
+
+const char* scanWhiteSpaces(const char* begin, const char* end)
+{
+#if defined(COMPIL_SCANNER_SSE2)
+    for (; end - begin >= 16; begin += 16)
+    {
+        int mask = whiteSpaces(load(begin));
+        if (mask)
+            return begin + firstBit(mask);
+    }
+#endif
+    while ((begin != end) && isWhiteSpace(*begin))
+        ++begin;
+    return begin;
+}
+
+const char* scanLineComment(const char* begin, const char* end)
+{
+#if defined(COMPIL_SCANNER_SSE2)
+    for (; end - begin >= 16; begin += 16)
+    {
+        int mask = lineComment(load(begin));
+        if (mask)
+            return begin + firstBit(mask);
+    }
+#endif
+    while ((begin != end) && !isEOL(*begin))
+        ++begin;
+    return begin;
+}
+
+const char* scanBlockComment(const char* begin, const char* end)
+{
+#if defined(COMPIL_SCANNER_SSE2)
+    for (; end - begin >= 16; begin += 16)
+    {
+        int mask = blockComment(load(begin));
+        if (mask)
+            return begin + firstBit(mask);
+    }
+#endif
+    while ((begin != end) && !isEOL(*begin) && (*begin != '*'))
+        ++begin;
+    return begin;
+}
+
+const char* scanString(const char* begin, const char* end, char quotationMark)
+{
+#if defined(COMPIL_SCANNER_SSE2)
+    for (; end - begin >= 16; begin += 16)
+    {
+        int mask = stringLiteral(load(begin), quotationMark);
+        if (mask)
+            return begin + firstBit(mask);
+    }
+#endif
+    while (   (begin != end)
+           && !isEOL(*begin)
+           && (*begin != '\\')
+           && (*begin != quotationMark))
+        ++begin;
+    return begin;
+}
+
+const char* scanIdentifier(const char* begin, const char* end)
+{
+#if defined(COMPIL_SCANNER_SSE2)
+    for (; end - begin >= 16; begin += 16)
+    {
+        int mask = identifier(load(begin));
+        if (mask)
+            return begin + firstBit(mask);
+    }
+#endif
+    while ((begin != end) && isIdentifier(*begin))
+        ++begin;
+    return begin;
+}
+
+}
@@ -0,0 +1,61 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#ifndef _COMPIL_SCANNER_H__
+#define _COMPIL_SCANNER_H__
+
+namespace compil
+{
+
+// Each scan returns the first character in [begin, end) that stops the
+// run, or end when the whole range belongs to the run. The scans test
+// 16 characters at a time with SSE2 where available and fall back to a
+// character by character loop otherwise.
+
+// stops at the first character that is not a white space
+const char* scanWhiteSpaces(const char* begin, const char* end);
+
+// stops at the first end of line character
+const char* scanLineComment(const char* begin, const char* end);
+
+// stops at the first '*' or end of line character
+const char* scanBlockComment(const char* begin, const char* end);
+
+// stops at the first closing quotation mark, escape or end of line character
+const char* scanString(const char* begin, const char* end, char quotationMark);
+
+// stops at the first character that is not a letter, a digit or underscore
+const char* scanIdentifier(const char* begin, const char* end);
+
+}
+
+#endif // _COMPIL_SCANNER_H__
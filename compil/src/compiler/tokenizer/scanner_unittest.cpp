@@ -0,0 +1,108 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/tokenizer/scanner.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+// every stop character is tried at every offset of runs longer than a
+// vector, so the vector loop, its tail and the scalar loop are all covered
+static void testScan(const char* (*scan)(const char*, const char*),
+                     char run,
+                     char stop)
+{
+    for (size_t size = 0; size < 50; ++size)
+    {
+        std::string text(size, run);
+        EXPECT_EQ(text.data() + size, scan(text.data(), text.data() + size)) << size;
+
+        for (size_t offset = 0; offset < size; ++offset)
+        {
+            std::string text(size, run);
+            text[offset] = stop;
+            EXPECT_EQ(text.data() + offset, scan(text.data(), text.data() + size))
+                << size << " " << offset << " " << (int)stop;
+        }
+    }
+}
+
+static const char* scanSingleQuotedString(const char* begin, const char* end)
+{
+    return compil::scanString(begin, end, '\'');
+}
+
+TEST(ScannerTests, whiteSpaces)
+{
+    const char runs[] = { ' ', '\t', '\n', '\v', '\f', '\r' };
+    const char stops[] = { 'a', '/', '\0', '\x08', '\x0E', '!', '\x80', '\xA0' };
+    for (size_t r = 0; r < sizeof(runs); ++r)
+    for (size_t s = 0; s < sizeof(stops); ++s)
+        testScan(&compil::scanWhiteSpaces, runs[r], stops[s]);
+}
+
+TEST(ScannerTests, lineComment)
+{
+    const char runs[] = { 'a', ' ', '\t', '*', '/', '\x80' };
+    const char stops[] = { '\n', '\r' };
+    for (size_t r = 0; r < sizeof(runs); ++r)
+    for (size_t s = 0; s < sizeof(stops); ++s)
+        testScan(&compil::scanLineComment, runs[r], stops[s]);
+}
+
+TEST(ScannerTests, blockComment)
+{
+    const char runs[] = { 'a', ' ', '\t', '/', '\x80' };
+    const char stops[] = { '\n', '\r', '*' };
+    for (size_t r = 0; r < sizeof(runs); ++r)
+    for (size_t s = 0; s < sizeof(stops); ++s)
+        testScan(&compil::scanBlockComment, runs[r], stops[s]);
+}
+
+TEST(ScannerTests, string)
+{
+    const char runs[] = { 'a', ' ', '"', '\x80' };
+    const char stops[] = { '\n', '\r', '\\', '\'' };
+    for (size_t r = 0; r < sizeof(runs); ++r)
+    for (size_t s = 0; s < sizeof(stops); ++s)
+        testScan(&scanSingleQuotedString, runs[r], stops[s]);
+}
+
+TEST(ScannerTests, identifier)
+{
+    const char runs[] = { 'a', 'z', 'A', 'Z', '0', '9', '_' };
+    const char stops[] = { ' ', '@', '[', '`', '{', '/', ':', '.', '\x80', '\xC1', '\xE1' };
+    for (size_t r = 0; r < sizeof(runs); ++r)
+    for (size_t s = 0; s < sizeof(stops); ++s)
+        testScan(&compil::scanIdentifier, runs[r], stops[s]);
+}
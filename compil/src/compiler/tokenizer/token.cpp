@@ -59,11 +59,21 @@ std::string Token::text() const
     return mText;
 }
 
+void Token::setText(const std::string& text)
+{
+    mText = text;
+}
+
 void Token::addChar(int ch)
 {
     mText += (char)ch;
 }
 
+void Token::addText(const char* text, size_t size)
+{
+    mText.append(text, size);
+}
+
 const Line& Token::line() const
 {
     return mLine;
@@ -121,7 +121,9 @@ public:
     void setType(Type type);
 
     std::string text() const;
+    void setText(const std::string& text);
     void addChar(int ch);
+    void addText(const char* text, size_t size);
     
     const Line& line() const;
     void setLine(const Line& line);
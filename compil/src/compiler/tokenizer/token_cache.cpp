@@ -0,0 +1,303 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/tokenizer/token_cache.h"
+
+#include "core/platform/version.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/make_shared.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <string.h>
+
+namespace compil
+{
+
+// Bump the format every time the file layout, the token layout or the
+// tokenizer rules change:
+//     1 - initial format
+//     2 - vector scanned comments, strings and identifiers, no comments mode
+//     3 - the source content follows its size
+#define COMPILC_FORMAT "3"
+
+// the files of the other tools versions are never used
+static const std::string gSignature = "compilc " COMPILC_FORMAT " compil " COMPIL_VERSION;
+
+static void writeInteger(std::ostream& stream, unsigned long long value, int size)
+{
+    for (int i = 0; i < size; ++i)
+    {
+        stream.put((char)(value & 0xFF));
+        value >>= 8;
+    }
+}
+
+static void writeString(std::ostream& stream, const std::string& value)
+{
+    writeInteger(stream, value.size(), 4);
+    stream.write(value.data(), value.size());
+}
+
+class CacheReader
+{
+public:
+    CacheReader(const char* begin, const char* end)
+        : mPosition(begin)
+        , mEnd(end)
+        , mValid(true)
+    {
+    }
+
+    unsigned long long readInteger(int size)
+    {
+        if (mEnd - mPosition < size)
+        {
+            mValid = false;
+            return 0;
+        }
+
+        unsigned long long value = 0;
+        for (int i = size - 1; i >= 0; --i)
+            value = (value << 8) | (unsigned char)mPosition[i];
+        mPosition += size;
+        return value;
+    }
+
+    std::string readString()
+    {
+        unsigned long long size = readInteger(4);
+        if (!mValid || ((unsigned long long)(mEnd - mPosition) < size))
+        {
+            mValid = false;
+            return "";
+        }
+
+        std::string value(mPosition, (size_t)size);
+        mPosition += size;
+        return value;
+    }
+
+    // true if the next bytes are the same as the content, they are skipped
+    bool matches(const std::string& content)
+    {
+        if (!mValid || ((size_t)(mEnd - mPosition) < content.size()))
+        {
+            mValid = false;
+            return false;
+        }
+
+        if (memcmp(mPosition, content.data(), content.size()) != 0)
+            return false;
+        mPosition += content.size();
+        return true;
+    }
+
+    bool valid() const
+    {
+        return mValid;
+    }
+
+private:
+    const char* mPosition;
+    const char* mEnd;
+    bool mValid;
+};
+
+TokenCache::TokenCache(const boost::filesystem::path& directory)
+    : mDirectory(directory)
+    , mHits(0)
+    , mMisses(0)
+{
+}
+
+TokenCache::~TokenCache()
+{
+}
+
+unsigned long long TokenCache::hash(const std::string& content)
+{
+    // 64 bit FNV-1a
+    unsigned long long result = 14695981039346656037ULL;
+    for (std::string::const_iterator it = content.begin(); it != content.end(); ++it)
+    {
+        result ^= (unsigned char)*it;
+        result *= 1099511628211ULL;
+    }
+    return result;
+}
+
+const boost::filesystem::path& TokenCache::directory() const
+{
+    return mDirectory;
+}
+
+boost::filesystem::path TokenCache::filePath(const std::string& content) const
+{
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << hash(content)
+         << ".compilc";
+    return mDirectory / name.str();
+}
+
+bool TokenCache::load(const std::string& content, TokenStream& stream)
+{
+    boost::filesystem::path path = filePath(content);
+
+    boost::system::error_code ec;
+    if (!boost::filesystem::exists(path, ec) || boost::filesystem::is_empty(path, ec))
+    {
+        ++mMisses;
+        return false;
+    }
+
+    try
+    {
+        namespace bip = boost::interprocess;
+        bip::file_mapping mapping(path.string().c_str(), bip::read_only);
+        bip::mapped_region region(mapping, bip::read_only);
+
+        const char* begin = static_cast<const char*>(region.get_address());
+        CacheReader reader(begin, begin + region.get_size());
+
+        if (   (reader.readString() != gSignature)
+            || (reader.readInteger(8) != hash(content))
+            || (reader.readInteger(8) != content.size())
+            // the hash is not a digest, so a colliding source has to be rejected
+            || !reader.matches(content))
+        {
+            ++mMisses;
+            return false;
+        }
+
+        TokenStream result;
+        result.endLine = Line((long)reader.readInteger(4));
+        result.endColumn = Column((long)reader.readInteger(4));
+
+        unsigned long long count = reader.readInteger(4);
+        result.tokens.reserve((size_t)count);
+        for (unsigned long long i = 0; reader.valid() && (i < count); ++i)
+        {
+            TokenPtr token = boost::make_shared<Token>();
+            token->setType((Token::Type)reader.readInteger(4));
+            token->setLine(Line((long)reader.readInteger(4)));
+            token->setBeginColumn(Column((long)reader.readInteger(4)));
+            token->setEndColumn(Column((long)reader.readInteger(4)));
+            token->setText(reader.readString());
+            result.tokens.push_back(token);
+        }
+
+        if (!reader.valid())
+        {
+            ++mMisses;
+            return false;
+        }
+
+        stream = result;
+    }
+    catch (const std::exception&)
+    {
+        ++mMisses;
+        return false;
+    }
+
+    ++mHits;
+    return true;
+}
+
+bool TokenCache::store(const std::string& content, const TokenStream& stream)
+{
+    boost::filesystem::path path = filePath(content);
+
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(mDirectory, ec);
+
+    // write in a temporary file first so concurrent generators never see
+    // partially written cache
+    boost::filesystem::path temporary = path;
+    temporary += boost::filesystem::unique_path(".%%%%-%%%%").string();
+
+    {
+        std::ofstream file(temporary.string().c_str(), std::ios::binary);
+        if (!file.is_open())
+            return false;
+
+        writeString(file, gSignature);
+        writeInteger(file, hash(content), 8);
+        writeInteger(file, content.size(), 8);
+        file.write(content.data(), content.size());
+        writeInteger(file, stream.endLine.value(), 4);
+        writeInteger(file, stream.endColumn.value(), 4);
+
+        writeInteger(file, stream.tokens.size(), 4);
+        for (std::vector<TokenPtr>::const_iterator it = stream.tokens.begin(); it != stream.tokens.end(); ++it)
+        {
+            const TokenPtr& token = *it;
+            writeInteger(file, token->type(), 4);
+            writeInteger(file, token->line().value(), 4);
+            writeInteger(file, token->beginColumn().value(), 4);
+            writeInteger(file, token->endColumn().value(), 4);
+            writeString(file, token->text());
+        }
+
+        if (!file.good())
+        {
+            file.close();
+            boost::filesystem::remove(temporary, ec);
+            return false;
+        }
+    }
+
+    boost::filesystem::rename(temporary, path, ec);
+    if (ec)
+    {
+        boost::filesystem::remove(temporary, ec);
+        return false;
+    }
+    return true;
+}
+
+int TokenCache::hits() const
+{
+    return mHits;
+}
+
+int TokenCache::misses() const
+{
+    return mMisses;
+}
+
+}
@@ -0,0 +1,102 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#ifndef _COMPIL_TOKEN_CACHE_H__
+#define _COMPIL_TOKEN_CACHE_H__
+
+#include "compiler/tokenizer/token.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <string>
+#include <vector>
+
+namespace compil
+{
+
+// The tokens of a source together with the position where the
+// tokenization ended
+struct TokenStream
+{
+    std::vector<TokenPtr> tokens;
+    Line endLine;
+    Column endColumn;
+};
+
+// Precompiled token cache. The token stream of every source is stored in
+// a separate binary .compilc file in the cache directory. The file name is
+// the hash of the source content and the file starts with a signature
+// identifying the format and the compiler version, so modified sources
+// and files from different compiler versions are never used. The file
+// keeps a copy of the source, so a source with a colliding hash is never
+// given the tokens of another one. The files are memory mapped when
+// loaded.
+class TokenCache
+{
+public:
+    TokenCache(const boost::filesystem::path& directory);
+    ~TokenCache();
+
+    bool load(const std::string& content, TokenStream& stream);
+    bool store(const std::string& content, const TokenStream& stream);
+
+    const boost::filesystem::path& directory() const;
+    boost::filesystem::path filePath(const std::string& content) const;
+
+    int hits() const;
+    int misses() const;
+
+    static unsigned long long hash(const std::string& content);
+
+private:
+    boost::filesystem::path mDirectory;
+    int mHits;
+    int mMisses;
+};
+
+typedef boost::shared_ptr<TokenCache> TokenCacheSPtr;
+
+}
+
+#else
+
+namespace compil
+{
+
+struct TokenStream;
+class TokenCache;
+typedef boost::shared_ptr<TokenCache> TokenCacheSPtr;
+
+}
+
+#endif
@@ -0,0 +1,201 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/tokenizer/token_cache.h"
+#include "compiler/tokenizer/tokenizer.h"
+
+#include "gtest/gtest.h"
+
+#include <boost/make_shared.hpp>
+
+#include <fstream>
+#include <sstream>
+
+class TokenCacheTests : public testing::Test
+{
+public:
+    virtual void SetUp()
+    {
+        mDirectory = boost::filesystem::temp_directory_path()
+                   / boost::filesystem::unique_path("compilc-%%%%-%%%%-%%%%");
+        mCache = boost::make_shared<compil::TokenCache>(mDirectory);
+    }
+
+    virtual void TearDown()
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(mDirectory, ec);
+    }
+
+protected:
+    compil::TokenStream tokenize(const std::string& content)
+    {
+        compil::MessageCollectorPtr collector = boost::make_shared<compil::MessageCollector>();
+        compil::Tokenizer tokenizer(collector, compil::SourceIdSPtr(),
+                                    boost::make_shared<std::istringstream>(content));
+        compil::TokenStream stream;
+        for (; tokenizer.current(); tokenizer.shift())
+            stream.tokens.push_back(tokenizer.current());
+        stream.endLine = tokenizer.line();
+        stream.endColumn = tokenizer.column();
+        return stream;
+    }
+
+    boost::filesystem::path mDirectory;
+    compil::TokenCacheSPtr mCache;
+};
+
+static const char* gSource =
+    "// comment\n"
+    "package a.b;\n"
+    "/* block\n"
+    "   comment */\n"
+    "structure S\n"
+    "{\n"
+    "\tinteger i = 5;\n"
+    "\tstring s = \"text\";\n"
+    "}\n";
+
+TEST_F(TokenCacheTests, miss)
+{
+    compil::TokenStream stream;
+    EXPECT_FALSE(mCache->load(gSource, stream));
+    EXPECT_EQ(0, mCache->hits());
+    EXPECT_EQ(1, mCache->misses());
+}
+
+TEST_F(TokenCacheTests, storeLoad)
+{
+    compil::TokenStream stored = tokenize(gSource);
+    ASSERT_TRUE(mCache->store(gSource, stored));
+    EXPECT_TRUE(boost::filesystem::exists(mCache->filePath(gSource)));
+
+    compil::TokenStream loaded;
+    ASSERT_TRUE(mCache->load(gSource, loaded));
+    EXPECT_EQ(1, mCache->hits());
+
+    ASSERT_EQ(stored.tokens.size(), loaded.tokens.size());
+    for (size_t i = 0; i < stored.tokens.size(); ++i)
+    {
+        EXPECT_EQ(stored.tokens[i]->type(), loaded.tokens[i]->type());
+        EXPECT_EQ(stored.tokens[i]->text(), loaded.tokens[i]->text());
+        EXPECT_EQ(stored.tokens[i]->line(), loaded.tokens[i]->line());
+        EXPECT_EQ(stored.tokens[i]->beginColumn(), loaded.tokens[i]->beginColumn());
+        EXPECT_EQ(stored.tokens[i]->endColumn(), loaded.tokens[i]->endColumn());
+    }
+    EXPECT_EQ(stored.endLine, loaded.endLine);
+    EXPECT_EQ(stored.endColumn, loaded.endColumn);
+}
+
+TEST_F(TokenCacheTests, changedContent)
+{
+    ASSERT_TRUE(mCache->store(gSource, tokenize(gSource)));
+
+    std::string changed = std::string(gSource) + "enum E {}\n";
+    compil::TokenStream loaded;
+    EXPECT_FALSE(mCache->load(changed, loaded));
+}
+
+TEST_F(TokenCacheTests, hashCollision)
+{
+    ASSERT_TRUE(mCache->store(gSource, tokenize(gSource)));
+
+    // the file of the other source is the stored one with the hash of the
+    // other source, as if both sources had the same hash
+    std::string other = gSource;
+    other[other.find('5')] = '6';
+    ASSERT_EQ(std::string(gSource).size(), other.size());
+
+    std::string data;
+    {
+        std::ifstream file(mCache->filePath(gSource).string().c_str(), std::ios::binary);
+        std::ostringstream buffer;
+        buffer << file.rdbuf();
+        data = buffer.str();
+    }
+    size_t position = 4 + (unsigned char)data[0];
+    unsigned long long hash = compil::TokenCache::hash(other);
+    for (int i = 0; i < 8; ++i, hash >>= 8)
+        data[position + i] = (char)(hash & 0xFF);
+    {
+        std::ofstream file(mCache->filePath(other).string().c_str(), std::ios::binary);
+        file << data;
+    }
+
+    compil::TokenStream loaded;
+    EXPECT_FALSE(mCache->load(other, loaded));
+    EXPECT_TRUE(mCache->load(gSource, loaded));
+}
+
+TEST_F(TokenCacheTests, corrupted)
+{
+    ASSERT_TRUE(mCache->store(gSource, tokenize(gSource)));
+
+    boost::filesystem::path path = mCache->filePath(gSource);
+    std::string data;
+    {
+        std::ifstream file(path.string().c_str(), std::ios::binary);
+        std::ostringstream buffer;
+        buffer << file.rdbuf();
+        data = buffer.str();
+    }
+    {
+        std::ofstream file(path.string().c_str(), std::ios::binary | std::ios::trunc);
+        file << data.substr(0, data.size() / 2);
+    }
+
+    compil::TokenStream loaded;
+    EXPECT_FALSE(mCache->load(gSource, loaded));
+}
+
+TEST_F(TokenCacheTests, replay)
+{
+    compil::TokenStream stream = tokenize(gSource);
+
+    compil::MessageCollectorPtr collector = boost::make_shared<compil::MessageCollector>();
+    compil::Tokenizer lazy(collector, compil::SourceIdSPtr(),
+                           boost::make_shared<std::istringstream>(gSource));
+    compil::Tokenizer replayed(collector);
+    replayed.replay(compil::SourceIdSPtr(), stream);
+
+    for (; lazy.current(); lazy.shift(), replayed.shift())
+    {
+        ASSERT_TRUE(replayed.current());
+        EXPECT_EQ(lazy.current()->type(), replayed.current()->type());
+        EXPECT_EQ(lazy.current()->text(), replayed.current()->text());
+        EXPECT_EQ(lazy.current()->line(), replayed.current()->line());
+        EXPECT_EQ(lazy.current()->beginColumn(), replayed.current()->beginColumn());
+    }
+    EXPECT_TRUE(replayed.eot());
+    EXPECT_EQ(lazy.line(), replayed.line());
+    EXPECT_EQ(lazy.column(), replayed.column());
+}
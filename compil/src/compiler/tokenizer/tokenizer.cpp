@@ -31,7 +31,11 @@
 //
 
 #include "compiler/tokenizer/tokenizer.h"
+#include "compiler/tokenizer/scanner.h"
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
 #include <sstream>
 
 namespace compil
@@ -39,9 +43,13 @@ namespace compil
 
 Tokenizer::Tokenizer(const MessageCollectorPtr& pMessageCollector)
         : mpMessageCollector(pMessageCollector)
+        , mPosition(0)
         , mCurrentLine(0)
         , mCurrentColumn(0)
         , mBlockComment(false)
+        , mDiscardComments(false)
+        , mReplay(false)
+        , mNextToken(0)
 {
 }
 
@@ -49,9 +57,13 @@ Tokenizer::Tokenizer(const MessageCollectorPtr& pMessageCollector,
                      const SourceIdSPtr& pSourceId, 
                      const boost::shared_ptr<std::istream>& pInput)
         : mpMessageCollector(pMessageCollector)
+        , mPosition(0)
         , mCurrentLine(0)
         , mCurrentColumn(0)
         , mBlockComment(false)
+        , mDiscardComments(false)
+        , mReplay(false)
+        , mNextToken(0)
 {
     tokenize(pSourceId, pInput);
     shift();
@@ -66,11 +78,46 @@ void Tokenizer::tokenize(const SourceIdSPtr& pSourceId, const boost::shared_ptr<
     BOOST_ASSERT(!mpInput);
     mpSourceId = pSourceId;
     mpInput = pInput;
+    mSource.assign(std::istreambuf_iterator<char>(*pInput), std::istreambuf_iterator<char>());
+    mPosition = 0;
     mCurrentLine = 0;
     mCurrentColumn = 0;
     mBlockComment = false;
 }
 
+void Tokenizer::tokenize(const SourceIdSPtr& pSourceId, const std::string& source,
+                         size_t offset, const Line& line, const Column& column)
+{
+    BOOST_ASSERT(!mpInput);
+    mpSourceId = pSourceId;
+    // a private copy; a shared copy-on-write buffer would be reallocated
+    // by the first non const access, leaving the scanned positions behind
+    mSource.assign(source.data(), source.size());
+    mPosition = std::min(offset, mSource.size());
+    mCurrentLine = line.value() - 1;
+    mCurrentColumn = column.value() - 1;
+    mBlockComment = false;
+}
+
+void Tokenizer::replay(const SourceIdSPtr& pSourceId, const TokenStream& stream, size_t index)
+{
+    BOOST_ASSERT(!mpInput);
+    mpSourceId = pSourceId;
+    mReplay = true;
+    mTokens = stream.tokens;
+    mNextToken = std::min(index, mTokens.size());
+    mEndLine = stream.endLine;
+    mEndColumn = stream.endColumn;
+    mCurrentLine = 0;
+    mCurrentColumn = 0;
+    shift();
+}
+
+void Tokenizer::setDiscardComments(bool discard)
+{
+    mDiscardComments = discard;
+}
+
 static bool isEOL(int ch)
 {
     return 
@@ -279,17 +326,9 @@ static bool isPortableFilepathChar(int ch)
 
 void Tokenizer::skipWhiteSpaces()
 {
-    while (!eof())
-    {
-        int ch = mpInput->get();
-        if (!isWhitespace(ch))
-		{
-            mpInput->clear();
-		    mpInput->unget();
-			break;
-		}
-		absorbed(ch);
-    }
+    const char* stop = scanWhiteSpaces(position(), end());
+    while (position() < stop)
+        absorbed(get());
 }
 
 void Tokenizer::skipEOL()
@@ -297,34 +336,79 @@ void Tokenizer::skipEOL()
     if (eof())
         return;
   
-    int ch = mpInput->get();
+    int ch = get();
     if (isEOL(ch))
     {
         absorbed(ch);
     }
     else
     {
-        mpInput->clear();
-        mpInput->unget();
+        unget();
     }
 }
 
-void Tokenizer::consumeCStyleLineComment()
+bool Tokenizer::skipComment()
 {
-    mpCurrent->setType(Token::TYPE_COMMENT);
+    if ((end() - position() < 2) || !isCStyleInitialCommentChar(position()[0]))
+        return false;
 
-    while (!eof())
+    if (isCStyleLineCommentSecondChar(position()[1]))
     {
-        int ch = mpInput->get();
+        absorbed(get());
+        absorbed(get());
+        absorbed(scanLineComment(position(), end()));
+        return true;
+    }
+
+    if (!isCStyleBlockCommentSecondChar(position()[1]))
+        return false;
+
+    // the unterminated comment is reported at the beginning of its last
+    // line, as the comment token of that line would be
+    Line commentLine = line();
+    Column commentColumn = column();
+    absorbed(get());
+    absorbed(get());
+    for (;;)
+    {
+        absorbed(scanBlockComment(position(), end()));
+        if (eof())
+            break;
+
+        int ch = get();
         if (isEOL(ch))
         {
-            mpInput->clear();
-            mpInput->unget();
-            break;
+            absorbed(ch);
+            commentLine = line();
+            commentColumn = column();
+            continue;
         }
+
+        if (eof())
+            break;
         absorbed(ch);
-        mpCurrent->addChar(ch);
+
+        if (isCStyleInitialCommentChar(peek()))
+        {
+            absorbed(get());
+            return true;
+        }
     }
+
+    mpMessageCollector->addMessage(
+        Message::SEVERITY_ERROR, Message::t_unterminatedComment,
+        mpSourceId, commentLine, commentColumn);
+    return false;
+}
+
+void Tokenizer::consumeCStyleLineComment()
+{
+    mpCurrent->setType(Token::TYPE_COMMENT);
+
+    const char* stop = scanLineComment(position(), end());
+    mpCurrent->addText(position(), stop - position());
+    absorbed(stop);
+
     mpCurrent->setEndColumn(column());
 }
 
@@ -333,6 +417,10 @@ void Tokenizer::consumeCStyleBlockComment()
     mpCurrent->setType(Token::TYPE_COMMENT);
     for(;;)
     {
+        const char* stop = scanBlockComment(position(), end());
+        mpCurrent->addText(position(), stop - position());
+        absorbed(stop);
+
         if (eof())
         {
             mpMessageCollector->addMessage(
@@ -341,12 +429,11 @@ void Tokenizer::consumeCStyleBlockComment()
             mpCurrent.reset();
             return;
         }
-        int ch = mpInput->get();
+        int ch = get();
         if (isEOL(ch))
         {
             mBlockComment = true;
-            mpInput->clear();
-            mpInput->unget();
+            unget();
             break;
         }
         if (isCStyleBlockCommentSecondChar(ch))
@@ -359,7 +446,7 @@ void Tokenizer::consumeCStyleBlockComment()
                 mpCurrent.reset();
                 return;
             }
-            int nch = mpInput->get();
+            int nch = get();
             if (isCStyleInitialCommentChar(nch))
             {
                 absorbed(ch);
@@ -367,8 +454,7 @@ void Tokenizer::consumeCStyleBlockComment()
                 mBlockComment = false;
                 break;
             }
-            mpInput->clear();
-            mpInput->unget();
+            unget();
         }
         absorbed(ch);
         mpCurrent->addChar(ch);
@@ -383,7 +469,7 @@ bool Tokenizer::consumeComment(int ch)
         return false;
     }
 
-    int nch = mpInput->get();
+    int nch = get();
     if (isCStyleLineCommentSecondChar(nch))
     {
         absorbed(ch);
@@ -398,8 +484,7 @@ bool Tokenizer::consumeComment(int ch)
     }
     else
     {
-        mpInput->clear();
-        mpInput->unget();
+        unget();
         return false;
     }
     return true;
@@ -413,9 +498,8 @@ bool Tokenizer::consumeDot(int ch)
     mpCurrent->setType(Token::TYPE_DOT);
     if (!eof()) 
     {
-        int nch = mpInput->get();
-        mpInput->clear();
-        mpInput->unget();
+        int nch = get();
+        unget();
         
         if (isDecimalDigit(nch)) 
         {
@@ -440,35 +524,32 @@ bool Tokenizer::consumeArrow(int ch)
         return false;
     }
 
-    int nch = mpInput->get();
+    int nch = get();
     if (eof() || !isArrowSymbol(nch) || (nch != '-')) 
     {
-        mpInput->clear();
-        mpInput->unget();
+        unget();
         return false;
     }
 
-    int nnch = mpInput->get();
+    int nnch = get();
     if (!isArrowSymbol(nnch) 
 	|| !(   (ch == '-' && nnch == '>')
 	     || (ch == '<' && nnch == '-')
 	     || (ch == '<' && nnch == '>')))
     {
-        mpInput->clear();
-        mpInput->unget();
-        mpInput->unget();
+        unget();
+        unget();
         return false;
     }
 
     if (!eof())
     {
-        int nnnch = mpInput->get();
-        mpInput->unget();
+        int nnnch = get();
+        unget();
         if (isArrowSymbol(nnnch))
         {
-            mpInput->clear();
-            mpInput->unget();
-            mpInput->unget();
+            unget();
+            unget();
             return false;
         }
     }
@@ -493,7 +574,7 @@ bool Tokenizer::consumeNumber(int ch)
         while (!eof())
         {
             ++count;
-            char nch = mpInput->get();
+            char nch = get();
             if (isWhitespace(nch)) 
                 continue;
                 
@@ -501,9 +582,8 @@ bool Tokenizer::consumeNumber(int ch)
             break;
         }
         if (count)
-            mpInput->clear();
         for (int i = 0; i < count; ++i) 
-            mpInput->unget();
+            unget();
         
         if (!number)
             return false;
@@ -514,7 +594,7 @@ bool Tokenizer::consumeNumber(int ch)
 
     for (int i = 0; i < count; ++i)
     {
-        char nch = mpInput->get();
+        char nch = get();
         absorbed(nch);
         mpCurrent->addChar(nch);
     }
@@ -530,7 +610,7 @@ bool Tokenizer::consumeNumber(int ch)
         mpCurrent->setType(Token::TYPE_INTEGER_LITERAL);      
         if (!eof() && isZero(ch))
         {
-            ch = mpInput->get();
+            ch = get();
             if (isHexIndicator(ch))
             {
                 if (eof())
@@ -547,7 +627,7 @@ bool Tokenizer::consumeNumber(int ch)
 
                 while (!eof())
                 {
-                    ch = mpInput->get();
+                    ch = get();
                     if (isNonHexicalLetter(ch) || isUnderscore(ch) || isDot(ch))
                     {
                         mpMessageCollector->addMessage(Message::SEVERITY_ERROR, 
@@ -559,8 +639,7 @@ bool Tokenizer::consumeNumber(int ch)
 
                     if (!isHexicalDigit(ch))
                     {
-                        mpInput->clear();
-                        mpInput->unget();
+                        unget();
                         break;
                     }
 
@@ -588,8 +667,7 @@ bool Tokenizer::consumeNumber(int ch)
 
                 if (!isOctalDigit(ch))
                 {
-                    mpInput->clear();
-                    mpInput->unget();
+                    unget();
                     break;
                 }
 
@@ -600,7 +678,7 @@ bool Tokenizer::consumeNumber(int ch)
                 {
                     break;
                 }
-                ch = mpInput->get();
+                ch = get();
             }
 
             mpCurrent->setEndColumn(column());
@@ -611,7 +689,7 @@ bool Tokenizer::consumeNumber(int ch)
     bool bExponent = false;
     while (!eof())
     {
-        ch = mpInput->get();
+        ch = get();
 
         if (isExponent(ch))
         {
@@ -628,7 +706,7 @@ bool Tokenizer::consumeNumber(int ch)
             absorbed(ch);
             mpCurrent->addChar(ch);
             
-            ch = mpInput->get();
+            ch = get();
             if (isSign(ch))
             {
                 mpCurrent->setType(Token::TYPE_REAL_LITERAL);
@@ -637,8 +715,7 @@ bool Tokenizer::consumeNumber(int ch)
             }
             else
             {
-                mpInput->clear();
-                mpInput->unget();
+                unget();
             }
             continue;
         }
@@ -671,8 +748,7 @@ bool Tokenizer::consumeNumber(int ch)
 
         if (!isDecimalDigit(ch))
         {
-            mpInput->clear();
-            mpInput->unget();
+            unget();
             break;
         }
 
@@ -697,6 +773,10 @@ bool Tokenizer::consumeString(int ch)
     int openQuotationMark = ch;
     for (;;)
     {
+        const char* stop = scanString(position(), end(), (char)openQuotationMark);
+        mpCurrent->addText(position(), stop - position());
+        absorbed(stop);
+
         if (eof())
         {
             mpMessageCollector->addMessage(
@@ -706,7 +786,7 @@ bool Tokenizer::consumeString(int ch)
             return false;
         }
 
-        ch = mpInput->get();
+        ch = get();
         if (isEOL(ch))
         {
             mpMessageCollector->addMessage(
@@ -732,7 +812,7 @@ bool Tokenizer::consumeString(int ch)
                 mpCurrent.reset();
                 return false;
             }
-            int nch = mpInput->get();
+            int nch = get();
             if (!isEscapee(nch))
             {
                 mpMessageCollector->addMessage(
@@ -765,11 +845,10 @@ bool Tokenizer::consumeEqualOperator(int ch)
     mpCurrent->setBeginColumn(column());
     mpCurrent->setType(Token::TYPE_RELATIONAL_OPERATOR1);
 
-    int nch = mpInput->get();
+    int nch = get();
     if (!isOperator(nch)) 
     {
-        mpInput->clear();
-        mpInput->unget();
+        unget();
         return false;
     }
 
@@ -791,18 +870,11 @@ void Tokenizer::consumeIdentifier(int ch)
 
     absorbed(ch);
     mpCurrent->addChar(ch);
-    while (!eof())
-    {
-        ch = mpInput->get();
-        if (!isLetter(ch) && !isDecimalDigit(ch) && !isUnderscore(ch))
-        {
-            mpInput->clear();
-            mpInput->unget();
-            break;
-        }
-        absorbed(ch);
-        mpCurrent->addChar(ch);
-    }
+
+    const char* stop = scanIdentifier(position(), end());
+    mpCurrent->addText(position(), stop - position());
+    absorbed(stop);
+
     mpCurrent->setEndColumn(column());
 }
 
@@ -810,6 +882,29 @@ void Tokenizer::shift()
 {
     mpCurrent.reset();
 
+    if (mReplay)
+    {
+        if (mDiscardComments)
+        {
+            while (   (mNextToken < mTokens.size())
+                   && (mTokens[mNextToken]->type() == Token::TYPE_COMMENT))
+                ++mNextToken;
+        }
+
+        if (mNextToken < mTokens.size())
+        {
+            mpCurrent = mTokens[mNextToken++];
+            mCurrentLine = mpCurrent->line().value() - 1;
+            mCurrentColumn = mpCurrent->endColumn().value() - 1;
+        }
+        else
+        {
+            mCurrentLine = mEndLine.value() - 1;
+            mCurrentColumn = mEndColumn.value() - 1;
+        }
+        return;
+    }
+
     if (mBlockComment)
     {
         skipEOL();
@@ -817,7 +912,12 @@ void Tokenizer::shift()
     else
     {
         skipWhiteSpaces();
-        if (mpInput->eof())
+        if (mDiscardComments)
+        {
+            while (skipComment())
+                skipWhiteSpaces();
+        }
+        if (position() == end())
             return;
     }
 
@@ -831,7 +931,7 @@ void Tokenizer::shift()
         return;
     }
 
-    int ch = mpInput->get();
+    int ch = get();
     if (isLetter(ch) || isUnderscore(ch))
     {
         consumeIdentifier(ch);
@@ -913,6 +1013,8 @@ void Tokenizer::shiftFilepath()
 {
     // do not call shift file in the middle of a block comment
     BOOST_ASSERT(!mBlockComment);
+    // the replayed streams do not have the source
+    BOOST_ASSERT(!mReplay);
 
     // we do not support files with whitespaces in the beggining
     skipWhiteSpaces();
@@ -924,11 +1026,10 @@ void Tokenizer::shiftFilepath()
 
     while (!eof())
     {
-        int ch = mpInput->get();
+        int ch = get();
         if (!isPortableFilepathChar(ch))
         {
-            mpInput->clear();
-            mpInput->unget();
+            unget();
             break;
         }
         absorbed(ch);
@@ -939,11 +1040,9 @@ void Tokenizer::shiftFilepath()
 
 bool Tokenizer::eof() const
 {
-    if (mpInput->bad())
-        return true;
-    if (mpInput->peek() == -1)
-        return true;
-    return false;
+    if (mReplay)
+        return mNextToken >= mTokens.size();
+    return mPosition >= mSource.size();
 }
 
 bool Tokenizer::eot() const
@@ -966,9 +1065,9 @@ void Tokenizer::absorbed(int ch)
         mCurrentColumn = 0;
         if (!eof())
         {
-            int nch = mpInput->peek();
+            int nch = peek();
             if (isEOL(nch) && (nch != ch))
-                mpInput->get();
+                get();
         }
     } 
     else
@@ -977,6 +1076,42 @@ void Tokenizer::absorbed(int ch)
     }
 }
 
+void Tokenizer::absorbed(const char* position)
+{
+    const char* begin = mSource.data() + mPosition;
+    size_t size = position - begin;
+    if (std::memchr(begin, '\t', size))
+    {
+        for (size_t i = 0; i < size; ++i)
+            absorbed(begin[i]);
+    }
+    else
+    {
+        mCurrentColumn += (int)size;
+    }
+    mPosition += size;
+}
+
+size_t Tokenizer::offset() const
+{
+    return mPosition;
+}
+
+size_t Tokenizer::replayIndex() const
+{
+    return mpCurrent ? mNextToken - 1 : mTokens.size();
+}
+
+const char* Tokenizer::position() const
+{
+    return mSource.data() + mPosition;
+}
+
+const char* Tokenizer::end() const
+{
+    return mSource.data() + mSource.size();
+}
+
 Line Tokenizer::line() const
 {
     return Line(mCurrentLine + 1);
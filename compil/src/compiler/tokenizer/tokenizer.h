@@ -34,12 +34,14 @@
 #define _COMPIL_TOKENIZER_H__
 
 #include "compiler/tokenizer/token.h"
+#include "compiler/tokenizer/token_cache.h"
 #include "compiler/message/message_collector.h"
 
 #include <boost/shared_ptr.hpp>
 
 #include <iostream>
 #include <memory>
+#include <string>
 
 namespace compil
 {
@@ -55,6 +57,26 @@ public:
 
     void tokenize(const SourceIdSPtr& pSourceId, const boost::shared_ptr<std::istream>& pInput);
 
+    // tokenizes the source starting from the offset, which has to be
+    // outside of comments and strings. The tokens are numbered from the
+    // given line and column (see IncrementalTokenizer)
+    void tokenize(const SourceIdSPtr& pSourceId, const std::string& source,
+                  size_t offset, const Line& line, const Column& column);
+
+    // replays already tokenized stream (see TokenCache) instead of
+    // reading the source, starting from the token with the given index
+    void replay(const SourceIdSPtr& pSourceId, const TokenStream& stream, size_t index = 0);
+
+    // the source offset right after the current token
+    size_t offset() const;
+
+    // the index of the current token in the replayed stream
+    size_t replayIndex() const;
+
+    // the comments are skipped in bulk and never returned as tokens.
+    // Set it before the first shift
+    void setDiscardComments(bool discard);
+
     // shifts the tokenizer to the next token
     void shift();
     void shiftFilepath();
@@ -75,6 +97,9 @@ public:
     // skips EOL
     void skipEOL();
 
+    // skips a whole comment, returns false if there is no comment
+    bool skipComment();
+
     void consumeCStyleLineComment();
     void consumeCStyleBlockComment();
     bool consumeComment(int ch);
@@ -92,16 +117,52 @@ public:
     bool expect(Token::Type type, const char* text);
     
 private:
+    // the source is read upfront so the comments, strings and identifiers
+    // are scanned in runs (see scanner.h). The single character access
+    // follows the std::istream get, unget and peek semantic
+    int get()
+    {
+        if (mPosition < mSource.size())
+            return (unsigned char)mSource[mPosition++];
+        return -1;
+    }
+    void unget()
+    {
+        if (mPosition > 0)
+            --mPosition;
+    }
+    int peek() const
+    {
+        if (mPosition < mSource.size())
+            return (unsigned char)mSource[mPosition];
+        return -1;
+    }
+    const char* position() const;
+    const char* end() const;
+
+    // absorbs the characters up to the given position, they do not
+    // contain end of line characters
+    void absorbed(const char* position);
+
     MessageCollectorPtr mpMessageCollector;
 
     TokenPtr mpCurrent;
     SourceIdSPtr mpSourceId;
     boost::shared_ptr<std::istream> mpInput;
+    std::string mSource;
+    size_t mPosition;
 
     int mCurrentLine;
     int mCurrentColumn;
 
     bool mBlockComment;
+    bool mDiscardComments;
+
+    bool mReplay;
+    std::vector<TokenPtr> mTokens;
+    size_t mNextToken;
+    Line mEndLine;
+    Column mEndColumn;
 };
 
 typedef boost::shared_ptr<Tokenizer> TokenizerPtr;
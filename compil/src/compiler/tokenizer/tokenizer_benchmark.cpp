@@ -0,0 +1,100 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/tokenizer/tokenizer.h"
+
+#include "core/platform/benchmark.h"
+
+#include "gtest/gtest.h"
+
+#include <boost/make_shared.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// a schema of two thousand documented structures, about half of its
+// characters are in comments
+static std::string corpus()
+{
+    std::ostringstream source;
+    source << "compil { }\n\npackage benchmark.tokenizer;\n\n";
+    for (int s = 0; s < 2000; ++s)
+    {
+        source << "/*\n"
+               << " * The structure " << s << " describes one entity of the benchmark schema.\n"
+               << " * The\tcomment is long enough to span several vector widths of text\n"
+               << " */\n"
+               << "structure Structure" << s << "\n"
+               << "{\n";
+        for (int f = 0; f < 6; ++f)
+        {
+            source << "    // the field " << f << " of the structure, kept for the compatibility\n"
+                   << "    integer field" << f << " = " << f * 7 << ";\n";
+        }
+        source << "    string name = \"structure name with a \\\"quoted\\\" part\";\n"
+               << "}\n\n";
+    }
+    return source.str();
+}
+
+static size_t tokenize(const std::string& source)
+{
+    compil::MessageCollectorPtr collector = boost::make_shared<compil::MessageCollector>();
+    compil::Tokenizer tokenizer(collector,
+                                compil::SourceIdSPtr(),
+                                boost::make_shared<std::istringstream>(source));
+    size_t tokens = 0;
+    for (; tokenizer.current(); tokenizer.shift())
+        ++tokens;
+    return tokens;
+}
+
+TEST(TokenizerBenchmark, commentHeavy)
+{
+    const std::string source = corpus();
+
+    size_t tokens = 0;
+    plt::Benchmark benchmark("compiler/tokenizer.comment_heavy");
+    while (benchmark.running())
+    {
+        tokens = tokenize(source);
+        benchmark.consume(tokens);
+    }
+
+    std::cout << "[ BENCHMARK] compiler/tokenizer.comment_heavy: "
+              << source.size() << " bytes, "
+              << tokens << " tokens, "
+              << std::fixed << std::setprecision(0)
+              << tokens * 1000000000.0 / benchmark.nanosecondsPerIteration() << " tokens/s"
+              << std::endl;
+}
@@ -1175,3 +1175,129 @@ TEST_F(TokenizerTests, filepathsDelimiter)
 		EXPECT_EQ(0U, mMessageCollector->messages().size());
 	}
 }
+
+TEST_F(TokenizerTests, longRuns)
+{
+	std::string text = std::string(40, 'c') + "\t" + std::string(20, 'c');
+	std::string identifier = "_" + std::string(50, 'x') + "0";
+	std::string literal = std::string(30, 's') + "\\t" + std::string(30, 's');
+
+	boost::shared_ptr<std::stringstream> pInput(new std::stringstream(
+		"//" + text + "\r\n"
+		"/*" + text + "\n" + text + "*" + text + "*/ " + identifier + "\n"
+		"\t\"" + literal + "\";"));
+	mpTokenizer->tokenize(compil::SourceIdSPtr(), pInput);
+
+	mpTokenizer->shift();
+	EXPECT_EQ(compil::Token::TYPE_COMMENT, mpTokenizer->current()->type());
+	EXPECT_EQ(text, mpTokenizer->current()->text());
+	EXPECT_EQ(lang::compil::Line(1), mpTokenizer->current()->line());
+	EXPECT_EQ(lang::compil::Column(65), mpTokenizer->current()->endColumn());
+
+	mpTokenizer->shift();
+	EXPECT_EQ(compil::Token::TYPE_COMMENT, mpTokenizer->current()->type());
+	EXPECT_EQ(text, mpTokenizer->current()->text());
+	EXPECT_EQ(lang::compil::Line(2), mpTokenizer->current()->line());
+	EXPECT_EQ(lang::compil::Column(65), mpTokenizer->current()->endColumn());
+
+	mpTokenizer->shift();
+	EXPECT_EQ(compil::Token::TYPE_COMMENT, mpTokenizer->current()->type());
+	EXPECT_EQ(text + "*" + text, mpTokenizer->current()->text());
+	EXPECT_EQ(lang::compil::Line(3), mpTokenizer->current()->line());
+	EXPECT_EQ(lang::compil::Column(131), mpTokenizer->current()->endColumn());
+
+	mpTokenizer->shift();
+	EXPECT_EQ(compil::Token::TYPE_IDENTIFIER, mpTokenizer->current()->type());
+	EXPECT_EQ(identifier, mpTokenizer->current()->text());
+	EXPECT_EQ(lang::compil::Line(3), mpTokenizer->current()->line());
+	EXPECT_EQ(lang::compil::Column(132), mpTokenizer->current()->beginColumn());
+	EXPECT_EQ(lang::compil::Column(184), mpTokenizer->current()->endColumn());
+
+	mpTokenizer->shift();
+	EXPECT_EQ(compil::Token::TYPE_STRING_LITERAL, mpTokenizer->current()->type());
+	EXPECT_EQ(literal, mpTokenizer->current()->text());
+	EXPECT_EQ(lang::compil::Line(4), mpTokenizer->current()->line());
+	EXPECT_EQ(lang::compil::Column(5), mpTokenizer->current()->beginColumn());
+	EXPECT_EQ(lang::compil::Column(69), mpTokenizer->current()->endColumn());
+
+	mpTokenizer->shift();
+	EXPECT_EQ(compil::Token::TYPE_DELIMITER, mpTokenizer->current()->type());
+	EXPECT_TRUE( mpTokenizer->eof() );
+	EXPECT_EQ(0U, mMessageCollector->messages().size());
+}
+
+TEST_F(TokenizerTests, discardComments)
+{
+	const char* sources[] =
+	{
+		"a // b\nc",
+		"// a\r\n// b\r\nc /* d */ e",
+		"/* a\n\tb * / c\n*/ d/**/e",
+		"a /***/ /* b\n\nc */",
+		"a /* b\n  c",
+		"a /* b\n  c *",
+		"a // b",
+		"a / b",
+		"a /",
+	};
+
+	for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); ++i)
+	{
+		const char* str = sources[i];
+
+		compil::MessageCollectorPtr fullCollector(new compil::MessageCollector());
+		compil::Tokenizer full(fullCollector);
+		full.tokenize(compil::SourceIdSPtr(), boost::make_shared<std::stringstream>(str));
+
+		compil::MessageCollectorPtr discardCollector(new compil::MessageCollector());
+		compil::Tokenizer discard(discardCollector);
+		discard.setDiscardComments(true);
+		discard.tokenize(compil::SourceIdSPtr(), boost::make_shared<std::stringstream>(str));
+
+		for (full.shift(), discard.shift(); full.current(); full.shift())
+		{
+			if (full.current()->type() == compil::Token::TYPE_COMMENT)
+				continue;
+
+			ASSERT_TRUE(discard.current()) << str;
+			EXPECT_EQ(full.current()->type(), discard.current()->type()) << str;
+			EXPECT_EQ(full.current()->text(), discard.current()->text()) << str;
+			EXPECT_EQ(full.current()->line(), discard.current()->line()) << str;
+			EXPECT_EQ(full.current()->beginColumn(), discard.current()->beginColumn()) << str;
+			EXPECT_EQ(full.current()->endColumn(), discard.current()->endColumn()) << str;
+			discard.shift();
+		}
+		EXPECT_FALSE(discard.current()) << str;
+		EXPECT_EQ(full.line(), discard.line()) << str;
+		EXPECT_EQ(full.column(), discard.column()) << str;
+
+		ASSERT_EQ(fullCollector->messages().size(), discardCollector->messages().size()) << str;
+		for (size_t m = 0; m < fullCollector->messages().size(); ++m)
+			EXPECT_EQ(fullCollector->messages()[m], discardCollector->messages()[m]) << str;
+	}
+}
+
+TEST_F(TokenizerTests, discardCommentsReplay)
+{
+	compil::Tokenizer eager(mMessageCollector);
+	eager.tokenize(compil::SourceIdSPtr(), boost::make_shared<std::stringstream>("// a\nb /* c */ d\n// e"));
+
+	compil::TokenStream stream;
+	for (eager.shift(); eager.current(); eager.shift())
+		stream.tokens.push_back(eager.current());
+	stream.endLine = eager.line();
+	stream.endColumn = eager.column();
+	ASSERT_EQ(5U, stream.tokens.size());
+
+	mpTokenizer->setDiscardComments(true);
+	mpTokenizer->replay(compil::SourceIdSPtr(), stream);
+	ASSERT_TRUE(mpTokenizer->current());
+	EXPECT_EQ("b", mpTokenizer->current()->text());
+	mpTokenizer->shift();
+	ASSERT_TRUE(mpTokenizer->current());
+	EXPECT_EQ("d", mpTokenizer->current()->text());
+	mpTokenizer->shift();
+	EXPECT_FALSE(mpTokenizer->current());
+	EXPECT_EQ(lang::compil::Line(3), mpTokenizer->line());
+	EXPECT_EQ(0U, mMessageCollector->messages().size());
+}
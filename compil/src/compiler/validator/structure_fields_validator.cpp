@@ -60,8 +60,8 @@ bool StructureFieldsValidator::validate(const ObjectSPtr& pObject, MessageCollec
     std::set<std::string> names;
     
     bool bError = false;
-    std::vector<ObjectSPtr> objects = pStructure->objects();
-    for (std::vector<ObjectSPtr>::iterator it = objects.begin(); it != objects.end(); ++it)
+    const std::vector<ObjectSPtr>& objects = pStructure->objects();
+    for (std::vector<ObjectSPtr>::const_iterator it = objects.begin(); it != objects.end(); ++it)
     {
         FieldSPtr pField = ObjectFactory::downcastField(*it);
         if (!pField) continue;
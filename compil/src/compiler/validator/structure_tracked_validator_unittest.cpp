@@ -0,0 +1,85 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure_tracked_validator.h"
+
+#include "language/compil/document/structure.h"
+
+#include "gtest/gtest.h"
+
+class StructureTrackedValidatorTests : public ::testing::Test 
+{
+public:
+    virtual void SetUp() 
+    {
+         mpMessageCollector.reset(new compil::MessageCollector());
+    }
+    
+protected:
+    compil::MessageCollectorPtr mpMessageCollector;
+};
+
+
+
+TEST_F(StructureTrackedValidatorTests, construct)
+{
+    compil::StructureTrackedValidator validator;
+}
+
+TEST_F(StructureTrackedValidatorTests, validate)
+{
+    compil::StructureTrackedValidator validator;
+    
+    compil::StructureSPtr pStructure(new compil::Structure());
+    EXPECT_TRUE(validator.validate(pStructure, mpMessageCollector));
+    
+    pStructure->set_tracked(true);
+    EXPECT_FALSE(validator.validate(pStructure, mpMessageCollector));
+    EXPECT_EQ(1U, mpMessageCollector->messages().size());
+    
+    pStructure->set_controlled(true);
+    EXPECT_TRUE(validator.validate(pStructure, mpMessageCollector));
+    
+    pStructure->set_immutable(true);
+    EXPECT_FALSE(validator.validate(pStructure, mpMessageCollector));
+    EXPECT_EQ(2U, mpMessageCollector->messages().size());
+    pStructure->set_immutable(false);
+    
+    compil::StructureSPtr pBaseStructure(new compil::Structure());
+    pBaseStructure->set_controlled(true);
+    pStructure->set_baseStructure(pBaseStructure);
+    EXPECT_FALSE(validator.validate(pStructure, mpMessageCollector));
+    EXPECT_EQ(3U, mpMessageCollector->messages().size());
+    
+    pBaseStructure->set_tracked(true);
+    EXPECT_TRUE(validator.validate(pStructure, mpMessageCollector));
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "compiler/validator/validation_engine.h"
+
+namespace compil
+{
+
+ValidationEngine::ValidationEngine()
+{
+}
+
+ValidationEngine::~ValidationEngine()
+{
+}
+
+void ValidationEngine::addValidator(const EObjectId& objectId, const ValidatorPtr& pValidator)
+{
+    mKindValidators[objectId.value()].push_back(pValidator);
+}
+
+void ValidationEngine::addValidator(const ValidatorPtr& pValidator)
+{
+    mValidators.push_back(pValidator);
+}
+
+static bool validate(const std::vector<ValidatorPtr>& validators,
+                     const ObjectSPtr& pObject,
+                     MessageCollectorPtr& pMessageCollector)
+{
+    bool bResult = true;
+    for (std::vector<ValidatorPtr>::const_iterator it = validators.begin(); it != validators.end(); ++it)
+    {
+        if (!(*it)->validate(pObject, pMessageCollector))
+            bResult = false;
+    }
+    return bResult;
+}
+
+bool ValidationEngine::validate(const ObjectSPtr& pObject, MessageCollectorPtr& pMessageCollector) const
+{
+    bool bResult = true;
+
+    KindValidators::const_iterator it = mKindValidators.find(pObject->runtimeObjectId().value());
+    if (it != mKindValidators.end())
+        bResult = compil::validate(it->second, pObject, pMessageCollector);
+
+    if (!compil::validate(mValidators, pObject, pMessageCollector))
+        bResult = false;
+
+    return bResult;
+}
+
+}
@@ -0,0 +1,85 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#ifndef _COMPIL_VALIDATION_ENGINE_H__
+#define _COMPIL_VALIDATION_ENGINE_H__
+
+#include "compiler/validator/validator.h"
+
+#include "language/compil/all/object_factory.h"
+
+#include <boost/shared_ptr.hpp>
+
+#include <map>
+#include <vector>
+
+namespace compil
+{
+
+// Validates every object in a single visit. The validators are attached
+// to the kind of the objects they check, so an object is passed only to
+// the validators of its kind instead of to all of them
+class ValidationEngine
+{
+public:
+    ValidationEngine();
+    ~ValidationEngine();
+
+    // the validator is called for the objects of the given kind
+    void addValidator(const EObjectId& objectId, const ValidatorPtr& pValidator);
+    // the validator is called for every object
+    void addValidator(const ValidatorPtr& pValidator);
+
+    bool validate(const ObjectSPtr& pObject, MessageCollectorPtr& pMessageCollector) const;
+
+private:
+    typedef std::map<long, std::vector<ValidatorPtr> > KindValidators;
+
+    KindValidators mKindValidators;
+    std::vector<ValidatorPtr> mValidators;
+};
+
+typedef boost::shared_ptr<ValidationEngine> ValidationEngineSPtr;
+
+}
+
+#else // _COMPIL_VALIDATION_ENGINE_H__
+
+namespace compil
+{
+
+class ValidationEngine;
+typedef boost::shared_ptr<ValidationEngine> ValidationEngineSPtr;
+
+}
+
+#endif // _COMPIL_VALIDATION_ENGINE_H__
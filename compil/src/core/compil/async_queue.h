@@ -0,0 +1,427 @@
+#ifndef __CORE_ASYNC_QUEUE_HPP_H_
+#define __CORE_ASYNC_QUEUE_HPP_H_
+
+// Boost C++ Smart Pointers
+#include <boost/smart_ptr/detail/yield_k.hpp>
+// Standard C Library
+#include <stddef.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <process.h>
+
+// Exchanges the pointer atomically. It is a full memory barrier.
+inline void* async_exchange(void* volatile* target, void* value)
+{
+    return InterlockedExchangePointer(target, value);
+}
+
+// Orders the memory accesses before and after it
+inline void async_barrier()
+{
+    MemoryBarrier();
+}
+
+// Thread that runs the routine with the argument
+class async_thread
+{
+public:
+    typedef void (*routine_type)(void*);
+
+    void start(routine_type routine, void* argument)
+    {
+        mRoutine = routine;
+        mArgument = argument;
+        mHandle = (HANDLE)_beginthreadex(0, 0, &async_thread::run, this, 0, 0);
+    }
+
+    void join()
+    {
+        WaitForSingleObject(mHandle, INFINITE);
+        CloseHandle(mHandle);
+    }
+
+private:
+    static unsigned __stdcall run(void* thread)
+    {
+        async_thread* self = static_cast<async_thread*>(thread);
+        self->mRoutine(self->mArgument);
+        return 0;
+    }
+
+    HANDLE       mHandle;
+    routine_type mRoutine;
+    void*        mArgument;
+};
+
+// Event the idle worker and the callers of the slow sends park on. A
+// signal releases one wait, the signal before the wait is not lost.
+class async_event
+{
+public:
+    async_event()
+    {
+        mHandle = CreateEvent(0, FALSE, FALSE, 0);
+    }
+
+    ~async_event()
+    {
+        CloseHandle(mHandle);
+    }
+
+    void signal()
+    {
+        SetEvent(mHandle);
+    }
+
+    void wait()
+    {
+        WaitForSingleObject(mHandle, INFINITE);
+    }
+
+private:
+    async_event(const async_event&);
+    async_event& operator=(const async_event&);
+
+    HANDLE mHandle;
+};
+
+#else
+#include <pthread.h>
+
+// Exchanges the pointer atomically. It is a full memory barrier.
+inline void* async_exchange(void* volatile* target, void* value)
+{
+    // the builtin alone is only an acquire barrier
+    __sync_synchronize();
+    return __sync_lock_test_and_set(target, value);
+}
+
+// Orders the memory accesses before and after it
+inline void async_barrier()
+{
+    __sync_synchronize();
+}
+
+// Thread that runs the routine with the argument
+class async_thread
+{
+public:
+    typedef void (*routine_type)(void*);
+
+    void start(routine_type routine, void* argument)
+    {
+        mRoutine = routine;
+        mArgument = argument;
+        pthread_create(&mHandle, 0, &async_thread::run, this);
+    }
+
+    void join()
+    {
+        pthread_join(mHandle, 0);
+    }
+
+private:
+    static void* run(void* thread)
+    {
+        async_thread* self = static_cast<async_thread*>(thread);
+        self->mRoutine(self->mArgument);
+        return 0;
+    }
+
+    pthread_t    mHandle;
+    routine_type mRoutine;
+    void*        mArgument;
+};
+
+// Event the idle worker and the callers of the slow sends park on. A
+// signal releases one wait, the signal before the wait is not lost.
+class async_event
+{
+public:
+    async_event()
+        : mSignaled(false)
+    {
+        pthread_mutex_init(&mMutex, 0);
+        pthread_cond_init(&mCondition, 0);
+    }
+
+    ~async_event()
+    {
+        pthread_cond_destroy(&mCondition);
+        pthread_mutex_destroy(&mMutex);
+    }
+
+    void signal()
+    {
+        pthread_mutex_lock(&mMutex);
+        mSignaled = true;
+        pthread_cond_signal(&mCondition);
+        pthread_mutex_unlock(&mMutex);
+    }
+
+    void wait()
+    {
+        pthread_mutex_lock(&mMutex);
+        while (!mSignaled)
+            pthread_cond_wait(&mCondition, &mMutex);
+        mSignaled = false;
+        pthread_mutex_unlock(&mMutex);
+    }
+
+private:
+    async_event(const async_event&);
+    async_event& operator=(const async_event&);
+
+    pthread_mutex_t mMutex;
+    pthread_cond_t  mCondition;
+    bool            mSignaled;
+};
+
+#endif
+
+// Call marshalled through an async_queue. The stubs derive from it and
+// keep the arguments of the call until it is dispatched. The state of a
+// sent call is 0 before the dispatch, the call itself after it, or the
+// event its caller parks on.
+class async_call
+{
+public:
+    async_call()
+        : mNext(0)
+        , mWaited(false)
+        , mState(0)
+    {
+    }
+
+    virtual ~async_call()
+    {
+    }
+
+    // Invokes the call on its target. It is executed on the worker thread.
+    virtual void dispatch() = 0;
+
+private:
+    friend class async_queue;
+
+    async_call* volatile mNext;
+    bool                 mWaited;
+    void* volatile       mState;
+};
+
+// Multiple producers single consumer queue of calls. The calls are
+// dispatched in order on the worker thread of the queue. Posting a call
+// never takes a lock, the producers only exchange the head of an intrusive
+// list. The worker drains all the pending calls at once, so the
+// consecutive calls are dispatched as one batch. When there are no calls
+// the worker spins for a while and then parks on an event until the next
+// call is posted.
+class async_queue
+{
+public:
+    // Starts the worker thread
+    async_queue()
+        : mHead(&mStub)
+        , mTail(&mStub)
+        , mStop(0)
+        , mCalls(0)
+        , mBatches(0)
+        , mParked(0)
+    {
+        mThread.start(&async_queue::run, this);
+    }
+
+    // Dispatches the calls that are still pending and stops the worker
+    // thread
+    ~async_queue()
+    {
+        async_barrier();
+        mStop = 1;
+        wake();
+        mThread.join();
+    }
+
+    // Posts the call without waiting for its dispatch. The queue takes the
+    // ownership of the call and deletes it after the dispatch. It could be
+    // called from any thread.
+    void post(async_call* call)
+    {
+        call->mNext = 0;
+        async_call* previous = (async_call*)async_exchange((void* volatile*)&mHead, call);
+        previous->mNext = call;
+        // only a parked worker is signaled, posting takes no lock otherwise
+        async_barrier();
+        if (mParked) wake();
+    }
+
+    // Posts the call and waits until it is dispatched. The caller spins
+    // for a while and then parks on an event until the dispatch. The call
+    // stays owned by the caller. It should not be called from a dispatched
+    // call, because the worker would wait for itself.
+    void send(async_call* call)
+    {
+        call->mWaited = true;
+        post(call);
+        for (unsigned k = 0; k < 64; ++k)
+        {
+            if (call->mState == call)
+            {
+                async_barrier();
+                return;
+            }
+            boost::detail::yield(k);
+        }
+
+        // the worker signals the event only if it takes it from the call
+        async_event event;
+        if (!async_exchange(&call->mState, &event))
+            event.wait();
+        async_barrier();
+    }
+
+    // Returns the number of the dispatched calls
+    size_t calls() const
+    {
+        return mCalls;
+    }
+
+    // Returns the number of the batches the calls were dispatched in
+    size_t batches() const
+    {
+        return mBatches;
+    }
+
+private:
+    async_queue(const async_queue&);
+    async_queue& operator=(const async_queue&);
+
+    // Marks the end of the list when all the calls are dispatched
+    class stub_call : public async_call
+    {
+    public:
+        virtual void dispatch()
+        {
+        }
+    };
+
+    static void run(void* queue)
+    {
+        async_queue* self = static_cast<async_queue*>(queue);
+        for (unsigned k = 0; ; ++k)
+        {
+            // the stop flag is read before the draining, so the calls posted
+            // before the destruction are still dispatched
+            bool stop = self->mStop != 0;
+            async_barrier();
+            size_t count = self->process();
+            if (count > 0)
+            {
+                self->mCalls += count;
+                ++self->mBatches;
+                k = 0;
+            }
+            else if (stop)
+            {
+                break;
+            }
+            else if (k < 64)
+            {
+                boost::detail::yield(k);
+            }
+            else
+            {
+                self->park();
+                k = 0;
+            }
+        }
+    }
+
+    // Waits until a call is posted or the queue is stopped. The flag is
+    // raised before the last check, so a producer either sees it or its
+    // call is seen by the check.
+    void park()
+    {
+        async_exchange(&mParked, this);
+        if (mStop || (mHead != mTail))
+        {
+            // a producer that took the flag is signaling, the signal is consumed
+            if (async_exchange(&mParked, 0)) return;
+        }
+        mEvent.wait();
+    }
+
+    // Signals the worker if it is parked. Only the thread that takes the
+    // flag signals it.
+    void wake()
+    {
+        if (async_exchange(&mParked, 0))
+            mEvent.signal();
+    }
+
+    // Dispatches all the calls posted so far. Returns their number.
+    size_t process()
+    {
+        size_t count = 0;
+        for (async_call* call = pop(); call; call = pop())
+        {
+            call->dispatch();
+            ++count;
+            if (call->mWaited)
+            {
+                // the caller could release the call as soon as it is done
+                void* waiter = async_exchange(&call->mState, call);
+                if (waiter)
+                    static_cast<async_event*>(waiter)->signal();
+            }
+            else
+            {
+                delete call;
+            }
+        }
+        return count;
+    }
+
+    // Removes the oldest call from the list. Returns null if there are no
+    // calls or if a producer has not linked its call yet.
+    async_call* pop()
+    {
+        async_call* stub = &mStub;
+        async_call* tail = mTail;
+        async_call* next = tail->mNext;
+        async_barrier();
+        if (tail == stub)
+        {
+            if (!next) return 0;
+            mTail = next;
+            tail = next;
+            next = next->mNext;
+            async_barrier();
+        }
+        if (next)
+        {
+            mTail = next;
+            return tail;
+        }
+        if (tail != mHead) return 0;
+        // the last call is released only when the stub is behind it
+        post(stub);
+        next = tail->mNext;
+        async_barrier();
+        if (!next) return 0;
+        mTail = next;
+        return tail;
+    }
+
+    stub_call            mStub;
+    async_call* volatile mHead;
+    async_call*          mTail;
+    volatile long        mStop;
+    volatile size_t      mCalls;
+    volatile size_t      mBatches;
+    void* volatile       mParked;
+    async_event          mEvent;
+    async_thread         mThread;
+};
+
+#endif // __CORE_ASYNC_QUEUE_HPP_H_
+
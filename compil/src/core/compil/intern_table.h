@@ -0,0 +1,136 @@
+#ifndef __CORE_INTERN_TABLE_HPP_H_
+#define __CORE_INTERN_TABLE_HPP_H_
+
+// Boost C++ Smart Pointers
+#include <boost/detail/lightweight_mutex.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Boost C++ Unordered
+#include <boost/unordered_map.hpp>
+// Standard Template Library
+#include <vector>
+
+template<class T>
+class intern_table
+{
+public:
+    intern_table()
+        : mLookups(0)
+        , mHits(0)
+    {
+    }
+
+    // Returns the canonical instance equal to the object. The table takes
+    // the ownership of the object and deletes it if an equal instance is
+    // already interned. The canonical instances are removed from the table
+    // when their last reference is released.
+    boost::shared_ptr<T> intern(T* object)
+    {
+        // the candidates are released after the lock, because releasing the
+        // last reference of an instance erases it from the table
+        std::vector<boost::shared_ptr<T> > candidates;
+        boost::shared_ptr<T> canonical = insert(object, candidates);
+        if (canonical.get() != object)
+            delete object;
+        return canonical;
+    }
+
+    // Returns the number of the canonical instances in the table
+    size_t size() const
+    {
+        boost::detail::lightweight_mutex::scoped_lock lock(mMutex);
+        return mEntries.size();
+    }
+
+    // Returns the number of the intern requests
+    size_t lookups() const
+    {
+        boost::detail::lightweight_mutex::scoped_lock lock(mMutex);
+        return mLookups;
+    }
+
+    // Returns the number of the intern requests served with an already
+    // interned instance
+    size_t hits() const
+    {
+        boost::detail::lightweight_mutex::scoped_lock lock(mMutex);
+        return mHits;
+    }
+
+    // Returns the ratio between the hits and the lookups
+    double hit_ratio() const
+    {
+        boost::detail::lightweight_mutex::scoped_lock lock(mMutex);
+        if (mLookups == 0) return 0.0;
+        return (double)mHits / mLookups;
+    }
+
+private:
+    typedef std::pair<T*, boost::weak_ptr<T> > entry;
+    typedef boost::unordered_multimap<size_t, entry> map;
+    typedef typename map::iterator iterator;
+
+    boost::shared_ptr<T> insert(T* object, std::vector<boost::shared_ptr<T> >& candidates)
+    {
+        size_t hash = object->internHash();
+        boost::detail::lightweight_mutex::scoped_lock lock(mMutex);
+        ++mLookups;
+
+        std::pair<iterator, iterator> range = mEntries.equal_range(hash);
+        for (iterator it = range.first; it != range.second; ++it)
+        {
+            candidates.push_back(it->second.second.lock());
+            if (candidates.back() && candidates.back()->internEquals(*object))
+            {
+                ++mHits;
+                return candidates.back();
+            }
+        }
+
+        boost::shared_ptr<T> canonical(object, deleter(this, hash));
+        mEntries.insert(std::make_pair(hash, entry(object, canonical)));
+        return canonical;
+    }
+
+    // Erases the canonical instance from the table when its last reference
+    // is released
+    class deleter
+    {
+    public:
+        deleter(intern_table* table, size_t hash)
+            : mTable(table)
+            , mHash(hash)
+        {
+        }
+
+        void operator()(T* object) const
+        {
+            mTable->erase(mHash, object);
+            delete object;
+        }
+
+    private:
+        intern_table* mTable;
+        size_t mHash;
+    };
+
+    void erase(size_t hash, T* object)
+    {
+        boost::detail::lightweight_mutex::scoped_lock lock(mMutex);
+        std::pair<iterator, iterator> range = mEntries.equal_range(hash);
+        for (iterator it = range.first; it != range.second; ++it)
+        {
+            if (it->second.first != object) continue;
+            mEntries.erase(it);
+            break;
+        }
+    }
+
+    mutable boost::detail::lightweight_mutex mMutex;
+    map mEntries;
+    size_t mLookups;
+    size_t mHits;
+};
+
+#endif // __CORE_INTERN_TABLE_HPP_H_
+
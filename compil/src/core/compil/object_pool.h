@@ -0,0 +1,461 @@
+#ifndef __CORE_OBJECT_POOL_HPP_H_
+#define __CORE_OBJECT_POOL_HPP_H_
+
+// Standard Template Library
+#include <new>
+// Standard C Library
+#include <stddef.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+
+// Sets the target to the value if it is equal to the expected one. It is a
+// full memory barrier.
+inline bool pool_compare_exchange(void* volatile* target, void* expected, void* value)
+{
+    return InterlockedCompareExchangePointer(target, value, expected) == expected;
+}
+
+// Exchanges the pointer atomically. It is a full memory barrier.
+inline void* pool_exchange(void* volatile* target, void* value)
+{
+    return InterlockedExchangePointer(target, value);
+}
+
+// Adds the delta to the target atomically
+inline void pool_add(volatile long* target, long delta)
+{
+    InterlockedExchangeAdd(target, delta);
+}
+
+// Called with the cache of a thread when the thread exits
+inline void pool_thread_exit(void* cache);
+
+// Adapts pool_thread_exit to the fiber local storage callback
+inline VOID NTAPI pool_thread_exit_callback(PVOID cache)
+{
+    pool_thread_exit(cache);
+}
+
+// Key of the thread local caches of a pool
+typedef DWORD pool_key;
+
+// Creates a key of the thread local caches. The cache of an exiting thread
+// is passed to pool_thread_exit.
+inline pool_key pool_key_create()
+{
+    return FlsAlloc(&pool_thread_exit_callback);
+}
+
+inline void* pool_key_get(pool_key key)
+{
+    return FlsGetValue(key);
+}
+
+inline void pool_key_set(pool_key key, void* value)
+{
+    FlsSetValue(key, value);
+}
+
+#else
+#include <pthread.h>
+
+// Sets the target to the value if it is equal to the expected one. It is a
+// full memory barrier.
+inline bool pool_compare_exchange(void* volatile* target, void* expected, void* value)
+{
+    return __sync_bool_compare_and_swap(target, expected, value);
+}
+
+// Exchanges the pointer atomically. It is a full memory barrier.
+inline void* pool_exchange(void* volatile* target, void* value)
+{
+    // the builtin alone is only an acquire barrier
+    __sync_synchronize();
+    return __sync_lock_test_and_set(target, value);
+}
+
+// Adds the delta to the target atomically
+inline void pool_add(volatile long* target, long delta)
+{
+    __sync_fetch_and_add(target, delta);
+}
+
+// Called with the cache of a thread when the thread exits
+inline void pool_thread_exit(void* cache);
+
+// Key of the thread local caches of a pool
+typedef pthread_key_t pool_key;
+
+// Creates a key of the thread local caches. The cache of an exiting thread
+// is passed to pool_thread_exit.
+inline pool_key pool_key_create()
+{
+    pool_key key;
+    pthread_key_create(&key, &pool_thread_exit);
+    return key;
+}
+
+inline void* pool_key_get(pool_key key)
+{
+    return pthread_getspecific(key);
+}
+
+inline void pool_key_set(pool_key key, void* value)
+{
+    pthread_setspecific(key, value);
+}
+
+#endif
+
+class pool_cache;
+
+// Header of a pool block. It keeps the cache of the thread that allocated
+// the block and keeps the object that follows it aligned.
+union pool_header
+{
+    pool_cache* mOwner;
+    long double mAlignment;
+};
+
+// Free pool block. The link takes the place of the object.
+struct pool_link
+{
+    pool_link* mNext;
+};
+
+// Free list of one thread for the objects of one size. The owner thread
+// allocates and releases its blocks without synchronization. The other
+// threads push the blocks they release on the remote list, which the owner
+// takes over at once when its own list is empty.
+class pool_cache
+{
+public:
+    explicit pool_cache(size_t size)
+        : mSize(size)
+        , mLocal(NULL)
+        , mRemote(NULL)
+        , mNext(NULL)
+        , mBlocks(0)
+        , mAvailable(0)
+    {
+    }
+
+    // Adds the cache to the registry of its pool
+    void attach(pool_cache* volatile* registry)
+    {
+        for (;;)
+        {
+            mNext = *registry;
+            if (pool_compare_exchange((void* volatile*)registry, mNext, this))
+                return;
+        }
+    }
+
+    // Returns a block. Called by the owner thread only.
+    void* allocate()
+    {
+        if (!mLocal && mRemote)
+            adopt();
+        if (mLocal)
+        {
+            pool_link* link = mLocal;
+            mLocal = link->mNext;
+            --mAvailable;
+            return link;
+        }
+
+        pool_header* header = (pool_header*)::operator new(sizeof(pool_header) + mSize);
+        header->mOwner = this;
+        pool_add(&mBlocks, 1);
+        return header + 1;
+    }
+
+    // Returns a block to the free list. Called by the owner thread only.
+    void release(void* object)
+    {
+        pool_link* link = (pool_link*)object;
+        link->mNext = mLocal;
+        mLocal = link;
+        ++mAvailable;
+    }
+
+    // Pushes a block on the remote list. Called by the other threads. The
+    // block is freed if the owner thread has already exited.
+    void releaseRemote(void* object)
+    {
+        pool_link* link = (pool_link*)object;
+        for (;;)
+        {
+            pool_link* head = mRemote;
+            if (head == orphan())
+            {
+                dispose(link);
+                return;
+            }
+            link->mNext = head;
+            if (pool_compare_exchange((void* volatile*)&mRemote, head, link))
+                return;
+        }
+    }
+
+    // Frees the free blocks. The blocks released after that are freed at
+    // once. Called when the owner thread exits.
+    void detach()
+    {
+        pool_link* remote = (pool_link*)pool_exchange((void* volatile*)&mRemote, orphan());
+        pool_link* lists[] = { remote, mLocal };
+        for (size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); ++i)
+        {
+            pool_link* link = lists[i];
+            while (link)
+            {
+                pool_link* next = link->mNext;
+                dispose(link);
+                link = next;
+            }
+        }
+        mLocal = NULL;
+        mAvailable = 0;
+    }
+
+    // Returns the next cache in the registry of the pool
+    pool_cache* next() const
+    {
+        return mNext;
+    }
+
+    // Returns true until the owner thread exits
+    bool attached() const
+    {
+        return mRemote != orphan();
+    }
+
+    // Returns the number of the blocks taken from the heap and not freed
+    // yet
+    long blocks() const
+    {
+        return mBlocks;
+    }
+
+    // Returns the number of the blocks in the free list
+    long available() const
+    {
+        return mAvailable;
+    }
+
+private:
+    // Marks the remote list of a cache whose owner thread has exited
+    static pool_link* orphan()
+    {
+        static pool_link link;
+        return &link;
+    }
+
+    // Takes over the blocks released by the other threads
+    void adopt()
+    {
+        mLocal = (pool_link*)pool_exchange((void* volatile*)&mRemote, NULL);
+        for (pool_link* link = mLocal; link; link = link->mNext)
+            ++mAvailable;
+    }
+
+    // Returns a block to the heap
+    void dispose(pool_link* link)
+    {
+        ::operator delete((pool_header*)link - 1);
+        pool_add(&mBlocks, -1);
+    }
+
+    pool_cache(const pool_cache&);
+    pool_cache& operator=(const pool_cache&);
+
+    size_t              mSize;
+    pool_link*          mLocal;
+    pool_link* volatile mRemote;
+    pool_cache*         mNext;
+    volatile long       mBlocks;
+    volatile long       mAvailable;
+};
+
+inline void pool_thread_exit(void* cache)
+{
+    ((pool_cache*)cache)->detach();
+}
+
+// Per-thread free list pool of the objects of type T. Every thread
+// allocates from its own cache without synchronization. A block released
+// by another thread returns to the cache of the thread that allocated it.
+// The free blocks of a thread are kept until the thread exits.
+template<class T>
+class object_pool
+{
+public:
+    // Returns storage for one T
+    static void* allocate()
+    {
+        pool_cache* cache = (pool_cache*)pool_key_get(key());
+        if (!cache)
+        {
+            cache = new pool_cache(sizeof(T));
+            cache->attach(&registry());
+            pool_key_set(key(), cache);
+        }
+        return cache->allocate();
+    }
+
+    // Returns the storage provided by allocate to the pool
+    static void deallocate(void* object)
+    {
+        if (!object)
+            return;
+        pool_cache* owner = ((pool_header*)object - 1)->mOwner;
+        if (owner == pool_key_get(key()))
+            owner->release(object);
+        else
+            owner->releaseRemote(object);
+    }
+
+    // Returns the number of the running threads that allocated from the
+    // pool
+    static size_t threads()
+    {
+        size_t result = 0;
+        for (pool_cache* cache = registry(); cache; cache = cache->next())
+            if (cache->attached()) ++result;
+        return result;
+    }
+
+    // Returns the number of the blocks taken from the heap and not freed
+    // yet
+    static size_t blocks()
+    {
+        long result = 0;
+        for (pool_cache* cache = registry(); cache; cache = cache->next())
+            result += cache->blocks();
+        return (size_t)result;
+    }
+
+    // Returns the number of the free blocks in the caches of the threads.
+    // The blocks released by other threads are counted once the thread
+    // that allocated them takes them over.
+    static size_t available()
+    {
+        long result = 0;
+        for (pool_cache* cache = registry(); cache; cache = cache->next())
+            result += cache->available();
+        return (size_t)result;
+    }
+
+    // Returns the number of the blocks that are not available. The
+    // counters of the running threads are read without synchronization, so
+    // the statistics are approximate while the pool is in use.
+    static size_t used()
+    {
+        size_t total = blocks();
+        size_t spare = available();
+        return total > spare ? total - spare : 0;
+    }
+
+private:
+    static pool_key key()
+    {
+        static pool_key key = pool_key_create();
+        return key;
+    }
+
+    // The caches of all the threads that allocated from the pool. The
+    // caches are never removed, the blocks of an exited thread may be
+    // still in use.
+    static pool_cache* volatile& registry()
+    {
+        static pool_cache* volatile head = NULL;
+        return head;
+    }
+};
+
+// Standard allocator on top of the object pools. The shared pointers use
+// it to take their control blocks from the pool of the control block type.
+template<class T>
+class object_pool_allocator
+{
+public:
+    typedef T         value_type;
+    typedef T*        pointer;
+    typedef const T*  const_pointer;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+    typedef size_t    size_type;
+    typedef ptrdiff_t difference_type;
+
+    template<class U>
+    struct rebind
+    {
+        typedef object_pool_allocator<U> other;
+    };
+
+    object_pool_allocator()
+    {
+    }
+
+    template<class U>
+    object_pool_allocator(const object_pool_allocator<U>&)
+    {
+    }
+
+    pointer address(reference value) const
+    {
+        return &value;
+    }
+
+    const_pointer address(const_reference value) const
+    {
+        return &value;
+    }
+
+    // Only the single objects come from the pool
+    pointer allocate(size_type count, const void* = NULL)
+    {
+        if (count == 1)
+            return (pointer)object_pool<T>::allocate();
+        return (pointer)::operator new(count * sizeof(T));
+    }
+
+    void deallocate(pointer object, size_type count)
+    {
+        if (count == 1)
+            object_pool<T>::deallocate(object);
+        else
+            ::operator delete(object);
+    }
+
+    void construct(pointer object, const T& value)
+    {
+        new (object) T(value);
+    }
+
+    void destroy(pointer object)
+    {
+        object->~T();
+    }
+
+    size_type max_size() const
+    {
+        return size_type(-1) / sizeof(T);
+    }
+};
+
+template<class T, class U>
+inline bool operator==(const object_pool_allocator<T>&, const object_pool_allocator<U>&)
+{
+    return true;
+}
+
+template<class T, class U>
+inline bool operator!=(const object_pool_allocator<T>&, const object_pool_allocator<U>&)
+{
+    return false;
+}
+
+#endif // __CORE_OBJECT_POOL_HPP_H_
+
@@ -0,0 +1,119 @@
+#ifndef __CORE_OBJECT_SLAB_HPP_H_
+#define __CORE_OBJECT_SLAB_HPP_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <new>
+#include <vector>
+// Standard C Library
+#include <stddef.h>
+
+// Contiguous storage for the clones of objects of the same type. The
+// pointers to the objects share the ownership of the whole slab, so it is
+// destroyed together with the last of them.
+template<class T>
+class object_slab
+{
+public:
+    explicit object_slab(size_t capacity)
+        : mObjects(static_cast<T*>(::operator new(capacity * sizeof(T))))
+        , mSize(0)
+    {
+    }
+
+    ~object_slab()
+    {
+        while (mSize)
+            mObjects[--mSize].~T();
+        ::operator delete(mObjects);
+    }
+
+    // Copy constructs the object at the end of the slab. The slab should
+    // have room for it.
+    T* push_back(const T& object)
+    {
+        T* place = mObjects + mSize;
+        new (place) T(object);
+        ++mSize;
+        return place;
+    }
+
+private:
+    object_slab(const object_slab&);
+    object_slab& operator=(const object_slab&);
+
+    T*     mObjects;
+    size_t mSize;
+};
+
+// Clones a vector of polymorphic objects group by group. The objects are
+// ordered by the identifiers of their types with a counting sort, then
+// each group is copied into its own slab without a virtual call per
+// object. The clones are placed at the positions of the originals. The
+// null objects should have the identifier 0, they stay null. Every clone
+// shares the ownership of its whole slab, so the slab and the destructors
+// of all its objects wait for the last of its clones. The clones could not
+// use enable_shared_from_this, their weak pointer is never set.
+template<class Base>
+class slab_cloner
+{
+public:
+    typedef boost::shared_ptr<Base> pointer;
+
+    // The identifiers should be less than the count of the groups
+    slab_cloner(const std::vector<pointer>& objects,
+                const std::vector<long>& ids,
+                size_t groups,
+                std::vector<pointer>& result)
+        : mObjects(objects)
+        , mResult(result)
+        , mOrder(ids.size())
+        , mStarts(groups + 1, 0)
+    {
+        mResult.assign(ids.size(), pointer());
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            BOOST_ASSERT((size_t)ids[i] < groups);
+            ++mStarts[ids[i] + 1];
+        }
+        for (size_t g = 0; g < groups; ++g)
+            mStarts[g + 1] += mStarts[g];
+        std::vector<size_t> next(mStarts.begin(), mStarts.end() - 1);
+        for (size_t i = 0; i < ids.size(); ++i)
+            mOrder[next[ids[i]]++] = i;
+    }
+
+    // Clones the group of the objects with the identifier of T
+    template<class T>
+    void clone(long id)
+    {
+        size_t begin = mStarts[id];
+        size_t end = mStarts[id + 1];
+        if (begin == end)
+            return;
+
+        boost::shared_ptr<object_slab<T> > slab(new object_slab<T>(end - begin));
+        for (size_t i = begin; i < end; ++i)
+        {
+            size_t index = mOrder[i];
+            T* clone = slab->push_back(static_cast<const T&>(*mObjects[index]));
+            // the clone shares the ownership of the slab
+            mResult[index] = pointer(slab, clone);
+        }
+    }
+
+private:
+    slab_cloner(const slab_cloner&);
+    slab_cloner& operator=(const slab_cloner&);
+
+    const std::vector<pointer>& mObjects;
+    std::vector<pointer>&       mResult;
+    std::vector<size_t>         mOrder;
+    std::vector<size_t>         mStarts;
+};
+
+#endif // __CORE_OBJECT_SLAB_HPP_H_
+
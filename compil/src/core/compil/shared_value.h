@@ -0,0 +1,79 @@
+#ifndef __CORE_SHARED_VALUE_HPP_H_
+#define __CORE_SHARED_VALUE_HPP_H_
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// Field storage shared between the copies of an immutable object. Copying
+// a shared_value only shares the storage, the storage is copied when a
+// shared value is changed. So a Builder derived from an existing object
+// copies only the fields it changes.
+template<class T>
+class shared_value
+{
+public:
+    shared_value()
+    {
+    }
+
+    shared_value(const T& value)
+        : mValue(boost::make_shared<T>(value))
+    {
+    }
+
+    // Reuses the storage if it is not shared
+    shared_value& operator=(const T& value)
+    {
+        if (mValue && mValue.unique())
+            *mValue = value;
+        else
+            mValue = boost::make_shared<T>(value);
+        return *this;
+    }
+
+    operator const T&() const
+    {
+        return get();
+    }
+
+    const T& get() const
+    {
+        return mValue ? *mValue : empty();
+    }
+
+    // Provides mutable access to the value. The storage is copied first if
+    // it is shared with another object.
+    T& mutate()
+    {
+        if (!mValue)
+            mValue = boost::make_shared<T>();
+        else if (!mValue.unique())
+            mValue = boost::make_shared<T>(*mValue);
+        return *mValue;
+    }
+
+    // Resets the value to the default one without an allocation
+    void clear()
+    {
+        mValue.reset();
+    }
+
+    // Returns true if both values use the same storage
+    bool shares(const shared_value& other) const
+    {
+        return mValue && mValue == other.mValue;
+    }
+
+private:
+    static const T& empty()
+    {
+        static const T value = T();
+        return value;
+    }
+
+    boost::shared_ptr<T> mValue;
+};
+
+#endif // __CORE_SHARED_VALUE_HPP_H_
+
@@ -0,0 +1,415 @@
+#ifndef __CORE_SHM_CHANNEL_HPP_H_
+#define __CORE_SHM_CHANNEL_HPP_H_
+
+// Boost C++ Integer
+#include <boost/cstdint.hpp>
+// Boost C++ Interprocess
+#include <assert.h>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+// Boost C++ Smart Pointers
+#include <boost/smart_ptr/detail/yield_k.hpp>
+// Standard Template Library
+#include <stdexcept>
+#include <string>
+#include <vector>
+// Standard C Library
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+
+// Orders the memory accesses before and after it. The rings are shared
+// between processes, so it has to be a hardware barrier too.
+inline void shm_barrier()
+{
+    MemoryBarrier();
+}
+
+// Monotonic time in milliseconds. It wraps around, but the difference of
+// two readings is right.
+inline boost::uint32_t shm_milliseconds()
+{
+    return GetTickCount();
+}
+
+#else
+#include <time.h>
+
+// Orders the memory accesses before and after it. The rings are shared
+// between processes, so it has to be a hardware barrier too.
+inline void shm_barrier()
+{
+    __sync_synchronize();
+}
+
+// Monotonic time in milliseconds. It wraps around, but the difference of
+// two readings is right.
+inline boost::uint32_t shm_milliseconds()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (boost::uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+#endif
+
+// Thrown when the peer of a ring does not respond within the timeout, for
+// example because its process has died or has never started. The channel
+// should not be used after it.
+class shm_timeout_error : public std::runtime_error
+{
+public:
+    explicit shm_timeout_error(const std::string& message)
+        : std::runtime_error(message)
+    {
+    }
+};
+
+// Single producer single consumer ring of messages placed in a shared
+// memory. Each message is a 32 bit size followed by the payload and it is
+// always contiguous, so it could be written and read in place. The
+// positions are free running counters, their difference is the used space.
+class shm_ring
+{
+public:
+    // The positions of the ring. They are in separate cache lines, because
+    // the producer and the consumer update them from different processes.
+    struct header
+    {
+        volatile boost::uint32_t mWrite;
+        char                     mWritePadding[60];
+        volatile boost::uint32_t mRead;
+        char                     mReadPadding[60];
+    };
+
+    shm_ring()
+        : mHeader(0)
+        , mData(0)
+        , mCapacity(0)
+        , mReserved(0)
+        , mReleased(0)
+        , mTimeout(0)
+    {
+    }
+
+    // The capacity should be a power of two. The waits for the peer throw
+    // shm_timeout_error after the timeout in milliseconds, 0 waits
+    // forever.
+    shm_ring(header* ring, char* data, boost::uint32_t capacity, boost::uint32_t timeout)
+        : mHeader(ring)
+        , mData(data)
+        , mCapacity(capacity)
+        , mReserved(0)
+        , mReleased(0)
+        , mTimeout(timeout)
+    {
+    }
+
+    // Returns the place of a message with the size of the payload. It
+    // waits while the ring is full, up to the timeout. The message is
+    // visible to the consumer only after the commit. It could not be
+    // larger than the half of the ring, so it always fits after the
+    // skipped space at the end. Throws std::length_error for a larger
+    // message, it would never fit.
+    char* reserve(boost::uint32_t size)
+    {
+        boost::uint32_t frame = align(sizeof(boost::uint32_t) + size);
+        if ((size > mCapacity / 2) || (frame > mCapacity / 2))
+            throw std::length_error("shm_ring: the message is larger than the half of the ring");
+        boost::uint32_t start = 0;
+        boost::uint32_t write = mHeader->mWrite;
+        boost::uint32_t offset = write & (mCapacity - 1);
+        // the message does not fit before the end, the rest of the ring is skipped
+        boost::uint32_t skip = mCapacity - offset < frame ? mCapacity - offset : 0;
+        for (unsigned k = 0; write + skip + frame - load(&mHeader->mRead) > mCapacity; ++k)
+            pause(k, start);
+        if (skip)
+        {
+            boost::uint32_t marker = skipMarker;
+            memcpy(mData + offset, &marker, sizeof(boost::uint32_t));
+            write += skip;
+            offset = 0;
+        }
+        mReserved = write + frame;
+        memcpy(mData + offset, &size, sizeof(boost::uint32_t));
+        return mData + offset + sizeof(boost::uint32_t);
+    }
+
+    // Publishes the reserved message to the consumer
+    void commit()
+    {
+        store(&mHeader->mWrite, mReserved);
+    }
+
+    // Returns the payload of the oldest message and its size, or null if
+    // the ring is empty. The payload stays in place until the release.
+    const char* peek(boost::uint32_t& size)
+    {
+        boost::uint32_t read = mHeader->mRead;
+        if (load(&mHeader->mWrite) == read) return 0;
+        boost::uint32_t offset = read & (mCapacity - 1);
+        memcpy(&size, mData + offset, sizeof(boost::uint32_t));
+        if (size == skipMarker)
+        {
+            // the producer always writes a message after the skipped space
+            read += mCapacity - offset;
+            offset = 0;
+            memcpy(&size, mData, sizeof(boost::uint32_t));
+        }
+        mReleased = read + align(sizeof(boost::uint32_t) + size);
+        return mData + offset + sizeof(boost::uint32_t);
+    }
+
+    // Waits for a message, up to the timeout, and returns its payload
+    const char* wait(boost::uint32_t& size)
+    {
+        boost::uint32_t start = 0;
+        const char* payload = peek(size);
+        for (unsigned k = 0; !payload; ++k)
+        {
+            pause(k, start);
+            payload = peek(size);
+        }
+        return payload;
+    }
+
+    // Returns the space of the peeked message to the producer
+    void release()
+    {
+        store(&mHeader->mRead, mReleased);
+    }
+
+private:
+    static const boost::uint32_t skipMarker = 0xFFFFFFFF;
+
+    // The messages are 8 bytes aligned, so the size of the next one always
+    // fits before the end
+    static boost::uint32_t align(boost::uint32_t size)
+    {
+        return (size + 7) & ~7;
+    }
+
+    // Yields in the k-th round of a wait for the peer. Throws
+    // shm_timeout_error when the wait, started in the first round, is
+    // longer than the timeout
+    void pause(unsigned k, boost::uint32_t& start)
+    {
+        boost::detail::yield(k);
+        if (!mTimeout) return;
+        boost::uint32_t now = shm_milliseconds();
+        if (k == 0)
+            start = now;
+        else if (now - start > mTimeout)
+            throw shm_timeout_error("shm_ring: the peer did not respond within the timeout");
+    }
+
+    static boost::uint32_t load(volatile boost::uint32_t* position)
+    {
+        boost::uint32_t value = *position;
+        shm_barrier();
+        return value;
+    }
+
+    static void store(volatile boost::uint32_t* position, boost::uint32_t value)
+    {
+        shm_barrier();
+        *position = value;
+    }
+
+    header*         mHeader;
+    char*           mData;
+    boost::uint32_t mCapacity;
+    boost::uint32_t mReserved;
+    boost::uint32_t mReleased;
+    boost::uint32_t mTimeout;
+};
+
+// Writes the arguments of a call directly in the place reserved in the
+// ring. The plain values are copied as they are, the strings and the
+// vectors are prefixed with their size.
+class shm_writer
+{
+public:
+    explicit shm_writer(char* data)
+        : mData(data)
+    {
+    }
+
+    template<class T>
+    static boost::uint32_t size(const T&)
+    {
+        return sizeof(T);
+    }
+
+    static boost::uint32_t size(const std::string& value)
+    {
+        return sizeof(boost::uint32_t) + (boost::uint32_t)value.size();
+    }
+
+    template<class T>
+    static boost::uint32_t size(const std::vector<T>& value)
+    {
+        return sizeof(boost::uint32_t) + (boost::uint32_t)(value.size() * sizeof(T));
+    }
+
+    template<class T>
+    void write(const T& value)
+    {
+        memcpy(mData, &value, sizeof(T));
+        mData += sizeof(T);
+    }
+
+    void write(const std::string& value)
+    {
+        write((boost::uint32_t)value.size());
+        memcpy(mData, value.data(), value.size());
+        mData += value.size();
+    }
+
+    template<class T>
+    void write(const std::vector<T>& value)
+    {
+        write((boost::uint32_t)value.size());
+        if (value.empty()) return;
+        memcpy(mData, &value[0], value.size() * sizeof(T));
+        mData += value.size() * sizeof(T);
+    }
+
+private:
+    char* mData;
+};
+
+// Reads the arguments of a call from the message in the ring
+class shm_reader
+{
+public:
+    explicit shm_reader(const char* data)
+        : mData(data)
+    {
+    }
+
+    template<class T>
+    void read(T& value)
+    {
+        memcpy(&value, mData, sizeof(T));
+        mData += sizeof(T);
+    }
+
+    void read(std::string& value)
+    {
+        boost::uint32_t size;
+        const char* data = view(size);
+        value.assign(data, size);
+    }
+
+    template<class T>
+    void read(std::vector<T>& value)
+    {
+        boost::uint32_t size;
+        read(size);
+        value.resize(size);
+        if (value.empty()) return;
+        memcpy(&value[0], mData, size * sizeof(T));
+        mData += size * sizeof(T);
+    }
+
+    // Returns the bytes of a string or a vector in place, without copying
+    // them out of the ring. They are valid until the message is released.
+    const char* view(boost::uint32_t& size)
+    {
+        read(size);
+        const char* data = mData;
+        mData += size;
+        return data;
+    }
+
+private:
+    const char* mData;
+};
+
+// Pair of rings in a named shared memory that connects a client and a
+// server in different processes of the same host. The client writes the
+// requests and reads the responses, the server does the opposite. Each
+// side should be used from a single thread.
+class shm_channel
+{
+public:
+    enum side
+    {
+        server_side,
+        client_side
+    };
+
+    // The server creates the shared memory and the client opens it. The
+    // capacity of each ring is rounded up to a power of two. Throws
+    // boost::interprocess::interprocess_exception if the shared memory
+    // could not be created or opened. The waits for the other side throw
+    // shm_timeout_error after the timeout in milliseconds, 0 waits
+    // forever. A call of the client waits for the server as long as the
+    // method runs, so the timeout should be longer than the slowest
+    // method.
+    shm_channel(const char* name,
+                side side,
+                boost::uint32_t capacity = 1 << 20,
+                boost::uint32_t timeout = 10000)
+        : mName(name)
+        , mSide(side)
+    {
+        using namespace boost::interprocess;
+        if (side == server_side)
+        {
+            boost::uint32_t size = 64;
+            while (size < capacity)
+                size <<= 1;
+            shared_memory_object::remove(name);
+            shared_memory_object memory(create_only, name, read_write);
+            memory.truncate(2 * (sizeof(shm_ring::header) + size));
+            mapped_region region(memory, read_write);
+            mRegion.swap(region);
+        }
+        else
+        {
+            shared_memory_object memory(open_only, name, read_write);
+            mapped_region region(memory, read_write);
+            mRegion.swap(region);
+        }
+
+        // the new shared memory is zero filled, so both rings start empty
+        char* base = static_cast<char*>(mRegion.get_address());
+        boost::uint32_t size = (boost::uint32_t)(mRegion.get_size() / 2 - sizeof(shm_ring::header));
+        char* second = base + sizeof(shm_ring::header) + size;
+        mRequests = shm_ring((shm_ring::header*)base, base + sizeof(shm_ring::header), size, timeout);
+        mResponses = shm_ring((shm_ring::header*)second, second + sizeof(shm_ring::header), size, timeout);
+    }
+
+    // The server removes the name of the shared memory
+    ~shm_channel()
+    {
+        if (mSide == server_side)
+            boost::interprocess::shared_memory_object::remove(mName.c_str());
+    }
+
+    shm_ring& requests()
+    {
+        return mRequests;
+    }
+
+    shm_ring& responses()
+    {
+        return mResponses;
+    }
+
+private:
+    shm_channel(const shm_channel&);
+    shm_channel& operator=(const shm_channel&);
+
+    std::string                        mName;
+    side                               mSide;
+    boost::interprocess::mapped_region mRegion;
+    shm_ring                           mRequests;
+    shm_ring                           mResponses;
+};
+
+#endif // __CORE_SHM_CHANNEL_HPP_H_
+
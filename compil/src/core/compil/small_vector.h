@@ -0,0 +1,165 @@
+#ifndef __CORE_SMALL_VECTOR_HPP_H_
+#define __CORE_SMALL_VECTOR_HPP_H_
+
+// Boost C++ Type Traits
+#include <boost/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+// Standard Template Library
+#include <algorithm>
+#include <new>
+
+// Vector that keeps up to N elements inline in the object and allocates
+// heap memory only when it grows beyond N elements. It implements the
+// subset of the std::vector interface used by the generated code.
+template<class T, size_t N>
+class small_vector
+{
+public:
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef size_t size_type;
+
+    small_vector()
+        : mBegin(inline_data())
+        , mSize(0)
+        , mCapacity(N)
+    {
+    }
+
+    small_vector(const small_vector& other)
+        : mBegin(inline_data())
+        , mSize(0)
+        , mCapacity(N)
+    {
+        append(other.begin(), other.end());
+    }
+
+    ~small_vector()
+    {
+        clear();
+        release();
+    }
+
+    small_vector& operator=(const small_vector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            append(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    iterator begin() { return mBegin; }
+    const_iterator begin() const { return mBegin; }
+    iterator end() { return mBegin + mSize; }
+    const_iterator end() const { return mBegin + mSize; }
+
+    size_type size() const { return mSize; }
+    size_type capacity() const { return mCapacity; }
+    bool empty() const { return mSize == 0; }
+
+    // Returns true while the elements are stored inline in the object
+    bool is_inline() const { return mBegin == inline_data(); }
+
+    reference operator[](size_type index) { return mBegin[index]; }
+    const_reference operator[](size_type index) const { return mBegin[index]; }
+    reference front() { return mBegin[0]; }
+    const_reference front() const { return mBegin[0]; }
+    reference back() { return mBegin[mSize - 1]; }
+    const_reference back() const { return mBegin[mSize - 1]; }
+
+    void push_back(const T& value)
+    {
+        if (mSize == mCapacity)
+        {
+            // the value could be an element of the vector
+            T copy(value);
+            reserve(2 * mCapacity);
+            new (mBegin + mSize) T(copy);
+        }
+        else
+            new (mBegin + mSize) T(value);
+        ++mSize;
+    }
+
+    void pop_back()
+    {
+        --mSize;
+        (mBegin + mSize)->~T();
+    }
+
+    void clear()
+    {
+        while (mSize > 0)
+            pop_back();
+    }
+
+    // Moves the elements to the heap when the capacity grows beyond the
+    // inline capacity. The inline storage is not reused after that.
+    void reserve(size_type capacity)
+    {
+        if (capacity <= mCapacity) return;
+        T* begin = static_cast<T*>(::operator new(capacity * sizeof(T)));
+        for (size_type i = 0; i < mSize; ++i)
+        {
+            new (begin + i) T(mBegin[i]);
+            (mBegin + i)->~T();
+        }
+        release();
+        mBegin = begin;
+        mCapacity = capacity;
+    }
+
+    void resize(size_type size, const T& value = T())
+    {
+        while (mSize > size)
+            pop_back();
+        reserve(size);
+        for (; mSize < size; ++mSize)
+            new (mBegin + mSize) T(value);
+    }
+
+    bool operator==(const small_vector& other) const
+    {
+        return mSize == other.mSize && std::equal(begin(), end(), other.begin());
+    }
+
+    bool operator!=(const small_vector& other) const
+    {
+        return !operator==(other);
+    }
+
+    bool operator<(const small_vector& other) const
+    {
+        return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+    }
+
+private:
+    T* inline_data() { return static_cast<T*>(mStorage.address()); }
+    const T* inline_data() const { return static_cast<const T*>(mStorage.address()); }
+
+    void release()
+    {
+        if (!is_inline())
+            ::operator delete(mBegin);
+    }
+
+    void append(const_iterator first, const_iterator last)
+    {
+        reserve(mSize + (last - first));
+        for (; first != last; ++first, ++mSize)
+            new (mBegin + mSize) T(*first);
+    }
+
+    T* mBegin;
+    size_type mSize;
+    size_type mCapacity;
+    boost::aligned_storage<N * sizeof(T), boost::alignment_of<T>::value> mStorage;
+};
+
+#endif // __CORE_SMALL_VECTOR_HPP_H_
+
@@ -0,0 +1,314 @@
+#ifndef __CORE_SNAPSHOT_HPP_H_
+#define __CORE_SNAPSHOT_HPP_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/smart_ptr/detail/yield_k.hpp>
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <stdexcept>
+// Standard C Library
+#include <stddef.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+
+// Exchanges the pointer atomically. It is a full memory barrier.
+inline void* snapshot_exchange(void* volatile* target, void* value)
+{
+    return InterlockedExchangePointer(target, value);
+}
+
+// Sets the target to the value if it is equal to the expected one. It is a
+// full memory barrier.
+inline bool snapshot_compare_exchange(volatile long* target, long expected, long value)
+{
+    return InterlockedCompareExchange(target, value, expected) == expected;
+}
+
+// Orders the memory accesses before and after it
+inline void snapshot_barrier()
+{
+    MemoryBarrier();
+}
+
+#else
+
+// Exchanges the pointer atomically. It is a full memory barrier.
+inline void* snapshot_exchange(void* volatile* target, void* value)
+{
+    // the builtin alone is only an acquire barrier
+    __sync_synchronize();
+    return __sync_lock_test_and_set(target, value);
+}
+
+// Sets the target to the value if it is equal to the expected one. It is a
+// full memory barrier.
+inline bool snapshot_compare_exchange(volatile long* target, long expected, long value)
+{
+    return __sync_bool_compare_and_swap(target, expected, value);
+}
+
+// Orders the memory accesses before and after it
+inline void snapshot_barrier()
+{
+    __sync_synchronize();
+}
+
+#endif
+
+// Epoch announced by a reader of a snapshot. The epoch is 0 when the
+// reader is not in a view. The slots are 64 bytes long and the snapshot
+// aligns them to 64 bytes, so every slot takes its own cache line and the
+// readers do not write to shared memory.
+struct snapshot_slot
+{
+    volatile long mUsed;
+    volatile long mEpoch;
+    long          mDepth;
+    char          mPadding[64 - 3 * sizeof(long)];
+};
+
+// Holder of the current version of an immutable object. The readers get
+// the current version wait-free - a view only announces the epoch of its
+// reader and loads a pointer, it never takes a lock and never touches a
+// reference count. The writers publish the new versions under a spin lock.
+// A replaced version is retired with the epoch of its replacement and
+// released once no reader announces that or an earlier epoch.
+template<class T>
+class snapshot
+{
+    struct version;
+
+public:
+    typedef boost::shared_ptr<T> pointer;
+
+    class view;
+
+    // Registration of a reader thread. It holds one of the reader slots of
+    // the snapshot and should not be shared between threads. Throws
+    // std::length_error when all the slots are taken.
+    class reader
+    {
+    public:
+        explicit reader(snapshot& holder)
+            : mHolder(holder)
+            , mSlot(holder.acquire())
+        {
+        }
+
+        ~reader()
+        {
+            mHolder.release(mSlot);
+        }
+
+    private:
+        friend class snapshot<T>::view;
+
+        reader(const reader&);
+        reader& operator=(const reader&);
+
+        snapshot&      mHolder;
+        snapshot_slot* mSlot;
+    };
+
+    // Read section of a reader. The version seen by the view is not
+    // released before the view is destroyed. The views of a reader can be
+    // nested.
+    class view
+    {
+    public:
+        explicit view(reader& owner)
+            : mSlot(owner.mSlot)
+        {
+            if (!mSlot->mDepth++)
+            {
+                mSlot->mEpoch = owner.mHolder.mEpoch;
+                // the epoch should be visible before the version is loaded
+                snapshot_barrier();
+            }
+            mVersion = owner.mHolder.mCurrent;
+        }
+
+        ~view()
+        {
+            if (!--mSlot->mDepth)
+            {
+                // the version should not be used after the epoch is cleared
+                snapshot_barrier();
+                mSlot->mEpoch = 0;
+            }
+        }
+
+        const T* get() const { return mVersion->mObject.get(); }
+        const T& operator*() const { return *get(); }
+        const T* operator->() const { return get(); }
+
+        // Shares the ownership of the version beyond the view
+        pointer share() const { return mVersion->mObject; }
+
+    private:
+        view(const view&);
+        view& operator=(const view&);
+
+        snapshot_slot* mSlot;
+        version*       mVersion;
+    };
+
+    // The readers registered at the same time could not exceed the number
+    // of the slots
+    explicit snapshot(const pointer& object = pointer(), size_t readers = 64)
+        : mCurrent(new version(object))
+        , mRetired(0)
+        , mEpoch(1)
+        , mLock(0)
+        , mMemory(new char[readers * sizeof(snapshot_slot) + 63])
+        , mSlots((snapshot_slot*)(((size_t)mMemory + 63) & ~(size_t)63))
+        , mSlotCount(readers)
+    {
+        for (size_t i = 0; i < readers; ++i)
+        {
+            mSlots[i].mUsed = 0;
+            mSlots[i].mEpoch = 0;
+            mSlots[i].mDepth = 0;
+        }
+    }
+
+    // There should be no readers left
+    ~snapshot()
+    {
+        delete mCurrent;
+        while (mRetired)
+        {
+            version* retired = mRetired;
+            mRetired = retired->mNext;
+            delete retired;
+        }
+        delete[] mMemory;
+    }
+
+    // Publishes a new version, e.g. the result of Builder::finalize(). The
+    // views see either the previous or the new version. The versions that
+    // no reader can see anymore are released.
+    void publish(const pointer& object)
+    {
+        version* fresh = new version(object);
+        lock();
+        version* previous = (version*)snapshot_exchange((void* volatile*)&mCurrent, fresh);
+        previous->mEpoch = mEpoch;
+        previous->mNext = mRetired;
+        mRetired = previous;
+        mEpoch = mEpoch + 1;
+        collect();
+        unlock();
+    }
+
+    // Returns the current version. It takes the lock of the writers, the
+    // readers should use a view instead.
+    pointer current()
+    {
+        lock();
+        pointer object = mCurrent->mObject;
+        unlock();
+        return object;
+    }
+
+    // Releases the retired versions that no reader can see anymore
+    void reclaim()
+    {
+        lock();
+        snapshot_barrier();
+        collect();
+        unlock();
+    }
+
+private:
+    friend class reader;
+    friend class view;
+
+    struct version
+    {
+        explicit version(const pointer& object)
+            : mObject(object)
+            , mEpoch(0)
+            , mNext(0)
+        {
+        }
+
+        pointer  mObject;
+        long     mEpoch;
+        version* mNext;
+    };
+
+    snapshot(const snapshot&);
+    snapshot& operator=(const snapshot&);
+
+    snapshot_slot* acquire()
+    {
+        for (size_t i = 0; i < mSlotCount; ++i)
+        {
+            if (snapshot_compare_exchange(&mSlots[i].mUsed, 0, 1))
+                return &mSlots[i];
+        }
+        throw std::length_error("snapshot: there are more readers than slots");
+    }
+
+    void release(snapshot_slot* slot)
+    {
+        BOOST_ASSERT(!slot->mDepth && "the reader has views");
+        snapshot_barrier();
+        slot->mUsed = 0;
+    }
+
+    // A version retired in an epoch is visible only to the readers that
+    // announced the same or an earlier epoch
+    void collect()
+    {
+        long oldest = mEpoch;
+        for (size_t i = 0; i < mSlotCount; ++i)
+        {
+            long epoch = mSlots[i].mEpoch;
+            if (epoch && epoch < oldest)
+                oldest = epoch;
+        }
+
+        version** link = &mRetired;
+        while (*link)
+        {
+            version* retired = *link;
+            if (retired->mEpoch < oldest)
+            {
+                *link = retired->mNext;
+                delete retired;
+            }
+            else
+            {
+                link = &retired->mNext;
+            }
+        }
+    }
+
+    void lock()
+    {
+        for (unsigned k = 0; !snapshot_compare_exchange(&mLock, 0, 1); ++k)
+            boost::detail::yield(k);
+    }
+
+    void unlock()
+    {
+        snapshot_barrier();
+        mLock = 0;
+    }
+
+    version* volatile mCurrent;
+    version*          mRetired;
+    volatile long     mEpoch;
+    volatile long     mLock;
+    char*             mMemory;
+    snapshot_slot*    mSlots;
+    size_t            mSlotCount;
+};
+
+#endif // __CORE_SNAPSHOT_HPP_H_
+
@@ -31,6 +31,7 @@
 //
 
 #include "core/configuration/configuration_manager.h"
+#include "core/platform/version.h"
 
 #include <boost/program_options.hpp>
 #include <boost/program_options/parsers.hpp>
@@ -141,7 +142,7 @@ bool ConfigurationManager::parse(int argc, const char **argv, const std::string&
 
 void ConfigurationManager::printVersion() const
 {
-    std::cout << "Compil 0.0.0.\nCopyright (C) 2011 George Georgiev\n";
+    std::cout << "Compil " COMPIL_VERSION ".\nCopyright (C) 2011 George Georgiev\n";
 }
 
 void ConfigurationManager::printHelp() const
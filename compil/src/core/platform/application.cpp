@@ -34,8 +34,13 @@
 
 #if defined(_WIN32)
 #  include <windows.h>
+#  include <psapi.h>
+#  pragma comment(lib, "psapi.lib")
 #elif defined(__APPLE__)
 #  include <mach-o/dyld.h>
+#  include <sys/resource.h>
+#else
+#  include <sys/resource.h>
 #endif
 
 namespace plt
@@ -74,4 +79,30 @@ boost::filesystem::path getApplicationPath()
     return path;
 }
 
-}
\ No newline at end of file
+long long getPeakMemoryUsage()
+{
+#if defined(_WIN32)
+
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+
+#else
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+#  if defined(__APPLE__)
+    // in bytes
+    return usage.ru_maxrss;
+#  else // LINUX
+    // in kilobytes
+    return (long long)usage.ru_maxrss * 1024;
+#  endif
+
+#endif
+}
+
+}
@@ -40,6 +40,10 @@ namespace plt
 
 boost::filesystem::path getApplicationPath();
 
+// Returns the peak resident memory of the process in bytes or 0 if it is
+// not available
+long long getPeakMemoryUsage();
+
 }
 
 #endif
@@ -34,6 +34,8 @@
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 namespace plt
 {
 
@@ -43,4 +45,16 @@ TEST(CorePlatformApplicationTests, sanity)
     EXPECT_STREQ("core-unit", appPath.stem().generic_string().c_str());
 }
 
+TEST(CorePlatformApplicationTests, peakMemoryUsage)
+{
+    long long before = getPeakMemoryUsage();
+    EXPECT_LT(0, before);
+
+    const size_t size = 64 * 1024 * 1024;
+    std::vector<char> buffer(size, 1);
+    long long after = getPeakMemoryUsage();
+    EXPECT_LE(before, after);
+    EXPECT_LE((long long)size, after);
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,139 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "core/platform/benchmark.h"
+
+#if defined(_WIN32)
+#  include <windows.h>
+#elif defined(__APPLE__)
+#  include <mach/mach_time.h>
+#else
+#  include <time.h>
+#endif
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+namespace plt
+{
+
+static const void* volatile gSink = 0;
+
+static long long getMinimumTime()
+{
+    long long milliseconds = 10;
+    const char* environment = getenv("COMPIL_BENCHMARK_TIME");
+    if (environment && (atoi(environment) > 0))
+        milliseconds = atoi(environment);
+    return milliseconds * 1000000;
+}
+
+long long getMonotonicTime()
+{
+#if defined(_WIN32)
+
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    ::QueryPerformanceFrequency(&frequency);
+    ::QueryPerformanceCounter(&counter);
+    return (long long)((double)counter.QuadPart * 1000000000.0 / (double)frequency.QuadPart);
+
+#elif defined(__APPLE__)
+
+    static mach_timebase_info_data_t timebase = {0, 0};
+    if (timebase.denom == 0)
+        mach_timebase_info(&timebase);
+    return (long long)(mach_absolute_time() * timebase.numer / timebase.denom);
+
+#else // LINUX
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000 + ts.tv_nsec;
+
+#endif
+}
+
+Benchmark::Benchmark(const std::string& name)
+    : mName(name)
+    , mMinimumTime(getMinimumTime())
+    , mStart(getMonotonicTime())
+    , mElapsed(0)
+    , mIterations(0)
+    , mNextCheck(2)
+{
+}
+
+Benchmark::~Benchmark()
+{
+    std::cout << "[ BENCHMARK] "
+              << mName << ": "
+              << iterations() << " iterations, "
+              << std::fixed << std::setprecision(2)
+              << nanosecondsPerIteration() << " ns/op"
+              << std::endl;
+}
+
+bool Benchmark::check()
+{
+    mElapsed = getMonotonicTime() - mStart;
+    if (mElapsed >= mMinimumTime)
+        return false;
+    mNextCheck = mIterations * 2;
+    return true;
+}
+
+void Benchmark::escape(const void* value)
+{
+    gSink = value;
+}
+
+long long Benchmark::iterations() const
+{
+    // the last call of running does not execute the body
+    return mIterations > 0 ? mIterations - 1 : 0;
+}
+
+long long Benchmark::elapsed() const
+{
+    return mElapsed;
+}
+
+double Benchmark::nanosecondsPerIteration() const
+{
+    if (iterations() == 0)
+        return 0;
+    return (double)mElapsed / (double)iterations();
+}
+
+}
@@ -0,0 +1,97 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#ifndef _CORE_PLATFORM_BENCHMARK_H__
+#define _CORE_PLATFORM_BENCHMARK_H__
+
+#include <string>
+
+namespace plt
+{
+
+// Returns the value of a monotonic clock in nanoseconds. Only the
+// difference between two values is meaningful.
+long long getMonotonicTime();
+
+// Micro benchmark loop. The body is repeated until the minimum
+// measurement time elapses. The time is checked on batches of growing
+// size so the check itself does not affect the measured body. The
+// result is reported when the benchmark object is destroyed.
+//
+//     plt::Benchmark benchmark("Structure.copy");
+//     while (benchmark.running())
+//     {
+//         ...
+//     }
+//
+// The minimum measurement time in milliseconds could be changed with the
+// COMPIL_BENCHMARK_TIME environment variable.
+class Benchmark
+{
+public:
+    Benchmark(const std::string& name);
+    ~Benchmark();
+
+    bool running()
+    {
+        if (++mIterations < mNextCheck)
+            return true;
+        return check();
+    }
+
+    // Makes the value observable so the compiler does not optimize away
+    // the computation of the value
+    template<class T>
+    static void consume(const T& value)
+    {
+        escape(&value);
+    }
+
+    long long iterations() const;
+    long long elapsed() const;
+    double nanosecondsPerIteration() const;
+
+private:
+    bool check();
+    static void escape(const void* value);
+
+    std::string mName;
+    long long mMinimumTime;
+    long long mStart;
+    long long mElapsed;
+    long long mIterations;
+    long long mNextCheck;
+};
+
+}
+
+#endif // _CORE_PLATFORM_BENCHMARK_H__
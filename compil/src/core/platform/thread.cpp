@@ -0,0 +1,160 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "core/platform/thread.h"
+
+#if defined(_WIN32)
+#  include <process.h>
+#else
+#  include <unistd.h>
+#endif
+
+namespace plt
+{
+
+int getHardwareConcurrency()
+{
+#if defined(_WIN32)
+
+    SYSTEM_INFO info;
+    ::GetSystemInfo(&info);
+    long count = info.dwNumberOfProcessors;
+
+#else
+
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+#endif
+
+    return count > 0 ? (int)count : 1;
+}
+
+#if defined(_WIN32)
+
+Mutex::Mutex()
+{
+    ::InitializeCriticalSection(&mHandle);
+}
+
+Mutex::~Mutex()
+{
+    ::DeleteCriticalSection(&mHandle);
+}
+
+void Mutex::lock()
+{
+    ::EnterCriticalSection(&mHandle);
+}
+
+void Mutex::unlock()
+{
+    ::LeaveCriticalSection(&mHandle);
+}
+
+#else
+
+Mutex::Mutex()
+{
+    pthread_mutex_init(&mHandle, 0);
+}
+
+Mutex::~Mutex()
+{
+    pthread_mutex_destroy(&mHandle);
+}
+
+void Mutex::lock()
+{
+    pthread_mutex_lock(&mHandle);
+}
+
+void Mutex::unlock()
+{
+    pthread_mutex_unlock(&mHandle);
+}
+
+#endif
+
+Lock::Lock(Mutex& mutex)
+    : mMutex(mutex)
+{
+    mMutex.lock();
+}
+
+Lock::~Lock()
+{
+    mMutex.unlock();
+}
+
+Thread::Thread(Routine routine, void* argument)
+    : mJoined(false)
+    , mRoutine(routine)
+    , mArgument(argument)
+{
+#if defined(_WIN32)
+    mHandle = (HANDLE)_beginthreadex(0, 0, &Thread::run, this, 0, 0);
+#else
+    pthread_create(&mHandle, 0, &Thread::run, this);
+#endif
+}
+
+Thread::~Thread()
+{
+    join();
+}
+
+void Thread::join()
+{
+    if (mJoined)
+        return;
+    mJoined = true;
+
+#if defined(_WIN32)
+    ::WaitForSingleObject(mHandle, INFINITE);
+    ::CloseHandle(mHandle);
+#else
+    pthread_join(mHandle, 0);
+#endif
+}
+
+#if defined(_WIN32)
+unsigned __stdcall Thread::run(void* thread)
+#else
+void* Thread::run(void* thread)
+#endif
+{
+    Thread* self = static_cast<Thread*>(thread);
+    self->mRoutine(self->mArgument);
+    return 0;
+}
+
+}
@@ -0,0 +1,112 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#ifndef _CORE_PLATFORM_THREAD_H__
+#define _CORE_PLATFORM_THREAD_H__
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <pthread.h>
+#endif
+
+namespace plt
+{
+
+// Returns the number of the hardware threads, at least 1
+int getHardwareConcurrency();
+
+class Mutex
+{
+public:
+    Mutex();
+    ~Mutex();
+
+    void lock();
+    void unlock();
+
+private:
+    Mutex(const Mutex&);
+    Mutex& operator=(const Mutex&);
+
+#if defined(_WIN32)
+    CRITICAL_SECTION mHandle;
+#else
+    pthread_mutex_t mHandle;
+#endif
+};
+
+// Holds the mutex locked for its life time
+class Lock
+{
+public:
+    explicit Lock(Mutex& mutex);
+    ~Lock();
+
+private:
+    Lock(const Lock&);
+    Lock& operator=(const Lock&);
+
+    Mutex& mMutex;
+};
+
+// Runs the routine with the argument on a new thread. The thread is
+// joined by the destructor
+class Thread
+{
+public:
+    typedef void (*Routine)(void*);
+
+    Thread(Routine routine, void* argument);
+    ~Thread();
+
+    void join();
+
+private:
+    Thread(const Thread&);
+    Thread& operator=(const Thread&);
+
+#if defined(_WIN32)
+    static unsigned __stdcall run(void* thread);
+    HANDLE mHandle;
+#else
+    static void* run(void* thread);
+    pthread_t mHandle;
+#endif
+    bool mJoined;
+    Routine mRoutine;
+    void* mArgument;
+};
+
+}
+
+#endif // _CORE_PLATFORM_THREAD_H__
@@ -0,0 +1,126 @@
+#include "interface/async.h"
+// Compil C++ Template Library
+#include "core/compil/async_queue.h"
+
+namespace async
+{
+
+Counter::~Counter()
+{
+}
+
+namespace
+{
+
+class CounterAddStub : public async_call
+{
+public:
+    CounterAddStub(const CounterSPtr& target, long value)
+            : mTarget(target)
+            , mValue (value)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->add(mValue);
+    }
+
+private:
+    CounterSPtr mTarget;
+    long        mValue;
+};
+
+class CounterAddTwiceStub : public async_call
+{
+public:
+    CounterAddTwiceStub(const CounterSPtr& target, long value1, long value2)
+            : mTarget(target)
+            , mValue1(value1)
+            , mValue2(value2)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->addTwice(mValue1, mValue2);
+    }
+
+private:
+    CounterSPtr mTarget;
+    long        mValue1;
+    long        mValue2;
+};
+
+class CounterTotalStub : public async_call
+{
+public:
+    CounterTotalStub(const CounterSPtr& target, long* sum)
+            : mTarget(target)
+            , mSum   (sum)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->total(*mSum);
+    }
+
+private:
+    CounterSPtr mTarget;
+    long*       mSum;
+};
+
+class CounterScaleStub : public async_call
+{
+public:
+    CounterScaleStub(const CounterSPtr& target, long factor, long* value)
+            : mTarget(target)
+            , mFactor(factor)
+            , mValue (value)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->scale(mFactor, *mValue);
+    }
+
+private:
+    CounterSPtr mTarget;
+    long        mFactor;
+    long*       mValue;
+};
+
+}
+
+CounterProxy::CounterProxy(const CounterSPtr& target, async_queue& queue)
+        : mTarget(target)
+        , mQueue (queue)
+{
+}
+
+void CounterProxy::add(long value)
+{
+    mQueue.post(new CounterAddStub(mTarget, value));
+}
+
+void CounterProxy::addTwice(long value1, long value2)
+{
+    mQueue.post(new CounterAddTwiceStub(mTarget, value1, value2));
+}
+
+void CounterProxy::total(long& sum)
+{
+    CounterTotalStub stub(mTarget, &sum);
+    mQueue.send(&stub);
+}
+
+void CounterProxy::scale(long factor, long& value)
+{
+    CounterScaleStub stub(mTarget, factor, &value);
+    mQueue.send(&stub);
+}
+
+}
+
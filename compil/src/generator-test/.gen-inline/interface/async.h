@@ -0,0 +1,76 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __INTERFACE_ASYNC_COMPIL_H_
+#define __INTERFACE_ASYNC_COMPIL_H_
+
+#include "interface/async.h"
+// Compil C++ Template Library
+#include "core/compil/async_queue.h"
+
+namespace async
+{
+
+// Accumulates the values added on the worker thread of the queue
+class Counter
+{
+public:
+    // Destructor
+    virtual      ~Counter();
+
+    virtual void add     (long value) = 0;
+
+    virtual void addTwice(long value1, long value2) = 0;
+
+    // Returns the sum of the values added so far
+    virtual void total   (long& sum) = 0;
+
+    virtual void scale   (long factor, long& value) = 0;
+};
+
+// Proxy of the Counter interface. The calls are marshalled into the queue
+// and dispatched on its worker thread in the order they are made. The
+// methods with out or io parameters wait for the dispatch, the rest return
+// as soon as the call is queued.
+class CounterProxy : public Counter
+{
+public:
+    // Constructor. The calls are dispatched to the target on the worker of
+    // the queue
+                 CounterProxy(const CounterSPtr& target, async_queue& queue);
+
+    virtual void add         (long value);
+
+    virtual void addTwice    (long value1, long value2);
+
+    virtual void total       (long& sum);
+
+    virtual void scale       (long factor, long& value);
+private:
+    CounterSPtr  mTarget;
+    async_queue& mQueue;
+};
+
+}
+
+#else // __INTERFACE_ASYNC_COMPIL_H_
+
+namespace async
+{
+
+// Forward declarations
+class Counter;
+typedef Counter*                   CounterRPtr;
+typedef boost::shared_ptr<Counter> CounterSPtr;
+typedef boost::weak_ptr<Counter>   CounterWPtr;
+
+class CounterProxy;
+typedef CounterProxy*                   CounterProxyRPtr;
+typedef boost::shared_ptr<CounterProxy> CounterProxySPtr;
+typedef boost::weak_ptr<CounterProxy>   CounterProxyWPtr;
+
+}
+
+#endif // __INTERFACE_ASYNC_COMPIL_H_
+
@@ -0,0 +1,156 @@
+#include "interface/shm.h"
+// Compil C++ Template Library
+#include "core/compil/async_queue.h"
+
+namespace shm
+{
+
+Journal::~Journal()
+{
+}
+
+namespace
+{
+
+class JournalRecordStub : public async_call
+{
+public:
+    JournalRecordStub(const JournalSPtr& target, const std::string& text, const std::vector<long>& values)
+            : mTarget(target)
+            , mText  (text)
+            , mValues(values)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->record(mText, mValues);
+    }
+
+private:
+    JournalSPtr       mTarget;
+    std::string       mText;
+    std::vector<long> mValues;
+};
+
+class JournalEchoStub : public async_call
+{
+public:
+    JournalEchoStub(const JournalSPtr& target, const std::string& text, std::string* copy)
+            : mTarget(target)
+            , mText  (text)
+            , mCopy  (copy)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->echo(mText, *mCopy);
+    }
+
+private:
+    JournalSPtr  mTarget;
+    std::string  mText;
+    std::string* mCopy;
+};
+
+class JournalSummaryStub : public async_call
+{
+public:
+    JournalSummaryStub(const JournalSPtr& target, long* count, long* sum)
+            : mTarget(target)
+            , mCount (count)
+            , mSum   (sum)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->summary(*mCount, *mSum);
+    }
+
+private:
+    JournalSPtr mTarget;
+    long*       mCount;
+    long*       mSum;
+};
+
+class JournalReverseStub : public async_call
+{
+public:
+    JournalReverseStub(const JournalSPtr& target, std::vector<long>* values)
+            : mTarget(target)
+            , mValues(values)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->reverse(*mValues);
+    }
+
+private:
+    JournalSPtr        mTarget;
+    std::vector<long>* mValues;
+};
+
+class JournalPingStub : public async_call
+{
+public:
+    JournalPingStub(const JournalSPtr& target, long sequence, long* reply)
+            : mTarget  (target)
+            , mSequence(sequence)
+            , mReply   (reply)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->ping(mSequence, *mReply);
+    }
+
+private:
+    JournalSPtr mTarget;
+    long        mSequence;
+    long*       mReply;
+};
+
+}
+
+JournalProxy::JournalProxy(const JournalSPtr& target, async_queue& queue)
+        : mTarget(target)
+        , mQueue (queue)
+{
+}
+
+void JournalProxy::record(const std::string& text, const std::vector<long>& values)
+{
+    mQueue.post(new JournalRecordStub(mTarget, text, values));
+}
+
+void JournalProxy::echo(const std::string& text, std::string& copy)
+{
+    JournalEchoStub stub(mTarget, text, &copy);
+    mQueue.send(&stub);
+}
+
+void JournalProxy::summary(long& count, long& sum)
+{
+    JournalSummaryStub stub(mTarget, &count, &sum);
+    mQueue.send(&stub);
+}
+
+void JournalProxy::reverse(std::vector<long>& values)
+{
+    JournalReverseStub stub(mTarget, &values);
+    mQueue.send(&stub);
+}
+
+void JournalProxy::ping(long sequence, long& reply)
+{
+    JournalPingStub stub(mTarget, sequence, &reply);
+    mQueue.send(&stub);
+}
+
+}
+
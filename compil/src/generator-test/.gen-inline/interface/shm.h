@@ -0,0 +1,83 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __INTERFACE_SHM_COMPIL_H_
+#define __INTERFACE_SHM_COMPIL_H_
+
+#include "interface/shm.h"
+// Compil C++ Template Library
+#include "core/compil/async_queue.h"
+
+namespace shm
+{
+
+// Keeps the records written by a client in another process
+class Journal
+{
+public:
+    // Destructor
+    virtual      ~Journal();
+
+    virtual void record  (const std::string& text, const std::vector<long>& values) = 0;
+
+    virtual void echo    (const std::string& text, std::string& copy) = 0;
+
+    // Returns the count of the records and the sum of their values
+    virtual void summary (long& count, long& sum) = 0;
+
+    virtual void reverse (std::vector<long>& values) = 0;
+
+    virtual void ping    (long sequence, long& reply) = 0;
+};
+
+// Proxy of the Journal interface. The calls are marshalled into the queue
+// and dispatched on its worker thread in the order they are made. The
+// methods with out or io parameters wait for the dispatch, the rest return
+// as soon as the call is queued.
+class JournalProxy : public Journal
+{
+public:
+    // Constructor. The calls are dispatched to the target on the worker of
+    // the queue
+                 JournalProxy(const JournalSPtr& target, async_queue& queue);
+
+    virtual void record      (const std::string& text, const std::vector<long>& values);
+
+    virtual void echo        (const std::string& text, std::string& copy);
+
+    virtual void summary     (long& count, long& sum);
+
+    virtual void reverse     (std::vector<long>& values);
+
+    virtual void ping        (long sequence, long& reply);
+private:
+    JournalSPtr  mTarget;
+    async_queue& mQueue;
+};
+
+}
+
+#else // __INTERFACE_SHM_COMPIL_H_
+
+namespace shm
+{
+
+// Forward declarations
+class Journal;
+typedef Journal*                   JournalRPtr;
+typedef boost::shared_ptr<Journal> JournalSPtr;
+typedef boost::weak_ptr<Journal>   JournalWPtr;
+
+class JournalProxy;
+typedef JournalProxy*                   JournalProxyRPtr;
+typedef boost::shared_ptr<JournalProxy> JournalProxySPtr;
+typedef boost::weak_ptr<JournalProxy>   JournalProxyWPtr;
+
+}
+
+#endif // __INTERFACE_SHM_COMPIL_H_
+
@@ -0,0 +1,72 @@
+#include "specimen/specimens.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace specimen
+{
+
+TEST(SpecimenIntegerSpecimenTest, operatorEqualTo)
+{
+    specimen::IntegerSpecimen specimen1;
+    specimen::IntegerSpecimen specimen2;
+    ASSERT_TRUE(specimen1 == specimen2);
+}
+
+TEST(SpecimenIntegerSpecimenTest, operatorNotEqualTo)
+{
+    specimen::IntegerSpecimen specimen1;
+    specimen::IntegerSpecimen specimen2;
+    ASSERT_FALSE(specimen1 != specimen2);
+}
+
+
+TEST(SpecimenStringSpecimenTest, operatorEqualTo)
+{
+    specimen::StringSpecimen specimen1;
+    specimen::StringSpecimen specimen2;
+    ASSERT_TRUE(specimen1 == specimen2);
+}
+
+TEST(SpecimenStringSpecimenTest, operatorNotEqualTo)
+{
+    specimen::StringSpecimen specimen1;
+    specimen::StringSpecimen specimen2;
+    ASSERT_FALSE(specimen1 != specimen2);
+}
+
+
+TEST(SpecimenSpecimenFromSpecimenTest, operatorEqualTo)
+{
+    specimen::SpecimenFromSpecimen specimen1;
+    specimen::SpecimenFromSpecimen specimen2;
+    ASSERT_TRUE(specimen1 == specimen2);
+}
+
+TEST(SpecimenSpecimenFromSpecimenTest, operatorNotEqualTo)
+{
+    specimen::SpecimenFromSpecimen specimen1;
+    specimen::SpecimenFromSpecimen specimen2;
+    ASSERT_FALSE(specimen1 != specimen2);
+}
+
+
+TEST(SpecimenStringSpecimen2Test, operatorEqualTo)
+{
+    specimen::StringSpecimen2 specimen1;
+    specimen::StringSpecimen2 specimen2;
+    ASSERT_TRUE(specimen1 == specimen2);
+}
+
+TEST(SpecimenStringSpecimen2Test, operatorNotEqualTo)
+{
+    specimen::StringSpecimen2 specimen1;
+    specimen::StringSpecimen2 specimen2;
+    ASSERT_FALSE(specimen1 != specimen2);
+}
+
+
+
+}
+
@@ -0,0 +1,77 @@
+#include "specimen/specimens.h"
+
+namespace specimen
+{
+
+IntegerSpecimen::IntegerSpecimen()
+        : mValue()
+{
+}
+
+IntegerSpecimen::IntegerSpecimen(long value)
+        : mValue(value)
+{
+}
+
+StringSpecimen::StringSpecimen()
+        : mValue()
+{
+}
+
+StringSpecimen::StringSpecimen(const std::string& value)
+        : mValue(value)
+{
+}
+
+SpecimenFromSpecimen::SpecimenFromSpecimen()
+        : mValue()
+{
+}
+
+SpecimenFromSpecimen::SpecimenFromSpecimen(const StringSpecimen& value)
+        : mValue(value)
+{
+}
+
+StringSpecimen2::StringSpecimen2()
+        : StringSpecimen()
+{
+}
+
+StringSpecimen2::StringSpecimen2(const std::string& value)
+        : StringSpecimen(value)
+{
+}
+
+SpecimenDefaultValue::SpecimenDefaultValue()
+        : mI(default_i())
+        , mS(default_s())
+{
+}
+
+SpecimenDefaultValue::~SpecimenDefaultValue()
+{
+}
+
+IntegerSpecimen SpecimenDefaultValue::default_i()
+{
+    return IntegerSpecimen(1);
+}
+
+IntegerSpecimen& SpecimenDefaultValue::mutable_i()
+{
+    return mI;
+}
+
+StringSpecimen SpecimenDefaultValue::default_s()
+{
+    return StringSpecimen("specimen");
+}
+
+StringSpecimen& SpecimenDefaultValue::mutable_s()
+{
+    return mS;
+}
+
+}
+
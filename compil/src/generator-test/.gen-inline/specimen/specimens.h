@@ -0,0 +1,400 @@
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+
+#ifndef __SPECIMEN_SPECIMENS_COMPIL_H_
+#define __SPECIMEN_SPECIMENS_COMPIL_H_
+
+#include "specimen/specimens.h"
+
+namespace specimen
+{
+
+#if 0
+class IntegerSpecimen
+{
+public:
+    IntegerSpecimen();
+    explicit IntegerSpecimen(const long value);
+    ~IntegerSpecimen();
+    inline long value() const;
+    inline bool operator==(const specimen::IntegerSpecimen& specimen) const;
+    inline bool operator!=(const specimen::IntegerSpecimen& specimen) const;
+    inline bool operator<(const specimen::IntegerSpecimen& specimen) const;
+private:
+    long value;
+};
+
+inline long value() const
+{
+    return value;
+}
+
+
+inline bool operator==(const specimen::IntegerSpecimen& specimen) const
+inline bool operator!=(const specimen::IntegerSpecimen& specimen) const
+inline bool operator<(const specimen::IntegerSpecimen& specimen) const
+
+#endif
+
+class IntegerSpecimen
+{
+public:
+                             IntegerSpecimen();
+    explicit                 IntegerSpecimen(long value);
+
+    inline   long            value          ()                              const;
+    inline   bool            operator==     (const IntegerSpecimen& rValue) const;
+    inline   bool            operator!=     (const IntegerSpecimen& rValue) const;
+    inline   bool            operator<      (const IntegerSpecimen& rValue) const;
+    inline   IntegerSpecimen operator+      (const IntegerSpecimen& rValue) const;
+    inline   IntegerSpecimen operator-      (const IntegerSpecimen& rValue) const;
+private:
+    long mValue;
+};
+
+#if 0
+class StringSpecimen
+{
+public:
+    StringSpecimen();
+    explicit StringSpecimen(std::string value);
+    ~StringSpecimen();
+    inline std::string value() const;
+    inline bool operator==(const specimen::StringSpecimen& specimen) const;
+    inline bool operator!=(const specimen::StringSpecimen& specimen) const;
+    inline bool operator<(const specimen::StringSpecimen& specimen) const;
+private:
+    std::string value;
+};
+
+inline std::string value() const
+{
+    return value;
+}
+
+
+inline bool operator==(const specimen::StringSpecimen& specimen) const
+inline bool operator!=(const specimen::StringSpecimen& specimen) const
+inline bool operator<(const specimen::StringSpecimen& specimen) const
+
+#endif
+
+class StringSpecimen
+{
+public:
+                         StringSpecimen();
+    explicit             StringSpecimen(const std::string& value);
+
+    inline   std::string value         ()                             const;
+    inline   bool        operator==    (const StringSpecimen& rValue) const;
+    inline   bool        operator!=    (const StringSpecimen& rValue) const;
+    inline   bool        operator<     (const StringSpecimen& rValue) const;
+private:
+    std::string mValue;
+};
+
+#if 0
+class SpecimenFromSpecimen
+{
+public:
+    SpecimenFromSpecimen();
+    explicit SpecimenFromSpecimen(const specimen::StringSpecimen& value);
+    ~SpecimenFromSpecimen();
+    inline specimen::StringSpecimen value() const;
+    inline bool operator==(const specimen::SpecimenFromSpecimen& specimen) const;
+    inline bool operator!=(const specimen::SpecimenFromSpecimen& specimen) const;
+    inline bool operator<(const specimen::SpecimenFromSpecimen& specimen) const;
+private:
+    specimen::StringSpecimen value;
+};
+
+inline specimen::StringSpecimen value() const
+{
+    return value;
+}
+
+
+inline bool operator==(const specimen::SpecimenFromSpecimen& specimen) const
+inline bool operator!=(const specimen::SpecimenFromSpecimen& specimen) const
+inline bool operator<(const specimen::SpecimenFromSpecimen& specimen) const
+
+#endif
+
+class SpecimenFromSpecimen
+{
+public:
+                            SpecimenFromSpecimen();
+    explicit                SpecimenFromSpecimen(const StringSpecimen& value);
+
+    inline   StringSpecimen value               ()                                   const;
+    inline   bool           operator==          (const SpecimenFromSpecimen& rValue) const;
+    inline   bool           operator!=          (const SpecimenFromSpecimen& rValue) const;
+    inline   bool           operator<           (const SpecimenFromSpecimen& rValue) const;
+private:
+    StringSpecimen mValue;
+};
+
+#if 0
+class StringSpecimen2
+{
+public:
+    StringSpecimen2();
+    explicit StringSpecimen2(std::string value);
+    ~StringSpecimen2();
+    inline std::string value() const;
+    inline bool operator==(const specimen::StringSpecimen2& specimen) const;
+    inline bool operator!=(const specimen::StringSpecimen2& specimen) const;
+    inline bool operator<(const specimen::StringSpecimen2& specimen) const;
+private:
+    std::string value;
+};
+
+inline std::string value() const
+{
+    return value;
+}
+
+
+inline bool operator==(const specimen::StringSpecimen2& specimen) const
+inline bool operator!=(const specimen::StringSpecimen2& specimen) const
+inline bool operator<(const specimen::StringSpecimen2& specimen) const
+
+#endif
+
+class StringSpecimen2 : public StringSpecimen
+{
+public:
+                  StringSpecimen2();
+    explicit      StringSpecimen2(const std::string& value);
+
+    inline   bool operator==     (const StringSpecimen2& rValue) const;
+    inline   bool operator!=     (const StringSpecimen2& rValue) const;
+    inline   bool operator<      (const StringSpecimen2& rValue) const;
+};
+
+class SpecimenDefaultValue
+{
+public:
+    // Default constructor
+                                   SpecimenDefaultValue ();
+    // Destructor
+    /*lax*/                        ~SpecimenDefaultValue();
+
+    // Getter method for the data field i
+            const IntegerSpecimen& i                    ()                         const;
+    // Returns the default value 1 of the field i
+    static  IntegerSpecimen        default_i            ();
+    // Setter method for the data field i
+            SpecimenDefaultValue&  set_i                (const IntegerSpecimen& i);
+    // Provides mutable access to field i
+            IntegerSpecimen&       mutable_i            ();
+
+    // Getter method for the data field s
+            const StringSpecimen&  s                    ()                         const;
+    // Returns the default value "specimen" of the field s
+    static  StringSpecimen         default_s            ();
+    // Setter method for the data field s
+            SpecimenDefaultValue&  set_s                (const StringSpecimen& s);
+    // Provides mutable access to field s
+            StringSpecimen&        mutable_s            ();
+
+private:
+    // variable for the data field i
+    IntegerSpecimen mI;
+    // variable for the data field s
+    StringSpecimen  mS;
+};
+
+inline IntegerSpecimenSPtr integerSpecimenRef()
+{
+    return boost::make_shared<IntegerSpecimen>();
+}
+
+inline IntegerSpecimenSPtr integerSpecimenRef(long value)
+{
+    return boost::make_shared<IntegerSpecimen>(value);
+}
+
+inline long IntegerSpecimen::value() const
+{
+    return mValue;
+}
+
+inline bool IntegerSpecimen::operator==(const IntegerSpecimen& rValue) const
+{
+    return value() == rValue.value();
+}
+
+inline bool IntegerSpecimen::operator!=(const IntegerSpecimen& rValue) const
+{
+    return value() != rValue.value();
+}
+
+inline bool IntegerSpecimen::operator<(const IntegerSpecimen& rValue) const
+{
+    return value() < rValue.value();
+}
+
+inline IntegerSpecimen IntegerSpecimen::operator+(const IntegerSpecimen& rValue) const
+{
+    return IntegerSpecimen(value() + rValue.value());
+}
+
+inline IntegerSpecimen IntegerSpecimen::operator-(const IntegerSpecimen& rValue) const
+{
+    return IntegerSpecimen(value() - rValue.value());
+}
+
+inline StringSpecimenSPtr stringSpecimenRef()
+{
+    return boost::make_shared<StringSpecimen>();
+}
+
+inline StringSpecimenSPtr stringSpecimenRef(const std::string& value)
+{
+    return boost::make_shared<StringSpecimen>(value);
+}
+
+inline std::string StringSpecimen::value() const
+{
+    return mValue;
+}
+
+inline bool StringSpecimen::operator==(const StringSpecimen& rValue) const
+{
+    return value() == rValue.value();
+}
+
+inline bool StringSpecimen::operator!=(const StringSpecimen& rValue) const
+{
+    return value() != rValue.value();
+}
+
+inline bool StringSpecimen::operator<(const StringSpecimen& rValue) const
+{
+    return value() < rValue.value();
+}
+
+inline SpecimenFromSpecimenSPtr specimenFromSpecimenRef()
+{
+    return boost::make_shared<SpecimenFromSpecimen>();
+}
+
+inline SpecimenFromSpecimenSPtr specimenFromSpecimenRef(const StringSpecimen& value)
+{
+    return boost::make_shared<SpecimenFromSpecimen>(value);
+}
+
+inline StringSpecimen SpecimenFromSpecimen::value() const
+{
+    return mValue;
+}
+
+inline bool SpecimenFromSpecimen::operator==(const SpecimenFromSpecimen& rValue) const
+{
+    return value() == rValue.value();
+}
+
+inline bool SpecimenFromSpecimen::operator!=(const SpecimenFromSpecimen& rValue) const
+{
+    return value() != rValue.value();
+}
+
+inline bool SpecimenFromSpecimen::operator<(const SpecimenFromSpecimen& rValue) const
+{
+    return value() < rValue.value();
+}
+
+inline StringSpecimen2SPtr stringSpecimen2Ref()
+{
+    return boost::make_shared<StringSpecimen2>();
+}
+
+inline StringSpecimen2SPtr stringSpecimen2Ref(const std::string& value)
+{
+    return boost::make_shared<StringSpecimen2>(value);
+}
+
+inline bool StringSpecimen2::operator==(const StringSpecimen2& rValue) const
+{
+    return value() == rValue.value();
+}
+
+inline bool StringSpecimen2::operator!=(const StringSpecimen2& rValue) const
+{
+    return value() != rValue.value();
+}
+
+inline bool StringSpecimen2::operator<(const StringSpecimen2& rValue) const
+{
+    return value() < rValue.value();
+}
+
+inline const IntegerSpecimen& SpecimenDefaultValue::i() const
+{
+    return mI;
+}
+
+inline SpecimenDefaultValue& SpecimenDefaultValue::set_i(const IntegerSpecimen& i)
+{
+    mI = i;
+    return *this;
+}
+
+inline const StringSpecimen& SpecimenDefaultValue::s() const
+{
+    return mS;
+}
+
+inline SpecimenDefaultValue& SpecimenDefaultValue::set_s(const StringSpecimen& s)
+{
+    mS = s;
+    return *this;
+}
+
+}
+
+#else // __SPECIMEN_SPECIMENS_COMPIL_H_
+
+namespace specimen
+{
+
+// Forward declarations
+class IntegerSpecimen;
+typedef IntegerSpecimen*                         IntegerSpecimenRPtr;
+typedef boost::shared_ptr<IntegerSpecimen>       IntegerSpecimenSPtr;
+typedef boost::shared_ptr<const IntegerSpecimen> IntegerSpecimenSCPtr;
+typedef boost::weak_ptr<IntegerSpecimen>         IntegerSpecimenWPtr;
+
+class StringSpecimen;
+typedef StringSpecimen*                         StringSpecimenRPtr;
+typedef boost::shared_ptr<StringSpecimen>       StringSpecimenSPtr;
+typedef boost::shared_ptr<const StringSpecimen> StringSpecimenSCPtr;
+typedef boost::weak_ptr<StringSpecimen>         StringSpecimenWPtr;
+
+class SpecimenFromSpecimen;
+typedef SpecimenFromSpecimen*                         SpecimenFromSpecimenRPtr;
+typedef boost::shared_ptr<SpecimenFromSpecimen>       SpecimenFromSpecimenSPtr;
+typedef boost::shared_ptr<const SpecimenFromSpecimen> SpecimenFromSpecimenSCPtr;
+typedef boost::weak_ptr<SpecimenFromSpecimen>         SpecimenFromSpecimenWPtr;
+
+class StringSpecimen2;
+typedef StringSpecimen2*                         StringSpecimen2RPtr;
+typedef boost::shared_ptr<StringSpecimen2>       StringSpecimen2SPtr;
+typedef boost::shared_ptr<const StringSpecimen2> StringSpecimen2SCPtr;
+typedef boost::weak_ptr<StringSpecimen2>         StringSpecimen2WPtr;
+
+class SpecimenDefaultValue;
+typedef SpecimenDefaultValue*                         SpecimenDefaultValueRPtr;
+typedef boost::shared_ptr<SpecimenDefaultValue>       SpecimenDefaultValueSPtr;
+typedef boost::shared_ptr<const SpecimenDefaultValue> SpecimenDefaultValueSCPtr;
+typedef boost::weak_ptr<SpecimenDefaultValue>         SpecimenDefaultValueWPtr;
+
+}
+
+#endif // __SPECIMEN_SPECIMENS_COMPIL_H_
+
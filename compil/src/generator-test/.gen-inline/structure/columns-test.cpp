@@ -0,0 +1,56 @@
+#include "structure/columns.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace columns
+{
+
+TEST(StructureTradeTest, available_DefaultValues)
+{
+    Trade structure1;
+    ASSERT_FALSE(structure1.valid_id());
+    ASSERT_FALSE(structure1.changed_quantity());
+    ASSERT_FALSE(structure1.changed_settled());
+    ASSERT_FALSE(structure1.valid_side());
+    ASSERT_FALSE(structure1.exist_venue());
+    ASSERT_FALSE(structure1.exist_fills());
+}
+
+TEST(StructureTradeTest, isInitialized)
+{
+    Trade structure1;
+    ASSERT_FALSE(structure1.isInitialized());
+    structure1.set_id(long());
+    structure1.set_side(ESide());
+    ASSERT_TRUE(structure1.isInitialized());
+}
+
+
+TEST(StructureBlockTradeTest, available_DefaultValues)
+{
+    BlockTrade structure1;
+    ASSERT_FALSE(structure1.valid_id());
+    ASSERT_FALSE(structure1.changed_quantity());
+    ASSERT_FALSE(structure1.changed_settled());
+    ASSERT_FALSE(structure1.valid_side());
+    ASSERT_FALSE(structure1.exist_venue());
+    ASSERT_FALSE(structure1.exist_fills());
+    ASSERT_FALSE(structure1.valid_legs());
+}
+
+TEST(StructureBlockTradeTest, isInitialized)
+{
+    BlockTrade structure1;
+    ASSERT_FALSE(structure1.isInitialized());
+    structure1.set_id(long());
+    structure1.set_side(ESide());
+    structure1.set_legs(long());
+    ASSERT_TRUE(structure1.isInitialized());
+}
+
+
+
+}
+
@@ -0,0 +1,295 @@
+#include "structure/columns.h"
+// Standard C Library
+#include <stddef.h>
+#include <string.h>
+
+namespace columns
+{
+
+ESide::ESide()
+        : mValue(kInvalid)
+{
+}
+
+ESide::ESide(long value)
+        : mValue(value)
+{
+}
+
+const ESide ESide::invalid()
+{
+    return ESide(kInvalid);
+}
+
+const ESide ESide::buy()
+{
+    return ESide(kBuy);
+}
+
+const ESide ESide::sell()
+{
+    return ESide(kSell);
+}
+
+long ESide::value() const
+{
+    return mValue;
+}
+
+const char* ESide::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "buy",
+        "sell",
+    };
+    return names[(size_t)value];
+}
+
+const char* ESide::shortName() const
+{
+    return shortName(value());
+}
+
+ESide ESide::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        1, 0,
+    };
+    static const char* names[] =
+    {
+        "sell",
+        "buy",
+        "invalid",
+    };
+    static const size_t lengths[] =
+    {
+        4, 3, 7,
+    };
+    static const long values[] =
+    {
+        kSell,
+        kBuy,
+        kInvalid,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return ESide();
+    return ESide(values[slot]);
+}
+
+bool ESide::operator==(const ESide& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool ESide::operator!=(const ESide& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+Trade::Trade()
+        : mBits    (0)
+        , mQuantity(default_quantity())
+        , mSettled (default_settled())
+{
+}
+
+Trade::~Trade()
+{
+}
+
+void Trade::erase_id()
+{
+    mId    =  0;
+    mBits &= ~bitmask_id();
+}
+
+long Trade::default_quantity()
+{
+    return 1;
+}
+
+Trade& Trade::update_quantity(long quantity)
+{
+    if (default_quantity() != quantity)
+        return set_quantity(quantity);
+
+    reset_quantity();
+    return *this;
+}
+
+void Trade::reset_quantity()
+{
+    mQuantity  =  default_quantity();
+    mBits     &= ~bitmask_quantity();
+}
+
+bool Trade::default_settled()
+{
+    return false;
+}
+
+Trade& Trade::update_settled(bool settled)
+{
+    if (default_settled() != settled)
+        return set_settled(settled);
+
+    reset_settled();
+    return *this;
+}
+
+void Trade::reset_settled()
+{
+    mSettled  =  default_settled();
+    mBits    &= ~bitmask_settled();
+}
+
+ESide& Trade::mutable_side()
+{
+    mBits |= bitmask_side();
+    return mSide;
+}
+
+void Trade::erase_side()
+{
+    mSide  =  ESide::invalid();
+    mBits &= ~bitmask_side     ();
+}
+
+std::string& Trade::mutable_venue()
+{
+    mBits |= bitmask_venue();
+    return mVenue;
+}
+
+void Trade::clear_venue()
+{
+    mVenue.clear();
+    mBits &= ~bitmask_venue();
+}
+
+std::vector<long>& Trade::mutable_fills()
+{
+    mBits |= bitmask_fills();
+    return mFills;
+}
+
+void Trade::clear_fills()
+{
+    mFills.clear();
+    mBits &= ~bitmask_fills();
+}
+
+BlockTrade::BlockTrade()
+        : mBits(0)
+{
+}
+
+BlockTrade::~BlockTrade()
+{
+}
+
+BlockTradeSPtr BlockTrade::downcast(const TradeSPtr& object)
+{
+    return boost::static_pointer_cast<BlockTrade>(object);
+}
+
+void BlockTrade::erase_legs()
+{
+    mLegs  =  0;
+    mBits &= ~bitmask_legs();
+}
+
+BlockTrade& BlockTrade::set_id(long id)
+{
+    Trade::set_id(id);
+    return *this;
+}
+
+BlockTrade& BlockTrade::set_quantity(long quantity)
+{
+    Trade::set_quantity(quantity);
+    return *this;
+}
+
+BlockTrade& BlockTrade::set_settled(bool settled)
+{
+    Trade::set_settled(settled);
+    return *this;
+}
+
+BlockTrade& BlockTrade::set_side(const ESide& side)
+{
+    Trade::set_side(side);
+    return *this;
+}
+
+BlockTrade& BlockTrade::set_venue(const std::string& venue)
+{
+    Trade::set_venue(venue);
+    return *this;
+}
+
+BlockTrade& BlockTrade::set_fills(const std::vector<long>& fills)
+{
+    Trade::set_fills(fills);
+    return *this;
+}
+
+Quote::Builder::Builder()
+        : mpObject(new Quote())
+{
+}
+
+Quote::Builder::Builder(const Quote& object)
+        : mpObject(new Quote())
+{
+    *(Quote*)mpObject = object;
+}
+
+Quote::Builder::Builder(QuoteRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Quote::Builder::~Builder()
+{
+    delete (QuoteRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Quote& Quote::Builder::build() const
+{
+    return *(QuoteRPtr)mpObject;
+}
+
+QuoteSPtr Quote::Builder::finalize()
+{
+    QuoteRPtr objectRPtr = (QuoteRPtr)mpObject;
+    mpObject = NULL;
+    return QuoteSPtr(objectRPtr);
+}
+
+Quote::Quote()
+{
+}
+
+Quote::~Quote()
+{
+}
+
+}
+
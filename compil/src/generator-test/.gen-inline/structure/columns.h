@@ -0,0 +1,557 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __STRUCTURE_COLUMNS_COMPIL_H_
+#define __STRUCTURE_COLUMNS_COMPIL_H_
+
+#include "structure/columns.h"
+// Standard C Library
+#include <stddef.h>
+
+template<class T> class snapshot;
+
+namespace columns
+{
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class ESide
+{
+public:
+    // Default constructor - sets the value to invalid
+                         ESide     ();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit             ESide     (long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long        value     ()                              const;
+    // Returns short name for a specified enum value
+    static   const char* shortName (long value);
+    // Returns short name of the enum value
+             const char* shortName ()                              const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   ESide       fromString(const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool        operator==(const ESide& rValue)           const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool        operator!=(const ESide& rValue)           const;
+
+    // static methods for enum class objects
+    static const ESide invalid();
+    static const ESide buy    ();
+    static const ESide sell   ();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid = 0,
+        kBuy     = 1,
+        kSell    = 2,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class Trade
+{
+public:
+    // Default constructor
+                                     Trade           ();
+    // Destructor
+    /*lax*/                          ~Trade          ();
+
+    // Returns true if every required field is initialized.
+            bool                     isInitialized   ()                               const;
+
+    // Getter method for the data field id
+            long                     id              ()                               const;
+    // Returns true if the data field id was set and could be considered
+    // valid
+            bool                     valid_id        ()                               const;
+    // Setter method for the data field id
+            Trade&                   set_id          (long id);
+    // Erases the required data field id. Object can not be instantiated
+    // before the field data is set again
+            void                     erase_id        ();
+
+    // Getter method for the data field quantity
+            long                     quantity        ()                               const;
+    // Returns true if the data field value quantity was changed from its
+    // default value 1
+            bool                     changed_quantity()                               const;
+    // Returns the default value 1 of the field quantity
+    static  long                     default_quantity();
+    // Setter method for the data field quantity
+            Trade&                   set_quantity    (long quantity);
+    // Updates the data field quantity. If the new value is equal to the
+    // default it clears the field else it sets it to the new value
+            Trade&                   update_quantity (long quantity);
+    // Resets the data field quantity to its default value 1
+            void                     reset_quantity  ();
+
+    // Getter method for the data field settled
+            bool                     settled         ()                               const;
+    // Returns true if the data field value settled was changed from its
+    // default value false
+            bool                     changed_settled ()                               const;
+    // Returns the default value false of the field settled
+    static  bool                     default_settled ();
+    // Setter method for the data field settled
+            Trade&                   set_settled     (bool settled);
+    // Updates the data field settled. If the new value is equal to the
+    // default it clears the field else it sets it to the new value
+            Trade&                   update_settled  (bool settled);
+    // Resets the data field settled to its default value false
+            void                     reset_settled   ();
+
+    // Getter method for the data field side
+            const ESide&             side            ()                               const;
+    // Returns true if the data field side was set and could be considered
+    // valid
+            bool                     valid_side      ()                               const;
+    // Setter method for the data field side
+            Trade&                   set_side        (const ESide& side);
+    // Provides mutable access to field side
+            ESide&                   mutable_side    ();
+    // Erases the required data field side. Object can not be instantiated
+    // before the field data is set again
+            void                     erase_side      ();
+
+    // Getter method for the data field venue
+            const std::string&       venue           ()                               const;
+    // Checks if the optional field venue exists
+            bool                     exist_venue     ()                               const;
+    // Setter method for the data field venue
+            Trade&                   set_venue       (const std::string& venue);
+    // Provides mutable access to field venue
+            std::string&             mutable_venue   ();
+    // Clears the optional data field venue
+            void                     clear_venue     ();
+
+    // Getter method for the data field fills
+            const std::vector<long>& fills           ()                               const;
+    // Checks if the optional field fills exists
+            bool                     exist_fills     ()                               const;
+    // Setter method for the data field fills
+            Trade&                   set_fills       (const std::vector<long>& fills);
+    // Provides mutable access to field fills
+            std::vector<long>&       mutable_fills   ();
+    // Clears the optional data field fills
+            void                     clear_fills     ();
+
+private:
+    // Returns unique bitmask value for the field id
+    static int bitmask_id      ();
+    // Returns unique bitmask value for the field quantity
+    static int bitmask_quantity();
+    // Returns unique bitmask value for the field settled
+    static int bitmask_settled ();
+    // Returns unique bitmask value for the field side
+    static int bitmask_side    ();
+    // Returns unique bitmask value for the field venue
+    static int bitmask_venue   ();
+    // Returns unique bitmask value for the field fills
+    static int bitmask_fills   ();
+
+    // Stores availability information for the fields
+    int               mBits;
+
+    // variable for the data field id
+    long              mId;
+    // variable for the data field quantity
+    long              mQuantity;
+    // variable for the data field settled
+    bool              mSettled;
+    // variable for the data field side
+    ESide             mSide;
+    // variable for the data field venue
+    std::string       mVenue;
+    // variable for the data field fills
+    std::vector<long> mFills;
+};
+
+class BlockTrade : public Trade
+{
+public:
+    // Default constructor
+                           BlockTrade   ();
+    // Destructor
+    /*lax*/                ~BlockTrade  ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  BlockTradeSPtr downcast     (const TradeSPtr& object);
+
+    // Returns true if every required field is initialized.
+            bool           isInitialized()                               const;
+
+    // Getter method for the data field legs
+            long           legs         ()                               const;
+    // Returns true if the data field legs was set and could be considered
+    // valid
+            bool           valid_legs   ()                               const;
+    // Setter method for the data field legs
+            BlockTrade&    set_legs     (long legs);
+    // Erases the required data field legs. Object can not be instantiated
+    // before the field data is set again
+            void           erase_legs   ();
+
+    // Setter method for the data field id
+            BlockTrade&    set_id       (long id);
+
+    // Setter method for the data field quantity
+            BlockTrade&    set_quantity (long quantity);
+
+    // Setter method for the data field settled
+            BlockTrade&    set_settled  (bool settled);
+
+    // Setter method for the data field side
+            BlockTrade&    set_side     (const ESide& side);
+
+    // Setter method for the data field venue
+            BlockTrade&    set_venue    (const std::string& venue);
+
+    // Setter method for the data field fills
+            BlockTrade&    set_fills    (const std::vector<long>& fills);
+
+private:
+    // Returns unique bitmask value for the field legs
+    static int bitmask_legs();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field legs
+    long mLegs;
+};
+
+// Quote is an immutable class - once instantiated none of the data fields
+// can be changed. For the initial initialization and instantiation use the
+// nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Quote
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void         operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                             Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                             Builder  (const Quote& object);
+        // Destructor of Builder
+        /*lax*/              ~Builder ();
+
+        // Instantiates Quote instance with the current initialization of
+        // the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Quote& build    ()                    const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                QuoteSPtr    finalize ();
+
+
+        // Setter method for the data field bid
+                Builder&     set_bid  (long bid);
+
+        // Setter method for the data field ask
+                Builder&     set_ask  (long ask);
+
+    protected:
+        // constructor needed from potential derived classes
+                             Builder  (QuoteRPtr pObject);
+
+        QuoteRPtr mpObject;
+    };
+
+    // Default constructor
+                 Quote ();
+    // Destructor
+    /*lax*/      ~Quote();
+
+    // Getter method for the data field bid
+            long bid   () const;
+
+    // Getter method for the data field ask
+            long ask   () const;
+
+private:
+    // variable for the data field bid
+    long mBid;
+    // variable for the data field ask
+    long mAsk;
+};
+
+// Holder of the current Quote shared between threads. The readers get the
+// current object wait-free through a view, the writers publish the results
+// of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Quote> QuoteSnapshot;
+
+inline int Trade::bitmask_id()
+{
+    return 0x1;
+}
+
+inline int Trade::bitmask_quantity()
+{
+    return 0x2;
+}
+
+inline int Trade::bitmask_settled()
+{
+    return 0x4;
+}
+
+inline int Trade::bitmask_side()
+{
+    return 0x8;
+}
+
+inline int Trade::bitmask_venue()
+{
+    return 0x10;
+}
+
+inline int Trade::bitmask_fills()
+{
+    return 0x20;
+}
+
+inline bool Trade::isInitialized() const
+{
+    if (!valid_id()) return false;
+    if (!valid_side()) return false;
+    return true;
+}
+
+inline long Trade::id() const
+{
+    BOOST_ASSERT(valid_id());
+    return mId;
+}
+
+inline bool Trade::valid_id() const
+{
+    return (mBits & bitmask_id()) != 0;
+}
+
+inline Trade& Trade::set_id(long id)
+{
+    mId    = id;
+    mBits |= bitmask_id();
+    return *this;
+}
+
+inline long Trade::quantity() const
+{
+    return mQuantity;
+}
+
+inline bool Trade::changed_quantity() const
+{
+    return (mBits & bitmask_quantity()) != 0;
+}
+
+inline Trade& Trade::set_quantity(long quantity)
+{
+    mQuantity  = quantity;
+    mBits     |= bitmask_quantity();
+    return *this;
+}
+
+inline bool Trade::settled() const
+{
+    return mSettled;
+}
+
+inline bool Trade::changed_settled() const
+{
+    return (mBits & bitmask_settled()) != 0;
+}
+
+inline Trade& Trade::set_settled(bool settled)
+{
+    mSettled  = settled;
+    mBits    |= bitmask_settled();
+    return *this;
+}
+
+inline const ESide& Trade::side() const
+{
+    BOOST_ASSERT(valid_side());
+    return mSide;
+}
+
+inline bool Trade::valid_side() const
+{
+    return (mBits & bitmask_side()) != 0;
+}
+
+inline Trade& Trade::set_side(const ESide& side)
+{
+    mSide  = side;
+    mBits |= bitmask_side();
+    return *this;
+}
+
+inline const std::string& Trade::venue() const
+{
+    BOOST_ASSERT(exist_venue());
+    return mVenue;
+}
+
+inline bool Trade::exist_venue() const
+{
+    return (mBits & bitmask_venue()) != 0;
+}
+
+inline Trade& Trade::set_venue(const std::string& venue)
+{
+    mVenue  = venue;
+    mBits  |= bitmask_venue();
+    return *this;
+}
+
+inline const std::vector<long>& Trade::fills() const
+{
+    BOOST_ASSERT(exist_fills());
+    return mFills;
+}
+
+inline bool Trade::exist_fills() const
+{
+    return (mBits & bitmask_fills()) != 0;
+}
+
+inline Trade& Trade::set_fills(const std::vector<long>& fills)
+{
+    mFills  = fills;
+    mBits  |= bitmask_fills();
+    return *this;
+}
+
+inline int BlockTrade::bitmask_legs()
+{
+    return 0x1;
+}
+
+inline bool BlockTrade::isInitialized() const
+{
+    if (!Trade::isInitialized()) return false;
+    if (!valid_legs()) return false;
+    return true;
+}
+
+inline long BlockTrade::legs() const
+{
+    BOOST_ASSERT(valid_legs());
+    return mLegs;
+}
+
+inline bool BlockTrade::valid_legs() const
+{
+    return (mBits & bitmask_legs()) != 0;
+}
+
+inline BlockTrade& BlockTrade::set_legs(long legs)
+{
+    mLegs  = legs;
+    mBits |= bitmask_legs();
+    return *this;
+}
+
+inline long Quote::bid() const
+{
+    return mBid;
+}
+
+inline Quote::Builder& Quote::Builder::set_bid(long bid)
+{
+    mpObject->mBid = bid;
+    return *this;
+}
+
+inline long Quote::ask() const
+{
+    return mAsk;
+}
+
+inline Quote::Builder& Quote::Builder::set_ask(long ask)
+{
+    mpObject->mAsk = ask;
+    return *this;
+}
+
+}
+
+#else // __STRUCTURE_COLUMNS_COMPIL_H_
+
+namespace columns
+{
+
+// Forward declarations
+class ESide;
+typedef ESide*                         ESideRPtr;
+typedef boost::shared_ptr<ESide>       ESideSPtr;
+typedef boost::shared_ptr<const ESide> ESideSCPtr;
+typedef boost::weak_ptr<ESide>         ESideWPtr;
+
+class Trade;
+typedef Trade*                         TradeRPtr;
+typedef boost::shared_ptr<Trade>       TradeSPtr;
+typedef boost::shared_ptr<const Trade> TradeSCPtr;
+typedef boost::weak_ptr<Trade>         TradeWPtr;
+
+class BlockTrade;
+typedef BlockTrade*                         BlockTradeRPtr;
+typedef boost::shared_ptr<BlockTrade>       BlockTradeSPtr;
+typedef boost::shared_ptr<const BlockTrade> BlockTradeSCPtr;
+typedef boost::weak_ptr<BlockTrade>         BlockTradeWPtr;
+
+class Quote;
+typedef Quote*                         QuoteRPtr;
+typedef boost::shared_ptr<Quote>       QuoteSPtr;
+typedef boost::shared_ptr<const Quote> QuoteSCPtr;
+typedef boost::weak_ptr<Quote>         QuoteWPtr;
+
+}
+
+#endif // __STRUCTURE_COLUMNS_COMPIL_H_
+
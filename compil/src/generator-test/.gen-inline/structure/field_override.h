@@ -0,0 +1,370 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#ifndef __STRUCTURE_FIELD_OVERRIDE_COMPIL_H_
+#define __STRUCTURE_FIELD_OVERRIDE_COMPIL_H_
+
+#include "structure/field_override.h"
+
+template<class T> class snapshot;
+
+namespace override
+{
+
+// Structure1 is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Structure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void              operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                  Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                  Builder  (const Structure1& object);
+        // Destructor of Builder
+        /*lax*/                   ~Builder ();
+
+        // Instantiates Structure1 instance with the current initialization
+        // of the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Structure1& build    ()                         const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                Structure1SPtr    finalize ();
+
+
+    protected:
+        // constructor needed from potential derived classes
+                                  Builder  (Structure1RPtr pObject);
+
+        Structure1RPtr mpObject;
+    };
+
+    // Default constructor
+                 Structure1   ();
+    // Destructor
+    /*lax*/      ~Structure1  ();
+
+    // Returns true if every required field is initialized.
+    // Note: If the class is used properly it should always return true,
+    // because the object could be instantiated only if it is already
+    // initialized and can not be changed. Called by the Builder class.
+            bool isInitialized() const;
+};
+
+// Holder of the current Structure1 shared between threads. The readers get
+// the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Structure1> Structure1Snapshot;
+
+// HoldStructure1 is an immutable class - once instantiated none of the
+// data fields can be changed. For the initial initialization and
+// instantiation use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class HoldStructure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                  operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                      Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                      Builder  (const HoldStructure1& object);
+        // Destructor of Builder
+        /*lax*/                       ~Builder ();
+
+        // Instantiates HoldStructure1 instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const HoldStructure1& build    ()                             const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                HoldStructure1SPtr    finalize ();
+
+
+        // Setter method for the data field s
+                Builder&              set_s    (const Structure1SPtr& s);
+        // Erases the required data field s. Object can not be instantiated
+        // before the field data is set again
+                void                  erase_s  ();
+
+    protected:
+        // constructor needed from potential derived classes
+                                      Builder  (HoldStructure1RPtr pObject);
+
+        HoldStructure1RPtr mpObject;
+    };
+
+    // Default constructor
+                                  HoldStructure1 ();
+    // Destructor
+    /*lax*/                       ~HoldStructure1();
+
+    // Returns true if every required field is initialized.
+    // Note: If the class is used properly it should always return true,
+    // because the object could be instantiated only if it is already
+    // initialized and can not be changed. Called by the Builder class.
+            bool                  isInitialized  () const;
+
+    // Getter method for the data field s
+            const Structure1SPtr& s              () const;
+    // Returns true if the data field s was set and could be considered
+    // valid
+    // Note: If the class is used properly it should always return true. It
+    // makes sense when it is called indirectly through isInitialized()
+    // from the Builder class
+            bool                  valid_s        () const;
+
+private:
+    // Returns unique bitmask value for the field s
+    static int bitmask_s();
+
+    // Stores availability information for the fields
+    int            mBits;
+
+    // variable for the data field s
+    Structure1SPtr mS;
+};
+
+// Holder of the current HoldStructure1 shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<HoldStructure1> HoldStructure1Snapshot;
+
+// Structure2 is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Structure2 : public Structure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder : public Structure1::Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void              operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                  Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                  Builder  (const Structure2& object);
+        // Destructor of Builder
+        /*lax*/                   ~Builder ();
+
+        // Instantiates Structure2 instance with the current initialization
+        // of the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Structure2& build    ()                         const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                Structure2SPtr    finalize ();
+
+
+    protected:
+        // constructor needed from potential derived classes
+                                  Builder  (Structure2RPtr pObject);
+    };
+
+    // Default constructor
+                           Structure2 ();
+    // Destructor
+    /*lax*/                ~Structure2();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2SPtr downcast   (const Structure1SPtr& object);
+};
+
+// Holder of the current Structure2 shared between threads. The readers get
+// the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Structure2> Structure2Snapshot;
+
+// HoldStructure2 is an immutable class - once instantiated none of the
+// data fields can be changed. For the initial initialization and
+// instantiation use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class HoldStructure2 : public HoldStructure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder : public HoldStructure1::Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                  operator=(const Builder& );
+
+        // Hide setter method for the data field s, no implementation
+                Builder&              set_s    (const Structure1SPtr& s);
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                      Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                      Builder  (const HoldStructure2& object);
+        // Destructor of Builder
+        /*lax*/                       ~Builder ();
+
+        // Instantiates HoldStructure2 instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const HoldStructure2& build    ()                             const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                HoldStructure2SPtr    finalize ();
+
+
+        // Override setter method for the data field s
+                Builder&              set_s    (const Structure2SPtr& s);
+
+    protected:
+        // constructor needed from potential derived classes
+                                      Builder  (HoldStructure2RPtr pObject);
+    };
+
+    // Default constructor
+                               HoldStructure2 ();
+    // Destructor
+    /*lax*/                    ~HoldStructure2();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  HoldStructure2SPtr downcast       (const HoldStructure1SPtr& object);
+
+    // Override getter method for the data field s
+            Structure2SPtr     s              ()                                 const;
+};
+
+// Holder of the current HoldStructure2 shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<HoldStructure2> HoldStructure2Snapshot;
+
+inline bool Structure1::isInitialized() const
+{
+    return true;
+}
+
+inline int HoldStructure1::bitmask_s()
+{
+    return 0x1;
+}
+
+inline bool HoldStructure1::isInitialized() const
+{
+    if (!valid_s()) return false;
+    return true;
+}
+
+inline const Structure1SPtr& HoldStructure1::s() const
+{
+    BOOST_ASSERT(valid_s());
+    return mS;
+}
+
+inline bool HoldStructure1::valid_s() const
+{
+    return (mBits & bitmask_s()) != 0;
+}
+
+inline HoldStructure1::Builder& HoldStructure1::Builder::set_s(const Structure1SPtr& s)
+{
+    mpObject->mS     = s;
+    mpObject->mBits |= bitmask_s();
+    return *this;
+}
+
+}
+
+#else // __STRUCTURE_FIELD_OVERRIDE_COMPIL_H_
+
+namespace override
+{
+
+// Forward declarations
+class Structure1;
+typedef Structure1*                         Structure1RPtr;
+typedef boost::shared_ptr<Structure1>       Structure1SPtr;
+typedef boost::shared_ptr<const Structure1> Structure1SCPtr;
+typedef boost::weak_ptr<Structure1>         Structure1WPtr;
+
+class HoldStructure1;
+typedef HoldStructure1*                         HoldStructure1RPtr;
+typedef boost::shared_ptr<HoldStructure1>       HoldStructure1SPtr;
+typedef boost::shared_ptr<const HoldStructure1> HoldStructure1SCPtr;
+typedef boost::weak_ptr<HoldStructure1>         HoldStructure1WPtr;
+
+class Structure2;
+typedef Structure2*                         Structure2RPtr;
+typedef boost::shared_ptr<Structure2>       Structure2SPtr;
+typedef boost::shared_ptr<const Structure2> Structure2SCPtr;
+typedef boost::weak_ptr<Structure2>         Structure2WPtr;
+
+class HoldStructure2;
+typedef HoldStructure2*                         HoldStructure2RPtr;
+typedef boost::shared_ptr<HoldStructure2>       HoldStructure2SPtr;
+typedef boost::shared_ptr<const HoldStructure2> HoldStructure2SCPtr;
+typedef boost::weak_ptr<HoldStructure2>         HoldStructure2WPtr;
+
+}
+
+#endif // __STRUCTURE_FIELD_OVERRIDE_COMPIL_H_
+
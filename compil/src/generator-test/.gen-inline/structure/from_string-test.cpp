@@ -0,0 +1,11 @@
+#include "structure/from_string.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace from_string
+{
+
+}
+
@@ -0,0 +1,5147 @@
+#include "structure/from_string.h"
+// Standard C Library
+#include <string.h>
+
+namespace from_string
+{
+
+EColor::EColor()
+        : mValue(kInvalid)
+{
+}
+
+EColor::EColor(long value)
+        : mValue(value)
+{
+}
+
+const long EColor::invalid()
+{
+    return kInvalid;
+}
+
+const long EColor::red()
+{
+    return kRed;
+}
+
+const long EColor::green()
+{
+    return kGreen;
+}
+
+const long EColor::blue()
+{
+    return kBlue;
+}
+
+long EColor::value() const
+{
+    return mValue;
+}
+
+const char* EColor::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "red",
+        "green",
+        "blue",
+    };
+    return names[(size_t)value];
+}
+
+const char* EColor::shortName() const
+{
+    return shortName(value());
+}
+
+EColor EColor::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        1, 1, 0,
+    };
+    static const char* names[] =
+    {
+        "green",
+        "red",
+        "invalid",
+        "blue",
+    };
+    static const size_t lengths[] =
+    {
+        5, 3, 7, 4,
+    };
+    static const long values[] =
+    {
+        kGreen,
+        kRed,
+        kInvalid,
+        kBlue,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 3]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 4;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return EColor();
+    return EColor(values[slot]);
+}
+
+EColor::operator long () const
+{
+    return mValue;
+}
+
+EPermission::EPermission()
+        : flags_enumeration<long, EPermission>(0)
+{
+}
+
+EPermission::EPermission(long value)
+        : flags_enumeration<long, EPermission>(value)
+{
+}
+
+const EPermission EPermission::nil()
+{
+    return EPermission(kNil);
+}
+
+const EPermission EPermission::read()
+{
+    return EPermission(kRead);
+}
+
+const EPermission EPermission::write()
+{
+    return EPermission(kWrite);
+}
+
+const EPermission EPermission::execute()
+{
+    return EPermission(kExecute);
+}
+
+const EPermission EPermission::all()
+{
+    return EPermission(kAll);
+}
+
+long EPermission::value() const
+{
+    return mValue;
+}
+
+const char* EPermission::shortName(long value)
+{
+    switch (value)
+    {
+        case kRead   : return "read";
+        case kWrite  : return "write";
+        case kExecute: return "execute";
+        default      : return "custom";
+    }
+}
+
+const char* EPermission::shortName() const
+{
+    return shortName(value());
+}
+
+EPermission EPermission::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        0, 8, 0,
+    };
+    static const char* names[] =
+    {
+        "all",
+        "execute",
+        "nil",
+        "write",
+        "read",
+    };
+    static const size_t lengths[] =
+    {
+        3, 7, 3, 5, 4,
+    };
+    static const long values[] =
+    {
+        kAll,
+        kExecute,
+        kNil,
+        kWrite,
+        kRead,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 3]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 5;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return EPermission();
+    return EPermission(values[slot]);
+}
+
+bool EPermission::operator==(const EPermission& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EPermission::operator!=(const EPermission& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EPlace::EPlace()
+        : mValue(kInvalid)
+{
+}
+
+EPlace::EPlace(long value)
+        : mValue(value)
+{
+}
+
+const EPlace EPlace::invalid()
+{
+    return EPlace(kInvalid);
+}
+
+const EPlace EPlace::amber_anchor()
+{
+    return EPlace(kAmber_anchor);
+}
+
+const EPlace EPlace::amber_bridge()
+{
+    return EPlace(kAmber_bridge);
+}
+
+const EPlace EPlace::amber_canyon()
+{
+    return EPlace(kAmber_canyon);
+}
+
+const EPlace EPlace::amber_delta()
+{
+    return EPlace(kAmber_delta);
+}
+
+const EPlace EPlace::amber_ember()
+{
+    return EPlace(kAmber_ember);
+}
+
+const EPlace EPlace::amber_falcon()
+{
+    return EPlace(kAmber_falcon);
+}
+
+const EPlace EPlace::amber_glacier()
+{
+    return EPlace(kAmber_glacier);
+}
+
+const EPlace EPlace::amber_harbor()
+{
+    return EPlace(kAmber_harbor);
+}
+
+const EPlace EPlace::amber_island()
+{
+    return EPlace(kAmber_island);
+}
+
+const EPlace EPlace::amber_jungle()
+{
+    return EPlace(kAmber_jungle);
+}
+
+const EPlace EPlace::amber_kernel()
+{
+    return EPlace(kAmber_kernel);
+}
+
+const EPlace EPlace::amber_lagoon()
+{
+    return EPlace(kAmber_lagoon);
+}
+
+const EPlace EPlace::amber_meadow()
+{
+    return EPlace(kAmber_meadow);
+}
+
+const EPlace EPlace::amber_nebula()
+{
+    return EPlace(kAmber_nebula);
+}
+
+const EPlace EPlace::amber_orchard()
+{
+    return EPlace(kAmber_orchard);
+}
+
+const EPlace EPlace::amber_prairie()
+{
+    return EPlace(kAmber_prairie);
+}
+
+const EPlace EPlace::amber_quarry()
+{
+    return EPlace(kAmber_quarry);
+}
+
+const EPlace EPlace::amber_river()
+{
+    return EPlace(kAmber_river);
+}
+
+const EPlace EPlace::amber_summit()
+{
+    return EPlace(kAmber_summit);
+}
+
+const EPlace EPlace::amber_tundra()
+{
+    return EPlace(kAmber_tundra);
+}
+
+const EPlace EPlace::amber_valley()
+{
+    return EPlace(kAmber_valley);
+}
+
+const EPlace EPlace::amber_willow()
+{
+    return EPlace(kAmber_willow);
+}
+
+const EPlace EPlace::amber_yonder()
+{
+    return EPlace(kAmber_yonder);
+}
+
+const EPlace EPlace::amber_zenith()
+{
+    return EPlace(kAmber_zenith);
+}
+
+const EPlace EPlace::brisk_anchor()
+{
+    return EPlace(kBrisk_anchor);
+}
+
+const EPlace EPlace::brisk_bridge()
+{
+    return EPlace(kBrisk_bridge);
+}
+
+const EPlace EPlace::brisk_canyon()
+{
+    return EPlace(kBrisk_canyon);
+}
+
+const EPlace EPlace::brisk_delta()
+{
+    return EPlace(kBrisk_delta);
+}
+
+const EPlace EPlace::brisk_ember()
+{
+    return EPlace(kBrisk_ember);
+}
+
+const EPlace EPlace::brisk_falcon()
+{
+    return EPlace(kBrisk_falcon);
+}
+
+const EPlace EPlace::brisk_glacier()
+{
+    return EPlace(kBrisk_glacier);
+}
+
+const EPlace EPlace::brisk_harbor()
+{
+    return EPlace(kBrisk_harbor);
+}
+
+const EPlace EPlace::brisk_island()
+{
+    return EPlace(kBrisk_island);
+}
+
+const EPlace EPlace::brisk_jungle()
+{
+    return EPlace(kBrisk_jungle);
+}
+
+const EPlace EPlace::brisk_kernel()
+{
+    return EPlace(kBrisk_kernel);
+}
+
+const EPlace EPlace::brisk_lagoon()
+{
+    return EPlace(kBrisk_lagoon);
+}
+
+const EPlace EPlace::brisk_meadow()
+{
+    return EPlace(kBrisk_meadow);
+}
+
+const EPlace EPlace::brisk_nebula()
+{
+    return EPlace(kBrisk_nebula);
+}
+
+const EPlace EPlace::brisk_orchard()
+{
+    return EPlace(kBrisk_orchard);
+}
+
+const EPlace EPlace::brisk_prairie()
+{
+    return EPlace(kBrisk_prairie);
+}
+
+const EPlace EPlace::brisk_quarry()
+{
+    return EPlace(kBrisk_quarry);
+}
+
+const EPlace EPlace::brisk_river()
+{
+    return EPlace(kBrisk_river);
+}
+
+const EPlace EPlace::brisk_summit()
+{
+    return EPlace(kBrisk_summit);
+}
+
+const EPlace EPlace::brisk_tundra()
+{
+    return EPlace(kBrisk_tundra);
+}
+
+const EPlace EPlace::brisk_valley()
+{
+    return EPlace(kBrisk_valley);
+}
+
+const EPlace EPlace::brisk_willow()
+{
+    return EPlace(kBrisk_willow);
+}
+
+const EPlace EPlace::brisk_yonder()
+{
+    return EPlace(kBrisk_yonder);
+}
+
+const EPlace EPlace::brisk_zenith()
+{
+    return EPlace(kBrisk_zenith);
+}
+
+const EPlace EPlace::coral_anchor()
+{
+    return EPlace(kCoral_anchor);
+}
+
+const EPlace EPlace::coral_bridge()
+{
+    return EPlace(kCoral_bridge);
+}
+
+const EPlace EPlace::coral_canyon()
+{
+    return EPlace(kCoral_canyon);
+}
+
+const EPlace EPlace::coral_delta()
+{
+    return EPlace(kCoral_delta);
+}
+
+const EPlace EPlace::coral_ember()
+{
+    return EPlace(kCoral_ember);
+}
+
+const EPlace EPlace::coral_falcon()
+{
+    return EPlace(kCoral_falcon);
+}
+
+const EPlace EPlace::coral_glacier()
+{
+    return EPlace(kCoral_glacier);
+}
+
+const EPlace EPlace::coral_harbor()
+{
+    return EPlace(kCoral_harbor);
+}
+
+const EPlace EPlace::coral_island()
+{
+    return EPlace(kCoral_island);
+}
+
+const EPlace EPlace::coral_jungle()
+{
+    return EPlace(kCoral_jungle);
+}
+
+const EPlace EPlace::coral_kernel()
+{
+    return EPlace(kCoral_kernel);
+}
+
+const EPlace EPlace::coral_lagoon()
+{
+    return EPlace(kCoral_lagoon);
+}
+
+const EPlace EPlace::coral_meadow()
+{
+    return EPlace(kCoral_meadow);
+}
+
+const EPlace EPlace::coral_nebula()
+{
+    return EPlace(kCoral_nebula);
+}
+
+const EPlace EPlace::coral_orchard()
+{
+    return EPlace(kCoral_orchard);
+}
+
+const EPlace EPlace::coral_prairie()
+{
+    return EPlace(kCoral_prairie);
+}
+
+const EPlace EPlace::coral_quarry()
+{
+    return EPlace(kCoral_quarry);
+}
+
+const EPlace EPlace::coral_river()
+{
+    return EPlace(kCoral_river);
+}
+
+const EPlace EPlace::coral_summit()
+{
+    return EPlace(kCoral_summit);
+}
+
+const EPlace EPlace::coral_tundra()
+{
+    return EPlace(kCoral_tundra);
+}
+
+const EPlace EPlace::coral_valley()
+{
+    return EPlace(kCoral_valley);
+}
+
+const EPlace EPlace::coral_willow()
+{
+    return EPlace(kCoral_willow);
+}
+
+const EPlace EPlace::coral_yonder()
+{
+    return EPlace(kCoral_yonder);
+}
+
+const EPlace EPlace::coral_zenith()
+{
+    return EPlace(kCoral_zenith);
+}
+
+const EPlace EPlace::dusty_anchor()
+{
+    return EPlace(kDusty_anchor);
+}
+
+const EPlace EPlace::dusty_bridge()
+{
+    return EPlace(kDusty_bridge);
+}
+
+const EPlace EPlace::dusty_canyon()
+{
+    return EPlace(kDusty_canyon);
+}
+
+const EPlace EPlace::dusty_delta()
+{
+    return EPlace(kDusty_delta);
+}
+
+const EPlace EPlace::dusty_ember()
+{
+    return EPlace(kDusty_ember);
+}
+
+const EPlace EPlace::dusty_falcon()
+{
+    return EPlace(kDusty_falcon);
+}
+
+const EPlace EPlace::dusty_glacier()
+{
+    return EPlace(kDusty_glacier);
+}
+
+const EPlace EPlace::dusty_harbor()
+{
+    return EPlace(kDusty_harbor);
+}
+
+const EPlace EPlace::dusty_island()
+{
+    return EPlace(kDusty_island);
+}
+
+const EPlace EPlace::dusty_jungle()
+{
+    return EPlace(kDusty_jungle);
+}
+
+const EPlace EPlace::dusty_kernel()
+{
+    return EPlace(kDusty_kernel);
+}
+
+const EPlace EPlace::dusty_lagoon()
+{
+    return EPlace(kDusty_lagoon);
+}
+
+const EPlace EPlace::dusty_meadow()
+{
+    return EPlace(kDusty_meadow);
+}
+
+const EPlace EPlace::dusty_nebula()
+{
+    return EPlace(kDusty_nebula);
+}
+
+const EPlace EPlace::dusty_orchard()
+{
+    return EPlace(kDusty_orchard);
+}
+
+const EPlace EPlace::dusty_prairie()
+{
+    return EPlace(kDusty_prairie);
+}
+
+const EPlace EPlace::dusty_quarry()
+{
+    return EPlace(kDusty_quarry);
+}
+
+const EPlace EPlace::dusty_river()
+{
+    return EPlace(kDusty_river);
+}
+
+const EPlace EPlace::dusty_summit()
+{
+    return EPlace(kDusty_summit);
+}
+
+const EPlace EPlace::dusty_tundra()
+{
+    return EPlace(kDusty_tundra);
+}
+
+const EPlace EPlace::dusty_valley()
+{
+    return EPlace(kDusty_valley);
+}
+
+const EPlace EPlace::dusty_willow()
+{
+    return EPlace(kDusty_willow);
+}
+
+const EPlace EPlace::dusty_yonder()
+{
+    return EPlace(kDusty_yonder);
+}
+
+const EPlace EPlace::dusty_zenith()
+{
+    return EPlace(kDusty_zenith);
+}
+
+const EPlace EPlace::early_anchor()
+{
+    return EPlace(kEarly_anchor);
+}
+
+const EPlace EPlace::early_bridge()
+{
+    return EPlace(kEarly_bridge);
+}
+
+const EPlace EPlace::early_canyon()
+{
+    return EPlace(kEarly_canyon);
+}
+
+const EPlace EPlace::early_delta()
+{
+    return EPlace(kEarly_delta);
+}
+
+const EPlace EPlace::early_ember()
+{
+    return EPlace(kEarly_ember);
+}
+
+const EPlace EPlace::early_falcon()
+{
+    return EPlace(kEarly_falcon);
+}
+
+const EPlace EPlace::early_glacier()
+{
+    return EPlace(kEarly_glacier);
+}
+
+const EPlace EPlace::early_harbor()
+{
+    return EPlace(kEarly_harbor);
+}
+
+const EPlace EPlace::early_island()
+{
+    return EPlace(kEarly_island);
+}
+
+const EPlace EPlace::early_jungle()
+{
+    return EPlace(kEarly_jungle);
+}
+
+const EPlace EPlace::early_kernel()
+{
+    return EPlace(kEarly_kernel);
+}
+
+const EPlace EPlace::early_lagoon()
+{
+    return EPlace(kEarly_lagoon);
+}
+
+const EPlace EPlace::early_meadow()
+{
+    return EPlace(kEarly_meadow);
+}
+
+const EPlace EPlace::early_nebula()
+{
+    return EPlace(kEarly_nebula);
+}
+
+const EPlace EPlace::early_orchard()
+{
+    return EPlace(kEarly_orchard);
+}
+
+const EPlace EPlace::early_prairie()
+{
+    return EPlace(kEarly_prairie);
+}
+
+const EPlace EPlace::early_quarry()
+{
+    return EPlace(kEarly_quarry);
+}
+
+const EPlace EPlace::early_river()
+{
+    return EPlace(kEarly_river);
+}
+
+const EPlace EPlace::early_summit()
+{
+    return EPlace(kEarly_summit);
+}
+
+const EPlace EPlace::early_tundra()
+{
+    return EPlace(kEarly_tundra);
+}
+
+const EPlace EPlace::early_valley()
+{
+    return EPlace(kEarly_valley);
+}
+
+const EPlace EPlace::early_willow()
+{
+    return EPlace(kEarly_willow);
+}
+
+const EPlace EPlace::early_yonder()
+{
+    return EPlace(kEarly_yonder);
+}
+
+const EPlace EPlace::early_zenith()
+{
+    return EPlace(kEarly_zenith);
+}
+
+const EPlace EPlace::faint_anchor()
+{
+    return EPlace(kFaint_anchor);
+}
+
+const EPlace EPlace::faint_bridge()
+{
+    return EPlace(kFaint_bridge);
+}
+
+const EPlace EPlace::faint_canyon()
+{
+    return EPlace(kFaint_canyon);
+}
+
+const EPlace EPlace::faint_delta()
+{
+    return EPlace(kFaint_delta);
+}
+
+const EPlace EPlace::faint_ember()
+{
+    return EPlace(kFaint_ember);
+}
+
+const EPlace EPlace::faint_falcon()
+{
+    return EPlace(kFaint_falcon);
+}
+
+const EPlace EPlace::faint_glacier()
+{
+    return EPlace(kFaint_glacier);
+}
+
+const EPlace EPlace::faint_harbor()
+{
+    return EPlace(kFaint_harbor);
+}
+
+const EPlace EPlace::faint_island()
+{
+    return EPlace(kFaint_island);
+}
+
+const EPlace EPlace::faint_jungle()
+{
+    return EPlace(kFaint_jungle);
+}
+
+const EPlace EPlace::faint_kernel()
+{
+    return EPlace(kFaint_kernel);
+}
+
+const EPlace EPlace::faint_lagoon()
+{
+    return EPlace(kFaint_lagoon);
+}
+
+const EPlace EPlace::faint_meadow()
+{
+    return EPlace(kFaint_meadow);
+}
+
+const EPlace EPlace::faint_nebula()
+{
+    return EPlace(kFaint_nebula);
+}
+
+const EPlace EPlace::faint_orchard()
+{
+    return EPlace(kFaint_orchard);
+}
+
+const EPlace EPlace::faint_prairie()
+{
+    return EPlace(kFaint_prairie);
+}
+
+const EPlace EPlace::faint_quarry()
+{
+    return EPlace(kFaint_quarry);
+}
+
+const EPlace EPlace::faint_river()
+{
+    return EPlace(kFaint_river);
+}
+
+const EPlace EPlace::faint_summit()
+{
+    return EPlace(kFaint_summit);
+}
+
+const EPlace EPlace::faint_tundra()
+{
+    return EPlace(kFaint_tundra);
+}
+
+const EPlace EPlace::faint_valley()
+{
+    return EPlace(kFaint_valley);
+}
+
+const EPlace EPlace::faint_willow()
+{
+    return EPlace(kFaint_willow);
+}
+
+const EPlace EPlace::faint_yonder()
+{
+    return EPlace(kFaint_yonder);
+}
+
+const EPlace EPlace::faint_zenith()
+{
+    return EPlace(kFaint_zenith);
+}
+
+const EPlace EPlace::giant_anchor()
+{
+    return EPlace(kGiant_anchor);
+}
+
+const EPlace EPlace::giant_bridge()
+{
+    return EPlace(kGiant_bridge);
+}
+
+const EPlace EPlace::giant_canyon()
+{
+    return EPlace(kGiant_canyon);
+}
+
+const EPlace EPlace::giant_delta()
+{
+    return EPlace(kGiant_delta);
+}
+
+const EPlace EPlace::giant_ember()
+{
+    return EPlace(kGiant_ember);
+}
+
+const EPlace EPlace::giant_falcon()
+{
+    return EPlace(kGiant_falcon);
+}
+
+const EPlace EPlace::giant_glacier()
+{
+    return EPlace(kGiant_glacier);
+}
+
+const EPlace EPlace::giant_harbor()
+{
+    return EPlace(kGiant_harbor);
+}
+
+const EPlace EPlace::giant_island()
+{
+    return EPlace(kGiant_island);
+}
+
+const EPlace EPlace::giant_jungle()
+{
+    return EPlace(kGiant_jungle);
+}
+
+const EPlace EPlace::giant_kernel()
+{
+    return EPlace(kGiant_kernel);
+}
+
+const EPlace EPlace::giant_lagoon()
+{
+    return EPlace(kGiant_lagoon);
+}
+
+const EPlace EPlace::giant_meadow()
+{
+    return EPlace(kGiant_meadow);
+}
+
+const EPlace EPlace::giant_nebula()
+{
+    return EPlace(kGiant_nebula);
+}
+
+const EPlace EPlace::giant_orchard()
+{
+    return EPlace(kGiant_orchard);
+}
+
+const EPlace EPlace::giant_prairie()
+{
+    return EPlace(kGiant_prairie);
+}
+
+const EPlace EPlace::giant_quarry()
+{
+    return EPlace(kGiant_quarry);
+}
+
+const EPlace EPlace::giant_river()
+{
+    return EPlace(kGiant_river);
+}
+
+const EPlace EPlace::giant_summit()
+{
+    return EPlace(kGiant_summit);
+}
+
+const EPlace EPlace::giant_tundra()
+{
+    return EPlace(kGiant_tundra);
+}
+
+const EPlace EPlace::giant_valley()
+{
+    return EPlace(kGiant_valley);
+}
+
+const EPlace EPlace::giant_willow()
+{
+    return EPlace(kGiant_willow);
+}
+
+const EPlace EPlace::giant_yonder()
+{
+    return EPlace(kGiant_yonder);
+}
+
+const EPlace EPlace::giant_zenith()
+{
+    return EPlace(kGiant_zenith);
+}
+
+const EPlace EPlace::hollow_anchor()
+{
+    return EPlace(kHollow_anchor);
+}
+
+const EPlace EPlace::hollow_bridge()
+{
+    return EPlace(kHollow_bridge);
+}
+
+const EPlace EPlace::hollow_canyon()
+{
+    return EPlace(kHollow_canyon);
+}
+
+const EPlace EPlace::hollow_delta()
+{
+    return EPlace(kHollow_delta);
+}
+
+const EPlace EPlace::hollow_ember()
+{
+    return EPlace(kHollow_ember);
+}
+
+const EPlace EPlace::hollow_falcon()
+{
+    return EPlace(kHollow_falcon);
+}
+
+const EPlace EPlace::hollow_glacier()
+{
+    return EPlace(kHollow_glacier);
+}
+
+const EPlace EPlace::hollow_harbor()
+{
+    return EPlace(kHollow_harbor);
+}
+
+const EPlace EPlace::hollow_island()
+{
+    return EPlace(kHollow_island);
+}
+
+const EPlace EPlace::hollow_jungle()
+{
+    return EPlace(kHollow_jungle);
+}
+
+const EPlace EPlace::hollow_kernel()
+{
+    return EPlace(kHollow_kernel);
+}
+
+const EPlace EPlace::hollow_lagoon()
+{
+    return EPlace(kHollow_lagoon);
+}
+
+const EPlace EPlace::hollow_meadow()
+{
+    return EPlace(kHollow_meadow);
+}
+
+const EPlace EPlace::hollow_nebula()
+{
+    return EPlace(kHollow_nebula);
+}
+
+const EPlace EPlace::hollow_orchard()
+{
+    return EPlace(kHollow_orchard);
+}
+
+const EPlace EPlace::hollow_prairie()
+{
+    return EPlace(kHollow_prairie);
+}
+
+const EPlace EPlace::hollow_quarry()
+{
+    return EPlace(kHollow_quarry);
+}
+
+const EPlace EPlace::hollow_river()
+{
+    return EPlace(kHollow_river);
+}
+
+const EPlace EPlace::hollow_summit()
+{
+    return EPlace(kHollow_summit);
+}
+
+const EPlace EPlace::hollow_tundra()
+{
+    return EPlace(kHollow_tundra);
+}
+
+const EPlace EPlace::hollow_valley()
+{
+    return EPlace(kHollow_valley);
+}
+
+const EPlace EPlace::hollow_willow()
+{
+    return EPlace(kHollow_willow);
+}
+
+const EPlace EPlace::hollow_yonder()
+{
+    return EPlace(kHollow_yonder);
+}
+
+const EPlace EPlace::hollow_zenith()
+{
+    return EPlace(kHollow_zenith);
+}
+
+const EPlace EPlace::ivory_anchor()
+{
+    return EPlace(kIvory_anchor);
+}
+
+const EPlace EPlace::ivory_bridge()
+{
+    return EPlace(kIvory_bridge);
+}
+
+const EPlace EPlace::ivory_canyon()
+{
+    return EPlace(kIvory_canyon);
+}
+
+const EPlace EPlace::ivory_delta()
+{
+    return EPlace(kIvory_delta);
+}
+
+const EPlace EPlace::ivory_ember()
+{
+    return EPlace(kIvory_ember);
+}
+
+const EPlace EPlace::ivory_falcon()
+{
+    return EPlace(kIvory_falcon);
+}
+
+const EPlace EPlace::ivory_glacier()
+{
+    return EPlace(kIvory_glacier);
+}
+
+const EPlace EPlace::ivory_harbor()
+{
+    return EPlace(kIvory_harbor);
+}
+
+const EPlace EPlace::ivory_island()
+{
+    return EPlace(kIvory_island);
+}
+
+const EPlace EPlace::ivory_jungle()
+{
+    return EPlace(kIvory_jungle);
+}
+
+const EPlace EPlace::ivory_kernel()
+{
+    return EPlace(kIvory_kernel);
+}
+
+const EPlace EPlace::ivory_lagoon()
+{
+    return EPlace(kIvory_lagoon);
+}
+
+const EPlace EPlace::ivory_meadow()
+{
+    return EPlace(kIvory_meadow);
+}
+
+const EPlace EPlace::ivory_nebula()
+{
+    return EPlace(kIvory_nebula);
+}
+
+const EPlace EPlace::ivory_orchard()
+{
+    return EPlace(kIvory_orchard);
+}
+
+const EPlace EPlace::ivory_prairie()
+{
+    return EPlace(kIvory_prairie);
+}
+
+const EPlace EPlace::ivory_quarry()
+{
+    return EPlace(kIvory_quarry);
+}
+
+const EPlace EPlace::ivory_river()
+{
+    return EPlace(kIvory_river);
+}
+
+const EPlace EPlace::ivory_summit()
+{
+    return EPlace(kIvory_summit);
+}
+
+const EPlace EPlace::ivory_tundra()
+{
+    return EPlace(kIvory_tundra);
+}
+
+const EPlace EPlace::ivory_valley()
+{
+    return EPlace(kIvory_valley);
+}
+
+const EPlace EPlace::ivory_willow()
+{
+    return EPlace(kIvory_willow);
+}
+
+const EPlace EPlace::ivory_yonder()
+{
+    return EPlace(kIvory_yonder);
+}
+
+const EPlace EPlace::ivory_zenith()
+{
+    return EPlace(kIvory_zenith);
+}
+
+const EPlace EPlace::jolly_anchor()
+{
+    return EPlace(kJolly_anchor);
+}
+
+const EPlace EPlace::jolly_bridge()
+{
+    return EPlace(kJolly_bridge);
+}
+
+const EPlace EPlace::jolly_canyon()
+{
+    return EPlace(kJolly_canyon);
+}
+
+const EPlace EPlace::jolly_delta()
+{
+    return EPlace(kJolly_delta);
+}
+
+const EPlace EPlace::jolly_ember()
+{
+    return EPlace(kJolly_ember);
+}
+
+const EPlace EPlace::jolly_falcon()
+{
+    return EPlace(kJolly_falcon);
+}
+
+const EPlace EPlace::jolly_glacier()
+{
+    return EPlace(kJolly_glacier);
+}
+
+const EPlace EPlace::jolly_harbor()
+{
+    return EPlace(kJolly_harbor);
+}
+
+const EPlace EPlace::jolly_island()
+{
+    return EPlace(kJolly_island);
+}
+
+const EPlace EPlace::jolly_jungle()
+{
+    return EPlace(kJolly_jungle);
+}
+
+const EPlace EPlace::jolly_kernel()
+{
+    return EPlace(kJolly_kernel);
+}
+
+const EPlace EPlace::jolly_lagoon()
+{
+    return EPlace(kJolly_lagoon);
+}
+
+const EPlace EPlace::jolly_meadow()
+{
+    return EPlace(kJolly_meadow);
+}
+
+const EPlace EPlace::jolly_nebula()
+{
+    return EPlace(kJolly_nebula);
+}
+
+const EPlace EPlace::jolly_orchard()
+{
+    return EPlace(kJolly_orchard);
+}
+
+const EPlace EPlace::jolly_prairie()
+{
+    return EPlace(kJolly_prairie);
+}
+
+const EPlace EPlace::jolly_quarry()
+{
+    return EPlace(kJolly_quarry);
+}
+
+const EPlace EPlace::jolly_river()
+{
+    return EPlace(kJolly_river);
+}
+
+const EPlace EPlace::jolly_summit()
+{
+    return EPlace(kJolly_summit);
+}
+
+const EPlace EPlace::jolly_tundra()
+{
+    return EPlace(kJolly_tundra);
+}
+
+const EPlace EPlace::jolly_valley()
+{
+    return EPlace(kJolly_valley);
+}
+
+const EPlace EPlace::jolly_willow()
+{
+    return EPlace(kJolly_willow);
+}
+
+const EPlace EPlace::jolly_yonder()
+{
+    return EPlace(kJolly_yonder);
+}
+
+const EPlace EPlace::jolly_zenith()
+{
+    return EPlace(kJolly_zenith);
+}
+
+const EPlace EPlace::keen_anchor()
+{
+    return EPlace(kKeen_anchor);
+}
+
+const EPlace EPlace::keen_bridge()
+{
+    return EPlace(kKeen_bridge);
+}
+
+const EPlace EPlace::keen_canyon()
+{
+    return EPlace(kKeen_canyon);
+}
+
+const EPlace EPlace::keen_delta()
+{
+    return EPlace(kKeen_delta);
+}
+
+const EPlace EPlace::keen_ember()
+{
+    return EPlace(kKeen_ember);
+}
+
+const EPlace EPlace::keen_falcon()
+{
+    return EPlace(kKeen_falcon);
+}
+
+const EPlace EPlace::keen_glacier()
+{
+    return EPlace(kKeen_glacier);
+}
+
+const EPlace EPlace::keen_harbor()
+{
+    return EPlace(kKeen_harbor);
+}
+
+const EPlace EPlace::keen_island()
+{
+    return EPlace(kKeen_island);
+}
+
+const EPlace EPlace::keen_jungle()
+{
+    return EPlace(kKeen_jungle);
+}
+
+const EPlace EPlace::keen_kernel()
+{
+    return EPlace(kKeen_kernel);
+}
+
+const EPlace EPlace::keen_lagoon()
+{
+    return EPlace(kKeen_lagoon);
+}
+
+const EPlace EPlace::keen_meadow()
+{
+    return EPlace(kKeen_meadow);
+}
+
+const EPlace EPlace::keen_nebula()
+{
+    return EPlace(kKeen_nebula);
+}
+
+const EPlace EPlace::keen_orchard()
+{
+    return EPlace(kKeen_orchard);
+}
+
+const EPlace EPlace::keen_prairie()
+{
+    return EPlace(kKeen_prairie);
+}
+
+const EPlace EPlace::keen_quarry()
+{
+    return EPlace(kKeen_quarry);
+}
+
+const EPlace EPlace::keen_river()
+{
+    return EPlace(kKeen_river);
+}
+
+const EPlace EPlace::keen_summit()
+{
+    return EPlace(kKeen_summit);
+}
+
+const EPlace EPlace::keen_tundra()
+{
+    return EPlace(kKeen_tundra);
+}
+
+const EPlace EPlace::keen_valley()
+{
+    return EPlace(kKeen_valley);
+}
+
+const EPlace EPlace::keen_willow()
+{
+    return EPlace(kKeen_willow);
+}
+
+const EPlace EPlace::keen_yonder()
+{
+    return EPlace(kKeen_yonder);
+}
+
+const EPlace EPlace::keen_zenith()
+{
+    return EPlace(kKeen_zenith);
+}
+
+const EPlace EPlace::lunar_anchor()
+{
+    return EPlace(kLunar_anchor);
+}
+
+const EPlace EPlace::lunar_bridge()
+{
+    return EPlace(kLunar_bridge);
+}
+
+const EPlace EPlace::lunar_canyon()
+{
+    return EPlace(kLunar_canyon);
+}
+
+const EPlace EPlace::lunar_delta()
+{
+    return EPlace(kLunar_delta);
+}
+
+const EPlace EPlace::lunar_ember()
+{
+    return EPlace(kLunar_ember);
+}
+
+const EPlace EPlace::lunar_falcon()
+{
+    return EPlace(kLunar_falcon);
+}
+
+const EPlace EPlace::lunar_glacier()
+{
+    return EPlace(kLunar_glacier);
+}
+
+const EPlace EPlace::lunar_harbor()
+{
+    return EPlace(kLunar_harbor);
+}
+
+const EPlace EPlace::lunar_island()
+{
+    return EPlace(kLunar_island);
+}
+
+const EPlace EPlace::lunar_jungle()
+{
+    return EPlace(kLunar_jungle);
+}
+
+const EPlace EPlace::lunar_kernel()
+{
+    return EPlace(kLunar_kernel);
+}
+
+const EPlace EPlace::lunar_lagoon()
+{
+    return EPlace(kLunar_lagoon);
+}
+
+const EPlace EPlace::lunar_meadow()
+{
+    return EPlace(kLunar_meadow);
+}
+
+const EPlace EPlace::lunar_nebula()
+{
+    return EPlace(kLunar_nebula);
+}
+
+const EPlace EPlace::lunar_orchard()
+{
+    return EPlace(kLunar_orchard);
+}
+
+const EPlace EPlace::lunar_prairie()
+{
+    return EPlace(kLunar_prairie);
+}
+
+const EPlace EPlace::lunar_quarry()
+{
+    return EPlace(kLunar_quarry);
+}
+
+const EPlace EPlace::lunar_river()
+{
+    return EPlace(kLunar_river);
+}
+
+const EPlace EPlace::lunar_summit()
+{
+    return EPlace(kLunar_summit);
+}
+
+const EPlace EPlace::lunar_tundra()
+{
+    return EPlace(kLunar_tundra);
+}
+
+const EPlace EPlace::lunar_valley()
+{
+    return EPlace(kLunar_valley);
+}
+
+const EPlace EPlace::lunar_willow()
+{
+    return EPlace(kLunar_willow);
+}
+
+const EPlace EPlace::lunar_yonder()
+{
+    return EPlace(kLunar_yonder);
+}
+
+const EPlace EPlace::lunar_zenith()
+{
+    return EPlace(kLunar_zenith);
+}
+
+const EPlace EPlace::misty_anchor()
+{
+    return EPlace(kMisty_anchor);
+}
+
+const EPlace EPlace::misty_bridge()
+{
+    return EPlace(kMisty_bridge);
+}
+
+const EPlace EPlace::misty_canyon()
+{
+    return EPlace(kMisty_canyon);
+}
+
+const EPlace EPlace::misty_delta()
+{
+    return EPlace(kMisty_delta);
+}
+
+const EPlace EPlace::misty_ember()
+{
+    return EPlace(kMisty_ember);
+}
+
+const EPlace EPlace::misty_falcon()
+{
+    return EPlace(kMisty_falcon);
+}
+
+const EPlace EPlace::misty_glacier()
+{
+    return EPlace(kMisty_glacier);
+}
+
+const EPlace EPlace::misty_harbor()
+{
+    return EPlace(kMisty_harbor);
+}
+
+const EPlace EPlace::misty_island()
+{
+    return EPlace(kMisty_island);
+}
+
+const EPlace EPlace::misty_jungle()
+{
+    return EPlace(kMisty_jungle);
+}
+
+const EPlace EPlace::misty_kernel()
+{
+    return EPlace(kMisty_kernel);
+}
+
+const EPlace EPlace::misty_lagoon()
+{
+    return EPlace(kMisty_lagoon);
+}
+
+const EPlace EPlace::misty_meadow()
+{
+    return EPlace(kMisty_meadow);
+}
+
+const EPlace EPlace::misty_nebula()
+{
+    return EPlace(kMisty_nebula);
+}
+
+const EPlace EPlace::misty_orchard()
+{
+    return EPlace(kMisty_orchard);
+}
+
+const EPlace EPlace::misty_prairie()
+{
+    return EPlace(kMisty_prairie);
+}
+
+const EPlace EPlace::misty_quarry()
+{
+    return EPlace(kMisty_quarry);
+}
+
+const EPlace EPlace::misty_river()
+{
+    return EPlace(kMisty_river);
+}
+
+const EPlace EPlace::misty_summit()
+{
+    return EPlace(kMisty_summit);
+}
+
+const EPlace EPlace::misty_tundra()
+{
+    return EPlace(kMisty_tundra);
+}
+
+const EPlace EPlace::misty_valley()
+{
+    return EPlace(kMisty_valley);
+}
+
+const EPlace EPlace::misty_willow()
+{
+    return EPlace(kMisty_willow);
+}
+
+const EPlace EPlace::misty_yonder()
+{
+    return EPlace(kMisty_yonder);
+}
+
+const EPlace EPlace::misty_zenith()
+{
+    return EPlace(kMisty_zenith);
+}
+
+const EPlace EPlace::noble_anchor()
+{
+    return EPlace(kNoble_anchor);
+}
+
+const EPlace EPlace::noble_bridge()
+{
+    return EPlace(kNoble_bridge);
+}
+
+const EPlace EPlace::noble_canyon()
+{
+    return EPlace(kNoble_canyon);
+}
+
+const EPlace EPlace::noble_delta()
+{
+    return EPlace(kNoble_delta);
+}
+
+const EPlace EPlace::noble_ember()
+{
+    return EPlace(kNoble_ember);
+}
+
+const EPlace EPlace::noble_falcon()
+{
+    return EPlace(kNoble_falcon);
+}
+
+const EPlace EPlace::noble_glacier()
+{
+    return EPlace(kNoble_glacier);
+}
+
+const EPlace EPlace::noble_harbor()
+{
+    return EPlace(kNoble_harbor);
+}
+
+const EPlace EPlace::noble_island()
+{
+    return EPlace(kNoble_island);
+}
+
+const EPlace EPlace::noble_jungle()
+{
+    return EPlace(kNoble_jungle);
+}
+
+const EPlace EPlace::noble_kernel()
+{
+    return EPlace(kNoble_kernel);
+}
+
+const EPlace EPlace::noble_lagoon()
+{
+    return EPlace(kNoble_lagoon);
+}
+
+const EPlace EPlace::noble_meadow()
+{
+    return EPlace(kNoble_meadow);
+}
+
+const EPlace EPlace::noble_nebula()
+{
+    return EPlace(kNoble_nebula);
+}
+
+const EPlace EPlace::noble_orchard()
+{
+    return EPlace(kNoble_orchard);
+}
+
+const EPlace EPlace::noble_prairie()
+{
+    return EPlace(kNoble_prairie);
+}
+
+const EPlace EPlace::noble_quarry()
+{
+    return EPlace(kNoble_quarry);
+}
+
+const EPlace EPlace::noble_river()
+{
+    return EPlace(kNoble_river);
+}
+
+const EPlace EPlace::noble_summit()
+{
+    return EPlace(kNoble_summit);
+}
+
+const EPlace EPlace::noble_tundra()
+{
+    return EPlace(kNoble_tundra);
+}
+
+const EPlace EPlace::noble_valley()
+{
+    return EPlace(kNoble_valley);
+}
+
+const EPlace EPlace::noble_willow()
+{
+    return EPlace(kNoble_willow);
+}
+
+const EPlace EPlace::noble_yonder()
+{
+    return EPlace(kNoble_yonder);
+}
+
+const EPlace EPlace::noble_zenith()
+{
+    return EPlace(kNoble_zenith);
+}
+
+const EPlace EPlace::olive_anchor()
+{
+    return EPlace(kOlive_anchor);
+}
+
+const EPlace EPlace::olive_bridge()
+{
+    return EPlace(kOlive_bridge);
+}
+
+const EPlace EPlace::olive_canyon()
+{
+    return EPlace(kOlive_canyon);
+}
+
+const EPlace EPlace::olive_delta()
+{
+    return EPlace(kOlive_delta);
+}
+
+const EPlace EPlace::olive_ember()
+{
+    return EPlace(kOlive_ember);
+}
+
+const EPlace EPlace::olive_falcon()
+{
+    return EPlace(kOlive_falcon);
+}
+
+const EPlace EPlace::olive_glacier()
+{
+    return EPlace(kOlive_glacier);
+}
+
+const EPlace EPlace::olive_harbor()
+{
+    return EPlace(kOlive_harbor);
+}
+
+const EPlace EPlace::olive_island()
+{
+    return EPlace(kOlive_island);
+}
+
+const EPlace EPlace::olive_jungle()
+{
+    return EPlace(kOlive_jungle);
+}
+
+const EPlace EPlace::olive_kernel()
+{
+    return EPlace(kOlive_kernel);
+}
+
+const EPlace EPlace::olive_lagoon()
+{
+    return EPlace(kOlive_lagoon);
+}
+
+const EPlace EPlace::olive_meadow()
+{
+    return EPlace(kOlive_meadow);
+}
+
+const EPlace EPlace::olive_nebula()
+{
+    return EPlace(kOlive_nebula);
+}
+
+const EPlace EPlace::olive_orchard()
+{
+    return EPlace(kOlive_orchard);
+}
+
+const EPlace EPlace::olive_prairie()
+{
+    return EPlace(kOlive_prairie);
+}
+
+const EPlace EPlace::olive_quarry()
+{
+    return EPlace(kOlive_quarry);
+}
+
+const EPlace EPlace::olive_river()
+{
+    return EPlace(kOlive_river);
+}
+
+const EPlace EPlace::olive_summit()
+{
+    return EPlace(kOlive_summit);
+}
+
+const EPlace EPlace::olive_tundra()
+{
+    return EPlace(kOlive_tundra);
+}
+
+const EPlace EPlace::olive_valley()
+{
+    return EPlace(kOlive_valley);
+}
+
+const EPlace EPlace::olive_willow()
+{
+    return EPlace(kOlive_willow);
+}
+
+const EPlace EPlace::olive_yonder()
+{
+    return EPlace(kOlive_yonder);
+}
+
+const EPlace EPlace::olive_zenith()
+{
+    return EPlace(kOlive_zenith);
+}
+
+const EPlace EPlace::prime_anchor()
+{
+    return EPlace(kPrime_anchor);
+}
+
+const EPlace EPlace::prime_bridge()
+{
+    return EPlace(kPrime_bridge);
+}
+
+const EPlace EPlace::prime_canyon()
+{
+    return EPlace(kPrime_canyon);
+}
+
+const EPlace EPlace::prime_delta()
+{
+    return EPlace(kPrime_delta);
+}
+
+const EPlace EPlace::prime_ember()
+{
+    return EPlace(kPrime_ember);
+}
+
+const EPlace EPlace::prime_falcon()
+{
+    return EPlace(kPrime_falcon);
+}
+
+const EPlace EPlace::prime_glacier()
+{
+    return EPlace(kPrime_glacier);
+}
+
+const EPlace EPlace::prime_harbor()
+{
+    return EPlace(kPrime_harbor);
+}
+
+const EPlace EPlace::prime_island()
+{
+    return EPlace(kPrime_island);
+}
+
+const EPlace EPlace::prime_jungle()
+{
+    return EPlace(kPrime_jungle);
+}
+
+const EPlace EPlace::prime_kernel()
+{
+    return EPlace(kPrime_kernel);
+}
+
+const EPlace EPlace::prime_lagoon()
+{
+    return EPlace(kPrime_lagoon);
+}
+
+const EPlace EPlace::prime_meadow()
+{
+    return EPlace(kPrime_meadow);
+}
+
+const EPlace EPlace::prime_nebula()
+{
+    return EPlace(kPrime_nebula);
+}
+
+const EPlace EPlace::prime_orchard()
+{
+    return EPlace(kPrime_orchard);
+}
+
+const EPlace EPlace::prime_prairie()
+{
+    return EPlace(kPrime_prairie);
+}
+
+const EPlace EPlace::prime_quarry()
+{
+    return EPlace(kPrime_quarry);
+}
+
+const EPlace EPlace::prime_river()
+{
+    return EPlace(kPrime_river);
+}
+
+const EPlace EPlace::prime_summit()
+{
+    return EPlace(kPrime_summit);
+}
+
+const EPlace EPlace::prime_tundra()
+{
+    return EPlace(kPrime_tundra);
+}
+
+const EPlace EPlace::prime_valley()
+{
+    return EPlace(kPrime_valley);
+}
+
+const EPlace EPlace::prime_willow()
+{
+    return EPlace(kPrime_willow);
+}
+
+const EPlace EPlace::prime_yonder()
+{
+    return EPlace(kPrime_yonder);
+}
+
+const EPlace EPlace::prime_zenith()
+{
+    return EPlace(kPrime_zenith);
+}
+
+const EPlace EPlace::quiet_anchor()
+{
+    return EPlace(kQuiet_anchor);
+}
+
+const EPlace EPlace::quiet_bridge()
+{
+    return EPlace(kQuiet_bridge);
+}
+
+const EPlace EPlace::quiet_canyon()
+{
+    return EPlace(kQuiet_canyon);
+}
+
+const EPlace EPlace::quiet_delta()
+{
+    return EPlace(kQuiet_delta);
+}
+
+const EPlace EPlace::quiet_ember()
+{
+    return EPlace(kQuiet_ember);
+}
+
+const EPlace EPlace::quiet_falcon()
+{
+    return EPlace(kQuiet_falcon);
+}
+
+const EPlace EPlace::quiet_glacier()
+{
+    return EPlace(kQuiet_glacier);
+}
+
+const EPlace EPlace::quiet_harbor()
+{
+    return EPlace(kQuiet_harbor);
+}
+
+const EPlace EPlace::quiet_island()
+{
+    return EPlace(kQuiet_island);
+}
+
+const EPlace EPlace::quiet_jungle()
+{
+    return EPlace(kQuiet_jungle);
+}
+
+const EPlace EPlace::quiet_kernel()
+{
+    return EPlace(kQuiet_kernel);
+}
+
+const EPlace EPlace::quiet_lagoon()
+{
+    return EPlace(kQuiet_lagoon);
+}
+
+const EPlace EPlace::quiet_meadow()
+{
+    return EPlace(kQuiet_meadow);
+}
+
+const EPlace EPlace::quiet_nebula()
+{
+    return EPlace(kQuiet_nebula);
+}
+
+const EPlace EPlace::quiet_orchard()
+{
+    return EPlace(kQuiet_orchard);
+}
+
+const EPlace EPlace::quiet_prairie()
+{
+    return EPlace(kQuiet_prairie);
+}
+
+const EPlace EPlace::quiet_quarry()
+{
+    return EPlace(kQuiet_quarry);
+}
+
+const EPlace EPlace::quiet_river()
+{
+    return EPlace(kQuiet_river);
+}
+
+const EPlace EPlace::quiet_summit()
+{
+    return EPlace(kQuiet_summit);
+}
+
+const EPlace EPlace::quiet_tundra()
+{
+    return EPlace(kQuiet_tundra);
+}
+
+const EPlace EPlace::quiet_valley()
+{
+    return EPlace(kQuiet_valley);
+}
+
+const EPlace EPlace::quiet_willow()
+{
+    return EPlace(kQuiet_willow);
+}
+
+const EPlace EPlace::quiet_yonder()
+{
+    return EPlace(kQuiet_yonder);
+}
+
+const EPlace EPlace::quiet_zenith()
+{
+    return EPlace(kQuiet_zenith);
+}
+
+const EPlace EPlace::rapid_anchor()
+{
+    return EPlace(kRapid_anchor);
+}
+
+const EPlace EPlace::rapid_bridge()
+{
+    return EPlace(kRapid_bridge);
+}
+
+const EPlace EPlace::rapid_canyon()
+{
+    return EPlace(kRapid_canyon);
+}
+
+const EPlace EPlace::rapid_delta()
+{
+    return EPlace(kRapid_delta);
+}
+
+const EPlace EPlace::rapid_ember()
+{
+    return EPlace(kRapid_ember);
+}
+
+const EPlace EPlace::rapid_falcon()
+{
+    return EPlace(kRapid_falcon);
+}
+
+const EPlace EPlace::rapid_glacier()
+{
+    return EPlace(kRapid_glacier);
+}
+
+const EPlace EPlace::rapid_harbor()
+{
+    return EPlace(kRapid_harbor);
+}
+
+const EPlace EPlace::rapid_island()
+{
+    return EPlace(kRapid_island);
+}
+
+const EPlace EPlace::rapid_jungle()
+{
+    return EPlace(kRapid_jungle);
+}
+
+const EPlace EPlace::rapid_kernel()
+{
+    return EPlace(kRapid_kernel);
+}
+
+const EPlace EPlace::rapid_lagoon()
+{
+    return EPlace(kRapid_lagoon);
+}
+
+const EPlace EPlace::rapid_meadow()
+{
+    return EPlace(kRapid_meadow);
+}
+
+const EPlace EPlace::rapid_nebula()
+{
+    return EPlace(kRapid_nebula);
+}
+
+const EPlace EPlace::rapid_orchard()
+{
+    return EPlace(kRapid_orchard);
+}
+
+const EPlace EPlace::rapid_prairie()
+{
+    return EPlace(kRapid_prairie);
+}
+
+const EPlace EPlace::rapid_quarry()
+{
+    return EPlace(kRapid_quarry);
+}
+
+const EPlace EPlace::rapid_river()
+{
+    return EPlace(kRapid_river);
+}
+
+const EPlace EPlace::rapid_summit()
+{
+    return EPlace(kRapid_summit);
+}
+
+const EPlace EPlace::rapid_tundra()
+{
+    return EPlace(kRapid_tundra);
+}
+
+const EPlace EPlace::rapid_valley()
+{
+    return EPlace(kRapid_valley);
+}
+
+const EPlace EPlace::rapid_willow()
+{
+    return EPlace(kRapid_willow);
+}
+
+const EPlace EPlace::rapid_yonder()
+{
+    return EPlace(kRapid_yonder);
+}
+
+const EPlace EPlace::rapid_zenith()
+{
+    return EPlace(kRapid_zenith);
+}
+
+const EPlace EPlace::solar_anchor()
+{
+    return EPlace(kSolar_anchor);
+}
+
+const EPlace EPlace::solar_bridge()
+{
+    return EPlace(kSolar_bridge);
+}
+
+const EPlace EPlace::solar_canyon()
+{
+    return EPlace(kSolar_canyon);
+}
+
+const EPlace EPlace::solar_delta()
+{
+    return EPlace(kSolar_delta);
+}
+
+const EPlace EPlace::solar_ember()
+{
+    return EPlace(kSolar_ember);
+}
+
+const EPlace EPlace::solar_falcon()
+{
+    return EPlace(kSolar_falcon);
+}
+
+const EPlace EPlace::solar_glacier()
+{
+    return EPlace(kSolar_glacier);
+}
+
+const EPlace EPlace::solar_harbor()
+{
+    return EPlace(kSolar_harbor);
+}
+
+const EPlace EPlace::solar_island()
+{
+    return EPlace(kSolar_island);
+}
+
+const EPlace EPlace::solar_jungle()
+{
+    return EPlace(kSolar_jungle);
+}
+
+const EPlace EPlace::solar_kernel()
+{
+    return EPlace(kSolar_kernel);
+}
+
+const EPlace EPlace::solar_lagoon()
+{
+    return EPlace(kSolar_lagoon);
+}
+
+const EPlace EPlace::solar_meadow()
+{
+    return EPlace(kSolar_meadow);
+}
+
+const EPlace EPlace::solar_nebula()
+{
+    return EPlace(kSolar_nebula);
+}
+
+const EPlace EPlace::solar_orchard()
+{
+    return EPlace(kSolar_orchard);
+}
+
+const EPlace EPlace::solar_prairie()
+{
+    return EPlace(kSolar_prairie);
+}
+
+const EPlace EPlace::solar_quarry()
+{
+    return EPlace(kSolar_quarry);
+}
+
+const EPlace EPlace::solar_river()
+{
+    return EPlace(kSolar_river);
+}
+
+const EPlace EPlace::solar_summit()
+{
+    return EPlace(kSolar_summit);
+}
+
+const EPlace EPlace::solar_tundra()
+{
+    return EPlace(kSolar_tundra);
+}
+
+const EPlace EPlace::solar_valley()
+{
+    return EPlace(kSolar_valley);
+}
+
+const EPlace EPlace::solar_willow()
+{
+    return EPlace(kSolar_willow);
+}
+
+const EPlace EPlace::solar_yonder()
+{
+    return EPlace(kSolar_yonder);
+}
+
+const EPlace EPlace::solar_zenith()
+{
+    return EPlace(kSolar_zenith);
+}
+
+const EPlace EPlace::tidal_anchor()
+{
+    return EPlace(kTidal_anchor);
+}
+
+const EPlace EPlace::tidal_bridge()
+{
+    return EPlace(kTidal_bridge);
+}
+
+const EPlace EPlace::tidal_canyon()
+{
+    return EPlace(kTidal_canyon);
+}
+
+const EPlace EPlace::tidal_delta()
+{
+    return EPlace(kTidal_delta);
+}
+
+const EPlace EPlace::tidal_ember()
+{
+    return EPlace(kTidal_ember);
+}
+
+const EPlace EPlace::tidal_falcon()
+{
+    return EPlace(kTidal_falcon);
+}
+
+const EPlace EPlace::tidal_glacier()
+{
+    return EPlace(kTidal_glacier);
+}
+
+const EPlace EPlace::tidal_harbor()
+{
+    return EPlace(kTidal_harbor);
+}
+
+const EPlace EPlace::tidal_island()
+{
+    return EPlace(kTidal_island);
+}
+
+const EPlace EPlace::tidal_jungle()
+{
+    return EPlace(kTidal_jungle);
+}
+
+const EPlace EPlace::tidal_kernel()
+{
+    return EPlace(kTidal_kernel);
+}
+
+const EPlace EPlace::tidal_lagoon()
+{
+    return EPlace(kTidal_lagoon);
+}
+
+const EPlace EPlace::tidal_meadow()
+{
+    return EPlace(kTidal_meadow);
+}
+
+const EPlace EPlace::tidal_nebula()
+{
+    return EPlace(kTidal_nebula);
+}
+
+const EPlace EPlace::tidal_orchard()
+{
+    return EPlace(kTidal_orchard);
+}
+
+const EPlace EPlace::tidal_prairie()
+{
+    return EPlace(kTidal_prairie);
+}
+
+const EPlace EPlace::tidal_quarry()
+{
+    return EPlace(kTidal_quarry);
+}
+
+const EPlace EPlace::tidal_river()
+{
+    return EPlace(kTidal_river);
+}
+
+const EPlace EPlace::tidal_summit()
+{
+    return EPlace(kTidal_summit);
+}
+
+const EPlace EPlace::tidal_tundra()
+{
+    return EPlace(kTidal_tundra);
+}
+
+const EPlace EPlace::tidal_valley()
+{
+    return EPlace(kTidal_valley);
+}
+
+const EPlace EPlace::tidal_willow()
+{
+    return EPlace(kTidal_willow);
+}
+
+const EPlace EPlace::tidal_yonder()
+{
+    return EPlace(kTidal_yonder);
+}
+
+const EPlace EPlace::tidal_zenith()
+{
+    return EPlace(kTidal_zenith);
+}
+
+const EPlace EPlace::urban_anchor()
+{
+    return EPlace(kUrban_anchor);
+}
+
+const EPlace EPlace::urban_bridge()
+{
+    return EPlace(kUrban_bridge);
+}
+
+const EPlace EPlace::urban_canyon()
+{
+    return EPlace(kUrban_canyon);
+}
+
+const EPlace EPlace::urban_delta()
+{
+    return EPlace(kUrban_delta);
+}
+
+const EPlace EPlace::urban_ember()
+{
+    return EPlace(kUrban_ember);
+}
+
+const EPlace EPlace::urban_falcon()
+{
+    return EPlace(kUrban_falcon);
+}
+
+const EPlace EPlace::urban_glacier()
+{
+    return EPlace(kUrban_glacier);
+}
+
+const EPlace EPlace::urban_harbor()
+{
+    return EPlace(kUrban_harbor);
+}
+
+const EPlace EPlace::urban_island()
+{
+    return EPlace(kUrban_island);
+}
+
+const EPlace EPlace::urban_jungle()
+{
+    return EPlace(kUrban_jungle);
+}
+
+const EPlace EPlace::urban_kernel()
+{
+    return EPlace(kUrban_kernel);
+}
+
+const EPlace EPlace::urban_lagoon()
+{
+    return EPlace(kUrban_lagoon);
+}
+
+const EPlace EPlace::urban_meadow()
+{
+    return EPlace(kUrban_meadow);
+}
+
+const EPlace EPlace::urban_nebula()
+{
+    return EPlace(kUrban_nebula);
+}
+
+const EPlace EPlace::urban_orchard()
+{
+    return EPlace(kUrban_orchard);
+}
+
+const EPlace EPlace::urban_prairie()
+{
+    return EPlace(kUrban_prairie);
+}
+
+const EPlace EPlace::urban_quarry()
+{
+    return EPlace(kUrban_quarry);
+}
+
+const EPlace EPlace::urban_river()
+{
+    return EPlace(kUrban_river);
+}
+
+const EPlace EPlace::urban_summit()
+{
+    return EPlace(kUrban_summit);
+}
+
+const EPlace EPlace::urban_tundra()
+{
+    return EPlace(kUrban_tundra);
+}
+
+const EPlace EPlace::urban_valley()
+{
+    return EPlace(kUrban_valley);
+}
+
+const EPlace EPlace::urban_willow()
+{
+    return EPlace(kUrban_willow);
+}
+
+const EPlace EPlace::urban_yonder()
+{
+    return EPlace(kUrban_yonder);
+}
+
+const EPlace EPlace::urban_zenith()
+{
+    return EPlace(kUrban_zenith);
+}
+
+const EPlace EPlace::vivid_anchor()
+{
+    return EPlace(kVivid_anchor);
+}
+
+const EPlace EPlace::vivid_bridge()
+{
+    return EPlace(kVivid_bridge);
+}
+
+const EPlace EPlace::vivid_canyon()
+{
+    return EPlace(kVivid_canyon);
+}
+
+const EPlace EPlace::vivid_delta()
+{
+    return EPlace(kVivid_delta);
+}
+
+const EPlace EPlace::vivid_ember()
+{
+    return EPlace(kVivid_ember);
+}
+
+const EPlace EPlace::vivid_falcon()
+{
+    return EPlace(kVivid_falcon);
+}
+
+const EPlace EPlace::vivid_glacier()
+{
+    return EPlace(kVivid_glacier);
+}
+
+const EPlace EPlace::vivid_harbor()
+{
+    return EPlace(kVivid_harbor);
+}
+
+const EPlace EPlace::vivid_island()
+{
+    return EPlace(kVivid_island);
+}
+
+const EPlace EPlace::vivid_jungle()
+{
+    return EPlace(kVivid_jungle);
+}
+
+const EPlace EPlace::vivid_kernel()
+{
+    return EPlace(kVivid_kernel);
+}
+
+const EPlace EPlace::vivid_lagoon()
+{
+    return EPlace(kVivid_lagoon);
+}
+
+const EPlace EPlace::vivid_meadow()
+{
+    return EPlace(kVivid_meadow);
+}
+
+const EPlace EPlace::vivid_nebula()
+{
+    return EPlace(kVivid_nebula);
+}
+
+const EPlace EPlace::vivid_orchard()
+{
+    return EPlace(kVivid_orchard);
+}
+
+const EPlace EPlace::vivid_prairie()
+{
+    return EPlace(kVivid_prairie);
+}
+
+const EPlace EPlace::vivid_quarry()
+{
+    return EPlace(kVivid_quarry);
+}
+
+const EPlace EPlace::vivid_river()
+{
+    return EPlace(kVivid_river);
+}
+
+const EPlace EPlace::vivid_summit()
+{
+    return EPlace(kVivid_summit);
+}
+
+const EPlace EPlace::vivid_tundra()
+{
+    return EPlace(kVivid_tundra);
+}
+
+const EPlace EPlace::vivid_valley()
+{
+    return EPlace(kVivid_valley);
+}
+
+const EPlace EPlace::vivid_willow()
+{
+    return EPlace(kVivid_willow);
+}
+
+const EPlace EPlace::vivid_yonder()
+{
+    return EPlace(kVivid_yonder);
+}
+
+const EPlace EPlace::vivid_zenith()
+{
+    return EPlace(kVivid_zenith);
+}
+
+const EPlace EPlace::windy_anchor()
+{
+    return EPlace(kWindy_anchor);
+}
+
+const EPlace EPlace::windy_bridge()
+{
+    return EPlace(kWindy_bridge);
+}
+
+const EPlace EPlace::windy_canyon()
+{
+    return EPlace(kWindy_canyon);
+}
+
+const EPlace EPlace::windy_delta()
+{
+    return EPlace(kWindy_delta);
+}
+
+const EPlace EPlace::windy_ember()
+{
+    return EPlace(kWindy_ember);
+}
+
+const EPlace EPlace::windy_falcon()
+{
+    return EPlace(kWindy_falcon);
+}
+
+const EPlace EPlace::windy_glacier()
+{
+    return EPlace(kWindy_glacier);
+}
+
+const EPlace EPlace::windy_harbor()
+{
+    return EPlace(kWindy_harbor);
+}
+
+const EPlace EPlace::windy_island()
+{
+    return EPlace(kWindy_island);
+}
+
+const EPlace EPlace::windy_jungle()
+{
+    return EPlace(kWindy_jungle);
+}
+
+const EPlace EPlace::windy_kernel()
+{
+    return EPlace(kWindy_kernel);
+}
+
+const EPlace EPlace::windy_lagoon()
+{
+    return EPlace(kWindy_lagoon);
+}
+
+const EPlace EPlace::windy_meadow()
+{
+    return EPlace(kWindy_meadow);
+}
+
+const EPlace EPlace::windy_nebula()
+{
+    return EPlace(kWindy_nebula);
+}
+
+const EPlace EPlace::windy_orchard()
+{
+    return EPlace(kWindy_orchard);
+}
+
+const EPlace EPlace::windy_prairie()
+{
+    return EPlace(kWindy_prairie);
+}
+
+const EPlace EPlace::windy_quarry()
+{
+    return EPlace(kWindy_quarry);
+}
+
+const EPlace EPlace::windy_river()
+{
+    return EPlace(kWindy_river);
+}
+
+const EPlace EPlace::windy_summit()
+{
+    return EPlace(kWindy_summit);
+}
+
+const EPlace EPlace::windy_tundra()
+{
+    return EPlace(kWindy_tundra);
+}
+
+const EPlace EPlace::windy_valley()
+{
+    return EPlace(kWindy_valley);
+}
+
+const EPlace EPlace::windy_willow()
+{
+    return EPlace(kWindy_willow);
+}
+
+const EPlace EPlace::windy_yonder()
+{
+    return EPlace(kWindy_yonder);
+}
+
+const EPlace EPlace::windy_zenith()
+{
+    return EPlace(kWindy_zenith);
+}
+
+const EPlace EPlace::young_anchor()
+{
+    return EPlace(kYoung_anchor);
+}
+
+const EPlace EPlace::young_bridge()
+{
+    return EPlace(kYoung_bridge);
+}
+
+const EPlace EPlace::young_canyon()
+{
+    return EPlace(kYoung_canyon);
+}
+
+const EPlace EPlace::young_delta()
+{
+    return EPlace(kYoung_delta);
+}
+
+const EPlace EPlace::young_ember()
+{
+    return EPlace(kYoung_ember);
+}
+
+const EPlace EPlace::young_falcon()
+{
+    return EPlace(kYoung_falcon);
+}
+
+const EPlace EPlace::young_glacier()
+{
+    return EPlace(kYoung_glacier);
+}
+
+const EPlace EPlace::young_harbor()
+{
+    return EPlace(kYoung_harbor);
+}
+
+const EPlace EPlace::young_island()
+{
+    return EPlace(kYoung_island);
+}
+
+const EPlace EPlace::young_jungle()
+{
+    return EPlace(kYoung_jungle);
+}
+
+const EPlace EPlace::young_kernel()
+{
+    return EPlace(kYoung_kernel);
+}
+
+const EPlace EPlace::young_lagoon()
+{
+    return EPlace(kYoung_lagoon);
+}
+
+const EPlace EPlace::young_meadow()
+{
+    return EPlace(kYoung_meadow);
+}
+
+const EPlace EPlace::young_nebula()
+{
+    return EPlace(kYoung_nebula);
+}
+
+const EPlace EPlace::young_orchard()
+{
+    return EPlace(kYoung_orchard);
+}
+
+const EPlace EPlace::young_prairie()
+{
+    return EPlace(kYoung_prairie);
+}
+
+const EPlace EPlace::young_quarry()
+{
+    return EPlace(kYoung_quarry);
+}
+
+const EPlace EPlace::young_river()
+{
+    return EPlace(kYoung_river);
+}
+
+const EPlace EPlace::young_summit()
+{
+    return EPlace(kYoung_summit);
+}
+
+const EPlace EPlace::young_tundra()
+{
+    return EPlace(kYoung_tundra);
+}
+
+const EPlace EPlace::young_valley()
+{
+    return EPlace(kYoung_valley);
+}
+
+const EPlace EPlace::young_willow()
+{
+    return EPlace(kYoung_willow);
+}
+
+const EPlace EPlace::young_yonder()
+{
+    return EPlace(kYoung_yonder);
+}
+
+const EPlace EPlace::young_zenith()
+{
+    return EPlace(kYoung_zenith);
+}
+
+const EPlace EPlace::zonal_anchor()
+{
+    return EPlace(kZonal_anchor);
+}
+
+const EPlace EPlace::zonal_bridge()
+{
+    return EPlace(kZonal_bridge);
+}
+
+const EPlace EPlace::zonal_canyon()
+{
+    return EPlace(kZonal_canyon);
+}
+
+const EPlace EPlace::zonal_delta()
+{
+    return EPlace(kZonal_delta);
+}
+
+const EPlace EPlace::zonal_ember()
+{
+    return EPlace(kZonal_ember);
+}
+
+const EPlace EPlace::zonal_falcon()
+{
+    return EPlace(kZonal_falcon);
+}
+
+const EPlace EPlace::zonal_glacier()
+{
+    return EPlace(kZonal_glacier);
+}
+
+const EPlace EPlace::zonal_harbor()
+{
+    return EPlace(kZonal_harbor);
+}
+
+const EPlace EPlace::zonal_island()
+{
+    return EPlace(kZonal_island);
+}
+
+const EPlace EPlace::zonal_jungle()
+{
+    return EPlace(kZonal_jungle);
+}
+
+const EPlace EPlace::zonal_kernel()
+{
+    return EPlace(kZonal_kernel);
+}
+
+const EPlace EPlace::zonal_lagoon()
+{
+    return EPlace(kZonal_lagoon);
+}
+
+const EPlace EPlace::zonal_meadow()
+{
+    return EPlace(kZonal_meadow);
+}
+
+const EPlace EPlace::zonal_nebula()
+{
+    return EPlace(kZonal_nebula);
+}
+
+const EPlace EPlace::zonal_orchard()
+{
+    return EPlace(kZonal_orchard);
+}
+
+const EPlace EPlace::zonal_prairie()
+{
+    return EPlace(kZonal_prairie);
+}
+
+const EPlace EPlace::zonal_quarry()
+{
+    return EPlace(kZonal_quarry);
+}
+
+const EPlace EPlace::zonal_river()
+{
+    return EPlace(kZonal_river);
+}
+
+const EPlace EPlace::zonal_summit()
+{
+    return EPlace(kZonal_summit);
+}
+
+const EPlace EPlace::zonal_tundra()
+{
+    return EPlace(kZonal_tundra);
+}
+
+const EPlace EPlace::zonal_valley()
+{
+    return EPlace(kZonal_valley);
+}
+
+const EPlace EPlace::zonal_willow()
+{
+    return EPlace(kZonal_willow);
+}
+
+const EPlace EPlace::zonal_yonder()
+{
+    return EPlace(kZonal_yonder);
+}
+
+const EPlace EPlace::zonal_zenith()
+{
+    return EPlace(kZonal_zenith);
+}
+
+long EPlace::value() const
+{
+    return mValue;
+}
+
+const char* EPlace::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "amber_anchor",
+        "amber_bridge",
+        "amber_canyon",
+        "amber_delta",
+        "amber_ember",
+        "amber_falcon",
+        "amber_glacier",
+        "amber_harbor",
+        "amber_island",
+        "amber_jungle",
+        "amber_kernel",
+        "amber_lagoon",
+        "amber_meadow",
+        "amber_nebula",
+        "amber_orchard",
+        "amber_prairie",
+        "amber_quarry",
+        "amber_river",
+        "amber_summit",
+        "amber_tundra",
+        "amber_valley",
+        "amber_willow",
+        "amber_yonder",
+        "amber_zenith",
+        "brisk_anchor",
+        "brisk_bridge",
+        "brisk_canyon",
+        "brisk_delta",
+        "brisk_ember",
+        "brisk_falcon",
+        "brisk_glacier",
+        "brisk_harbor",
+        "brisk_island",
+        "brisk_jungle",
+        "brisk_kernel",
+        "brisk_lagoon",
+        "brisk_meadow",
+        "brisk_nebula",
+        "brisk_orchard",
+        "brisk_prairie",
+        "brisk_quarry",
+        "brisk_river",
+        "brisk_summit",
+        "brisk_tundra",
+        "brisk_valley",
+        "brisk_willow",
+        "brisk_yonder",
+        "brisk_zenith",
+        "coral_anchor",
+        "coral_bridge",
+        "coral_canyon",
+        "coral_delta",
+        "coral_ember",
+        "coral_falcon",
+        "coral_glacier",
+        "coral_harbor",
+        "coral_island",
+        "coral_jungle",
+        "coral_kernel",
+        "coral_lagoon",
+        "coral_meadow",
+        "coral_nebula",
+        "coral_orchard",
+        "coral_prairie",
+        "coral_quarry",
+        "coral_river",
+        "coral_summit",
+        "coral_tundra",
+        "coral_valley",
+        "coral_willow",
+        "coral_yonder",
+        "coral_zenith",
+        "dusty_anchor",
+        "dusty_bridge",
+        "dusty_canyon",
+        "dusty_delta",
+        "dusty_ember",
+        "dusty_falcon",
+        "dusty_glacier",
+        "dusty_harbor",
+        "dusty_island",
+        "dusty_jungle",
+        "dusty_kernel",
+        "dusty_lagoon",
+        "dusty_meadow",
+        "dusty_nebula",
+        "dusty_orchard",
+        "dusty_prairie",
+        "dusty_quarry",
+        "dusty_river",
+        "dusty_summit",
+        "dusty_tundra",
+        "dusty_valley",
+        "dusty_willow",
+        "dusty_yonder",
+        "dusty_zenith",
+        "early_anchor",
+        "early_bridge",
+        "early_canyon",
+        "early_delta",
+        "early_ember",
+        "early_falcon",
+        "early_glacier",
+        "early_harbor",
+        "early_island",
+        "early_jungle",
+        "early_kernel",
+        "early_lagoon",
+        "early_meadow",
+        "early_nebula",
+        "early_orchard",
+        "early_prairie",
+        "early_quarry",
+        "early_river",
+        "early_summit",
+        "early_tundra",
+        "early_valley",
+        "early_willow",
+        "early_yonder",
+        "early_zenith",
+        "faint_anchor",
+        "faint_bridge",
+        "faint_canyon",
+        "faint_delta",
+        "faint_ember",
+        "faint_falcon",
+        "faint_glacier",
+        "faint_harbor",
+        "faint_island",
+        "faint_jungle",
+        "faint_kernel",
+        "faint_lagoon",
+        "faint_meadow",
+        "faint_nebula",
+        "faint_orchard",
+        "faint_prairie",
+        "faint_quarry",
+        "faint_river",
+        "faint_summit",
+        "faint_tundra",
+        "faint_valley",
+        "faint_willow",
+        "faint_yonder",
+        "faint_zenith",
+        "giant_anchor",
+        "giant_bridge",
+        "giant_canyon",
+        "giant_delta",
+        "giant_ember",
+        "giant_falcon",
+        "giant_glacier",
+        "giant_harbor",
+        "giant_island",
+        "giant_jungle",
+        "giant_kernel",
+        "giant_lagoon",
+        "giant_meadow",
+        "giant_nebula",
+        "giant_orchard",
+        "giant_prairie",
+        "giant_quarry",
+        "giant_river",
+        "giant_summit",
+        "giant_tundra",
+        "giant_valley",
+        "giant_willow",
+        "giant_yonder",
+        "giant_zenith",
+        "hollow_anchor",
+        "hollow_bridge",
+        "hollow_canyon",
+        "hollow_delta",
+        "hollow_ember",
+        "hollow_falcon",
+        "hollow_glacier",
+        "hollow_harbor",
+        "hollow_island",
+        "hollow_jungle",
+        "hollow_kernel",
+        "hollow_lagoon",
+        "hollow_meadow",
+        "hollow_nebula",
+        "hollow_orchard",
+        "hollow_prairie",
+        "hollow_quarry",
+        "hollow_river",
+        "hollow_summit",
+        "hollow_tundra",
+        "hollow_valley",
+        "hollow_willow",
+        "hollow_yonder",
+        "hollow_zenith",
+        "ivory_anchor",
+        "ivory_bridge",
+        "ivory_canyon",
+        "ivory_delta",
+        "ivory_ember",
+        "ivory_falcon",
+        "ivory_glacier",
+        "ivory_harbor",
+        "ivory_island",
+        "ivory_jungle",
+        "ivory_kernel",
+        "ivory_lagoon",
+        "ivory_meadow",
+        "ivory_nebula",
+        "ivory_orchard",
+        "ivory_prairie",
+        "ivory_quarry",
+        "ivory_river",
+        "ivory_summit",
+        "ivory_tundra",
+        "ivory_valley",
+        "ivory_willow",
+        "ivory_yonder",
+        "ivory_zenith",
+        "jolly_anchor",
+        "jolly_bridge",
+        "jolly_canyon",
+        "jolly_delta",
+        "jolly_ember",
+        "jolly_falcon",
+        "jolly_glacier",
+        "jolly_harbor",
+        "jolly_island",
+        "jolly_jungle",
+        "jolly_kernel",
+        "jolly_lagoon",
+        "jolly_meadow",
+        "jolly_nebula",
+        "jolly_orchard",
+        "jolly_prairie",
+        "jolly_quarry",
+        "jolly_river",
+        "jolly_summit",
+        "jolly_tundra",
+        "jolly_valley",
+        "jolly_willow",
+        "jolly_yonder",
+        "jolly_zenith",
+        "keen_anchor",
+        "keen_bridge",
+        "keen_canyon",
+        "keen_delta",
+        "keen_ember",
+        "keen_falcon",
+        "keen_glacier",
+        "keen_harbor",
+        "keen_island",
+        "keen_jungle",
+        "keen_kernel",
+        "keen_lagoon",
+        "keen_meadow",
+        "keen_nebula",
+        "keen_orchard",
+        "keen_prairie",
+        "keen_quarry",
+        "keen_river",
+        "keen_summit",
+        "keen_tundra",
+        "keen_valley",
+        "keen_willow",
+        "keen_yonder",
+        "keen_zenith",
+        "lunar_anchor",
+        "lunar_bridge",
+        "lunar_canyon",
+        "lunar_delta",
+        "lunar_ember",
+        "lunar_falcon",
+        "lunar_glacier",
+        "lunar_harbor",
+        "lunar_island",
+        "lunar_jungle",
+        "lunar_kernel",
+        "lunar_lagoon",
+        "lunar_meadow",
+        "lunar_nebula",
+        "lunar_orchard",
+        "lunar_prairie",
+        "lunar_quarry",
+        "lunar_river",
+        "lunar_summit",
+        "lunar_tundra",
+        "lunar_valley",
+        "lunar_willow",
+        "lunar_yonder",
+        "lunar_zenith",
+        "misty_anchor",
+        "misty_bridge",
+        "misty_canyon",
+        "misty_delta",
+        "misty_ember",
+        "misty_falcon",
+        "misty_glacier",
+        "misty_harbor",
+        "misty_island",
+        "misty_jungle",
+        "misty_kernel",
+        "misty_lagoon",
+        "misty_meadow",
+        "misty_nebula",
+        "misty_orchard",
+        "misty_prairie",
+        "misty_quarry",
+        "misty_river",
+        "misty_summit",
+        "misty_tundra",
+        "misty_valley",
+        "misty_willow",
+        "misty_yonder",
+        "misty_zenith",
+        "noble_anchor",
+        "noble_bridge",
+        "noble_canyon",
+        "noble_delta",
+        "noble_ember",
+        "noble_falcon",
+        "noble_glacier",
+        "noble_harbor",
+        "noble_island",
+        "noble_jungle",
+        "noble_kernel",
+        "noble_lagoon",
+        "noble_meadow",
+        "noble_nebula",
+        "noble_orchard",
+        "noble_prairie",
+        "noble_quarry",
+        "noble_river",
+        "noble_summit",
+        "noble_tundra",
+        "noble_valley",
+        "noble_willow",
+        "noble_yonder",
+        "noble_zenith",
+        "olive_anchor",
+        "olive_bridge",
+        "olive_canyon",
+        "olive_delta",
+        "olive_ember",
+        "olive_falcon",
+        "olive_glacier",
+        "olive_harbor",
+        "olive_island",
+        "olive_jungle",
+        "olive_kernel",
+        "olive_lagoon",
+        "olive_meadow",
+        "olive_nebula",
+        "olive_orchard",
+        "olive_prairie",
+        "olive_quarry",
+        "olive_river",
+        "olive_summit",
+        "olive_tundra",
+        "olive_valley",
+        "olive_willow",
+        "olive_yonder",
+        "olive_zenith",
+        "prime_anchor",
+        "prime_bridge",
+        "prime_canyon",
+        "prime_delta",
+        "prime_ember",
+        "prime_falcon",
+        "prime_glacier",
+        "prime_harbor",
+        "prime_island",
+        "prime_jungle",
+        "prime_kernel",
+        "prime_lagoon",
+        "prime_meadow",
+        "prime_nebula",
+        "prime_orchard",
+        "prime_prairie",
+        "prime_quarry",
+        "prime_river",
+        "prime_summit",
+        "prime_tundra",
+        "prime_valley",
+        "prime_willow",
+        "prime_yonder",
+        "prime_zenith",
+        "quiet_anchor",
+        "quiet_bridge",
+        "quiet_canyon",
+        "quiet_delta",
+        "quiet_ember",
+        "quiet_falcon",
+        "quiet_glacier",
+        "quiet_harbor",
+        "quiet_island",
+        "quiet_jungle",
+        "quiet_kernel",
+        "quiet_lagoon",
+        "quiet_meadow",
+        "quiet_nebula",
+        "quiet_orchard",
+        "quiet_prairie",
+        "quiet_quarry",
+        "quiet_river",
+        "quiet_summit",
+        "quiet_tundra",
+        "quiet_valley",
+        "quiet_willow",
+        "quiet_yonder",
+        "quiet_zenith",
+        "rapid_anchor",
+        "rapid_bridge",
+        "rapid_canyon",
+        "rapid_delta",
+        "rapid_ember",
+        "rapid_falcon",
+        "rapid_glacier",
+        "rapid_harbor",
+        "rapid_island",
+        "rapid_jungle",
+        "rapid_kernel",
+        "rapid_lagoon",
+        "rapid_meadow",
+        "rapid_nebula",
+        "rapid_orchard",
+        "rapid_prairie",
+        "rapid_quarry",
+        "rapid_river",
+        "rapid_summit",
+        "rapid_tundra",
+        "rapid_valley",
+        "rapid_willow",
+        "rapid_yonder",
+        "rapid_zenith",
+        "solar_anchor",
+        "solar_bridge",
+        "solar_canyon",
+        "solar_delta",
+        "solar_ember",
+        "solar_falcon",
+        "solar_glacier",
+        "solar_harbor",
+        "solar_island",
+        "solar_jungle",
+        "solar_kernel",
+        "solar_lagoon",
+        "solar_meadow",
+        "solar_nebula",
+        "solar_orchard",
+        "solar_prairie",
+        "solar_quarry",
+        "solar_river",
+        "solar_summit",
+        "solar_tundra",
+        "solar_valley",
+        "solar_willow",
+        "solar_yonder",
+        "solar_zenith",
+        "tidal_anchor",
+        "tidal_bridge",
+        "tidal_canyon",
+        "tidal_delta",
+        "tidal_ember",
+        "tidal_falcon",
+        "tidal_glacier",
+        "tidal_harbor",
+        "tidal_island",
+        "tidal_jungle",
+        "tidal_kernel",
+        "tidal_lagoon",
+        "tidal_meadow",
+        "tidal_nebula",
+        "tidal_orchard",
+        "tidal_prairie",
+        "tidal_quarry",
+        "tidal_river",
+        "tidal_summit",
+        "tidal_tundra",
+        "tidal_valley",
+        "tidal_willow",
+        "tidal_yonder",
+        "tidal_zenith",
+        "urban_anchor",
+        "urban_bridge",
+        "urban_canyon",
+        "urban_delta",
+        "urban_ember",
+        "urban_falcon",
+        "urban_glacier",
+        "urban_harbor",
+        "urban_island",
+        "urban_jungle",
+        "urban_kernel",
+        "urban_lagoon",
+        "urban_meadow",
+        "urban_nebula",
+        "urban_orchard",
+        "urban_prairie",
+        "urban_quarry",
+        "urban_river",
+        "urban_summit",
+        "urban_tundra",
+        "urban_valley",
+        "urban_willow",
+        "urban_yonder",
+        "urban_zenith",
+        "vivid_anchor",
+        "vivid_bridge",
+        "vivid_canyon",
+        "vivid_delta",
+        "vivid_ember",
+        "vivid_falcon",
+        "vivid_glacier",
+        "vivid_harbor",
+        "vivid_island",
+        "vivid_jungle",
+        "vivid_kernel",
+        "vivid_lagoon",
+        "vivid_meadow",
+        "vivid_nebula",
+        "vivid_orchard",
+        "vivid_prairie",
+        "vivid_quarry",
+        "vivid_river",
+        "vivid_summit",
+        "vivid_tundra",
+        "vivid_valley",
+        "vivid_willow",
+        "vivid_yonder",
+        "vivid_zenith",
+        "windy_anchor",
+        "windy_bridge",
+        "windy_canyon",
+        "windy_delta",
+        "windy_ember",
+        "windy_falcon",
+        "windy_glacier",
+        "windy_harbor",
+        "windy_island",
+        "windy_jungle",
+        "windy_kernel",
+        "windy_lagoon",
+        "windy_meadow",
+        "windy_nebula",
+        "windy_orchard",
+        "windy_prairie",
+        "windy_quarry",
+        "windy_river",
+        "windy_summit",
+        "windy_tundra",
+        "windy_valley",
+        "windy_willow",
+        "windy_yonder",
+        "windy_zenith",
+        "young_anchor",
+        "young_bridge",
+        "young_canyon",
+        "young_delta",
+        "young_ember",
+        "young_falcon",
+        "young_glacier",
+        "young_harbor",
+        "young_island",
+        "young_jungle",
+        "young_kernel",
+        "young_lagoon",
+        "young_meadow",
+        "young_nebula",
+        "young_orchard",
+        "young_prairie",
+        "young_quarry",
+        "young_river",
+        "young_summit",
+        "young_tundra",
+        "young_valley",
+        "young_willow",
+        "young_yonder",
+        "young_zenith",
+        "zonal_anchor",
+        "zonal_bridge",
+        "zonal_canyon",
+        "zonal_delta",
+        "zonal_ember",
+        "zonal_falcon",
+        "zonal_glacier",
+        "zonal_harbor",
+        "zonal_island",
+        "zonal_jungle",
+        "zonal_kernel",
+        "zonal_lagoon",
+        "zonal_meadow",
+        "zonal_nebula",
+        "zonal_orchard",
+        "zonal_prairie",
+        "zonal_quarry",
+        "zonal_river",
+        "zonal_summit",
+        "zonal_tundra",
+        "zonal_valley",
+        "zonal_willow",
+        "zonal_yonder",
+        "zonal_zenith",
+    };
+    return names[(size_t)value];
+}
+
+const char* EPlace::shortName() const
+{
+    return shortName(value());
+}
+
+EPlace EPlace::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        0, 606, 25, 2, 396, 514, 36, 11, 0, 228, 46, 87, 3, 59, 45, 197,
+        4, 16, 0, 0, 60, 5, 24, 11, 1, 0, 31, 52, 99, 0, 37, 10,
+        0, 0, 47, 208, 186, 19, 9, 73, 0, 2, 0, 0, 0, 3, 5, 5,
+        7, 1, 17, 35, 0, 2, 9, 5, 8, 20, 1, 5, 1, 1, 74, 0,
+        9, 0, 1, 0, 16, 8, 0, 57, 11, 0, 2, 0, 0, 0, 134, 39,
+        15, 0, 42, 7, 5, 11, 70, 15, 12, 19, 23, 2, 13, 91, 38, 13,
+        2, 1, 8, 192, 0, 38, 13, 17, 1, 4, 9, 39, 0, 0, 49, 28,
+        19, 7, 4, 2, 18, 23, 15, 5, 14, 43, 2, 3, 1, 3, 24, 0,
+        23, 3, 4, 3, 0, 0, 6, 11, 4, 0, 9, 8, 9, 7, 16, 18,
+        24, 14, 10, 0, 0, 5, 0, 0, 2, 0, 0, 0, 2, 0, 11, 0,
+        15, 0, 4, 1, 0, 1, 16, 16, 10, 6, 2, 1, 1, 0, 0, 0,
+        0, 5, 2, 0, 0, 55, 21, 0, 0, 1, 0, 4, 1, 1, 0, 0,
+        1, 3, 8, 3, 9, 29, 28, 5, 0, 0, 0, 0, 7, 7, 0, 11,
+        0, 19, 0, 25, 3, 0, 10, 21, 4, 11, 0, 2, 0, 1, 1, 12,
+        0, 0, 1, 0, 8, 4, 0, 0, 0, 1, 5, 1, 2, 1, 3, 0,
+        1, 0, 1, 20, 2, 1, 0, 1, 12, 17, 0, 5, 8, 6, 49, 3,
+        14, 0, 0, 3, 7, 0, 25, 4, 1, 0, 0, 1, 1, 9, 0, 3,
+        14, 5, 0, 8, 2, 0, 4, 0, 0, 5, 2, 4, 0, 0, 0, 11,
+        9, 4, 13, 5, 0, 1, 1, 23, 10, 5, 0, 1, 0,
+    };
+    static const char* names[] =
+    {
+        "prime_delta",
+        "zonal_ember",
+        "young_zenith",
+        "dusty_ember",
+        "vivid_glacier",
+        "coral_yonder",
+        "prime_prairie",
+        "noble_nebula",
+        "lunar_prairie",
+        "noble_orchard",
+        "noble_quarry",
+        "quiet_jungle",
+        "faint_zenith",
+        "tidal_quarry",
+        "hollow_canyon",
+        "noble_falcon",
+        "windy_falcon",
+        "quiet_bridge",
+        "lunar_valley",
+        "early_nebula",
+        "lunar_ember",
+        "lunar_bridge",
+        "giant_meadow",
+        "rapid_glacier",
+        "brisk_summit",
+        "early_island",
+        "ivory_orchard",
+        "giant_canyon",
+        "faint_kernel",
+        "urban_tundra",
+        "prime_willow",
+        "misty_willow",
+        "giant_orchard",
+        "solar_summit",
+        "solar_valley",
+        "brisk_bridge",
+        "ivory_jungle",
+        "hollow_delta",
+        "vivid_jungle",
+        "jolly_falcon",
+        "misty_nebula",
+        "windy_anchor",
+        "zonal_anchor",
+        "misty_ember",
+        "quiet_falcon",
+        "zonal_bridge",
+        "quiet_lagoon",
+        "keen_kernel",
+        "rapid_quarry",
+        "jolly_harbor",
+        "giant_willow",
+        "dusty_valley",
+        "amber_jungle",
+        "early_valley",
+        "keen_harbor",
+        "dusty_yonder",
+        "giant_river",
+        "prime_jungle",
+        "ivory_willow",
+        "jolly_glacier",
+        "jolly_orchard",
+        "misty_prairie",
+        "jolly_river",
+        "coral_willow",
+        "hollow_island",
+        "keen_lagoon",
+        "dusty_river",
+        "solar_falcon",
+        "misty_quarry",
+        "tidal_canyon",
+        "zonal_island",
+        "young_prairie",
+        "vivid_orchard",
+        "prime_nebula",
+        "zonal_prairie",
+        "rapid_canyon",
+        "amber_glacier",
+        "brisk_yonder",
+        "noble_bridge",
+        "tidal_ember",
+        "ivory_ember",
+        "urban_jungle",
+        "tidal_jungle",
+        "lunar_glacier",
+        "tidal_kernel",
+        "rapid_jungle",
+        "faint_delta",
+        "keen_prairie",
+        "solar_lagoon",
+        "coral_lagoon",
+        "amber_canyon",
+        "amber_falcon",
+        "rapid_kernel",
+        "windy_prairie",
+        "early_tundra",
+        "coral_summit",
+        "hollow_harbor",
+        "solar_harbor",
+        "noble_ember",
+        "amber_anchor",
+        "prime_harbor",
+        "tidal_valley",
+        "vivid_harbor",
+        "early_harbor",
+        "jolly_zenith",
+        "brisk_glacier",
+        "zonal_delta",
+        "faint_summit",
+        "tidal_orchard",
+        "olive_bridge",
+        "early_falcon",
+        "giant_bridge",
+        "brisk_willow",
+        "dusty_jungle",
+        "faint_lagoon",
+        "noble_lagoon",
+        "faint_orchard",
+        "quiet_harbor",
+        "urban_valley",
+        "solar_orchard",
+        "faint_meadow",
+        "noble_island",
+        "brisk_orchard",
+        "giant_harbor",
+        "misty_island",
+        "faint_jungle",
+        "zonal_meadow",
+        "solar_yonder",
+        "urban_orchard",
+        "zonal_orchard",
+        "vivid_willow",
+        "jolly_nebula",
+        "coral_bridge",
+        "keen_river",
+        "dusty_prairie",
+        "windy_valley",
+        "coral_harbor",
+        "early_glacier",
+        "tidal_meadow",
+        "brisk_valley",
+        "rapid_harbor",
+        "hollow_prairie",
+        "prime_falcon",
+        "faint_bridge",
+        "rapid_ember",
+        "hollow_yonder",
+        "misty_zenith",
+        "vivid_kernel",
+        "young_ember",
+        "young_delta",
+        "young_yonder",
+        "dusty_canyon",
+        "zonal_tundra",
+        "amber_meadow",
+        "olive_nebula",
+        "quiet_quarry",
+        "young_nebula",
+        "amber_quarry",
+        "giant_prairie",
+        "rapid_yonder",
+        "rapid_prairie",
+        "young_summit",
+        "tidal_glacier",
+        "windy_zenith",
+        "vivid_zenith",
+        "amber_bridge",
+        "windy_bridge",
+        "misty_yonder",
+        "ivory_valley",
+        "young_harbor",
+        "dusty_quarry",
+        "ivory_prairie",
+        "noble_river",
+        "jolly_meadow",
+        "olive_orchard",
+        "amber_nebula",
+        "quiet_summit",
+        "rapid_valley",
+        "misty_kernel",
+        "olive_glacier",
+        "zonal_river",
+        "early_meadow",
+        "hollow_tundra",
+        "rapid_zenith",
+        "olive_yonder",
+        "rapid_island",
+        "faint_tundra",
+        "prime_anchor",
+        "misty_tundra",
+        "noble_prairie",
+        "ivory_island",
+        "windy_kernel",
+        "rapid_falcon",
+        "hollow_anchor",
+        "keen_yonder",
+        "windy_nebula",
+        "quiet_river",
+        "coral_ember",
+        "faint_quarry",
+        "ivory_summit",
+        "coral_delta",
+        "hollow_zenith",
+        "ivory_lagoon",
+        "dusty_falcon",
+        "young_bridge",
+        "keen_ember",
+        "vivid_valley",
+        "brisk_harbor",
+        "keen_summit",
+        "urban_anchor",
+        "faint_yonder",
+        "faint_river",
+        "rapid_lagoon",
+        "urban_yonder",
+        "vivid_tundra",
+        "coral_nebula",
+        "solar_quarry",
+        "amber_zenith",
+        "hollow_orchard",
+        "urban_willow",
+        "jolly_prairie",
+        "noble_willow",
+        "quiet_island",
+        "hollow_willow",
+        "ivory_delta",
+        "dusty_kernel",
+        "ivory_nebula",
+        "young_island",
+        "hollow_lagoon",
+        "amber_delta",
+        "brisk_canyon",
+        "dusty_lagoon",
+        "vivid_summit",
+        "faint_glacier",
+        "hollow_meadow",
+        "rapid_orchard",
+        "olive_kernel",
+        "faint_falcon",
+        "vivid_falcon",
+        "amber_willow",
+        "jolly_yonder",
+        "amber_ember",
+        "early_lagoon",
+        "jolly_summit",
+        "dusty_bridge",
+        "giant_kernel",
+        "noble_yonder",
+        "hollow_summit",
+        "ivory_canyon",
+        "prime_zenith",
+        "solar_anchor",
+        "quiet_orchard",
+        "young_falcon",
+        "coral_tundra",
+        "solar_canyon",
+        "keen_nebula",
+        "windy_quarry",
+        "dusty_tundra",
+        "quiet_anchor",
+        "ivory_bridge",
+        "zonal_zenith",
+        "prime_yonder",
+        "ivory_river",
+        "misty_orchard",
+        "misty_harbor",
+        "tidal_bridge",
+        "brisk_island",
+        "tidal_lagoon",
+        "young_tundra",
+        "faint_valley",
+        "misty_glacier",
+        "early_canyon",
+        "prime_lagoon",
+        "noble_summit",
+        "coral_kernel",
+        "windy_canyon",
+        "coral_island",
+        "vivid_meadow",
+        "noble_delta",
+        "tidal_falcon",
+        "prime_quarry",
+        "zonal_jungle",
+        "quiet_prairie",
+        "misty_falcon",
+        "brisk_meadow",
+        "brisk_delta",
+        "giant_glacier",
+        "prime_kernel",
+        "hollow_nebula",
+        "olive_summit",
+        "urban_ember",
+        "solar_island",
+        "olive_zenith",
+        "young_jungle",
+        "coral_jungle",
+        "dusty_island",
+        "urban_falcon",
+        "jolly_canyon",
+        "amber_island",
+        "olive_canyon",
+        "urban_summit",
+        "keen_meadow",
+        "zonal_harbor",
+        "young_river",
+        "faint_canyon",
+        "faint_anchor",
+        "amber_tundra",
+        "quiet_tundra",
+        "misty_anchor",
+        "early_zenith",
+        "amber_orchard",
+        "young_willow",
+        "dusty_zenith",
+        "jolly_island",
+        "tidal_island",
+        "lunar_tundra",
+        "windy_ember",
+        "keen_tundra",
+        "amber_yonder",
+        "windy_river",
+        "zonal_summit",
+        "jolly_willow",
+        "quiet_zenith",
+        "early_delta",
+        "lunar_island",
+        "hollow_bridge",
+        "vivid_ember",
+        "lunar_jungle",
+        "brisk_tundra",
+        "prime_island",
+        "windy_meadow",
+        "coral_orchard",
+        "quiet_willow",
+        "prime_meadow",
+        "jolly_bridge",
+        "lunar_willow",
+        "solar_jungle",
+        "early_ember",
+        "solar_river",
+        "urban_bridge",
+        "prime_summit",
+        "lunar_nebula",
+        "keen_glacier",
+        "faint_nebula",
+        "noble_jungle",
+        "solar_tundra",
+        "jolly_jungle",
+        "prime_bridge",
+        "brisk_prairie",
+        "amber_summit",
+        "early_anchor",
+        "noble_harbor",
+        "rapid_delta",
+        "olive_delta",
+        "urban_quarry",
+        "zonal_willow",
+        "windy_willow",
+        "prime_valley",
+        "prime_canyon",
+        "amber_lagoon",
+        "misty_summit",
+        "ivory_zenith",
+        "vivid_island",
+        "tidal_anchor",
+        "tidal_harbor",
+        "zonal_yonder",
+        "hollow_falcon",
+        "urban_delta",
+        "brisk_ember",
+        "amber_prairie",
+        "jolly_ember",
+        "quiet_ember",
+        "misty_bridge",
+        "solar_kernel",
+        "coral_glacier",
+        "quiet_kernel",
+        "olive_island",
+        "vivid_bridge",
+        "giant_delta",
+        "brisk_jungle",
+        "dusty_glacier",
+        "keen_willow",
+        "windy_yonder",
+        "prime_glacier",
+        "windy_tundra",
+        "giant_anchor",
+        "rapid_anchor",
+        "amber_valley",
+        "hollow_ember",
+        "faint_willow",
+        "urban_zenith",
+        "giant_jungle",
+        "quiet_valley",
+        "coral_quarry",
+        "jolly_valley",
+        "quiet_yonder",
+        "jolly_kernel",
+        "dusty_anchor",
+        "faint_harbor",
+        "lunar_meadow",
+        "hollow_valley",
+        "vivid_anchor",
+        "jolly_delta",
+        "ivory_falcon",
+        "early_summit",
+        "olive_harbor",
+        "amber_harbor",
+        "zonal_nebula",
+        "hollow_jungle",
+        "zonal_quarry",
+        "lunar_lagoon",
+        "dusty_orchard",
+        "hollow_kernel",
+        "noble_anchor",
+        "keen_quarry",
+        "tidal_river",
+        "prime_river",
+        "ivory_yonder",
+        "amber_river",
+        "quiet_glacier",
+        "giant_summit",
+        "tidal_yonder",
+        "ivory_kernel",
+        "zonal_kernel",
+        "coral_river",
+        "noble_valley",
+        "quiet_meadow",
+        "brisk_anchor",
+        "young_lagoon",
+        "urban_meadow",
+        "giant_lagoon",
+        "zonal_valley",
+        "vivid_delta",
+        "vivid_lagoon",
+        "solar_nebula",
+        "giant_falcon",
+        "young_glacier",
+        "misty_delta",
+        "jolly_lagoon",
+        "urban_lagoon",
+        "misty_lagoon",
+        "rapid_summit",
+        "jolly_quarry",
+        "urban_canyon",
+        "solar_delta",
+        "young_valley",
+        "brisk_lagoon",
+        "keen_zenith",
+        "tidal_nebula",
+        "brisk_kernel",
+        "ivory_harbor",
+        "windy_harbor",
+        "zonal_falcon",
+        "prime_tundra",
+        "tidal_prairie",
+        "urban_island",
+        "rapid_willow",
+        "giant_nebula",
+        "keen_canyon",
+        "windy_lagoon",
+        "ivory_glacier",
+        "early_prairie",
+        "misty_river",
+        "keen_island",
+        "giant_zenith",
+        "windy_jungle",
+        "rapid_meadow",
+        "hollow_glacier",
+        "brisk_zenith",
+        "tidal_willow",
+        "early_willow",
+        "young_quarry",
+        "rapid_tundra",
+        "young_anchor",
+        "lunar_canyon",
+        "rapid_bridge",
+        "young_meadow",
+        "solar_zenith",
+        "ivory_tundra",
+        "noble_tundra",
+        "giant_tundra",
+        "coral_zenith",
+        "lunar_falcon",
+        "olive_valley",
+        "olive_river",
+        "early_yonder",
+        "noble_glacier",
+        "invalid",
+        "keen_falcon",
+        "giant_quarry",
+        "urban_harbor",
+        "windy_summit",
+        "coral_canyon",
+        "misty_jungle",
+        "vivid_prairie",
+        "lunar_delta",
+        "urban_glacier",
+        "early_jungle",
+        "amber_kernel",
+        "tidal_delta",
+        "early_bridge",
+        "brisk_falcon",
+        "noble_zenith",
+        "noble_canyon",
+        "keen_jungle",
+        "solar_ember",
+        "young_kernel",
+        "lunar_quarry",
+        "giant_yonder",
+        "tidal_summit",
+        "rapid_nebula",
+        "windy_island",
+        "keen_valley",
+        "zonal_glacier",
+        "keen_orchard",
+        "keen_anchor",
+        "olive_willow",
+        "vivid_canyon",
+        "dusty_willow",
+        "brisk_nebula",
+        "solar_glacier",
+        "windy_delta",
+        "olive_lagoon",
+        "misty_valley",
+        "prime_orchard",
+        "quiet_canyon",
+        "lunar_harbor",
+        "dusty_summit",
+        "solar_meadow",
+        "coral_valley",
+        "misty_canyon",
+        "jolly_anchor",
+        "urban_river",
+        "vivid_river",
+        "vivid_quarry",
+        "young_canyon",
+        "ivory_quarry",
+        "vivid_yonder",
+        "quiet_nebula",
+        "coral_falcon",
+        "solar_prairie",
+        "early_quarry",
+        "faint_ember",
+        "giant_valley",
+        "urban_prairie",
+        "tidal_tundra",
+        "olive_meadow",
+        "early_kernel",
+        "urban_nebula",
+        "lunar_anchor",
+        "early_orchard",
+        "lunar_yonder",
+        "keen_delta",
+        "lunar_summit",
+        "lunar_kernel",
+        "brisk_river",
+        "dusty_delta",
+        "young_orchard",
+        "hollow_quarry",
+        "coral_anchor",
+        "olive_anchor",
+        "brisk_quarry",
+        "faint_prairie",
+        "noble_meadow",
+        "dusty_meadow",
+        "lunar_orchard",
+        "giant_island",
+        "windy_glacier",
+        "misty_meadow",
+        "hollow_river",
+        "keen_bridge",
+        "prime_ember",
+        "windy_orchard",
+        "solar_bridge",
+        "olive_ember",
+        "giant_ember",
+        "rapid_river",
+        "solar_willow",
+        "coral_prairie",
+        "coral_meadow",
+        "lunar_zenith",
+        "early_river",
+        "olive_prairie",
+        "jolly_tundra",
+        "quiet_delta",
+        "zonal_lagoon",
+        "noble_kernel",
+        "ivory_meadow",
+        "zonal_canyon",
+        "faint_island",
+        "olive_falcon",
+        "olive_quarry",
+        "olive_jungle",
+        "urban_kernel",
+        "vivid_nebula",
+        "dusty_harbor",
+        "lunar_river",
+        "olive_tundra",
+        "dusty_nebula",
+        "tidal_zenith",
+        "ivory_anchor",
+    };
+    static const size_t lengths[] =
+    {
+        11, 11, 12, 11, 13, 12, 13, 12, 13, 13, 12, 12, 12, 12, 13, 12,
+        12, 12, 12, 12, 11, 12, 12, 13, 12, 12, 13, 12, 12, 12, 12, 12,
+        13, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 11, 12, 12, 12, 11,
+        12, 12, 12, 12, 12, 12, 11, 12, 11, 12, 12, 13, 13, 13, 11, 12,
+        13, 11, 11, 12, 12, 12, 12, 13, 13, 12, 13, 12, 13, 12, 12, 11,
+        11, 12, 12, 13, 12, 12, 11, 12, 12, 12, 12, 12, 12, 13, 12, 12,
+        13, 12, 11, 12, 12, 12, 12, 12, 12, 13, 11, 12, 13, 12, 12, 12,
+        12, 12, 12, 12, 13, 12, 12, 13, 12, 12, 13, 12, 12, 12, 12, 12,
+        13, 13, 12, 12, 12, 10, 13, 12, 12, 13, 12, 12, 12, 14, 12, 12,
+        11, 13, 12, 12, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 13, 12,
+        13, 12, 13, 12, 12, 12, 12, 12, 12, 12, 12, 13, 11, 12, 13, 12,
+        12, 12, 12, 13, 11, 12, 13, 12, 12, 12, 12, 12, 12, 13, 12, 12,
+        12, 13, 11, 12, 11, 11, 12, 12, 11, 13, 12, 12, 12, 10, 12, 12,
+        11, 12, 12, 11, 12, 12, 12, 12, 12, 12, 14, 12, 13, 12, 12, 13,
+        11, 12, 12, 12, 13, 11, 12, 12, 12, 13, 13, 13, 12, 12, 12, 12,
+        12, 11, 12, 12, 12, 12, 12, 13, 12, 12, 12, 13, 12, 12, 12, 11,
+        12, 12, 12, 12, 12, 12, 11, 13, 12, 12, 12, 12, 12, 12, 13, 12,
+        12, 12, 12, 12, 12, 12, 11, 12, 12, 12, 13, 12, 12, 11, 13, 12,
+        13, 12, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 11, 12, 11,
+        12, 12, 12, 12, 12, 12, 13, 12, 12, 12, 12, 12, 11, 11, 12, 11,
+        12, 12, 12, 11, 12, 13, 11, 12, 12, 12, 12, 13, 12, 12, 12, 12,
+        12, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 12, 12, 12,
+        11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 11,
+        11, 13, 11, 11, 12, 12, 13, 12, 12, 12, 11, 12, 13, 11, 12, 13,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        13, 12, 11, 12, 12, 12, 12, 12, 13, 12, 12, 13, 13, 12, 11, 11,
+        11, 12, 11, 13, 12, 12, 12, 12, 11, 12, 12, 12, 12, 12, 12, 12,
+        11, 12, 12, 12, 13, 11, 12, 12, 12, 12, 12, 12, 11, 12, 12, 11,
+        12, 12, 12, 12, 12, 12, 13, 12, 12, 12, 11, 12, 13, 13, 11, 11,
+        12, 12, 12, 14, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 11, 12, 13, 7, 11, 12, 12, 12, 12, 12, 13, 11,
+        13, 12, 12, 11, 12, 12, 12, 12, 11, 11, 12, 12, 12, 12, 12, 12,
+        11, 13, 12, 11, 12, 12, 12, 12, 13, 11, 12, 12, 13, 12, 12, 12,
+        12, 12, 12, 12, 11, 11, 12, 12, 12, 12, 12, 12, 13, 12, 11, 12,
+        13, 12, 12, 12, 12, 12, 13, 12, 10, 12, 12, 11, 11, 13, 13, 12,
+        12, 12, 13, 12, 12, 13, 12, 13, 12, 12, 11, 11, 13, 12, 11, 11,
+        11, 12, 13, 12, 12, 11, 13, 12, 11, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 11, 12, 12, 12, 12,
+    };
+    static const long values[] =
+    {
+        kPrime_delta,
+        kZonal_ember,
+        kYoung_zenith,
+        kDusty_ember,
+        kVivid_glacier,
+        kCoral_yonder,
+        kPrime_prairie,
+        kNoble_nebula,
+        kLunar_prairie,
+        kNoble_orchard,
+        kNoble_quarry,
+        kQuiet_jungle,
+        kFaint_zenith,
+        kTidal_quarry,
+        kHollow_canyon,
+        kNoble_falcon,
+        kWindy_falcon,
+        kQuiet_bridge,
+        kLunar_valley,
+        kEarly_nebula,
+        kLunar_ember,
+        kLunar_bridge,
+        kGiant_meadow,
+        kRapid_glacier,
+        kBrisk_summit,
+        kEarly_island,
+        kIvory_orchard,
+        kGiant_canyon,
+        kFaint_kernel,
+        kUrban_tundra,
+        kPrime_willow,
+        kMisty_willow,
+        kGiant_orchard,
+        kSolar_summit,
+        kSolar_valley,
+        kBrisk_bridge,
+        kIvory_jungle,
+        kHollow_delta,
+        kVivid_jungle,
+        kJolly_falcon,
+        kMisty_nebula,
+        kWindy_anchor,
+        kZonal_anchor,
+        kMisty_ember,
+        kQuiet_falcon,
+        kZonal_bridge,
+        kQuiet_lagoon,
+        kKeen_kernel,
+        kRapid_quarry,
+        kJolly_harbor,
+        kGiant_willow,
+        kDusty_valley,
+        kAmber_jungle,
+        kEarly_valley,
+        kKeen_harbor,
+        kDusty_yonder,
+        kGiant_river,
+        kPrime_jungle,
+        kIvory_willow,
+        kJolly_glacier,
+        kJolly_orchard,
+        kMisty_prairie,
+        kJolly_river,
+        kCoral_willow,
+        kHollow_island,
+        kKeen_lagoon,
+        kDusty_river,
+        kSolar_falcon,
+        kMisty_quarry,
+        kTidal_canyon,
+        kZonal_island,
+        kYoung_prairie,
+        kVivid_orchard,
+        kPrime_nebula,
+        kZonal_prairie,
+        kRapid_canyon,
+        kAmber_glacier,
+        kBrisk_yonder,
+        kNoble_bridge,
+        kTidal_ember,
+        kIvory_ember,
+        kUrban_jungle,
+        kTidal_jungle,
+        kLunar_glacier,
+        kTidal_kernel,
+        kRapid_jungle,
+        kFaint_delta,
+        kKeen_prairie,
+        kSolar_lagoon,
+        kCoral_lagoon,
+        kAmber_canyon,
+        kAmber_falcon,
+        kRapid_kernel,
+        kWindy_prairie,
+        kEarly_tundra,
+        kCoral_summit,
+        kHollow_harbor,
+        kSolar_harbor,
+        kNoble_ember,
+        kAmber_anchor,
+        kPrime_harbor,
+        kTidal_valley,
+        kVivid_harbor,
+        kEarly_harbor,
+        kJolly_zenith,
+        kBrisk_glacier,
+        kZonal_delta,
+        kFaint_summit,
+        kTidal_orchard,
+        kOlive_bridge,
+        kEarly_falcon,
+        kGiant_bridge,
+        kBrisk_willow,
+        kDusty_jungle,
+        kFaint_lagoon,
+        kNoble_lagoon,
+        kFaint_orchard,
+        kQuiet_harbor,
+        kUrban_valley,
+        kSolar_orchard,
+        kFaint_meadow,
+        kNoble_island,
+        kBrisk_orchard,
+        kGiant_harbor,
+        kMisty_island,
+        kFaint_jungle,
+        kZonal_meadow,
+        kSolar_yonder,
+        kUrban_orchard,
+        kZonal_orchard,
+        kVivid_willow,
+        kJolly_nebula,
+        kCoral_bridge,
+        kKeen_river,
+        kDusty_prairie,
+        kWindy_valley,
+        kCoral_harbor,
+        kEarly_glacier,
+        kTidal_meadow,
+        kBrisk_valley,
+        kRapid_harbor,
+        kHollow_prairie,
+        kPrime_falcon,
+        kFaint_bridge,
+        kRapid_ember,
+        kHollow_yonder,
+        kMisty_zenith,
+        kVivid_kernel,
+        kYoung_ember,
+        kYoung_delta,
+        kYoung_yonder,
+        kDusty_canyon,
+        kZonal_tundra,
+        kAmber_meadow,
+        kOlive_nebula,
+        kQuiet_quarry,
+        kYoung_nebula,
+        kAmber_quarry,
+        kGiant_prairie,
+        kRapid_yonder,
+        kRapid_prairie,
+        kYoung_summit,
+        kTidal_glacier,
+        kWindy_zenith,
+        kVivid_zenith,
+        kAmber_bridge,
+        kWindy_bridge,
+        kMisty_yonder,
+        kIvory_valley,
+        kYoung_harbor,
+        kDusty_quarry,
+        kIvory_prairie,
+        kNoble_river,
+        kJolly_meadow,
+        kOlive_orchard,
+        kAmber_nebula,
+        kQuiet_summit,
+        kRapid_valley,
+        kMisty_kernel,
+        kOlive_glacier,
+        kZonal_river,
+        kEarly_meadow,
+        kHollow_tundra,
+        kRapid_zenith,
+        kOlive_yonder,
+        kRapid_island,
+        kFaint_tundra,
+        kPrime_anchor,
+        kMisty_tundra,
+        kNoble_prairie,
+        kIvory_island,
+        kWindy_kernel,
+        kRapid_falcon,
+        kHollow_anchor,
+        kKeen_yonder,
+        kWindy_nebula,
+        kQuiet_river,
+        kCoral_ember,
+        kFaint_quarry,
+        kIvory_summit,
+        kCoral_delta,
+        kHollow_zenith,
+        kIvory_lagoon,
+        kDusty_falcon,
+        kYoung_bridge,
+        kKeen_ember,
+        kVivid_valley,
+        kBrisk_harbor,
+        kKeen_summit,
+        kUrban_anchor,
+        kFaint_yonder,
+        kFaint_river,
+        kRapid_lagoon,
+        kUrban_yonder,
+        kVivid_tundra,
+        kCoral_nebula,
+        kSolar_quarry,
+        kAmber_zenith,
+        kHollow_orchard,
+        kUrban_willow,
+        kJolly_prairie,
+        kNoble_willow,
+        kQuiet_island,
+        kHollow_willow,
+        kIvory_delta,
+        kDusty_kernel,
+        kIvory_nebula,
+        kYoung_island,
+        kHollow_lagoon,
+        kAmber_delta,
+        kBrisk_canyon,
+        kDusty_lagoon,
+        kVivid_summit,
+        kFaint_glacier,
+        kHollow_meadow,
+        kRapid_orchard,
+        kOlive_kernel,
+        kFaint_falcon,
+        kVivid_falcon,
+        kAmber_willow,
+        kJolly_yonder,
+        kAmber_ember,
+        kEarly_lagoon,
+        kJolly_summit,
+        kDusty_bridge,
+        kGiant_kernel,
+        kNoble_yonder,
+        kHollow_summit,
+        kIvory_canyon,
+        kPrime_zenith,
+        kSolar_anchor,
+        kQuiet_orchard,
+        kYoung_falcon,
+        kCoral_tundra,
+        kSolar_canyon,
+        kKeen_nebula,
+        kWindy_quarry,
+        kDusty_tundra,
+        kQuiet_anchor,
+        kIvory_bridge,
+        kZonal_zenith,
+        kPrime_yonder,
+        kIvory_river,
+        kMisty_orchard,
+        kMisty_harbor,
+        kTidal_bridge,
+        kBrisk_island,
+        kTidal_lagoon,
+        kYoung_tundra,
+        kFaint_valley,
+        kMisty_glacier,
+        kEarly_canyon,
+        kPrime_lagoon,
+        kNoble_summit,
+        kCoral_kernel,
+        kWindy_canyon,
+        kCoral_island,
+        kVivid_meadow,
+        kNoble_delta,
+        kTidal_falcon,
+        kPrime_quarry,
+        kZonal_jungle,
+        kQuiet_prairie,
+        kMisty_falcon,
+        kBrisk_meadow,
+        kBrisk_delta,
+        kGiant_glacier,
+        kPrime_kernel,
+        kHollow_nebula,
+        kOlive_summit,
+        kUrban_ember,
+        kSolar_island,
+        kOlive_zenith,
+        kYoung_jungle,
+        kCoral_jungle,
+        kDusty_island,
+        kUrban_falcon,
+        kJolly_canyon,
+        kAmber_island,
+        kOlive_canyon,
+        kUrban_summit,
+        kKeen_meadow,
+        kZonal_harbor,
+        kYoung_river,
+        kFaint_canyon,
+        kFaint_anchor,
+        kAmber_tundra,
+        kQuiet_tundra,
+        kMisty_anchor,
+        kEarly_zenith,
+        kAmber_orchard,
+        kYoung_willow,
+        kDusty_zenith,
+        kJolly_island,
+        kTidal_island,
+        kLunar_tundra,
+        kWindy_ember,
+        kKeen_tundra,
+        kAmber_yonder,
+        kWindy_river,
+        kZonal_summit,
+        kJolly_willow,
+        kQuiet_zenith,
+        kEarly_delta,
+        kLunar_island,
+        kHollow_bridge,
+        kVivid_ember,
+        kLunar_jungle,
+        kBrisk_tundra,
+        kPrime_island,
+        kWindy_meadow,
+        kCoral_orchard,
+        kQuiet_willow,
+        kPrime_meadow,
+        kJolly_bridge,
+        kLunar_willow,
+        kSolar_jungle,
+        kEarly_ember,
+        kSolar_river,
+        kUrban_bridge,
+        kPrime_summit,
+        kLunar_nebula,
+        kKeen_glacier,
+        kFaint_nebula,
+        kNoble_jungle,
+        kSolar_tundra,
+        kJolly_jungle,
+        kPrime_bridge,
+        kBrisk_prairie,
+        kAmber_summit,
+        kEarly_anchor,
+        kNoble_harbor,
+        kRapid_delta,
+        kOlive_delta,
+        kUrban_quarry,
+        kZonal_willow,
+        kWindy_willow,
+        kPrime_valley,
+        kPrime_canyon,
+        kAmber_lagoon,
+        kMisty_summit,
+        kIvory_zenith,
+        kVivid_island,
+        kTidal_anchor,
+        kTidal_harbor,
+        kZonal_yonder,
+        kHollow_falcon,
+        kUrban_delta,
+        kBrisk_ember,
+        kAmber_prairie,
+        kJolly_ember,
+        kQuiet_ember,
+        kMisty_bridge,
+        kSolar_kernel,
+        kCoral_glacier,
+        kQuiet_kernel,
+        kOlive_island,
+        kVivid_bridge,
+        kGiant_delta,
+        kBrisk_jungle,
+        kDusty_glacier,
+        kKeen_willow,
+        kWindy_yonder,
+        kPrime_glacier,
+        kWindy_tundra,
+        kGiant_anchor,
+        kRapid_anchor,
+        kAmber_valley,
+        kHollow_ember,
+        kFaint_willow,
+        kUrban_zenith,
+        kGiant_jungle,
+        kQuiet_valley,
+        kCoral_quarry,
+        kJolly_valley,
+        kQuiet_yonder,
+        kJolly_kernel,
+        kDusty_anchor,
+        kFaint_harbor,
+        kLunar_meadow,
+        kHollow_valley,
+        kVivid_anchor,
+        kJolly_delta,
+        kIvory_falcon,
+        kEarly_summit,
+        kOlive_harbor,
+        kAmber_harbor,
+        kZonal_nebula,
+        kHollow_jungle,
+        kZonal_quarry,
+        kLunar_lagoon,
+        kDusty_orchard,
+        kHollow_kernel,
+        kNoble_anchor,
+        kKeen_quarry,
+        kTidal_river,
+        kPrime_river,
+        kIvory_yonder,
+        kAmber_river,
+        kQuiet_glacier,
+        kGiant_summit,
+        kTidal_yonder,
+        kIvory_kernel,
+        kZonal_kernel,
+        kCoral_river,
+        kNoble_valley,
+        kQuiet_meadow,
+        kBrisk_anchor,
+        kYoung_lagoon,
+        kUrban_meadow,
+        kGiant_lagoon,
+        kZonal_valley,
+        kVivid_delta,
+        kVivid_lagoon,
+        kSolar_nebula,
+        kGiant_falcon,
+        kYoung_glacier,
+        kMisty_delta,
+        kJolly_lagoon,
+        kUrban_lagoon,
+        kMisty_lagoon,
+        kRapid_summit,
+        kJolly_quarry,
+        kUrban_canyon,
+        kSolar_delta,
+        kYoung_valley,
+        kBrisk_lagoon,
+        kKeen_zenith,
+        kTidal_nebula,
+        kBrisk_kernel,
+        kIvory_harbor,
+        kWindy_harbor,
+        kZonal_falcon,
+        kPrime_tundra,
+        kTidal_prairie,
+        kUrban_island,
+        kRapid_willow,
+        kGiant_nebula,
+        kKeen_canyon,
+        kWindy_lagoon,
+        kIvory_glacier,
+        kEarly_prairie,
+        kMisty_river,
+        kKeen_island,
+        kGiant_zenith,
+        kWindy_jungle,
+        kRapid_meadow,
+        kHollow_glacier,
+        kBrisk_zenith,
+        kTidal_willow,
+        kEarly_willow,
+        kYoung_quarry,
+        kRapid_tundra,
+        kYoung_anchor,
+        kLunar_canyon,
+        kRapid_bridge,
+        kYoung_meadow,
+        kSolar_zenith,
+        kIvory_tundra,
+        kNoble_tundra,
+        kGiant_tundra,
+        kCoral_zenith,
+        kLunar_falcon,
+        kOlive_valley,
+        kOlive_river,
+        kEarly_yonder,
+        kNoble_glacier,
+        kInvalid,
+        kKeen_falcon,
+        kGiant_quarry,
+        kUrban_harbor,
+        kWindy_summit,
+        kCoral_canyon,
+        kMisty_jungle,
+        kVivid_prairie,
+        kLunar_delta,
+        kUrban_glacier,
+        kEarly_jungle,
+        kAmber_kernel,
+        kTidal_delta,
+        kEarly_bridge,
+        kBrisk_falcon,
+        kNoble_zenith,
+        kNoble_canyon,
+        kKeen_jungle,
+        kSolar_ember,
+        kYoung_kernel,
+        kLunar_quarry,
+        kGiant_yonder,
+        kTidal_summit,
+        kRapid_nebula,
+        kWindy_island,
+        kKeen_valley,
+        kZonal_glacier,
+        kKeen_orchard,
+        kKeen_anchor,
+        kOlive_willow,
+        kVivid_canyon,
+        kDusty_willow,
+        kBrisk_nebula,
+        kSolar_glacier,
+        kWindy_delta,
+        kOlive_lagoon,
+        kMisty_valley,
+        kPrime_orchard,
+        kQuiet_canyon,
+        kLunar_harbor,
+        kDusty_summit,
+        kSolar_meadow,
+        kCoral_valley,
+        kMisty_canyon,
+        kJolly_anchor,
+        kUrban_river,
+        kVivid_river,
+        kVivid_quarry,
+        kYoung_canyon,
+        kIvory_quarry,
+        kVivid_yonder,
+        kQuiet_nebula,
+        kCoral_falcon,
+        kSolar_prairie,
+        kEarly_quarry,
+        kFaint_ember,
+        kGiant_valley,
+        kUrban_prairie,
+        kTidal_tundra,
+        kOlive_meadow,
+        kEarly_kernel,
+        kUrban_nebula,
+        kLunar_anchor,
+        kEarly_orchard,
+        kLunar_yonder,
+        kKeen_delta,
+        kLunar_summit,
+        kLunar_kernel,
+        kBrisk_river,
+        kDusty_delta,
+        kYoung_orchard,
+        kHollow_quarry,
+        kCoral_anchor,
+        kOlive_anchor,
+        kBrisk_quarry,
+        kFaint_prairie,
+        kNoble_meadow,
+        kDusty_meadow,
+        kLunar_orchard,
+        kGiant_island,
+        kWindy_glacier,
+        kMisty_meadow,
+        kHollow_river,
+        kKeen_bridge,
+        kPrime_ember,
+        kWindy_orchard,
+        kSolar_bridge,
+        kOlive_ember,
+        kGiant_ember,
+        kRapid_river,
+        kSolar_willow,
+        kCoral_prairie,
+        kCoral_meadow,
+        kLunar_zenith,
+        kEarly_river,
+        kOlive_prairie,
+        kJolly_tundra,
+        kQuiet_delta,
+        kZonal_lagoon,
+        kNoble_kernel,
+        kIvory_meadow,
+        kZonal_canyon,
+        kFaint_island,
+        kOlive_falcon,
+        kOlive_quarry,
+        kOlive_jungle,
+        kUrban_kernel,
+        kVivid_nebula,
+        kDusty_harbor,
+        kLunar_river,
+        kOlive_tundra,
+        kDusty_nebula,
+        kTidal_zenith,
+        kIvory_anchor,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 301]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 601;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return EPlace();
+    return EPlace(values[slot]);
+}
+
+bool EPlace::operator==(const EPlace& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EPlace::operator!=(const EPlace& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+}
+
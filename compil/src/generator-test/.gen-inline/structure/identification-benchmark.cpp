@@ -0,0 +1,310 @@
+#include "structure/identification.h"
+// Compil C++ core
+#include <core/platform/benchmark.h>
+// Google Test framework
+#include <gtest/gtest.h>
+// Standard C Library
+#include <string.h>
+
+namespace identification
+{
+
+TEST(Structure1Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/identification.Structure1.construction");
+    while (benchmark.running())
+    {
+        Structure1 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure1Benchmark, copy)
+{
+    Structure1 structure1;
+    plt::Benchmark benchmark("structure/identification.Structure1.copy");
+    while (benchmark.running())
+    {
+        Structure1 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure1Benchmark, fieldAccess)
+{
+    Structure1 structure;
+    plt::Benchmark benchmark("structure/identification.Structure1.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.weight());
+    }
+}
+
+TEST(Structure1Benchmark, fieldUpdate)
+{
+    Structure1 structure;
+    plt::Benchmark benchmark("structure/identification.Structure1.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_weight(structure.weight());
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure2aBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/identification.Structure2a.construction");
+    while (benchmark.running())
+    {
+        Structure2a structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure2aBenchmark, copy)
+{
+    Structure2a structure1;
+    plt::Benchmark benchmark("structure/identification.Structure2a.copy");
+    while (benchmark.running())
+    {
+        Structure2a structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure2bBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/identification.Structure2b.construction");
+    while (benchmark.running())
+    {
+        Structure2b structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure2bBenchmark, copy)
+{
+    Structure2b structure1;
+    plt::Benchmark benchmark("structure/identification.Structure2b.copy");
+    while (benchmark.running())
+    {
+        Structure2b structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure3aaBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/identification.Structure3aa.construction");
+    while (benchmark.running())
+    {
+        Structure3aa structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure3aaBenchmark, copy)
+{
+    Structure3aa structure1;
+    plt::Benchmark benchmark("structure/identification.Structure3aa.copy");
+    while (benchmark.running())
+    {
+        Structure3aa structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure3abBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/identification.Structure3ab.construction");
+    while (benchmark.running())
+    {
+        Structure3ab structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure3abBenchmark, copy)
+{
+    Structure3ab structure1;
+    plt::Benchmark benchmark("structure/identification.Structure3ab.copy");
+    while (benchmark.running())
+    {
+        Structure3ab structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure3baBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/identification.Structure3ba.construction");
+    while (benchmark.running())
+    {
+        Structure3ba structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure3baBenchmark, copy)
+{
+    Structure3ba structure1;
+    plt::Benchmark benchmark("structure/identification.Structure3ba.copy");
+    while (benchmark.running())
+    {
+        Structure3ba structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure3bbBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/identification.Structure3bb.construction");
+    while (benchmark.running())
+    {
+        Structure3bb structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure3bbBenchmark, copy)
+{
+    Structure3bb structure1;
+    plt::Benchmark benchmark("structure/identification.Structure3bb.copy");
+    while (benchmark.running())
+    {
+        Structure3bb structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure1aFactoryBenchmark, cloneStructure1)
+{
+    Structure1SPtr object(new Structure1());
+    plt::Benchmark benchmark("structure/identification.Structure1aFactory.cloneStructure1");
+    while (benchmark.running())
+    {
+        Structure1SPtr clone = Structure1aFactory::clone(object);
+        benchmark.consume(clone);
+    }
+}
+
+TEST(Structure1aFactoryBenchmark, cloneStructure2a)
+{
+    Structure1SPtr object(new Structure2a());
+    plt::Benchmark benchmark("structure/identification.Structure1aFactory.cloneStructure2a");
+    while (benchmark.running())
+    {
+        Structure1SPtr clone = Structure1aFactory::clone(object);
+        benchmark.consume(clone);
+    }
+}
+
+TEST(Structure1aFactoryBenchmark, cloneStructure3aa)
+{
+    Structure1SPtr object(new Structure3aa());
+    plt::Benchmark benchmark("structure/identification.Structure1aFactory.cloneStructure3aa");
+    while (benchmark.running())
+    {
+        Structure1SPtr clone = Structure1aFactory::clone(object);
+        benchmark.consume(clone);
+    }
+}
+
+TEST(Structure1aFactoryBenchmark, cloneStructure3ba)
+{
+    Structure1SPtr object(new Structure3ba());
+    plt::Benchmark benchmark("structure/identification.Structure1aFactory.cloneStructure3ba");
+    while (benchmark.running())
+    {
+        Structure1SPtr clone = Structure1aFactory::clone(object);
+        benchmark.consume(clone);
+    }
+}
+
+TEST(SharedStructure1Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/identification.SharedStructure1.construction");
+    while (benchmark.running())
+    {
+        SharedStructure1 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(SharedStructure1Benchmark, copy)
+{
+    SharedStructure1 structure1;
+    plt::Benchmark benchmark("structure/identification.SharedStructure1.copy");
+    while (benchmark.running())
+    {
+        SharedStructure1 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(SharedStructure1Benchmark, fieldAccess)
+{
+    SharedStructure1 structure;
+    plt::Benchmark benchmark("structure/identification.SharedStructure1.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.weight());
+    }
+}
+
+TEST(SharedStructure1Benchmark, fieldUpdate)
+{
+    SharedStructure1 structure;
+    plt::Benchmark benchmark("structure/identification.SharedStructure1.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_weight(structure.weight());
+        benchmark.consume(structure);
+    }
+}
+
+TEST(SharedStructure2Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/identification.SharedStructure2.construction");
+    while (benchmark.running())
+    {
+        SharedStructure2 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(SharedStructure2Benchmark, copy)
+{
+    SharedStructure2 structure1;
+    plt::Benchmark benchmark("structure/identification.SharedStructure2.copy");
+    while (benchmark.running())
+    {
+        SharedStructure2 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(SharedStructure1FactoryBenchmark, cloneSharedStructure1)
+{
+    SharedStructure1SPtr object(new SharedStructure1());
+    plt::Benchmark benchmark("structure/identification.SharedStructure1Factory.cloneSharedStructure1");
+    while (benchmark.running())
+    {
+        SharedStructure1SPtr clone = SharedStructure1Factory::clone(object);
+        benchmark.consume(clone);
+    }
+}
+
+TEST(SharedStructure1FactoryBenchmark, cloneSharedStructure2)
+{
+    SharedStructure1SPtr object(new SharedStructure2());
+    plt::Benchmark benchmark("structure/identification.SharedStructure1Factory.cloneSharedStructure2");
+    while (benchmark.running())
+    {
+        SharedStructure1SPtr clone = SharedStructure1Factory::clone(object);
+        benchmark.consume(clone);
+    }
+}
+
+}
+
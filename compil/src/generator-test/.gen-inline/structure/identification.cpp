@@ -0,0 +1,574 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "structure/identification.h"
+// Compil C++ Template Library
+#include "core/compil/object_slab.h"
+// Standard C Library
+#include <string.h>
+
+namespace identification
+{
+
+Structure1::Structure1()
+        : mWeight(default_weight())
+{
+}
+
+Structure1::~Structure1()
+{
+}
+
+size_t Structure1::staticInprocId()
+{
+    return (size_t)"structure.Structure1";
+}
+
+size_t Structure1::runtimeInprocId() const
+{
+    return staticInprocId();
+}
+
+long Structure1::default_weight()
+{
+    return 0;
+}
+
+Structure2a::Structure2a()
+{
+}
+
+Structure2a::~Structure2a()
+{
+}
+
+Structure2aSPtr Structure2a::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2a>(object);
+}
+
+Structure2a& Structure2a::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure2b::Structure2b()
+{
+}
+
+Structure2b::~Structure2b()
+{
+}
+
+Structure2bSPtr Structure2b::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2b>(object);
+}
+
+Structure2b& Structure2b::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure3aa::Structure3aa()
+{
+}
+
+Structure3aa::~Structure3aa()
+{
+}
+
+Structure3aaSPtr Structure3aa::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure3aa>(object);
+}
+
+Structure3aa& Structure3aa::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure3ab::Structure3ab()
+{
+}
+
+Structure3ab::~Structure3ab()
+{
+}
+
+Structure3abSPtr Structure3ab::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure3ab>(object);
+}
+
+Structure3ab& Structure3ab::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure3ba::Structure3ba()
+{
+}
+
+Structure3ba::~Structure3ba()
+{
+}
+
+Structure3baSPtr Structure3ba::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure3ba>(object);
+}
+
+Structure3ba& Structure3ba::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure3bb::Structure3bb()
+{
+}
+
+Structure3bb::~Structure3bb()
+{
+}
+
+Structure3bbSPtr Structure3bb::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure3bb>(object);
+}
+
+Structure3bb& Structure3bb::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+EStructure1Id::EStructure1Id()
+        : mValue(kInvalid)
+{
+}
+
+EStructure1Id::EStructure1Id(long value)
+        : mValue(value)
+{
+}
+
+const EStructure1Id EStructure1Id::invalid()
+{
+    return EStructure1Id(kInvalid);
+}
+
+const EStructure1Id EStructure1Id::structure1()
+{
+    return EStructure1Id(kStructure1);
+}
+
+const EStructure1Id EStructure1Id::structure2a()
+{
+    return EStructure1Id(kStructure2a);
+}
+
+const EStructure1Id EStructure1Id::structure3aa()
+{
+    return EStructure1Id(kStructure3aa);
+}
+
+const EStructure1Id EStructure1Id::structure3ba()
+{
+    return EStructure1Id(kStructure3ba);
+}
+
+long EStructure1Id::value() const
+{
+    return mValue;
+}
+
+const char* EStructure1Id::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "Structure1",
+        "Structure2a",
+        "Structure3aa",
+        "Structure3ba",
+    };
+    return names[(size_t)value];
+}
+
+const char* EStructure1Id::shortName() const
+{
+    return shortName(value());
+}
+
+EStructure1Id EStructure1Id::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        1, 0, 15,
+    };
+    static const char* names[] =
+    {
+        "Structure3ba",
+        "invalid",
+        "Structure2a",
+        "Structure1",
+        "Structure3aa",
+    };
+    static const size_t lengths[] =
+    {
+        12, 7, 11, 10, 12,
+    };
+    static const long values[] =
+    {
+        kStructure3ba,
+        kInvalid,
+        kStructure2a,
+        kStructure1,
+        kStructure3aa,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 3]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 5;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return EStructure1Id();
+    return EStructure1Id(values[slot]);
+}
+
+bool EStructure1Id::operator==(const EStructure1Id& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EStructure1Id::operator!=(const EStructure1Id& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EStructure1Id Structure1::staticStructure1Id()
+{
+    return EStructure1Id::structure1();
+}
+
+EStructure1Id Structure1::runtimeStructure1Id() const
+{
+    return staticStructure1Id();
+}
+
+EStructure1Id Structure2a::staticStructure1Id()
+{
+    return EStructure1Id::structure2a();
+}
+
+EStructure1Id Structure2a::runtimeStructure1Id() const
+{
+    return staticStructure1Id();
+}
+
+EStructure1Id Structure3aa::staticStructure1Id()
+{
+    return EStructure1Id::structure3aa();
+}
+
+EStructure1Id Structure3aa::runtimeStructure1Id() const
+{
+    return staticStructure1Id();
+}
+
+EStructure1Id Structure3ba::staticStructure1Id()
+{
+    return EStructure1Id::structure3ba();
+}
+
+EStructure1Id Structure3ba::runtimeStructure1Id() const
+{
+    return staticStructure1Id();
+}
+
+Structure1SPtr Structure1aFactory::clone(const Structure1SPtr& pObject)
+{
+    switch (pObject->runtimeStructure1Id().value())
+    {
+        case EStructure1Id::kStructure1:
+        {
+            Structure1SPtr pClone(new Structure1());
+            *pClone = *pObject;
+            return pClone;
+        }
+        case EStructure1Id::kStructure2a:
+        {
+            Structure2aSPtr pClone(new Structure2a());
+            *pClone = *downcastStructure2a(pObject);
+            return pClone;
+        }
+        case EStructure1Id::kStructure3aa:
+        {
+            Structure3aaSPtr pClone(new Structure3aa());
+            *pClone = *downcastStructure3aa(pObject);
+            return pClone;
+        }
+        case EStructure1Id::kStructure3ba:
+        {
+            Structure3baSPtr pClone(new Structure3ba());
+            *pClone = *downcastStructure3ba(pObject);
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return Structure1SPtr();
+}
+
+std::vector<Structure1SPtr> Structure1aFactory::cloneAll(const std::vector<Structure1SPtr>& objects)
+{
+    // the null objects get the invalid identifier and stay null
+    std::vector<long> ids(objects.size(), 0);
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i])
+            ids[i] = objects[i]->runtimeStructure1Id().value();
+    }
+
+    std::vector<Structure1SPtr> result;
+    slab_cloner<Structure1> cloner(objects, ids, 5, result);
+    cloner.clone<Structure1>(EStructure1Id::kStructure1);
+    cloner.clone<Structure2a>(EStructure1Id::kStructure2a);
+    cloner.clone<Structure3aa>(EStructure1Id::kStructure3aa);
+    cloner.clone<Structure3ba>(EStructure1Id::kStructure3ba);
+    return result;
+}
+
+Structure2aSPtr Structure1aFactory::downcastStructure2a(const Structure1SPtr& pObject)
+{
+    bool b = (pObject->runtimeStructure1Id() == Structure2a::staticStructure1Id())
+          // or any of the derived classes
+          || (pObject->runtimeStructure1Id() == Structure3aa::staticStructure1Id());
+
+    if (b)
+        return boost::static_pointer_cast<Structure2a>(pObject);
+    return Structure2aSPtr();
+}
+
+Structure3aaSPtr Structure1aFactory::downcastStructure3aa(const Structure1SPtr& pObject)
+{
+    bool b = (pObject->runtimeStructure1Id() == Structure3aa::staticStructure1Id());
+
+    if (b)
+        return boost::static_pointer_cast<Structure3aa>(pObject);
+    return Structure3aaSPtr();
+}
+
+Structure3baSPtr Structure1aFactory::downcastStructure3ba(const Structure1SPtr& pObject)
+{
+    bool b = (pObject->runtimeStructure1Id() == Structure3ba::staticStructure1Id());
+
+    if (b)
+        return boost::static_pointer_cast<Structure3ba>(pObject);
+    return Structure3baSPtr();
+}
+
+SharedStructure1::SharedStructure1()
+        : mWeight(default_weight())
+{
+}
+
+SharedStructure1::~SharedStructure1()
+{
+}
+
+long SharedStructure1::default_weight()
+{
+    return 0;
+}
+
+SharedStructure2::SharedStructure2()
+{
+}
+
+SharedStructure2::~SharedStructure2()
+{
+}
+
+SharedStructure2SPtr SharedStructure2::downcast(const SharedStructure1SPtr& object)
+{
+    return boost::static_pointer_cast<SharedStructure2>(object);
+}
+
+SharedStructure2SPtr SharedStructure2::shared_from_this()
+{
+    return boost::static_pointer_cast<SharedStructure2>(
+        boost::enable_shared_from_this<SharedStructure1>::shared_from_this());
+}
+
+SharedStructure2SCPtr SharedStructure2::shared_from_this() const
+{
+    return boost::static_pointer_cast<const SharedStructure2>(
+        boost::enable_shared_from_this<SharedStructure1>::shared_from_this());
+}
+
+SharedStructure2& SharedStructure2::set_weight(long weight)
+{
+    SharedStructure1::set_weight(weight);
+    return *this;
+}
+
+ESharedStructure1Id::ESharedStructure1Id()
+        : mValue(kInvalid)
+{
+}
+
+ESharedStructure1Id::ESharedStructure1Id(long value)
+        : mValue(value)
+{
+}
+
+const ESharedStructure1Id ESharedStructure1Id::invalid()
+{
+    return ESharedStructure1Id(kInvalid);
+}
+
+const ESharedStructure1Id ESharedStructure1Id::sharedStructure1()
+{
+    return ESharedStructure1Id(kSharedStructure1);
+}
+
+const ESharedStructure1Id ESharedStructure1Id::sharedStructure2()
+{
+    return ESharedStructure1Id(kSharedStructure2);
+}
+
+long ESharedStructure1Id::value() const
+{
+    return mValue;
+}
+
+const char* ESharedStructure1Id::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "SharedStructure1",
+        "SharedStructure2",
+    };
+    return names[(size_t)value];
+}
+
+const char* ESharedStructure1Id::shortName() const
+{
+    return shortName(value());
+}
+
+ESharedStructure1Id ESharedStructure1Id::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        0, 0,
+    };
+    static const char* names[] =
+    {
+        "SharedStructure2",
+        "invalid",
+        "SharedStructure1",
+    };
+    static const size_t lengths[] =
+    {
+        16, 7, 16,
+    };
+    static const long values[] =
+    {
+        kSharedStructure2,
+        kInvalid,
+        kSharedStructure1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return ESharedStructure1Id();
+    return ESharedStructure1Id(values[slot]);
+}
+
+bool ESharedStructure1Id::operator==(const ESharedStructure1Id& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool ESharedStructure1Id::operator!=(const ESharedStructure1Id& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+ESharedStructure1Id SharedStructure1::staticSharedStructure1Id()
+{
+    return ESharedStructure1Id::sharedStructure1();
+}
+
+ESharedStructure1Id SharedStructure1::runtimeSharedStructure1Id() const
+{
+    return staticSharedStructure1Id();
+}
+
+ESharedStructure1Id SharedStructure2::staticSharedStructure1Id()
+{
+    return ESharedStructure1Id::sharedStructure2();
+}
+
+ESharedStructure1Id SharedStructure2::runtimeSharedStructure1Id() const
+{
+    return staticSharedStructure1Id();
+}
+
+SharedStructure1SPtr SharedStructure1Factory::clone(const SharedStructure1SPtr& pObject)
+{
+    switch (pObject->runtimeSharedStructure1Id().value())
+    {
+        case ESharedStructure1Id::kSharedStructure1:
+        {
+            SharedStructure1SPtr pClone(new SharedStructure1());
+            *pClone = *pObject;
+            return pClone;
+        }
+        case ESharedStructure1Id::kSharedStructure2:
+        {
+            SharedStructure2SPtr pClone(new SharedStructure2());
+            *pClone = *downcastSharedStructure2(pObject);
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return SharedStructure1SPtr();
+}
+
+SharedStructure2SPtr SharedStructure1Factory::downcastSharedStructure2(const SharedStructure1SPtr& pObject)
+{
+    bool b = (pObject->runtimeSharedStructure1Id() == SharedStructure2::staticSharedStructure1Id());
+
+    if (b)
+        return boost::static_pointer_cast<SharedStructure2>(pObject);
+    return SharedStructure2SPtr();
+}
+
+}
+
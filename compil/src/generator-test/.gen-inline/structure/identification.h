@@ -0,0 +1,629 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <vector>
+
+#ifndef __STRUCTURE_IDENTIFICATION_COMPIL_H_
+#define __STRUCTURE_IDENTIFICATION_COMPIL_H_
+
+#include "structure/identification.h"
+// Boost C++ Smart Pointers
+#include <boost/enable_shared_from_this.hpp>
+// Standard C Library
+#include <stddef.h>
+
+namespace identification
+{
+
+class Structure1
+{
+public:
+    // Default constructor
+                          Structure1         ();
+    // Destructor
+    virtual               ~Structure1        ();
+
+    // Identifier for the objects from Structure1 class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructure1Id staticStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructure1Id runtimeStructure1Id()            const;
+
+    // Inproc identifier for the objects from Structure1 class.
+    // Note: this identificator is unique just for the process session.
+    // There is no guarantee that the id will be the same from session to
+    // session. Do not use for serialization.
+    static  size_t        staticInprocId     ();
+    // This virtual method provides runtime inproc object identification
+    // based on the polymorphic behavior of the virtual methods. Allows
+    // having a RTTI like mechanism significantly cheaper than the RTTI
+    // provided by the compilers themselves.
+    virtual size_t        runtimeInprocId    ()            const;
+
+    // Getter method for the data field weight
+            long          weight             ()            const;
+    // Returns the default value 0 of the field weight
+    static  long          default_weight     ();
+    // Setter method for the data field weight
+            Structure1&   set_weight         (long weight);
+
+private:
+    // variable for the data field weight
+    long mWeight;
+};
+
+class Structure2a : public Structure1
+{
+public:
+    // Default constructor
+                            Structure2a        ();
+    // Destructor
+    virtual                 ~Structure2a       ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2aSPtr downcast           (const Structure1SPtr& object);
+
+    // Identifier for the objects from Structure2a class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructure1Id   staticStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructure1Id   runtimeStructure1Id()                             const;
+
+    // Setter method for the data field weight
+            Structure2a&    set_weight         (long weight);
+};
+
+class Structure2b : public Structure1
+{
+public:
+    // Default constructor
+                            Structure2b ();
+    // Destructor
+    virtual                 ~Structure2b();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2bSPtr downcast    (const Structure1SPtr& object);
+
+    // Setter method for the data field weight
+            Structure2b&    set_weight  (long weight);
+};
+
+class Structure3aa : public Structure2a
+{
+public:
+    // Default constructor
+                             Structure3aa       ();
+    // Destructor
+    virtual                  ~Structure3aa      ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure3aaSPtr downcast           (const Structure1SPtr& object);
+
+    // Identifier for the objects from Structure3aa class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructure1Id    staticStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructure1Id    runtimeStructure1Id()                             const;
+
+    // Setter method for the data field weight
+            Structure3aa&    set_weight         (long weight);
+};
+
+class Structure3ab : public Structure2a
+{
+public:
+    // Default constructor
+                             Structure3ab ();
+    // Destructor
+    virtual                  ~Structure3ab();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure3abSPtr downcast     (const Structure1SPtr& object);
+
+    // Setter method for the data field weight
+            Structure3ab&    set_weight   (long weight);
+};
+
+class Structure3ba : public Structure2b
+{
+public:
+    // Default constructor
+                             Structure3ba       ();
+    // Destructor
+    virtual                  ~Structure3ba      ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure3baSPtr downcast           (const Structure1SPtr& object);
+
+    // Identifier for the objects from Structure3ba class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructure1Id    staticStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructure1Id    runtimeStructure1Id()                             const;
+
+    // Setter method for the data field weight
+            Structure3ba&    set_weight         (long weight);
+};
+
+class Structure3bb : public Structure2b
+{
+public:
+    // Default constructor
+                             Structure3bb ();
+    // Destructor
+    virtual                  ~Structure3bb();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure3bbSPtr downcast     (const Structure1SPtr& object);
+
+    // Setter method for the data field weight
+            Structure3bb&    set_weight   (long weight);
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EStructure1Id
+{
+public:
+    // Default constructor - sets the value to invalid
+                           EStructure1Id();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit               EStructure1Id(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long          value        ()                              const;
+    // Returns short name for a specified enum value
+    static   const char*   shortName    (long value);
+    // Returns short name of the enum value
+             const char*   shortName    ()                              const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   EStructure1Id fromString   (const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool          operator==   (const EStructure1Id& rValue)   const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool          operator!=   (const EStructure1Id& rValue)   const;
+
+    // static methods for enum class objects
+    static const EStructure1Id invalid     ();
+    static const EStructure1Id structure1  ();
+    static const EStructure1Id structure2a ();
+    static const EStructure1Id structure3aa();
+    static const EStructure1Id structure3ba();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid      = 0,
+        kStructure1   = 1,
+        kStructure2a  = 2,
+        kStructure3aa = 3,
+        kStructure3ba = 4,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class Structure1aFactory
+{
+public:
+    static Structure1SPtr   clone               (const Structure1SPtr& object);
+    static Structure2aSPtr  downcastStructure2a (const Structure1SPtr& object);
+    static Structure3aaSPtr downcastStructure3aa(const Structure1SPtr& object);
+    static Structure3baSPtr downcastStructure3ba(const Structure1SPtr& object);
+
+    // Clones all the objects, preserving their order. The objects of the
+    // same type are copied together in a contiguous slab. The slab and all
+    // its clones are released with the last of them, a surviving clone
+    // keeps its siblings alive without running their destructors.
+    static std::vector<Structure1SPtr> cloneAll(const std::vector<Structure1SPtr>& objects);
+};
+
+// Static visitor of the Structure1 hierarchy. The accept method dispatches
+// the object with a single indirect call through a table indexed by its
+// runtime identification. The derived visitor overrides visit for the
+// structures it handles and brings the rest in scope with a using
+// declaration. The visits it does not override fall back to the visit of
+// the nearest identified base structure.
+template<class Derived, class Result = void>
+class Structure1Visitor
+{
+public:
+    Result accept(const Structure1SPtr& object)
+    {
+        typedef Result (*Thunk)(Derived&, const Structure1SPtr&);
+        // the table follows the values of the identification enumeration
+        static const Thunk thunks[] =
+        {
+            &thunk<Structure1>,
+            &thunk<Structure1>,
+            &thunk<Structure2a>,
+            &thunk<Structure3aa>,
+            &thunk<Structure3ba>,
+        };
+        return thunks[object->runtimeStructure1Id().value()](static_cast<Derived&>(*this), object);
+    }
+
+    Result visit(const Structure1SPtr&)
+    {
+        return Result();
+    }
+
+    Result visit(const Structure2aSPtr& object)
+    {
+        return static_cast<Derived*>(this)->visit(Structure1SPtr(object));
+    }
+
+    Result visit(const Structure3aaSPtr& object)
+    {
+        return static_cast<Derived*>(this)->visit(Structure2aSPtr(object));
+    }
+
+    Result visit(const Structure3baSPtr& object)
+    {
+        return static_cast<Derived*>(this)->visit(Structure1SPtr(object));
+    }
+
+protected:
+    ~Structure1Visitor()
+    {
+    }
+
+private:
+    template<class T>
+    static Result thunk(Derived& visitor, const Structure1SPtr& object)
+    {
+        return visitor.visit(boost::static_pointer_cast<T>(object));
+    }
+};
+
+class SharedStructure1 : public boost::enable_shared_from_this<SharedStructure1>
+{
+public:
+    // Default constructor
+                                SharedStructure1         ();
+    // Destructor
+    virtual                     ~SharedStructure1        ();
+
+    // Identifier for the objects from SharedStructure1 class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  ESharedStructure1Id staticSharedStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual ESharedStructure1Id runtimeSharedStructure1Id()            const;
+
+    // Getter method for the data field weight
+            long                weight                   ()            const;
+    // Returns the default value 0 of the field weight
+    static  long                default_weight           ();
+    // Setter method for the data field weight
+            SharedStructure1&   set_weight               (long weight);
+
+private:
+    // variable for the data field weight
+    long mWeight;
+};
+
+class SharedStructure2 : public SharedStructure1
+{
+public:
+    // Default constructor
+                                  SharedStructure2         ();
+    // Destructor
+    virtual                       ~SharedStructure2        ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  SharedStructure2SPtr  downcast                 (const SharedStructure1SPtr& object);
+    // shared_from_this is a helper method that overrides the
+    // shared_from_this method that is implemented in
+    // boost::enable_shared_from_this base class. The only purpose of this
+    // helper method is to eliminate the need of downcasting to shared_ptr
+    // to this class.
+            SharedStructure2SPtr  shared_from_this         ();
+    // This method is exactly the same as the previous one with exception
+    // that it allows shared_from_this to be called from const methods.
+            SharedStructure2SCPtr shared_from_this         ()                                   const;
+
+    // Identifier for the objects from SharedStructure2 class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  ESharedStructure1Id   staticSharedStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual ESharedStructure1Id   runtimeSharedStructure1Id()                                   const;
+
+    // Setter method for the data field weight
+            SharedStructure2&     set_weight               (long weight);
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class ESharedStructure1Id
+{
+public:
+    // Default constructor - sets the value to invalid
+                                 ESharedStructure1Id();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit                     ESharedStructure1Id(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long                value              ()                                  const;
+    // Returns short name for a specified enum value
+    static   const char*         shortName          (long value);
+    // Returns short name of the enum value
+             const char*         shortName          ()                                  const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   ESharedStructure1Id fromString         (const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool                operator==         (const ESharedStructure1Id& rValue) const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool                operator!=         (const ESharedStructure1Id& rValue) const;
+
+    // static methods for enum class objects
+    static const ESharedStructure1Id invalid         ();
+    static const ESharedStructure1Id sharedStructure1();
+    static const ESharedStructure1Id sharedStructure2();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid          = 0,
+        kSharedStructure1 = 1,
+        kSharedStructure2 = 2,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class SharedStructure1Factory
+{
+public:
+    static SharedStructure1SPtr clone                   (const SharedStructure1SPtr& object);
+    static SharedStructure2SPtr downcastSharedStructure2(const SharedStructure1SPtr& object);
+};
+
+// Static visitor of the SharedStructure1 hierarchy. The accept method
+// dispatches the object with a single indirect call through a table
+// indexed by its runtime identification. The derived visitor overrides
+// visit for the structures it handles and brings the rest in scope with a
+// using declaration. The visits it does not override fall back to the
+// visit of the nearest identified base structure.
+template<class Derived, class Result = void>
+class SharedStructure1Visitor
+{
+public:
+    Result accept(const SharedStructure1SPtr& object)
+    {
+        typedef Result (*Thunk)(Derived&, const SharedStructure1SPtr&);
+        // the table follows the values of the identification enumeration
+        static const Thunk thunks[] =
+        {
+            &thunk<SharedStructure1>,
+            &thunk<SharedStructure1>,
+            &thunk<SharedStructure2>,
+        };
+        return thunks[object->runtimeSharedStructure1Id().value()](static_cast<Derived&>(*this), object);
+    }
+
+    Result visit(const SharedStructure1SPtr&)
+    {
+        return Result();
+    }
+
+    Result visit(const SharedStructure2SPtr& object)
+    {
+        return static_cast<Derived*>(this)->visit(SharedStructure1SPtr(object));
+    }
+
+protected:
+    ~SharedStructure1Visitor()
+    {
+    }
+
+private:
+    template<class T>
+    static Result thunk(Derived& visitor, const SharedStructure1SPtr& object)
+    {
+        return visitor.visit(boost::static_pointer_cast<T>(object));
+    }
+};
+
+inline long Structure1::weight() const
+{
+    return mWeight;
+}
+
+inline Structure1& Structure1::set_weight(long weight)
+{
+    mWeight = weight;
+    return *this;
+}
+
+inline long SharedStructure1::weight() const
+{
+    return mWeight;
+}
+
+inline SharedStructure1& SharedStructure1::set_weight(long weight)
+{
+    mWeight = weight;
+    return *this;
+}
+
+}
+
+#else // __STRUCTURE_IDENTIFICATION_COMPIL_H_
+
+namespace identification
+{
+
+// Forward declarations
+class Structure1;
+typedef Structure1*                         Structure1RPtr;
+typedef boost::shared_ptr<Structure1>       Structure1SPtr;
+typedef boost::shared_ptr<const Structure1> Structure1SCPtr;
+typedef boost::weak_ptr<Structure1>         Structure1WPtr;
+
+class EStructure1Id;
+
+class Structure2a;
+typedef Structure2a*                         Structure2aRPtr;
+typedef boost::shared_ptr<Structure2a>       Structure2aSPtr;
+typedef boost::shared_ptr<const Structure2a> Structure2aSCPtr;
+typedef boost::weak_ptr<Structure2a>         Structure2aWPtr;
+
+class Structure2b;
+typedef Structure2b*                         Structure2bRPtr;
+typedef boost::shared_ptr<Structure2b>       Structure2bSPtr;
+typedef boost::shared_ptr<const Structure2b> Structure2bSCPtr;
+typedef boost::weak_ptr<Structure2b>         Structure2bWPtr;
+
+class Structure3aa;
+typedef Structure3aa*                         Structure3aaRPtr;
+typedef boost::shared_ptr<Structure3aa>       Structure3aaSPtr;
+typedef boost::shared_ptr<const Structure3aa> Structure3aaSCPtr;
+typedef boost::weak_ptr<Structure3aa>         Structure3aaWPtr;
+
+class Structure3ab;
+typedef Structure3ab*                         Structure3abRPtr;
+typedef boost::shared_ptr<Structure3ab>       Structure3abSPtr;
+typedef boost::shared_ptr<const Structure3ab> Structure3abSCPtr;
+typedef boost::weak_ptr<Structure3ab>         Structure3abWPtr;
+
+class Structure3ba;
+typedef Structure3ba*                         Structure3baRPtr;
+typedef boost::shared_ptr<Structure3ba>       Structure3baSPtr;
+typedef boost::shared_ptr<const Structure3ba> Structure3baSCPtr;
+typedef boost::weak_ptr<Structure3ba>         Structure3baWPtr;
+
+class Structure3bb;
+typedef Structure3bb*                         Structure3bbRPtr;
+typedef boost::shared_ptr<Structure3bb>       Structure3bbSPtr;
+typedef boost::shared_ptr<const Structure3bb> Structure3bbSCPtr;
+typedef boost::weak_ptr<Structure3bb>         Structure3bbWPtr;
+
+class Structure1aFactory;
+typedef Structure1aFactory*                         Structure1aFactoryRPtr;
+typedef boost::shared_ptr<Structure1aFactory>       Structure1aFactorySPtr;
+typedef boost::shared_ptr<const Structure1aFactory> Structure1aFactorySCPtr;
+typedef boost::weak_ptr<Structure1aFactory>         Structure1aFactoryWPtr;
+
+typedef EStructure1Id*                         EStructure1IdRPtr;
+typedef boost::shared_ptr<EStructure1Id>       EStructure1IdSPtr;
+typedef boost::shared_ptr<const EStructure1Id> EStructure1IdSCPtr;
+typedef boost::weak_ptr<EStructure1Id>         EStructure1IdWPtr;
+
+class SharedStructure1;
+typedef SharedStructure1*                         SharedStructure1RPtr;
+typedef boost::shared_ptr<SharedStructure1>       SharedStructure1SPtr;
+typedef boost::shared_ptr<const SharedStructure1> SharedStructure1SCPtr;
+typedef boost::weak_ptr<SharedStructure1>         SharedStructure1WPtr;
+
+class ESharedStructure1Id;
+
+class SharedStructure2;
+typedef SharedStructure2*                         SharedStructure2RPtr;
+typedef boost::shared_ptr<SharedStructure2>       SharedStructure2SPtr;
+typedef boost::shared_ptr<const SharedStructure2> SharedStructure2SCPtr;
+typedef boost::weak_ptr<SharedStructure2>         SharedStructure2WPtr;
+
+class SharedStructure1Factory;
+typedef SharedStructure1Factory*                         SharedStructure1FactoryRPtr;
+typedef boost::shared_ptr<SharedStructure1Factory>       SharedStructure1FactorySPtr;
+typedef boost::shared_ptr<const SharedStructure1Factory> SharedStructure1FactorySCPtr;
+typedef boost::weak_ptr<SharedStructure1Factory>         SharedStructure1FactoryWPtr;
+
+typedef ESharedStructure1Id*                         ESharedStructure1IdRPtr;
+typedef boost::shared_ptr<ESharedStructure1Id>       ESharedStructure1IdSPtr;
+typedef boost::shared_ptr<const ESharedStructure1Id> ESharedStructure1IdSCPtr;
+typedef boost::weak_ptr<ESharedStructure1Id>         ESharedStructure1IdWPtr;
+
+}
+
+#endif // __STRUCTURE_IDENTIFICATION_COMPIL_H_
+
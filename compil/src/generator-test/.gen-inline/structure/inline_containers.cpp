@@ -0,0 +1,154 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "structure/inline_containers.h"
+
+namespace inline_containers
+{
+
+Sample::Sample()
+        : mBits(0)
+{
+}
+
+Sample::~Sample()
+{
+}
+
+bool Sample::isVoid() const
+{
+    if (exist_coordinates()) return false;
+    if (exist_fills()) return false;
+    if (exist_names()) return false;
+    return true;
+}
+
+boost::array<long, 3>& Sample::mutable_coordinates()
+{
+    mBits |= bitmask_coordinates();
+    return mCoordinates;
+}
+
+Sample& Sample::operator<<(const boost::array<long, 3>& coordinates)
+{
+    return set_coordinates(coordinates);
+}
+
+const SampleSPtr& operator<<(const SampleSPtr& object, const boost::array<long, 3>& coordinates)
+{
+    BOOST_ASSERT(object);
+    *object << coordinates;
+    return object;
+}
+
+void Sample::clear_coordinates()
+{
+    mCoordinates.assign(long());
+    mBits &= ~bitmask_coordinates();
+}
+
+small_vector<long, 2>& Sample::mutable_fills()
+{
+    mBits |= bitmask_fills();
+    return mFills;
+}
+
+Sample& Sample::operator<<(const small_vector<long, 2>& fills)
+{
+    return set_fills(fills);
+}
+
+const SampleSPtr& operator<<(const SampleSPtr& object, const small_vector<long, 2>& fills)
+{
+    BOOST_ASSERT(object);
+    *object << fills;
+    return object;
+}
+
+Sample& Sample::operator<<(long fillsItem)
+{
+    mBits |= bitmask_fills();
+    mFills.push_back(fillsItem);
+    return *this;
+}
+
+const SampleSPtr& operator<<(const SampleSPtr& object, long fillsItem)
+{
+    BOOST_ASSERT(object);
+    *object << fillsItem;
+    return object;
+}
+
+void Sample::clear_fills()
+{
+    mFills.clear();
+    mBits &= ~bitmask_fills();
+}
+
+small_vector<std::string, 2>& Sample::mutable_names()
+{
+    mBits |= bitmask_names();
+    return mNames;
+}
+
+Sample& Sample::operator<<(const small_vector<std::string, 2>& names)
+{
+    return set_names(names);
+}
+
+const SampleSPtr& operator<<(const SampleSPtr& object, const small_vector<std::string, 2>& names)
+{
+    BOOST_ASSERT(object);
+    *object << names;
+    return object;
+}
+
+Sample& Sample::operator<<(const std::string& namesItem)
+{
+    mBits |= bitmask_names();
+    mNames.push_back(namesItem);
+    return *this;
+}
+
+const SampleSPtr& operator<<(const SampleSPtr& object, const std::string& namesItem)
+{
+    BOOST_ASSERT(object);
+    *object << namesItem;
+    return object;
+}
+
+void Sample::clear_names()
+{
+    mNames.clear();
+    mBits &= ~bitmask_names();
+}
+
+Entry::Entry()
+        : mBits(0)
+{
+}
+
+Entry::~Entry()
+{
+}
+
+void Entry::erase_id()
+{
+    mId    =  0;
+    mBits &= ~bitmask_id();
+}
+
+small_vector<long, 4>& Entry::mutable_fills()
+{
+    mBits |= bitmask_fills();
+    return mFills;
+}
+
+void Entry::clear_fills()
+{
+    mFills.clear();
+    mBits &= ~bitmask_fills();
+}
+
+}
+
@@ -0,0 +1,310 @@
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <string>
+
+#ifndef __STRUCTURE_INLINE_CONTAINERS_COMPIL_H_
+#define __STRUCTURE_INLINE_CONTAINERS_COMPIL_H_
+
+#include "structure/inline_containers.h"
+// Compil C++ Template Library
+#include "core/compil/small_vector.h"
+// Boost C++ Array
+#include <boost/array.hpp>
+
+namespace inline_containers
+{
+
+class Sample
+{
+public:
+    // Default constructor
+                                                Sample             ();
+    // Destructor
+    /*lax*/                                     ~Sample            ();
+
+    // Returns true if every required field is initialized.
+            bool                                isInitialized      ()                                          const;
+
+            bool                                isVoid             ()                                          const;
+
+    // Getter method for the data field coordinates
+            const boost::array<long, 3>&        coordinates        ()                                          const;
+    // Checks if the optional field coordinates exists
+            bool                                exist_coordinates  ()                                          const;
+    // Setter method for the data field coordinates
+            Sample&                             set_coordinates    (const boost::array<long, 3>& coordinates);
+    // Provides mutable access to field coordinates
+            boost::array<long, 3>&              mutable_coordinates();
+    // Store operator for the data field coordinates
+            Sample&                             operator<<         (const boost::array<long, 3>& coordinates);
+    // Clears the optional data field coordinates
+            void                                clear_coordinates  ();
+
+    // Getter method for the data field fills
+            const small_vector<long, 2>&        fills              ()                                          const;
+    // Checks if the optional field fills exists
+            bool                                exist_fills        ()                                          const;
+    // Setter method for the data field fills
+            Sample&                             set_fills          (const small_vector<long, 2>& fills);
+    // Provides mutable access to field fills
+            small_vector<long, 2>&              mutable_fills      ();
+    // Store operator for the data field fills
+            Sample&                             operator<<         (const small_vector<long, 2>& fills);
+    // Store operator for an item of data field fills
+            Sample&                             operator<<         (long fillsItem);
+    // Clears the optional data field fills
+            void                                clear_fills        ();
+
+    // Getter method for the data field names
+            const small_vector<std::string, 2>& names              ()                                          const;
+    // Checks if the optional field names exists
+            bool                                exist_names        ()                                          const;
+    // Setter method for the data field names
+            Sample&                             set_names          (const small_vector<std::string, 2>& names);
+    // Provides mutable access to field names
+            small_vector<std::string, 2>&       mutable_names      ();
+    // Store operator for the data field names
+            Sample&                             operator<<         (const small_vector<std::string, 2>& names);
+    // Store operator for an item of data field names
+            Sample&                             operator<<         (const std::string& namesItem);
+    // Clears the optional data field names
+            void                                clear_names        ();
+
+private:
+    // Returns unique bitmask value for the field coordinates
+    static int bitmask_coordinates();
+    // Returns unique bitmask value for the field fills
+    static int bitmask_fills      ();
+    // Returns unique bitmask value for the field names
+    static int bitmask_names      ();
+
+    // Stores availability information for the fields
+    int                          mBits;
+
+    // variable for the data field coordinates
+    boost::array<long, 3>        mCoordinates;
+    // variable for the data field fills
+    small_vector<long, 2>        mFills;
+    // variable for the data field names
+    small_vector<std::string, 2> mNames;
+};
+
+// Reference store operator for the data field coordinates
+const SampleSPtr& operator<<(const SampleSPtr& , const boost::array<long, 3>& );
+// Reference store operator for the data field fills
+const SampleSPtr& operator<<(const SampleSPtr& , const small_vector<long, 2>& );
+// Reference store operator for an item of data field fills
+const SampleSPtr& operator<<(const SampleSPtr& , long );
+// Reference store operator for the data field names
+const SampleSPtr& operator<<(const SampleSPtr& , const small_vector<std::string, 2>& );
+// Reference store operator for an item of data field names
+const SampleSPtr& operator<<(const SampleSPtr& , const std::string& );
+
+class Entry
+{
+public:
+    // Default constructor
+                                         Entry        ();
+    // Destructor
+    /*lax*/                              ~Entry       ();
+
+    // Returns true if every required field is initialized.
+            bool                         isInitialized()                                   const;
+
+    // Getter method for the data field id
+            long                         id           ()                                   const;
+    // Returns true if the data field id was set and could be considered
+    // valid
+            bool                         valid_id     ()                                   const;
+    // Setter method for the data field id
+            Entry&                       set_id       (long id);
+    // Erases the required data field id. Object can not be instantiated
+    // before the field data is set again
+            void                         erase_id     ();
+
+    // Getter method for the data field fills
+            const small_vector<long, 4>& fills        ()                                   const;
+    // Checks if the optional field fills exists
+            bool                         exist_fills  ()                                   const;
+    // Setter method for the data field fills
+            Entry&                       set_fills    (const small_vector<long, 4>& fills);
+    // Provides mutable access to field fills
+            small_vector<long, 4>&       mutable_fills();
+    // Clears the optional data field fills
+            void                         clear_fills  ();
+
+private:
+    // Returns unique bitmask value for the field id
+    static int bitmask_id   ();
+    // Returns unique bitmask value for the field fills
+    static int bitmask_fills();
+
+    // Stores availability information for the fields
+    int                   mBits;
+
+    // variable for the data field id
+    long                  mId;
+    // variable for the data field fills
+    small_vector<long, 4> mFills;
+};
+
+inline SampleSPtr sampleRef()
+{
+    return boost::make_shared<Sample>();
+}
+
+inline int Sample::bitmask_coordinates()
+{
+    return 0x1;
+}
+
+inline int Sample::bitmask_fills()
+{
+    return 0x2;
+}
+
+inline int Sample::bitmask_names()
+{
+    return 0x4;
+}
+
+inline bool Sample::isInitialized() const
+{
+    return true;
+}
+
+inline const boost::array<long, 3>& Sample::coordinates() const
+{
+    BOOST_ASSERT(exist_coordinates());
+    return mCoordinates;
+}
+
+inline bool Sample::exist_coordinates() const
+{
+    return (mBits & bitmask_coordinates()) != 0;
+}
+
+inline Sample& Sample::set_coordinates(const boost::array<long, 3>& coordinates)
+{
+    mCoordinates  = coordinates;
+    mBits        |= bitmask_coordinates();
+    return *this;
+}
+
+inline const small_vector<long, 2>& Sample::fills() const
+{
+    BOOST_ASSERT(exist_fills());
+    return mFills;
+}
+
+inline bool Sample::exist_fills() const
+{
+    return (mBits & bitmask_fills()) != 0;
+}
+
+inline Sample& Sample::set_fills(const small_vector<long, 2>& fills)
+{
+    mFills  = fills;
+    mBits  |= bitmask_fills();
+    return *this;
+}
+
+inline const small_vector<std::string, 2>& Sample::names() const
+{
+    BOOST_ASSERT(exist_names());
+    return mNames;
+}
+
+inline bool Sample::exist_names() const
+{
+    return (mBits & bitmask_names()) != 0;
+}
+
+inline Sample& Sample::set_names(const small_vector<std::string, 2>& names)
+{
+    mNames  = names;
+    mBits  |= bitmask_names();
+    return *this;
+}
+
+inline int Entry::bitmask_id()
+{
+    return 0x1;
+}
+
+inline int Entry::bitmask_fills()
+{
+    return 0x2;
+}
+
+inline bool Entry::isInitialized() const
+{
+    if (!valid_id()) return false;
+    return true;
+}
+
+inline long Entry::id() const
+{
+    BOOST_ASSERT(valid_id());
+    return mId;
+}
+
+inline bool Entry::valid_id() const
+{
+    return (mBits & bitmask_id()) != 0;
+}
+
+inline Entry& Entry::set_id(long id)
+{
+    mId    = id;
+    mBits |= bitmask_id();
+    return *this;
+}
+
+inline const small_vector<long, 4>& Entry::fills() const
+{
+    BOOST_ASSERT(exist_fills());
+    return mFills;
+}
+
+inline bool Entry::exist_fills() const
+{
+    return (mBits & bitmask_fills()) != 0;
+}
+
+inline Entry& Entry::set_fills(const small_vector<long, 4>& fills)
+{
+    mFills  = fills;
+    mBits  |= bitmask_fills();
+    return *this;
+}
+
+}
+
+#else // __STRUCTURE_INLINE_CONTAINERS_COMPIL_H_
+
+namespace inline_containers
+{
+
+// Forward declarations
+class Sample;
+typedef Sample*                         SampleRPtr;
+typedef boost::shared_ptr<Sample>       SampleSPtr;
+typedef boost::shared_ptr<const Sample> SampleSCPtr;
+typedef boost::weak_ptr<Sample>         SampleWPtr;
+
+class Entry;
+typedef Entry*                         EntryRPtr;
+typedef boost::shared_ptr<Entry>       EntrySPtr;
+typedef boost::shared_ptr<const Entry> EntrySCPtr;
+typedef boost::weak_ptr<Entry>         EntryWPtr;
+
+}
+
+#endif // __STRUCTURE_INLINE_CONTAINERS_COMPIL_H_
+
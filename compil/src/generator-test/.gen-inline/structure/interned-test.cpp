@@ -0,0 +1,28 @@
+#include "structure/interned.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace interned
+{
+
+
+TEST(StructureSegmentTest, available_DefaultValues)
+{
+    Segment structure1;
+    ASSERT_FALSE(structure1.valid_from());
+    ASSERT_FALSE(structure1.valid_to());
+    ASSERT_FALSE(structure1.exist_name());
+}
+
+TEST(StructureSegmentTest, negativeBuild)
+{
+    Segment::Builder builder;
+    ASSERT_THROW(builder.build(), boost::assert_exception);
+    ASSERT_THROW(builder.finalize(), boost::assert_exception);
+}
+
+
+}
+
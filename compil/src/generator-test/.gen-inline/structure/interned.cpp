@@ -0,0 +1,236 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "structure/interned.h"
+// Compil C++ Template Library
+#include "core/compil/intern_table.h"
+// Boost C++ Hash
+#include <boost/functional/hash.hpp>
+// Standard C Library
+#include <stddef.h>
+
+namespace interned
+{
+
+Point::Builder::Builder()
+        : mpObject(new Point())
+{
+}
+
+Point::Builder::Builder(const Point& object)
+        : mpObject(new Point())
+{
+    *(Point*)mpObject = object;
+}
+
+Point::Builder::Builder(PointRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Point::Builder::~Builder()
+{
+    delete (PointRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Point& Point::Builder::build() const
+{
+    return *(PointRPtr)mpObject;
+}
+
+PointSPtr Point::Builder::finalize()
+{
+    PointRPtr objectRPtr = (PointRPtr)mpObject;
+    mpObject = NULL;
+    return internTable().intern(objectRPtr);
+}
+
+Point::Point()
+{
+}
+
+Point::~Point()
+{
+}
+
+bool Point::operator==(const Point& object) const
+{
+    if (this == &object) return true;
+    if (x() != object.x()) return false;
+    if (y() != object.y()) return false;
+    return label() == object.label();
+}
+
+bool Point::operator==(const PointSPtr& object) const
+{
+    return *this == *object;
+}
+
+std::string& Point::Builder::mutable_label()
+{
+    return mpObject->mLabel.mutate();
+}
+
+size_t Point::internHash() const
+{
+    size_t seed = 0;
+    boost::hash_combine(seed, x());
+    boost::hash_combine(seed, y());
+    boost::hash_combine(seed, label());
+    return seed;
+}
+
+bool Point::internEquals(const Point& object) const
+{
+    if (this == &object) return true;
+    if (!(x() == object.x())) return false;
+    if (!(y() == object.y())) return false;
+    if (!(label() == object.label())) return false;
+    return true;
+}
+
+intern_table<Point>& Point::internTable()
+{
+    static intern_table<Point>* table = new intern_table<Point>();
+    return *table;
+}
+
+size_t Point::internTableSize()
+{
+    return internTable().size();
+}
+
+size_t Point::internTableLookups()
+{
+    return internTable().lookups();
+}
+
+size_t Point::internTableHits()
+{
+    return internTable().hits();
+}
+
+double Point::internTableHitRatio()
+{
+    return internTable().hit_ratio();
+}
+
+Segment::Builder::Builder()
+        : mpObject(new Segment())
+{
+}
+
+Segment::Builder::Builder(const Segment& object)
+        : mpObject(new Segment())
+{
+    *(Segment*)mpObject = object;
+}
+
+Segment::Builder::Builder(SegmentRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Segment::Builder::~Builder()
+{
+    delete (SegmentRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Segment& Segment::Builder::build() const
+{
+    BOOST_ASSERT(mpObject->isInitialized());
+    return *(SegmentRPtr)mpObject;
+}
+
+SegmentSPtr Segment::Builder::finalize()
+{
+    BOOST_ASSERT(mpObject->isInitialized());
+    SegmentRPtr objectRPtr = (SegmentRPtr)mpObject;
+    mpObject = NULL;
+    return internTable().intern(objectRPtr);
+}
+
+Segment::Segment()
+        : mBits(0)
+{
+}
+
+Segment::~Segment()
+{
+}
+
+void Segment::Builder::erase_from()
+{
+    mpObject->mFrom.reset();
+    mpObject->mBits &= ~bitmask_from();
+}
+
+void Segment::Builder::erase_to()
+{
+    mpObject->mTo.reset();
+    mpObject->mBits &= ~bitmask_to();
+}
+
+std::string& Segment::Builder::mutable_name()
+{
+    mpObject->mBits |= bitmask_name();
+    return mpObject->mName.mutate();
+}
+
+void Segment::Builder::clear_name()
+{
+    mpObject->mName.clear();
+    mpObject->mBits &= ~bitmask_name();
+}
+
+size_t Segment::internHash() const
+{
+    size_t seed = 0;
+    if (valid_from()) boost::hash_combine(seed, from().get());
+    if (valid_to()) boost::hash_combine(seed, to().get());
+    if (exist_name()) boost::hash_combine(seed, name());
+    return seed;
+}
+
+bool Segment::internEquals(const Segment& object) const
+{
+    if (this == &object) return true;
+    if (valid_from() != object.valid_from()) return false;
+    if (valid_from() && !(from() == object.from())) return false;
+    if (valid_to() != object.valid_to()) return false;
+    if (valid_to() && !(to() == object.to())) return false;
+    if (exist_name() != object.exist_name()) return false;
+    if (exist_name() && !(name() == object.name())) return false;
+    return true;
+}
+
+intern_table<Segment>& Segment::internTable()
+{
+    static intern_table<Segment>* table = new intern_table<Segment>();
+    return *table;
+}
+
+size_t Segment::internTableSize()
+{
+    return internTable().size();
+}
+
+size_t Segment::internTableLookups()
+{
+    return internTable().lookups();
+}
+
+size_t Segment::internTableHits()
+{
+    return internTable().hits();
+}
+
+double Segment::internTableHitRatio()
+{
+    return internTable().hit_ratio();
+}
+
+}
+
@@ -0,0 +1,420 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <string>
+
+#ifndef __STRUCTURE_INTERNED_COMPIL_H_
+#define __STRUCTURE_INTERNED_COMPIL_H_
+
+#include "structure/interned.h"
+// Compil C++ Template Library
+#include "core/compil/intern_table.h"
+#include "core/compil/shared_value.h"
+
+template<class T> class snapshot;
+
+namespace interned
+{
+
+// Point is an immutable class - once instantiated none of the data fields
+// can be changed. For the initial initialization and instantiation use the
+// nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Point
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void         operator=    (const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                             Builder      ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                             Builder      (const Point& object);
+        // Destructor of Builder
+        /*lax*/              ~Builder     ();
+
+        // Instantiates Point instance with the current initialization of
+        // the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Point& build        ()                         const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+        // Note: Point is interned - finalize() provides the already
+        // interned instance with the same fields if there is one.
+                PointSPtr    finalize     ();
+
+
+        // Setter method for the data field x
+                Builder&     set_x        (long x);
+
+        // Setter method for the data field y
+                Builder&     set_y        (long y);
+
+        // Setter method for the data field label
+                Builder&     set_label    (const std::string& label);
+        // Provides mutable access to field label
+                std::string& mutable_label();
+
+    protected:
+        // constructor needed from potential derived classes
+                             Builder      (PointRPtr pObject);
+
+        PointRPtr mpObject;
+    };
+
+    // Default constructor
+                               Point              ();
+    // Destructor
+    /*lax*/                    ~Point             ();
+
+            bool               operator==         (const Point& object)     const;
+
+            bool               operator==         (const PointSPtr& object) const;
+
+    // Getter method for the data field x
+            long               x                  ()                        const;
+
+    // Getter method for the data field y
+            long               y                  ()                        const;
+
+    // Getter method for the data field label
+            const std::string& label              ()                        const;
+
+    // Returns hash of all the fields. Used by the intern table.
+            size_t             internHash         ()                        const;
+    // Returns true if all the fields are equal. Used by the intern table.
+    // Note: The interned instances are unique, so two instances provided
+    // by finalize() are equal only if they are the same instance.
+            bool               internEquals       (const Point& object)     const;
+
+    // Returns the number of the interned instances that are still
+    // referenced
+    static  size_t             internTableSize    ();
+    // Returns the number of the finalize() calls
+    static  size_t             internTableLookups ();
+    // Returns the number of the finalize() calls that provided an already
+    // interned instance
+    static  size_t             internTableHits    ();
+    // Returns the ratio between the hits and the lookups of the intern
+    // table
+    static  double             internTableHitRatio();
+
+private:
+    // Holds the canonical instances provided by finalize(). The table is
+    // never destroyed, because the instances could outlive the static
+    // objects.
+    static intern_table<Point>& internTable();
+
+    // variable for the data field x
+    long                      mX;
+    // variable for the data field y
+    long                      mY;
+    // variable for the data field label
+    shared_value<std::string> mLabel;
+};
+
+// Holder of the current Point shared between threads. The readers get the
+// current object wait-free through a view, the writers publish the results
+// of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Point> PointSnapshot;
+
+// Segment is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Segment
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void           operator=   (const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                               Builder     ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                               Builder     (const Segment& object);
+        // Destructor of Builder
+        /*lax*/                ~Builder    ();
+
+        // Instantiates Segment instance with the current initialization of
+        // the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Segment& build       ()                        const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+        // Note: Segment is interned - finalize() provides the already
+        // interned instance with the same fields if there is one.
+                SegmentSPtr    finalize    ();
+
+
+        // Setter method for the data field from
+                Builder&       set_from    (const PointSPtr& from);
+        // Erases the required data field from. Object can not be
+        // instantiated before the field data is set again
+                void           erase_from  ();
+
+        // Setter method for the data field to
+                Builder&       set_to      (const PointSPtr& to);
+        // Erases the required data field to. Object can not be
+        // instantiated before the field data is set again
+                void           erase_to    ();
+
+        // Setter method for the data field name
+                Builder&       set_name    (const std::string& name);
+        // Provides mutable access to field name
+                std::string&   mutable_name();
+        // Clears the optional data field name
+                void           clear_name  ();
+
+    protected:
+        // constructor needed from potential derived classes
+                               Builder     (SegmentRPtr pObject);
+
+        SegmentRPtr mpObject;
+    };
+
+    // Default constructor
+                               Segment            ();
+    // Destructor
+    /*lax*/                    ~Segment           ();
+
+    // Returns true if every required field is initialized.
+    // Note: If the class is used properly it should always return true,
+    // because the object could be instantiated only if it is already
+    // initialized and can not be changed. Called by the Builder class.
+            bool               isInitialized      ()                      const;
+
+    // Getter method for the data field from
+            const PointSPtr&   from               ()                      const;
+    // Returns true if the data field from was set and could be considered
+    // valid
+    // Note: If the class is used properly it should always return true. It
+    // makes sense when it is called indirectly through isInitialized()
+    // from the Builder class
+            bool               valid_from         ()                      const;
+
+    // Getter method for the data field to
+            const PointSPtr&   to                 ()                      const;
+    // Returns true if the data field to was set and could be considered
+    // valid
+    // Note: If the class is used properly it should always return true. It
+    // makes sense when it is called indirectly through isInitialized()
+    // from the Builder class
+            bool               valid_to           ()                      const;
+
+    // Getter method for the data field name
+            const std::string& name               ()                      const;
+    // Checks if the optional field name exists
+            bool               exist_name         ()                      const;
+
+    // Returns hash of all the fields. Used by the intern table.
+            size_t             internHash         ()                      const;
+    // Returns true if all the fields are equal. Used by the intern table.
+    // Note: The interned instances are unique, so two instances provided
+    // by finalize() are equal only if they are the same instance.
+            bool               internEquals       (const Segment& object) const;
+
+    // Returns the number of the interned instances that are still
+    // referenced
+    static  size_t             internTableSize    ();
+    // Returns the number of the finalize() calls
+    static  size_t             internTableLookups ();
+    // Returns the number of the finalize() calls that provided an already
+    // interned instance
+    static  size_t             internTableHits    ();
+    // Returns the ratio between the hits and the lookups of the intern
+    // table
+    static  double             internTableHitRatio();
+
+private:
+    // Holds the canonical instances provided by finalize(). The table is
+    // never destroyed, because the instances could outlive the static
+    // objects.
+    static intern_table<Segment>& internTable();
+
+    // Returns unique bitmask value for the field from
+    static int bitmask_from();
+    // Returns unique bitmask value for the field to
+    static int bitmask_to  ();
+    // Returns unique bitmask value for the field name
+    static int bitmask_name();
+
+    // Stores availability information for the fields
+    int                       mBits;
+
+    // variable for the data field from
+    PointSPtr                 mFrom;
+    // variable for the data field to
+    PointSPtr                 mTo;
+    // variable for the data field name
+    shared_value<std::string> mName;
+};
+
+// Holder of the current Segment shared between threads. The readers get
+// the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Segment> SegmentSnapshot;
+
+inline long Point::x() const
+{
+    return mX;
+}
+
+inline Point::Builder& Point::Builder::set_x(long x)
+{
+    mpObject->mX = x;
+    return *this;
+}
+
+inline long Point::y() const
+{
+    return mY;
+}
+
+inline Point::Builder& Point::Builder::set_y(long y)
+{
+    mpObject->mY = y;
+    return *this;
+}
+
+inline const std::string& Point::label() const
+{
+    return mLabel;
+}
+
+inline Point::Builder& Point::Builder::set_label(const std::string& label)
+{
+    mpObject->mLabel = label;
+    return *this;
+}
+
+inline int Segment::bitmask_from()
+{
+    return 0x1;
+}
+
+inline int Segment::bitmask_to()
+{
+    return 0x2;
+}
+
+inline int Segment::bitmask_name()
+{
+    return 0x4;
+}
+
+inline bool Segment::isInitialized() const
+{
+    if (!valid_from()) return false;
+    if (!valid_to()) return false;
+    return true;
+}
+
+inline const PointSPtr& Segment::from() const
+{
+    BOOST_ASSERT(valid_from());
+    return mFrom;
+}
+
+inline bool Segment::valid_from() const
+{
+    return (mBits & bitmask_from()) != 0;
+}
+
+inline Segment::Builder& Segment::Builder::set_from(const PointSPtr& from)
+{
+    mpObject->mFrom  = from;
+    mpObject->mBits |= bitmask_from();
+    return *this;
+}
+
+inline const PointSPtr& Segment::to() const
+{
+    BOOST_ASSERT(valid_to());
+    return mTo;
+}
+
+inline bool Segment::valid_to() const
+{
+    return (mBits & bitmask_to()) != 0;
+}
+
+inline Segment::Builder& Segment::Builder::set_to(const PointSPtr& to)
+{
+    mpObject->mTo    = to;
+    mpObject->mBits |= bitmask_to();
+    return *this;
+}
+
+inline const std::string& Segment::name() const
+{
+    BOOST_ASSERT(exist_name());
+    return mName;
+}
+
+inline bool Segment::exist_name() const
+{
+    return (mBits & bitmask_name()) != 0;
+}
+
+inline Segment::Builder& Segment::Builder::set_name(const std::string& name)
+{
+    mpObject->mName  = name;
+    mpObject->mBits |= bitmask_name();
+    return *this;
+}
+
+}
+
+#else // __STRUCTURE_INTERNED_COMPIL_H_
+
+namespace interned
+{
+
+// Forward declarations
+class Point;
+typedef Point*                         PointRPtr;
+typedef boost::shared_ptr<Point>       PointSPtr;
+typedef boost::shared_ptr<const Point> PointSCPtr;
+typedef boost::weak_ptr<Point>         PointWPtr;
+
+class Segment;
+typedef Segment*                         SegmentRPtr;
+typedef boost::shared_ptr<Segment>       SegmentSPtr;
+typedef boost::shared_ptr<const Segment> SegmentSCPtr;
+typedef boost::weak_ptr<Segment>         SegmentWPtr;
+
+}
+
+#endif // __STRUCTURE_INTERNED_COMPIL_H_
+
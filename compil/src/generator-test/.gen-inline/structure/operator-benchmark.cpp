@@ -0,0 +1,715 @@
+#include "structure/operator.h"
+// Compil C++ core
+#include <core/platform/benchmark.h>
+// Google Test framework
+#include <gtest/gtest.h>
+// Standard C Library
+#include <string.h>
+
+namespace operator_
+{
+
+TEST(Structure1Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.Structure1.construction");
+    while (benchmark.running())
+    {
+        Structure1 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure1Benchmark, copy)
+{
+    Structure1 structure1;
+    plt::Benchmark benchmark("structure/operator.Structure1.copy");
+    while (benchmark.running())
+    {
+        Structure1 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure1Benchmark, operatorEqualTo)
+{
+    Structure1 structure1;
+    Structure1 structure2;
+    plt::Benchmark benchmark("structure/operator.Structure1.operatorEqualTo");
+    while (benchmark.running())
+    {
+        bool result = structure1 == structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(Structure1Benchmark, operatorLessThan)
+{
+    Structure1 structure1;
+    Structure1 structure2;
+    plt::Benchmark benchmark("structure/operator.Structure1.operatorLessThan");
+    while (benchmark.running())
+    {
+        bool result = structure1 < structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(Structure1Benchmark, fieldAccess)
+{
+    Structure1 structure;
+    plt::Benchmark benchmark("structure/operator.Structure1.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.i1());
+        benchmark.consume(structure.w1());
+        benchmark.consume(structure.s1());
+        benchmark.consume(structure.str1());
+    }
+}
+
+TEST(Structure1Benchmark, fieldUpdate)
+{
+    Structure1 structure;
+    plt::Benchmark benchmark("structure/operator.Structure1.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_i1(structure.i1());
+        structure.set_w1(structure.w1());
+        structure.set_s1(structure.s1());
+        structure.set_str1(structure.str1());
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure2aBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.Structure2a.construction");
+    while (benchmark.running())
+    {
+        Structure2a structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure2aBenchmark, copy)
+{
+    Structure2a structure1;
+    plt::Benchmark benchmark("structure/operator.Structure2a.copy");
+    while (benchmark.running())
+    {
+        Structure2a structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure2aBenchmark, operatorEqualTo)
+{
+    Structure2a structure1;
+    Structure2a structure2;
+    plt::Benchmark benchmark("structure/operator.Structure2a.operatorEqualTo");
+    while (benchmark.running())
+    {
+        bool result = structure1 == structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(Structure2aBenchmark, operatorLessThan)
+{
+    Structure2a structure1;
+    Structure2a structure2;
+    plt::Benchmark benchmark("structure/operator.Structure2a.operatorLessThan");
+    while (benchmark.running())
+    {
+        bool result = structure1 < structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(Structure2bBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.Structure2b.construction");
+    while (benchmark.running())
+    {
+        Structure2b structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure2bBenchmark, copy)
+{
+    Structure2b structure1;
+    plt::Benchmark benchmark("structure/operator.Structure2b.copy");
+    while (benchmark.running())
+    {
+        Structure2b structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure2bBenchmark, operatorEqualTo)
+{
+    Structure2b structure1;
+    Structure2b structure2;
+    plt::Benchmark benchmark("structure/operator.Structure2b.operatorEqualTo");
+    while (benchmark.running())
+    {
+        bool result = structure1 == structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(Structure2bBenchmark, operatorLessThan)
+{
+    Structure2b structure1;
+    Structure2b structure2;
+    plt::Benchmark benchmark("structure/operator.Structure2b.operatorLessThan");
+    while (benchmark.running())
+    {
+        bool result = structure1 < structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(Structure2bBenchmark, fieldAccess)
+{
+    Structure2b structure;
+    plt::Benchmark benchmark("structure/operator.Structure2b.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.i2());
+        benchmark.consume(structure.s2());
+    }
+}
+
+TEST(Structure2bBenchmark, fieldUpdate)
+{
+    Structure2b structure;
+    plt::Benchmark benchmark("structure/operator.Structure2b.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_i2(structure.i2());
+        structure.set_s2(structure.s2());
+        benchmark.consume(structure);
+    }
+}
+
+TEST(NoOperatorStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.NoOperatorStructure.construction");
+    while (benchmark.running())
+    {
+        NoOperatorStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(NoOperatorStructureBenchmark, copy)
+{
+    NoOperatorStructure structure1;
+    plt::Benchmark benchmark("structure/operator.NoOperatorStructure.copy");
+    while (benchmark.running())
+    {
+        NoOperatorStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(NoOperatorStructureBenchmark, fieldAccess)
+{
+    NoOperatorStructure structure;
+    plt::Benchmark benchmark("structure/operator.NoOperatorStructure.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.i());
+    }
+}
+
+TEST(NoOperatorStructureBenchmark, fieldUpdate)
+{
+    NoOperatorStructure structure;
+    plt::Benchmark benchmark("structure/operator.NoOperatorStructure.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_i(structure.i());
+        benchmark.consume(structure);
+    }
+}
+
+TEST(INoOperatorWithNativeEqStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.INoOperatorWithNativeEqStructure.construction");
+    while (benchmark.running())
+    {
+        INoOperatorWithNativeEqStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(INoOperatorWithNativeEqStructureBenchmark, copy)
+{
+    INoOperatorWithNativeEqStructure structure1;
+    plt::Benchmark benchmark("structure/operator.INoOperatorWithNativeEqStructure.copy");
+    while (benchmark.running())
+    {
+        INoOperatorWithNativeEqStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(INoOperatorWithNativeEqStructureBenchmark, operatorEqualTo)
+{
+    INoOperatorWithNativeEqStructure structure1;
+    INoOperatorWithNativeEqStructure structure2;
+    plt::Benchmark benchmark("structure/operator.INoOperatorWithNativeEqStructure.operatorEqualTo");
+    while (benchmark.running())
+    {
+        bool result = structure1 == structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(INoOperatorWithNativeLtStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.INoOperatorWithNativeLtStructure.construction");
+    while (benchmark.running())
+    {
+        INoOperatorWithNativeLtStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(INoOperatorWithNativeLtStructureBenchmark, copy)
+{
+    INoOperatorWithNativeLtStructure structure1;
+    plt::Benchmark benchmark("structure/operator.INoOperatorWithNativeLtStructure.copy");
+    while (benchmark.running())
+    {
+        INoOperatorWithNativeLtStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(INoOperatorWithNativeLtStructureBenchmark, operatorLessThan)
+{
+    INoOperatorWithNativeLtStructure structure1;
+    INoOperatorWithNativeLtStructure structure2;
+    plt::Benchmark benchmark("structure/operator.INoOperatorWithNativeLtStructure.operatorLessThan");
+    while (benchmark.running())
+    {
+        bool result = structure1 < structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(INoOperatorWithFunctionalEqStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.INoOperatorWithFunctionalEqStructure.construction");
+    while (benchmark.running())
+    {
+        INoOperatorWithFunctionalEqStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(INoOperatorWithFunctionalEqStructureBenchmark, copy)
+{
+    INoOperatorWithFunctionalEqStructure structure1;
+    plt::Benchmark benchmark("structure/operator.INoOperatorWithFunctionalEqStructure.copy");
+    while (benchmark.running())
+    {
+        INoOperatorWithFunctionalEqStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(INoOperatorWithFunctionalLtStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.INoOperatorWithFunctionalLtStructure.construction");
+    while (benchmark.running())
+    {
+        INoOperatorWithFunctionalLtStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(INoOperatorWithFunctionalLtStructureBenchmark, copy)
+{
+    INoOperatorWithFunctionalLtStructure structure1;
+    plt::Benchmark benchmark("structure/operator.INoOperatorWithFunctionalLtStructure.copy");
+    while (benchmark.running())
+    {
+        INoOperatorWithFunctionalLtStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(FunctionalEqStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.FunctionalEqStructure.construction");
+    while (benchmark.running())
+    {
+        FunctionalEqStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(FunctionalEqStructureBenchmark, copy)
+{
+    FunctionalEqStructure structure1;
+    plt::Benchmark benchmark("structure/operator.FunctionalEqStructure.copy");
+    while (benchmark.running())
+    {
+        FunctionalEqStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(IEqWithNativeEqStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.IEqWithNativeEqStructure.construction");
+    while (benchmark.running())
+    {
+        IEqWithNativeEqStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(IEqWithNativeEqStructureBenchmark, copy)
+{
+    IEqWithNativeEqStructure structure1;
+    plt::Benchmark benchmark("structure/operator.IEqWithNativeEqStructure.copy");
+    while (benchmark.running())
+    {
+        IEqWithNativeEqStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(IEqWithNativeEqStructureBenchmark, operatorEqualTo)
+{
+    IEqWithNativeEqStructure structure1;
+    IEqWithNativeEqStructure structure2;
+    plt::Benchmark benchmark("structure/operator.IEqWithNativeEqStructure.operatorEqualTo");
+    while (benchmark.running())
+    {
+        bool result = structure1 == structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(IEqWithNativeLtStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.IEqWithNativeLtStructure.construction");
+    while (benchmark.running())
+    {
+        IEqWithNativeLtStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(IEqWithNativeLtStructureBenchmark, copy)
+{
+    IEqWithNativeLtStructure structure1;
+    plt::Benchmark benchmark("structure/operator.IEqWithNativeLtStructure.copy");
+    while (benchmark.running())
+    {
+        IEqWithNativeLtStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(IEqWithNativeLtStructureBenchmark, operatorLessThan)
+{
+    IEqWithNativeLtStructure structure1;
+    IEqWithNativeLtStructure structure2;
+    plt::Benchmark benchmark("structure/operator.IEqWithNativeLtStructure.operatorLessThan");
+    while (benchmark.running())
+    {
+        bool result = structure1 < structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(IFunctionalEqWithFunctionalEqStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.IFunctionalEqWithFunctionalEqStructure.construction");
+    while (benchmark.running())
+    {
+        IFunctionalEqWithFunctionalEqStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(IFunctionalEqWithFunctionalEqStructureBenchmark, copy)
+{
+    IFunctionalEqWithFunctionalEqStructure structure1;
+    plt::Benchmark benchmark("structure/operator.IFunctionalEqWithFunctionalEqStructure.copy");
+    while (benchmark.running())
+    {
+        IFunctionalEqWithFunctionalEqStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(IFunctionalEqWithFunctionalLtStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.IFunctionalEqWithFunctionalLtStructure.construction");
+    while (benchmark.running())
+    {
+        IFunctionalEqWithFunctionalLtStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(IFunctionalEqWithFunctionalLtStructureBenchmark, copy)
+{
+    IFunctionalEqWithFunctionalLtStructure structure1;
+    plt::Benchmark benchmark("structure/operator.IFunctionalEqWithFunctionalLtStructure.copy");
+    while (benchmark.running())
+    {
+        IFunctionalEqWithFunctionalLtStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(IFunctionalEqWithFunctorEqStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.IFunctionalEqWithFunctorEqStructure.construction");
+    while (benchmark.running())
+    {
+        IFunctionalEqWithFunctorEqStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(IFunctionalEqWithFunctorEqStructureBenchmark, copy)
+{
+    IFunctionalEqWithFunctorEqStructure structure1;
+    plt::Benchmark benchmark("structure/operator.IFunctionalEqWithFunctorEqStructure.copy");
+    while (benchmark.running())
+    {
+        IFunctionalEqWithFunctorEqStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(IFunctionalEqWithFunctorLtStructureBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.IFunctionalEqWithFunctorLtStructure.construction");
+    while (benchmark.running())
+    {
+        IFunctionalEqWithFunctorLtStructure structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(IFunctionalEqWithFunctorLtStructureBenchmark, copy)
+{
+    IFunctionalEqWithFunctorLtStructure structure1;
+    plt::Benchmark benchmark("structure/operator.IFunctionalEqWithFunctorLtStructure.copy");
+    while (benchmark.running())
+    {
+        IFunctionalEqWithFunctorLtStructure structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(CompareKeyBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.CompareKey.construction");
+    while (benchmark.running())
+    {
+        CompareKey structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(CompareKeyBenchmark, copy)
+{
+    CompareKey structure1;
+    plt::Benchmark benchmark("structure/operator.CompareKey.copy");
+    while (benchmark.running())
+    {
+        CompareKey structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(CompareKeyBenchmark, operatorEqualTo)
+{
+    CompareKey structure1;
+    CompareKey structure2;
+    plt::Benchmark benchmark("structure/operator.CompareKey.operatorEqualTo");
+    while (benchmark.running())
+    {
+        bool result = structure1 == structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(CompareKeyBenchmark, operatorLessThan)
+{
+    CompareKey structure1;
+    CompareKey structure2;
+    plt::Benchmark benchmark("structure/operator.CompareKey.operatorLessThan");
+    while (benchmark.running())
+    {
+        bool result = structure1 < structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(CompareKeyBenchmark, fieldAccess)
+{
+    CompareKey structure;
+    plt::Benchmark benchmark("structure/operator.CompareKey.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.venue());
+        benchmark.consume(structure.side());
+        benchmark.consume(structure.price());
+        benchmark.consume(structure.lot());
+    }
+}
+
+TEST(CompareKeyBenchmark, fieldUpdate)
+{
+    CompareKey structure;
+    plt::Benchmark benchmark("structure/operator.CompareKey.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_venue(structure.venue());
+        structure.set_side(structure.side());
+        structure.set_price(structure.price());
+        structure.set_lot(structure.lot());
+        benchmark.consume(structure);
+    }
+}
+
+TEST(CompareRecordBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.CompareRecord.construction");
+    while (benchmark.running())
+    {
+        CompareRecord structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(CompareRecordBenchmark, copy)
+{
+    CompareRecord structure1;
+    plt::Benchmark benchmark("structure/operator.CompareRecord.copy");
+    while (benchmark.running())
+    {
+        CompareRecord structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(CompareRecordBenchmark, operatorEqualTo)
+{
+    CompareRecord structure1;
+    CompareRecord structure2;
+    plt::Benchmark benchmark("structure/operator.CompareRecord.operatorEqualTo");
+    while (benchmark.running())
+    {
+        bool result = structure1 == structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(CompareRecordBenchmark, operatorLessThan)
+{
+    CompareRecord structure1;
+    CompareRecord structure2;
+    plt::Benchmark benchmark("structure/operator.CompareRecord.operatorLessThan");
+    while (benchmark.running())
+    {
+        bool result = structure1 < structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(CompareRecordBenchmark, fieldAccess)
+{
+    CompareRecord structure;
+    plt::Benchmark benchmark("structure/operator.CompareRecord.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.symbol());
+        benchmark.consume(structure.key());
+        benchmark.consume(structure.quantity());
+    }
+}
+
+TEST(CompareRecordBenchmark, fieldUpdate)
+{
+    CompareRecord structure;
+    plt::Benchmark benchmark("structure/operator.CompareRecord.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_symbol(structure.symbol());
+        structure.set_key(structure.key());
+        structure.set_quantity(structure.quantity());
+        benchmark.consume(structure);
+    }
+}
+
+TEST(ICompareRecordBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/operator.ICompareRecord.construction");
+    while (benchmark.running())
+    {
+        ICompareRecord structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(ICompareRecordBenchmark, copy)
+{
+    ICompareRecord structure1;
+    plt::Benchmark benchmark("structure/operator.ICompareRecord.copy");
+    while (benchmark.running())
+    {
+        ICompareRecord structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(ICompareRecordBenchmark, operatorLessThan)
+{
+    ICompareRecord structure1;
+    ICompareRecord structure2;
+    plt::Benchmark benchmark("structure/operator.ICompareRecord.operatorLessThan");
+    while (benchmark.running())
+    {
+        bool result = structure1 < structure2;
+        benchmark.consume(result);
+    }
+}
+
+TEST(ICompareRecordBenchmark, fieldAccess)
+{
+    ICompareRecord structure;
+    plt::Benchmark benchmark("structure/operator.ICompareRecord.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.sequence());
+    }
+}
+
+TEST(ICompareRecordBenchmark, fieldUpdate)
+{
+    ICompareRecord structure;
+    plt::Benchmark benchmark("structure/operator.ICompareRecord.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_sequence(structure.sequence());
+        benchmark.consume(structure);
+    }
+}
+
+}
+
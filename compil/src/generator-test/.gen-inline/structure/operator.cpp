@@ -0,0 +1,1006 @@
+#include "structure/operator.h"
+// Standard C Library
+#include <string.h>
+
+namespace operator_
+{
+
+Structure1::Structure1()
+{
+}
+
+Structure1::~Structure1()
+{
+}
+
+bool Structure1::operator==(const Structure1& object) const
+{
+    if (i1() != object.i1()) return false;
+    if (w1() != object.w1()) return false;
+    if (s1() != object.s1()) return false;
+    return str1() == object.str1();
+}
+
+bool Structure1::operator==(const Structure1SPtr& object) const
+{
+    return *this == *object;
+}
+
+bool Structure1::isEqual(const Structure1& object) const
+{
+    return *this == object;
+}
+
+bool Structure1::isEqual(const Structure1SPtr& object) const
+{
+    return *this == *object;
+}
+
+int Structure1::compare(const Structure1& object) const
+{
+    // can not compare Strong
+    int result = ((object.i1() < i1()) - (i1() < object.i1())) * 2
+               + ((object.w1() < w1()) - (w1() < object.w1()));
+    if (result) return result;
+    return str1().compare(object.str1());
+}
+
+bool Structure1::operator<(const Structure1& object) const
+{
+    return compare(object) < 0;
+}
+
+bool Structure1::operator<(const Structure1SPtr& object) const
+{
+    return *this < *object;
+}
+
+bool Structure1::lessThan(const Structure1& object) const
+{
+    return *this < object;
+}
+
+bool Structure1::lessThan(const Structure1SPtr& object) const
+{
+    return *this < *object;
+}
+
+bool Structure1::lessThan::operator()(const Structure1& object1, const Structure1& object2) const
+{
+    return object1 < object2;
+}
+
+bool Structure1::lessThan::operator()(const Structure1SPtr& object1, const Structure1SPtr& object2) const
+{
+    return *object1 < *object2;
+}
+
+Structure1::EWeak::EWeak()
+        : mValue(kInvalid)
+{
+}
+
+Structure1::EWeak::EWeak(long value)
+        : mValue(value)
+{
+}
+
+const long Structure1::EWeak::invalid()
+{
+    return kInvalid;
+}
+
+const long Structure1::EWeak::value1()
+{
+    return kValue1;
+}
+
+const long Structure1::EWeak::value2()
+{
+    return kValue2;
+}
+
+long Structure1::EWeak::value() const
+{
+    return mValue;
+}
+
+const char* Structure1::EWeak::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "value1",
+        "value2",
+    };
+    return names[(size_t)value];
+}
+
+const char* Structure1::EWeak::shortName() const
+{
+    return shortName(value());
+}
+
+Structure1::EWeak Structure1::EWeak::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        2, 2,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "value2",
+        "value1",
+    };
+    static const size_t lengths[] =
+    {
+        7, 6, 6,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kValue2,
+        kValue1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return Structure1::EWeak();
+    return Structure1::EWeak(values[slot]);
+}
+
+Structure1::EWeak::operator long () const
+{
+    return mValue;
+}
+
+Structure1::EStrong::EStrong()
+        : mValue(kInvalid)
+{
+}
+
+Structure1::EStrong::EStrong(long value)
+        : mValue(value)
+{
+}
+
+const Structure1::EStrong Structure1::EStrong::invalid()
+{
+    return EStrong(kInvalid);
+}
+
+const Structure1::EStrong Structure1::EStrong::value1()
+{
+    return EStrong(kValue1);
+}
+
+const Structure1::EStrong Structure1::EStrong::value2()
+{
+    return EStrong(kValue2);
+}
+
+long Structure1::EStrong::value() const
+{
+    return mValue;
+}
+
+const char* Structure1::EStrong::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "value1",
+        "value2",
+    };
+    return names[(size_t)value];
+}
+
+const char* Structure1::EStrong::shortName() const
+{
+    return shortName(value());
+}
+
+Structure1::EStrong Structure1::EStrong::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        2, 2,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "value2",
+        "value1",
+    };
+    static const size_t lengths[] =
+    {
+        7, 6, 6,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kValue2,
+        kValue1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return Structure1::EStrong();
+    return Structure1::EStrong(values[slot]);
+}
+
+bool Structure1::EStrong::operator==(const EStrong& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool Structure1::EStrong::operator!=(const EStrong& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+Structure1::EWeak& Structure1::mutable_w1()
+{
+    return mW1;
+}
+
+Structure1::EStrong& Structure1::mutable_s1()
+{
+    return mS1;
+}
+
+std::string& Structure1::mutable_str1()
+{
+    return mStr1;
+}
+
+Structure2a::Structure2a()
+{
+}
+
+Structure2a::~Structure2a()
+{
+}
+
+Structure2aSPtr Structure2a::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2a>(object);
+}
+
+bool Structure2a::operator==(const Structure2a& object) const
+{
+    return (const Structure1&)*this == (const Structure1&)object;
+}
+
+bool Structure2a::operator==(const Structure2aSPtr& object) const
+{
+    return *this == *object;
+}
+
+bool Structure2a::isEqual(const Structure2a& object) const
+{
+    return *this == object;
+}
+
+bool Structure2a::isEqual(const Structure2aSPtr& object) const
+{
+    return *this == *object;
+}
+
+int Structure2a::compare(const Structure2a& object) const
+{
+    return Structure1::compare(object);
+}
+
+bool Structure2a::operator<(const Structure2a& object) const
+{
+    return compare(object) < 0;
+}
+
+bool Structure2a::operator<(const Structure2aSPtr& object) const
+{
+    return *this < *object;
+}
+
+bool Structure2a::lessThan(const Structure2a& object) const
+{
+    return *this < object;
+}
+
+bool Structure2a::lessThan(const Structure2aSPtr& object) const
+{
+    return *this < *object;
+}
+
+Structure2a& Structure2a::set_i1(long i1)
+{
+    Structure1::set_i1(i1);
+    return *this;
+}
+
+Structure2a& Structure2a::set_w1(const EWeak& w1)
+{
+    Structure1::set_w1(w1);
+    return *this;
+}
+
+Structure2a& Structure2a::set_s1(const EStrong& s1)
+{
+    Structure1::set_s1(s1);
+    return *this;
+}
+
+Structure2a& Structure2a::set_str1(const std::string& str1)
+{
+    Structure1::set_str1(str1);
+    return *this;
+}
+
+Structure2b::Structure2b()
+{
+}
+
+Structure2b::~Structure2b()
+{
+}
+
+Structure2bSPtr Structure2b::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2b>(object);
+}
+
+bool Structure2b::operator==(const Structure2b& object) const
+{
+    if (!((const Structure1&)*this == (const Structure1&)object)) return false;
+    if (i2() != object.i2()) return false;
+    return s2() == object.s2();
+}
+
+bool Structure2b::operator==(const Structure2bSPtr& object) const
+{
+    return *this == *object;
+}
+
+bool Structure2b::isEqual(const Structure2b& object) const
+{
+    return *this == object;
+}
+
+bool Structure2b::isEqual(const Structure2bSPtr& object) const
+{
+    return *this == *object;
+}
+
+int Structure2b::compare(const Structure2b& object) const
+{
+    int result = Structure1::compare(object);
+    if (result) return result;
+    result = (object.i2() < i2()) - (i2() < object.i2());
+    if (result) return result;
+    return s2().compare(object.s2());
+}
+
+bool Structure2b::operator<(const Structure2b& object) const
+{
+    return compare(object) < 0;
+}
+
+bool Structure2b::operator<(const Structure2bSPtr& object) const
+{
+    return *this < *object;
+}
+
+bool Structure2b::lessThan(const Structure2b& object) const
+{
+    return *this < object;
+}
+
+bool Structure2b::lessThan(const Structure2bSPtr& object) const
+{
+    return *this < *object;
+}
+
+Structure2a& Structure2b::mutable_s2()
+{
+    return mS2;
+}
+
+Structure2b& Structure2b::set_i1(long i1)
+{
+    Structure1::set_i1(i1);
+    return *this;
+}
+
+Structure2b& Structure2b::set_w1(const EWeak& w1)
+{
+    Structure1::set_w1(w1);
+    return *this;
+}
+
+Structure2b& Structure2b::set_s1(const EStrong& s1)
+{
+    Structure1::set_s1(s1);
+    return *this;
+}
+
+Structure2b& Structure2b::set_str1(const std::string& str1)
+{
+    Structure1::set_str1(str1);
+    return *this;
+}
+
+NoOperatorStructure::NoOperatorStructure()
+{
+}
+
+NoOperatorStructure::~NoOperatorStructure()
+{
+}
+
+INoOperatorWithNativeEqStructure::INoOperatorWithNativeEqStructure()
+{
+}
+
+INoOperatorWithNativeEqStructure::~INoOperatorWithNativeEqStructure()
+{
+}
+
+INoOperatorWithNativeEqStructureSPtr INoOperatorWithNativeEqStructure::downcast(const NoOperatorStructureSPtr& object)
+{
+    return boost::static_pointer_cast<INoOperatorWithNativeEqStructure>(object);
+}
+
+bool INoOperatorWithNativeEqStructure::operator==(const INoOperatorWithNativeEqStructure& object) const
+{
+    return i() == object.i();
+}
+
+bool INoOperatorWithNativeEqStructure::operator==(const INoOperatorWithNativeEqStructureSPtr& object) const
+{
+    return *this == *object;
+}
+
+INoOperatorWithNativeEqStructure& INoOperatorWithNativeEqStructure::set_i(long i)
+{
+    NoOperatorStructure::set_i(i);
+    return *this;
+}
+
+INoOperatorWithNativeLtStructure::INoOperatorWithNativeLtStructure()
+{
+}
+
+INoOperatorWithNativeLtStructure::~INoOperatorWithNativeLtStructure()
+{
+}
+
+INoOperatorWithNativeLtStructureSPtr INoOperatorWithNativeLtStructure::downcast(const NoOperatorStructureSPtr& object)
+{
+    return boost::static_pointer_cast<INoOperatorWithNativeLtStructure>(object);
+}
+
+int INoOperatorWithNativeLtStructure::compare(const INoOperatorWithNativeLtStructure& object) const
+{
+    return (object.i() < i()) - (i() < object.i());
+}
+
+bool INoOperatorWithNativeLtStructure::operator<(const INoOperatorWithNativeLtStructure& object) const
+{
+    return compare(object) < 0;
+}
+
+bool INoOperatorWithNativeLtStructure::operator<(const INoOperatorWithNativeLtStructureSPtr& object) const
+{
+    return *this < *object;
+}
+
+INoOperatorWithNativeLtStructure& INoOperatorWithNativeLtStructure::set_i(long i)
+{
+    NoOperatorStructure::set_i(i);
+    return *this;
+}
+
+INoOperatorWithFunctionalEqStructure::INoOperatorWithFunctionalEqStructure()
+{
+}
+
+INoOperatorWithFunctionalEqStructure::~INoOperatorWithFunctionalEqStructure()
+{
+}
+
+INoOperatorWithFunctionalEqStructureSPtr INoOperatorWithFunctionalEqStructure::downcast(const NoOperatorStructureSPtr& object)
+{
+    return boost::static_pointer_cast<INoOperatorWithFunctionalEqStructure>(object);
+}
+
+bool INoOperatorWithFunctionalEqStructure::isEqual(const INoOperatorWithFunctionalEqStructure& object) const
+{
+    return i() == object.i();
+}
+
+bool INoOperatorWithFunctionalEqStructure::isEqual(const INoOperatorWithFunctionalEqStructureSPtr& object) const
+{
+    return isEqual(*object);
+}
+
+INoOperatorWithFunctionalEqStructure& INoOperatorWithFunctionalEqStructure::set_i(long i)
+{
+    NoOperatorStructure::set_i(i);
+    return *this;
+}
+
+INoOperatorWithFunctionalLtStructure::INoOperatorWithFunctionalLtStructure()
+{
+}
+
+INoOperatorWithFunctionalLtStructure::~INoOperatorWithFunctionalLtStructure()
+{
+}
+
+INoOperatorWithFunctionalLtStructureSPtr INoOperatorWithFunctionalLtStructure::downcast(const NoOperatorStructureSPtr& object)
+{
+    return boost::static_pointer_cast<INoOperatorWithFunctionalLtStructure>(object);
+}
+
+int INoOperatorWithFunctionalLtStructure::compare(const INoOperatorWithFunctionalLtStructure& object) const
+{
+    return (object.i() < i()) - (i() < object.i());
+}
+
+bool INoOperatorWithFunctionalLtStructure::lessThan(const INoOperatorWithFunctionalLtStructure& object) const
+{
+    return compare(object) < 0;
+}
+
+bool INoOperatorWithFunctionalLtStructure::lessThan(const INoOperatorWithFunctionalLtStructureSPtr& object) const
+{
+    return lessThan(*object);
+}
+
+INoOperatorWithFunctionalLtStructure& INoOperatorWithFunctionalLtStructure::set_i(long i)
+{
+    NoOperatorStructure::set_i(i);
+    return *this;
+}
+
+FunctionalEqStructure::FunctionalEqStructure()
+{
+}
+
+FunctionalEqStructure::~FunctionalEqStructure()
+{
+}
+
+bool FunctionalEqStructure::isEqual(const FunctionalEqStructure& object) const
+{
+    return true;
+}
+
+bool FunctionalEqStructure::isEqual(const FunctionalEqStructureSPtr& object) const
+{
+    return isEqual(*object);
+}
+
+IEqWithNativeEqStructure::IEqWithNativeEqStructure()
+{
+}
+
+IEqWithNativeEqStructure::~IEqWithNativeEqStructure()
+{
+}
+
+IEqWithNativeEqStructureSPtr IEqWithNativeEqStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IEqWithNativeEqStructure>(object);
+}
+
+bool IEqWithNativeEqStructure::operator==(const IEqWithNativeEqStructure& object) const
+{
+    return ((const FunctionalEqStructure&)*this).isEqual((const FunctionalEqStructure&)object);
+}
+
+bool IEqWithNativeEqStructure::operator==(const IEqWithNativeEqStructureSPtr& object) const
+{
+    return *this == *object;
+}
+
+IEqWithNativeLtStructure::IEqWithNativeLtStructure()
+{
+}
+
+IEqWithNativeLtStructure::~IEqWithNativeLtStructure()
+{
+}
+
+IEqWithNativeLtStructureSPtr IEqWithNativeLtStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IEqWithNativeLtStructure>(object);
+}
+
+int IEqWithNativeLtStructure::compare(const IEqWithNativeLtStructure& object) const
+{
+    return 0;
+}
+
+bool IEqWithNativeLtStructure::operator<(const IEqWithNativeLtStructure& object) const
+{
+    return compare(object) < 0;
+}
+
+bool IEqWithNativeLtStructure::operator<(const IEqWithNativeLtStructureSPtr& object) const
+{
+    return *this < *object;
+}
+
+IFunctionalEqWithFunctionalEqStructure::IFunctionalEqWithFunctionalEqStructure()
+{
+}
+
+IFunctionalEqWithFunctionalEqStructure::~IFunctionalEqWithFunctionalEqStructure()
+{
+}
+
+IFunctionalEqWithFunctionalEqStructureSPtr IFunctionalEqWithFunctionalEqStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IFunctionalEqWithFunctionalEqStructure>(object);
+}
+
+bool IFunctionalEqWithFunctionalEqStructure::isEqual(const IFunctionalEqWithFunctionalEqStructure& object) const
+{
+    return ((const FunctionalEqStructure&)*this).isEqual((const FunctionalEqStructure&)object);
+}
+
+bool IFunctionalEqWithFunctionalEqStructure::isEqual(const IFunctionalEqWithFunctionalEqStructureSPtr& object) const
+{
+    return isEqual(*object);
+}
+
+IFunctionalEqWithFunctionalLtStructure::IFunctionalEqWithFunctionalLtStructure()
+{
+}
+
+IFunctionalEqWithFunctionalLtStructure::~IFunctionalEqWithFunctionalLtStructure()
+{
+}
+
+IFunctionalEqWithFunctionalLtStructureSPtr IFunctionalEqWithFunctionalLtStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IFunctionalEqWithFunctionalLtStructure>(object);
+}
+
+int IFunctionalEqWithFunctionalLtStructure::compare(const IFunctionalEqWithFunctionalLtStructure& object) const
+{
+    return 0;
+}
+
+bool IFunctionalEqWithFunctionalLtStructure::lessThan(const IFunctionalEqWithFunctionalLtStructure& object) const
+{
+    return compare(object) < 0;
+}
+
+bool IFunctionalEqWithFunctionalLtStructure::lessThan(const IFunctionalEqWithFunctionalLtStructureSPtr& object) const
+{
+    return lessThan(*object);
+}
+
+IFunctionalEqWithFunctorEqStructure::IFunctionalEqWithFunctorEqStructure()
+{
+}
+
+IFunctionalEqWithFunctorEqStructure::~IFunctionalEqWithFunctorEqStructure()
+{
+}
+
+IFunctionalEqWithFunctorEqStructureSPtr IFunctionalEqWithFunctorEqStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IFunctionalEqWithFunctorEqStructure>(object);
+}
+
+bool IFunctionalEqWithFunctorEqStructure::isEqual::operator()(const IFunctionalEqWithFunctorEqStructure& object1,
+                                                              const IFunctionalEqWithFunctorEqStructure& object2)  const
+{
+    return true;
+}
+
+bool IFunctionalEqWithFunctorEqStructure::isEqual::operator()(const IFunctionalEqWithFunctorEqStructureSPtr& object1,
+                                                              const IFunctionalEqWithFunctorEqStructureSPtr& object2)  const
+{
+    return isEqual()(*object1, *object2);
+}
+
+IFunctionalEqWithFunctorLtStructure::IFunctionalEqWithFunctorLtStructure()
+{
+}
+
+IFunctionalEqWithFunctorLtStructure::~IFunctionalEqWithFunctorLtStructure()
+{
+}
+
+IFunctionalEqWithFunctorLtStructureSPtr IFunctionalEqWithFunctorLtStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IFunctionalEqWithFunctorLtStructure>(object);
+}
+
+int IFunctionalEqWithFunctorLtStructure::compare(const IFunctionalEqWithFunctorLtStructure& object) const
+{
+    return 0;
+}
+
+bool IFunctionalEqWithFunctorLtStructure::lessThan::operator()(const IFunctionalEqWithFunctorLtStructure& object1,
+                                                               const IFunctionalEqWithFunctorLtStructure& object2)  const
+{
+    return object1.compare(object2) < 0;
+}
+
+bool IFunctionalEqWithFunctorLtStructure::lessThan::operator()(const IFunctionalEqWithFunctorLtStructureSPtr& object1,
+                                                               const IFunctionalEqWithFunctorLtStructureSPtr& object2)  const
+{
+    return lessThan()(*object1, *object2);
+}
+
+CompareKey::CompareKey()
+{
+}
+
+CompareKey::~CompareKey()
+{
+}
+
+bool CompareKey::operator==(const CompareKey& object) const
+{
+    return compare(object) == 0;
+}
+
+bool CompareKey::operator==(const CompareKeySPtr& object) const
+{
+    return *this == *object;
+}
+
+int CompareKey::compare(const CompareKey& object) const
+{
+    return ((object.venue() < venue()) - (venue() < object.venue())) * 8
+         + ((object.side() < side()) - (side() < object.side())) * 4
+         + ((object.price() < price()) - (price() < object.price())) * 2
+         + ((object.lot() < lot()) - (lot() < object.lot()));
+}
+
+bool CompareKey::operator<(const CompareKey& object) const
+{
+    return compare(object) < 0;
+}
+
+bool CompareKey::operator<(const CompareKeySPtr& object) const
+{
+    return *this < *object;
+}
+
+bool CompareKey::lessThan::operator()(const CompareKey& object1, const CompareKey& object2) const
+{
+    return object1 < object2;
+}
+
+bool CompareKey::lessThan::operator()(const CompareKeySPtr& object1, const CompareKeySPtr& object2) const
+{
+    return *object1 < *object2;
+}
+
+CompareKey::ESide::ESide()
+        : mValue(kInvalid)
+{
+}
+
+CompareKey::ESide::ESide(long value)
+        : mValue(value)
+{
+}
+
+const long CompareKey::ESide::invalid()
+{
+    return kInvalid;
+}
+
+const long CompareKey::ESide::buy()
+{
+    return kBuy;
+}
+
+const long CompareKey::ESide::sell()
+{
+    return kSell;
+}
+
+long CompareKey::ESide::value() const
+{
+    return mValue;
+}
+
+const char* CompareKey::ESide::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "buy",
+        "sell",
+    };
+    return names[(size_t)value];
+}
+
+const char* CompareKey::ESide::shortName() const
+{
+    return shortName(value());
+}
+
+CompareKey::ESide CompareKey::ESide::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        1, 0,
+    };
+    static const char* names[] =
+    {
+        "sell",
+        "buy",
+        "invalid",
+    };
+    static const size_t lengths[] =
+    {
+        4, 3, 7,
+    };
+    static const long values[] =
+    {
+        kSell,
+        kBuy,
+        kInvalid,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return CompareKey::ESide();
+    return CompareKey::ESide(values[slot]);
+}
+
+CompareKey::ESide::operator long () const
+{
+    return mValue;
+}
+
+CompareKey::ESide& CompareKey::mutable_side()
+{
+    return mSide;
+}
+
+CompareRecord::CompareRecord()
+{
+}
+
+CompareRecord::~CompareRecord()
+{
+}
+
+bool CompareRecord::operator==(const CompareRecord& object) const
+{
+    return compare(object) == 0;
+}
+
+bool CompareRecord::operator==(const CompareRecordSPtr& object) const
+{
+    return *this == *object;
+}
+
+int CompareRecord::compare(const CompareRecord& object) const
+{
+    int result = symbol().compare(object.symbol());
+    if (result) return result;
+    result = key().compare(object.key());
+    if (result) return result;
+    return (object.quantity() < quantity()) - (quantity() < object.quantity());
+}
+
+bool CompareRecord::operator<(const CompareRecord& object) const
+{
+    return compare(object) < 0;
+}
+
+bool CompareRecord::operator<(const CompareRecordSPtr& object) const
+{
+    return *this < *object;
+}
+
+bool CompareRecord::lessThan(const CompareRecord& object) const
+{
+    return *this < object;
+}
+
+bool CompareRecord::lessThan(const CompareRecordSPtr& object) const
+{
+    return *this < *object;
+}
+
+std::string& CompareRecord::mutable_symbol()
+{
+    return mSymbol;
+}
+
+CompareKey& CompareRecord::mutable_key()
+{
+    return mKey;
+}
+
+ICompareRecord::ICompareRecord()
+{
+}
+
+ICompareRecord::~ICompareRecord()
+{
+}
+
+ICompareRecordSPtr ICompareRecord::downcast(const CompareRecordSPtr& object)
+{
+    return boost::static_pointer_cast<ICompareRecord>(object);
+}
+
+int ICompareRecord::compare(const ICompareRecord& object) const
+{
+    int result = CompareRecord::compare(object);
+    if (result) return result;
+    return (object.sequence() < sequence()) - (sequence() < object.sequence());
+}
+
+bool ICompareRecord::operator<(const ICompareRecord& object) const
+{
+    return compare(object) < 0;
+}
+
+bool ICompareRecord::operator<(const ICompareRecordSPtr& object) const
+{
+    return *this < *object;
+}
+
+ICompareRecord& ICompareRecord::set_symbol(const std::string& symbol)
+{
+    CompareRecord::set_symbol(symbol);
+    return *this;
+}
+
+ICompareRecord& ICompareRecord::set_key(const CompareKey& key)
+{
+    CompareRecord::set_key(key);
+    return *this;
+}
+
+ICompareRecord& ICompareRecord::set_quantity(long quantity)
+{
+    CompareRecord::set_quantity(quantity);
+    return *this;
+}
+
+}
+
@@ -0,0 +1,1042 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+
+#ifndef __STRUCTURE_OPERATOR_COMPIL_H_
+#define __STRUCTURE_OPERATOR_COMPIL_H_
+
+#include "structure/operator.h"
+// Standard C Library
+#include <stddef.h>
+
+namespace operator_
+{
+
+class Structure1
+{
+public:
+    // Default constructor
+                 Structure1 ();
+    // Destructor
+    /*lax*/      ~Structure1();
+
+            bool operator== (const Structure1& object)                                     const;
+
+            bool operator== (const Structure1SPtr& object)                                 const;
+
+            bool isEqual    (const Structure1& object)                                     const;
+
+            bool isEqual    (const Structure1SPtr& object)                                 const;
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int  compare    (const Structure1& object)                                     const;
+
+            bool operator<  (const Structure1& object)                                     const;
+
+            bool operator<  (const Structure1SPtr& object)                                 const;
+
+            bool lessThan   (const Structure1& object)                                     const;
+
+            bool lessThan   (const Structure1SPtr& object)                                 const;
+
+    struct lessThan {
+            bool operator() (const Structure1& object1, const Structure1& object2)         const;
+
+            bool operator() (const Structure1SPtr& object1, const Structure1SPtr& object2) const;
+    };
+
+    // This enumeration class provides namespaced set of constant values.
+    class EWeak
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             EWeak     ( );
+        // Constructor from an integer value.
+                             EWeak     ( long value);
+
+        // Returns the integer value of the enum.
+               long          value     ( )                              const;
+        // Returns short name for a specified enum value
+        static const char*   shortName ( long value);
+        // Returns short name of the enum value
+               const char*   shortName ( )                              const;
+        // Returns the enum value with a specified short name or invalid if
+        // none of the values has this name. The lookup is a perfect hash.
+        static EWeak         fromString( const char* name, size_t size);
+        // Cast operator that casts the enum to its native type
+               operator long (         ) const;
+
+        // static methods for enum class objects
+        static const long invalid();
+        static const long value1 ();
+        static const long value2 ();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid = 0,
+            kValue1  = 1,
+            kValue2  = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // This enumeration class provides namespaced set of constant values.
+    // It is designed to provide type control over operations with enum
+    // values without need to wait all compilers you are going to use for
+    // this project to support C++0x standard. The type control do not
+    // prevent the variables to be used in switch statements.
+    class EStrong
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             EStrong   ();
+        // Constructor from an integer value.
+        // Note: Avoid using this constructor if possible. It is
+        // appropriate only in case of importing value from components that
+        // you do not have control over (such as 3rd party libraries or
+        // serialization functionality).
+        explicit             EStrong   (long value);
+
+        // Returns the integer value of the enum.
+        // Note: Avoid using this method if possible. It is appropriate
+        // only in case of exporting value to components that you do not
+        // have control over (such as 3rd party libraries or serialization
+        // functionality).
+                 long        value     ()                              const;
+        // Returns short name for a specified enum value
+        static   const char* shortName (long value);
+        // Returns short name of the enum value
+                 const char* shortName ()                              const;
+        // Returns the enum value with a specified short name or invalid if
+        // none of the values has this name. The lookup is a perfect hash.
+        static   EStrong     fromString(const char* name, size_t size);
+        // returns true if the value of the enum is equal to the value of
+        // the argument
+                 bool        operator==(const EStrong& rValue)         const;
+        // returns true if the value of the enum is not equal to the value
+        // of the argument
+                 bool        operator!=(const EStrong& rValue)         const;
+
+        // static methods for enum class objects
+        static const EStrong invalid();
+        static const EStrong value1 ();
+        static const EStrong value2 ();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid = 0,
+            kValue1  = 1,
+            kValue2  = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // Getter method for the data field i1
+    long               i1          ()                        const;
+    // Setter method for the data field i1
+    Structure1&        set_i1      (long i1);
+
+    // Getter method for the data field w1
+    const EWeak&       w1          ()                        const;
+    // Setter method for the data field w1
+    Structure1&        set_w1      (const EWeak& w1);
+    // Provides mutable access to field w1
+    EWeak&             mutable_w1  ();
+
+    // Getter method for the data field s1
+    const EStrong&     s1          ()                        const;
+    // Setter method for the data field s1
+    Structure1&        set_s1      (const EStrong& s1);
+    // Provides mutable access to field s1
+    EStrong&           mutable_s1  ();
+
+    // Getter method for the data field str1
+    const std::string& str1        ()                        const;
+    // Setter method for the data field str1
+    Structure1&        set_str1    (const std::string& str1);
+    // Provides mutable access to field str1
+    std::string&       mutable_str1();
+
+private:
+    // variable for the data field i1
+    long        mI1;
+    // variable for the data field w1
+    EWeak       mW1;
+    // variable for the data field s1
+    EStrong     mS1;
+    // variable for the data field str1
+    std::string mStr1;
+};
+
+class Structure2a : public Structure1
+{
+public:
+    // Default constructor
+                            Structure2a ();
+    // Destructor
+    /*lax*/                 ~Structure2a();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2aSPtr downcast    (const Structure1SPtr& object);
+
+            bool            operator==  (const Structure2a& object)     const;
+
+            bool            operator==  (const Structure2aSPtr& object) const;
+
+            bool            isEqual     (const Structure2a& object)     const;
+
+            bool            isEqual     (const Structure2aSPtr& object) const;
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int             compare     (const Structure2a& object)     const;
+
+            bool            operator<   (const Structure2a& object)     const;
+
+            bool            operator<   (const Structure2aSPtr& object) const;
+
+            bool            lessThan    (const Structure2a& object)     const;
+
+            bool            lessThan    (const Structure2aSPtr& object) const;
+
+    // Setter method for the data field i1
+            Structure2a&    set_i1      (long i1);
+
+    // Setter method for the data field w1
+            Structure2a&    set_w1      (const EWeak& w1);
+
+    // Setter method for the data field s1
+            Structure2a&    set_s1      (const EStrong& s1);
+
+    // Setter method for the data field str1
+            Structure2a&    set_str1    (const std::string& str1);
+};
+
+class Structure2b : public Structure1
+{
+public:
+    // Default constructor
+                               Structure2b ();
+    // Destructor
+    /*lax*/                    ~Structure2b();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2bSPtr    downcast    (const Structure1SPtr& object);
+
+            bool               operator==  (const Structure2b& object)     const;
+
+            bool               operator==  (const Structure2bSPtr& object) const;
+
+            bool               isEqual     (const Structure2b& object)     const;
+
+            bool               isEqual     (const Structure2bSPtr& object) const;
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                compare     (const Structure2b& object)     const;
+
+            bool               operator<   (const Structure2b& object)     const;
+
+            bool               operator<   (const Structure2bSPtr& object) const;
+
+            bool               lessThan    (const Structure2b& object)     const;
+
+            bool               lessThan    (const Structure2bSPtr& object) const;
+
+    // Getter method for the data field i2
+            long               i2          ()                              const;
+    // Setter method for the data field i2
+            Structure2b&       set_i2      (long i2);
+
+    // Getter method for the data field s2
+            const Structure2a& s2          ()                              const;
+    // Setter method for the data field s2
+            Structure2b&       set_s2      (const Structure2a& s2);
+    // Provides mutable access to field s2
+            Structure2a&       mutable_s2  ();
+
+    // Setter method for the data field i1
+            Structure2b&       set_i1      (long i1);
+
+    // Setter method for the data field w1
+            Structure2b&       set_w1      (const EWeak& w1);
+
+    // Setter method for the data field s1
+            Structure2b&       set_s1      (const EStrong& s1);
+
+    // Setter method for the data field str1
+            Structure2b&       set_str1    (const std::string& str1);
+
+private:
+    // variable for the data field i2
+    long        mI2;
+    // variable for the data field s2
+    Structure2a mS2;
+};
+
+class NoOperatorStructure
+{
+public:
+    // Default constructor
+                                 NoOperatorStructure ();
+    // Destructor
+    /*lax*/                      ~NoOperatorStructure();
+
+    // Getter method for the data field i
+            long                 i                   ()       const;
+    // Setter method for the data field i
+            NoOperatorStructure& set_i               (long i);
+
+private:
+    // variable for the data field i
+    long mI;
+};
+
+class INoOperatorWithNativeEqStructure : public NoOperatorStructure
+{
+public:
+    // Default constructor
+                                                 INoOperatorWithNativeEqStructure ();
+    // Destructor
+    /*lax*/                                      ~INoOperatorWithNativeEqStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  INoOperatorWithNativeEqStructureSPtr downcast                         (const NoOperatorStructureSPtr& object);
+
+            bool                                 operator==                       (const INoOperatorWithNativeEqStructure& object)     const;
+
+            bool                                 operator==                       (const INoOperatorWithNativeEqStructureSPtr& object) const;
+
+    // Setter method for the data field i
+            INoOperatorWithNativeEqStructure&    set_i                            (long i);
+};
+
+class INoOperatorWithNativeLtStructure : public NoOperatorStructure
+{
+public:
+    // Default constructor
+                                                 INoOperatorWithNativeLtStructure ();
+    // Destructor
+    /*lax*/                                      ~INoOperatorWithNativeLtStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  INoOperatorWithNativeLtStructureSPtr downcast                         (const NoOperatorStructureSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                                  compare                          (const INoOperatorWithNativeLtStructure& object)     const;
+
+            bool                                 operator<                        (const INoOperatorWithNativeLtStructure& object)     const;
+
+            bool                                 operator<                        (const INoOperatorWithNativeLtStructureSPtr& object) const;
+
+    // Setter method for the data field i
+            INoOperatorWithNativeLtStructure&    set_i                            (long i);
+};
+
+class INoOperatorWithFunctionalEqStructure : public NoOperatorStructure
+{
+public:
+    // Default constructor
+                                                     INoOperatorWithFunctionalEqStructure ();
+    // Destructor
+    /*lax*/                                          ~INoOperatorWithFunctionalEqStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  INoOperatorWithFunctionalEqStructureSPtr downcast                             (const NoOperatorStructureSPtr& object);
+
+            bool                                     isEqual                              (const INoOperatorWithFunctionalEqStructure& object)     const;
+
+            bool                                     isEqual                              (const INoOperatorWithFunctionalEqStructureSPtr& object) const;
+
+    // Setter method for the data field i
+            INoOperatorWithFunctionalEqStructure&    set_i                                (long i);
+};
+
+class INoOperatorWithFunctionalLtStructure : public NoOperatorStructure
+{
+public:
+    // Default constructor
+                                                     INoOperatorWithFunctionalLtStructure ();
+    // Destructor
+    /*lax*/                                          ~INoOperatorWithFunctionalLtStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  INoOperatorWithFunctionalLtStructureSPtr downcast                             (const NoOperatorStructureSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                                      compare                              (const INoOperatorWithFunctionalLtStructure& object)     const;
+
+            bool                                     lessThan                             (const INoOperatorWithFunctionalLtStructure& object)     const;
+
+            bool                                     lessThan                             (const INoOperatorWithFunctionalLtStructureSPtr& object) const;
+
+    // Setter method for the data field i
+            INoOperatorWithFunctionalLtStructure&    set_i                                (long i);
+};
+
+class FunctionalEqStructure
+{
+public:
+    // Default constructor
+                 FunctionalEqStructure ();
+    // Destructor
+    /*lax*/      ~FunctionalEqStructure();
+
+            bool isEqual               (const FunctionalEqStructure& object)     const;
+
+            bool isEqual               (const FunctionalEqStructureSPtr& object) const;
+};
+
+class IEqWithNativeEqStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                         IEqWithNativeEqStructure ();
+    // Destructor
+    /*lax*/                              ~IEqWithNativeEqStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IEqWithNativeEqStructureSPtr downcast                 (const FunctionalEqStructureSPtr& object);
+
+            bool                         operator==               (const IEqWithNativeEqStructure& object)     const;
+
+            bool                         operator==               (const IEqWithNativeEqStructureSPtr& object) const;
+};
+
+class IEqWithNativeLtStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                         IEqWithNativeLtStructure ();
+    // Destructor
+    /*lax*/                              ~IEqWithNativeLtStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IEqWithNativeLtStructureSPtr downcast                 (const FunctionalEqStructureSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                          compare                  (const IEqWithNativeLtStructure& object)     const;
+
+            bool                         operator<                (const IEqWithNativeLtStructure& object)     const;
+
+            bool                         operator<                (const IEqWithNativeLtStructureSPtr& object) const;
+};
+
+class IFunctionalEqWithFunctionalEqStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                                       IFunctionalEqWithFunctionalEqStructure ();
+    // Destructor
+    /*lax*/                                            ~IFunctionalEqWithFunctionalEqStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IFunctionalEqWithFunctionalEqStructureSPtr downcast                               (const FunctionalEqStructureSPtr& object);
+
+            bool                                       isEqual                                (const IFunctionalEqWithFunctionalEqStructure& object)     const;
+
+            bool                                       isEqual                                (const IFunctionalEqWithFunctionalEqStructureSPtr& object) const;
+};
+
+class IFunctionalEqWithFunctionalLtStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                                       IFunctionalEqWithFunctionalLtStructure ();
+    // Destructor
+    /*lax*/                                            ~IFunctionalEqWithFunctionalLtStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IFunctionalEqWithFunctionalLtStructureSPtr downcast                               (const FunctionalEqStructureSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                                        compare                                (const IFunctionalEqWithFunctionalLtStructure& object)     const;
+
+            bool                                       lessThan                               (const IFunctionalEqWithFunctionalLtStructure& object)     const;
+
+            bool                                       lessThan                               (const IFunctionalEqWithFunctionalLtStructureSPtr& object) const;
+};
+
+class IFunctionalEqWithFunctorEqStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                                    IFunctionalEqWithFunctorEqStructure ();
+    // Destructor
+    /*lax*/                                         ~IFunctionalEqWithFunctorEqStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IFunctionalEqWithFunctorEqStructureSPtr downcast                            (const FunctionalEqStructureSPtr& object);
+
+    struct isEqual {
+            bool                                    operator()                          (const IFunctionalEqWithFunctorEqStructure& object1,
+                                                                                         const IFunctionalEqWithFunctorEqStructure& object2)      const;
+
+            bool                                    operator()                          (const IFunctionalEqWithFunctorEqStructureSPtr& object1,
+                                                                                         const IFunctionalEqWithFunctorEqStructureSPtr& object2)  const;
+    };
+};
+
+class IFunctionalEqWithFunctorLtStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                                    IFunctionalEqWithFunctorLtStructure ();
+    // Destructor
+    /*lax*/                                         ~IFunctionalEqWithFunctorLtStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IFunctionalEqWithFunctorLtStructureSPtr downcast                            (const FunctionalEqStructureSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                                     compare                             (const IFunctionalEqWithFunctorLtStructure& object)       const;
+
+    struct lessThan {
+            bool                                    operator()                          (const IFunctionalEqWithFunctorLtStructure& object1,
+                                                                                         const IFunctionalEqWithFunctorLtStructure& object2)      const;
+
+            bool                                    operator()                          (const IFunctionalEqWithFunctorLtStructureSPtr& object1,
+                                                                                         const IFunctionalEqWithFunctorLtStructureSPtr& object2)  const;
+    };
+};
+
+class CompareKey
+{
+public:
+    // Default constructor
+                 CompareKey ();
+    // Destructor
+    /*lax*/      ~CompareKey();
+
+            bool operator== (const CompareKey& object)                                     const;
+
+            bool operator== (const CompareKeySPtr& object)                                 const;
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int  compare    (const CompareKey& object)                                     const;
+
+            bool operator<  (const CompareKey& object)                                     const;
+
+            bool operator<  (const CompareKeySPtr& object)                                 const;
+
+    struct lessThan {
+            bool operator() (const CompareKey& object1, const CompareKey& object2)         const;
+
+            bool operator() (const CompareKeySPtr& object1, const CompareKeySPtr& object2) const;
+    };
+
+    // This enumeration class provides namespaced set of constant values.
+    class ESide
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             ESide     ( );
+        // Constructor from an integer value.
+                             ESide     ( long value);
+
+        // Returns the integer value of the enum.
+               long          value     ( )                              const;
+        // Returns short name for a specified enum value
+        static const char*   shortName ( long value);
+        // Returns short name of the enum value
+               const char*   shortName ( )                              const;
+        // Returns the enum value with a specified short name or invalid if
+        // none of the values has this name. The lookup is a perfect hash.
+        static ESide         fromString( const char* name, size_t size);
+        // Cast operator that casts the enum to its native type
+               operator long (         ) const;
+
+        // static methods for enum class objects
+        static const long invalid();
+        static const long buy    ();
+        static const long sell   ();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid = 0,
+            kBuy     = 1,
+            kSell    = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // Getter method for the data field venue
+    long         venue       ()                  const;
+    // Setter method for the data field venue
+    CompareKey&  set_venue   (long venue);
+
+    // Getter method for the data field side
+    const ESide& side        ()                  const;
+    // Setter method for the data field side
+    CompareKey&  set_side    (const ESide& side);
+    // Provides mutable access to field side
+    ESide&       mutable_side();
+
+    // Getter method for the data field price
+    long         price       ()                  const;
+    // Setter method for the data field price
+    CompareKey&  set_price   (long price);
+
+    // Getter method for the data field lot
+    long         lot         ()                  const;
+    // Setter method for the data field lot
+    CompareKey&  set_lot     (long lot);
+
+private:
+    // variable for the data field venue
+    long  mVenue;
+    // variable for the data field side
+    ESide mSide;
+    // variable for the data field price
+    long  mPrice;
+    // variable for the data field lot
+    long  mLot;
+};
+
+class CompareRecord
+{
+public:
+    // Default constructor
+                               CompareRecord ();
+    // Destructor
+    /*lax*/                    ~CompareRecord();
+
+            bool               operator==    (const CompareRecord& object)     const;
+
+            bool               operator==    (const CompareRecordSPtr& object) const;
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                compare       (const CompareRecord& object)     const;
+
+            bool               operator<     (const CompareRecord& object)     const;
+
+            bool               operator<     (const CompareRecordSPtr& object) const;
+
+            bool               lessThan      (const CompareRecord& object)     const;
+
+            bool               lessThan      (const CompareRecordSPtr& object) const;
+
+    // Getter method for the data field symbol
+            const std::string& symbol        ()                                const;
+    // Setter method for the data field symbol
+            CompareRecord&     set_symbol    (const std::string& symbol);
+    // Provides mutable access to field symbol
+            std::string&       mutable_symbol();
+
+    // Getter method for the data field key
+            const CompareKey&  key           ()                                const;
+    // Setter method for the data field key
+            CompareRecord&     set_key       (const CompareKey& key);
+    // Provides mutable access to field key
+            CompareKey&        mutable_key   ();
+
+    // Getter method for the data field quantity
+            long               quantity      ()                                const;
+    // Setter method for the data field quantity
+            CompareRecord&     set_quantity  (long quantity);
+
+private:
+    // variable for the data field symbol
+    std::string mSymbol;
+    // variable for the data field key
+    CompareKey  mKey;
+    // variable for the data field quantity
+    long        mQuantity;
+};
+
+class ICompareRecord : public CompareRecord
+{
+public:
+    // Default constructor
+                               ICompareRecord ();
+    // Destructor
+    /*lax*/                    ~ICompareRecord();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  ICompareRecordSPtr downcast       (const CompareRecordSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                compare        (const ICompareRecord& object)     const;
+
+            bool               operator<      (const ICompareRecord& object)     const;
+
+            bool               operator<      (const ICompareRecordSPtr& object) const;
+
+    // Getter method for the data field sequence
+            long               sequence       ()                                 const;
+    // Setter method for the data field sequence
+            ICompareRecord&    set_sequence   (long sequence);
+
+    // Setter method for the data field symbol
+            ICompareRecord&    set_symbol     (const std::string& symbol);
+
+    // Setter method for the data field key
+            ICompareRecord&    set_key        (const CompareKey& key);
+
+    // Setter method for the data field quantity
+            ICompareRecord&    set_quantity   (long quantity);
+
+private:
+    // variable for the data field sequence
+    long mSequence;
+};
+
+inline long Structure1::i1() const
+{
+    return mI1;
+}
+
+inline Structure1& Structure1::set_i1(long i1)
+{
+    mI1 = i1;
+    return *this;
+}
+
+inline const Structure1::EWeak& Structure1::w1() const
+{
+    return mW1;
+}
+
+inline Structure1& Structure1::set_w1(const EWeak& w1)
+{
+    mW1 = w1;
+    return *this;
+}
+
+inline const Structure1::EStrong& Structure1::s1() const
+{
+    return mS1;
+}
+
+inline Structure1& Structure1::set_s1(const EStrong& s1)
+{
+    mS1 = s1;
+    return *this;
+}
+
+inline const std::string& Structure1::str1() const
+{
+    return mStr1;
+}
+
+inline Structure1& Structure1::set_str1(const std::string& str1)
+{
+    mStr1 = str1;
+    return *this;
+}
+
+inline long Structure2b::i2() const
+{
+    return mI2;
+}
+
+inline Structure2b& Structure2b::set_i2(long i2)
+{
+    mI2 = i2;
+    return *this;
+}
+
+inline const Structure2a& Structure2b::s2() const
+{
+    return mS2;
+}
+
+inline Structure2b& Structure2b::set_s2(const Structure2a& s2)
+{
+    mS2 = s2;
+    return *this;
+}
+
+inline long NoOperatorStructure::i() const
+{
+    return mI;
+}
+
+inline NoOperatorStructure& NoOperatorStructure::set_i(long i)
+{
+    mI = i;
+    return *this;
+}
+
+inline long CompareKey::venue() const
+{
+    return mVenue;
+}
+
+inline CompareKey& CompareKey::set_venue(long venue)
+{
+    mVenue = venue;
+    return *this;
+}
+
+inline const CompareKey::ESide& CompareKey::side() const
+{
+    return mSide;
+}
+
+inline CompareKey& CompareKey::set_side(const ESide& side)
+{
+    mSide = side;
+    return *this;
+}
+
+inline long CompareKey::price() const
+{
+    return mPrice;
+}
+
+inline CompareKey& CompareKey::set_price(long price)
+{
+    mPrice = price;
+    return *this;
+}
+
+inline long CompareKey::lot() const
+{
+    return mLot;
+}
+
+inline CompareKey& CompareKey::set_lot(long lot)
+{
+    mLot = lot;
+    return *this;
+}
+
+inline const std::string& CompareRecord::symbol() const
+{
+    return mSymbol;
+}
+
+inline CompareRecord& CompareRecord::set_symbol(const std::string& symbol)
+{
+    mSymbol = symbol;
+    return *this;
+}
+
+inline const CompareKey& CompareRecord::key() const
+{
+    return mKey;
+}
+
+inline CompareRecord& CompareRecord::set_key(const CompareKey& key)
+{
+    mKey = key;
+    return *this;
+}
+
+inline long CompareRecord::quantity() const
+{
+    return mQuantity;
+}
+
+inline CompareRecord& CompareRecord::set_quantity(long quantity)
+{
+    mQuantity = quantity;
+    return *this;
+}
+
+inline long ICompareRecord::sequence() const
+{
+    return mSequence;
+}
+
+inline ICompareRecord& ICompareRecord::set_sequence(long sequence)
+{
+    mSequence = sequence;
+    return *this;
+}
+
+}
+
+#else // __STRUCTURE_OPERATOR_COMPIL_H_
+
+namespace operator_
+{
+
+// Forward declarations
+class Structure1;
+typedef Structure1*                         Structure1RPtr;
+typedef boost::shared_ptr<Structure1>       Structure1SPtr;
+typedef boost::shared_ptr<const Structure1> Structure1SCPtr;
+typedef boost::weak_ptr<Structure1>         Structure1WPtr;
+
+class Structure2a;
+typedef Structure2a*                         Structure2aRPtr;
+typedef boost::shared_ptr<Structure2a>       Structure2aSPtr;
+typedef boost::shared_ptr<const Structure2a> Structure2aSCPtr;
+typedef boost::weak_ptr<Structure2a>         Structure2aWPtr;
+
+class Structure2b;
+typedef Structure2b*                         Structure2bRPtr;
+typedef boost::shared_ptr<Structure2b>       Structure2bSPtr;
+typedef boost::shared_ptr<const Structure2b> Structure2bSCPtr;
+typedef boost::weak_ptr<Structure2b>         Structure2bWPtr;
+
+class NoOperatorStructure;
+typedef NoOperatorStructure*                         NoOperatorStructureRPtr;
+typedef boost::shared_ptr<NoOperatorStructure>       NoOperatorStructureSPtr;
+typedef boost::shared_ptr<const NoOperatorStructure> NoOperatorStructureSCPtr;
+typedef boost::weak_ptr<NoOperatorStructure>         NoOperatorStructureWPtr;
+
+class INoOperatorWithNativeEqStructure;
+typedef INoOperatorWithNativeEqStructure*                         INoOperatorWithNativeEqStructureRPtr;
+typedef boost::shared_ptr<INoOperatorWithNativeEqStructure>       INoOperatorWithNativeEqStructureSPtr;
+typedef boost::shared_ptr<const INoOperatorWithNativeEqStructure> INoOperatorWithNativeEqStructureSCPtr;
+typedef boost::weak_ptr<INoOperatorWithNativeEqStructure>         INoOperatorWithNativeEqStructureWPtr;
+
+class INoOperatorWithNativeLtStructure;
+typedef INoOperatorWithNativeLtStructure*                         INoOperatorWithNativeLtStructureRPtr;
+typedef boost::shared_ptr<INoOperatorWithNativeLtStructure>       INoOperatorWithNativeLtStructureSPtr;
+typedef boost::shared_ptr<const INoOperatorWithNativeLtStructure> INoOperatorWithNativeLtStructureSCPtr;
+typedef boost::weak_ptr<INoOperatorWithNativeLtStructure>         INoOperatorWithNativeLtStructureWPtr;
+
+class INoOperatorWithFunctionalEqStructure;
+typedef INoOperatorWithFunctionalEqStructure*                         INoOperatorWithFunctionalEqStructureRPtr;
+typedef boost::shared_ptr<INoOperatorWithFunctionalEqStructure>       INoOperatorWithFunctionalEqStructureSPtr;
+typedef boost::shared_ptr<const INoOperatorWithFunctionalEqStructure> INoOperatorWithFunctionalEqStructureSCPtr;
+typedef boost::weak_ptr<INoOperatorWithFunctionalEqStructure>         INoOperatorWithFunctionalEqStructureWPtr;
+
+class INoOperatorWithFunctionalLtStructure;
+typedef INoOperatorWithFunctionalLtStructure*                         INoOperatorWithFunctionalLtStructureRPtr;
+typedef boost::shared_ptr<INoOperatorWithFunctionalLtStructure>       INoOperatorWithFunctionalLtStructureSPtr;
+typedef boost::shared_ptr<const INoOperatorWithFunctionalLtStructure> INoOperatorWithFunctionalLtStructureSCPtr;
+typedef boost::weak_ptr<INoOperatorWithFunctionalLtStructure>         INoOperatorWithFunctionalLtStructureWPtr;
+
+class FunctionalEqStructure;
+typedef FunctionalEqStructure*                         FunctionalEqStructureRPtr;
+typedef boost::shared_ptr<FunctionalEqStructure>       FunctionalEqStructureSPtr;
+typedef boost::shared_ptr<const FunctionalEqStructure> FunctionalEqStructureSCPtr;
+typedef boost::weak_ptr<FunctionalEqStructure>         FunctionalEqStructureWPtr;
+
+class IEqWithNativeEqStructure;
+typedef IEqWithNativeEqStructure*                         IEqWithNativeEqStructureRPtr;
+typedef boost::shared_ptr<IEqWithNativeEqStructure>       IEqWithNativeEqStructureSPtr;
+typedef boost::shared_ptr<const IEqWithNativeEqStructure> IEqWithNativeEqStructureSCPtr;
+typedef boost::weak_ptr<IEqWithNativeEqStructure>         IEqWithNativeEqStructureWPtr;
+
+class IEqWithNativeLtStructure;
+typedef IEqWithNativeLtStructure*                         IEqWithNativeLtStructureRPtr;
+typedef boost::shared_ptr<IEqWithNativeLtStructure>       IEqWithNativeLtStructureSPtr;
+typedef boost::shared_ptr<const IEqWithNativeLtStructure> IEqWithNativeLtStructureSCPtr;
+typedef boost::weak_ptr<IEqWithNativeLtStructure>         IEqWithNativeLtStructureWPtr;
+
+class IFunctionalEqWithFunctionalEqStructure;
+typedef IFunctionalEqWithFunctionalEqStructure*                         IFunctionalEqWithFunctionalEqStructureRPtr;
+typedef boost::shared_ptr<IFunctionalEqWithFunctionalEqStructure>       IFunctionalEqWithFunctionalEqStructureSPtr;
+typedef boost::shared_ptr<const IFunctionalEqWithFunctionalEqStructure> IFunctionalEqWithFunctionalEqStructureSCPtr;
+typedef boost::weak_ptr<IFunctionalEqWithFunctionalEqStructure>         IFunctionalEqWithFunctionalEqStructureWPtr;
+
+class IFunctionalEqWithFunctionalLtStructure;
+typedef IFunctionalEqWithFunctionalLtStructure*                         IFunctionalEqWithFunctionalLtStructureRPtr;
+typedef boost::shared_ptr<IFunctionalEqWithFunctionalLtStructure>       IFunctionalEqWithFunctionalLtStructureSPtr;
+typedef boost::shared_ptr<const IFunctionalEqWithFunctionalLtStructure> IFunctionalEqWithFunctionalLtStructureSCPtr;
+typedef boost::weak_ptr<IFunctionalEqWithFunctionalLtStructure>         IFunctionalEqWithFunctionalLtStructureWPtr;
+
+class IFunctionalEqWithFunctorEqStructure;
+typedef IFunctionalEqWithFunctorEqStructure*                         IFunctionalEqWithFunctorEqStructureRPtr;
+typedef boost::shared_ptr<IFunctionalEqWithFunctorEqStructure>       IFunctionalEqWithFunctorEqStructureSPtr;
+typedef boost::shared_ptr<const IFunctionalEqWithFunctorEqStructure> IFunctionalEqWithFunctorEqStructureSCPtr;
+typedef boost::weak_ptr<IFunctionalEqWithFunctorEqStructure>         IFunctionalEqWithFunctorEqStructureWPtr;
+
+class IFunctionalEqWithFunctorLtStructure;
+typedef IFunctionalEqWithFunctorLtStructure*                         IFunctionalEqWithFunctorLtStructureRPtr;
+typedef boost::shared_ptr<IFunctionalEqWithFunctorLtStructure>       IFunctionalEqWithFunctorLtStructureSPtr;
+typedef boost::shared_ptr<const IFunctionalEqWithFunctorLtStructure> IFunctionalEqWithFunctorLtStructureSCPtr;
+typedef boost::weak_ptr<IFunctionalEqWithFunctorLtStructure>         IFunctionalEqWithFunctorLtStructureWPtr;
+
+class CompareKey;
+typedef CompareKey*                         CompareKeyRPtr;
+typedef boost::shared_ptr<CompareKey>       CompareKeySPtr;
+typedef boost::shared_ptr<const CompareKey> CompareKeySCPtr;
+typedef boost::weak_ptr<CompareKey>         CompareKeyWPtr;
+
+class CompareRecord;
+typedef CompareRecord*                         CompareRecordRPtr;
+typedef boost::shared_ptr<CompareRecord>       CompareRecordSPtr;
+typedef boost::shared_ptr<const CompareRecord> CompareRecordSCPtr;
+typedef boost::weak_ptr<CompareRecord>         CompareRecordWPtr;
+
+class ICompareRecord;
+typedef ICompareRecord*                         ICompareRecordRPtr;
+typedef boost::shared_ptr<ICompareRecord>       ICompareRecordSPtr;
+typedef boost::shared_ptr<const ICompareRecord> ICompareRecordSCPtr;
+typedef boost::weak_ptr<ICompareRecord>         ICompareRecordWPtr;
+
+}
+
+#endif // __STRUCTURE_OPERATOR_COMPIL_H_
+
@@ -0,0 +1,16 @@
+#include "structure/pooled.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace pooled
+{
+
+
+
+
+
+
+}
+
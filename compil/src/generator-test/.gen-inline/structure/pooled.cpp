@@ -0,0 +1,376 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "structure/pooled.h"
+// Compil C++ Template Library
+#include "core/compil/object_pool.h"
+// Standard C Library
+#include <stddef.h>
+
+namespace pooled
+{
+
+Order::Order()
+        : mBuy(default_buy())
+{
+}
+
+Order::~Order()
+{
+}
+
+Order& Order::operator<<(long id)
+{
+    return set_id(id);
+}
+
+const OrderSPtr& operator<<(const OrderSPtr& object, long id)
+{
+    BOOST_ASSERT(object);
+    *object << id;
+    return object;
+}
+
+bool Order::default_buy()
+{
+    return true;
+}
+
+Order& Order::operator<<(bool buy)
+{
+    return set_buy(buy);
+}
+
+const OrderSPtr& operator<<(const OrderSPtr& object, bool buy)
+{
+    BOOST_ASSERT(object);
+    *object << buy;
+    return object;
+}
+
+void* Order::operator new(size_t size)
+{
+    // the derived classes inherit the operator
+    if (size != sizeof(Order))
+        return ::operator new(size);
+    return object_pool<Order>::allocate();
+}
+
+void Order::operator delete(void* object, size_t size)
+{
+    if (size != sizeof(Order))
+        ::operator delete(object);
+    else
+        object_pool<Order>::deallocate(object);
+}
+
+size_t Order::poolThreads()
+{
+    return object_pool<Order>::threads();
+}
+
+size_t Order::poolBlocks()
+{
+    return object_pool<Order>::blocks();
+}
+
+size_t Order::poolAvailable()
+{
+    return object_pool<Order>::available();
+}
+
+size_t Order::poolUsed()
+{
+    return object_pool<Order>::used();
+}
+
+LimitOrder::LimitOrder()
+{
+}
+
+LimitOrder::~LimitOrder()
+{
+}
+
+LimitOrderSPtr LimitOrder::downcast(const OrderSPtr& object)
+{
+    return boost::static_pointer_cast<LimitOrder>(object);
+}
+
+std::string& LimitOrder::mutable_account()
+{
+    return mAccount;
+}
+
+LimitOrder& LimitOrder::operator<<(const std::string& account)
+{
+    return set_account(account);
+}
+
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& object, const std::string& account)
+{
+    BOOST_ASSERT(object);
+    *object << account;
+    return object;
+}
+
+LimitOrder& LimitOrder::set_id(long id)
+{
+    Order::set_id(id);
+    return *this;
+}
+
+LimitOrder& LimitOrder::operator<<(long id)
+{
+    *(Order*)this << id;
+    return *this;
+}
+
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& object, long id)
+{
+    BOOST_ASSERT(object);
+    *object << id;
+    return object;
+}
+
+LimitOrder& LimitOrder::set_buy(bool buy)
+{
+    Order::set_buy(buy);
+    return *this;
+}
+
+LimitOrder& LimitOrder::operator<<(bool buy)
+{
+    *(Order*)this << buy;
+    return *this;
+}
+
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& object, bool buy)
+{
+    BOOST_ASSERT(object);
+    *object << buy;
+    return object;
+}
+
+void* LimitOrder::operator new(size_t size)
+{
+    // the derived classes inherit the operator
+    if (size != sizeof(LimitOrder))
+        return ::operator new(size);
+    return object_pool<LimitOrder>::allocate();
+}
+
+void LimitOrder::operator delete(void* object, size_t size)
+{
+    if (size != sizeof(LimitOrder))
+        ::operator delete(object);
+    else
+        object_pool<LimitOrder>::deallocate(object);
+}
+
+size_t LimitOrder::poolThreads()
+{
+    return object_pool<LimitOrder>::threads();
+}
+
+size_t LimitOrder::poolBlocks()
+{
+    return object_pool<LimitOrder>::blocks();
+}
+
+size_t LimitOrder::poolAvailable()
+{
+    return object_pool<LimitOrder>::available();
+}
+
+size_t LimitOrder::poolUsed()
+{
+    return object_pool<LimitOrder>::used();
+}
+
+MarketOrder::MarketOrder()
+{
+}
+
+MarketOrder::~MarketOrder()
+{
+}
+
+MarketOrderSPtr MarketOrder::downcast(const OrderSPtr& object)
+{
+    return boost::static_pointer_cast<MarketOrder>(object);
+}
+
+std::string& MarketOrder::mutable_venue()
+{
+    return mVenue;
+}
+
+MarketOrder& MarketOrder::operator<<(const std::string& venue)
+{
+    return set_venue(venue);
+}
+
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& object, const std::string& venue)
+{
+    BOOST_ASSERT(object);
+    *object << venue;
+    return object;
+}
+
+MarketOrder& MarketOrder::set_id(long id)
+{
+    Order::set_id(id);
+    return *this;
+}
+
+MarketOrder& MarketOrder::operator<<(long id)
+{
+    *(Order*)this << id;
+    return *this;
+}
+
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& object, long id)
+{
+    BOOST_ASSERT(object);
+    *object << id;
+    return object;
+}
+
+MarketOrder& MarketOrder::set_buy(bool buy)
+{
+    Order::set_buy(buy);
+    return *this;
+}
+
+MarketOrder& MarketOrder::operator<<(bool buy)
+{
+    *(Order*)this << buy;
+    return *this;
+}
+
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& object, bool buy)
+{
+    BOOST_ASSERT(object);
+    *object << buy;
+    return object;
+}
+
+Quote::Builder::Builder()
+        : mpObject(new Quote())
+{
+}
+
+Quote::Builder::Builder(const Quote& object)
+        : mpObject(new Quote())
+{
+    *(Quote*)mpObject = object;
+}
+
+Quote::Builder::Builder(QuoteRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Quote::Builder::~Builder()
+{
+    delete (QuoteRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Quote& Quote::Builder::build() const
+{
+    return *(QuoteRPtr)mpObject;
+}
+
+QuoteSPtr Quote::Builder::finalize()
+{
+    QuoteRPtr objectRPtr = (QuoteRPtr)mpObject;
+    mpObject = NULL;
+    return QuoteSPtr(objectRPtr, boost::checked_deleter<Quote>(), object_pool_allocator<Quote>());
+}
+
+Quote::Quote()
+{
+}
+
+Quote::~Quote()
+{
+}
+
+void* Quote::operator new(size_t size)
+{
+    // the derived classes inherit the operator
+    if (size != sizeof(Quote))
+        return ::operator new(size);
+    return object_pool<Quote>::allocate();
+}
+
+void Quote::operator delete(void* object, size_t size)
+{
+    if (size != sizeof(Quote))
+        ::operator delete(object);
+    else
+        object_pool<Quote>::deallocate(object);
+}
+
+size_t Quote::poolThreads()
+{
+    return object_pool<Quote>::threads();
+}
+
+size_t Quote::poolBlocks()
+{
+    return object_pool<Quote>::blocks();
+}
+
+size_t Quote::poolAvailable()
+{
+    return object_pool<Quote>::available();
+}
+
+size_t Quote::poolUsed()
+{
+    return object_pool<Quote>::used();
+}
+
+PlainOrder::PlainOrder()
+        : mBuy(default_buy())
+{
+}
+
+PlainOrder::~PlainOrder()
+{
+}
+
+PlainOrder& PlainOrder::operator<<(long id)
+{
+    return set_id(id);
+}
+
+const PlainOrderSPtr& operator<<(const PlainOrderSPtr& object, long id)
+{
+    BOOST_ASSERT(object);
+    *object << id;
+    return object;
+}
+
+bool PlainOrder::default_buy()
+{
+    return true;
+}
+
+PlainOrder& PlainOrder::operator<<(bool buy)
+{
+    return set_buy(buy);
+}
+
+const PlainOrderSPtr& operator<<(const PlainOrderSPtr& object, bool buy)
+{
+    BOOST_ASSERT(object);
+    *object << buy;
+    return object;
+}
+
+}
+
@@ -0,0 +1,456 @@
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+
+#ifndef __STRUCTURE_POOLED_COMPIL_H_
+#define __STRUCTURE_POOLED_COMPIL_H_
+
+#include "structure/pooled.h"
+// Compil C++ Template Library
+#include "core/compil/object_pool.h"
+
+template<class T> class snapshot;
+
+namespace pooled
+{
+
+class Order
+{
+public:
+    // Default constructor
+                   Order          ();
+    // Destructor
+    /*lax*/        ~Order         ();
+
+    // Getter method for the data field id
+            long   id             ()                          const;
+    // Setter method for the data field id
+            Order& set_id         (long id);
+    // Store operator for the data field id
+            Order& operator<<     (long id);
+
+    // Getter method for the data field buy
+            bool   buy            ()                          const;
+    // Returns the default value true of the field buy
+    static  bool   default_buy    ();
+    // Setter method for the data field buy
+            Order& set_buy        (bool buy);
+    // Store operator for the data field buy
+            Order& operator<<     (bool buy);
+
+    // Allocates the instances from the per-thread free list pool of the
+    // class. The instances of the derived classes that have other size
+    // come from the heap.
+    static  void*  operator new   (size_t size);
+    // Returns the instance to the pool of the thread that allocated it
+    static  void   operator delete(void* object, size_t size);
+
+    // Returns the number of the running threads that allocated instances
+    static  size_t poolThreads    ();
+    // Returns the number of the pool blocks taken from the heap
+    static  size_t poolBlocks     ();
+    // Returns the number of the pool blocks that are free for reuse
+    static  size_t poolAvailable  ();
+    // Returns the number of the pool blocks that hold instances. It is
+    // approximate while other threads allocate or release instances.
+    static  size_t poolUsed       ();
+
+private:
+    // variable for the data field id
+    long mId;
+    // variable for the data field buy
+    bool mBuy;
+};
+
+// Reference store operator for the data field id
+const OrderSPtr& operator<<(const OrderSPtr& , long );
+// Reference store operator for the data field buy
+const OrderSPtr& operator<<(const OrderSPtr& , bool );
+
+class LimitOrder : public Order
+{
+public:
+    // Default constructor
+                               LimitOrder     ();
+    // Destructor
+    /*lax*/                    ~LimitOrder    ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  LimitOrderSPtr     downcast       (const OrderSPtr& object);
+
+    // Getter method for the data field account
+            const std::string& account        ()                           const;
+    // Setter method for the data field account
+            LimitOrder&        set_account    (const std::string& account);
+    // Provides mutable access to field account
+            std::string&       mutable_account();
+    // Store operator for the data field account
+            LimitOrder&        operator<<     (const std::string& account);
+
+    // Setter method for the data field id
+            LimitOrder&        set_id         (long id);
+    // Store operator for the data field id
+            LimitOrder&        operator<<     (long id);
+
+    // Setter method for the data field buy
+            LimitOrder&        set_buy        (bool buy);
+    // Store operator for the data field buy
+            LimitOrder&        operator<<     (bool buy);
+
+    // Allocates the instances from the per-thread free list pool of the
+    // class. The instances of the derived classes that have other size
+    // come from the heap.
+    static  void*              operator new   (size_t size);
+    // Returns the instance to the pool of the thread that allocated it
+    static  void               operator delete(void* object, size_t size);
+
+    // Returns the number of the running threads that allocated instances
+    static  size_t             poolThreads    ();
+    // Returns the number of the pool blocks taken from the heap
+    static  size_t             poolBlocks     ();
+    // Returns the number of the pool blocks that are free for reuse
+    static  size_t             poolAvailable  ();
+    // Returns the number of the pool blocks that hold instances. It is
+    // approximate while other threads allocate or release instances.
+    static  size_t             poolUsed       ();
+
+private:
+    // variable for the data field account
+    std::string mAccount;
+};
+
+// Reference store operator for the data field id
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& , long );
+// Reference store operator for the data field buy
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& , bool );
+// Reference store operator for the data field account
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& , const std::string& );
+
+class MarketOrder : public Order
+{
+public:
+    // Default constructor
+                               MarketOrder  ();
+    // Destructor
+    /*lax*/                    ~MarketOrder ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  MarketOrderSPtr    downcast     (const OrderSPtr& object);
+
+    // Getter method for the data field venue
+            const std::string& venue        ()                         const;
+    // Setter method for the data field venue
+            MarketOrder&       set_venue    (const std::string& venue);
+    // Provides mutable access to field venue
+            std::string&       mutable_venue();
+    // Store operator for the data field venue
+            MarketOrder&       operator<<   (const std::string& venue);
+
+    // Setter method for the data field id
+            MarketOrder&       set_id       (long id);
+    // Store operator for the data field id
+            MarketOrder&       operator<<   (long id);
+
+    // Setter method for the data field buy
+            MarketOrder&       set_buy      (bool buy);
+    // Store operator for the data field buy
+            MarketOrder&       operator<<   (bool buy);
+
+private:
+    // variable for the data field venue
+    std::string mVenue;
+};
+
+// Reference store operator for the data field id
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& , long );
+// Reference store operator for the data field buy
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& , bool );
+// Reference store operator for the data field venue
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& , const std::string& );
+
+// Quote is an immutable class - once instantiated none of the data fields
+// can be changed. For the initial initialization and instantiation use the
+// nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Quote
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void         operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                             Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                             Builder  (const Quote& object);
+        // Destructor of Builder
+        /*lax*/              ~Builder ();
+
+        // Instantiates Quote instance with the current initialization of
+        // the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Quote& build    ()                    const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                QuoteSPtr    finalize ();
+
+
+        // Setter method for the data field bid
+                Builder&     set_bid  (long bid);
+
+        // Setter method for the data field ask
+                Builder&     set_ask  (long ask);
+
+    protected:
+        // constructor needed from potential derived classes
+                             Builder  (QuoteRPtr pObject);
+
+        QuoteRPtr mpObject;
+    };
+
+    // Default constructor
+                   Quote          ();
+    // Destructor
+    /*lax*/        ~Quote         ();
+
+    // Getter method for the data field bid
+            long   bid            ()                          const;
+
+    // Getter method for the data field ask
+            long   ask            ()                          const;
+
+    // Allocates the instances from the per-thread free list pool of the
+    // class. The instances of the derived classes that have other size
+    // come from the heap.
+    static  void*  operator new   (size_t size);
+    // Returns the instance to the pool of the thread that allocated it
+    static  void   operator delete(void* object, size_t size);
+
+    // Returns the number of the running threads that allocated instances
+    static  size_t poolThreads    ();
+    // Returns the number of the pool blocks taken from the heap
+    static  size_t poolBlocks     ();
+    // Returns the number of the pool blocks that are free for reuse
+    static  size_t poolAvailable  ();
+    // Returns the number of the pool blocks that hold instances. It is
+    // approximate while other threads allocate or release instances.
+    static  size_t poolUsed       ();
+
+private:
+    // variable for the data field bid
+    long mBid;
+    // variable for the data field ask
+    long mAsk;
+};
+
+// Holder of the current Quote shared between threads. The readers get the
+// current object wait-free through a view, the writers publish the results
+// of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Quote> QuoteSnapshot;
+
+class PlainOrder
+{
+public:
+    // Default constructor
+                        PlainOrder ();
+    // Destructor
+    /*lax*/             ~PlainOrder();
+
+    // Getter method for the data field id
+            long        id         ()         const;
+    // Setter method for the data field id
+            PlainOrder& set_id     (long id);
+    // Store operator for the data field id
+            PlainOrder& operator<< (long id);
+
+    // Getter method for the data field buy
+            bool        buy        ()         const;
+    // Returns the default value true of the field buy
+    static  bool        default_buy();
+    // Setter method for the data field buy
+            PlainOrder& set_buy    (bool buy);
+    // Store operator for the data field buy
+            PlainOrder& operator<< (bool buy);
+
+private:
+    // variable for the data field id
+    long mId;
+    // variable for the data field buy
+    bool mBuy;
+};
+
+// Reference store operator for the data field id
+const PlainOrderSPtr& operator<<(const PlainOrderSPtr& , long );
+// Reference store operator for the data field buy
+const PlainOrderSPtr& operator<<(const PlainOrderSPtr& , bool );
+
+inline OrderSPtr orderRef()
+{
+    return OrderSPtr(new Order(), boost::checked_deleter<Order>(), object_pool_allocator<Order>());
+}
+
+inline LimitOrderSPtr limitOrderRef()
+{
+    return LimitOrderSPtr(new LimitOrder(), boost::checked_deleter<LimitOrder>(), object_pool_allocator<LimitOrder>());
+}
+
+inline MarketOrderSPtr marketOrderRef()
+{
+    return boost::make_shared<MarketOrder>();
+}
+
+inline PlainOrderSPtr plainOrderRef()
+{
+    return boost::make_shared<PlainOrder>();
+}
+
+inline long Order::id() const
+{
+    return mId;
+}
+
+inline Order& Order::set_id(long id)
+{
+    mId = id;
+    return *this;
+}
+
+inline bool Order::buy() const
+{
+    return mBuy;
+}
+
+inline Order& Order::set_buy(bool buy)
+{
+    mBuy = buy;
+    return *this;
+}
+
+inline const std::string& LimitOrder::account() const
+{
+    return mAccount;
+}
+
+inline LimitOrder& LimitOrder::set_account(const std::string& account)
+{
+    mAccount = account;
+    return *this;
+}
+
+inline const std::string& MarketOrder::venue() const
+{
+    return mVenue;
+}
+
+inline MarketOrder& MarketOrder::set_venue(const std::string& venue)
+{
+    mVenue = venue;
+    return *this;
+}
+
+inline long Quote::bid() const
+{
+    return mBid;
+}
+
+inline Quote::Builder& Quote::Builder::set_bid(long bid)
+{
+    mpObject->mBid = bid;
+    return *this;
+}
+
+inline long Quote::ask() const
+{
+    return mAsk;
+}
+
+inline Quote::Builder& Quote::Builder::set_ask(long ask)
+{
+    mpObject->mAsk = ask;
+    return *this;
+}
+
+inline long PlainOrder::id() const
+{
+    return mId;
+}
+
+inline PlainOrder& PlainOrder::set_id(long id)
+{
+    mId = id;
+    return *this;
+}
+
+inline bool PlainOrder::buy() const
+{
+    return mBuy;
+}
+
+inline PlainOrder& PlainOrder::set_buy(bool buy)
+{
+    mBuy = buy;
+    return *this;
+}
+
+}
+
+#else // __STRUCTURE_POOLED_COMPIL_H_
+
+namespace pooled
+{
+
+// Forward declarations
+class Order;
+typedef Order*                         OrderRPtr;
+typedef boost::shared_ptr<Order>       OrderSPtr;
+typedef boost::shared_ptr<const Order> OrderSCPtr;
+typedef boost::weak_ptr<Order>         OrderWPtr;
+
+class LimitOrder;
+typedef LimitOrder*                         LimitOrderRPtr;
+typedef boost::shared_ptr<LimitOrder>       LimitOrderSPtr;
+typedef boost::shared_ptr<const LimitOrder> LimitOrderSCPtr;
+typedef boost::weak_ptr<LimitOrder>         LimitOrderWPtr;
+
+class MarketOrder;
+typedef MarketOrder*                         MarketOrderRPtr;
+typedef boost::shared_ptr<MarketOrder>       MarketOrderSPtr;
+typedef boost::shared_ptr<const MarketOrder> MarketOrderSCPtr;
+typedef boost::weak_ptr<MarketOrder>         MarketOrderWPtr;
+
+class Quote;
+typedef Quote*                         QuoteRPtr;
+typedef boost::shared_ptr<Quote>       QuoteSPtr;
+typedef boost::shared_ptr<const Quote> QuoteSCPtr;
+typedef boost::weak_ptr<Quote>         QuoteWPtr;
+
+class PlainOrder;
+typedef PlainOrder*                         PlainOrderRPtr;
+typedef boost::shared_ptr<PlainOrder>       PlainOrderSPtr;
+typedef boost::shared_ptr<const PlainOrder> PlainOrderSCPtr;
+typedef boost::weak_ptr<PlainOrder>         PlainOrderWPtr;
+
+}
+
+#endif // __STRUCTURE_POOLED_COMPIL_H_
+
@@ -0,0 +1,415 @@
+#include "structure/sanity.h"
+// Compil C++ core
+#include <core/platform/benchmark.h>
+// Google Test framework
+#include <gtest/gtest.h>
+// Standard C Library
+#include <string.h>
+
+namespace sanity
+{
+
+TEST(StructureIsInitializeBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize.construction");
+    while (benchmark.running())
+    {
+        StructureIsInitialize structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsInitializeBenchmark, copy)
+{
+    StructureIsInitialize structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize.copy");
+    while (benchmark.running())
+    {
+        StructureIsInitialize structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureIsInitializeBenchmark, fieldAccess)
+{
+    StructureIsInitialize structure;
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.d());
+    }
+}
+
+TEST(StructureIsInitializeBenchmark, fieldUpdate)
+{
+    StructureIsInitialize structure;
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_d(structure.d());
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsInitialize1Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize1.construction");
+    while (benchmark.running())
+    {
+        StructureIsInitialize1 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsInitialize1Benchmark, copy)
+{
+    StructureIsInitialize1 structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize1.copy");
+    while (benchmark.running())
+    {
+        StructureIsInitialize1 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureIsInitialize2Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize2.construction");
+    while (benchmark.running())
+    {
+        StructureIsInitialize2 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsInitialize2Benchmark, copy)
+{
+    StructureIsInitialize2 structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize2.copy");
+    while (benchmark.running())
+    {
+        StructureIsInitialize2 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureNonControlledInheritBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlledInherit.construction");
+    while (benchmark.running())
+    {
+        StructureNonControlledInherit structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureNonControlledInheritBenchmark, copy)
+{
+    StructureNonControlledInherit structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlledInherit.copy");
+    while (benchmark.running())
+    {
+        StructureNonControlledInherit structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureIsInitialize3Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize3.construction");
+    while (benchmark.running())
+    {
+        StructureIsInitialize3 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsInitialize3Benchmark, copy)
+{
+    StructureIsInitialize3 structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize3.copy");
+    while (benchmark.running())
+    {
+        StructureIsInitialize3 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureNonControlledBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlled.construction");
+    while (benchmark.running())
+    {
+        StructureNonControlled structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureNonControlledBenchmark, copy)
+{
+    StructureNonControlled structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlled.copy");
+    while (benchmark.running())
+    {
+        StructureNonControlled structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureIsInitialize4Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize4.construction");
+    while (benchmark.running())
+    {
+        StructureIsInitialize4 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsInitialize4Benchmark, copy)
+{
+    StructureIsInitialize4 structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize4.copy");
+    while (benchmark.running())
+    {
+        StructureIsInitialize4 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureIsInitializeVirtualBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitializeVirtual.construction");
+    while (benchmark.running())
+    {
+        StructureIsInitializeVirtual structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsInitializeVirtualBenchmark, copy)
+{
+    StructureIsInitializeVirtual structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitializeVirtual.copy");
+    while (benchmark.running())
+    {
+        StructureIsInitializeVirtual structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureNonControlledVirtualInheritBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlledVirtualInherit.construction");
+    while (benchmark.running())
+    {
+        StructureNonControlledVirtualInherit structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureNonControlledVirtualInheritBenchmark, copy)
+{
+    StructureNonControlledVirtualInherit structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlledVirtualInherit.copy");
+    while (benchmark.running())
+    {
+        StructureNonControlledVirtualInherit structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureIsInitialize5Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize5.construction");
+    while (benchmark.running())
+    {
+        StructureIsInitialize5 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsInitialize5Benchmark, copy)
+{
+    StructureIsInitialize5 structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize5.copy");
+    while (benchmark.running())
+    {
+        StructureIsInitialize5 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureNonControlledVirtualBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlledVirtual.construction");
+    while (benchmark.running())
+    {
+        StructureNonControlledVirtual structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureNonControlledVirtualBenchmark, copy)
+{
+    StructureNonControlledVirtual structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlledVirtual.copy");
+    while (benchmark.running())
+    {
+        StructureNonControlledVirtual structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureNonControlledVirtualBenchmark, fieldAccess)
+{
+    StructureNonControlledVirtual structure;
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlledVirtual.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.r());
+    }
+}
+
+TEST(StructureNonControlledVirtualBenchmark, fieldUpdate)
+{
+    StructureNonControlledVirtual structure;
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlledVirtual.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_r(structure.r());
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsInitialize6Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize6.construction");
+    while (benchmark.running())
+    {
+        StructureIsInitialize6 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsInitialize6Benchmark, copy)
+{
+    StructureIsInitialize6 structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitialize6.copy");
+    while (benchmark.running())
+    {
+        StructureIsInitialize6 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureIsVoidBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureIsVoid.construction");
+    while (benchmark.running())
+    {
+        StructureIsVoid structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsVoidBenchmark, copy)
+{
+    StructureIsVoid structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureIsVoid.copy");
+    while (benchmark.running())
+    {
+        StructureIsVoid structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureIsVoid1Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureIsVoid1.construction");
+    while (benchmark.running())
+    {
+        StructureIsVoid1 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureIsVoid1Benchmark, copy)
+{
+    StructureIsVoid1 structure1;
+    plt::Benchmark benchmark("structure/sanity.StructureIsVoid1.copy");
+    while (benchmark.running())
+    {
+        StructureIsVoid1 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureIsInitializeVirtualFactoryBenchmark, cloneStructureIsInitializeVirtual)
+{
+    StructureIsInitializeVirtualSPtr object(new StructureIsInitializeVirtual());
+    plt::Benchmark benchmark("structure/sanity.StructureIsInitializeVirtualFactory.cloneStructureIsInitializeVirtual");
+    while (benchmark.running())
+    {
+        StructureIsInitializeVirtualSPtr clone = StructureIsInitializeVirtualFactory::clone(object);
+        benchmark.consume(clone);
+    }
+}
+
+TEST(StructureNonControlledVirtualFactoryBenchmark, cloneStructureNonControlledVirtual)
+{
+    StructureNonControlledVirtualSPtr object(new StructureNonControlledVirtual());
+    plt::Benchmark benchmark("structure/sanity.StructureNonControlledVirtualFactory.cloneStructureNonControlledVirtual");
+    while (benchmark.running())
+    {
+        StructureNonControlledVirtualSPtr clone = StructureNonControlledVirtualFactory::clone(object);
+        benchmark.consume(clone);
+    }
+}
+
+TEST(StructureBaseBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureBase.construction");
+    while (benchmark.running())
+    {
+        StructureBase::Builder builder;
+        StructureBaseSPtr structure = builder.finalize();
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureBaseBenchmark, copy)
+{
+    StructureBaseSPtr structure1 = StructureBase::Builder().finalize();
+    plt::Benchmark benchmark("structure/sanity.StructureBase.copy");
+    while (benchmark.running())
+    {
+        StructureBaseSPtr structure2 = StructureBase::Builder(*structure1).finalize();
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(StructureLeafBenchmark, construction)
+{
+    plt::Benchmark benchmark("structure/sanity.StructureLeaf.construction");
+    while (benchmark.running())
+    {
+        StructureLeaf::Builder builder;
+        StructureLeafSPtr structure = builder.finalize();
+        benchmark.consume(structure);
+    }
+}
+
+TEST(StructureLeafBenchmark, copy)
+{
+    StructureLeafSPtr structure1 = StructureLeaf::Builder().finalize();
+    plt::Benchmark benchmark("structure/sanity.StructureLeaf.copy");
+    while (benchmark.running())
+    {
+        StructureLeafSPtr structure2 = StructureLeaf::Builder(*structure1).finalize();
+        benchmark.consume(structure2);
+    }
+}
+
+}
+
@@ -0,0 +1,800 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "structure/sanity.h"
+// Compil C++ Template Library
+#include "core/compil/object_slab.h"
+// Standard C Library
+#include <stddef.h>
+#include <string.h>
+
+namespace sanity
+{
+
+StructureIsInitialize::StructureIsInitialize()
+        : mBits(0)
+        , mD   (default_d())
+{
+}
+
+StructureIsInitialize::~StructureIsInitialize()
+{
+}
+
+void StructureIsInitialize::erase_r()
+{
+    mR     =  0;
+    mBits &= ~bitmask_r();
+}
+
+void StructureIsInitialize::clear_o()
+{
+    mO     =  0;
+    mBits &= ~bitmask_o();
+}
+
+long StructureIsInitialize::default_d()
+{
+    return 1;
+}
+
+StructureIsInitialize& StructureIsInitialize::update_d(long d)
+{
+    if (default_d() != d)
+        return set_d(d);
+
+    reset_d();
+    return *this;
+}
+
+void StructureIsInitialize::reset_d()
+{
+    mD     =  default_d();
+    mBits &= ~bitmask_d();
+}
+
+StructureIsInitialize1::StructureIsInitialize1()
+{
+    set_r(alter_r());
+}
+
+StructureIsInitialize1::~StructureIsInitialize1()
+{
+}
+
+StructureIsInitialize1SPtr StructureIsInitialize1::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize1>(object);
+}
+
+long StructureIsInitialize1::alter_r()
+{
+    return 5;
+}
+
+StructureIsInitialize1& StructureIsInitialize1::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize1& StructureIsInitialize1::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureIsInitialize1& StructureIsInitialize1::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureIsInitialize2::StructureIsInitialize2()
+        : mBits(0)
+{
+}
+
+StructureIsInitialize2::~StructureIsInitialize2()
+{
+}
+
+StructureIsInitialize2SPtr StructureIsInitialize2::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize2>(object);
+}
+
+void StructureIsInitialize2::erase_r2()
+{
+    mR2    =  0;
+    mBits &= ~bitmask_r2();
+}
+
+StructureIsInitialize2& StructureIsInitialize2::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize2& StructureIsInitialize2::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureIsInitialize2& StructureIsInitialize2::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureNonControlledInherit::StructureNonControlledInherit()
+{
+}
+
+StructureNonControlledInherit::~StructureNonControlledInherit()
+{
+}
+
+StructureNonControlledInheritSPtr StructureNonControlledInherit::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureNonControlledInherit>(object);
+}
+
+StructureNonControlledInheritSPtr StructureNonControlledInherit::shared_from_this()
+{
+    return boost::static_pointer_cast<StructureNonControlledInherit>(
+        boost::enable_shared_from_this<StructureIsInitialize>::shared_from_this());
+}
+
+StructureNonControlledInheritSCPtr StructureNonControlledInherit::shared_from_this() const
+{
+    return boost::static_pointer_cast<const StructureNonControlledInherit>(
+        boost::enable_shared_from_this<StructureIsInitialize>::shared_from_this());
+}
+
+StructureNonControlledInherit& StructureNonControlledInherit::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureNonControlledInherit& StructureNonControlledInherit::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureNonControlledInherit& StructureNonControlledInherit::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureIsInitialize3::StructureIsInitialize3()
+        : mBits(0)
+{
+}
+
+StructureIsInitialize3::~StructureIsInitialize3()
+{
+}
+
+StructureIsInitialize3SPtr StructureIsInitialize3::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize3>(object);
+}
+
+StructureIsInitialize3SPtr StructureIsInitialize3::shared_from_this()
+{
+    return boost::static_pointer_cast<StructureIsInitialize3>(
+        boost::enable_shared_from_this<StructureIsInitialize>::shared_from_this());
+}
+
+StructureIsInitialize3SCPtr StructureIsInitialize3::shared_from_this() const
+{
+    return boost::static_pointer_cast<const StructureIsInitialize3>(
+        boost::enable_shared_from_this<StructureIsInitialize>::shared_from_this());
+}
+
+void StructureIsInitialize3::erase_r3()
+{
+    mR3    =  0;
+    mBits &= ~bitmask_r3();
+}
+
+StructureIsInitialize3& StructureIsInitialize3::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize3& StructureIsInitialize3::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureIsInitialize3& StructureIsInitialize3::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureNonControlled::StructureNonControlled()
+{
+}
+
+StructureNonControlled::~StructureNonControlled()
+{
+}
+
+StructureNonControlledSPtr StructureNonControlled::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureNonControlled>(object);
+}
+
+StructureNonControlled& StructureNonControlled::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureNonControlled& StructureNonControlled::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureNonControlled& StructureNonControlled::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureIsInitialize4::StructureIsInitialize4()
+        : mBits(0)
+{
+}
+
+StructureIsInitialize4::~StructureIsInitialize4()
+{
+}
+
+StructureIsInitialize4SPtr StructureIsInitialize4::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize4>(object);
+}
+
+void StructureIsInitialize4::erase_r4()
+{
+    mR4    =  0;
+    mBits &= ~bitmask_r4();
+}
+
+StructureIsInitialize4& StructureIsInitialize4::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize4& StructureIsInitialize4::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureIsInitialize4& StructureIsInitialize4::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureIsInitializeVirtual::StructureIsInitializeVirtual()
+        : mBits(0)
+{
+}
+
+StructureIsInitializeVirtual::~StructureIsInitializeVirtual()
+{
+}
+
+void StructureIsInitializeVirtual::erase_r()
+{
+    mR     =  0;
+    mBits &= ~bitmask_r();
+}
+
+StructureNonControlledVirtualInherit::StructureNonControlledVirtualInherit()
+{
+}
+
+StructureNonControlledVirtualInherit::~StructureNonControlledVirtualInherit()
+{
+}
+
+StructureNonControlledVirtualInheritSPtr StructureNonControlledVirtualInherit::downcast(const StructureIsInitializeVirtualSPtr& object)
+{
+    return boost::static_pointer_cast<StructureNonControlledVirtualInherit>(object);
+}
+
+StructureNonControlledVirtualInherit& StructureNonControlledVirtualInherit::set_r(long r)
+{
+    StructureIsInitializeVirtual::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize5::StructureIsInitialize5()
+        : mBits(0)
+{
+}
+
+StructureIsInitialize5::~StructureIsInitialize5()
+{
+}
+
+StructureIsInitialize5SPtr StructureIsInitialize5::downcast(const StructureIsInitializeVirtualSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize5>(object);
+}
+
+void StructureIsInitialize5::erase_r5()
+{
+    mR5    =  0;
+    mBits &= ~bitmask_r5();
+}
+
+StructureIsInitialize5& StructureIsInitialize5::set_r(long r)
+{
+    StructureIsInitializeVirtual::set_r(r);
+    return *this;
+}
+
+StructureNonControlledVirtual::StructureNonControlledVirtual()
+{
+}
+
+StructureNonControlledVirtual::~StructureNonControlledVirtual()
+{
+}
+
+StructureIsInitialize6::StructureIsInitialize6()
+        : mBits(0)
+{
+}
+
+StructureIsInitialize6::~StructureIsInitialize6()
+{
+}
+
+StructureIsInitialize6SPtr StructureIsInitialize6::downcast(const StructureNonControlledVirtualSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize6>(object);
+}
+
+void StructureIsInitialize6::erase_r6()
+{
+    mR6    =  0;
+    mBits &= ~bitmask_r6();
+}
+
+StructureIsInitialize6& StructureIsInitialize6::set_r(long r)
+{
+    StructureNonControlledVirtual::set_r(r);
+    return *this;
+}
+
+StructureIsVoid::StructureIsVoid()
+        : mBits(0)
+{
+}
+
+StructureIsVoid::~StructureIsVoid()
+{
+}
+
+bool StructureIsVoid::isVoid() const
+{
+    if (exist_o()) return false;
+    return true;
+}
+
+void StructureIsVoid::clear_o()
+{
+    mO     =  0;
+    mBits &= ~bitmask_o();
+}
+
+StructureIsVoid1::StructureIsVoid1()
+        : mBits(0)
+{
+}
+
+StructureIsVoid1::~StructureIsVoid1()
+{
+}
+
+StructureIsVoid1SPtr StructureIsVoid1::downcast(const StructureIsVoidSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsVoid1>(object);
+}
+
+bool StructureIsVoid1::isVoid() const
+{
+    if (!StructureIsVoid::isVoid()) return false;
+    if (exist_o1()) return false;
+    return true;
+}
+
+void StructureIsVoid1::clear_o1()
+{
+    mO1    =  0;
+    mBits &= ~bitmask_o1();
+}
+
+StructureIsVoid1& StructureIsVoid1::set_o(long o)
+{
+    StructureIsVoid::set_o(o);
+    return *this;
+}
+
+EStructureIsInitializeVirtualId::EStructureIsInitializeVirtualId()
+        : mValue(kInvalid)
+{
+}
+
+EStructureIsInitializeVirtualId::EStructureIsInitializeVirtualId(long value)
+        : mValue(value)
+{
+}
+
+const EStructureIsInitializeVirtualId EStructureIsInitializeVirtualId::invalid()
+{
+    return EStructureIsInitializeVirtualId(kInvalid);
+}
+
+const EStructureIsInitializeVirtualId EStructureIsInitializeVirtualId::structureIsInitializeVirtual()
+{
+    return EStructureIsInitializeVirtualId(kStructureIsInitializeVirtual);
+}
+
+long EStructureIsInitializeVirtualId::value() const
+{
+    return mValue;
+}
+
+const char* EStructureIsInitializeVirtualId::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "StructureIsInitializeVirtual",
+    };
+    return names[(size_t)value];
+}
+
+const char* EStructureIsInitializeVirtualId::shortName() const
+{
+    return shortName(value());
+}
+
+EStructureIsInitializeVirtualId EStructureIsInitializeVirtualId::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        0, 0,
+    };
+    static const char* names[] =
+    {
+        "StructureIsInitializeVirtual",
+        "invalid",
+    };
+    static const size_t lengths[] =
+    {
+        28, 7,
+    };
+    static const long values[] =
+    {
+        kStructureIsInitializeVirtual,
+        kInvalid,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 2;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return EStructureIsInitializeVirtualId();
+    return EStructureIsInitializeVirtualId(values[slot]);
+}
+
+bool EStructureIsInitializeVirtualId::operator==(const EStructureIsInitializeVirtualId& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EStructureIsInitializeVirtualId::operator!=(const EStructureIsInitializeVirtualId& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EStructureIsInitializeVirtualId StructureIsInitializeVirtual::staticStructureIsInitializeVirtualId()
+{
+    return EStructureIsInitializeVirtualId::structureIsInitializeVirtual();
+}
+
+EStructureIsInitializeVirtualId StructureIsInitializeVirtual::runtimeStructureIsInitializeVirtualId() const
+{
+    return staticStructureIsInitializeVirtualId();
+}
+
+StructureIsInitializeVirtualSPtr StructureIsInitializeVirtualFactory::clone(const StructureIsInitializeVirtualSPtr& pObject)
+{
+    switch (pObject->runtimeStructureIsInitializeVirtualId().value())
+    {
+        case EStructureIsInitializeVirtualId::kStructureIsInitializeVirtual:
+        {
+            StructureIsInitializeVirtualSPtr pClone(new StructureIsInitializeVirtual());
+            *pClone = *pObject;
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return StructureIsInitializeVirtualSPtr();
+}
+
+std::vector<StructureIsInitializeVirtualSPtr> StructureIsInitializeVirtualFactory::cloneAll(const std::vector<StructureIsInitializeVirtualSPtr>& objects)
+{
+    // the null objects get the invalid identifier and stay null
+    std::vector<long> ids(objects.size(), 0);
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i])
+            ids[i] = objects[i]->runtimeStructureIsInitializeVirtualId().value();
+    }
+
+    std::vector<StructureIsInitializeVirtualSPtr> result;
+    slab_cloner<StructureIsInitializeVirtual> cloner(objects, ids, 2, result);
+    cloner.clone<StructureIsInitializeVirtual>(EStructureIsInitializeVirtualId::kStructureIsInitializeVirtual);
+    return result;
+}
+
+EStructureNonControlledVirtualId::EStructureNonControlledVirtualId()
+        : mValue(kInvalid)
+{
+}
+
+EStructureNonControlledVirtualId::EStructureNonControlledVirtualId(long value)
+        : mValue(value)
+{
+}
+
+const EStructureNonControlledVirtualId EStructureNonControlledVirtualId::invalid()
+{
+    return EStructureNonControlledVirtualId(kInvalid);
+}
+
+const EStructureNonControlledVirtualId EStructureNonControlledVirtualId::structureNonControlledVirtual()
+{
+    return EStructureNonControlledVirtualId(kStructureNonControlledVirtual);
+}
+
+long EStructureNonControlledVirtualId::value() const
+{
+    return mValue;
+}
+
+const char* EStructureNonControlledVirtualId::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "StructureNonControlledVirtual",
+    };
+    return names[(size_t)value];
+}
+
+const char* EStructureNonControlledVirtualId::shortName() const
+{
+    return shortName(value());
+}
+
+EStructureNonControlledVirtualId EStructureNonControlledVirtualId::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        1, 0,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "StructureNonControlledVirtual",
+    };
+    static const size_t lengths[] =
+    {
+        7, 29,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kStructureNonControlledVirtual,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 2;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return EStructureNonControlledVirtualId();
+    return EStructureNonControlledVirtualId(values[slot]);
+}
+
+bool EStructureNonControlledVirtualId::operator==(const EStructureNonControlledVirtualId& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EStructureNonControlledVirtualId::operator!=(const EStructureNonControlledVirtualId& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EStructureNonControlledVirtualId StructureNonControlledVirtual::staticStructureNonControlledVirtualId()
+{
+    return EStructureNonControlledVirtualId::structureNonControlledVirtual();
+}
+
+EStructureNonControlledVirtualId StructureNonControlledVirtual::runtimeStructureNonControlledVirtualId() const
+{
+    return staticStructureNonControlledVirtualId();
+}
+
+StructureNonControlledVirtualSPtr StructureNonControlledVirtualFactory::clone(const StructureNonControlledVirtualSPtr& pObject)
+{
+    switch (pObject->runtimeStructureNonControlledVirtualId().value())
+    {
+        case EStructureNonControlledVirtualId::kStructureNonControlledVirtual:
+        {
+            StructureNonControlledVirtualSPtr pClone(new StructureNonControlledVirtual());
+            *pClone = *pObject;
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return StructureNonControlledVirtualSPtr();
+}
+
+std::vector<StructureNonControlledVirtualSPtr> StructureNonControlledVirtualFactory::cloneAll(const std::vector<StructureNonControlledVirtualSPtr>& objects)
+{
+    // the null objects get the invalid identifier and stay null
+    std::vector<long> ids(objects.size(), 0);
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i])
+            ids[i] = objects[i]->runtimeStructureNonControlledVirtualId().value();
+    }
+
+    std::vector<StructureNonControlledVirtualSPtr> result;
+    slab_cloner<StructureNonControlledVirtual> cloner(objects, ids, 2, result);
+    cloner.clone<StructureNonControlledVirtual>(EStructureNonControlledVirtualId::kStructureNonControlledVirtual);
+    return result;
+}
+
+StructureBase::Builder::Builder()
+        : mpObject(new StructureBase())
+{
+}
+
+StructureBase::Builder::Builder(const StructureBase& object)
+        : mpObject(new StructureBase())
+{
+    *(StructureBase*)mpObject = object;
+}
+
+StructureBase::Builder::Builder(StructureBaseRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+StructureBase::Builder::~Builder()
+{
+    delete (StructureBaseRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const StructureBase& StructureBase::Builder::build() const
+{
+    return *(StructureBaseRPtr)mpObject;
+}
+
+StructureBaseSPtr StructureBase::Builder::finalize()
+{
+    StructureBaseRPtr objectRPtr = (StructureBaseRPtr)mpObject;
+    mpObject = NULL;
+    return StructureBaseSPtr(objectRPtr);
+}
+
+StructureBase::StructureBase()
+{
+}
+
+StructureBase::~StructureBase()
+{
+}
+
+StructureAbstract::StructureAbstract()
+{
+}
+
+StructureAbstract::~StructureAbstract()
+{
+}
+
+StructureAbstractSPtr StructureAbstract::downcast(const StructureBaseSPtr& object)
+{
+    return boost::static_pointer_cast<StructureAbstract>(object);
+}
+
+StructureLeaf::Builder::Builder()
+        : StructureAbstract::Builder(new StructureLeaf())
+{
+}
+
+StructureLeaf::Builder::Builder(const StructureLeaf& object)
+        : StructureAbstract::Builder(new StructureLeaf())
+{
+    *(StructureLeaf*)mpObject = object;
+}
+
+StructureLeaf::Builder::Builder(StructureLeafRPtr pObject)
+        : StructureAbstract::Builder(pObject)
+{
+}
+
+StructureLeaf::Builder::~Builder()
+{
+    delete (StructureLeafRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const StructureLeaf& StructureLeaf::Builder::build() const
+{
+    return *(StructureLeafRPtr)mpObject;
+}
+
+StructureLeafSPtr StructureLeaf::Builder::finalize()
+{
+    StructureLeafRPtr objectRPtr = (StructureLeafRPtr)mpObject;
+    mpObject = NULL;
+    return StructureLeafSPtr(objectRPtr);
+}
+
+StructureLeaf::StructureLeaf()
+{
+}
+
+StructureLeaf::~StructureLeaf()
+{
+}
+
+StructureLeafSPtr StructureLeaf::downcast(const StructureBaseSPtr& object)
+{
+    return boost::static_pointer_cast<StructureLeaf>(object);
+}
+
+}
+
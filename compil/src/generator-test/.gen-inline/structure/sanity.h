@@ -0,0 +1,1388 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <vector>
+
+#ifndef __STRUCTURE_SANITY_COMPIL_H_
+#define __STRUCTURE_SANITY_COMPIL_H_
+
+#include "structure/sanity.h"
+// Boost C++ Smart Pointers
+#include <boost/enable_shared_from_this.hpp>
+// Standard C Library
+#include <stddef.h>
+
+template<class T> class snapshot;
+
+namespace sanity
+{
+
+class StructureIsInitialize : public boost::enable_shared_from_this<StructureIsInitialize>
+{
+public:
+    // Default constructor
+                                   StructureIsInitialize ();
+    // Destructor
+    /*lax*/                        ~StructureIsInitialize();
+
+    // Returns true if every required field is initialized.
+            bool                   isInitialized         ()       const;
+
+    // Getter method for the data field r
+            long                   r                     ()       const;
+    // Returns true if the data field r was set and could be considered
+    // valid
+            bool                   valid_r               ()       const;
+    // Setter method for the data field r
+            StructureIsInitialize& set_r                 (long r);
+    // Erases the required data field r. Object can not be instantiated
+    // before the field data is set again
+            void                   erase_r               ();
+
+    // Getter method for the data field o
+            long                   o                     ()       const;
+    // Checks if the optional field o exists
+            bool                   exist_o               ()       const;
+    // Setter method for the data field o
+            StructureIsInitialize& set_o                 (long o);
+    // Clears the optional data field o
+            void                   clear_o               ();
+
+    // Getter method for the data field d
+            long                   d                     ()       const;
+    // Returns true if the data field value d was changed from its default
+    // value 1
+            bool                   changed_d             ()       const;
+    // Returns the default value 1 of the field d
+    static  long                   default_d             ();
+    // Setter method for the data field d
+            StructureIsInitialize& set_d                 (long d);
+    // Updates the data field d. If the new value is equal to the default
+    // it clears the field else it sets it to the new value
+            StructureIsInitialize& update_d              (long d);
+    // Resets the data field d to its default value 1
+            void                   reset_d               ();
+
+private:
+    // Returns unique bitmask value for the field r
+    static int bitmask_r();
+    // Returns unique bitmask value for the field o
+    static int bitmask_o();
+    // Returns unique bitmask value for the field d
+    static int bitmask_d();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r
+    long mR;
+    // variable for the data field o
+    long mO;
+    // variable for the data field d
+    long mD;
+};
+
+class StructureIsInitialize1 : public StructureIsInitialize
+{
+public:
+    // Default constructor
+                                       StructureIsInitialize1 ();
+    // Destructor
+    /*lax*/                            ~StructureIsInitialize1();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize1SPtr downcast               (const StructureIsInitializeSPtr& object);
+
+    // Returns the alter value 5 of the field r
+    static  long                       alter_r                ();
+
+    // Setter method for the data field r
+            StructureIsInitialize1&    set_r                  (long r);
+
+    // Setter method for the data field o
+            StructureIsInitialize1&    set_o                  (long o);
+
+    // Setter method for the data field d
+            StructureIsInitialize1&    set_d                  (long d);
+};
+
+class StructureIsInitialize2 : public StructureIsInitialize
+{
+public:
+    // Default constructor
+                                       StructureIsInitialize2 ();
+    // Destructor
+    /*lax*/                            ~StructureIsInitialize2();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize2SPtr downcast               (const StructureIsInitializeSPtr& object);
+
+    // Returns true if every required field is initialized.
+            bool                       isInitialized          ()                                        const;
+
+    // Getter method for the data field r2
+            long                       r2                     ()                                        const;
+    // Returns true if the data field r2 was set and could be considered
+    // valid
+            bool                       valid_r2               ()                                        const;
+    // Setter method for the data field r2
+            StructureIsInitialize2&    set_r2                 (long r2);
+    // Erases the required data field r2. Object can not be instantiated
+    // before the field data is set again
+            void                       erase_r2               ();
+
+    // Setter method for the data field r
+            StructureIsInitialize2&    set_r                  (long r);
+
+    // Setter method for the data field o
+            StructureIsInitialize2&    set_o                  (long o);
+
+    // Setter method for the data field d
+            StructureIsInitialize2&    set_d                  (long d);
+
+private:
+    // Returns unique bitmask value for the field r2
+    static int bitmask_r2();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r2
+    long mR2;
+};
+
+class StructureNonControlledInherit : public StructureIsInitialize
+{
+public:
+    // Default constructor
+                                               StructureNonControlledInherit ();
+    // Destructor
+    /*lax*/                                    ~StructureNonControlledInherit();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureNonControlledInheritSPtr  downcast                      (const StructureIsInitializeSPtr& object);
+    // shared_from_this is a helper method that overrides the
+    // shared_from_this method that is implemented in
+    // boost::enable_shared_from_this base class. The only purpose of this
+    // helper method is to eliminate the need of downcasting to shared_ptr
+    // to this class.
+            StructureNonControlledInheritSPtr  shared_from_this              ();
+    // This method is exactly the same as the previous one with exception
+    // that it allows shared_from_this to be called from const methods.
+            StructureNonControlledInheritSCPtr shared_from_this              ()                                        const;
+
+    // Setter method for the data field r
+            StructureNonControlledInherit&     set_r                         (long r);
+
+    // Setter method for the data field o
+            StructureNonControlledInherit&     set_o                         (long o);
+
+    // Setter method for the data field d
+            StructureNonControlledInherit&     set_d                         (long d);
+};
+
+class StructureIsInitialize3 : public StructureNonControlledInherit
+{
+public:
+    // Default constructor
+                                        StructureIsInitialize3 ();
+    // Destructor
+    /*lax*/                             ~StructureIsInitialize3();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize3SPtr  downcast               (const StructureIsInitializeSPtr& object);
+    // shared_from_this is a helper method that overrides the
+    // shared_from_this method that is implemented in
+    // boost::enable_shared_from_this base class. The only purpose of this
+    // helper method is to eliminate the need of downcasting to shared_ptr
+    // to this class.
+            StructureIsInitialize3SPtr  shared_from_this       ();
+    // This method is exactly the same as the previous one with exception
+    // that it allows shared_from_this to be called from const methods.
+            StructureIsInitialize3SCPtr shared_from_this       ()                                        const;
+
+    // Returns true if every required field is initialized.
+            bool                        isInitialized          ()                                        const;
+
+    // Getter method for the data field r3
+            long                        r3                     ()                                        const;
+    // Returns true if the data field r3 was set and could be considered
+    // valid
+            bool                        valid_r3               ()                                        const;
+    // Setter method for the data field r3
+            StructureIsInitialize3&     set_r3                 (long r3);
+    // Erases the required data field r3. Object can not be instantiated
+    // before the field data is set again
+            void                        erase_r3               ();
+
+    // Setter method for the data field r
+            StructureIsInitialize3&     set_r                  (long r);
+
+    // Setter method for the data field o
+            StructureIsInitialize3&     set_o                  (long o);
+
+    // Setter method for the data field d
+            StructureIsInitialize3&     set_d                  (long d);
+
+private:
+    // Returns unique bitmask value for the field r3
+    static int bitmask_r3();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r3
+    long mR3;
+};
+
+class StructureNonControlled : public StructureIsInitialize
+{
+public:
+    // Default constructor
+                                       StructureNonControlled ();
+    // Destructor
+    /*lax*/                            ~StructureNonControlled();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureNonControlledSPtr downcast               (const StructureIsInitializeSPtr& object);
+
+    // Setter method for the data field r
+            StructureNonControlled&    set_r                  (long r);
+
+    // Setter method for the data field o
+            StructureNonControlled&    set_o                  (long o);
+
+    // Setter method for the data field d
+            StructureNonControlled&    set_d                  (long d);
+};
+
+class StructureIsInitialize4 : public StructureNonControlled
+{
+public:
+    // Default constructor
+                                       StructureIsInitialize4 ();
+    // Destructor
+    /*lax*/                            ~StructureIsInitialize4();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize4SPtr downcast               (const StructureIsInitializeSPtr& object);
+
+    // Returns true if every required field is initialized.
+            bool                       isInitialized          ()                                        const;
+
+    // Getter method for the data field r4
+            long                       r4                     ()                                        const;
+    // Returns true if the data field r4 was set and could be considered
+    // valid
+            bool                       valid_r4               ()                                        const;
+    // Setter method for the data field r4
+            StructureIsInitialize4&    set_r4                 (long r4);
+    // Erases the required data field r4. Object can not be instantiated
+    // before the field data is set again
+            void                       erase_r4               ();
+
+    // Setter method for the data field r
+            StructureIsInitialize4&    set_r                  (long r);
+
+    // Setter method for the data field o
+            StructureIsInitialize4&    set_o                  (long o);
+
+    // Setter method for the data field d
+            StructureIsInitialize4&    set_d                  (long d);
+
+private:
+    // Returns unique bitmask value for the field r4
+    static int bitmask_r4();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r4
+    long mR4;
+};
+
+class StructureIsInitializeVirtual
+{
+public:
+    // Default constructor
+                                            StructureIsInitializeVirtual         ();
+    // Destructor
+    virtual                                 ~StructureIsInitializeVirtual        ();
+
+    // Returns true if every required field is initialized.
+    virtual bool                            isInitialized                        ()       const;
+
+    // Identifier for the objects from StructureIsInitializeVirtual class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructureIsInitializeVirtualId staticStructureIsInitializeVirtualId ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructureIsInitializeVirtualId runtimeStructureIsInitializeVirtualId()       const;
+
+    // Getter method for the data field r
+            long                            r                                    ()       const;
+    // Returns true if the data field r was set and could be considered
+    // valid
+            bool                            valid_r                              ()       const;
+    // Setter method for the data field r
+            StructureIsInitializeVirtual&   set_r                                (long r);
+    // Erases the required data field r. Object can not be instantiated
+    // before the field data is set again
+            void                            erase_r                              ();
+
+private:
+    // Returns unique bitmask value for the field r
+    static int bitmask_r();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r
+    long mR;
+};
+
+class StructureNonControlledVirtualInherit : public StructureIsInitializeVirtual
+{
+public:
+    // Default constructor
+                                                     StructureNonControlledVirtualInherit ();
+    // Destructor
+    virtual                                          ~StructureNonControlledVirtualInherit();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureNonControlledVirtualInheritSPtr downcast                             (const StructureIsInitializeVirtualSPtr& object);
+
+    // Setter method for the data field r
+            StructureNonControlledVirtualInherit&    set_r                                (long r);
+};
+
+class StructureIsInitialize5 : public StructureNonControlledVirtualInherit
+{
+public:
+    // Default constructor
+                                       StructureIsInitialize5 ();
+    // Destructor
+    virtual                            ~StructureIsInitialize5();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize5SPtr downcast               (const StructureIsInitializeVirtualSPtr& object);
+
+    // Returns true if every required field is initialized.
+    virtual bool                       isInitialized          ()                                               const;
+
+    // Getter method for the data field r5
+            long                       r5                     ()                                               const;
+    // Returns true if the data field r5 was set and could be considered
+    // valid
+            bool                       valid_r5               ()                                               const;
+    // Setter method for the data field r5
+            StructureIsInitialize5&    set_r5                 (long r5);
+    // Erases the required data field r5. Object can not be instantiated
+    // before the field data is set again
+            void                       erase_r5               ();
+
+    // Setter method for the data field r
+            StructureIsInitialize5&    set_r                  (long r);
+
+private:
+    // Returns unique bitmask value for the field r5
+    static int bitmask_r5();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r5
+    long mR5;
+};
+
+class StructureNonControlledVirtual
+{
+public:
+    // Default constructor
+                                             StructureNonControlledVirtual         ();
+    // Destructor
+    virtual                                  ~StructureNonControlledVirtual        ();
+
+    // Identifier for the objects from StructureNonControlledVirtual class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructureNonControlledVirtualId staticStructureNonControlledVirtualId ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructureNonControlledVirtualId runtimeStructureNonControlledVirtualId()       const;
+
+    // Getter method for the data field r
+            long                             r                                     ()       const;
+    // Setter method for the data field r
+            StructureNonControlledVirtual&   set_r                                 (long r);
+
+private:
+    // variable for the data field r
+    long mR;
+};
+
+class StructureIsInitialize6 : public StructureNonControlledVirtual
+{
+public:
+    // Default constructor
+                                       StructureIsInitialize6 ();
+    // Destructor
+    virtual                            ~StructureIsInitialize6();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize6SPtr downcast               (const StructureNonControlledVirtualSPtr& object);
+
+    // Returns true if every required field is initialized.
+    virtual bool                       isInitialized          ()                                                const;
+
+    // Getter method for the data field r6
+            long                       r6                     ()                                                const;
+    // Returns true if the data field r6 was set and could be considered
+    // valid
+            bool                       valid_r6               ()                                                const;
+    // Setter method for the data field r6
+            StructureIsInitialize6&    set_r6                 (long r6);
+    // Erases the required data field r6. Object can not be instantiated
+    // before the field data is set again
+            void                       erase_r6               ();
+
+    // Setter method for the data field r
+            StructureIsInitialize6&    set_r                  (long r);
+
+private:
+    // Returns unique bitmask value for the field r6
+    static int bitmask_r6();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r6
+    long mR6;
+};
+
+class StructureIsVoid
+{
+public:
+    // Default constructor
+                             StructureIsVoid ();
+    // Destructor
+    /*lax*/                  ~StructureIsVoid();
+
+    // Returns true if every required field is initialized.
+            bool             isInitialized   ()       const;
+
+            bool             isVoid          ()       const;
+
+    // Getter method for the data field o
+            long             o               ()       const;
+    // Checks if the optional field o exists
+            bool             exist_o         ()       const;
+    // Setter method for the data field o
+            StructureIsVoid& set_o           (long o);
+    // Clears the optional data field o
+            void             clear_o         ();
+
+private:
+    // Returns unique bitmask value for the field o
+    static int bitmask_o();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field o
+    long mO;
+};
+
+class StructureIsVoid1 : public StructureIsVoid
+{
+public:
+    // Default constructor
+                                 StructureIsVoid1 ();
+    // Destructor
+    /*lax*/                      ~StructureIsVoid1();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsVoid1SPtr downcast         (const StructureIsVoidSPtr& object);
+
+    // Returns true if every required field is initialized.
+            bool                 isInitialized    ()                                  const;
+
+            bool                 isVoid           ()                                  const;
+
+    // Getter method for the data field o1
+            long                 o1               ()                                  const;
+    // Checks if the optional field o1 exists
+            bool                 exist_o1         ()                                  const;
+    // Setter method for the data field o1
+            StructureIsVoid1&    set_o1           (long o1);
+    // Clears the optional data field o1
+            void                 clear_o1         ();
+
+    // Setter method for the data field o
+            StructureIsVoid1&    set_o            (long o);
+
+private:
+    // Returns unique bitmask value for the field o1
+    static int bitmask_o1();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field o1
+    long mO1;
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EStructureIsInitializeVirtualId
+{
+public:
+    // Default constructor - sets the value to invalid
+                                             EStructureIsInitializeVirtualId();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit                                 EStructureIsInitializeVirtualId(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long                            value                          ()                                              const;
+    // Returns short name for a specified enum value
+    static   const char*                     shortName                      (long value);
+    // Returns short name of the enum value
+             const char*                     shortName                      ()                                              const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   EStructureIsInitializeVirtualId fromString                     (const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool                            operator==                     (const EStructureIsInitializeVirtualId& rValue) const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool                            operator!=                     (const EStructureIsInitializeVirtualId& rValue) const;
+
+    // static methods for enum class objects
+    static const EStructureIsInitializeVirtualId invalid                     ();
+    static const EStructureIsInitializeVirtualId structureIsInitializeVirtual();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid                      = 0,
+        kStructureIsInitializeVirtual = 1,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class StructureIsInitializeVirtualFactory
+{
+public:
+    static StructureIsInitializeVirtualSPtr clone(const StructureIsInitializeVirtualSPtr& object);
+
+    // Clones all the objects, preserving their order. The objects of the
+    // same type are copied together in a contiguous slab. The slab and all
+    // its clones are released with the last of them, a surviving clone
+    // keeps its siblings alive without running their destructors.
+    static std::vector<StructureIsInitializeVirtualSPtr> cloneAll(const std::vector<StructureIsInitializeVirtualSPtr>& objects);
+};
+
+// Static visitor of the StructureIsInitializeVirtual hierarchy. The accept
+// method dispatches the object with a single indirect call through a table
+// indexed by its runtime identification. The derived visitor overrides
+// visit for the structures it handles and brings the rest in scope with a
+// using declaration. The visits it does not override fall back to the
+// visit of the nearest identified base structure.
+template<class Derived, class Result = void>
+class StructureIsInitializeVirtualVisitor
+{
+public:
+    Result accept(const StructureIsInitializeVirtualSPtr& object)
+    {
+        typedef Result (*Thunk)(Derived&, const StructureIsInitializeVirtualSPtr&);
+        // the table follows the values of the identification enumeration
+        static const Thunk thunks[] =
+        {
+            &thunk<StructureIsInitializeVirtual>,
+            &thunk<StructureIsInitializeVirtual>,
+        };
+        return thunks[object->runtimeStructureIsInitializeVirtualId().value()](static_cast<Derived&>(*this), object);
+    }
+
+    Result visit(const StructureIsInitializeVirtualSPtr&)
+    {
+        return Result();
+    }
+
+protected:
+    ~StructureIsInitializeVirtualVisitor()
+    {
+    }
+
+private:
+    template<class T>
+    static Result thunk(Derived& visitor, const StructureIsInitializeVirtualSPtr& object)
+    {
+        return visitor.visit(boost::static_pointer_cast<T>(object));
+    }
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EStructureNonControlledVirtualId
+{
+public:
+    // Default constructor - sets the value to invalid
+                                              EStructureNonControlledVirtualId();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit                                  EStructureNonControlledVirtualId(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long                             value                           ()                                               const;
+    // Returns short name for a specified enum value
+    static   const char*                      shortName                       (long value);
+    // Returns short name of the enum value
+             const char*                      shortName                       ()                                               const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   EStructureNonControlledVirtualId fromString                      (const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool                             operator==                      (const EStructureNonControlledVirtualId& rValue) const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool                             operator!=                      (const EStructureNonControlledVirtualId& rValue) const;
+
+    // static methods for enum class objects
+    static const EStructureNonControlledVirtualId invalid                      ();
+    static const EStructureNonControlledVirtualId structureNonControlledVirtual();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid                       = 0,
+        kStructureNonControlledVirtual = 1,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class StructureNonControlledVirtualFactory
+{
+public:
+    static StructureNonControlledVirtualSPtr clone(const StructureNonControlledVirtualSPtr& object);
+
+    // Clones all the objects, preserving their order. The objects of the
+    // same type are copied together in a contiguous slab. The slab and all
+    // its clones are released with the last of them, a surviving clone
+    // keeps its siblings alive without running their destructors.
+    static std::vector<StructureNonControlledVirtualSPtr> cloneAll(const std::vector<StructureNonControlledVirtualSPtr>& objects);
+};
+
+// Static visitor of the StructureNonControlledVirtual hierarchy. The
+// accept method dispatches the object with a single indirect call through
+// a table indexed by its runtime identification. The derived visitor
+// overrides visit for the structures it handles and brings the rest in
+// scope with a using declaration. The visits it does not override fall
+// back to the visit of the nearest identified base structure.
+template<class Derived, class Result = void>
+class StructureNonControlledVirtualVisitor
+{
+public:
+    Result accept(const StructureNonControlledVirtualSPtr& object)
+    {
+        typedef Result (*Thunk)(Derived&, const StructureNonControlledVirtualSPtr&);
+        // the table follows the values of the identification enumeration
+        static const Thunk thunks[] =
+        {
+            &thunk<StructureNonControlledVirtual>,
+            &thunk<StructureNonControlledVirtual>,
+        };
+        return thunks[object->runtimeStructureNonControlledVirtualId().value()](static_cast<Derived&>(*this), object);
+    }
+
+    Result visit(const StructureNonControlledVirtualSPtr&)
+    {
+        return Result();
+    }
+
+protected:
+    ~StructureNonControlledVirtualVisitor()
+    {
+    }
+
+private:
+    template<class T>
+    static Result thunk(Derived& visitor, const StructureNonControlledVirtualSPtr& object)
+    {
+        return visitor.visit(boost::static_pointer_cast<T>(object));
+    }
+};
+
+// StructureBase is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class StructureBase
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                 operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                     Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                     Builder  (const StructureBase& object);
+        // Destructor of Builder
+        /*lax*/                      ~Builder ();
+
+        // Instantiates StructureBase instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const StructureBase& build    ()                            const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                StructureBaseSPtr    finalize ();
+
+
+    protected:
+        // constructor needed from potential derived classes
+                                     Builder  (StructureBaseRPtr pObject);
+
+        StructureBaseRPtr mpObject;
+    };
+
+    // Default constructor
+            StructureBase ();
+    // Destructor
+    /*lax*/ ~StructureBase();
+};
+
+// Holder of the current StructureBase shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<StructureBase> StructureBaseSnapshot;
+
+// StructureAbstract is an immutable class - once instantiated none of the
+// data fields can be changed. For the initial initialization and
+// instantiation use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class StructureAbstract : public StructureBase
+{
+public:
+    // Default constructor
+                                  StructureAbstract ();
+    // Destructor
+    /*lax*/                       ~StructureAbstract();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureAbstractSPtr downcast          (const StructureBaseSPtr& object);
+};
+
+// Holder of the current StructureAbstract shared between threads. The
+// readers get the current object wait-free through a view, the writers
+// publish the results of Builder::finalize(). It needs the core snapshot
+// header.
+typedef snapshot<StructureAbstract> StructureAbstractSnapshot;
+
+// StructureLeaf is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class StructureLeaf : public StructureAbstract
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder : public StructureAbstract::Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                 operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                     Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                     Builder  (const StructureLeaf& object);
+        // Destructor of Builder
+        /*lax*/                      ~Builder ();
+
+        // Instantiates StructureLeaf instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const StructureLeaf& build    ()                            const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                StructureLeafSPtr    finalize ();
+
+
+    protected:
+        // constructor needed from potential derived classes
+                                     Builder  (StructureLeafRPtr pObject);
+    };
+
+    // Default constructor
+                              StructureLeaf ();
+    // Destructor
+    /*lax*/                   ~StructureLeaf();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureLeafSPtr downcast      (const StructureBaseSPtr& object);
+};
+
+// Holder of the current StructureLeaf shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<StructureLeaf> StructureLeafSnapshot;
+
+inline int StructureIsInitialize::bitmask_r()
+{
+    return 0x1;
+}
+
+inline int StructureIsInitialize::bitmask_o()
+{
+    return 0x2;
+}
+
+inline int StructureIsInitialize::bitmask_d()
+{
+    return 0x4;
+}
+
+inline bool StructureIsInitialize::isInitialized() const
+{
+    if (!valid_r()) return false;
+    return true;
+}
+
+inline long StructureIsInitialize::r() const
+{
+    BOOST_ASSERT(valid_r());
+    return mR;
+}
+
+inline bool StructureIsInitialize::valid_r() const
+{
+    return (mBits & bitmask_r()) != 0;
+}
+
+inline StructureIsInitialize& StructureIsInitialize::set_r(long r)
+{
+    mR     = r;
+    mBits |= bitmask_r();
+    return *this;
+}
+
+inline long StructureIsInitialize::o() const
+{
+    BOOST_ASSERT(exist_o());
+    return mO;
+}
+
+inline bool StructureIsInitialize::exist_o() const
+{
+    return (mBits & bitmask_o()) != 0;
+}
+
+inline StructureIsInitialize& StructureIsInitialize::set_o(long o)
+{
+    mO     = o;
+    mBits |= bitmask_o();
+    return *this;
+}
+
+inline long StructureIsInitialize::d() const
+{
+    return mD;
+}
+
+inline bool StructureIsInitialize::changed_d() const
+{
+    return (mBits & bitmask_d()) != 0;
+}
+
+inline StructureIsInitialize& StructureIsInitialize::set_d(long d)
+{
+    mD     = d;
+    mBits |= bitmask_d();
+    return *this;
+}
+
+inline int StructureIsInitialize2::bitmask_r2()
+{
+    return 0x1;
+}
+
+inline bool StructureIsInitialize2::isInitialized() const
+{
+    if (!StructureIsInitialize::isInitialized()) return false;
+    if (!valid_r2()) return false;
+    return true;
+}
+
+inline long StructureIsInitialize2::r2() const
+{
+    BOOST_ASSERT(valid_r2());
+    return mR2;
+}
+
+inline bool StructureIsInitialize2::valid_r2() const
+{
+    return (mBits & bitmask_r2()) != 0;
+}
+
+inline StructureIsInitialize2& StructureIsInitialize2::set_r2(long r2)
+{
+    mR2    = r2;
+    mBits |= bitmask_r2();
+    return *this;
+}
+
+inline int StructureIsInitialize3::bitmask_r3()
+{
+    return 0x1;
+}
+
+inline bool StructureIsInitialize3::isInitialized() const
+{
+    // structure StructureNonControlledInherit is not controlled. This function assume it is initilized
+    if (!StructureIsInitialize::isInitialized()) return false;
+    if (!valid_r3()) return false;
+    return true;
+}
+
+inline long StructureIsInitialize3::r3() const
+{
+    BOOST_ASSERT(valid_r3());
+    return mR3;
+}
+
+inline bool StructureIsInitialize3::valid_r3() const
+{
+    return (mBits & bitmask_r3()) != 0;
+}
+
+inline StructureIsInitialize3& StructureIsInitialize3::set_r3(long r3)
+{
+    mR3    = r3;
+    mBits |= bitmask_r3();
+    return *this;
+}
+
+inline int StructureIsInitialize4::bitmask_r4()
+{
+    return 0x1;
+}
+
+inline bool StructureIsInitialize4::isInitialized() const
+{
+    // structure StructureNonControlled is not controlled. This function assume it is initilized
+    if (!StructureIsInitialize::isInitialized()) return false;
+    if (!valid_r4()) return false;
+    return true;
+}
+
+inline long StructureIsInitialize4::r4() const
+{
+    BOOST_ASSERT(valid_r4());
+    return mR4;
+}
+
+inline bool StructureIsInitialize4::valid_r4() const
+{
+    return (mBits & bitmask_r4()) != 0;
+}
+
+inline StructureIsInitialize4& StructureIsInitialize4::set_r4(long r4)
+{
+    mR4    = r4;
+    mBits |= bitmask_r4();
+    return *this;
+}
+
+inline int StructureIsInitializeVirtual::bitmask_r()
+{
+    return 0x1;
+}
+
+inline bool StructureIsInitializeVirtual::isInitialized() const
+{
+    if (!valid_r()) return false;
+    return true;
+}
+
+inline long StructureIsInitializeVirtual::r() const
+{
+    BOOST_ASSERT(valid_r());
+    return mR;
+}
+
+inline bool StructureIsInitializeVirtual::valid_r() const
+{
+    return (mBits & bitmask_r()) != 0;
+}
+
+inline StructureIsInitializeVirtual& StructureIsInitializeVirtual::set_r(long r)
+{
+    mR     = r;
+    mBits |= bitmask_r();
+    return *this;
+}
+
+inline int StructureIsInitialize5::bitmask_r5()
+{
+    return 0x1;
+}
+
+inline bool StructureIsInitialize5::isInitialized() const
+{
+    // structure StructureNonControlledVirtualInherit is not controlled. This function assume it is initilized
+    if (!StructureIsInitializeVirtual::isInitialized()) return false;
+    if (!valid_r5()) return false;
+    return true;
+}
+
+inline long StructureIsInitialize5::r5() const
+{
+    BOOST_ASSERT(valid_r5());
+    return mR5;
+}
+
+inline bool StructureIsInitialize5::valid_r5() const
+{
+    return (mBits & bitmask_r5()) != 0;
+}
+
+inline StructureIsInitialize5& StructureIsInitialize5::set_r5(long r5)
+{
+    mR5    = r5;
+    mBits |= bitmask_r5();
+    return *this;
+}
+
+inline long StructureNonControlledVirtual::r() const
+{
+    return mR;
+}
+
+inline StructureNonControlledVirtual& StructureNonControlledVirtual::set_r(long r)
+{
+    mR = r;
+    return *this;
+}
+
+inline int StructureIsInitialize6::bitmask_r6()
+{
+    return 0x1;
+}
+
+inline bool StructureIsInitialize6::isInitialized() const
+{
+    // structure StructureNonControlledVirtual is not controlled. This function assume it is initilized
+    if (!valid_r6()) return false;
+    return true;
+}
+
+inline long StructureIsInitialize6::r6() const
+{
+    BOOST_ASSERT(valid_r6());
+    return mR6;
+}
+
+inline bool StructureIsInitialize6::valid_r6() const
+{
+    return (mBits & bitmask_r6()) != 0;
+}
+
+inline StructureIsInitialize6& StructureIsInitialize6::set_r6(long r6)
+{
+    mR6    = r6;
+    mBits |= bitmask_r6();
+    return *this;
+}
+
+inline int StructureIsVoid::bitmask_o()
+{
+    return 0x1;
+}
+
+inline bool StructureIsVoid::isInitialized() const
+{
+    return true;
+}
+
+inline long StructureIsVoid::o() const
+{
+    BOOST_ASSERT(exist_o());
+    return mO;
+}
+
+inline bool StructureIsVoid::exist_o() const
+{
+    return (mBits & bitmask_o()) != 0;
+}
+
+inline StructureIsVoid& StructureIsVoid::set_o(long o)
+{
+    mO     = o;
+    mBits |= bitmask_o();
+    return *this;
+}
+
+inline int StructureIsVoid1::bitmask_o1()
+{
+    return 0x1;
+}
+
+inline bool StructureIsVoid1::isInitialized() const
+{
+    if (!StructureIsVoid::isInitialized()) return false;
+    return true;
+}
+
+inline long StructureIsVoid1::o1() const
+{
+    BOOST_ASSERT(exist_o1());
+    return mO1;
+}
+
+inline bool StructureIsVoid1::exist_o1() const
+{
+    return (mBits & bitmask_o1()) != 0;
+}
+
+inline StructureIsVoid1& StructureIsVoid1::set_o1(long o1)
+{
+    mO1    = o1;
+    mBits |= bitmask_o1();
+    return *this;
+}
+
+}
+
+#else // __STRUCTURE_SANITY_COMPIL_H_
+
+namespace sanity
+{
+
+// Forward declarations
+class StructureIsInitialize;
+typedef StructureIsInitialize*                         StructureIsInitializeRPtr;
+typedef boost::shared_ptr<StructureIsInitialize>       StructureIsInitializeSPtr;
+typedef boost::shared_ptr<const StructureIsInitialize> StructureIsInitializeSCPtr;
+typedef boost::weak_ptr<StructureIsInitialize>         StructureIsInitializeWPtr;
+
+class StructureIsInitialize1;
+typedef StructureIsInitialize1*                         StructureIsInitialize1RPtr;
+typedef boost::shared_ptr<StructureIsInitialize1>       StructureIsInitialize1SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize1> StructureIsInitialize1SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize1>         StructureIsInitialize1WPtr;
+
+class StructureIsInitialize2;
+typedef StructureIsInitialize2*                         StructureIsInitialize2RPtr;
+typedef boost::shared_ptr<StructureIsInitialize2>       StructureIsInitialize2SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize2> StructureIsInitialize2SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize2>         StructureIsInitialize2WPtr;
+
+class StructureNonControlledInherit;
+typedef StructureNonControlledInherit*                         StructureNonControlledInheritRPtr;
+typedef boost::shared_ptr<StructureNonControlledInherit>       StructureNonControlledInheritSPtr;
+typedef boost::shared_ptr<const StructureNonControlledInherit> StructureNonControlledInheritSCPtr;
+typedef boost::weak_ptr<StructureNonControlledInherit>         StructureNonControlledInheritWPtr;
+
+class StructureIsInitialize3;
+typedef StructureIsInitialize3*                         StructureIsInitialize3RPtr;
+typedef boost::shared_ptr<StructureIsInitialize3>       StructureIsInitialize3SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize3> StructureIsInitialize3SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize3>         StructureIsInitialize3WPtr;
+
+class StructureNonControlled;
+typedef StructureNonControlled*                         StructureNonControlledRPtr;
+typedef boost::shared_ptr<StructureNonControlled>       StructureNonControlledSPtr;
+typedef boost::shared_ptr<const StructureNonControlled> StructureNonControlledSCPtr;
+typedef boost::weak_ptr<StructureNonControlled>         StructureNonControlledWPtr;
+
+class StructureIsInitialize4;
+typedef StructureIsInitialize4*                         StructureIsInitialize4RPtr;
+typedef boost::shared_ptr<StructureIsInitialize4>       StructureIsInitialize4SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize4> StructureIsInitialize4SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize4>         StructureIsInitialize4WPtr;
+
+class StructureIsInitializeVirtual;
+typedef StructureIsInitializeVirtual*                         StructureIsInitializeVirtualRPtr;
+typedef boost::shared_ptr<StructureIsInitializeVirtual>       StructureIsInitializeVirtualSPtr;
+typedef boost::shared_ptr<const StructureIsInitializeVirtual> StructureIsInitializeVirtualSCPtr;
+typedef boost::weak_ptr<StructureIsInitializeVirtual>         StructureIsInitializeVirtualWPtr;
+
+class EStructureIsInitializeVirtualId;
+
+class StructureNonControlledVirtualInherit;
+typedef StructureNonControlledVirtualInherit*                         StructureNonControlledVirtualInheritRPtr;
+typedef boost::shared_ptr<StructureNonControlledVirtualInherit>       StructureNonControlledVirtualInheritSPtr;
+typedef boost::shared_ptr<const StructureNonControlledVirtualInherit> StructureNonControlledVirtualInheritSCPtr;
+typedef boost::weak_ptr<StructureNonControlledVirtualInherit>         StructureNonControlledVirtualInheritWPtr;
+
+class StructureIsInitialize5;
+typedef StructureIsInitialize5*                         StructureIsInitialize5RPtr;
+typedef boost::shared_ptr<StructureIsInitialize5>       StructureIsInitialize5SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize5> StructureIsInitialize5SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize5>         StructureIsInitialize5WPtr;
+
+class StructureNonControlledVirtual;
+typedef StructureNonControlledVirtual*                         StructureNonControlledVirtualRPtr;
+typedef boost::shared_ptr<StructureNonControlledVirtual>       StructureNonControlledVirtualSPtr;
+typedef boost::shared_ptr<const StructureNonControlledVirtual> StructureNonControlledVirtualSCPtr;
+typedef boost::weak_ptr<StructureNonControlledVirtual>         StructureNonControlledVirtualWPtr;
+
+class EStructureNonControlledVirtualId;
+
+class StructureIsInitialize6;
+typedef StructureIsInitialize6*                         StructureIsInitialize6RPtr;
+typedef boost::shared_ptr<StructureIsInitialize6>       StructureIsInitialize6SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize6> StructureIsInitialize6SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize6>         StructureIsInitialize6WPtr;
+
+class StructureIsVoid;
+typedef StructureIsVoid*                         StructureIsVoidRPtr;
+typedef boost::shared_ptr<StructureIsVoid>       StructureIsVoidSPtr;
+typedef boost::shared_ptr<const StructureIsVoid> StructureIsVoidSCPtr;
+typedef boost::weak_ptr<StructureIsVoid>         StructureIsVoidWPtr;
+
+class StructureIsVoid1;
+typedef StructureIsVoid1*                         StructureIsVoid1RPtr;
+typedef boost::shared_ptr<StructureIsVoid1>       StructureIsVoid1SPtr;
+typedef boost::shared_ptr<const StructureIsVoid1> StructureIsVoid1SCPtr;
+typedef boost::weak_ptr<StructureIsVoid1>         StructureIsVoid1WPtr;
+
+class StructureIsInitializeVirtualFactory;
+typedef StructureIsInitializeVirtualFactory*                         StructureIsInitializeVirtualFactoryRPtr;
+typedef boost::shared_ptr<StructureIsInitializeVirtualFactory>       StructureIsInitializeVirtualFactorySPtr;
+typedef boost::shared_ptr<const StructureIsInitializeVirtualFactory> StructureIsInitializeVirtualFactorySCPtr;
+typedef boost::weak_ptr<StructureIsInitializeVirtualFactory>         StructureIsInitializeVirtualFactoryWPtr;
+
+typedef EStructureIsInitializeVirtualId*                         EStructureIsInitializeVirtualIdRPtr;
+typedef boost::shared_ptr<EStructureIsInitializeVirtualId>       EStructureIsInitializeVirtualIdSPtr;
+typedef boost::shared_ptr<const EStructureIsInitializeVirtualId> EStructureIsInitializeVirtualIdSCPtr;
+typedef boost::weak_ptr<EStructureIsInitializeVirtualId>         EStructureIsInitializeVirtualIdWPtr;
+
+class StructureNonControlledVirtualFactory;
+typedef StructureNonControlledVirtualFactory*                         StructureNonControlledVirtualFactoryRPtr;
+typedef boost::shared_ptr<StructureNonControlledVirtualFactory>       StructureNonControlledVirtualFactorySPtr;
+typedef boost::shared_ptr<const StructureNonControlledVirtualFactory> StructureNonControlledVirtualFactorySCPtr;
+typedef boost::weak_ptr<StructureNonControlledVirtualFactory>         StructureNonControlledVirtualFactoryWPtr;
+
+typedef EStructureNonControlledVirtualId*                         EStructureNonControlledVirtualIdRPtr;
+typedef boost::shared_ptr<EStructureNonControlledVirtualId>       EStructureNonControlledVirtualIdSPtr;
+typedef boost::shared_ptr<const EStructureNonControlledVirtualId> EStructureNonControlledVirtualIdSCPtr;
+typedef boost::weak_ptr<EStructureNonControlledVirtualId>         EStructureNonControlledVirtualIdWPtr;
+
+class StructureBase;
+typedef StructureBase*                         StructureBaseRPtr;
+typedef boost::shared_ptr<StructureBase>       StructureBaseSPtr;
+typedef boost::shared_ptr<const StructureBase> StructureBaseSCPtr;
+typedef boost::weak_ptr<StructureBase>         StructureBaseWPtr;
+
+class StructureAbstract;
+typedef StructureAbstract*                         StructureAbstractRPtr;
+typedef boost::shared_ptr<StructureAbstract>       StructureAbstractSPtr;
+typedef boost::shared_ptr<const StructureAbstract> StructureAbstractSCPtr;
+typedef boost::weak_ptr<StructureAbstract>         StructureAbstractWPtr;
+
+class StructureLeaf;
+typedef StructureLeaf*                         StructureLeafRPtr;
+typedef boost::shared_ptr<StructureLeaf>       StructureLeafSPtr;
+typedef boost::shared_ptr<const StructureLeaf> StructureLeafSCPtr;
+typedef boost::weak_ptr<StructureLeaf>         StructureLeafWPtr;
+
+}
+
+#endif // __STRUCTURE_SANITY_COMPIL_H_
+
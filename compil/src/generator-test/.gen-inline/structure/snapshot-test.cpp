@@ -0,0 +1,12 @@
+#include "structure/snapshot.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace configuration
+{
+
+
+}
+
@@ -0,0 +1,56 @@
+#include "structure/snapshot.h"
+// Standard C Library
+#include <stddef.h>
+
+namespace configuration
+{
+
+Configuration::Builder::Builder()
+        : mpObject(new Configuration())
+{
+}
+
+Configuration::Builder::Builder(const Configuration& object)
+        : mpObject(new Configuration())
+{
+    *(Configuration*)mpObject = object;
+}
+
+Configuration::Builder::Builder(ConfigurationRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Configuration::Builder::~Builder()
+{
+    delete (ConfigurationRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Configuration& Configuration::Builder::build() const
+{
+    return *(ConfigurationRPtr)mpObject;
+}
+
+ConfigurationSPtr Configuration::Builder::finalize()
+{
+    ConfigurationRPtr objectRPtr = (ConfigurationRPtr)mpObject;
+    mpObject = NULL;
+    return ConfigurationSPtr(objectRPtr);
+}
+
+Configuration::Configuration()
+{
+}
+
+Configuration::~Configuration()
+{
+}
+
+std::string& Configuration::Builder::mutable_name()
+{
+    return mpObject->mName.mutate();
+}
+
+}
+
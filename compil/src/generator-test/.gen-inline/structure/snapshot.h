@@ -0,0 +1,155 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+
+#ifndef __STRUCTURE_SNAPSHOT_COMPIL_H_
+#define __STRUCTURE_SNAPSHOT_COMPIL_H_
+
+#include "structure/snapshot.h"
+// Compil C++ Template Library
+#include "core/compil/shared_value.h"
+
+template<class T> class snapshot;
+
+namespace configuration
+{
+
+// Configuration is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Configuration
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                 operator=   (const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                     Builder     ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                     Builder     (const Configuration& object);
+        // Destructor of Builder
+        /*lax*/                      ~Builder    ();
+
+        // Instantiates Configuration instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const Configuration& build       ()                            const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                ConfigurationSPtr    finalize    ();
+
+
+        // Setter method for the data field revision
+                Builder&             set_revision(long revision);
+
+        // Setter method for the data field limit
+                Builder&             set_limit   (long limit);
+
+        // Setter method for the data field name
+                Builder&             set_name    (const std::string& name);
+        // Provides mutable access to field name
+                std::string&         mutable_name();
+
+    protected:
+        // constructor needed from potential derived classes
+                                     Builder     (ConfigurationRPtr pObject);
+
+        ConfigurationRPtr mpObject;
+    };
+
+    // Default constructor
+                               Configuration ();
+    // Destructor
+    /*lax*/                    ~Configuration();
+
+    // Getter method for the data field revision
+            long               revision      () const;
+
+    // Getter method for the data field limit
+            long               limit         () const;
+
+    // Getter method for the data field name
+            const std::string& name          () const;
+
+private:
+    // variable for the data field revision
+    long                      mRevision;
+    // variable for the data field limit
+    long                      mLimit;
+    // variable for the data field name
+    shared_value<std::string> mName;
+};
+
+// Holder of the current Configuration shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Configuration> ConfigurationSnapshot;
+
+inline long Configuration::revision() const
+{
+    return mRevision;
+}
+
+inline Configuration::Builder& Configuration::Builder::set_revision(long revision)
+{
+    mpObject->mRevision = revision;
+    return *this;
+}
+
+inline long Configuration::limit() const
+{
+    return mLimit;
+}
+
+inline Configuration::Builder& Configuration::Builder::set_limit(long limit)
+{
+    mpObject->mLimit = limit;
+    return *this;
+}
+
+inline const std::string& Configuration::name() const
+{
+    return mName;
+}
+
+inline Configuration::Builder& Configuration::Builder::set_name(const std::string& name)
+{
+    mpObject->mName = name;
+    return *this;
+}
+
+}
+
+#else // __STRUCTURE_SNAPSHOT_COMPIL_H_
+
+namespace configuration
+{
+
+// Forward declarations
+class Configuration;
+typedef Configuration*                         ConfigurationRPtr;
+typedef boost::shared_ptr<Configuration>       ConfigurationSPtr;
+typedef boost::shared_ptr<const Configuration> ConfigurationSCPtr;
+typedef boost::weak_ptr<Configuration>         ConfigurationWPtr;
+
+}
+
+#endif // __STRUCTURE_SNAPSHOT_COMPIL_H_
+
@@ -0,0 +1,170 @@
+#include "structure/streamable.h"
+// Compil C++ core
+#include <core/platform/benchmark.h>
+// Google Test framework
+#include <gtest/gtest.h>
+// Standard C Library
+#include <string.h>
+
+namespace streamable
+{
+
+static const char* namesEnum[] =
+{
+    "invalid",
+    "value1",
+    "value2",
+};
+
+static EEnum linearFromStringEnum(const char* name)
+{
+    if (strcmp(name, "invalid") == 0) return EEnum::invalid();
+    if (strcmp(name, "value1") == 0) return EEnum::value1();
+    if (strcmp(name, "value2") == 0) return EEnum::value2();
+    return EEnum();
+}
+
+TEST(EnumBenchmark, fromString)
+{
+    size_t count = sizeof(namesEnum) / sizeof(const char*);
+    size_t index = 0;
+    plt::Benchmark benchmark("structure/streamable.Enum.fromString");
+    while (benchmark.running())
+    {
+        const char* name = namesEnum[index++ % count];
+        size_t size = strlen(name);
+        benchmark.consume(EEnum::fromString(name, size));
+    }
+}
+
+TEST(EnumBenchmark, linearFromString)
+{
+    size_t count = sizeof(namesEnum) / sizeof(const char*);
+    size_t index = 0;
+    plt::Benchmark benchmark("structure/streamable.Enum.linearFromString");
+    while (benchmark.running())
+    {
+        const char* name = namesEnum[index++ % count];
+        size_t size = strlen(name);
+        benchmark.consume(size);
+        benchmark.consume(linearFromStringEnum(name));
+    }
+}
+
+TEST(Item1Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/streamable.Item1.construction");
+    while (benchmark.running())
+    {
+        Item1 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Item1Benchmark, copy)
+{
+    Item1 structure1;
+    plt::Benchmark benchmark("structure/streamable.Item1.copy");
+    while (benchmark.running())
+    {
+        Item1 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Item2Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/streamable.Item2.construction");
+    while (benchmark.running())
+    {
+        Item2 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Item2Benchmark, copy)
+{
+    Item2 structure1;
+    plt::Benchmark benchmark("structure/streamable.Item2.copy");
+    while (benchmark.running())
+    {
+        Item2 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure1Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/streamable.Structure1.construction");
+    while (benchmark.running())
+    {
+        Structure1 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure1Benchmark, copy)
+{
+    Structure1 structure1;
+    plt::Benchmark benchmark("structure/streamable.Structure1.copy");
+    while (benchmark.running())
+    {
+        Structure1 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+TEST(Structure1Benchmark, fieldAccess)
+{
+    Structure1 structure;
+    plt::Benchmark benchmark("structure/streamable.Structure1.fieldAccess");
+    while (benchmark.running())
+    {
+        benchmark.consume(structure.i1());
+        benchmark.consume(structure.w1());
+        benchmark.consume(structure.s1());
+        benchmark.consume(structure.item1());
+        benchmark.consume(structure.refItem1());
+        benchmark.consume(structure.es1());
+    }
+}
+
+TEST(Structure1Benchmark, fieldUpdate)
+{
+    Structure1 structure;
+    plt::Benchmark benchmark("structure/streamable.Structure1.fieldUpdate");
+    while (benchmark.running())
+    {
+        structure.set_i1(structure.i1());
+        structure.set_w1(structure.w1());
+        structure.set_s1(structure.s1());
+        structure.set_item1(structure.item1());
+        structure.set_refItem1(structure.refItem1());
+        structure.set_es1(structure.es1());
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure2Benchmark, construction)
+{
+    plt::Benchmark benchmark("structure/streamable.Structure2.construction");
+    while (benchmark.running())
+    {
+        Structure2 structure;
+        benchmark.consume(structure);
+    }
+}
+
+TEST(Structure2Benchmark, copy)
+{
+    Structure2 structure1;
+    plt::Benchmark benchmark("structure/streamable.Structure2.copy");
+    while (benchmark.running())
+    {
+        Structure2 structure2(structure1);
+        benchmark.consume(structure2);
+    }
+}
+
+}
+
@@ -0,0 +1,49 @@
+#include "structure/tracked.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace tracked
+{
+
+TEST(StructureAccountTest, available_DefaultValues)
+{
+    Account structure1;
+    ASSERT_FALSE(structure1.valid_id());
+    ASSERT_FALSE(structure1.exist_owner());
+    ASSERT_FALSE(structure1.changed_limit());
+    ASSERT_FALSE(structure1.exist_history());
+}
+
+TEST(StructureAccountTest, isInitialized)
+{
+    Account structure1;
+    ASSERT_FALSE(structure1.isInitialized());
+    structure1.set_id(long());
+    ASSERT_TRUE(structure1.isInitialized());
+}
+
+
+TEST(StructureSavingsAccountTest, available_DefaultValues)
+{
+    SavingsAccount structure1;
+    ASSERT_FALSE(structure1.valid_id());
+    ASSERT_FALSE(structure1.exist_owner());
+    ASSERT_FALSE(structure1.changed_limit());
+    ASSERT_FALSE(structure1.exist_history());
+    ASSERT_FALSE(structure1.valid_rate());
+}
+
+TEST(StructureSavingsAccountTest, isInitialized)
+{
+    SavingsAccount structure1;
+    ASSERT_FALSE(structure1.isInitialized());
+    structure1.set_id(long());
+    structure1.set_rate(long());
+    ASSERT_TRUE(structure1.isInitialized());
+}
+
+
+}
+
@@ -0,0 +1,245 @@
+#include "structure/tracked.h"
+
+namespace tracked
+{
+
+Account::Account()
+        : mBits    (0)
+        , mModified(0)
+        , mLimit   (default_limit())
+{
+}
+
+Account::~Account()
+{
+}
+
+void Account::erase_id()
+{
+    mId        =  0;
+    mBits     &= ~bitmask_id();
+    mModified |=  bitmask_id();
+}
+
+std::string& Account::mutable_owner()
+{
+    mBits |= bitmask_owner();
+    mModified |= bitmask_owner();
+    return mOwner;
+}
+
+void Account::clear_owner()
+{
+    mOwner.clear();
+    mBits     &= ~bitmask_owner();
+    mModified |=  bitmask_owner();
+}
+
+long Account::default_limit()
+{
+    return 100;
+}
+
+Account& Account::update_limit(long limit)
+{
+    if (default_limit() != limit)
+        return set_limit(limit);
+
+    reset_limit();
+    return *this;
+}
+
+void Account::reset_limit()
+{
+    mLimit     =  default_limit();
+    mBits     &= ~bitmask_limit();
+    mModified |=  bitmask_limit();
+}
+
+std::vector<long>& Account::mutable_history()
+{
+    mBits |= bitmask_history();
+    mModified |= bitmask_history();
+    return mHistory;
+}
+
+void Account::clear_history()
+{
+    mHistory.clear();
+    mBits     &= ~bitmask_history();
+    mModified |=  bitmask_history();
+}
+
+bool Account::isModified() const
+{
+    if (mModified != 0) return true;
+    return false;
+}
+
+void Account::checkpoint()
+{
+    mModified = 0;
+}
+
+Account Account::diff(const Account& object1, const Account& object2)
+{
+    Account delta;
+    object1.copyDifferences(object2, delta);
+    return delta;
+}
+
+void Account::applyDelta(const Account& delta)
+{
+    if (delta.modified_id())
+    {
+        if (delta.valid_id())
+            set_id(delta.id());
+        else
+            erase_id();
+    }
+    if (delta.modified_owner())
+    {
+        if (delta.exist_owner())
+            set_owner(delta.owner());
+        else
+            clear_owner();
+    }
+    if (delta.modified_limit())
+    {
+        if (delta.changed_limit())
+            set_limit(delta.limit());
+        else
+            reset_limit();
+    }
+    if (delta.modified_history())
+    {
+        if (delta.exist_history())
+            set_history(delta.history());
+        else
+            clear_history();
+    }
+}
+
+void Account::copyDifferences(const Account& object, Account& delta) const
+{
+    if (valid_id() != object.valid_id() || (valid_id() && !(id() == object.id())))
+    {
+        if (object.valid_id())
+            delta.set_id(object.id());
+        else
+            delta.erase_id();
+    }
+    if (exist_owner() != object.exist_owner() || (exist_owner() && !(owner() == object.owner())))
+    {
+        if (object.exist_owner())
+            delta.set_owner(object.owner());
+        else
+            delta.clear_owner();
+    }
+    if (changed_limit() != object.changed_limit() || (changed_limit() && !(limit() == object.limit())))
+    {
+        if (object.changed_limit())
+            delta.set_limit(object.limit());
+        else
+            delta.reset_limit();
+    }
+    if (exist_history() != object.exist_history() || (exist_history() && !(history() == object.history())))
+    {
+        if (object.exist_history())
+            delta.set_history(object.history());
+        else
+            delta.clear_history();
+    }
+}
+
+SavingsAccount::SavingsAccount()
+        : mBits    (0)
+        , mModified(0)
+{
+}
+
+SavingsAccount::~SavingsAccount()
+{
+}
+
+SavingsAccountSPtr SavingsAccount::downcast(const AccountSPtr& object)
+{
+    return boost::static_pointer_cast<SavingsAccount>(object);
+}
+
+void SavingsAccount::erase_rate()
+{
+    mRate      =  0;
+    mBits     &= ~bitmask_rate();
+    mModified |=  bitmask_rate();
+}
+
+SavingsAccount& SavingsAccount::set_id(long id)
+{
+    Account::set_id(id);
+    return *this;
+}
+
+SavingsAccount& SavingsAccount::set_owner(const std::string& owner)
+{
+    Account::set_owner(owner);
+    return *this;
+}
+
+SavingsAccount& SavingsAccount::set_limit(long limit)
+{
+    Account::set_limit(limit);
+    return *this;
+}
+
+SavingsAccount& SavingsAccount::set_history(const std::vector<long>& history)
+{
+    Account::set_history(history);
+    return *this;
+}
+
+bool SavingsAccount::isModified() const
+{
+    if (mModified != 0) return true;
+    return Account::isModified();
+}
+
+void SavingsAccount::checkpoint()
+{
+    Account::checkpoint();
+    mModified = 0;
+}
+
+SavingsAccount SavingsAccount::diff(const SavingsAccount& object1, const SavingsAccount& object2)
+{
+    SavingsAccount delta;
+    object1.copyDifferences(object2, delta);
+    return delta;
+}
+
+void SavingsAccount::applyDelta(const SavingsAccount& delta)
+{
+    Account::applyDelta(delta);
+    if (delta.modified_rate())
+    {
+        if (delta.valid_rate())
+            set_rate(delta.rate());
+        else
+            erase_rate();
+    }
+}
+
+void SavingsAccount::copyDifferences(const SavingsAccount& object, SavingsAccount& delta) const
+{
+    Account::copyDifferences(object, delta);
+    if (valid_rate() != object.valid_rate() || (valid_rate() && !(rate() == object.rate())))
+    {
+        if (object.valid_rate())
+            delta.set_rate(object.rate());
+        else
+            delta.erase_rate();
+    }
+}
+
+}
+
@@ -0,0 +1,383 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __STRUCTURE_TRACKED_COMPIL_H_
+#define __STRUCTURE_TRACKED_COMPIL_H_
+
+#include "structure/tracked.h"
+
+namespace tracked
+{
+
+class Account
+{
+public:
+    // Default constructor
+                                     Account         ();
+    // Destructor
+    /*lax*/                          ~Account        ();
+
+    // Returns true if every required field is initialized.
+            bool                     isInitialized   ()                                               const;
+
+    // Getter method for the data field id
+            long                     id              ()                                               const;
+    // Returns true if the data field id was set and could be considered
+    // valid
+            bool                     valid_id        ()                                               const;
+    // Returns true if the data field id was modified since the last
+    // checkpoint()
+            bool                     modified_id     ()                                               const;
+    // Setter method for the data field id
+            Account&                 set_id          (long id);
+    // Erases the required data field id. Object can not be instantiated
+    // before the field data is set again
+            void                     erase_id        ();
+
+    // Getter method for the data field owner
+            const std::string&       owner           ()                                               const;
+    // Checks if the optional field owner exists
+            bool                     exist_owner     ()                                               const;
+    // Returns true if the data field owner was modified since the last
+    // checkpoint()
+            bool                     modified_owner  ()                                               const;
+    // Setter method for the data field owner
+            Account&                 set_owner       (const std::string& owner);
+    // Provides mutable access to field owner
+            std::string&             mutable_owner   ();
+    // Clears the optional data field owner
+            void                     clear_owner     ();
+
+    // Getter method for the data field limit
+            long                     limit           ()                                               const;
+    // Returns true if the data field value limit was changed from its
+    // default value 100
+            bool                     changed_limit   ()                                               const;
+    // Returns true if the data field limit was modified since the last
+    // checkpoint()
+            bool                     modified_limit  ()                                               const;
+    // Returns the default value 100 of the field limit
+    static  long                     default_limit   ();
+    // Setter method for the data field limit
+            Account&                 set_limit       (long limit);
+    // Updates the data field limit. If the new value is equal to the
+    // default it clears the field else it sets it to the new value
+            Account&                 update_limit    (long limit);
+    // Resets the data field limit to its default value 100
+            void                     reset_limit     ();
+
+    // Getter method for the data field history
+            const std::vector<long>& history         ()                                               const;
+    // Checks if the optional field history exists
+            bool                     exist_history   ()                                               const;
+    // Returns true if the data field history was modified since the last
+    // checkpoint()
+            bool                     modified_history()                                               const;
+    // Setter method for the data field history
+            Account&                 set_history     (const std::vector<long>& history);
+    // Provides mutable access to field history
+            std::vector<long>&       mutable_history ();
+    // Clears the optional data field history
+            void                     clear_history   ();
+
+    // Returns true if any of the fields was modified since the last
+    // checkpoint()
+            bool                     isModified      ()                                               const;
+    // Forgets the modifications of the fields recorded so far
+            void                     checkpoint      ();
+    // Returns a delta that holds only the fields of object2 that differ
+    // from object1. They are marked as modified
+    static  Account                  diff            (const Account& object1, const Account& object2);
+    // Sets or clears the fields marked as modified in the delta. The other
+    // fields are not touched
+            void                     applyDelta      (const Account& delta);
+
+protected:
+    // Sets in the delta only the fields of the object that differ from
+    // this instance
+    void copyDifferences(const Account& object, Account& delta) const;
+
+private:
+    // Returns unique bitmask value for the field id
+    static int bitmask_id     ();
+    // Returns unique bitmask value for the field owner
+    static int bitmask_owner  ();
+    // Returns unique bitmask value for the field limit
+    static int bitmask_limit  ();
+    // Returns unique bitmask value for the field history
+    static int bitmask_history();
+
+    // Stores availability information for the fields
+    int               mBits;
+    // Stores the fields modified since the last checkpoint()
+    int               mModified;
+
+    // variable for the data field id
+    long              mId;
+    // variable for the data field owner
+    std::string       mOwner;
+    // variable for the data field limit
+    long              mLimit;
+    // variable for the data field history
+    std::vector<long> mHistory;
+};
+
+class SavingsAccount : public Account
+{
+public:
+    // Default constructor
+                               SavingsAccount ();
+    // Destructor
+    /*lax*/                    ~SavingsAccount();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  SavingsAccountSPtr downcast       (const AccountSPtr& object);
+
+    // Returns true if every required field is initialized.
+            bool               isInitialized  ()                                                             const;
+
+    // Getter method for the data field rate
+            long               rate           ()                                                             const;
+    // Returns true if the data field rate was set and could be considered
+    // valid
+            bool               valid_rate     ()                                                             const;
+    // Returns true if the data field rate was modified since the last
+    // checkpoint()
+            bool               modified_rate  ()                                                             const;
+    // Setter method for the data field rate
+            SavingsAccount&    set_rate       (long rate);
+    // Erases the required data field rate. Object can not be instantiated
+    // before the field data is set again
+            void               erase_rate     ();
+
+    // Setter method for the data field id
+            SavingsAccount&    set_id         (long id);
+
+    // Setter method for the data field owner
+            SavingsAccount&    set_owner      (const std::string& owner);
+
+    // Setter method for the data field limit
+            SavingsAccount&    set_limit      (long limit);
+
+    // Setter method for the data field history
+            SavingsAccount&    set_history    (const std::vector<long>& history);
+
+    // Returns true if any of the fields was modified since the last
+    // checkpoint()
+            bool               isModified     ()                                                             const;
+    // Forgets the modifications of the fields recorded so far
+            void               checkpoint     ();
+    // Returns a delta that holds only the fields of object2 that differ
+    // from object1. They are marked as modified
+    static  SavingsAccount     diff           (const SavingsAccount& object1, const SavingsAccount& object2);
+    // Sets or clears the fields marked as modified in the delta. The other
+    // fields are not touched
+            void               applyDelta     (const SavingsAccount& delta);
+
+protected:
+    // Sets in the delta only the fields of the object that differ from
+    // this instance
+    void copyDifferences(const SavingsAccount& object, SavingsAccount& delta) const;
+
+private:
+    // Returns unique bitmask value for the field rate
+    static int bitmask_rate();
+
+    // Stores availability information for the fields
+    int  mBits;
+    // Stores the fields modified since the last checkpoint()
+    int  mModified;
+
+    // variable for the data field rate
+    long mRate;
+};
+
+inline int Account::bitmask_id()
+{
+    return 0x1;
+}
+
+inline int Account::bitmask_owner()
+{
+    return 0x2;
+}
+
+inline int Account::bitmask_limit()
+{
+    return 0x4;
+}
+
+inline int Account::bitmask_history()
+{
+    return 0x8;
+}
+
+inline bool Account::isInitialized() const
+{
+    if (!valid_id()) return false;
+    return true;
+}
+
+inline long Account::id() const
+{
+    BOOST_ASSERT(valid_id());
+    return mId;
+}
+
+inline bool Account::valid_id() const
+{
+    return (mBits & bitmask_id()) != 0;
+}
+
+inline bool Account::modified_id() const
+{
+    return (mModified & bitmask_id()) != 0;
+}
+
+inline Account& Account::set_id(long id)
+{
+    mId        = id;
+    mBits     |= bitmask_id();
+    mModified |= bitmask_id();
+    return *this;
+}
+
+inline const std::string& Account::owner() const
+{
+    BOOST_ASSERT(exist_owner());
+    return mOwner;
+}
+
+inline bool Account::exist_owner() const
+{
+    return (mBits & bitmask_owner()) != 0;
+}
+
+inline bool Account::modified_owner() const
+{
+    return (mModified & bitmask_owner()) != 0;
+}
+
+inline Account& Account::set_owner(const std::string& owner)
+{
+    mOwner     = owner;
+    mBits     |= bitmask_owner();
+    mModified |= bitmask_owner();
+    return *this;
+}
+
+inline long Account::limit() const
+{
+    return mLimit;
+}
+
+inline bool Account::changed_limit() const
+{
+    return (mBits & bitmask_limit()) != 0;
+}
+
+inline bool Account::modified_limit() const
+{
+    return (mModified & bitmask_limit()) != 0;
+}
+
+inline Account& Account::set_limit(long limit)
+{
+    mLimit     = limit;
+    mBits     |= bitmask_limit();
+    mModified |= bitmask_limit();
+    return *this;
+}
+
+inline const std::vector<long>& Account::history() const
+{
+    BOOST_ASSERT(exist_history());
+    return mHistory;
+}
+
+inline bool Account::exist_history() const
+{
+    return (mBits & bitmask_history()) != 0;
+}
+
+inline bool Account::modified_history() const
+{
+    return (mModified & bitmask_history()) != 0;
+}
+
+inline Account& Account::set_history(const std::vector<long>& history)
+{
+    mHistory   = history;
+    mBits     |= bitmask_history();
+    mModified |= bitmask_history();
+    return *this;
+}
+
+inline int SavingsAccount::bitmask_rate()
+{
+    return 0x1;
+}
+
+inline bool SavingsAccount::isInitialized() const
+{
+    if (!Account::isInitialized()) return false;
+    if (!valid_rate()) return false;
+    return true;
+}
+
+inline long SavingsAccount::rate() const
+{
+    BOOST_ASSERT(valid_rate());
+    return mRate;
+}
+
+inline bool SavingsAccount::valid_rate() const
+{
+    return (mBits & bitmask_rate()) != 0;
+}
+
+inline bool SavingsAccount::modified_rate() const
+{
+    return (mModified & bitmask_rate()) != 0;
+}
+
+inline SavingsAccount& SavingsAccount::set_rate(long rate)
+{
+    mRate      = rate;
+    mBits     |= bitmask_rate();
+    mModified |= bitmask_rate();
+    return *this;
+}
+
+}
+
+#else // __STRUCTURE_TRACKED_COMPIL_H_
+
+namespace tracked
+{
+
+// Forward declarations
+class Account;
+typedef Account*                         AccountRPtr;
+typedef boost::shared_ptr<Account>       AccountSPtr;
+typedef boost::shared_ptr<const Account> AccountSCPtr;
+typedef boost::weak_ptr<Account>         AccountWPtr;
+
+class SavingsAccount;
+typedef SavingsAccount*                         SavingsAccountRPtr;
+typedef boost::shared_ptr<SavingsAccount>       SavingsAccountSPtr;
+typedef boost::shared_ptr<const SavingsAccount> SavingsAccountSCPtr;
+typedef boost::weak_ptr<SavingsAccount>         SavingsAccountWPtr;
+
+}
+
+#endif // __STRUCTURE_TRACKED_COMPIL_H_
+
@@ -0,0 +1,15 @@
+#include "structure/upcopy.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace upcopy
+{
+
+
+
+
+
+}
+
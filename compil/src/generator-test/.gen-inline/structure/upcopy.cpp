@@ -0,0 +1,224 @@
+#include "structure/upcopy.h"
+// Standard C Library
+#include <stddef.h>
+
+namespace upcopy
+{
+
+Structure1::Builder::Builder()
+        : mpObject(new Structure1())
+{
+}
+
+Structure1::Builder::Builder(const Structure1& object)
+        : mpObject(new Structure1())
+{
+    *(Structure1*)mpObject = object;
+}
+
+Structure1::Builder::Builder(Structure1RPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Structure1::Builder::~Builder()
+{
+    delete (Structure1RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Structure1& Structure1::Builder::build() const
+{
+    return *(Structure1RPtr)mpObject;
+}
+
+Structure1SPtr Structure1::Builder::finalize()
+{
+    Structure1RPtr objectRPtr = (Structure1RPtr)mpObject;
+    mpObject = NULL;
+    return Structure1SPtr(objectRPtr);
+}
+
+Structure1::Structure1()
+{
+}
+
+Structure1::~Structure1()
+{
+}
+
+Structure2::Builder::Builder()
+        : Structure1::Builder(new Structure2())
+{
+}
+
+Structure2::Builder::Builder(const Structure2& object)
+        : Structure1::Builder(new Structure2())
+{
+    *(Structure2*)mpObject = object;
+}
+
+Structure2::Builder::Builder(Structure2RPtr pObject)
+        : Structure1::Builder(pObject)
+{
+}
+
+Structure2::Builder::~Builder()
+{
+    delete (Structure2RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Structure2& Structure2::Builder::build() const
+{
+    return *(Structure2RPtr)mpObject;
+}
+
+Structure2SPtr Structure2::Builder::finalize()
+{
+    Structure2RPtr objectRPtr = (Structure2RPtr)mpObject;
+    mpObject = NULL;
+    return Structure2SPtr(objectRPtr);
+}
+
+Structure2::Structure2()
+{
+}
+
+Structure2::~Structure2()
+{
+}
+
+Structure2SPtr Structure2::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2>(object);
+}
+
+Structure2::Builder& Structure2::Builder::set_i1(long i1)
+{
+    return (Structure2::Builder&)Structure1::Builder::set_i1(i1);
+}
+
+Structure3::Builder::Builder()
+        : Structure2::Builder(new Structure3())
+{
+}
+
+Structure3::Builder::Builder(const Structure3& object)
+        : Structure2::Builder(new Structure3())
+{
+    *(Structure3*)mpObject = object;
+}
+
+Structure3::Builder::Builder(const Structure1& object)
+        : Structure2::Builder(new Structure3())
+{
+    *(Structure1*)mpObject = object;
+}
+
+Structure3::Builder::Builder(const Structure2& object)
+        : Structure2::Builder(new Structure3())
+{
+    *(Structure2*)mpObject = object;
+}
+
+Structure3::Builder::Builder(Structure3RPtr pObject)
+        : Structure2::Builder(pObject)
+{
+}
+
+Structure3::Builder::~Builder()
+{
+    delete (Structure3RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Structure3& Structure3::Builder::build() const
+{
+    return *(Structure3RPtr)mpObject;
+}
+
+Structure3SPtr Structure3::Builder::finalize()
+{
+    Structure3RPtr objectRPtr = (Structure3RPtr)mpObject;
+    mpObject = NULL;
+    return Structure3SPtr(objectRPtr);
+}
+
+Structure3::Structure3()
+{
+}
+
+Structure3::~Structure3()
+{
+}
+
+Structure3SPtr Structure3::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure3>(object);
+}
+
+Structure3::Builder& Structure3::Builder::set_i1(long i1)
+{
+    return (Structure3::Builder&)Structure1::Builder::set_i1(i1);
+}
+
+Structure3::Builder& Structure3::Builder::set_i2(long i2)
+{
+    return (Structure3::Builder&)Structure2::Builder::set_i2(i2);
+}
+
+Document::Builder::Builder()
+        : mpObject(new Document())
+{
+}
+
+Document::Builder::Builder(const Document& object)
+        : mpObject(new Document())
+{
+    *(Document*)mpObject = object;
+}
+
+Document::Builder::Builder(DocumentRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Document::Builder::~Builder()
+{
+    delete (DocumentRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Document& Document::Builder::build() const
+{
+    return *(DocumentRPtr)mpObject;
+}
+
+DocumentSPtr Document::Builder::finalize()
+{
+    DocumentRPtr objectRPtr = (DocumentRPtr)mpObject;
+    mpObject = NULL;
+    return DocumentSPtr(objectRPtr);
+}
+
+Document::Document()
+{
+}
+
+Document::~Document()
+{
+}
+
+std::string& Document::Builder::mutable_title()
+{
+    return mpObject->mTitle.mutate();
+}
+
+std::vector<long>& Document::Builder::mutable_values()
+{
+    return mpObject->mValues.mutate();
+}
+
+}
+
@@ -0,0 +1,35 @@
+#ifndef __INTERFACE_ASYNC_COMPIL__FWD_H_
+#define __INTERFACE_ASYNC_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace async
+{
+
+// Forward declarations
+class Counter;
+typedef Counter*                   CounterRPtr;
+typedef boost::shared_ptr<Counter> CounterSPtr;
+typedef boost::weak_ptr<Counter>   CounterWPtr;
+
+class CounterProxy;
+typedef CounterProxy*                   CounterProxyRPtr;
+typedef boost::shared_ptr<CounterProxy> CounterProxySPtr;
+typedef boost::weak_ptr<CounterProxy>   CounterProxyWPtr;
+
+class CounterShmClient;
+typedef CounterShmClient*                   CounterShmClientRPtr;
+typedef boost::shared_ptr<CounterShmClient> CounterShmClientSPtr;
+typedef boost::weak_ptr<CounterShmClient>   CounterShmClientWPtr;
+
+class CounterShmServer;
+typedef CounterShmServer*                   CounterShmServerRPtr;
+typedef boost::shared_ptr<CounterShmServer> CounterShmServerSPtr;
+typedef boost::weak_ptr<CounterShmServer>   CounterShmServerWPtr;
+
+}
+
+#endif // __INTERFACE_ASYNC_COMPIL__FWD_H_
+
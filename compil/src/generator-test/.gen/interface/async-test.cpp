@@ -0,0 +1,11 @@
+#include "interface/async.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace async
+{
+
+}
+
@@ -0,0 +1,249 @@
+#include "interface/async.h"
+// Compil C++ Template Library
+#include "core/compil/async_queue.h"
+#include "core/compil/shm_channel.h"
+
+namespace async
+{
+
+Counter::~Counter()
+{
+}
+
+namespace
+{
+
+class CounterAddStub : public async_call
+{
+public:
+    CounterAddStub(const CounterSPtr& target, long value)
+            : mTarget(target)
+            , mValue (value)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->add(mValue);
+    }
+
+private:
+    CounterSPtr mTarget;
+    long        mValue;
+};
+
+class CounterAddTwiceStub : public async_call
+{
+public:
+    CounterAddTwiceStub(const CounterSPtr& target, long value1, long value2)
+            : mTarget(target)
+            , mValue1(value1)
+            , mValue2(value2)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->addTwice(mValue1, mValue2);
+    }
+
+private:
+    CounterSPtr mTarget;
+    long        mValue1;
+    long        mValue2;
+};
+
+class CounterTotalStub : public async_call
+{
+public:
+    CounterTotalStub(const CounterSPtr& target, long* sum)
+            : mTarget(target)
+            , mSum   (sum)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->total(*mSum);
+    }
+
+private:
+    CounterSPtr mTarget;
+    long*       mSum;
+};
+
+class CounterScaleStub : public async_call
+{
+public:
+    CounterScaleStub(const CounterSPtr& target, long factor, long* value)
+            : mTarget(target)
+            , mFactor(factor)
+            , mValue (value)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->scale(mFactor, *mValue);
+    }
+
+private:
+    CounterSPtr mTarget;
+    long        mFactor;
+    long*       mValue;
+};
+
+}
+
+CounterProxy::CounterProxy(const CounterSPtr& target, async_queue& queue)
+        : mTarget(target)
+        , mQueue (queue)
+{
+}
+
+void CounterProxy::add(long value)
+{
+    mQueue.post(new CounterAddStub(mTarget, value));
+}
+
+void CounterProxy::addTwice(long value1, long value2)
+{
+    mQueue.post(new CounterAddTwiceStub(mTarget, value1, value2));
+}
+
+void CounterProxy::total(long& sum)
+{
+    CounterTotalStub stub(mTarget, &sum);
+    mQueue.send(&stub);
+}
+
+void CounterProxy::scale(long factor, long& value)
+{
+    CounterScaleStub stub(mTarget, factor, &value);
+    mQueue.send(&stub);
+}
+
+CounterShmClient::CounterShmClient(shm_channel& channel)
+        : mChannel(channel)
+{
+}
+
+void CounterShmClient::add(long value)
+{
+    shm_writer writer(mChannel.requests().reserve(sizeof(boost::uint32_t) + shm_writer::size(value)));
+    writer.write(boost::uint32_t(0));
+    writer.write(value);
+    mChannel.requests().commit();
+}
+
+void CounterShmClient::addTwice(long value1, long value2)
+{
+    shm_writer writer(mChannel.requests().reserve(sizeof(boost::uint32_t) + shm_writer::size(value1) + shm_writer::size(value2)));
+    writer.write(boost::uint32_t(1));
+    writer.write(value1);
+    writer.write(value2);
+    mChannel.requests().commit();
+}
+
+void CounterShmClient::total(long& sum)
+{
+    shm_writer writer(mChannel.requests().reserve(sizeof(boost::uint32_t)));
+    writer.write(boost::uint32_t(2));
+    mChannel.requests().commit();
+
+    boost::uint32_t frameSize;
+    shm_reader reader(mChannel.responses().wait(frameSize));
+    reader.read(sum);
+    mChannel.responses().release();
+}
+
+void CounterShmClient::scale(long factor, long& value)
+{
+    shm_writer writer(mChannel.requests().reserve(sizeof(boost::uint32_t) + shm_writer::size(factor) + shm_writer::size(value)));
+    writer.write(boost::uint32_t(3));
+    writer.write(factor);
+    writer.write(value);
+    mChannel.requests().commit();
+
+    boost::uint32_t frameSize;
+    shm_reader reader(mChannel.responses().wait(frameSize));
+    reader.read(value);
+    mChannel.responses().release();
+}
+
+CounterShmServer::CounterShmServer(const CounterSPtr& target, shm_channel& channel)
+        : mTarget (target)
+        , mChannel(channel)
+{
+}
+
+bool CounterShmServer::dispatch()
+{
+    boost::uint32_t frameSize;
+    const char* frame = mChannel.requests().peek(frameSize);
+    if (!frame)
+        return false;
+
+    shm_reader reader(frame);
+    boost::uint32_t methodId;
+    reader.read(methodId);
+    switch (methodId)
+    {
+        case 0:
+        {
+            long value = long();
+            reader.read(value);
+            mChannel.requests().release();
+            mTarget->add(value);
+            break;
+        }
+        case 1:
+        {
+            long value1 = long();
+            long value2 = long();
+            reader.read(value1);
+            reader.read(value2);
+            mChannel.requests().release();
+            mTarget->addTwice(value1, value2);
+            break;
+        }
+        case 2:
+        {
+            long sum = long();
+            mChannel.requests().release();
+            mTarget->total(sum);
+            shm_writer writer(mChannel.responses().reserve(shm_writer::size(sum)));
+            writer.write(sum);
+            mChannel.responses().commit();
+            break;
+        }
+        case 3:
+        {
+            long factor = long();
+            long value = long();
+            reader.read(factor);
+            reader.read(value);
+            mChannel.requests().release();
+            mTarget->scale(factor, value);
+            shm_writer writer(mChannel.responses().reserve(shm_writer::size(value)));
+            writer.write(value);
+            mChannel.responses().commit();
+            break;
+        }
+        default:
+            mChannel.requests().release();
+            break;
+    }
+    return true;
+}
+
+size_t CounterShmServer::process()
+{
+    size_t count = 0;
+    while (dispatch())
+        ++count;
+    return count;
+}
+
+}
+
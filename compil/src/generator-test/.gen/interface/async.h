@@ -0,0 +1,103 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __INTERFACE_ASYNC_COMPIL_H_
+#define __INTERFACE_ASYNC_COMPIL_H_
+
+#include "interface/async-fwd.h"
+// Compil C++ Template Library
+#include "core/compil/async_queue.h"
+#include "core/compil/shm_channel.h"
+
+namespace async
+{
+
+// Accumulates the values added on the worker thread of the queue
+class Counter
+{
+public:
+    // Destructor
+    virtual      ~Counter();
+
+    virtual void add     (long value) = 0;
+
+    virtual void addTwice(long value1, long value2) = 0;
+
+    // Returns the sum of the values added so far
+    virtual void total   (long& sum) = 0;
+
+    virtual void scale   (long factor, long& value) = 0;
+};
+
+// Proxy of the Counter interface. The calls are marshalled into the queue
+// and dispatched on its worker thread in the order they are made. The
+// methods with out or io parameters wait for the dispatch, the rest return
+// as soon as the call is queued.
+class CounterProxy : public Counter
+{
+public:
+    // Constructor. The calls are dispatched to the target on the worker of
+    // the queue
+                 CounterProxy(const CounterSPtr& target, async_queue& queue);
+
+    virtual void add         (long value);
+
+    virtual void addTwice    (long value1, long value2);
+
+    virtual void total       (long& sum);
+
+    virtual void scale       (long factor, long& value);
+private:
+    CounterSPtr  mTarget;
+    async_queue& mQueue;
+};
+
+// Client of the Counter interface in another process. The arguments of the
+// calls are written directly in the request ring of the channel. The
+// methods with out or io parameters wait for the response of the server,
+// the rest return as soon as the request is committed. The waits throw
+// shm_timeout_error after the timeout of the channel.
+class CounterShmClient : public Counter
+{
+public:
+    // Constructor. The channel should be opened on the client side
+                 CounterShmClient(shm_channel& channel);
+
+    virtual void add             (long value);
+
+    virtual void addTwice        (long value1, long value2);
+
+    virtual void total           (long& sum);
+
+    virtual void scale           (long factor, long& value);
+private:
+    shm_channel& mChannel;
+};
+
+// Server of the Counter interface for a client in another process. It
+// reads the requests from the channel and dispatches them to the target on
+// the thread that calls it. The string and vector arguments are copied out
+// of the ring once, because the methods of the interface take them as
+// std::string and std::vector.
+class CounterShmServer
+{
+public:
+    // Constructor. The channel should be opened on the server side
+    CounterShmServer(const CounterSPtr& target, shm_channel& channel);
+
+    // Dispatches the oldest request. Returns false if there is none
+    bool dispatch();
+
+    // Dispatches the pending requests. Returns the count of the dispatched
+    // ones
+    size_t process();
+private:
+    CounterSPtr  mTarget;
+    shm_channel& mChannel;
+};
+
+}
+
+#endif // __INTERFACE_ASYNC_COMPIL_H_
+
@@ -0,0 +1,3 @@
+// Unity translation unit of the package interface (1 of 2)
+
+#include "shm.cpp"
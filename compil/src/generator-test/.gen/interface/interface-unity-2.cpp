@@ -0,0 +1,3 @@
+// Unity translation unit of the package interface (2 of 2)
+
+#include "async.cpp"
@@ -0,0 +1,35 @@
+#ifndef __INTERFACE_SHM_COMPIL__FWD_H_
+#define __INTERFACE_SHM_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace shm
+{
+
+// Forward declarations
+class Journal;
+typedef Journal*                   JournalRPtr;
+typedef boost::shared_ptr<Journal> JournalSPtr;
+typedef boost::weak_ptr<Journal>   JournalWPtr;
+
+class JournalProxy;
+typedef JournalProxy*                   JournalProxyRPtr;
+typedef boost::shared_ptr<JournalProxy> JournalProxySPtr;
+typedef boost::weak_ptr<JournalProxy>   JournalProxyWPtr;
+
+class JournalShmClient;
+typedef JournalShmClient*                   JournalShmClientRPtr;
+typedef boost::shared_ptr<JournalShmClient> JournalShmClientSPtr;
+typedef boost::weak_ptr<JournalShmClient>   JournalShmClientWPtr;
+
+class JournalShmServer;
+typedef JournalShmServer*                   JournalShmServerRPtr;
+typedef boost::shared_ptr<JournalShmServer> JournalShmServerSPtr;
+typedef boost::weak_ptr<JournalShmServer>   JournalShmServerWPtr;
+
+}
+
+#endif // __INTERFACE_SHM_COMPIL__FWD_H_
+
@@ -0,0 +1,313 @@
+#include "interface/shm.h"
+// Compil C++ Template Library
+#include "core/compil/async_queue.h"
+#include "core/compil/shm_channel.h"
+
+namespace shm
+{
+
+Journal::~Journal()
+{
+}
+
+namespace
+{
+
+class JournalRecordStub : public async_call
+{
+public:
+    JournalRecordStub(const JournalSPtr& target, const std::string& text, const std::vector<long>& values)
+            : mTarget(target)
+            , mText  (text)
+            , mValues(values)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->record(mText, mValues);
+    }
+
+private:
+    JournalSPtr       mTarget;
+    std::string       mText;
+    std::vector<long> mValues;
+};
+
+class JournalEchoStub : public async_call
+{
+public:
+    JournalEchoStub(const JournalSPtr& target, const std::string& text, std::string* copy)
+            : mTarget(target)
+            , mText  (text)
+            , mCopy  (copy)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->echo(mText, *mCopy);
+    }
+
+private:
+    JournalSPtr  mTarget;
+    std::string  mText;
+    std::string* mCopy;
+};
+
+class JournalSummaryStub : public async_call
+{
+public:
+    JournalSummaryStub(const JournalSPtr& target, long* count, long* sum)
+            : mTarget(target)
+            , mCount (count)
+            , mSum   (sum)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->summary(*mCount, *mSum);
+    }
+
+private:
+    JournalSPtr mTarget;
+    long*       mCount;
+    long*       mSum;
+};
+
+class JournalReverseStub : public async_call
+{
+public:
+    JournalReverseStub(const JournalSPtr& target, std::vector<long>* values)
+            : mTarget(target)
+            , mValues(values)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->reverse(*mValues);
+    }
+
+private:
+    JournalSPtr        mTarget;
+    std::vector<long>* mValues;
+};
+
+class JournalPingStub : public async_call
+{
+public:
+    JournalPingStub(const JournalSPtr& target, long sequence, long* reply)
+            : mTarget  (target)
+            , mSequence(sequence)
+            , mReply   (reply)
+    {
+    }
+
+    virtual void dispatch()
+    {
+        mTarget->ping(mSequence, *mReply);
+    }
+
+private:
+    JournalSPtr mTarget;
+    long        mSequence;
+    long*       mReply;
+};
+
+}
+
+JournalProxy::JournalProxy(const JournalSPtr& target, async_queue& queue)
+        : mTarget(target)
+        , mQueue (queue)
+{
+}
+
+void JournalProxy::record(const std::string& text, const std::vector<long>& values)
+{
+    mQueue.post(new JournalRecordStub(mTarget, text, values));
+}
+
+void JournalProxy::echo(const std::string& text, std::string& copy)
+{
+    JournalEchoStub stub(mTarget, text, &copy);
+    mQueue.send(&stub);
+}
+
+void JournalProxy::summary(long& count, long& sum)
+{
+    JournalSummaryStub stub(mTarget, &count, &sum);
+    mQueue.send(&stub);
+}
+
+void JournalProxy::reverse(std::vector<long>& values)
+{
+    JournalReverseStub stub(mTarget, &values);
+    mQueue.send(&stub);
+}
+
+void JournalProxy::ping(long sequence, long& reply)
+{
+    JournalPingStub stub(mTarget, sequence, &reply);
+    mQueue.send(&stub);
+}
+
+JournalShmClient::JournalShmClient(shm_channel& channel)
+        : mChannel(channel)
+{
+}
+
+void JournalShmClient::record(const std::string& text, const std::vector<long>& values)
+{
+    shm_writer writer(mChannel.requests().reserve(sizeof(boost::uint32_t) + shm_writer::size(text) + shm_writer::size(values)));
+    writer.write(boost::uint32_t(0));
+    writer.write(text);
+    writer.write(values);
+    mChannel.requests().commit();
+}
+
+void JournalShmClient::echo(const std::string& text, std::string& copy)
+{
+    shm_writer writer(mChannel.requests().reserve(sizeof(boost::uint32_t) + shm_writer::size(text)));
+    writer.write(boost::uint32_t(1));
+    writer.write(text);
+    mChannel.requests().commit();
+
+    boost::uint32_t frameSize;
+    shm_reader reader(mChannel.responses().wait(frameSize));
+    reader.read(copy);
+    mChannel.responses().release();
+}
+
+void JournalShmClient::summary(long& count, long& sum)
+{
+    shm_writer writer(mChannel.requests().reserve(sizeof(boost::uint32_t)));
+    writer.write(boost::uint32_t(2));
+    mChannel.requests().commit();
+
+    boost::uint32_t frameSize;
+    shm_reader reader(mChannel.responses().wait(frameSize));
+    reader.read(count);
+    reader.read(sum);
+    mChannel.responses().release();
+}
+
+void JournalShmClient::reverse(std::vector<long>& values)
+{
+    shm_writer writer(mChannel.requests().reserve(sizeof(boost::uint32_t) + shm_writer::size(values)));
+    writer.write(boost::uint32_t(3));
+    writer.write(values);
+    mChannel.requests().commit();
+
+    boost::uint32_t frameSize;
+    shm_reader reader(mChannel.responses().wait(frameSize));
+    reader.read(values);
+    mChannel.responses().release();
+}
+
+void JournalShmClient::ping(long sequence, long& reply)
+{
+    shm_writer writer(mChannel.requests().reserve(sizeof(boost::uint32_t) + shm_writer::size(sequence)));
+    writer.write(boost::uint32_t(4));
+    writer.write(sequence);
+    mChannel.requests().commit();
+
+    boost::uint32_t frameSize;
+    shm_reader reader(mChannel.responses().wait(frameSize));
+    reader.read(reply);
+    mChannel.responses().release();
+}
+
+JournalShmServer::JournalShmServer(const JournalSPtr& target, shm_channel& channel)
+        : mTarget (target)
+        , mChannel(channel)
+{
+}
+
+bool JournalShmServer::dispatch()
+{
+    boost::uint32_t frameSize;
+    const char* frame = mChannel.requests().peek(frameSize);
+    if (!frame)
+        return false;
+
+    shm_reader reader(frame);
+    boost::uint32_t methodId;
+    reader.read(methodId);
+    switch (methodId)
+    {
+        case 0:
+        {
+            std::string text = std::string();
+            std::vector<long> values = std::vector<long>();
+            reader.read(text);
+            reader.read(values);
+            mChannel.requests().release();
+            mTarget->record(text, values);
+            break;
+        }
+        case 1:
+        {
+            std::string text = std::string();
+            std::string copy = std::string();
+            reader.read(text);
+            mChannel.requests().release();
+            mTarget->echo(text, copy);
+            shm_writer writer(mChannel.responses().reserve(shm_writer::size(copy)));
+            writer.write(copy);
+            mChannel.responses().commit();
+            break;
+        }
+        case 2:
+        {
+            long count = long();
+            long sum = long();
+            mChannel.requests().release();
+            mTarget->summary(count, sum);
+            shm_writer writer(mChannel.responses().reserve(shm_writer::size(count) + shm_writer::size(sum)));
+            writer.write(count);
+            writer.write(sum);
+            mChannel.responses().commit();
+            break;
+        }
+        case 3:
+        {
+            std::vector<long> values = std::vector<long>();
+            reader.read(values);
+            mChannel.requests().release();
+            mTarget->reverse(values);
+            shm_writer writer(mChannel.responses().reserve(shm_writer::size(values)));
+            writer.write(values);
+            mChannel.responses().commit();
+            break;
+        }
+        case 4:
+        {
+            long sequence = long();
+            long reply = long();
+            reader.read(sequence);
+            mChannel.requests().release();
+            mTarget->ping(sequence, reply);
+            shm_writer writer(mChannel.responses().reserve(shm_writer::size(reply)));
+            writer.write(reply);
+            mChannel.responses().commit();
+            break;
+        }
+        default:
+            mChannel.requests().release();
+            break;
+    }
+    return true;
+}
+
+size_t JournalShmServer::process()
+{
+    size_t count = 0;
+    while (dispatch())
+        ++count;
+    return count;
+}
+
+}
+
@@ -0,0 +1,112 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __INTERFACE_SHM_COMPIL_H_
+#define __INTERFACE_SHM_COMPIL_H_
+
+#include "interface/shm-fwd.h"
+// Compil C++ Template Library
+#include "core/compil/async_queue.h"
+#include "core/compil/shm_channel.h"
+
+namespace shm
+{
+
+// Keeps the records written by a client in another process
+class Journal
+{
+public:
+    // Destructor
+    virtual      ~Journal();
+
+    virtual void record  (const std::string& text, const std::vector<long>& values) = 0;
+
+    virtual void echo    (const std::string& text, std::string& copy) = 0;
+
+    // Returns the count of the records and the sum of their values
+    virtual void summary (long& count, long& sum) = 0;
+
+    virtual void reverse (std::vector<long>& values) = 0;
+
+    virtual void ping    (long sequence, long& reply) = 0;
+};
+
+// Proxy of the Journal interface. The calls are marshalled into the queue
+// and dispatched on its worker thread in the order they are made. The
+// methods with out or io parameters wait for the dispatch, the rest return
+// as soon as the call is queued.
+class JournalProxy : public Journal
+{
+public:
+    // Constructor. The calls are dispatched to the target on the worker of
+    // the queue
+                 JournalProxy(const JournalSPtr& target, async_queue& queue);
+
+    virtual void record      (const std::string& text, const std::vector<long>& values);
+
+    virtual void echo        (const std::string& text, std::string& copy);
+
+    virtual void summary     (long& count, long& sum);
+
+    virtual void reverse     (std::vector<long>& values);
+
+    virtual void ping        (long sequence, long& reply);
+private:
+    JournalSPtr  mTarget;
+    async_queue& mQueue;
+};
+
+// Client of the Journal interface in another process. The arguments of the
+// calls are written directly in the request ring of the channel. The
+// methods with out or io parameters wait for the response of the server,
+// the rest return as soon as the request is committed. The waits throw
+// shm_timeout_error after the timeout of the channel.
+class JournalShmClient : public Journal
+{
+public:
+    // Constructor. The channel should be opened on the client side
+                 JournalShmClient(shm_channel& channel);
+
+    virtual void record          (const std::string& text, const std::vector<long>& values);
+
+    virtual void echo            (const std::string& text, std::string& copy);
+
+    virtual void summary         (long& count, long& sum);
+
+    virtual void reverse         (std::vector<long>& values);
+
+    virtual void ping            (long sequence, long& reply);
+private:
+    shm_channel& mChannel;
+};
+
+// Server of the Journal interface for a client in another process. It
+// reads the requests from the channel and dispatches them to the target on
+// the thread that calls it. The string and vector arguments are copied out
+// of the ring once, because the methods of the interface take them as
+// std::string and std::vector.
+class JournalShmServer
+{
+public:
+    // Constructor. The channel should be opened on the server side
+    JournalShmServer(const JournalSPtr& target, shm_channel& channel);
+
+    // Dispatches the oldest request. Returns false if there is none
+    bool dispatch();
+
+    // Dispatches the pending requests. Returns the count of the dispatched
+    // ones
+    size_t process();
+private:
+    JournalSPtr  mTarget;
+    shm_channel& mChannel;
+};
+
+}
+
+#endif // __INTERFACE_SHM_COMPIL_H_
+
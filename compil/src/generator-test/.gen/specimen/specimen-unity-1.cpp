@@ -0,0 +1,3 @@
+// Unity translation unit of the package specimen (1 of 2)
+
+#include "specimens.cpp"
@@ -0,0 +1,2 @@
+// Unity translation unit of the package specimen (2 of 2)
+
@@ -0,0 +1,45 @@
+#ifndef __SPECIMEN_SPECIMENS_COMPIL__FWD_H_
+#define __SPECIMEN_SPECIMENS_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace specimen
+{
+
+// Forward declarations
+class IntegerSpecimen;
+typedef IntegerSpecimen*                         IntegerSpecimenRPtr;
+typedef boost::shared_ptr<IntegerSpecimen>       IntegerSpecimenSPtr;
+typedef boost::shared_ptr<const IntegerSpecimen> IntegerSpecimenSCPtr;
+typedef boost::weak_ptr<IntegerSpecimen>         IntegerSpecimenWPtr;
+
+class StringSpecimen;
+typedef StringSpecimen*                         StringSpecimenRPtr;
+typedef boost::shared_ptr<StringSpecimen>       StringSpecimenSPtr;
+typedef boost::shared_ptr<const StringSpecimen> StringSpecimenSCPtr;
+typedef boost::weak_ptr<StringSpecimen>         StringSpecimenWPtr;
+
+class SpecimenFromSpecimen;
+typedef SpecimenFromSpecimen*                         SpecimenFromSpecimenRPtr;
+typedef boost::shared_ptr<SpecimenFromSpecimen>       SpecimenFromSpecimenSPtr;
+typedef boost::shared_ptr<const SpecimenFromSpecimen> SpecimenFromSpecimenSCPtr;
+typedef boost::weak_ptr<SpecimenFromSpecimen>         SpecimenFromSpecimenWPtr;
+
+class StringSpecimen2;
+typedef StringSpecimen2*                         StringSpecimen2RPtr;
+typedef boost::shared_ptr<StringSpecimen2>       StringSpecimen2SPtr;
+typedef boost::shared_ptr<const StringSpecimen2> StringSpecimen2SCPtr;
+typedef boost::weak_ptr<StringSpecimen2>         StringSpecimen2WPtr;
+
+class SpecimenDefaultValue;
+typedef SpecimenDefaultValue*                         SpecimenDefaultValueRPtr;
+typedef boost::shared_ptr<SpecimenDefaultValue>       SpecimenDefaultValueSPtr;
+typedef boost::shared_ptr<const SpecimenDefaultValue> SpecimenDefaultValueSCPtr;
+typedef boost::weak_ptr<SpecimenDefaultValue>         SpecimenDefaultValueWPtr;
+
+}
+
+#endif // __SPECIMEN_SPECIMENS_COMPIL__FWD_H_
+
@@ -0,0 +1,166 @@
+#include "specimen/specimens.h"
+
+namespace specimen
+{
+
+IntegerSpecimen::IntegerSpecimen()
+        : mValue()
+{
+}
+
+IntegerSpecimen::IntegerSpecimen(long value)
+        : mValue(value)
+{
+}
+
+StringSpecimen::StringSpecimen()
+        : mValue()
+{
+}
+
+StringSpecimen::StringSpecimen(const std::string& value)
+        : mValue(value)
+{
+}
+
+SpecimenFromSpecimen::SpecimenFromSpecimen()
+        : mValue()
+{
+}
+
+SpecimenFromSpecimen::SpecimenFromSpecimen(const StringSpecimen& value)
+        : mValue(value)
+{
+}
+
+StringSpecimen2::StringSpecimen2()
+        : StringSpecimen()
+{
+}
+
+StringSpecimen2::StringSpecimen2(const std::string& value)
+        : StringSpecimen(value)
+{
+}
+
+SpecimenDefaultValue::SpecimenDefaultValue()
+        : mI(default_i())
+        , mS(default_s())
+{
+}
+
+SpecimenDefaultValue::~SpecimenDefaultValue()
+{
+}
+
+const IntegerSpecimen& SpecimenDefaultValue::i() const
+{
+    return mI;
+}
+
+IntegerSpecimen SpecimenDefaultValue::default_i()
+{
+    return IntegerSpecimen(1);
+}
+
+SpecimenDefaultValue& SpecimenDefaultValue::set_i(const IntegerSpecimen& i)
+{
+    mI = i;
+    return *this;
+}
+
+IntegerSpecimen& SpecimenDefaultValue::mutable_i()
+{
+    return mI;
+}
+
+const StringSpecimen& SpecimenDefaultValue::s() const
+{
+    return mS;
+}
+
+StringSpecimen SpecimenDefaultValue::default_s()
+{
+    return StringSpecimen("specimen");
+}
+
+SpecimenDefaultValue& SpecimenDefaultValue::set_s(const StringSpecimen& s)
+{
+    mS = s;
+    return *this;
+}
+
+StringSpecimen& SpecimenDefaultValue::mutable_s()
+{
+    return mS;
+}
+
+SpecimenDefaultValueColumns::Row::Row(const SpecimenDefaultValueColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+const IntegerSpecimen& SpecimenDefaultValueColumns::Row::i() const
+{
+    return mColumns.i()[mIndex];
+}
+
+const StringSpecimen& SpecimenDefaultValueColumns::Row::s() const
+{
+    return mColumns.s()[mIndex];
+}
+
+SpecimenDefaultValueColumns::SpecimenDefaultValueColumns()
+{
+}
+
+SpecimenDefaultValueColumns::~SpecimenDefaultValueColumns()
+{
+}
+
+size_t SpecimenDefaultValueColumns::size() const
+{
+    return mI.size();
+}
+
+bool SpecimenDefaultValueColumns::empty() const
+{
+    return mI.empty();
+}
+
+void SpecimenDefaultValueColumns::reserve(size_t size)
+{
+    mI.reserve(size);
+    mS.reserve(size);
+}
+
+void SpecimenDefaultValueColumns::clear()
+{
+    mI.clear();
+    mS.clear();
+}
+
+void SpecimenDefaultValueColumns::push_back(const SpecimenDefaultValue& object)
+{
+    mI.push_back(object.i());
+    mS.push_back(object.s());
+}
+
+SpecimenDefaultValueColumns::Row SpecimenDefaultValueColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<IntegerSpecimen>& SpecimenDefaultValueColumns::i() const
+{
+    return mI;
+}
+
+const std::vector<StringSpecimen>& SpecimenDefaultValueColumns::s() const
+{
+    return mS;
+}
+
+}
+
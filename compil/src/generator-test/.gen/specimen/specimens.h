@@ -0,0 +1,403 @@
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __SPECIMEN_SPECIMENS_COMPIL_H_
+#define __SPECIMEN_SPECIMENS_COMPIL_H_
+
+#include "specimen/specimens-fwd.h"
+
+namespace specimen
+{
+
+#if 0
+class IntegerSpecimen
+{
+public:
+    IntegerSpecimen();
+    explicit IntegerSpecimen(const long value);
+    ~IntegerSpecimen();
+    inline long value() const;
+    inline bool operator==(const specimen::IntegerSpecimen& specimen) const;
+    inline bool operator!=(const specimen::IntegerSpecimen& specimen) const;
+    inline bool operator<(const specimen::IntegerSpecimen& specimen) const;
+private:
+    long value;
+};
+
+inline long value() const
+{
+    return value;
+}
+
+
+inline bool operator==(const specimen::IntegerSpecimen& specimen) const
+inline bool operator!=(const specimen::IntegerSpecimen& specimen) const
+inline bool operator<(const specimen::IntegerSpecimen& specimen) const
+
+#endif
+
+class IntegerSpecimen
+{
+public:
+                             IntegerSpecimen();
+    explicit                 IntegerSpecimen(long value);
+
+    inline   long            value          ()                              const;
+    inline   bool            operator==     (const IntegerSpecimen& rValue) const;
+    inline   bool            operator!=     (const IntegerSpecimen& rValue) const;
+    inline   bool            operator<      (const IntegerSpecimen& rValue) const;
+    inline   IntegerSpecimen operator+      (const IntegerSpecimen& rValue) const;
+    inline   IntegerSpecimen operator-      (const IntegerSpecimen& rValue) const;
+private:
+    long mValue;
+};
+
+#if 0
+class StringSpecimen
+{
+public:
+    StringSpecimen();
+    explicit StringSpecimen(std::string value);
+    ~StringSpecimen();
+    inline std::string value() const;
+    inline bool operator==(const specimen::StringSpecimen& specimen) const;
+    inline bool operator!=(const specimen::StringSpecimen& specimen) const;
+    inline bool operator<(const specimen::StringSpecimen& specimen) const;
+private:
+    std::string value;
+};
+
+inline std::string value() const
+{
+    return value;
+}
+
+
+inline bool operator==(const specimen::StringSpecimen& specimen) const
+inline bool operator!=(const specimen::StringSpecimen& specimen) const
+inline bool operator<(const specimen::StringSpecimen& specimen) const
+
+#endif
+
+class StringSpecimen
+{
+public:
+                         StringSpecimen();
+    explicit             StringSpecimen(const std::string& value);
+
+    inline   std::string value         ()                             const;
+    inline   bool        operator==    (const StringSpecimen& rValue) const;
+    inline   bool        operator!=    (const StringSpecimen& rValue) const;
+    inline   bool        operator<     (const StringSpecimen& rValue) const;
+private:
+    std::string mValue;
+};
+
+#if 0
+class SpecimenFromSpecimen
+{
+public:
+    SpecimenFromSpecimen();
+    explicit SpecimenFromSpecimen(const specimen::StringSpecimen& value);
+    ~SpecimenFromSpecimen();
+    inline specimen::StringSpecimen value() const;
+    inline bool operator==(const specimen::SpecimenFromSpecimen& specimen) const;
+    inline bool operator!=(const specimen::SpecimenFromSpecimen& specimen) const;
+    inline bool operator<(const specimen::SpecimenFromSpecimen& specimen) const;
+private:
+    specimen::StringSpecimen value;
+};
+
+inline specimen::StringSpecimen value() const
+{
+    return value;
+}
+
+
+inline bool operator==(const specimen::SpecimenFromSpecimen& specimen) const
+inline bool operator!=(const specimen::SpecimenFromSpecimen& specimen) const
+inline bool operator<(const specimen::SpecimenFromSpecimen& specimen) const
+
+#endif
+
+class SpecimenFromSpecimen
+{
+public:
+                            SpecimenFromSpecimen();
+    explicit                SpecimenFromSpecimen(const StringSpecimen& value);
+
+    inline   StringSpecimen value               ()                                   const;
+    inline   bool           operator==          (const SpecimenFromSpecimen& rValue) const;
+    inline   bool           operator!=          (const SpecimenFromSpecimen& rValue) const;
+    inline   bool           operator<           (const SpecimenFromSpecimen& rValue) const;
+private:
+    StringSpecimen mValue;
+};
+
+#if 0
+class StringSpecimen2
+{
+public:
+    StringSpecimen2();
+    explicit StringSpecimen2(std::string value);
+    ~StringSpecimen2();
+    inline std::string value() const;
+    inline bool operator==(const specimen::StringSpecimen2& specimen) const;
+    inline bool operator!=(const specimen::StringSpecimen2& specimen) const;
+    inline bool operator<(const specimen::StringSpecimen2& specimen) const;
+private:
+    std::string value;
+};
+
+inline std::string value() const
+{
+    return value;
+}
+
+
+inline bool operator==(const specimen::StringSpecimen2& specimen) const
+inline bool operator!=(const specimen::StringSpecimen2& specimen) const
+inline bool operator<(const specimen::StringSpecimen2& specimen) const
+
+#endif
+
+class StringSpecimen2 : public StringSpecimen
+{
+public:
+                  StringSpecimen2();
+    explicit      StringSpecimen2(const std::string& value);
+
+    inline   bool operator==     (const StringSpecimen2& rValue) const;
+    inline   bool operator!=     (const StringSpecimen2& rValue) const;
+    inline   bool operator<      (const StringSpecimen2& rValue) const;
+};
+
+class SpecimenDefaultValue
+{
+public:
+    // Default constructor
+                                   SpecimenDefaultValue ();
+    // Destructor
+    /*lax*/                        ~SpecimenDefaultValue();
+
+    // Getter method for the data field i
+            const IntegerSpecimen& i                    ()                         const;
+    // Returns the default value 1 of the field i
+    static  IntegerSpecimen        default_i            ();
+    // Setter method for the data field i
+            SpecimenDefaultValue&  set_i                (const IntegerSpecimen& i);
+    // Provides mutable access to field i
+            IntegerSpecimen&       mutable_i            ();
+
+    // Getter method for the data field s
+            const StringSpecimen&  s                    ()                         const;
+    // Returns the default value "specimen" of the field s
+    static  StringSpecimen         default_s            ();
+    // Setter method for the data field s
+            SpecimenDefaultValue&  set_s                (const StringSpecimen& s);
+    // Provides mutable access to field s
+            StringSpecimen&        mutable_s            ();
+
+private:
+    // variable for the data field i
+    IntegerSpecimen mI;
+    // variable for the data field s
+    StringSpecimen  mS;
+};
+
+// SpecimenDefaultValueColumns holds SpecimenDefaultValue objects column by
+// column - one contiguous array per data field. Use it for large
+// collections that are scanned one or two fields at a time. Such scan
+// touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class SpecimenDefaultValueColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                                  Row(const SpecimenDefaultValueColumns& columns, size_t index);
+
+        // Getter method for the data field i
+                                           const IntegerSpecimen& i  ()                                                         const;
+
+        // Getter method for the data field s
+                                           const StringSpecimen&  s  ()                                                         const;
+    private:
+        const SpecimenDefaultValueColumns& mColumns;
+        size_t                             mIndex;
+    };
+
+    // Default constructor
+                                        SpecimenDefaultValueColumns ();
+    // Destructor
+                                        ~SpecimenDefaultValueColumns();
+
+    // Returns the number of the rows
+    size_t                              size                        ()                                   const;
+    // Returns true if there are no rows
+    bool                                empty                       ()                                   const;
+    // Reserves memory for size rows in every column
+    void                                reserve                     (size_t size);
+    // Removes all the rows
+    void                                clear                       ();
+
+    // Appends a row with the data fields of the object
+    void                                push_back                   (const SpecimenDefaultValue& object);
+
+    // Returns proxy of the row index
+    Row                                 operator[]                  (size_t index)                       const;
+
+    // Column of the data field i
+    const std::vector<IntegerSpecimen>& i                           ()                                   const;
+
+    // Column of the data field s
+    const std::vector<StringSpecimen>&  s                           ()                                   const;
+
+private:
+    // column of the data field i
+    std::vector<IntegerSpecimen> mI;
+    // column of the data field s
+    std::vector<StringSpecimen>  mS;
+};
+
+inline IntegerSpecimenSPtr integerSpecimenRef()
+{
+    return boost::make_shared<IntegerSpecimen>();
+}
+
+inline IntegerSpecimenSPtr integerSpecimenRef(long value)
+{
+    return boost::make_shared<IntegerSpecimen>(value);
+}
+
+inline long IntegerSpecimen::value() const
+{
+    return mValue;
+}
+
+inline bool IntegerSpecimen::operator==(const IntegerSpecimen& rValue) const
+{
+    return value() == rValue.value();
+}
+
+inline bool IntegerSpecimen::operator!=(const IntegerSpecimen& rValue) const
+{
+    return value() != rValue.value();
+}
+
+inline bool IntegerSpecimen::operator<(const IntegerSpecimen& rValue) const
+{
+    return value() < rValue.value();
+}
+
+inline IntegerSpecimen IntegerSpecimen::operator+(const IntegerSpecimen& rValue) const
+{
+    return IntegerSpecimen(value() + rValue.value());
+}
+
+inline IntegerSpecimen IntegerSpecimen::operator-(const IntegerSpecimen& rValue) const
+{
+    return IntegerSpecimen(value() - rValue.value());
+}
+
+inline StringSpecimenSPtr stringSpecimenRef()
+{
+    return boost::make_shared<StringSpecimen>();
+}
+
+inline StringSpecimenSPtr stringSpecimenRef(const std::string& value)
+{
+    return boost::make_shared<StringSpecimen>(value);
+}
+
+inline std::string StringSpecimen::value() const
+{
+    return mValue;
+}
+
+inline bool StringSpecimen::operator==(const StringSpecimen& rValue) const
+{
+    return value() == rValue.value();
+}
+
+inline bool StringSpecimen::operator!=(const StringSpecimen& rValue) const
+{
+    return value() != rValue.value();
+}
+
+inline bool StringSpecimen::operator<(const StringSpecimen& rValue) const
+{
+    return value() < rValue.value();
+}
+
+inline SpecimenFromSpecimenSPtr specimenFromSpecimenRef()
+{
+    return boost::make_shared<SpecimenFromSpecimen>();
+}
+
+inline SpecimenFromSpecimenSPtr specimenFromSpecimenRef(const StringSpecimen& value)
+{
+    return boost::make_shared<SpecimenFromSpecimen>(value);
+}
+
+inline StringSpecimen SpecimenFromSpecimen::value() const
+{
+    return mValue;
+}
+
+inline bool SpecimenFromSpecimen::operator==(const SpecimenFromSpecimen& rValue) const
+{
+    return value() == rValue.value();
+}
+
+inline bool SpecimenFromSpecimen::operator!=(const SpecimenFromSpecimen& rValue) const
+{
+    return value() != rValue.value();
+}
+
+inline bool SpecimenFromSpecimen::operator<(const SpecimenFromSpecimen& rValue) const
+{
+    return value() < rValue.value();
+}
+
+inline StringSpecimen2SPtr stringSpecimen2Ref()
+{
+    return boost::make_shared<StringSpecimen2>();
+}
+
+inline StringSpecimen2SPtr stringSpecimen2Ref(const std::string& value)
+{
+    return boost::make_shared<StringSpecimen2>(value);
+}
+
+inline bool StringSpecimen2::operator==(const StringSpecimen2& rValue) const
+{
+    return value() == rValue.value();
+}
+
+inline bool StringSpecimen2::operator!=(const StringSpecimen2& rValue) const
+{
+    return value() != rValue.value();
+}
+
+inline bool StringSpecimen2::operator<(const StringSpecimen2& rValue) const
+{
+    return value() < rValue.value();
+}
+
+}
+
+#endif // __SPECIMEN_SPECIMENS_COMPIL_H_
+
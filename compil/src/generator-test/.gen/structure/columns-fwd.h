@@ -0,0 +1,39 @@
+#ifndef __STRUCTURE_COLUMNS_COMPIL__FWD_H_
+#define __STRUCTURE_COLUMNS_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace columns
+{
+
+// Forward declarations
+class ESide;
+typedef ESide*                         ESideRPtr;
+typedef boost::shared_ptr<ESide>       ESideSPtr;
+typedef boost::shared_ptr<const ESide> ESideSCPtr;
+typedef boost::weak_ptr<ESide>         ESideWPtr;
+
+class Trade;
+typedef Trade*                         TradeRPtr;
+typedef boost::shared_ptr<Trade>       TradeSPtr;
+typedef boost::shared_ptr<const Trade> TradeSCPtr;
+typedef boost::weak_ptr<Trade>         TradeWPtr;
+
+class BlockTrade;
+typedef BlockTrade*                         BlockTradeRPtr;
+typedef boost::shared_ptr<BlockTrade>       BlockTradeSPtr;
+typedef boost::shared_ptr<const BlockTrade> BlockTradeSCPtr;
+typedef boost::weak_ptr<BlockTrade>         BlockTradeWPtr;
+
+class Quote;
+typedef Quote*                         QuoteRPtr;
+typedef boost::shared_ptr<Quote>       QuoteSPtr;
+typedef boost::shared_ptr<const Quote> QuoteSCPtr;
+typedef boost::weak_ptr<Quote>         QuoteWPtr;
+
+}
+
+#endif // __STRUCTURE_COLUMNS_COMPIL__FWD_H_
+
@@ -0,0 +1,963 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#include "structure/columns.h"
+// Standard C Library
+#include <stddef.h>
+#include <string.h>
+
+namespace columns
+{
+
+ESide::ESide()
+        : mValue(kInvalid)
+{
+}
+
+ESide::ESide(long value)
+        : mValue(value)
+{
+}
+
+const ESide ESide::invalid()
+{
+    return ESide(kInvalid);
+}
+
+const ESide ESide::buy()
+{
+    return ESide(kBuy);
+}
+
+const ESide ESide::sell()
+{
+    return ESide(kSell);
+}
+
+long ESide::value() const
+{
+    return mValue;
+}
+
+const char* ESide::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "buy",
+        "sell",
+    };
+    return names[(size_t)value];
+}
+
+const char* ESide::shortName() const
+{
+    return shortName(value());
+}
+
+ESide ESide::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        1, 0,
+    };
+    static const char* names[] =
+    {
+        "sell",
+        "buy",
+        "invalid",
+    };
+    static const size_t lengths[] =
+    {
+        4, 3, 7,
+    };
+    static const long values[] =
+    {
+        kSell,
+        kBuy,
+        kInvalid,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return ESide();
+    return ESide(values[slot]);
+}
+
+bool ESide::operator==(const ESide& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool ESide::operator!=(const ESide& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+int Trade::bitmask_id()
+{
+    return 0x1;
+}
+
+int Trade::bitmask_quantity()
+{
+    return 0x2;
+}
+
+int Trade::bitmask_settled()
+{
+    return 0x4;
+}
+
+int Trade::bitmask_side()
+{
+    return 0x8;
+}
+
+int Trade::bitmask_venue()
+{
+    return 0x10;
+}
+
+int Trade::bitmask_fills()
+{
+    return 0x20;
+}
+
+Trade::Trade()
+        : mBits    (0)
+        , mQuantity(default_quantity())
+        , mSettled (default_settled())
+{
+}
+
+Trade::~Trade()
+{
+}
+
+bool Trade::isInitialized() const
+{
+    if (!valid_id()) return false;
+    if (!valid_side()) return false;
+    return true;
+}
+
+long Trade::id() const
+{
+    BOOST_ASSERT(valid_id());
+    return mId;
+}
+
+bool Trade::valid_id() const
+{
+    return (mBits & bitmask_id()) != 0;
+}
+
+Trade& Trade::set_id(long id)
+{
+    mId    = id;
+    mBits |= bitmask_id();
+    return *this;
+}
+
+void Trade::erase_id()
+{
+    mId    =  0;
+    mBits &= ~bitmask_id();
+}
+
+long Trade::quantity() const
+{
+    return mQuantity;
+}
+
+bool Trade::changed_quantity() const
+{
+    return (mBits & bitmask_quantity()) != 0;
+}
+
+long Trade::default_quantity()
+{
+    return 1;
+}
+
+Trade& Trade::set_quantity(long quantity)
+{
+    mQuantity  = quantity;
+    mBits     |= bitmask_quantity();
+    return *this;
+}
+
+Trade& Trade::update_quantity(long quantity)
+{
+    if (default_quantity() != quantity)
+        return set_quantity(quantity);
+
+    reset_quantity();
+    return *this;
+}
+
+void Trade::reset_quantity()
+{
+    mQuantity  =  default_quantity();
+    mBits     &= ~bitmask_quantity();
+}
+
+bool Trade::settled() const
+{
+    return mSettled;
+}
+
+bool Trade::changed_settled() const
+{
+    return (mBits & bitmask_settled()) != 0;
+}
+
+bool Trade::default_settled()
+{
+    return false;
+}
+
+Trade& Trade::set_settled(bool settled)
+{
+    mSettled  = settled;
+    mBits    |= bitmask_settled();
+    return *this;
+}
+
+Trade& Trade::update_settled(bool settled)
+{
+    if (default_settled() != settled)
+        return set_settled(settled);
+
+    reset_settled();
+    return *this;
+}
+
+void Trade::reset_settled()
+{
+    mSettled  =  default_settled();
+    mBits    &= ~bitmask_settled();
+}
+
+const ESide& Trade::side() const
+{
+    BOOST_ASSERT(valid_side());
+    return mSide;
+}
+
+bool Trade::valid_side() const
+{
+    return (mBits & bitmask_side()) != 0;
+}
+
+Trade& Trade::set_side(const ESide& side)
+{
+    mSide  = side;
+    mBits |= bitmask_side();
+    return *this;
+}
+
+ESide& Trade::mutable_side()
+{
+    mBits |= bitmask_side();
+    return mSide;
+}
+
+void Trade::erase_side()
+{
+    mSide  =  ESide::invalid();
+    mBits &= ~bitmask_side     ();
+}
+
+const std::string& Trade::venue() const
+{
+    BOOST_ASSERT(exist_venue());
+    return mVenue;
+}
+
+bool Trade::exist_venue() const
+{
+    return (mBits & bitmask_venue()) != 0;
+}
+
+Trade& Trade::set_venue(const std::string& venue)
+{
+    mVenue  = venue;
+    mBits  |= bitmask_venue();
+    return *this;
+}
+
+std::string& Trade::mutable_venue()
+{
+    mBits |= bitmask_venue();
+    return mVenue;
+}
+
+void Trade::clear_venue()
+{
+    mVenue.clear();
+    mBits &= ~bitmask_venue();
+}
+
+const std::vector<long>& Trade::fills() const
+{
+    BOOST_ASSERT(exist_fills());
+    return mFills;
+}
+
+bool Trade::exist_fills() const
+{
+    return (mBits & bitmask_fills()) != 0;
+}
+
+Trade& Trade::set_fills(const std::vector<long>& fills)
+{
+    mFills  = fills;
+    mBits  |= bitmask_fills();
+    return *this;
+}
+
+std::vector<long>& Trade::mutable_fills()
+{
+    mBits |= bitmask_fills();
+    return mFills;
+}
+
+void Trade::clear_fills()
+{
+    mFills.clear();
+    mBits &= ~bitmask_fills();
+}
+
+TradeColumns::Row::Row(const TradeColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long TradeColumns::Row::id() const
+{
+    return mColumns.id()[mIndex];
+}
+
+bool TradeColumns::Row::valid_id() const
+{
+    return mColumns.valid_id()[mIndex];
+}
+
+long TradeColumns::Row::quantity() const
+{
+    return mColumns.quantity()[mIndex];
+}
+
+bool TradeColumns::Row::settled() const
+{
+    return mColumns.settled()[mIndex] != 0;
+}
+
+const ESide& TradeColumns::Row::side() const
+{
+    return mColumns.side()[mIndex];
+}
+
+bool TradeColumns::Row::valid_side() const
+{
+    return mColumns.valid_side()[mIndex];
+}
+
+const std::string& TradeColumns::Row::venue() const
+{
+    return mColumns.venue()[mIndex];
+}
+
+bool TradeColumns::Row::exist_venue() const
+{
+    return mColumns.exist_venue()[mIndex];
+}
+
+const std::vector<long>& TradeColumns::Row::fills() const
+{
+    return mColumns.fills()[mIndex];
+}
+
+bool TradeColumns::Row::exist_fills() const
+{
+    return mColumns.exist_fills()[mIndex];
+}
+
+TradeColumns::TradeColumns()
+{
+}
+
+TradeColumns::~TradeColumns()
+{
+}
+
+size_t TradeColumns::size() const
+{
+    return mId.size();
+}
+
+bool TradeColumns::empty() const
+{
+    return mId.empty();
+}
+
+void TradeColumns::reserve(size_t size)
+{
+    mId.reserve(size);
+    mIdAvailability.reserve(size);
+    mQuantity.reserve(size);
+    mSettled.reserve(size);
+    mSide.reserve(size);
+    mSideAvailability.reserve(size);
+    mVenue.reserve(size);
+    mVenueAvailability.reserve(size);
+    mFills.reserve(size);
+    mFillsAvailability.reserve(size);
+}
+
+void TradeColumns::clear()
+{
+    mId.clear();
+    mIdAvailability.clear();
+    mQuantity.clear();
+    mSettled.clear();
+    mSide.clear();
+    mSideAvailability.clear();
+    mVenue.clear();
+    mVenueAvailability.clear();
+    mFills.clear();
+    mFillsAvailability.clear();
+}
+
+void TradeColumns::push_back(const Trade& object)
+{
+    mIdAvailability.push_back(object.valid_id());
+    if (mIdAvailability.back())
+        mId.push_back(object.id());
+    else
+        mId.resize(mId.size() + 1);
+    mQuantity.push_back(object.quantity());
+    mSettled.push_back(object.settled());
+    mSideAvailability.push_back(object.valid_side());
+    if (mSideAvailability.back())
+        mSide.push_back(object.side());
+    else
+        mSide.resize(mSide.size() + 1);
+    mVenueAvailability.push_back(object.exist_venue());
+    if (mVenueAvailability.back())
+        mVenue.push_back(object.venue());
+    else
+        mVenue.resize(mVenue.size() + 1);
+    mFillsAvailability.push_back(object.exist_fills());
+    if (mFillsAvailability.back())
+        mFills.push_back(object.fills());
+    else
+        mFills.resize(mFills.size() + 1);
+}
+
+TradeColumns::Row TradeColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& TradeColumns::id() const
+{
+    return mId;
+}
+
+const std::vector<bool>& TradeColumns::valid_id() const
+{
+    return mIdAvailability;
+}
+
+const std::vector<long>& TradeColumns::quantity() const
+{
+    return mQuantity;
+}
+
+const std::vector<unsigned char>& TradeColumns::settled() const
+{
+    return mSettled;
+}
+
+const std::vector<ESide>& TradeColumns::side() const
+{
+    return mSide;
+}
+
+const std::vector<bool>& TradeColumns::valid_side() const
+{
+    return mSideAvailability;
+}
+
+const std::vector<std::string>& TradeColumns::venue() const
+{
+    return mVenue;
+}
+
+const std::vector<bool>& TradeColumns::exist_venue() const
+{
+    return mVenueAvailability;
+}
+
+const std::vector<std::vector<long> >& TradeColumns::fills() const
+{
+    return mFills;
+}
+
+const std::vector<bool>& TradeColumns::exist_fills() const
+{
+    return mFillsAvailability;
+}
+
+int BlockTrade::bitmask_legs()
+{
+    return 0x1;
+}
+
+BlockTrade::BlockTrade()
+        : mBits(0)
+{
+}
+
+BlockTrade::~BlockTrade()
+{
+}
+
+BlockTradeSPtr BlockTrade::downcast(const TradeSPtr& object)
+{
+    return boost::static_pointer_cast<BlockTrade>(object);
+}
+
+bool BlockTrade::isInitialized() const
+{
+    if (!Trade::isInitialized()) return false;
+    if (!valid_legs()) return false;
+    return true;
+}
+
+long BlockTrade::legs() const
+{
+    BOOST_ASSERT(valid_legs());
+    return mLegs;
+}
+
+bool BlockTrade::valid_legs() const
+{
+    return (mBits & bitmask_legs()) != 0;
+}
+
+BlockTrade& BlockTrade::set_legs(long legs)
+{
+    mLegs  = legs;
+    mBits |= bitmask_legs();
+    return *this;
+}
+
+void BlockTrade::erase_legs()
+{
+    mLegs  =  0;
+    mBits &= ~bitmask_legs();
+}
+
+BlockTrade& BlockTrade::set_id(long id)
+{
+    Trade::set_id(id);
+    return *this;
+}
+
+BlockTrade& BlockTrade::set_quantity(long quantity)
+{
+    Trade::set_quantity(quantity);
+    return *this;
+}
+
+BlockTrade& BlockTrade::set_settled(bool settled)
+{
+    Trade::set_settled(settled);
+    return *this;
+}
+
+BlockTrade& BlockTrade::set_side(const ESide& side)
+{
+    Trade::set_side(side);
+    return *this;
+}
+
+BlockTrade& BlockTrade::set_venue(const std::string& venue)
+{
+    Trade::set_venue(venue);
+    return *this;
+}
+
+BlockTrade& BlockTrade::set_fills(const std::vector<long>& fills)
+{
+    Trade::set_fills(fills);
+    return *this;
+}
+
+BlockTradeColumns::Row::Row(const BlockTradeColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long BlockTradeColumns::Row::id() const
+{
+    return mColumns.id()[mIndex];
+}
+
+bool BlockTradeColumns::Row::valid_id() const
+{
+    return mColumns.valid_id()[mIndex];
+}
+
+long BlockTradeColumns::Row::quantity() const
+{
+    return mColumns.quantity()[mIndex];
+}
+
+bool BlockTradeColumns::Row::settled() const
+{
+    return mColumns.settled()[mIndex] != 0;
+}
+
+const ESide& BlockTradeColumns::Row::side() const
+{
+    return mColumns.side()[mIndex];
+}
+
+bool BlockTradeColumns::Row::valid_side() const
+{
+    return mColumns.valid_side()[mIndex];
+}
+
+const std::string& BlockTradeColumns::Row::venue() const
+{
+    return mColumns.venue()[mIndex];
+}
+
+bool BlockTradeColumns::Row::exist_venue() const
+{
+    return mColumns.exist_venue()[mIndex];
+}
+
+const std::vector<long>& BlockTradeColumns::Row::fills() const
+{
+    return mColumns.fills()[mIndex];
+}
+
+bool BlockTradeColumns::Row::exist_fills() const
+{
+    return mColumns.exist_fills()[mIndex];
+}
+
+long BlockTradeColumns::Row::legs() const
+{
+    return mColumns.legs()[mIndex];
+}
+
+bool BlockTradeColumns::Row::valid_legs() const
+{
+    return mColumns.valid_legs()[mIndex];
+}
+
+BlockTradeColumns::BlockTradeColumns()
+{
+}
+
+BlockTradeColumns::~BlockTradeColumns()
+{
+}
+
+size_t BlockTradeColumns::size() const
+{
+    return mId.size();
+}
+
+bool BlockTradeColumns::empty() const
+{
+    return mId.empty();
+}
+
+void BlockTradeColumns::reserve(size_t size)
+{
+    mId.reserve(size);
+    mIdAvailability.reserve(size);
+    mQuantity.reserve(size);
+    mSettled.reserve(size);
+    mSide.reserve(size);
+    mSideAvailability.reserve(size);
+    mVenue.reserve(size);
+    mVenueAvailability.reserve(size);
+    mFills.reserve(size);
+    mFillsAvailability.reserve(size);
+    mLegs.reserve(size);
+    mLegsAvailability.reserve(size);
+}
+
+void BlockTradeColumns::clear()
+{
+    mId.clear();
+    mIdAvailability.clear();
+    mQuantity.clear();
+    mSettled.clear();
+    mSide.clear();
+    mSideAvailability.clear();
+    mVenue.clear();
+    mVenueAvailability.clear();
+    mFills.clear();
+    mFillsAvailability.clear();
+    mLegs.clear();
+    mLegsAvailability.clear();
+}
+
+void BlockTradeColumns::push_back(const BlockTrade& object)
+{
+    mIdAvailability.push_back(object.valid_id());
+    if (mIdAvailability.back())
+        mId.push_back(object.id());
+    else
+        mId.resize(mId.size() + 1);
+    mQuantity.push_back(object.quantity());
+    mSettled.push_back(object.settled());
+    mSideAvailability.push_back(object.valid_side());
+    if (mSideAvailability.back())
+        mSide.push_back(object.side());
+    else
+        mSide.resize(mSide.size() + 1);
+    mVenueAvailability.push_back(object.exist_venue());
+    if (mVenueAvailability.back())
+        mVenue.push_back(object.venue());
+    else
+        mVenue.resize(mVenue.size() + 1);
+    mFillsAvailability.push_back(object.exist_fills());
+    if (mFillsAvailability.back())
+        mFills.push_back(object.fills());
+    else
+        mFills.resize(mFills.size() + 1);
+    mLegsAvailability.push_back(object.valid_legs());
+    if (mLegsAvailability.back())
+        mLegs.push_back(object.legs());
+    else
+        mLegs.resize(mLegs.size() + 1);
+}
+
+BlockTradeColumns::Row BlockTradeColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& BlockTradeColumns::id() const
+{
+    return mId;
+}
+
+const std::vector<bool>& BlockTradeColumns::valid_id() const
+{
+    return mIdAvailability;
+}
+
+const std::vector<long>& BlockTradeColumns::quantity() const
+{
+    return mQuantity;
+}
+
+const std::vector<unsigned char>& BlockTradeColumns::settled() const
+{
+    return mSettled;
+}
+
+const std::vector<ESide>& BlockTradeColumns::side() const
+{
+    return mSide;
+}
+
+const std::vector<bool>& BlockTradeColumns::valid_side() const
+{
+    return mSideAvailability;
+}
+
+const std::vector<std::string>& BlockTradeColumns::venue() const
+{
+    return mVenue;
+}
+
+const std::vector<bool>& BlockTradeColumns::exist_venue() const
+{
+    return mVenueAvailability;
+}
+
+const std::vector<std::vector<long> >& BlockTradeColumns::fills() const
+{
+    return mFills;
+}
+
+const std::vector<bool>& BlockTradeColumns::exist_fills() const
+{
+    return mFillsAvailability;
+}
+
+const std::vector<long>& BlockTradeColumns::legs() const
+{
+    return mLegs;
+}
+
+const std::vector<bool>& BlockTradeColumns::valid_legs() const
+{
+    return mLegsAvailability;
+}
+
+Quote::Builder::Builder()
+        : mpObject(new Quote())
+{
+}
+
+Quote::Builder::Builder(const Quote& object)
+        : mpObject(new Quote())
+{
+    *(Quote*)mpObject = object;
+}
+
+Quote::Builder::Builder(QuoteRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Quote::Builder::~Builder()
+{
+    delete (QuoteRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Quote& Quote::Builder::build() const
+{
+    return *(QuoteRPtr)mpObject;
+}
+
+QuoteSPtr Quote::Builder::finalize()
+{
+    QuoteRPtr objectRPtr = (QuoteRPtr)mpObject;
+    mpObject = NULL;
+    return QuoteSPtr(objectRPtr);
+}
+
+Quote::Quote()
+{
+}
+
+Quote::~Quote()
+{
+}
+
+long Quote::bid() const
+{
+    return mBid;
+}
+
+Quote::Builder& Quote::Builder::set_bid(long bid)
+{
+    mpObject->mBid = bid;
+    return *this;
+}
+
+long Quote::ask() const
+{
+    return mAsk;
+}
+
+Quote::Builder& Quote::Builder::set_ask(long ask)
+{
+    mpObject->mAsk = ask;
+    return *this;
+}
+
+QuoteColumns::Row::Row(const QuoteColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long QuoteColumns::Row::bid() const
+{
+    return mColumns.bid()[mIndex];
+}
+
+long QuoteColumns::Row::ask() const
+{
+    return mColumns.ask()[mIndex];
+}
+
+QuoteColumns::QuoteColumns()
+{
+}
+
+QuoteColumns::~QuoteColumns()
+{
+}
+
+size_t QuoteColumns::size() const
+{
+    return mBid.size();
+}
+
+bool QuoteColumns::empty() const
+{
+    return mBid.empty();
+}
+
+void QuoteColumns::reserve(size_t size)
+{
+    mBid.reserve(size);
+    mAsk.reserve(size);
+}
+
+void QuoteColumns::clear()
+{
+    mBid.clear();
+    mAsk.clear();
+}
+
+void QuoteColumns::push_back(const Quote& object)
+{
+    mBid.push_back(object.bid());
+    mAsk.push_back(object.ask());
+}
+
+void QuoteColumns::push_back(const Quote::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+QuoteColumns::Row QuoteColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& QuoteColumns::bid() const
+{
+    return mBid;
+}
+
+const std::vector<long>& QuoteColumns::ask() const
+{
+    return mAsk;
+}
+
+}
+
@@ -0,0 +1,643 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __STRUCTURE_COLUMNS_COMPIL_H_
+#define __STRUCTURE_COLUMNS_COMPIL_H_
+
+#include "structure/columns-fwd.h"
+// Standard C Library
+#include <stddef.h>
+
+template<class T> class snapshot;
+
+namespace columns
+{
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class ESide
+{
+public:
+    // Default constructor - sets the value to invalid
+                         ESide     ();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit             ESide     (long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long        value     ()                              const;
+    // Returns short name for a specified enum value
+    static   const char* shortName (long value);
+    // Returns short name of the enum value
+             const char* shortName ()                              const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   ESide       fromString(const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool        operator==(const ESide& rValue)           const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool        operator!=(const ESide& rValue)           const;
+
+    // static methods for enum class objects
+    static const ESide invalid();
+    static const ESide buy    ();
+    static const ESide sell   ();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid = 0,
+        kBuy     = 1,
+        kSell    = 2,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class Trade
+{
+public:
+    // Default constructor
+                                     Trade           ();
+    // Destructor
+    /*lax*/                          ~Trade          ();
+
+    // Returns true if every required field is initialized.
+            bool                     isInitialized   ()                               const;
+
+    // Getter method for the data field id
+            long                     id              ()                               const;
+    // Returns true if the data field id was set and could be considered
+    // valid
+            bool                     valid_id        ()                               const;
+    // Setter method for the data field id
+            Trade&                   set_id          (long id);
+    // Erases the required data field id. Object can not be instantiated
+    // before the field data is set again
+            void                     erase_id        ();
+
+    // Getter method for the data field quantity
+            long                     quantity        ()                               const;
+    // Returns true if the data field value quantity was changed from its
+    // default value 1
+            bool                     changed_quantity()                               const;
+    // Returns the default value 1 of the field quantity
+    static  long                     default_quantity();
+    // Setter method for the data field quantity
+            Trade&                   set_quantity    (long quantity);
+    // Updates the data field quantity. If the new value is equal to the
+    // default it clears the field else it sets it to the new value
+            Trade&                   update_quantity (long quantity);
+    // Resets the data field quantity to its default value 1
+            void                     reset_quantity  ();
+
+    // Getter method for the data field settled
+            bool                     settled         ()                               const;
+    // Returns true if the data field value settled was changed from its
+    // default value false
+            bool                     changed_settled ()                               const;
+    // Returns the default value false of the field settled
+    static  bool                     default_settled ();
+    // Setter method for the data field settled
+            Trade&                   set_settled     (bool settled);
+    // Updates the data field settled. If the new value is equal to the
+    // default it clears the field else it sets it to the new value
+            Trade&                   update_settled  (bool settled);
+    // Resets the data field settled to its default value false
+            void                     reset_settled   ();
+
+    // Getter method for the data field side
+            const ESide&             side            ()                               const;
+    // Returns true if the data field side was set and could be considered
+    // valid
+            bool                     valid_side      ()                               const;
+    // Setter method for the data field side
+            Trade&                   set_side        (const ESide& side);
+    // Provides mutable access to field side
+            ESide&                   mutable_side    ();
+    // Erases the required data field side. Object can not be instantiated
+    // before the field data is set again
+            void                     erase_side      ();
+
+    // Getter method for the data field venue
+            const std::string&       venue           ()                               const;
+    // Checks if the optional field venue exists
+            bool                     exist_venue     ()                               const;
+    // Setter method for the data field venue
+            Trade&                   set_venue       (const std::string& venue);
+    // Provides mutable access to field venue
+            std::string&             mutable_venue   ();
+    // Clears the optional data field venue
+            void                     clear_venue     ();
+
+    // Getter method for the data field fills
+            const std::vector<long>& fills           ()                               const;
+    // Checks if the optional field fills exists
+            bool                     exist_fills     ()                               const;
+    // Setter method for the data field fills
+            Trade&                   set_fills       (const std::vector<long>& fills);
+    // Provides mutable access to field fills
+            std::vector<long>&       mutable_fills   ();
+    // Clears the optional data field fills
+            void                     clear_fills     ();
+
+private:
+    // Returns unique bitmask value for the field id
+    static int bitmask_id      ();
+    // Returns unique bitmask value for the field quantity
+    static int bitmask_quantity();
+    // Returns unique bitmask value for the field settled
+    static int bitmask_settled ();
+    // Returns unique bitmask value for the field side
+    static int bitmask_side    ();
+    // Returns unique bitmask value for the field venue
+    static int bitmask_venue   ();
+    // Returns unique bitmask value for the field fills
+    static int bitmask_fills   ();
+
+    // Stores availability information for the fields
+    int               mBits;
+
+    // variable for the data field id
+    long              mId;
+    // variable for the data field quantity
+    long              mQuantity;
+    // variable for the data field settled
+    bool              mSettled;
+    // variable for the data field side
+    ESide             mSide;
+    // variable for the data field venue
+    std::string       mVenue;
+    // variable for the data field fills
+    std::vector<long> mFills;
+};
+
+// TradeColumns holds Trade objects column by column - one contiguous array
+// per data field. Use it for large collections that are scanned one or two
+// fields at a time. Such scan touches only the memory of the columns it
+// reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class TradeColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                     Row        (const TradeColumns& columns, size_t index);
+
+        // Getter method for the data field id
+                            long                     id         ()                                          const;
+        // Returns true if the data field id is available in the row
+                            bool                     valid_id   ()                                          const;
+
+        // Getter method for the data field quantity
+                            long                     quantity   ()                                          const;
+
+        // Getter method for the data field settled
+                            bool                     settled    ()                                          const;
+
+        // Getter method for the data field side
+                            const ESide&             side       ()                                          const;
+        // Returns true if the data field side is available in the row
+                            bool                     valid_side ()                                          const;
+
+        // Getter method for the data field venue
+                            const std::string&       venue      ()                                          const;
+        // Returns true if the data field venue is available in the row
+                            bool                     exist_venue()                                          const;
+
+        // Getter method for the data field fills
+                            const std::vector<long>& fills      ()                                          const;
+        // Returns true if the data field fills is available in the row
+                            bool                     exist_fills()                                          const;
+    private:
+        const TradeColumns& mColumns;
+        size_t              mIndex;
+    };
+
+    // Default constructor
+                                           TradeColumns ();
+    // Destructor
+                                           ~TradeColumns();
+
+    // Returns the number of the rows
+    size_t                                 size         ()                    const;
+    // Returns true if there are no rows
+    bool                                   empty        ()                    const;
+    // Reserves memory for size rows in every column
+    void                                   reserve      (size_t size);
+    // Removes all the rows
+    void                                   clear        ();
+
+    // Appends a row with the data fields of the object
+    void                                   push_back    (const Trade& object);
+
+    // Returns proxy of the row index
+    Row                                    operator[]   (size_t index)        const;
+
+    // Column of the data field id
+    const std::vector<long>&               id           ()                    const;
+    // Availability bitmap of the data field id
+    const std::vector<bool>&               valid_id     ()                    const;
+
+    // Column of the data field quantity
+    const std::vector<long>&               quantity     ()                    const;
+
+    // Column of the data field settled
+    const std::vector<unsigned char>&      settled      ()                    const;
+
+    // Column of the data field side
+    const std::vector<ESide>&              side         ()                    const;
+    // Availability bitmap of the data field side
+    const std::vector<bool>&               valid_side   ()                    const;
+
+    // Column of the data field venue
+    const std::vector<std::string>&        venue        ()                    const;
+    // Availability bitmap of the data field venue
+    const std::vector<bool>&               exist_venue  ()                    const;
+
+    // Column of the data field fills
+    const std::vector<std::vector<long> >& fills        ()                    const;
+    // Availability bitmap of the data field fills
+    const std::vector<bool>&               exist_fills  ()                    const;
+
+private:
+    // column of the data field id
+    std::vector<long>               mId;
+    // availability bitmap of the data field id
+    std::vector<bool>               mIdAvailability;
+    // column of the data field quantity
+    std::vector<long>               mQuantity;
+    // column of the data field settled
+    std::vector<unsigned char>      mSettled;
+    // column of the data field side
+    std::vector<ESide>              mSide;
+    // availability bitmap of the data field side
+    std::vector<bool>               mSideAvailability;
+    // column of the data field venue
+    std::vector<std::string>        mVenue;
+    // availability bitmap of the data field venue
+    std::vector<bool>               mVenueAvailability;
+    // column of the data field fills
+    std::vector<std::vector<long> > mFills;
+    // availability bitmap of the data field fills
+    std::vector<bool>               mFillsAvailability;
+};
+
+class BlockTrade : public Trade
+{
+public:
+    // Default constructor
+                           BlockTrade   ();
+    // Destructor
+    /*lax*/                ~BlockTrade  ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  BlockTradeSPtr downcast     (const TradeSPtr& object);
+
+    // Returns true if every required field is initialized.
+            bool           isInitialized()                               const;
+
+    // Getter method for the data field legs
+            long           legs         ()                               const;
+    // Returns true if the data field legs was set and could be considered
+    // valid
+            bool           valid_legs   ()                               const;
+    // Setter method for the data field legs
+            BlockTrade&    set_legs     (long legs);
+    // Erases the required data field legs. Object can not be instantiated
+    // before the field data is set again
+            void           erase_legs   ();
+
+    // Setter method for the data field id
+            BlockTrade&    set_id       (long id);
+
+    // Setter method for the data field quantity
+            BlockTrade&    set_quantity (long quantity);
+
+    // Setter method for the data field settled
+            BlockTrade&    set_settled  (bool settled);
+
+    // Setter method for the data field side
+            BlockTrade&    set_side     (const ESide& side);
+
+    // Setter method for the data field venue
+            BlockTrade&    set_venue    (const std::string& venue);
+
+    // Setter method for the data field fills
+            BlockTrade&    set_fills    (const std::vector<long>& fills);
+
+private:
+    // Returns unique bitmask value for the field legs
+    static int bitmask_legs();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field legs
+    long mLegs;
+};
+
+// BlockTradeColumns holds BlockTrade objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class BlockTradeColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                          Row        (const BlockTradeColumns& columns, size_t index);
+
+        // Getter method for the data field id
+                                 long                     id         ()                                               const;
+        // Returns true if the data field id is available in the row
+                                 bool                     valid_id   ()                                               const;
+
+        // Getter method for the data field quantity
+                                 long                     quantity   ()                                               const;
+
+        // Getter method for the data field settled
+                                 bool                     settled    ()                                               const;
+
+        // Getter method for the data field side
+                                 const ESide&             side       ()                                               const;
+        // Returns true if the data field side is available in the row
+                                 bool                     valid_side ()                                               const;
+
+        // Getter method for the data field venue
+                                 const std::string&       venue      ()                                               const;
+        // Returns true if the data field venue is available in the row
+                                 bool                     exist_venue()                                               const;
+
+        // Getter method for the data field fills
+                                 const std::vector<long>& fills      ()                                               const;
+        // Returns true if the data field fills is available in the row
+                                 bool                     exist_fills()                                               const;
+
+        // Getter method for the data field legs
+                                 long                     legs       ()                                               const;
+        // Returns true if the data field legs is available in the row
+                                 bool                     valid_legs ()                                               const;
+    private:
+        const BlockTradeColumns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                                           BlockTradeColumns ();
+    // Destructor
+                                           ~BlockTradeColumns();
+
+    // Returns the number of the rows
+    size_t                                 size              ()                         const;
+    // Returns true if there are no rows
+    bool                                   empty             ()                         const;
+    // Reserves memory for size rows in every column
+    void                                   reserve           (size_t size);
+    // Removes all the rows
+    void                                   clear             ();
+
+    // Appends a row with the data fields of the object
+    void                                   push_back         (const BlockTrade& object);
+
+    // Returns proxy of the row index
+    Row                                    operator[]        (size_t index)             const;
+
+    // Column of the data field id
+    const std::vector<long>&               id                ()                         const;
+    // Availability bitmap of the data field id
+    const std::vector<bool>&               valid_id          ()                         const;
+
+    // Column of the data field quantity
+    const std::vector<long>&               quantity          ()                         const;
+
+    // Column of the data field settled
+    const std::vector<unsigned char>&      settled           ()                         const;
+
+    // Column of the data field side
+    const std::vector<ESide>&              side              ()                         const;
+    // Availability bitmap of the data field side
+    const std::vector<bool>&               valid_side        ()                         const;
+
+    // Column of the data field venue
+    const std::vector<std::string>&        venue             ()                         const;
+    // Availability bitmap of the data field venue
+    const std::vector<bool>&               exist_venue       ()                         const;
+
+    // Column of the data field fills
+    const std::vector<std::vector<long> >& fills             ()                         const;
+    // Availability bitmap of the data field fills
+    const std::vector<bool>&               exist_fills       ()                         const;
+
+    // Column of the data field legs
+    const std::vector<long>&               legs              ()                         const;
+    // Availability bitmap of the data field legs
+    const std::vector<bool>&               valid_legs        ()                         const;
+
+private:
+    // column of the data field id
+    std::vector<long>               mId;
+    // availability bitmap of the data field id
+    std::vector<bool>               mIdAvailability;
+    // column of the data field quantity
+    std::vector<long>               mQuantity;
+    // column of the data field settled
+    std::vector<unsigned char>      mSettled;
+    // column of the data field side
+    std::vector<ESide>              mSide;
+    // availability bitmap of the data field side
+    std::vector<bool>               mSideAvailability;
+    // column of the data field venue
+    std::vector<std::string>        mVenue;
+    // availability bitmap of the data field venue
+    std::vector<bool>               mVenueAvailability;
+    // column of the data field fills
+    std::vector<std::vector<long> > mFills;
+    // availability bitmap of the data field fills
+    std::vector<bool>               mFillsAvailability;
+    // column of the data field legs
+    std::vector<long>               mLegs;
+    // availability bitmap of the data field legs
+    std::vector<bool>               mLegsAvailability;
+};
+
+// Quote is an immutable class - once instantiated none of the data fields
+// can be changed. For the initial initialization and instantiation use the
+// nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Quote
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void         operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                             Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                             Builder  (const Quote& object);
+        // Destructor of Builder
+        /*lax*/              ~Builder ();
+
+        // Instantiates Quote instance with the current initialization of
+        // the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Quote& build    ()                    const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                QuoteSPtr    finalize ();
+
+
+        // Setter method for the data field bid
+                Builder&     set_bid  (long bid);
+
+        // Setter method for the data field ask
+                Builder&     set_ask  (long ask);
+
+    protected:
+        // constructor needed from potential derived classes
+                             Builder  (QuoteRPtr pObject);
+
+        QuoteRPtr mpObject;
+    };
+
+    // Default constructor
+                 Quote ();
+    // Destructor
+    /*lax*/      ~Quote();
+
+    // Getter method for the data field bid
+            long bid   () const;
+
+    // Getter method for the data field ask
+            long ask   () const;
+
+private:
+    // variable for the data field bid
+    long mBid;
+    // variable for the data field ask
+    long mAsk;
+};
+
+// Holder of the current Quote shared between threads. The readers get the
+// current object wait-free through a view, the writers publish the results
+// of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Quote> QuoteSnapshot;
+
+// QuoteColumns holds Quote objects column by column - one contiguous array
+// per data field. Use it for large collections that are scanned one or two
+// fields at a time. Such scan touches only the memory of the columns it
+// reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class QuoteColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                     Row(const QuoteColumns& columns, size_t index);
+
+        // Getter method for the data field bid
+                            long     bid()                                          const;
+
+        // Getter method for the data field ask
+                            long     ask()                                          const;
+    private:
+        const QuoteColumns& mColumns;
+        size_t              mIndex;
+    };
+
+    // Default constructor
+                             QuoteColumns ();
+    // Destructor
+                             ~QuoteColumns();
+
+    // Returns the number of the rows
+    size_t                   size         ()                              const;
+    // Returns true if there are no rows
+    bool                     empty        ()                              const;
+    // Reserves memory for size rows in every column
+    void                     reserve      (size_t size);
+    // Removes all the rows
+    void                     clear        ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back    (const Quote& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                     push_back    (const Quote::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                      operator[]   (size_t index)                  const;
+
+    // Column of the data field bid
+    const std::vector<long>& bid          ()                              const;
+
+    // Column of the data field ask
+    const std::vector<long>& ask          ()                              const;
+
+private:
+    // column of the data field bid
+    std::vector<long> mBid;
+    // column of the data field ask
+    std::vector<long> mAsk;
+};
+
+}
+
+#endif // __STRUCTURE_COLUMNS_COMPIL_H_
+
@@ -0,0 +1,39 @@
+#ifndef __STRUCTURE_FIELD_OVERRIDE_COMPIL__FWD_H_
+#define __STRUCTURE_FIELD_OVERRIDE_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace override
+{
+
+// Forward declarations
+class Structure1;
+typedef Structure1*                         Structure1RPtr;
+typedef boost::shared_ptr<Structure1>       Structure1SPtr;
+typedef boost::shared_ptr<const Structure1> Structure1SCPtr;
+typedef boost::weak_ptr<Structure1>         Structure1WPtr;
+
+class HoldStructure1;
+typedef HoldStructure1*                         HoldStructure1RPtr;
+typedef boost::shared_ptr<HoldStructure1>       HoldStructure1SPtr;
+typedef boost::shared_ptr<const HoldStructure1> HoldStructure1SCPtr;
+typedef boost::weak_ptr<HoldStructure1>         HoldStructure1WPtr;
+
+class Structure2;
+typedef Structure2*                         Structure2RPtr;
+typedef boost::shared_ptr<Structure2>       Structure2SPtr;
+typedef boost::shared_ptr<const Structure2> Structure2SCPtr;
+typedef boost::weak_ptr<Structure2>         Structure2WPtr;
+
+class HoldStructure2;
+typedef HoldStructure2*                         HoldStructure2RPtr;
+typedef boost::shared_ptr<HoldStructure2>       HoldStructure2SPtr;
+typedef boost::shared_ptr<const HoldStructure2> HoldStructure2SCPtr;
+typedef boost::weak_ptr<HoldStructure2>         HoldStructure2WPtr;
+
+}
+
+#endif // __STRUCTURE_FIELD_OVERRIDE_COMPIL__FWD_H_
+
@@ -0,0 +1,44 @@
+#include "structure/field_override.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace override
+{
+
+TEST(StructureStructure1Test, available_DefaultValues)
+{
+    Structure1 structure1;
+}
+
+
+TEST(StructureHoldStructure1Test, available_DefaultValues)
+{
+    HoldStructure1 structure1;
+    ASSERT_FALSE(structure1.valid_s());
+}
+
+TEST(StructureHoldStructure1Test, negativeBuild)
+{
+    HoldStructure1::Builder builder;
+    ASSERT_THROW(builder.build(), boost::assert_exception);
+    ASSERT_THROW(builder.finalize(), boost::assert_exception);
+}
+
+
+TEST(StructureStructure2Test, available_DefaultValues)
+{
+    Structure2 structure1;
+}
+
+
+TEST(StructureHoldStructure2Test, available_DefaultValues)
+{
+    HoldStructure2 structure1;
+    ASSERT_FALSE(structure1.valid_s());
+}
+
+
+}
+
@@ -0,0 +1,396 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "structure/field_override.h"
+// Standard C Library
+#include <stddef.h>
+
+namespace override
+{
+
+Structure1::Builder::Builder()
+        : mpObject(new Structure1())
+{
+}
+
+Structure1::Builder::Builder(const Structure1& object)
+        : mpObject(new Structure1())
+{
+    *(Structure1*)mpObject = object;
+}
+
+Structure1::Builder::Builder(Structure1RPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Structure1::Builder::~Builder()
+{
+    delete (Structure1RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Structure1& Structure1::Builder::build() const
+{
+    BOOST_ASSERT(mpObject->isInitialized());
+    return *(Structure1RPtr)mpObject;
+}
+
+Structure1SPtr Structure1::Builder::finalize()
+{
+    BOOST_ASSERT(mpObject->isInitialized());
+    Structure1RPtr objectRPtr = (Structure1RPtr)mpObject;
+    mpObject = NULL;
+    return Structure1SPtr(objectRPtr);
+}
+
+Structure1::Structure1()
+{
+}
+
+Structure1::~Structure1()
+{
+}
+
+bool Structure1::isInitialized() const
+{
+    return true;
+}
+
+int HoldStructure1::bitmask_s()
+{
+    return 0x1;
+}
+
+HoldStructure1::Builder::Builder()
+        : mpObject(new HoldStructure1())
+{
+}
+
+HoldStructure1::Builder::Builder(const HoldStructure1& object)
+        : mpObject(new HoldStructure1())
+{
+    *(HoldStructure1*)mpObject = object;
+}
+
+HoldStructure1::Builder::Builder(HoldStructure1RPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+HoldStructure1::Builder::~Builder()
+{
+    delete (HoldStructure1RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const HoldStructure1& HoldStructure1::Builder::build() const
+{
+    BOOST_ASSERT(mpObject->isInitialized());
+    return *(HoldStructure1RPtr)mpObject;
+}
+
+HoldStructure1SPtr HoldStructure1::Builder::finalize()
+{
+    BOOST_ASSERT(mpObject->isInitialized());
+    HoldStructure1RPtr objectRPtr = (HoldStructure1RPtr)mpObject;
+    mpObject = NULL;
+    return HoldStructure1SPtr(objectRPtr);
+}
+
+HoldStructure1::HoldStructure1()
+        : mBits(0)
+{
+}
+
+HoldStructure1::~HoldStructure1()
+{
+}
+
+bool HoldStructure1::isInitialized() const
+{
+    if (!valid_s()) return false;
+    return true;
+}
+
+const Structure1SPtr& HoldStructure1::s() const
+{
+    BOOST_ASSERT(valid_s());
+    return mS;
+}
+
+bool HoldStructure1::valid_s() const
+{
+    return (mBits & bitmask_s()) != 0;
+}
+
+HoldStructure1::Builder& HoldStructure1::Builder::set_s(const Structure1SPtr& s)
+{
+    mpObject->mS     = s;
+    mpObject->mBits |= bitmask_s();
+    return *this;
+}
+
+void HoldStructure1::Builder::erase_s()
+{
+    mpObject->mS.reset();
+    mpObject->mBits &= ~bitmask_s();
+}
+
+HoldStructure1Columns::Row::Row(const HoldStructure1Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+const Structure1SPtr& HoldStructure1Columns::Row::s() const
+{
+    return mColumns.s()[mIndex];
+}
+
+bool HoldStructure1Columns::Row::valid_s() const
+{
+    return mColumns.valid_s()[mIndex];
+}
+
+HoldStructure1Columns::HoldStructure1Columns()
+{
+}
+
+HoldStructure1Columns::~HoldStructure1Columns()
+{
+}
+
+size_t HoldStructure1Columns::size() const
+{
+    return mS.size();
+}
+
+bool HoldStructure1Columns::empty() const
+{
+    return mS.empty();
+}
+
+void HoldStructure1Columns::reserve(size_t size)
+{
+    mS.reserve(size);
+    mSAvailability.reserve(size);
+}
+
+void HoldStructure1Columns::clear()
+{
+    mS.clear();
+    mSAvailability.clear();
+}
+
+void HoldStructure1Columns::push_back(const HoldStructure1& object)
+{
+    mSAvailability.push_back(object.valid_s());
+    if (mSAvailability.back())
+        mS.push_back(object.s());
+    else
+        mS.resize(mS.size() + 1);
+}
+
+void HoldStructure1Columns::push_back(const HoldStructure1::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+HoldStructure1Columns::Row HoldStructure1Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<Structure1SPtr>& HoldStructure1Columns::s() const
+{
+    return mS;
+}
+
+const std::vector<bool>& HoldStructure1Columns::valid_s() const
+{
+    return mSAvailability;
+}
+
+Structure2::Builder::Builder()
+        : Structure1::Builder(new Structure2())
+{
+}
+
+Structure2::Builder::Builder(const Structure2& object)
+        : Structure1::Builder(new Structure2())
+{
+    *(Structure2*)mpObject = object;
+}
+
+Structure2::Builder::Builder(Structure2RPtr pObject)
+        : Structure1::Builder(pObject)
+{
+}
+
+Structure2::Builder::~Builder()
+{
+    delete (Structure2RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Structure2& Structure2::Builder::build() const
+{
+    return *(Structure2RPtr)mpObject;
+}
+
+Structure2SPtr Structure2::Builder::finalize()
+{
+    Structure2RPtr objectRPtr = (Structure2RPtr)mpObject;
+    mpObject = NULL;
+    return Structure2SPtr(objectRPtr);
+}
+
+Structure2::Structure2()
+{
+}
+
+Structure2::~Structure2()
+{
+}
+
+Structure2SPtr Structure2::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2>(object);
+}
+
+HoldStructure2::Builder::Builder()
+        : HoldStructure1::Builder(new HoldStructure2())
+{
+}
+
+HoldStructure2::Builder::Builder(const HoldStructure2& object)
+        : HoldStructure1::Builder(new HoldStructure2())
+{
+    *(HoldStructure2*)mpObject = object;
+}
+
+HoldStructure2::Builder::Builder(HoldStructure2RPtr pObject)
+        : HoldStructure1::Builder(pObject)
+{
+}
+
+HoldStructure2::Builder::~Builder()
+{
+    delete (HoldStructure2RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const HoldStructure2& HoldStructure2::Builder::build() const
+{
+    return *(HoldStructure2RPtr)mpObject;
+}
+
+HoldStructure2SPtr HoldStructure2::Builder::finalize()
+{
+    HoldStructure2RPtr objectRPtr = (HoldStructure2RPtr)mpObject;
+    mpObject = NULL;
+    return HoldStructure2SPtr(objectRPtr);
+}
+
+HoldStructure2::HoldStructure2()
+{
+}
+
+HoldStructure2::~HoldStructure2()
+{
+}
+
+HoldStructure2SPtr HoldStructure2::downcast(const HoldStructure1SPtr& object)
+{
+    return boost::static_pointer_cast<HoldStructure2>(object);
+}
+
+Structure2SPtr HoldStructure2::s() const
+{
+    return boost::static_pointer_cast<Structure2>(HoldStructure1::s());
+}
+
+HoldStructure2::Builder& HoldStructure2::Builder::set_s(const Structure2SPtr& s)
+{
+    HoldStructure1::Builder::set_s(s);
+    return *this;
+}
+
+HoldStructure2Columns::Row::Row(const HoldStructure2Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+const Structure1SPtr& HoldStructure2Columns::Row::s() const
+{
+    return mColumns.s()[mIndex];
+}
+
+bool HoldStructure2Columns::Row::valid_s() const
+{
+    return mColumns.valid_s()[mIndex];
+}
+
+HoldStructure2Columns::HoldStructure2Columns()
+{
+}
+
+HoldStructure2Columns::~HoldStructure2Columns()
+{
+}
+
+size_t HoldStructure2Columns::size() const
+{
+    return mS.size();
+}
+
+bool HoldStructure2Columns::empty() const
+{
+    return mS.empty();
+}
+
+void HoldStructure2Columns::reserve(size_t size)
+{
+    mS.reserve(size);
+    mSAvailability.reserve(size);
+}
+
+void HoldStructure2Columns::clear()
+{
+    mS.clear();
+    mSAvailability.clear();
+}
+
+void HoldStructure2Columns::push_back(const HoldStructure2& object)
+{
+    mSAvailability.push_back(object.valid_s());
+    if (mSAvailability.back())
+        mS.push_back(object.s());
+    else
+        mS.resize(mS.size() + 1);
+}
+
+void HoldStructure2Columns::push_back(const HoldStructure2::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+HoldStructure2Columns::Row HoldStructure2Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<Structure1SPtr>& HoldStructure2Columns::s() const
+{
+    return mS;
+}
+
+const std::vector<bool>& HoldStructure2Columns::valid_s() const
+{
+    return mSAvailability;
+}
+
+}
+
@@ -0,0 +1,430 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <vector>
+
+#ifndef __STRUCTURE_FIELD_OVERRIDE_COMPIL_H_
+#define __STRUCTURE_FIELD_OVERRIDE_COMPIL_H_
+
+#include "structure/field_override-fwd.h"
+
+template<class T> class snapshot;
+
+namespace override
+{
+
+// Structure1 is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Structure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void              operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                  Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                  Builder  (const Structure1& object);
+        // Destructor of Builder
+        /*lax*/                   ~Builder ();
+
+        // Instantiates Structure1 instance with the current initialization
+        // of the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Structure1& build    ()                         const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                Structure1SPtr    finalize ();
+
+
+    protected:
+        // constructor needed from potential derived classes
+                                  Builder  (Structure1RPtr pObject);
+
+        Structure1RPtr mpObject;
+    };
+
+    // Default constructor
+                 Structure1   ();
+    // Destructor
+    /*lax*/      ~Structure1  ();
+
+    // Returns true if every required field is initialized.
+    // Note: If the class is used properly it should always return true,
+    // because the object could be instantiated only if it is already
+    // initialized and can not be changed. Called by the Builder class.
+            bool isInitialized() const;
+};
+
+// Holder of the current Structure1 shared between threads. The readers get
+// the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Structure1> Structure1Snapshot;
+
+// HoldStructure1 is an immutable class - once instantiated none of the
+// data fields can be changed. For the initial initialization and
+// instantiation use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class HoldStructure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                  operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                      Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                      Builder  (const HoldStructure1& object);
+        // Destructor of Builder
+        /*lax*/                       ~Builder ();
+
+        // Instantiates HoldStructure1 instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const HoldStructure1& build    ()                             const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                HoldStructure1SPtr    finalize ();
+
+
+        // Setter method for the data field s
+                Builder&              set_s    (const Structure1SPtr& s);
+        // Erases the required data field s. Object can not be instantiated
+        // before the field data is set again
+                void                  erase_s  ();
+
+    protected:
+        // constructor needed from potential derived classes
+                                      Builder  (HoldStructure1RPtr pObject);
+
+        HoldStructure1RPtr mpObject;
+    };
+
+    // Default constructor
+                                  HoldStructure1 ();
+    // Destructor
+    /*lax*/                       ~HoldStructure1();
+
+    // Returns true if every required field is initialized.
+    // Note: If the class is used properly it should always return true,
+    // because the object could be instantiated only if it is already
+    // initialized and can not be changed. Called by the Builder class.
+            bool                  isInitialized  () const;
+
+    // Getter method for the data field s
+            const Structure1SPtr& s              () const;
+    // Returns true if the data field s was set and could be considered
+    // valid
+    // Note: If the class is used properly it should always return true. It
+    // makes sense when it is called indirectly through isInitialized()
+    // from the Builder class
+            bool                  valid_s        () const;
+
+private:
+    // Returns unique bitmask value for the field s
+    static int bitmask_s();
+
+    // Stores availability information for the fields
+    int            mBits;
+
+    // variable for the data field s
+    Structure1SPtr mS;
+};
+
+// Holder of the current HoldStructure1 shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<HoldStructure1> HoldStructure1Snapshot;
+
+// HoldStructure1Columns holds HoldStructure1 objects column by column -
+// one contiguous array per data field. Use it for large collections that
+// are scanned one or two fields at a time. Such scan touches only the
+// memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class HoldStructure1Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                           Row    (const HoldStructure1Columns& columns, size_t index);
+
+        // Getter method for the data field s
+                                     const Structure1SPtr& s      ()                                                   const;
+        // Returns true if the data field s is available in the row
+                                     bool                  valid_s()                                                   const;
+    private:
+        const HoldStructure1Columns& mColumns;
+        size_t                       mIndex;
+    };
+
+    // Default constructor
+                                       HoldStructure1Columns ();
+    // Destructor
+                                       ~HoldStructure1Columns();
+
+    // Returns the number of the rows
+    size_t                             size                  ()                                       const;
+    // Returns true if there are no rows
+    bool                               empty                 ()                                       const;
+    // Reserves memory for size rows in every column
+    void                               reserve               (size_t size);
+    // Removes all the rows
+    void                               clear                 ();
+
+    // Appends a row with the data fields of the object
+    void                               push_back             (const HoldStructure1& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                               push_back             (const HoldStructure1::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                                operator[]            (size_t index)                           const;
+
+    // Column of the data field s
+    const std::vector<Structure1SPtr>& s                     ()                                       const;
+    // Availability bitmap of the data field s
+    const std::vector<bool>&           valid_s               ()                                       const;
+
+private:
+    // column of the data field s
+    std::vector<Structure1SPtr> mS;
+    // availability bitmap of the data field s
+    std::vector<bool>           mSAvailability;
+};
+
+// Structure2 is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Structure2 : public Structure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder : public Structure1::Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void              operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                  Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                  Builder  (const Structure2& object);
+        // Destructor of Builder
+        /*lax*/                   ~Builder ();
+
+        // Instantiates Structure2 instance with the current initialization
+        // of the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Structure2& build    ()                         const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                Structure2SPtr    finalize ();
+
+
+    protected:
+        // constructor needed from potential derived classes
+                                  Builder  (Structure2RPtr pObject);
+    };
+
+    // Default constructor
+                           Structure2 ();
+    // Destructor
+    /*lax*/                ~Structure2();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2SPtr downcast   (const Structure1SPtr& object);
+};
+
+// Holder of the current Structure2 shared between threads. The readers get
+// the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Structure2> Structure2Snapshot;
+
+// HoldStructure2 is an immutable class - once instantiated none of the
+// data fields can be changed. For the initial initialization and
+// instantiation use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class HoldStructure2 : public HoldStructure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder : public HoldStructure1::Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                  operator=(const Builder& );
+
+        // Hide setter method for the data field s, no implementation
+                Builder&              set_s    (const Structure1SPtr& s);
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                      Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                      Builder  (const HoldStructure2& object);
+        // Destructor of Builder
+        /*lax*/                       ~Builder ();
+
+        // Instantiates HoldStructure2 instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const HoldStructure2& build    ()                             const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                HoldStructure2SPtr    finalize ();
+
+
+        // Override setter method for the data field s
+                Builder&              set_s    (const Structure2SPtr& s);
+
+    protected:
+        // constructor needed from potential derived classes
+                                      Builder  (HoldStructure2RPtr pObject);
+    };
+
+    // Default constructor
+                               HoldStructure2 ();
+    // Destructor
+    /*lax*/                    ~HoldStructure2();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  HoldStructure2SPtr downcast       (const HoldStructure1SPtr& object);
+
+    // Override getter method for the data field s
+            Structure2SPtr     s              ()                                 const;
+};
+
+// Holder of the current HoldStructure2 shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<HoldStructure2> HoldStructure2Snapshot;
+
+// HoldStructure2Columns holds HoldStructure2 objects column by column -
+// one contiguous array per data field. Use it for large collections that
+// are scanned one or two fields at a time. Such scan touches only the
+// memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class HoldStructure2Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                           Row    (const HoldStructure2Columns& columns, size_t index);
+
+        // Getter method for the data field s
+                                     const Structure1SPtr& s      ()                                                   const;
+        // Returns true if the data field s is available in the row
+                                     bool                  valid_s()                                                   const;
+    private:
+        const HoldStructure2Columns& mColumns;
+        size_t                       mIndex;
+    };
+
+    // Default constructor
+                                       HoldStructure2Columns ();
+    // Destructor
+                                       ~HoldStructure2Columns();
+
+    // Returns the number of the rows
+    size_t                             size                  ()                                       const;
+    // Returns true if there are no rows
+    bool                               empty                 ()                                       const;
+    // Reserves memory for size rows in every column
+    void                               reserve               (size_t size);
+    // Removes all the rows
+    void                               clear                 ();
+
+    // Appends a row with the data fields of the object
+    void                               push_back             (const HoldStructure2& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                               push_back             (const HoldStructure2::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                                operator[]            (size_t index)                           const;
+
+    // Column of the data field s
+    const std::vector<Structure1SPtr>& s                     ()                                       const;
+    // Availability bitmap of the data field s
+    const std::vector<bool>&           valid_s               ()                                       const;
+
+private:
+    // column of the data field s
+    std::vector<Structure1SPtr> mS;
+    // availability bitmap of the data field s
+    std::vector<bool>           mSAvailability;
+};
+
+}
+
+#endif // __STRUCTURE_FIELD_OVERRIDE_COMPIL_H_
+
@@ -0,0 +1,1341 @@
+#include "structure/from_string.h"
+// Compil C++ core
+#include <core/platform/benchmark.h>
+// Google Test framework
+#include <gtest/gtest.h>
+// Standard C Library
+#include <string.h>
+
+namespace from_string
+{
+
+static const char* namesColor[] =
+{
+    "invalid",
+    "red",
+    "green",
+    "blue",
+};
+
+static EColor linearFromStringColor(const char* name)
+{
+    if (strcmp(name, "invalid") == 0) return EColor::invalid();
+    if (strcmp(name, "red") == 0) return EColor::red();
+    if (strcmp(name, "green") == 0) return EColor::green();
+    if (strcmp(name, "blue") == 0) return EColor::blue();
+    return EColor();
+}
+
+TEST(ColorBenchmark, fromString)
+{
+    size_t count = sizeof(namesColor) / sizeof(const char*);
+    size_t index = 0;
+    plt::Benchmark benchmark("structure/from_string.Color.fromString");
+    while (benchmark.running())
+    {
+        const char* name = namesColor[index++ % count];
+        size_t size = strlen(name);
+        benchmark.consume(EColor::fromString(name, size));
+    }
+}
+
+TEST(ColorBenchmark, linearFromString)
+{
+    size_t count = sizeof(namesColor) / sizeof(const char*);
+    size_t index = 0;
+    plt::Benchmark benchmark("structure/from_string.Color.linearFromString");
+    while (benchmark.running())
+    {
+        const char* name = namesColor[index++ % count];
+        size_t size = strlen(name);
+        benchmark.consume(size);
+        benchmark.consume(linearFromStringColor(name));
+    }
+}
+
+static const char* namesPermission[] =
+{
+    "nil",
+    "read",
+    "write",
+    "execute",
+    "all",
+};
+
+static EPermission linearFromStringPermission(const char* name)
+{
+    if (strcmp(name, "nil") == 0) return EPermission::nil();
+    if (strcmp(name, "read") == 0) return EPermission::read();
+    if (strcmp(name, "write") == 0) return EPermission::write();
+    if (strcmp(name, "execute") == 0) return EPermission::execute();
+    if (strcmp(name, "all") == 0) return EPermission::all();
+    return EPermission();
+}
+
+TEST(PermissionBenchmark, fromString)
+{
+    size_t count = sizeof(namesPermission) / sizeof(const char*);
+    size_t index = 0;
+    plt::Benchmark benchmark("structure/from_string.Permission.fromString");
+    while (benchmark.running())
+    {
+        const char* name = namesPermission[index++ % count];
+        size_t size = strlen(name);
+        benchmark.consume(EPermission::fromString(name, size));
+    }
+}
+
+TEST(PermissionBenchmark, linearFromString)
+{
+    size_t count = sizeof(namesPermission) / sizeof(const char*);
+    size_t index = 0;
+    plt::Benchmark benchmark("structure/from_string.Permission.linearFromString");
+    while (benchmark.running())
+    {
+        const char* name = namesPermission[index++ % count];
+        size_t size = strlen(name);
+        benchmark.consume(size);
+        benchmark.consume(linearFromStringPermission(name));
+    }
+}
+
+static const char* namesPlace[] =
+{
+    "invalid",
+    "amber_anchor",
+    "amber_bridge",
+    "amber_canyon",
+    "amber_delta",
+    "amber_ember",
+    "amber_falcon",
+    "amber_glacier",
+    "amber_harbor",
+    "amber_island",
+    "amber_jungle",
+    "amber_kernel",
+    "amber_lagoon",
+    "amber_meadow",
+    "amber_nebula",
+    "amber_orchard",
+    "amber_prairie",
+    "amber_quarry",
+    "amber_river",
+    "amber_summit",
+    "amber_tundra",
+    "amber_valley",
+    "amber_willow",
+    "amber_yonder",
+    "amber_zenith",
+    "brisk_anchor",
+    "brisk_bridge",
+    "brisk_canyon",
+    "brisk_delta",
+    "brisk_ember",
+    "brisk_falcon",
+    "brisk_glacier",
+    "brisk_harbor",
+    "brisk_island",
+    "brisk_jungle",
+    "brisk_kernel",
+    "brisk_lagoon",
+    "brisk_meadow",
+    "brisk_nebula",
+    "brisk_orchard",
+    "brisk_prairie",
+    "brisk_quarry",
+    "brisk_river",
+    "brisk_summit",
+    "brisk_tundra",
+    "brisk_valley",
+    "brisk_willow",
+    "brisk_yonder",
+    "brisk_zenith",
+    "coral_anchor",
+    "coral_bridge",
+    "coral_canyon",
+    "coral_delta",
+    "coral_ember",
+    "coral_falcon",
+    "coral_glacier",
+    "coral_harbor",
+    "coral_island",
+    "coral_jungle",
+    "coral_kernel",
+    "coral_lagoon",
+    "coral_meadow",
+    "coral_nebula",
+    "coral_orchard",
+    "coral_prairie",
+    "coral_quarry",
+    "coral_river",
+    "coral_summit",
+    "coral_tundra",
+    "coral_valley",
+    "coral_willow",
+    "coral_yonder",
+    "coral_zenith",
+    "dusty_anchor",
+    "dusty_bridge",
+    "dusty_canyon",
+    "dusty_delta",
+    "dusty_ember",
+    "dusty_falcon",
+    "dusty_glacier",
+    "dusty_harbor",
+    "dusty_island",
+    "dusty_jungle",
+    "dusty_kernel",
+    "dusty_lagoon",
+    "dusty_meadow",
+    "dusty_nebula",
+    "dusty_orchard",
+    "dusty_prairie",
+    "dusty_quarry",
+    "dusty_river",
+    "dusty_summit",
+    "dusty_tundra",
+    "dusty_valley",
+    "dusty_willow",
+    "dusty_yonder",
+    "dusty_zenith",
+    "early_anchor",
+    "early_bridge",
+    "early_canyon",
+    "early_delta",
+    "early_ember",
+    "early_falcon",
+    "early_glacier",
+    "early_harbor",
+    "early_island",
+    "early_jungle",
+    "early_kernel",
+    "early_lagoon",
+    "early_meadow",
+    "early_nebula",
+    "early_orchard",
+    "early_prairie",
+    "early_quarry",
+    "early_river",
+    "early_summit",
+    "early_tundra",
+    "early_valley",
+    "early_willow",
+    "early_yonder",
+    "early_zenith",
+    "faint_anchor",
+    "faint_bridge",
+    "faint_canyon",
+    "faint_delta",
+    "faint_ember",
+    "faint_falcon",
+    "faint_glacier",
+    "faint_harbor",
+    "faint_island",
+    "faint_jungle",
+    "faint_kernel",
+    "faint_lagoon",
+    "faint_meadow",
+    "faint_nebula",
+    "faint_orchard",
+    "faint_prairie",
+    "faint_quarry",
+    "faint_river",
+    "faint_summit",
+    "faint_tundra",
+    "faint_valley",
+    "faint_willow",
+    "faint_yonder",
+    "faint_zenith",
+    "giant_anchor",
+    "giant_bridge",
+    "giant_canyon",
+    "giant_delta",
+    "giant_ember",
+    "giant_falcon",
+    "giant_glacier",
+    "giant_harbor",
+    "giant_island",
+    "giant_jungle",
+    "giant_kernel",
+    "giant_lagoon",
+    "giant_meadow",
+    "giant_nebula",
+    "giant_orchard",
+    "giant_prairie",
+    "giant_quarry",
+    "giant_river",
+    "giant_summit",
+    "giant_tundra",
+    "giant_valley",
+    "giant_willow",
+    "giant_yonder",
+    "giant_zenith",
+    "hollow_anchor",
+    "hollow_bridge",
+    "hollow_canyon",
+    "hollow_delta",
+    "hollow_ember",
+    "hollow_falcon",
+    "hollow_glacier",
+    "hollow_harbor",
+    "hollow_island",
+    "hollow_jungle",
+    "hollow_kernel",
+    "hollow_lagoon",
+    "hollow_meadow",
+    "hollow_nebula",
+    "hollow_orchard",
+    "hollow_prairie",
+    "hollow_quarry",
+    "hollow_river",
+    "hollow_summit",
+    "hollow_tundra",
+    "hollow_valley",
+    "hollow_willow",
+    "hollow_yonder",
+    "hollow_zenith",
+    "ivory_anchor",
+    "ivory_bridge",
+    "ivory_canyon",
+    "ivory_delta",
+    "ivory_ember",
+    "ivory_falcon",
+    "ivory_glacier",
+    "ivory_harbor",
+    "ivory_island",
+    "ivory_jungle",
+    "ivory_kernel",
+    "ivory_lagoon",
+    "ivory_meadow",
+    "ivory_nebula",
+    "ivory_orchard",
+    "ivory_prairie",
+    "ivory_quarry",
+    "ivory_river",
+    "ivory_summit",
+    "ivory_tundra",
+    "ivory_valley",
+    "ivory_willow",
+    "ivory_yonder",
+    "ivory_zenith",
+    "jolly_anchor",
+    "jolly_bridge",
+    "jolly_canyon",
+    "jolly_delta",
+    "jolly_ember",
+    "jolly_falcon",
+    "jolly_glacier",
+    "jolly_harbor",
+    "jolly_island",
+    "jolly_jungle",
+    "jolly_kernel",
+    "jolly_lagoon",
+    "jolly_meadow",
+    "jolly_nebula",
+    "jolly_orchard",
+    "jolly_prairie",
+    "jolly_quarry",
+    "jolly_river",
+    "jolly_summit",
+    "jolly_tundra",
+    "jolly_valley",
+    "jolly_willow",
+    "jolly_yonder",
+    "jolly_zenith",
+    "keen_anchor",
+    "keen_bridge",
+    "keen_canyon",
+    "keen_delta",
+    "keen_ember",
+    "keen_falcon",
+    "keen_glacier",
+    "keen_harbor",
+    "keen_island",
+    "keen_jungle",
+    "keen_kernel",
+    "keen_lagoon",
+    "keen_meadow",
+    "keen_nebula",
+    "keen_orchard",
+    "keen_prairie",
+    "keen_quarry",
+    "keen_river",
+    "keen_summit",
+    "keen_tundra",
+    "keen_valley",
+    "keen_willow",
+    "keen_yonder",
+    "keen_zenith",
+    "lunar_anchor",
+    "lunar_bridge",
+    "lunar_canyon",
+    "lunar_delta",
+    "lunar_ember",
+    "lunar_falcon",
+    "lunar_glacier",
+    "lunar_harbor",
+    "lunar_island",
+    "lunar_jungle",
+    "lunar_kernel",
+    "lunar_lagoon",
+    "lunar_meadow",
+    "lunar_nebula",
+    "lunar_orchard",
+    "lunar_prairie",
+    "lunar_quarry",
+    "lunar_river",
+    "lunar_summit",
+    "lunar_tundra",
+    "lunar_valley",
+    "lunar_willow",
+    "lunar_yonder",
+    "lunar_zenith",
+    "misty_anchor",
+    "misty_bridge",
+    "misty_canyon",
+    "misty_delta",
+    "misty_ember",
+    "misty_falcon",
+    "misty_glacier",
+    "misty_harbor",
+    "misty_island",
+    "misty_jungle",
+    "misty_kernel",
+    "misty_lagoon",
+    "misty_meadow",
+    "misty_nebula",
+    "misty_orchard",
+    "misty_prairie",
+    "misty_quarry",
+    "misty_river",
+    "misty_summit",
+    "misty_tundra",
+    "misty_valley",
+    "misty_willow",
+    "misty_yonder",
+    "misty_zenith",
+    "noble_anchor",
+    "noble_bridge",
+    "noble_canyon",
+    "noble_delta",
+    "noble_ember",
+    "noble_falcon",
+    "noble_glacier",
+    "noble_harbor",
+    "noble_island",
+    "noble_jungle",
+    "noble_kernel",
+    "noble_lagoon",
+    "noble_meadow",
+    "noble_nebula",
+    "noble_orchard",
+    "noble_prairie",
+    "noble_quarry",
+    "noble_river",
+    "noble_summit",
+    "noble_tundra",
+    "noble_valley",
+    "noble_willow",
+    "noble_yonder",
+    "noble_zenith",
+    "olive_anchor",
+    "olive_bridge",
+    "olive_canyon",
+    "olive_delta",
+    "olive_ember",
+    "olive_falcon",
+    "olive_glacier",
+    "olive_harbor",
+    "olive_island",
+    "olive_jungle",
+    "olive_kernel",
+    "olive_lagoon",
+    "olive_meadow",
+    "olive_nebula",
+    "olive_orchard",
+    "olive_prairie",
+    "olive_quarry",
+    "olive_river",
+    "olive_summit",
+    "olive_tundra",
+    "olive_valley",
+    "olive_willow",
+    "olive_yonder",
+    "olive_zenith",
+    "prime_anchor",
+    "prime_bridge",
+    "prime_canyon",
+    "prime_delta",
+    "prime_ember",
+    "prime_falcon",
+    "prime_glacier",
+    "prime_harbor",
+    "prime_island",
+    "prime_jungle",
+    "prime_kernel",
+    "prime_lagoon",
+    "prime_meadow",
+    "prime_nebula",
+    "prime_orchard",
+    "prime_prairie",
+    "prime_quarry",
+    "prime_river",
+    "prime_summit",
+    "prime_tundra",
+    "prime_valley",
+    "prime_willow",
+    "prime_yonder",
+    "prime_zenith",
+    "quiet_anchor",
+    "quiet_bridge",
+    "quiet_canyon",
+    "quiet_delta",
+    "quiet_ember",
+    "quiet_falcon",
+    "quiet_glacier",
+    "quiet_harbor",
+    "quiet_island",
+    "quiet_jungle",
+    "quiet_kernel",
+    "quiet_lagoon",
+    "quiet_meadow",
+    "quiet_nebula",
+    "quiet_orchard",
+    "quiet_prairie",
+    "quiet_quarry",
+    "quiet_river",
+    "quiet_summit",
+    "quiet_tundra",
+    "quiet_valley",
+    "quiet_willow",
+    "quiet_yonder",
+    "quiet_zenith",
+    "rapid_anchor",
+    "rapid_bridge",
+    "rapid_canyon",
+    "rapid_delta",
+    "rapid_ember",
+    "rapid_falcon",
+    "rapid_glacier",
+    "rapid_harbor",
+    "rapid_island",
+    "rapid_jungle",
+    "rapid_kernel",
+    "rapid_lagoon",
+    "rapid_meadow",
+    "rapid_nebula",
+    "rapid_orchard",
+    "rapid_prairie",
+    "rapid_quarry",
+    "rapid_river",
+    "rapid_summit",
+    "rapid_tundra",
+    "rapid_valley",
+    "rapid_willow",
+    "rapid_yonder",
+    "rapid_zenith",
+    "solar_anchor",
+    "solar_bridge",
+    "solar_canyon",
+    "solar_delta",
+    "solar_ember",
+    "solar_falcon",
+    "solar_glacier",
+    "solar_harbor",
+    "solar_island",
+    "solar_jungle",
+    "solar_kernel",
+    "solar_lagoon",
+    "solar_meadow",
+    "solar_nebula",
+    "solar_orchard",
+    "solar_prairie",
+    "solar_quarry",
+    "solar_river",
+    "solar_summit",
+    "solar_tundra",
+    "solar_valley",
+    "solar_willow",
+    "solar_yonder",
+    "solar_zenith",
+    "tidal_anchor",
+    "tidal_bridge",
+    "tidal_canyon",
+    "tidal_delta",
+    "tidal_ember",
+    "tidal_falcon",
+    "tidal_glacier",
+    "tidal_harbor",
+    "tidal_island",
+    "tidal_jungle",
+    "tidal_kernel",
+    "tidal_lagoon",
+    "tidal_meadow",
+    "tidal_nebula",
+    "tidal_orchard",
+    "tidal_prairie",
+    "tidal_quarry",
+    "tidal_river",
+    "tidal_summit",
+    "tidal_tundra",
+    "tidal_valley",
+    "tidal_willow",
+    "tidal_yonder",
+    "tidal_zenith",
+    "urban_anchor",
+    "urban_bridge",
+    "urban_canyon",
+    "urban_delta",
+    "urban_ember",
+    "urban_falcon",
+    "urban_glacier",
+    "urban_harbor",
+    "urban_island",
+    "urban_jungle",
+    "urban_kernel",
+    "urban_lagoon",
+    "urban_meadow",
+    "urban_nebula",
+    "urban_orchard",
+    "urban_prairie",
+    "urban_quarry",
+    "urban_river",
+    "urban_summit",
+    "urban_tundra",
+    "urban_valley",
+    "urban_willow",
+    "urban_yonder",
+    "urban_zenith",
+    "vivid_anchor",
+    "vivid_bridge",
+    "vivid_canyon",
+    "vivid_delta",
+    "vivid_ember",
+    "vivid_falcon",
+    "vivid_glacier",
+    "vivid_harbor",
+    "vivid_island",
+    "vivid_jungle",
+    "vivid_kernel",
+    "vivid_lagoon",
+    "vivid_meadow",
+    "vivid_nebula",
+    "vivid_orchard",
+    "vivid_prairie",
+    "vivid_quarry",
+    "vivid_river",
+    "vivid_summit",
+    "vivid_tundra",
+    "vivid_valley",
+    "vivid_willow",
+    "vivid_yonder",
+    "vivid_zenith",
+    "windy_anchor",
+    "windy_bridge",
+    "windy_canyon",
+    "windy_delta",
+    "windy_ember",
+    "windy_falcon",
+    "windy_glacier",
+    "windy_harbor",
+    "windy_island",
+    "windy_jungle",
+    "windy_kernel",
+    "windy_lagoon",
+    "windy_meadow",
+    "windy_nebula",
+    "windy_orchard",
+    "windy_prairie",
+    "windy_quarry",
+    "windy_river",
+    "windy_summit",
+    "windy_tundra",
+    "windy_valley",
+    "windy_willow",
+    "windy_yonder",
+    "windy_zenith",
+    "young_anchor",
+    "young_bridge",
+    "young_canyon",
+    "young_delta",
+    "young_ember",
+    "young_falcon",
+    "young_glacier",
+    "young_harbor",
+    "young_island",
+    "young_jungle",
+    "young_kernel",
+    "young_lagoon",
+    "young_meadow",
+    "young_nebula",
+    "young_orchard",
+    "young_prairie",
+    "young_quarry",
+    "young_river",
+    "young_summit",
+    "young_tundra",
+    "young_valley",
+    "young_willow",
+    "young_yonder",
+    "young_zenith",
+    "zonal_anchor",
+    "zonal_bridge",
+    "zonal_canyon",
+    "zonal_delta",
+    "zonal_ember",
+    "zonal_falcon",
+    "zonal_glacier",
+    "zonal_harbor",
+    "zonal_island",
+    "zonal_jungle",
+    "zonal_kernel",
+    "zonal_lagoon",
+    "zonal_meadow",
+    "zonal_nebula",
+    "zonal_orchard",
+    "zonal_prairie",
+    "zonal_quarry",
+    "zonal_river",
+    "zonal_summit",
+    "zonal_tundra",
+    "zonal_valley",
+    "zonal_willow",
+    "zonal_yonder",
+    "zonal_zenith",
+};
+
+static EPlace linearFromStringPlace(const char* name)
+{
+    if (strcmp(name, "invalid") == 0) return EPlace::invalid();
+    if (strcmp(name, "amber_anchor") == 0) return EPlace::amber_anchor();
+    if (strcmp(name, "amber_bridge") == 0) return EPlace::amber_bridge();
+    if (strcmp(name, "amber_canyon") == 0) return EPlace::amber_canyon();
+    if (strcmp(name, "amber_delta") == 0) return EPlace::amber_delta();
+    if (strcmp(name, "amber_ember") == 0) return EPlace::amber_ember();
+    if (strcmp(name, "amber_falcon") == 0) return EPlace::amber_falcon();
+    if (strcmp(name, "amber_glacier") == 0) return EPlace::amber_glacier();
+    if (strcmp(name, "amber_harbor") == 0) return EPlace::amber_harbor();
+    if (strcmp(name, "amber_island") == 0) return EPlace::amber_island();
+    if (strcmp(name, "amber_jungle") == 0) return EPlace::amber_jungle();
+    if (strcmp(name, "amber_kernel") == 0) return EPlace::amber_kernel();
+    if (strcmp(name, "amber_lagoon") == 0) return EPlace::amber_lagoon();
+    if (strcmp(name, "amber_meadow") == 0) return EPlace::amber_meadow();
+    if (strcmp(name, "amber_nebula") == 0) return EPlace::amber_nebula();
+    if (strcmp(name, "amber_orchard") == 0) return EPlace::amber_orchard();
+    if (strcmp(name, "amber_prairie") == 0) return EPlace::amber_prairie();
+    if (strcmp(name, "amber_quarry") == 0) return EPlace::amber_quarry();
+    if (strcmp(name, "amber_river") == 0) return EPlace::amber_river();
+    if (strcmp(name, "amber_summit") == 0) return EPlace::amber_summit();
+    if (strcmp(name, "amber_tundra") == 0) return EPlace::amber_tundra();
+    if (strcmp(name, "amber_valley") == 0) return EPlace::amber_valley();
+    if (strcmp(name, "amber_willow") == 0) return EPlace::amber_willow();
+    if (strcmp(name, "amber_yonder") == 0) return EPlace::amber_yonder();
+    if (strcmp(name, "amber_zenith") == 0) return EPlace::amber_zenith();
+    if (strcmp(name, "brisk_anchor") == 0) return EPlace::brisk_anchor();
+    if (strcmp(name, "brisk_bridge") == 0) return EPlace::brisk_bridge();
+    if (strcmp(name, "brisk_canyon") == 0) return EPlace::brisk_canyon();
+    if (strcmp(name, "brisk_delta") == 0) return EPlace::brisk_delta();
+    if (strcmp(name, "brisk_ember") == 0) return EPlace::brisk_ember();
+    if (strcmp(name, "brisk_falcon") == 0) return EPlace::brisk_falcon();
+    if (strcmp(name, "brisk_glacier") == 0) return EPlace::brisk_glacier();
+    if (strcmp(name, "brisk_harbor") == 0) return EPlace::brisk_harbor();
+    if (strcmp(name, "brisk_island") == 0) return EPlace::brisk_island();
+    if (strcmp(name, "brisk_jungle") == 0) return EPlace::brisk_jungle();
+    if (strcmp(name, "brisk_kernel") == 0) return EPlace::brisk_kernel();
+    if (strcmp(name, "brisk_lagoon") == 0) return EPlace::brisk_lagoon();
+    if (strcmp(name, "brisk_meadow") == 0) return EPlace::brisk_meadow();
+    if (strcmp(name, "brisk_nebula") == 0) return EPlace::brisk_nebula();
+    if (strcmp(name, "brisk_orchard") == 0) return EPlace::brisk_orchard();
+    if (strcmp(name, "brisk_prairie") == 0) return EPlace::brisk_prairie();
+    if (strcmp(name, "brisk_quarry") == 0) return EPlace::brisk_quarry();
+    if (strcmp(name, "brisk_river") == 0) return EPlace::brisk_river();
+    if (strcmp(name, "brisk_summit") == 0) return EPlace::brisk_summit();
+    if (strcmp(name, "brisk_tundra") == 0) return EPlace::brisk_tundra();
+    if (strcmp(name, "brisk_valley") == 0) return EPlace::brisk_valley();
+    if (strcmp(name, "brisk_willow") == 0) return EPlace::brisk_willow();
+    if (strcmp(name, "brisk_yonder") == 0) return EPlace::brisk_yonder();
+    if (strcmp(name, "brisk_zenith") == 0) return EPlace::brisk_zenith();
+    if (strcmp(name, "coral_anchor") == 0) return EPlace::coral_anchor();
+    if (strcmp(name, "coral_bridge") == 0) return EPlace::coral_bridge();
+    if (strcmp(name, "coral_canyon") == 0) return EPlace::coral_canyon();
+    if (strcmp(name, "coral_delta") == 0) return EPlace::coral_delta();
+    if (strcmp(name, "coral_ember") == 0) return EPlace::coral_ember();
+    if (strcmp(name, "coral_falcon") == 0) return EPlace::coral_falcon();
+    if (strcmp(name, "coral_glacier") == 0) return EPlace::coral_glacier();
+    if (strcmp(name, "coral_harbor") == 0) return EPlace::coral_harbor();
+    if (strcmp(name, "coral_island") == 0) return EPlace::coral_island();
+    if (strcmp(name, "coral_jungle") == 0) return EPlace::coral_jungle();
+    if (strcmp(name, "coral_kernel") == 0) return EPlace::coral_kernel();
+    if (strcmp(name, "coral_lagoon") == 0) return EPlace::coral_lagoon();
+    if (strcmp(name, "coral_meadow") == 0) return EPlace::coral_meadow();
+    if (strcmp(name, "coral_nebula") == 0) return EPlace::coral_nebula();
+    if (strcmp(name, "coral_orchard") == 0) return EPlace::coral_orchard();
+    if (strcmp(name, "coral_prairie") == 0) return EPlace::coral_prairie();
+    if (strcmp(name, "coral_quarry") == 0) return EPlace::coral_quarry();
+    if (strcmp(name, "coral_river") == 0) return EPlace::coral_river();
+    if (strcmp(name, "coral_summit") == 0) return EPlace::coral_summit();
+    if (strcmp(name, "coral_tundra") == 0) return EPlace::coral_tundra();
+    if (strcmp(name, "coral_valley") == 0) return EPlace::coral_valley();
+    if (strcmp(name, "coral_willow") == 0) return EPlace::coral_willow();
+    if (strcmp(name, "coral_yonder") == 0) return EPlace::coral_yonder();
+    if (strcmp(name, "coral_zenith") == 0) return EPlace::coral_zenith();
+    if (strcmp(name, "dusty_anchor") == 0) return EPlace::dusty_anchor();
+    if (strcmp(name, "dusty_bridge") == 0) return EPlace::dusty_bridge();
+    if (strcmp(name, "dusty_canyon") == 0) return EPlace::dusty_canyon();
+    if (strcmp(name, "dusty_delta") == 0) return EPlace::dusty_delta();
+    if (strcmp(name, "dusty_ember") == 0) return EPlace::dusty_ember();
+    if (strcmp(name, "dusty_falcon") == 0) return EPlace::dusty_falcon();
+    if (strcmp(name, "dusty_glacier") == 0) return EPlace::dusty_glacier();
+    if (strcmp(name, "dusty_harbor") == 0) return EPlace::dusty_harbor();
+    if (strcmp(name, "dusty_island") == 0) return EPlace::dusty_island();
+    if (strcmp(name, "dusty_jungle") == 0) return EPlace::dusty_jungle();
+    if (strcmp(name, "dusty_kernel") == 0) return EPlace::dusty_kernel();
+    if (strcmp(name, "dusty_lagoon") == 0) return EPlace::dusty_lagoon();
+    if (strcmp(name, "dusty_meadow") == 0) return EPlace::dusty_meadow();
+    if (strcmp(name, "dusty_nebula") == 0) return EPlace::dusty_nebula();
+    if (strcmp(name, "dusty_orchard") == 0) return EPlace::dusty_orchard();
+    if (strcmp(name, "dusty_prairie") == 0) return EPlace::dusty_prairie();
+    if (strcmp(name, "dusty_quarry") == 0) return EPlace::dusty_quarry();
+    if (strcmp(name, "dusty_river") == 0) return EPlace::dusty_river();
+    if (strcmp(name, "dusty_summit") == 0) return EPlace::dusty_summit();
+    if (strcmp(name, "dusty_tundra") == 0) return EPlace::dusty_tundra();
+    if (strcmp(name, "dusty_valley") == 0) return EPlace::dusty_valley();
+    if (strcmp(name, "dusty_willow") == 0) return EPlace::dusty_willow();
+    if (strcmp(name, "dusty_yonder") == 0) return EPlace::dusty_yonder();
+    if (strcmp(name, "dusty_zenith") == 0) return EPlace::dusty_zenith();
+    if (strcmp(name, "early_anchor") == 0) return EPlace::early_anchor();
+    if (strcmp(name, "early_bridge") == 0) return EPlace::early_bridge();
+    if (strcmp(name, "early_canyon") == 0) return EPlace::early_canyon();
+    if (strcmp(name, "early_delta") == 0) return EPlace::early_delta();
+    if (strcmp(name, "early_ember") == 0) return EPlace::early_ember();
+    if (strcmp(name, "early_falcon") == 0) return EPlace::early_falcon();
+    if (strcmp(name, "early_glacier") == 0) return EPlace::early_glacier();
+    if (strcmp(name, "early_harbor") == 0) return EPlace::early_harbor();
+    if (strcmp(name, "early_island") == 0) return EPlace::early_island();
+    if (strcmp(name, "early_jungle") == 0) return EPlace::early_jungle();
+    if (strcmp(name, "early_kernel") == 0) return EPlace::early_kernel();
+    if (strcmp(name, "early_lagoon") == 0) return EPlace::early_lagoon();
+    if (strcmp(name, "early_meadow") == 0) return EPlace::early_meadow();
+    if (strcmp(name, "early_nebula") == 0) return EPlace::early_nebula();
+    if (strcmp(name, "early_orchard") == 0) return EPlace::early_orchard();
+    if (strcmp(name, "early_prairie") == 0) return EPlace::early_prairie();
+    if (strcmp(name, "early_quarry") == 0) return EPlace::early_quarry();
+    if (strcmp(name, "early_river") == 0) return EPlace::early_river();
+    if (strcmp(name, "early_summit") == 0) return EPlace::early_summit();
+    if (strcmp(name, "early_tundra") == 0) return EPlace::early_tundra();
+    if (strcmp(name, "early_valley") == 0) return EPlace::early_valley();
+    if (strcmp(name, "early_willow") == 0) return EPlace::early_willow();
+    if (strcmp(name, "early_yonder") == 0) return EPlace::early_yonder();
+    if (strcmp(name, "early_zenith") == 0) return EPlace::early_zenith();
+    if (strcmp(name, "faint_anchor") == 0) return EPlace::faint_anchor();
+    if (strcmp(name, "faint_bridge") == 0) return EPlace::faint_bridge();
+    if (strcmp(name, "faint_canyon") == 0) return EPlace::faint_canyon();
+    if (strcmp(name, "faint_delta") == 0) return EPlace::faint_delta();
+    if (strcmp(name, "faint_ember") == 0) return EPlace::faint_ember();
+    if (strcmp(name, "faint_falcon") == 0) return EPlace::faint_falcon();
+    if (strcmp(name, "faint_glacier") == 0) return EPlace::faint_glacier();
+    if (strcmp(name, "faint_harbor") == 0) return EPlace::faint_harbor();
+    if (strcmp(name, "faint_island") == 0) return EPlace::faint_island();
+    if (strcmp(name, "faint_jungle") == 0) return EPlace::faint_jungle();
+    if (strcmp(name, "faint_kernel") == 0) return EPlace::faint_kernel();
+    if (strcmp(name, "faint_lagoon") == 0) return EPlace::faint_lagoon();
+    if (strcmp(name, "faint_meadow") == 0) return EPlace::faint_meadow();
+    if (strcmp(name, "faint_nebula") == 0) return EPlace::faint_nebula();
+    if (strcmp(name, "faint_orchard") == 0) return EPlace::faint_orchard();
+    if (strcmp(name, "faint_prairie") == 0) return EPlace::faint_prairie();
+    if (strcmp(name, "faint_quarry") == 0) return EPlace::faint_quarry();
+    if (strcmp(name, "faint_river") == 0) return EPlace::faint_river();
+    if (strcmp(name, "faint_summit") == 0) return EPlace::faint_summit();
+    if (strcmp(name, "faint_tundra") == 0) return EPlace::faint_tundra();
+    if (strcmp(name, "faint_valley") == 0) return EPlace::faint_valley();
+    if (strcmp(name, "faint_willow") == 0) return EPlace::faint_willow();
+    if (strcmp(name, "faint_yonder") == 0) return EPlace::faint_yonder();
+    if (strcmp(name, "faint_zenith") == 0) return EPlace::faint_zenith();
+    if (strcmp(name, "giant_anchor") == 0) return EPlace::giant_anchor();
+    if (strcmp(name, "giant_bridge") == 0) return EPlace::giant_bridge();
+    if (strcmp(name, "giant_canyon") == 0) return EPlace::giant_canyon();
+    if (strcmp(name, "giant_delta") == 0) return EPlace::giant_delta();
+    if (strcmp(name, "giant_ember") == 0) return EPlace::giant_ember();
+    if (strcmp(name, "giant_falcon") == 0) return EPlace::giant_falcon();
+    if (strcmp(name, "giant_glacier") == 0) return EPlace::giant_glacier();
+    if (strcmp(name, "giant_harbor") == 0) return EPlace::giant_harbor();
+    if (strcmp(name, "giant_island") == 0) return EPlace::giant_island();
+    if (strcmp(name, "giant_jungle") == 0) return EPlace::giant_jungle();
+    if (strcmp(name, "giant_kernel") == 0) return EPlace::giant_kernel();
+    if (strcmp(name, "giant_lagoon") == 0) return EPlace::giant_lagoon();
+    if (strcmp(name, "giant_meadow") == 0) return EPlace::giant_meadow();
+    if (strcmp(name, "giant_nebula") == 0) return EPlace::giant_nebula();
+    if (strcmp(name, "giant_orchard") == 0) return EPlace::giant_orchard();
+    if (strcmp(name, "giant_prairie") == 0) return EPlace::giant_prairie();
+    if (strcmp(name, "giant_quarry") == 0) return EPlace::giant_quarry();
+    if (strcmp(name, "giant_river") == 0) return EPlace::giant_river();
+    if (strcmp(name, "giant_summit") == 0) return EPlace::giant_summit();
+    if (strcmp(name, "giant_tundra") == 0) return EPlace::giant_tundra();
+    if (strcmp(name, "giant_valley") == 0) return EPlace::giant_valley();
+    if (strcmp(name, "giant_willow") == 0) return EPlace::giant_willow();
+    if (strcmp(name, "giant_yonder") == 0) return EPlace::giant_yonder();
+    if (strcmp(name, "giant_zenith") == 0) return EPlace::giant_zenith();
+    if (strcmp(name, "hollow_anchor") == 0) return EPlace::hollow_anchor();
+    if (strcmp(name, "hollow_bridge") == 0) return EPlace::hollow_bridge();
+    if (strcmp(name, "hollow_canyon") == 0) return EPlace::hollow_canyon();
+    if (strcmp(name, "hollow_delta") == 0) return EPlace::hollow_delta();
+    if (strcmp(name, "hollow_ember") == 0) return EPlace::hollow_ember();
+    if (strcmp(name, "hollow_falcon") == 0) return EPlace::hollow_falcon();
+    if (strcmp(name, "hollow_glacier") == 0) return EPlace::hollow_glacier();
+    if (strcmp(name, "hollow_harbor") == 0) return EPlace::hollow_harbor();
+    if (strcmp(name, "hollow_island") == 0) return EPlace::hollow_island();
+    if (strcmp(name, "hollow_jungle") == 0) return EPlace::hollow_jungle();
+    if (strcmp(name, "hollow_kernel") == 0) return EPlace::hollow_kernel();
+    if (strcmp(name, "hollow_lagoon") == 0) return EPlace::hollow_lagoon();
+    if (strcmp(name, "hollow_meadow") == 0) return EPlace::hollow_meadow();
+    if (strcmp(name, "hollow_nebula") == 0) return EPlace::hollow_nebula();
+    if (strcmp(name, "hollow_orchard") == 0) return EPlace::hollow_orchard();
+    if (strcmp(name, "hollow_prairie") == 0) return EPlace::hollow_prairie();
+    if (strcmp(name, "hollow_quarry") == 0) return EPlace::hollow_quarry();
+    if (strcmp(name, "hollow_river") == 0) return EPlace::hollow_river();
+    if (strcmp(name, "hollow_summit") == 0) return EPlace::hollow_summit();
+    if (strcmp(name, "hollow_tundra") == 0) return EPlace::hollow_tundra();
+    if (strcmp(name, "hollow_valley") == 0) return EPlace::hollow_valley();
+    if (strcmp(name, "hollow_willow") == 0) return EPlace::hollow_willow();
+    if (strcmp(name, "hollow_yonder") == 0) return EPlace::hollow_yonder();
+    if (strcmp(name, "hollow_zenith") == 0) return EPlace::hollow_zenith();
+    if (strcmp(name, "ivory_anchor") == 0) return EPlace::ivory_anchor();
+    if (strcmp(name, "ivory_bridge") == 0) return EPlace::ivory_bridge();
+    if (strcmp(name, "ivory_canyon") == 0) return EPlace::ivory_canyon();
+    if (strcmp(name, "ivory_delta") == 0) return EPlace::ivory_delta();
+    if (strcmp(name, "ivory_ember") == 0) return EPlace::ivory_ember();
+    if (strcmp(name, "ivory_falcon") == 0) return EPlace::ivory_falcon();
+    if (strcmp(name, "ivory_glacier") == 0) return EPlace::ivory_glacier();
+    if (strcmp(name, "ivory_harbor") == 0) return EPlace::ivory_harbor();
+    if (strcmp(name, "ivory_island") == 0) return EPlace::ivory_island();
+    if (strcmp(name, "ivory_jungle") == 0) return EPlace::ivory_jungle();
+    if (strcmp(name, "ivory_kernel") == 0) return EPlace::ivory_kernel();
+    if (strcmp(name, "ivory_lagoon") == 0) return EPlace::ivory_lagoon();
+    if (strcmp(name, "ivory_meadow") == 0) return EPlace::ivory_meadow();
+    if (strcmp(name, "ivory_nebula") == 0) return EPlace::ivory_nebula();
+    if (strcmp(name, "ivory_orchard") == 0) return EPlace::ivory_orchard();
+    if (strcmp(name, "ivory_prairie") == 0) return EPlace::ivory_prairie();
+    if (strcmp(name, "ivory_quarry") == 0) return EPlace::ivory_quarry();
+    if (strcmp(name, "ivory_river") == 0) return EPlace::ivory_river();
+    if (strcmp(name, "ivory_summit") == 0) return EPlace::ivory_summit();
+    if (strcmp(name, "ivory_tundra") == 0) return EPlace::ivory_tundra();
+    if (strcmp(name, "ivory_valley") == 0) return EPlace::ivory_valley();
+    if (strcmp(name, "ivory_willow") == 0) return EPlace::ivory_willow();
+    if (strcmp(name, "ivory_yonder") == 0) return EPlace::ivory_yonder();
+    if (strcmp(name, "ivory_zenith") == 0) return EPlace::ivory_zenith();
+    if (strcmp(name, "jolly_anchor") == 0) return EPlace::jolly_anchor();
+    if (strcmp(name, "jolly_bridge") == 0) return EPlace::jolly_bridge();
+    if (strcmp(name, "jolly_canyon") == 0) return EPlace::jolly_canyon();
+    if (strcmp(name, "jolly_delta") == 0) return EPlace::jolly_delta();
+    if (strcmp(name, "jolly_ember") == 0) return EPlace::jolly_ember();
+    if (strcmp(name, "jolly_falcon") == 0) return EPlace::jolly_falcon();
+    if (strcmp(name, "jolly_glacier") == 0) return EPlace::jolly_glacier();
+    if (strcmp(name, "jolly_harbor") == 0) return EPlace::jolly_harbor();
+    if (strcmp(name, "jolly_island") == 0) return EPlace::jolly_island();
+    if (strcmp(name, "jolly_jungle") == 0) return EPlace::jolly_jungle();
+    if (strcmp(name, "jolly_kernel") == 0) return EPlace::jolly_kernel();
+    if (strcmp(name, "jolly_lagoon") == 0) return EPlace::jolly_lagoon();
+    if (strcmp(name, "jolly_meadow") == 0) return EPlace::jolly_meadow();
+    if (strcmp(name, "jolly_nebula") == 0) return EPlace::jolly_nebula();
+    if (strcmp(name, "jolly_orchard") == 0) return EPlace::jolly_orchard();
+    if (strcmp(name, "jolly_prairie") == 0) return EPlace::jolly_prairie();
+    if (strcmp(name, "jolly_quarry") == 0) return EPlace::jolly_quarry();
+    if (strcmp(name, "jolly_river") == 0) return EPlace::jolly_river();
+    if (strcmp(name, "jolly_summit") == 0) return EPlace::jolly_summit();
+    if (strcmp(name, "jolly_tundra") == 0) return EPlace::jolly_tundra();
+    if (strcmp(name, "jolly_valley") == 0) return EPlace::jolly_valley();
+    if (strcmp(name, "jolly_willow") == 0) return EPlace::jolly_willow();
+    if (strcmp(name, "jolly_yonder") == 0) return EPlace::jolly_yonder();
+    if (strcmp(name, "jolly_zenith") == 0) return EPlace::jolly_zenith();
+    if (strcmp(name, "keen_anchor") == 0) return EPlace::keen_anchor();
+    if (strcmp(name, "keen_bridge") == 0) return EPlace::keen_bridge();
+    if (strcmp(name, "keen_canyon") == 0) return EPlace::keen_canyon();
+    if (strcmp(name, "keen_delta") == 0) return EPlace::keen_delta();
+    if (strcmp(name, "keen_ember") == 0) return EPlace::keen_ember();
+    if (strcmp(name, "keen_falcon") == 0) return EPlace::keen_falcon();
+    if (strcmp(name, "keen_glacier") == 0) return EPlace::keen_glacier();
+    if (strcmp(name, "keen_harbor") == 0) return EPlace::keen_harbor();
+    if (strcmp(name, "keen_island") == 0) return EPlace::keen_island();
+    if (strcmp(name, "keen_jungle") == 0) return EPlace::keen_jungle();
+    if (strcmp(name, "keen_kernel") == 0) return EPlace::keen_kernel();
+    if (strcmp(name, "keen_lagoon") == 0) return EPlace::keen_lagoon();
+    if (strcmp(name, "keen_meadow") == 0) return EPlace::keen_meadow();
+    if (strcmp(name, "keen_nebula") == 0) return EPlace::keen_nebula();
+    if (strcmp(name, "keen_orchard") == 0) return EPlace::keen_orchard();
+    if (strcmp(name, "keen_prairie") == 0) return EPlace::keen_prairie();
+    if (strcmp(name, "keen_quarry") == 0) return EPlace::keen_quarry();
+    if (strcmp(name, "keen_river") == 0) return EPlace::keen_river();
+    if (strcmp(name, "keen_summit") == 0) return EPlace::keen_summit();
+    if (strcmp(name, "keen_tundra") == 0) return EPlace::keen_tundra();
+    if (strcmp(name, "keen_valley") == 0) return EPlace::keen_valley();
+    if (strcmp(name, "keen_willow") == 0) return EPlace::keen_willow();
+    if (strcmp(name, "keen_yonder") == 0) return EPlace::keen_yonder();
+    if (strcmp(name, "keen_zenith") == 0) return EPlace::keen_zenith();
+    if (strcmp(name, "lunar_anchor") == 0) return EPlace::lunar_anchor();
+    if (strcmp(name, "lunar_bridge") == 0) return EPlace::lunar_bridge();
+    if (strcmp(name, "lunar_canyon") == 0) return EPlace::lunar_canyon();
+    if (strcmp(name, "lunar_delta") == 0) return EPlace::lunar_delta();
+    if (strcmp(name, "lunar_ember") == 0) return EPlace::lunar_ember();
+    if (strcmp(name, "lunar_falcon") == 0) return EPlace::lunar_falcon();
+    if (strcmp(name, "lunar_glacier") == 0) return EPlace::lunar_glacier();
+    if (strcmp(name, "lunar_harbor") == 0) return EPlace::lunar_harbor();
+    if (strcmp(name, "lunar_island") == 0) return EPlace::lunar_island();
+    if (strcmp(name, "lunar_jungle") == 0) return EPlace::lunar_jungle();
+    if (strcmp(name, "lunar_kernel") == 0) return EPlace::lunar_kernel();
+    if (strcmp(name, "lunar_lagoon") == 0) return EPlace::lunar_lagoon();
+    if (strcmp(name, "lunar_meadow") == 0) return EPlace::lunar_meadow();
+    if (strcmp(name, "lunar_nebula") == 0) return EPlace::lunar_nebula();
+    if (strcmp(name, "lunar_orchard") == 0) return EPlace::lunar_orchard();
+    if (strcmp(name, "lunar_prairie") == 0) return EPlace::lunar_prairie();
+    if (strcmp(name, "lunar_quarry") == 0) return EPlace::lunar_quarry();
+    if (strcmp(name, "lunar_river") == 0) return EPlace::lunar_river();
+    if (strcmp(name, "lunar_summit") == 0) return EPlace::lunar_summit();
+    if (strcmp(name, "lunar_tundra") == 0) return EPlace::lunar_tundra();
+    if (strcmp(name, "lunar_valley") == 0) return EPlace::lunar_valley();
+    if (strcmp(name, "lunar_willow") == 0) return EPlace::lunar_willow();
+    if (strcmp(name, "lunar_yonder") == 0) return EPlace::lunar_yonder();
+    if (strcmp(name, "lunar_zenith") == 0) return EPlace::lunar_zenith();
+    if (strcmp(name, "misty_anchor") == 0) return EPlace::misty_anchor();
+    if (strcmp(name, "misty_bridge") == 0) return EPlace::misty_bridge();
+    if (strcmp(name, "misty_canyon") == 0) return EPlace::misty_canyon();
+    if (strcmp(name, "misty_delta") == 0) return EPlace::misty_delta();
+    if (strcmp(name, "misty_ember") == 0) return EPlace::misty_ember();
+    if (strcmp(name, "misty_falcon") == 0) return EPlace::misty_falcon();
+    if (strcmp(name, "misty_glacier") == 0) return EPlace::misty_glacier();
+    if (strcmp(name, "misty_harbor") == 0) return EPlace::misty_harbor();
+    if (strcmp(name, "misty_island") == 0) return EPlace::misty_island();
+    if (strcmp(name, "misty_jungle") == 0) return EPlace::misty_jungle();
+    if (strcmp(name, "misty_kernel") == 0) return EPlace::misty_kernel();
+    if (strcmp(name, "misty_lagoon") == 0) return EPlace::misty_lagoon();
+    if (strcmp(name, "misty_meadow") == 0) return EPlace::misty_meadow();
+    if (strcmp(name, "misty_nebula") == 0) return EPlace::misty_nebula();
+    if (strcmp(name, "misty_orchard") == 0) return EPlace::misty_orchard();
+    if (strcmp(name, "misty_prairie") == 0) return EPlace::misty_prairie();
+    if (strcmp(name, "misty_quarry") == 0) return EPlace::misty_quarry();
+    if (strcmp(name, "misty_river") == 0) return EPlace::misty_river();
+    if (strcmp(name, "misty_summit") == 0) return EPlace::misty_summit();
+    if (strcmp(name, "misty_tundra") == 0) return EPlace::misty_tundra();
+    if (strcmp(name, "misty_valley") == 0) return EPlace::misty_valley();
+    if (strcmp(name, "misty_willow") == 0) return EPlace::misty_willow();
+    if (strcmp(name, "misty_yonder") == 0) return EPlace::misty_yonder();
+    if (strcmp(name, "misty_zenith") == 0) return EPlace::misty_zenith();
+    if (strcmp(name, "noble_anchor") == 0) return EPlace::noble_anchor();
+    if (strcmp(name, "noble_bridge") == 0) return EPlace::noble_bridge();
+    if (strcmp(name, "noble_canyon") == 0) return EPlace::noble_canyon();
+    if (strcmp(name, "noble_delta") == 0) return EPlace::noble_delta();
+    if (strcmp(name, "noble_ember") == 0) return EPlace::noble_ember();
+    if (strcmp(name, "noble_falcon") == 0) return EPlace::noble_falcon();
+    if (strcmp(name, "noble_glacier") == 0) return EPlace::noble_glacier();
+    if (strcmp(name, "noble_harbor") == 0) return EPlace::noble_harbor();
+    if (strcmp(name, "noble_island") == 0) return EPlace::noble_island();
+    if (strcmp(name, "noble_jungle") == 0) return EPlace::noble_jungle();
+    if (strcmp(name, "noble_kernel") == 0) return EPlace::noble_kernel();
+    if (strcmp(name, "noble_lagoon") == 0) return EPlace::noble_lagoon();
+    if (strcmp(name, "noble_meadow") == 0) return EPlace::noble_meadow();
+    if (strcmp(name, "noble_nebula") == 0) return EPlace::noble_nebula();
+    if (strcmp(name, "noble_orchard") == 0) return EPlace::noble_orchard();
+    if (strcmp(name, "noble_prairie") == 0) return EPlace::noble_prairie();
+    if (strcmp(name, "noble_quarry") == 0) return EPlace::noble_quarry();
+    if (strcmp(name, "noble_river") == 0) return EPlace::noble_river();
+    if (strcmp(name, "noble_summit") == 0) return EPlace::noble_summit();
+    if (strcmp(name, "noble_tundra") == 0) return EPlace::noble_tundra();
+    if (strcmp(name, "noble_valley") == 0) return EPlace::noble_valley();
+    if (strcmp(name, "noble_willow") == 0) return EPlace::noble_willow();
+    if (strcmp(name, "noble_yonder") == 0) return EPlace::noble_yonder();
+    if (strcmp(name, "noble_zenith") == 0) return EPlace::noble_zenith();
+    if (strcmp(name, "olive_anchor") == 0) return EPlace::olive_anchor();
+    if (strcmp(name, "olive_bridge") == 0) return EPlace::olive_bridge();
+    if (strcmp(name, "olive_canyon") == 0) return EPlace::olive_canyon();
+    if (strcmp(name, "olive_delta") == 0) return EPlace::olive_delta();
+    if (strcmp(name, "olive_ember") == 0) return EPlace::olive_ember();
+    if (strcmp(name, "olive_falcon") == 0) return EPlace::olive_falcon();
+    if (strcmp(name, "olive_glacier") == 0) return EPlace::olive_glacier();
+    if (strcmp(name, "olive_harbor") == 0) return EPlace::olive_harbor();
+    if (strcmp(name, "olive_island") == 0) return EPlace::olive_island();
+    if (strcmp(name, "olive_jungle") == 0) return EPlace::olive_jungle();
+    if (strcmp(name, "olive_kernel") == 0) return EPlace::olive_kernel();
+    if (strcmp(name, "olive_lagoon") == 0) return EPlace::olive_lagoon();
+    if (strcmp(name, "olive_meadow") == 0) return EPlace::olive_meadow();
+    if (strcmp(name, "olive_nebula") == 0) return EPlace::olive_nebula();
+    if (strcmp(name, "olive_orchard") == 0) return EPlace::olive_orchard();
+    if (strcmp(name, "olive_prairie") == 0) return EPlace::olive_prairie();
+    if (strcmp(name, "olive_quarry") == 0) return EPlace::olive_quarry();
+    if (strcmp(name, "olive_river") == 0) return EPlace::olive_river();
+    if (strcmp(name, "olive_summit") == 0) return EPlace::olive_summit();
+    if (strcmp(name, "olive_tundra") == 0) return EPlace::olive_tundra();
+    if (strcmp(name, "olive_valley") == 0) return EPlace::olive_valley();
+    if (strcmp(name, "olive_willow") == 0) return EPlace::olive_willow();
+    if (strcmp(name, "olive_yonder") == 0) return EPlace::olive_yonder();
+    if (strcmp(name, "olive_zenith") == 0) return EPlace::olive_zenith();
+    if (strcmp(name, "prime_anchor") == 0) return EPlace::prime_anchor();
+    if (strcmp(name, "prime_bridge") == 0) return EPlace::prime_bridge();
+    if (strcmp(name, "prime_canyon") == 0) return EPlace::prime_canyon();
+    if (strcmp(name, "prime_delta") == 0) return EPlace::prime_delta();
+    if (strcmp(name, "prime_ember") == 0) return EPlace::prime_ember();
+    if (strcmp(name, "prime_falcon") == 0) return EPlace::prime_falcon();
+    if (strcmp(name, "prime_glacier") == 0) return EPlace::prime_glacier();
+    if (strcmp(name, "prime_harbor") == 0) return EPlace::prime_harbor();
+    if (strcmp(name, "prime_island") == 0) return EPlace::prime_island();
+    if (strcmp(name, "prime_jungle") == 0) return EPlace::prime_jungle();
+    if (strcmp(name, "prime_kernel") == 0) return EPlace::prime_kernel();
+    if (strcmp(name, "prime_lagoon") == 0) return EPlace::prime_lagoon();
+    if (strcmp(name, "prime_meadow") == 0) return EPlace::prime_meadow();
+    if (strcmp(name, "prime_nebula") == 0) return EPlace::prime_nebula();
+    if (strcmp(name, "prime_orchard") == 0) return EPlace::prime_orchard();
+    if (strcmp(name, "prime_prairie") == 0) return EPlace::prime_prairie();
+    if (strcmp(name, "prime_quarry") == 0) return EPlace::prime_quarry();
+    if (strcmp(name, "prime_river") == 0) return EPlace::prime_river();
+    if (strcmp(name, "prime_summit") == 0) return EPlace::prime_summit();
+    if (strcmp(name, "prime_tundra") == 0) return EPlace::prime_tundra();
+    if (strcmp(name, "prime_valley") == 0) return EPlace::prime_valley();
+    if (strcmp(name, "prime_willow") == 0) return EPlace::prime_willow();
+    if (strcmp(name, "prime_yonder") == 0) return EPlace::prime_yonder();
+    if (strcmp(name, "prime_zenith") == 0) return EPlace::prime_zenith();
+    if (strcmp(name, "quiet_anchor") == 0) return EPlace::quiet_anchor();
+    if (strcmp(name, "quiet_bridge") == 0) return EPlace::quiet_bridge();
+    if (strcmp(name, "quiet_canyon") == 0) return EPlace::quiet_canyon();
+    if (strcmp(name, "quiet_delta") == 0) return EPlace::quiet_delta();
+    if (strcmp(name, "quiet_ember") == 0) return EPlace::quiet_ember();
+    if (strcmp(name, "quiet_falcon") == 0) return EPlace::quiet_falcon();
+    if (strcmp(name, "quiet_glacier") == 0) return EPlace::quiet_glacier();
+    if (strcmp(name, "quiet_harbor") == 0) return EPlace::quiet_harbor();
+    if (strcmp(name, "quiet_island") == 0) return EPlace::quiet_island();
+    if (strcmp(name, "quiet_jungle") == 0) return EPlace::quiet_jungle();
+    if (strcmp(name, "quiet_kernel") == 0) return EPlace::quiet_kernel();
+    if (strcmp(name, "quiet_lagoon") == 0) return EPlace::quiet_lagoon();
+    if (strcmp(name, "quiet_meadow") == 0) return EPlace::quiet_meadow();
+    if (strcmp(name, "quiet_nebula") == 0) return EPlace::quiet_nebula();
+    if (strcmp(name, "quiet_orchard") == 0) return EPlace::quiet_orchard();
+    if (strcmp(name, "quiet_prairie") == 0) return EPlace::quiet_prairie();
+    if (strcmp(name, "quiet_quarry") == 0) return EPlace::quiet_quarry();
+    if (strcmp(name, "quiet_river") == 0) return EPlace::quiet_river();
+    if (strcmp(name, "quiet_summit") == 0) return EPlace::quiet_summit();
+    if (strcmp(name, "quiet_tundra") == 0) return EPlace::quiet_tundra();
+    if (strcmp(name, "quiet_valley") == 0) return EPlace::quiet_valley();
+    if (strcmp(name, "quiet_willow") == 0) return EPlace::quiet_willow();
+    if (strcmp(name, "quiet_yonder") == 0) return EPlace::quiet_yonder();
+    if (strcmp(name, "quiet_zenith") == 0) return EPlace::quiet_zenith();
+    if (strcmp(name, "rapid_anchor") == 0) return EPlace::rapid_anchor();
+    if (strcmp(name, "rapid_bridge") == 0) return EPlace::rapid_bridge();
+    if (strcmp(name, "rapid_canyon") == 0) return EPlace::rapid_canyon();
+    if (strcmp(name, "rapid_delta") == 0) return EPlace::rapid_delta();
+    if (strcmp(name, "rapid_ember") == 0) return EPlace::rapid_ember();
+    if (strcmp(name, "rapid_falcon") == 0) return EPlace::rapid_falcon();
+    if (strcmp(name, "rapid_glacier") == 0) return EPlace::rapid_glacier();
+    if (strcmp(name, "rapid_harbor") == 0) return EPlace::rapid_harbor();
+    if (strcmp(name, "rapid_island") == 0) return EPlace::rapid_island();
+    if (strcmp(name, "rapid_jungle") == 0) return EPlace::rapid_jungle();
+    if (strcmp(name, "rapid_kernel") == 0) return EPlace::rapid_kernel();
+    if (strcmp(name, "rapid_lagoon") == 0) return EPlace::rapid_lagoon();
+    if (strcmp(name, "rapid_meadow") == 0) return EPlace::rapid_meadow();
+    if (strcmp(name, "rapid_nebula") == 0) return EPlace::rapid_nebula();
+    if (strcmp(name, "rapid_orchard") == 0) return EPlace::rapid_orchard();
+    if (strcmp(name, "rapid_prairie") == 0) return EPlace::rapid_prairie();
+    if (strcmp(name, "rapid_quarry") == 0) return EPlace::rapid_quarry();
+    if (strcmp(name, "rapid_river") == 0) return EPlace::rapid_river();
+    if (strcmp(name, "rapid_summit") == 0) return EPlace::rapid_summit();
+    if (strcmp(name, "rapid_tundra") == 0) return EPlace::rapid_tundra();
+    if (strcmp(name, "rapid_valley") == 0) return EPlace::rapid_valley();
+    if (strcmp(name, "rapid_willow") == 0) return EPlace::rapid_willow();
+    if (strcmp(name, "rapid_yonder") == 0) return EPlace::rapid_yonder();
+    if (strcmp(name, "rapid_zenith") == 0) return EPlace::rapid_zenith();
+    if (strcmp(name, "solar_anchor") == 0) return EPlace::solar_anchor();
+    if (strcmp(name, "solar_bridge") == 0) return EPlace::solar_bridge();
+    if (strcmp(name, "solar_canyon") == 0) return EPlace::solar_canyon();
+    if (strcmp(name, "solar_delta") == 0) return EPlace::solar_delta();
+    if (strcmp(name, "solar_ember") == 0) return EPlace::solar_ember();
+    if (strcmp(name, "solar_falcon") == 0) return EPlace::solar_falcon();
+    if (strcmp(name, "solar_glacier") == 0) return EPlace::solar_glacier();
+    if (strcmp(name, "solar_harbor") == 0) return EPlace::solar_harbor();
+    if (strcmp(name, "solar_island") == 0) return EPlace::solar_island();
+    if (strcmp(name, "solar_jungle") == 0) return EPlace::solar_jungle();
+    if (strcmp(name, "solar_kernel") == 0) return EPlace::solar_kernel();
+    if (strcmp(name, "solar_lagoon") == 0) return EPlace::solar_lagoon();
+    if (strcmp(name, "solar_meadow") == 0) return EPlace::solar_meadow();
+    if (strcmp(name, "solar_nebula") == 0) return EPlace::solar_nebula();
+    if (strcmp(name, "solar_orchard") == 0) return EPlace::solar_orchard();
+    if (strcmp(name, "solar_prairie") == 0) return EPlace::solar_prairie();
+    if (strcmp(name, "solar_quarry") == 0) return EPlace::solar_quarry();
+    if (strcmp(name, "solar_river") == 0) return EPlace::solar_river();
+    if (strcmp(name, "solar_summit") == 0) return EPlace::solar_summit();
+    if (strcmp(name, "solar_tundra") == 0) return EPlace::solar_tundra();
+    if (strcmp(name, "solar_valley") == 0) return EPlace::solar_valley();
+    if (strcmp(name, "solar_willow") == 0) return EPlace::solar_willow();
+    if (strcmp(name, "solar_yonder") == 0) return EPlace::solar_yonder();
+    if (strcmp(name, "solar_zenith") == 0) return EPlace::solar_zenith();
+    if (strcmp(name, "tidal_anchor") == 0) return EPlace::tidal_anchor();
+    if (strcmp(name, "tidal_bridge") == 0) return EPlace::tidal_bridge();
+    if (strcmp(name, "tidal_canyon") == 0) return EPlace::tidal_canyon();
+    if (strcmp(name, "tidal_delta") == 0) return EPlace::tidal_delta();
+    if (strcmp(name, "tidal_ember") == 0) return EPlace::tidal_ember();
+    if (strcmp(name, "tidal_falcon") == 0) return EPlace::tidal_falcon();
+    if (strcmp(name, "tidal_glacier") == 0) return EPlace::tidal_glacier();
+    if (strcmp(name, "tidal_harbor") == 0) return EPlace::tidal_harbor();
+    if (strcmp(name, "tidal_island") == 0) return EPlace::tidal_island();
+    if (strcmp(name, "tidal_jungle") == 0) return EPlace::tidal_jungle();
+    if (strcmp(name, "tidal_kernel") == 0) return EPlace::tidal_kernel();
+    if (strcmp(name, "tidal_lagoon") == 0) return EPlace::tidal_lagoon();
+    if (strcmp(name, "tidal_meadow") == 0) return EPlace::tidal_meadow();
+    if (strcmp(name, "tidal_nebula") == 0) return EPlace::tidal_nebula();
+    if (strcmp(name, "tidal_orchard") == 0) return EPlace::tidal_orchard();
+    if (strcmp(name, "tidal_prairie") == 0) return EPlace::tidal_prairie();
+    if (strcmp(name, "tidal_quarry") == 0) return EPlace::tidal_quarry();
+    if (strcmp(name, "tidal_river") == 0) return EPlace::tidal_river();
+    if (strcmp(name, "tidal_summit") == 0) return EPlace::tidal_summit();
+    if (strcmp(name, "tidal_tundra") == 0) return EPlace::tidal_tundra();
+    if (strcmp(name, "tidal_valley") == 0) return EPlace::tidal_valley();
+    if (strcmp(name, "tidal_willow") == 0) return EPlace::tidal_willow();
+    if (strcmp(name, "tidal_yonder") == 0) return EPlace::tidal_yonder();
+    if (strcmp(name, "tidal_zenith") == 0) return EPlace::tidal_zenith();
+    if (strcmp(name, "urban_anchor") == 0) return EPlace::urban_anchor();
+    if (strcmp(name, "urban_bridge") == 0) return EPlace::urban_bridge();
+    if (strcmp(name, "urban_canyon") == 0) return EPlace::urban_canyon();
+    if (strcmp(name, "urban_delta") == 0) return EPlace::urban_delta();
+    if (strcmp(name, "urban_ember") == 0) return EPlace::urban_ember();
+    if (strcmp(name, "urban_falcon") == 0) return EPlace::urban_falcon();
+    if (strcmp(name, "urban_glacier") == 0) return EPlace::urban_glacier();
+    if (strcmp(name, "urban_harbor") == 0) return EPlace::urban_harbor();
+    if (strcmp(name, "urban_island") == 0) return EPlace::urban_island();
+    if (strcmp(name, "urban_jungle") == 0) return EPlace::urban_jungle();
+    if (strcmp(name, "urban_kernel") == 0) return EPlace::urban_kernel();
+    if (strcmp(name, "urban_lagoon") == 0) return EPlace::urban_lagoon();
+    if (strcmp(name, "urban_meadow") == 0) return EPlace::urban_meadow();
+    if (strcmp(name, "urban_nebula") == 0) return EPlace::urban_nebula();
+    if (strcmp(name, "urban_orchard") == 0) return EPlace::urban_orchard();
+    if (strcmp(name, "urban_prairie") == 0) return EPlace::urban_prairie();
+    if (strcmp(name, "urban_quarry") == 0) return EPlace::urban_quarry();
+    if (strcmp(name, "urban_river") == 0) return EPlace::urban_river();
+    if (strcmp(name, "urban_summit") == 0) return EPlace::urban_summit();
+    if (strcmp(name, "urban_tundra") == 0) return EPlace::urban_tundra();
+    if (strcmp(name, "urban_valley") == 0) return EPlace::urban_valley();
+    if (strcmp(name, "urban_willow") == 0) return EPlace::urban_willow();
+    if (strcmp(name, "urban_yonder") == 0) return EPlace::urban_yonder();
+    if (strcmp(name, "urban_zenith") == 0) return EPlace::urban_zenith();
+    if (strcmp(name, "vivid_anchor") == 0) return EPlace::vivid_anchor();
+    if (strcmp(name, "vivid_bridge") == 0) return EPlace::vivid_bridge();
+    if (strcmp(name, "vivid_canyon") == 0) return EPlace::vivid_canyon();
+    if (strcmp(name, "vivid_delta") == 0) return EPlace::vivid_delta();
+    if (strcmp(name, "vivid_ember") == 0) return EPlace::vivid_ember();
+    if (strcmp(name, "vivid_falcon") == 0) return EPlace::vivid_falcon();
+    if (strcmp(name, "vivid_glacier") == 0) return EPlace::vivid_glacier();
+    if (strcmp(name, "vivid_harbor") == 0) return EPlace::vivid_harbor();
+    if (strcmp(name, "vivid_island") == 0) return EPlace::vivid_island();
+    if (strcmp(name, "vivid_jungle") == 0) return EPlace::vivid_jungle();
+    if (strcmp(name, "vivid_kernel") == 0) return EPlace::vivid_kernel();
+    if (strcmp(name, "vivid_lagoon") == 0) return EPlace::vivid_lagoon();
+    if (strcmp(name, "vivid_meadow") == 0) return EPlace::vivid_meadow();
+    if (strcmp(name, "vivid_nebula") == 0) return EPlace::vivid_nebula();
+    if (strcmp(name, "vivid_orchard") == 0) return EPlace::vivid_orchard();
+    if (strcmp(name, "vivid_prairie") == 0) return EPlace::vivid_prairie();
+    if (strcmp(name, "vivid_quarry") == 0) return EPlace::vivid_quarry();
+    if (strcmp(name, "vivid_river") == 0) return EPlace::vivid_river();
+    if (strcmp(name, "vivid_summit") == 0) return EPlace::vivid_summit();
+    if (strcmp(name, "vivid_tundra") == 0) return EPlace::vivid_tundra();
+    if (strcmp(name, "vivid_valley") == 0) return EPlace::vivid_valley();
+    if (strcmp(name, "vivid_willow") == 0) return EPlace::vivid_willow();
+    if (strcmp(name, "vivid_yonder") == 0) return EPlace::vivid_yonder();
+    if (strcmp(name, "vivid_zenith") == 0) return EPlace::vivid_zenith();
+    if (strcmp(name, "windy_anchor") == 0) return EPlace::windy_anchor();
+    if (strcmp(name, "windy_bridge") == 0) return EPlace::windy_bridge();
+    if (strcmp(name, "windy_canyon") == 0) return EPlace::windy_canyon();
+    if (strcmp(name, "windy_delta") == 0) return EPlace::windy_delta();
+    if (strcmp(name, "windy_ember") == 0) return EPlace::windy_ember();
+    if (strcmp(name, "windy_falcon") == 0) return EPlace::windy_falcon();
+    if (strcmp(name, "windy_glacier") == 0) return EPlace::windy_glacier();
+    if (strcmp(name, "windy_harbor") == 0) return EPlace::windy_harbor();
+    if (strcmp(name, "windy_island") == 0) return EPlace::windy_island();
+    if (strcmp(name, "windy_jungle") == 0) return EPlace::windy_jungle();
+    if (strcmp(name, "windy_kernel") == 0) return EPlace::windy_kernel();
+    if (strcmp(name, "windy_lagoon") == 0) return EPlace::windy_lagoon();
+    if (strcmp(name, "windy_meadow") == 0) return EPlace::windy_meadow();
+    if (strcmp(name, "windy_nebula") == 0) return EPlace::windy_nebula();
+    if (strcmp(name, "windy_orchard") == 0) return EPlace::windy_orchard();
+    if (strcmp(name, "windy_prairie") == 0) return EPlace::windy_prairie();
+    if (strcmp(name, "windy_quarry") == 0) return EPlace::windy_quarry();
+    if (strcmp(name, "windy_river") == 0) return EPlace::windy_river();
+    if (strcmp(name, "windy_summit") == 0) return EPlace::windy_summit();
+    if (strcmp(name, "windy_tundra") == 0) return EPlace::windy_tundra();
+    if (strcmp(name, "windy_valley") == 0) return EPlace::windy_valley();
+    if (strcmp(name, "windy_willow") == 0) return EPlace::windy_willow();
+    if (strcmp(name, "windy_yonder") == 0) return EPlace::windy_yonder();
+    if (strcmp(name, "windy_zenith") == 0) return EPlace::windy_zenith();
+    if (strcmp(name, "young_anchor") == 0) return EPlace::young_anchor();
+    if (strcmp(name, "young_bridge") == 0) return EPlace::young_bridge();
+    if (strcmp(name, "young_canyon") == 0) return EPlace::young_canyon();
+    if (strcmp(name, "young_delta") == 0) return EPlace::young_delta();
+    if (strcmp(name, "young_ember") == 0) return EPlace::young_ember();
+    if (strcmp(name, "young_falcon") == 0) return EPlace::young_falcon();
+    if (strcmp(name, "young_glacier") == 0) return EPlace::young_glacier();
+    if (strcmp(name, "young_harbor") == 0) return EPlace::young_harbor();
+    if (strcmp(name, "young_island") == 0) return EPlace::young_island();
+    if (strcmp(name, "young_jungle") == 0) return EPlace::young_jungle();
+    if (strcmp(name, "young_kernel") == 0) return EPlace::young_kernel();
+    if (strcmp(name, "young_lagoon") == 0) return EPlace::young_lagoon();
+    if (strcmp(name, "young_meadow") == 0) return EPlace::young_meadow();
+    if (strcmp(name, "young_nebula") == 0) return EPlace::young_nebula();
+    if (strcmp(name, "young_orchard") == 0) return EPlace::young_orchard();
+    if (strcmp(name, "young_prairie") == 0) return EPlace::young_prairie();
+    if (strcmp(name, "young_quarry") == 0) return EPlace::young_quarry();
+    if (strcmp(name, "young_river") == 0) return EPlace::young_river();
+    if (strcmp(name, "young_summit") == 0) return EPlace::young_summit();
+    if (strcmp(name, "young_tundra") == 0) return EPlace::young_tundra();
+    if (strcmp(name, "young_valley") == 0) return EPlace::young_valley();
+    if (strcmp(name, "young_willow") == 0) return EPlace::young_willow();
+    if (strcmp(name, "young_yonder") == 0) return EPlace::young_yonder();
+    if (strcmp(name, "young_zenith") == 0) return EPlace::young_zenith();
+    if (strcmp(name, "zonal_anchor") == 0) return EPlace::zonal_anchor();
+    if (strcmp(name, "zonal_bridge") == 0) return EPlace::zonal_bridge();
+    if (strcmp(name, "zonal_canyon") == 0) return EPlace::zonal_canyon();
+    if (strcmp(name, "zonal_delta") == 0) return EPlace::zonal_delta();
+    if (strcmp(name, "zonal_ember") == 0) return EPlace::zonal_ember();
+    if (strcmp(name, "zonal_falcon") == 0) return EPlace::zonal_falcon();
+    if (strcmp(name, "zonal_glacier") == 0) return EPlace::zonal_glacier();
+    if (strcmp(name, "zonal_harbor") == 0) return EPlace::zonal_harbor();
+    if (strcmp(name, "zonal_island") == 0) return EPlace::zonal_island();
+    if (strcmp(name, "zonal_jungle") == 0) return EPlace::zonal_jungle();
+    if (strcmp(name, "zonal_kernel") == 0) return EPlace::zonal_kernel();
+    if (strcmp(name, "zonal_lagoon") == 0) return EPlace::zonal_lagoon();
+    if (strcmp(name, "zonal_meadow") == 0) return EPlace::zonal_meadow();
+    if (strcmp(name, "zonal_nebula") == 0) return EPlace::zonal_nebula();
+    if (strcmp(name, "zonal_orchard") == 0) return EPlace::zonal_orchard();
+    if (strcmp(name, "zonal_prairie") == 0) return EPlace::zonal_prairie();
+    if (strcmp(name, "zonal_quarry") == 0) return EPlace::zonal_quarry();
+    if (strcmp(name, "zonal_river") == 0) return EPlace::zonal_river();
+    if (strcmp(name, "zonal_summit") == 0) return EPlace::zonal_summit();
+    if (strcmp(name, "zonal_tundra") == 0) return EPlace::zonal_tundra();
+    if (strcmp(name, "zonal_valley") == 0) return EPlace::zonal_valley();
+    if (strcmp(name, "zonal_willow") == 0) return EPlace::zonal_willow();
+    if (strcmp(name, "zonal_yonder") == 0) return EPlace::zonal_yonder();
+    if (strcmp(name, "zonal_zenith") == 0) return EPlace::zonal_zenith();
+    return EPlace();
+}
+
+TEST(PlaceBenchmark, fromString)
+{
+    size_t count = sizeof(namesPlace) / sizeof(const char*);
+    size_t index = 0;
+    plt::Benchmark benchmark("structure/from_string.Place.fromString");
+    while (benchmark.running())
+    {
+        const char* name = namesPlace[index++ % count];
+        size_t size = strlen(name);
+        benchmark.consume(EPlace::fromString(name, size));
+    }
+}
+
+TEST(PlaceBenchmark, linearFromString)
+{
+    size_t count = sizeof(namesPlace) / sizeof(const char*);
+    size_t index = 0;
+    plt::Benchmark benchmark("structure/from_string.Place.linearFromString");
+    while (benchmark.running())
+    {
+        const char* name = namesPlace[index++ % count];
+        size_t size = strlen(name);
+        benchmark.consume(size);
+        benchmark.consume(linearFromStringPlace(name));
+    }
+}
+
+}
+
@@ -0,0 +1,33 @@
+#ifndef __STRUCTURE_FROM_STRING_COMPIL__FWD_H_
+#define __STRUCTURE_FROM_STRING_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace from_string
+{
+
+// Forward declarations
+class EColor;
+typedef EColor*                         EColorRPtr;
+typedef boost::shared_ptr<EColor>       EColorSPtr;
+typedef boost::shared_ptr<const EColor> EColorSCPtr;
+typedef boost::weak_ptr<EColor>         EColorWPtr;
+
+class EPermission;
+typedef EPermission*                         EPermissionRPtr;
+typedef boost::shared_ptr<EPermission>       EPermissionSPtr;
+typedef boost::shared_ptr<const EPermission> EPermissionSCPtr;
+typedef boost::weak_ptr<EPermission>         EPermissionWPtr;
+
+class EPlace;
+typedef EPlace*                         EPlaceRPtr;
+typedef boost::shared_ptr<EPlace>       EPlaceSPtr;
+typedef boost::shared_ptr<const EPlace> EPlaceSCPtr;
+typedef boost::weak_ptr<EPlace>         EPlaceWPtr;
+
+}
+
+#endif // __STRUCTURE_FROM_STRING_COMPIL__FWD_H_
+
@@ -0,0 +1,1369 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __STRUCTURE_FROM_STRING_COMPIL_H_
+#define __STRUCTURE_FROM_STRING_COMPIL_H_
+
+#include "structure/from_string-fwd.h"
+// Compil C++ Template Library
+#include "core/compil/flags_enumeration.h"
+// Standard C Library
+#include <stddef.h>
+
+namespace from_string
+{
+
+// This enumeration class provides namespaced set of constant values.
+class EColor
+{
+public:
+    // Default constructor - sets the value to invalid
+                         EColor    ( );
+    // Constructor from an integer value.
+                         EColor    ( long value);
+
+    // Returns the integer value of the enum.
+           long          value     ( )                              const;
+    // Returns short name for a specified enum value
+    static const char*   shortName ( long value);
+    // Returns short name of the enum value
+           const char*   shortName ( )                              const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static EColor        fromString( const char* name, size_t size);
+    // Cast operator that casts the enum to its native type
+           operator long (         ) const;
+
+    // static methods for enum class objects
+    static const long invalid();
+    static const long red    ();
+    static const long green  ();
+    static const long blue   ();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid = 0,
+        kRed     = 1,
+        kGreen   = 2,
+        kBlue    = 3,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EPermission : public flags_enumeration<long, EPermission>
+{
+public:
+    // Default constructor - sets the value to nil
+                         EPermission();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit             EPermission(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long        value      ()                              const;
+    // Returns short name for a specified enum value
+    static   const char* shortName  (long value);
+    // Returns short name of the enum value
+             const char* shortName  ()                              const;
+    // Returns the enum value with a specified short name or nil if none of
+    // the values has this name. The lookup is a perfect hash.
+    static   EPermission fromString (const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool        operator== (const EPermission& rValue)     const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool        operator!= (const EPermission& rValue)     const;
+
+    // static methods for enum class objects
+    static const EPermission nil    ();
+    static const EPermission read   ();
+    static const EPermission write  ();
+    static const EPermission execute();
+    static const EPermission all    ();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kNil     = 0,
+        kRead    = 1 << 0,
+        kWrite   = 1 << 1,
+        kExecute = 1 << 2,
+        kAll     = 0x7,
+    };
+
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EPlace
+{
+public:
+    // Default constructor - sets the value to invalid
+                         EPlace    ();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit             EPlace    (long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long        value     ()                              const;
+    // Returns short name for a specified enum value
+    static   const char* shortName (long value);
+    // Returns short name of the enum value
+             const char* shortName ()                              const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   EPlace      fromString(const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool        operator==(const EPlace& rValue)          const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool        operator!=(const EPlace& rValue)          const;
+
+    // static methods for enum class objects
+    static const EPlace invalid       ();
+    static const EPlace amber_anchor  ();
+    static const EPlace amber_bridge  ();
+    static const EPlace amber_canyon  ();
+    static const EPlace amber_delta   ();
+    static const EPlace amber_ember   ();
+    static const EPlace amber_falcon  ();
+    static const EPlace amber_glacier ();
+    static const EPlace amber_harbor  ();
+    static const EPlace amber_island  ();
+    static const EPlace amber_jungle  ();
+    static const EPlace amber_kernel  ();
+    static const EPlace amber_lagoon  ();
+    static const EPlace amber_meadow  ();
+    static const EPlace amber_nebula  ();
+    static const EPlace amber_orchard ();
+    static const EPlace amber_prairie ();
+    static const EPlace amber_quarry  ();
+    static const EPlace amber_river   ();
+    static const EPlace amber_summit  ();
+    static const EPlace amber_tundra  ();
+    static const EPlace amber_valley  ();
+    static const EPlace amber_willow  ();
+    static const EPlace amber_yonder  ();
+    static const EPlace amber_zenith  ();
+    static const EPlace brisk_anchor  ();
+    static const EPlace brisk_bridge  ();
+    static const EPlace brisk_canyon  ();
+    static const EPlace brisk_delta   ();
+    static const EPlace brisk_ember   ();
+    static const EPlace brisk_falcon  ();
+    static const EPlace brisk_glacier ();
+    static const EPlace brisk_harbor  ();
+    static const EPlace brisk_island  ();
+    static const EPlace brisk_jungle  ();
+    static const EPlace brisk_kernel  ();
+    static const EPlace brisk_lagoon  ();
+    static const EPlace brisk_meadow  ();
+    static const EPlace brisk_nebula  ();
+    static const EPlace brisk_orchard ();
+    static const EPlace brisk_prairie ();
+    static const EPlace brisk_quarry  ();
+    static const EPlace brisk_river   ();
+    static const EPlace brisk_summit  ();
+    static const EPlace brisk_tundra  ();
+    static const EPlace brisk_valley  ();
+    static const EPlace brisk_willow  ();
+    static const EPlace brisk_yonder  ();
+    static const EPlace brisk_zenith  ();
+    static const EPlace coral_anchor  ();
+    static const EPlace coral_bridge  ();
+    static const EPlace coral_canyon  ();
+    static const EPlace coral_delta   ();
+    static const EPlace coral_ember   ();
+    static const EPlace coral_falcon  ();
+    static const EPlace coral_glacier ();
+    static const EPlace coral_harbor  ();
+    static const EPlace coral_island  ();
+    static const EPlace coral_jungle  ();
+    static const EPlace coral_kernel  ();
+    static const EPlace coral_lagoon  ();
+    static const EPlace coral_meadow  ();
+    static const EPlace coral_nebula  ();
+    static const EPlace coral_orchard ();
+    static const EPlace coral_prairie ();
+    static const EPlace coral_quarry  ();
+    static const EPlace coral_river   ();
+    static const EPlace coral_summit  ();
+    static const EPlace coral_tundra  ();
+    static const EPlace coral_valley  ();
+    static const EPlace coral_willow  ();
+    static const EPlace coral_yonder  ();
+    static const EPlace coral_zenith  ();
+    static const EPlace dusty_anchor  ();
+    static const EPlace dusty_bridge  ();
+    static const EPlace dusty_canyon  ();
+    static const EPlace dusty_delta   ();
+    static const EPlace dusty_ember   ();
+    static const EPlace dusty_falcon  ();
+    static const EPlace dusty_glacier ();
+    static const EPlace dusty_harbor  ();
+    static const EPlace dusty_island  ();
+    static const EPlace dusty_jungle  ();
+    static const EPlace dusty_kernel  ();
+    static const EPlace dusty_lagoon  ();
+    static const EPlace dusty_meadow  ();
+    static const EPlace dusty_nebula  ();
+    static const EPlace dusty_orchard ();
+    static const EPlace dusty_prairie ();
+    static const EPlace dusty_quarry  ();
+    static const EPlace dusty_river   ();
+    static const EPlace dusty_summit  ();
+    static const EPlace dusty_tundra  ();
+    static const EPlace dusty_valley  ();
+    static const EPlace dusty_willow  ();
+    static const EPlace dusty_yonder  ();
+    static const EPlace dusty_zenith  ();
+    static const EPlace early_anchor  ();
+    static const EPlace early_bridge  ();
+    static const EPlace early_canyon  ();
+    static const EPlace early_delta   ();
+    static const EPlace early_ember   ();
+    static const EPlace early_falcon  ();
+    static const EPlace early_glacier ();
+    static const EPlace early_harbor  ();
+    static const EPlace early_island  ();
+    static const EPlace early_jungle  ();
+    static const EPlace early_kernel  ();
+    static const EPlace early_lagoon  ();
+    static const EPlace early_meadow  ();
+    static const EPlace early_nebula  ();
+    static const EPlace early_orchard ();
+    static const EPlace early_prairie ();
+    static const EPlace early_quarry  ();
+    static const EPlace early_river   ();
+    static const EPlace early_summit  ();
+    static const EPlace early_tundra  ();
+    static const EPlace early_valley  ();
+    static const EPlace early_willow  ();
+    static const EPlace early_yonder  ();
+    static const EPlace early_zenith  ();
+    static const EPlace faint_anchor  ();
+    static const EPlace faint_bridge  ();
+    static const EPlace faint_canyon  ();
+    static const EPlace faint_delta   ();
+    static const EPlace faint_ember   ();
+    static const EPlace faint_falcon  ();
+    static const EPlace faint_glacier ();
+    static const EPlace faint_harbor  ();
+    static const EPlace faint_island  ();
+    static const EPlace faint_jungle  ();
+    static const EPlace faint_kernel  ();
+    static const EPlace faint_lagoon  ();
+    static const EPlace faint_meadow  ();
+    static const EPlace faint_nebula  ();
+    static const EPlace faint_orchard ();
+    static const EPlace faint_prairie ();
+    static const EPlace faint_quarry  ();
+    static const EPlace faint_river   ();
+    static const EPlace faint_summit  ();
+    static const EPlace faint_tundra  ();
+    static const EPlace faint_valley  ();
+    static const EPlace faint_willow  ();
+    static const EPlace faint_yonder  ();
+    static const EPlace faint_zenith  ();
+    static const EPlace giant_anchor  ();
+    static const EPlace giant_bridge  ();
+    static const EPlace giant_canyon  ();
+    static const EPlace giant_delta   ();
+    static const EPlace giant_ember   ();
+    static const EPlace giant_falcon  ();
+    static const EPlace giant_glacier ();
+    static const EPlace giant_harbor  ();
+    static const EPlace giant_island  ();
+    static const EPlace giant_jungle  ();
+    static const EPlace giant_kernel  ();
+    static const EPlace giant_lagoon  ();
+    static const EPlace giant_meadow  ();
+    static const EPlace giant_nebula  ();
+    static const EPlace giant_orchard ();
+    static const EPlace giant_prairie ();
+    static const EPlace giant_quarry  ();
+    static const EPlace giant_river   ();
+    static const EPlace giant_summit  ();
+    static const EPlace giant_tundra  ();
+    static const EPlace giant_valley  ();
+    static const EPlace giant_willow  ();
+    static const EPlace giant_yonder  ();
+    static const EPlace giant_zenith  ();
+    static const EPlace hollow_anchor ();
+    static const EPlace hollow_bridge ();
+    static const EPlace hollow_canyon ();
+    static const EPlace hollow_delta  ();
+    static const EPlace hollow_ember  ();
+    static const EPlace hollow_falcon ();
+    static const EPlace hollow_glacier();
+    static const EPlace hollow_harbor ();
+    static const EPlace hollow_island ();
+    static const EPlace hollow_jungle ();
+    static const EPlace hollow_kernel ();
+    static const EPlace hollow_lagoon ();
+    static const EPlace hollow_meadow ();
+    static const EPlace hollow_nebula ();
+    static const EPlace hollow_orchard();
+    static const EPlace hollow_prairie();
+    static const EPlace hollow_quarry ();
+    static const EPlace hollow_river  ();
+    static const EPlace hollow_summit ();
+    static const EPlace hollow_tundra ();
+    static const EPlace hollow_valley ();
+    static const EPlace hollow_willow ();
+    static const EPlace hollow_yonder ();
+    static const EPlace hollow_zenith ();
+    static const EPlace ivory_anchor  ();
+    static const EPlace ivory_bridge  ();
+    static const EPlace ivory_canyon  ();
+    static const EPlace ivory_delta   ();
+    static const EPlace ivory_ember   ();
+    static const EPlace ivory_falcon  ();
+    static const EPlace ivory_glacier ();
+    static const EPlace ivory_harbor  ();
+    static const EPlace ivory_island  ();
+    static const EPlace ivory_jungle  ();
+    static const EPlace ivory_kernel  ();
+    static const EPlace ivory_lagoon  ();
+    static const EPlace ivory_meadow  ();
+    static const EPlace ivory_nebula  ();
+    static const EPlace ivory_orchard ();
+    static const EPlace ivory_prairie ();
+    static const EPlace ivory_quarry  ();
+    static const EPlace ivory_river   ();
+    static const EPlace ivory_summit  ();
+    static const EPlace ivory_tundra  ();
+    static const EPlace ivory_valley  ();
+    static const EPlace ivory_willow  ();
+    static const EPlace ivory_yonder  ();
+    static const EPlace ivory_zenith  ();
+    static const EPlace jolly_anchor  ();
+    static const EPlace jolly_bridge  ();
+    static const EPlace jolly_canyon  ();
+    static const EPlace jolly_delta   ();
+    static const EPlace jolly_ember   ();
+    static const EPlace jolly_falcon  ();
+    static const EPlace jolly_glacier ();
+    static const EPlace jolly_harbor  ();
+    static const EPlace jolly_island  ();
+    static const EPlace jolly_jungle  ();
+    static const EPlace jolly_kernel  ();
+    static const EPlace jolly_lagoon  ();
+    static const EPlace jolly_meadow  ();
+    static const EPlace jolly_nebula  ();
+    static const EPlace jolly_orchard ();
+    static const EPlace jolly_prairie ();
+    static const EPlace jolly_quarry  ();
+    static const EPlace jolly_river   ();
+    static const EPlace jolly_summit  ();
+    static const EPlace jolly_tundra  ();
+    static const EPlace jolly_valley  ();
+    static const EPlace jolly_willow  ();
+    static const EPlace jolly_yonder  ();
+    static const EPlace jolly_zenith  ();
+    static const EPlace keen_anchor   ();
+    static const EPlace keen_bridge   ();
+    static const EPlace keen_canyon   ();
+    static const EPlace keen_delta    ();
+    static const EPlace keen_ember    ();
+    static const EPlace keen_falcon   ();
+    static const EPlace keen_glacier  ();
+    static const EPlace keen_harbor   ();
+    static const EPlace keen_island   ();
+    static const EPlace keen_jungle   ();
+    static const EPlace keen_kernel   ();
+    static const EPlace keen_lagoon   ();
+    static const EPlace keen_meadow   ();
+    static const EPlace keen_nebula   ();
+    static const EPlace keen_orchard  ();
+    static const EPlace keen_prairie  ();
+    static const EPlace keen_quarry   ();
+    static const EPlace keen_river    ();
+    static const EPlace keen_summit   ();
+    static const EPlace keen_tundra   ();
+    static const EPlace keen_valley   ();
+    static const EPlace keen_willow   ();
+    static const EPlace keen_yonder   ();
+    static const EPlace keen_zenith   ();
+    static const EPlace lunar_anchor  ();
+    static const EPlace lunar_bridge  ();
+    static const EPlace lunar_canyon  ();
+    static const EPlace lunar_delta   ();
+    static const EPlace lunar_ember   ();
+    static const EPlace lunar_falcon  ();
+    static const EPlace lunar_glacier ();
+    static const EPlace lunar_harbor  ();
+    static const EPlace lunar_island  ();
+    static const EPlace lunar_jungle  ();
+    static const EPlace lunar_kernel  ();
+    static const EPlace lunar_lagoon  ();
+    static const EPlace lunar_meadow  ();
+    static const EPlace lunar_nebula  ();
+    static const EPlace lunar_orchard ();
+    static const EPlace lunar_prairie ();
+    static const EPlace lunar_quarry  ();
+    static const EPlace lunar_river   ();
+    static const EPlace lunar_summit  ();
+    static const EPlace lunar_tundra  ();
+    static const EPlace lunar_valley  ();
+    static const EPlace lunar_willow  ();
+    static const EPlace lunar_yonder  ();
+    static const EPlace lunar_zenith  ();
+    static const EPlace misty_anchor  ();
+    static const EPlace misty_bridge  ();
+    static const EPlace misty_canyon  ();
+    static const EPlace misty_delta   ();
+    static const EPlace misty_ember   ();
+    static const EPlace misty_falcon  ();
+    static const EPlace misty_glacier ();
+    static const EPlace misty_harbor  ();
+    static const EPlace misty_island  ();
+    static const EPlace misty_jungle  ();
+    static const EPlace misty_kernel  ();
+    static const EPlace misty_lagoon  ();
+    static const EPlace misty_meadow  ();
+    static const EPlace misty_nebula  ();
+    static const EPlace misty_orchard ();
+    static const EPlace misty_prairie ();
+    static const EPlace misty_quarry  ();
+    static const EPlace misty_river   ();
+    static const EPlace misty_summit  ();
+    static const EPlace misty_tundra  ();
+    static const EPlace misty_valley  ();
+    static const EPlace misty_willow  ();
+    static const EPlace misty_yonder  ();
+    static const EPlace misty_zenith  ();
+    static const EPlace noble_anchor  ();
+    static const EPlace noble_bridge  ();
+    static const EPlace noble_canyon  ();
+    static const EPlace noble_delta   ();
+    static const EPlace noble_ember   ();
+    static const EPlace noble_falcon  ();
+    static const EPlace noble_glacier ();
+    static const EPlace noble_harbor  ();
+    static const EPlace noble_island  ();
+    static const EPlace noble_jungle  ();
+    static const EPlace noble_kernel  ();
+    static const EPlace noble_lagoon  ();
+    static const EPlace noble_meadow  ();
+    static const EPlace noble_nebula  ();
+    static const EPlace noble_orchard ();
+    static const EPlace noble_prairie ();
+    static const EPlace noble_quarry  ();
+    static const EPlace noble_river   ();
+    static const EPlace noble_summit  ();
+    static const EPlace noble_tundra  ();
+    static const EPlace noble_valley  ();
+    static const EPlace noble_willow  ();
+    static const EPlace noble_yonder  ();
+    static const EPlace noble_zenith  ();
+    static const EPlace olive_anchor  ();
+    static const EPlace olive_bridge  ();
+    static const EPlace olive_canyon  ();
+    static const EPlace olive_delta   ();
+    static const EPlace olive_ember   ();
+    static const EPlace olive_falcon  ();
+    static const EPlace olive_glacier ();
+    static const EPlace olive_harbor  ();
+    static const EPlace olive_island  ();
+    static const EPlace olive_jungle  ();
+    static const EPlace olive_kernel  ();
+    static const EPlace olive_lagoon  ();
+    static const EPlace olive_meadow  ();
+    static const EPlace olive_nebula  ();
+    static const EPlace olive_orchard ();
+    static const EPlace olive_prairie ();
+    static const EPlace olive_quarry  ();
+    static const EPlace olive_river   ();
+    static const EPlace olive_summit  ();
+    static const EPlace olive_tundra  ();
+    static const EPlace olive_valley  ();
+    static const EPlace olive_willow  ();
+    static const EPlace olive_yonder  ();
+    static const EPlace olive_zenith  ();
+    static const EPlace prime_anchor  ();
+    static const EPlace prime_bridge  ();
+    static const EPlace prime_canyon  ();
+    static const EPlace prime_delta   ();
+    static const EPlace prime_ember   ();
+    static const EPlace prime_falcon  ();
+    static const EPlace prime_glacier ();
+    static const EPlace prime_harbor  ();
+    static const EPlace prime_island  ();
+    static const EPlace prime_jungle  ();
+    static const EPlace prime_kernel  ();
+    static const EPlace prime_lagoon  ();
+    static const EPlace prime_meadow  ();
+    static const EPlace prime_nebula  ();
+    static const EPlace prime_orchard ();
+    static const EPlace prime_prairie ();
+    static const EPlace prime_quarry  ();
+    static const EPlace prime_river   ();
+    static const EPlace prime_summit  ();
+    static const EPlace prime_tundra  ();
+    static const EPlace prime_valley  ();
+    static const EPlace prime_willow  ();
+    static const EPlace prime_yonder  ();
+    static const EPlace prime_zenith  ();
+    static const EPlace quiet_anchor  ();
+    static const EPlace quiet_bridge  ();
+    static const EPlace quiet_canyon  ();
+    static const EPlace quiet_delta   ();
+    static const EPlace quiet_ember   ();
+    static const EPlace quiet_falcon  ();
+    static const EPlace quiet_glacier ();
+    static const EPlace quiet_harbor  ();
+    static const EPlace quiet_island  ();
+    static const EPlace quiet_jungle  ();
+    static const EPlace quiet_kernel  ();
+    static const EPlace quiet_lagoon  ();
+    static const EPlace quiet_meadow  ();
+    static const EPlace quiet_nebula  ();
+    static const EPlace quiet_orchard ();
+    static const EPlace quiet_prairie ();
+    static const EPlace quiet_quarry  ();
+    static const EPlace quiet_river   ();
+    static const EPlace quiet_summit  ();
+    static const EPlace quiet_tundra  ();
+    static const EPlace quiet_valley  ();
+    static const EPlace quiet_willow  ();
+    static const EPlace quiet_yonder  ();
+    static const EPlace quiet_zenith  ();
+    static const EPlace rapid_anchor  ();
+    static const EPlace rapid_bridge  ();
+    static const EPlace rapid_canyon  ();
+    static const EPlace rapid_delta   ();
+    static const EPlace rapid_ember   ();
+    static const EPlace rapid_falcon  ();
+    static const EPlace rapid_glacier ();
+    static const EPlace rapid_harbor  ();
+    static const EPlace rapid_island  ();
+    static const EPlace rapid_jungle  ();
+    static const EPlace rapid_kernel  ();
+    static const EPlace rapid_lagoon  ();
+    static const EPlace rapid_meadow  ();
+    static const EPlace rapid_nebula  ();
+    static const EPlace rapid_orchard ();
+    static const EPlace rapid_prairie ();
+    static const EPlace rapid_quarry  ();
+    static const EPlace rapid_river   ();
+    static const EPlace rapid_summit  ();
+    static const EPlace rapid_tundra  ();
+    static const EPlace rapid_valley  ();
+    static const EPlace rapid_willow  ();
+    static const EPlace rapid_yonder  ();
+    static const EPlace rapid_zenith  ();
+    static const EPlace solar_anchor  ();
+    static const EPlace solar_bridge  ();
+    static const EPlace solar_canyon  ();
+    static const EPlace solar_delta   ();
+    static const EPlace solar_ember   ();
+    static const EPlace solar_falcon  ();
+    static const EPlace solar_glacier ();
+    static const EPlace solar_harbor  ();
+    static const EPlace solar_island  ();
+    static const EPlace solar_jungle  ();
+    static const EPlace solar_kernel  ();
+    static const EPlace solar_lagoon  ();
+    static const EPlace solar_meadow  ();
+    static const EPlace solar_nebula  ();
+    static const EPlace solar_orchard ();
+    static const EPlace solar_prairie ();
+    static const EPlace solar_quarry  ();
+    static const EPlace solar_river   ();
+    static const EPlace solar_summit  ();
+    static const EPlace solar_tundra  ();
+    static const EPlace solar_valley  ();
+    static const EPlace solar_willow  ();
+    static const EPlace solar_yonder  ();
+    static const EPlace solar_zenith  ();
+    static const EPlace tidal_anchor  ();
+    static const EPlace tidal_bridge  ();
+    static const EPlace tidal_canyon  ();
+    static const EPlace tidal_delta   ();
+    static const EPlace tidal_ember   ();
+    static const EPlace tidal_falcon  ();
+    static const EPlace tidal_glacier ();
+    static const EPlace tidal_harbor  ();
+    static const EPlace tidal_island  ();
+    static const EPlace tidal_jungle  ();
+    static const EPlace tidal_kernel  ();
+    static const EPlace tidal_lagoon  ();
+    static const EPlace tidal_meadow  ();
+    static const EPlace tidal_nebula  ();
+    static const EPlace tidal_orchard ();
+    static const EPlace tidal_prairie ();
+    static const EPlace tidal_quarry  ();
+    static const EPlace tidal_river   ();
+    static const EPlace tidal_summit  ();
+    static const EPlace tidal_tundra  ();
+    static const EPlace tidal_valley  ();
+    static const EPlace tidal_willow  ();
+    static const EPlace tidal_yonder  ();
+    static const EPlace tidal_zenith  ();
+    static const EPlace urban_anchor  ();
+    static const EPlace urban_bridge  ();
+    static const EPlace urban_canyon  ();
+    static const EPlace urban_delta   ();
+    static const EPlace urban_ember   ();
+    static const EPlace urban_falcon  ();
+    static const EPlace urban_glacier ();
+    static const EPlace urban_harbor  ();
+    static const EPlace urban_island  ();
+    static const EPlace urban_jungle  ();
+    static const EPlace urban_kernel  ();
+    static const EPlace urban_lagoon  ();
+    static const EPlace urban_meadow  ();
+    static const EPlace urban_nebula  ();
+    static const EPlace urban_orchard ();
+    static const EPlace urban_prairie ();
+    static const EPlace urban_quarry  ();
+    static const EPlace urban_river   ();
+    static const EPlace urban_summit  ();
+    static const EPlace urban_tundra  ();
+    static const EPlace urban_valley  ();
+    static const EPlace urban_willow  ();
+    static const EPlace urban_yonder  ();
+    static const EPlace urban_zenith  ();
+    static const EPlace vivid_anchor  ();
+    static const EPlace vivid_bridge  ();
+    static const EPlace vivid_canyon  ();
+    static const EPlace vivid_delta   ();
+    static const EPlace vivid_ember   ();
+    static const EPlace vivid_falcon  ();
+    static const EPlace vivid_glacier ();
+    static const EPlace vivid_harbor  ();
+    static const EPlace vivid_island  ();
+    static const EPlace vivid_jungle  ();
+    static const EPlace vivid_kernel  ();
+    static const EPlace vivid_lagoon  ();
+    static const EPlace vivid_meadow  ();
+    static const EPlace vivid_nebula  ();
+    static const EPlace vivid_orchard ();
+    static const EPlace vivid_prairie ();
+    static const EPlace vivid_quarry  ();
+    static const EPlace vivid_river   ();
+    static const EPlace vivid_summit  ();
+    static const EPlace vivid_tundra  ();
+    static const EPlace vivid_valley  ();
+    static const EPlace vivid_willow  ();
+    static const EPlace vivid_yonder  ();
+    static const EPlace vivid_zenith  ();
+    static const EPlace windy_anchor  ();
+    static const EPlace windy_bridge  ();
+    static const EPlace windy_canyon  ();
+    static const EPlace windy_delta   ();
+    static const EPlace windy_ember   ();
+    static const EPlace windy_falcon  ();
+    static const EPlace windy_glacier ();
+    static const EPlace windy_harbor  ();
+    static const EPlace windy_island  ();
+    static const EPlace windy_jungle  ();
+    static const EPlace windy_kernel  ();
+    static const EPlace windy_lagoon  ();
+    static const EPlace windy_meadow  ();
+    static const EPlace windy_nebula  ();
+    static const EPlace windy_orchard ();
+    static const EPlace windy_prairie ();
+    static const EPlace windy_quarry  ();
+    static const EPlace windy_river   ();
+    static const EPlace windy_summit  ();
+    static const EPlace windy_tundra  ();
+    static const EPlace windy_valley  ();
+    static const EPlace windy_willow  ();
+    static const EPlace windy_yonder  ();
+    static const EPlace windy_zenith  ();
+    static const EPlace young_anchor  ();
+    static const EPlace young_bridge  ();
+    static const EPlace young_canyon  ();
+    static const EPlace young_delta   ();
+    static const EPlace young_ember   ();
+    static const EPlace young_falcon  ();
+    static const EPlace young_glacier ();
+    static const EPlace young_harbor  ();
+    static const EPlace young_island  ();
+    static const EPlace young_jungle  ();
+    static const EPlace young_kernel  ();
+    static const EPlace young_lagoon  ();
+    static const EPlace young_meadow  ();
+    static const EPlace young_nebula  ();
+    static const EPlace young_orchard ();
+    static const EPlace young_prairie ();
+    static const EPlace young_quarry  ();
+    static const EPlace young_river   ();
+    static const EPlace young_summit  ();
+    static const EPlace young_tundra  ();
+    static const EPlace young_valley  ();
+    static const EPlace young_willow  ();
+    static const EPlace young_yonder  ();
+    static const EPlace young_zenith  ();
+    static const EPlace zonal_anchor  ();
+    static const EPlace zonal_bridge  ();
+    static const EPlace zonal_canyon  ();
+    static const EPlace zonal_delta   ();
+    static const EPlace zonal_ember   ();
+    static const EPlace zonal_falcon  ();
+    static const EPlace zonal_glacier ();
+    static const EPlace zonal_harbor  ();
+    static const EPlace zonal_island  ();
+    static const EPlace zonal_jungle  ();
+    static const EPlace zonal_kernel  ();
+    static const EPlace zonal_lagoon  ();
+    static const EPlace zonal_meadow  ();
+    static const EPlace zonal_nebula  ();
+    static const EPlace zonal_orchard ();
+    static const EPlace zonal_prairie ();
+    static const EPlace zonal_quarry  ();
+    static const EPlace zonal_river   ();
+    static const EPlace zonal_summit  ();
+    static const EPlace zonal_tundra  ();
+    static const EPlace zonal_valley  ();
+    static const EPlace zonal_willow  ();
+    static const EPlace zonal_yonder  ();
+    static const EPlace zonal_zenith  ();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid        = 0,
+        kAmber_anchor   = 1,
+        kAmber_bridge   = 2,
+        kAmber_canyon   = 3,
+        kAmber_delta    = 4,
+        kAmber_ember    = 5,
+        kAmber_falcon   = 6,
+        kAmber_glacier  = 7,
+        kAmber_harbor   = 8,
+        kAmber_island   = 9,
+        kAmber_jungle   = 10,
+        kAmber_kernel   = 11,
+        kAmber_lagoon   = 12,
+        kAmber_meadow   = 13,
+        kAmber_nebula   = 14,
+        kAmber_orchard  = 15,
+        kAmber_prairie  = 16,
+        kAmber_quarry   = 17,
+        kAmber_river    = 18,
+        kAmber_summit   = 19,
+        kAmber_tundra   = 20,
+        kAmber_valley   = 21,
+        kAmber_willow   = 22,
+        kAmber_yonder   = 23,
+        kAmber_zenith   = 24,
+        kBrisk_anchor   = 25,
+        kBrisk_bridge   = 26,
+        kBrisk_canyon   = 27,
+        kBrisk_delta    = 28,
+        kBrisk_ember    = 29,
+        kBrisk_falcon   = 30,
+        kBrisk_glacier  = 31,
+        kBrisk_harbor   = 32,
+        kBrisk_island   = 33,
+        kBrisk_jungle   = 34,
+        kBrisk_kernel   = 35,
+        kBrisk_lagoon   = 36,
+        kBrisk_meadow   = 37,
+        kBrisk_nebula   = 38,
+        kBrisk_orchard  = 39,
+        kBrisk_prairie  = 40,
+        kBrisk_quarry   = 41,
+        kBrisk_river    = 42,
+        kBrisk_summit   = 43,
+        kBrisk_tundra   = 44,
+        kBrisk_valley   = 45,
+        kBrisk_willow   = 46,
+        kBrisk_yonder   = 47,
+        kBrisk_zenith   = 48,
+        kCoral_anchor   = 49,
+        kCoral_bridge   = 50,
+        kCoral_canyon   = 51,
+        kCoral_delta    = 52,
+        kCoral_ember    = 53,
+        kCoral_falcon   = 54,
+        kCoral_glacier  = 55,
+        kCoral_harbor   = 56,
+        kCoral_island   = 57,
+        kCoral_jungle   = 58,
+        kCoral_kernel   = 59,
+        kCoral_lagoon   = 60,
+        kCoral_meadow   = 61,
+        kCoral_nebula   = 62,
+        kCoral_orchard  = 63,
+        kCoral_prairie  = 64,
+        kCoral_quarry   = 65,
+        kCoral_river    = 66,
+        kCoral_summit   = 67,
+        kCoral_tundra   = 68,
+        kCoral_valley   = 69,
+        kCoral_willow   = 70,
+        kCoral_yonder   = 71,
+        kCoral_zenith   = 72,
+        kDusty_anchor   = 73,
+        kDusty_bridge   = 74,
+        kDusty_canyon   = 75,
+        kDusty_delta    = 76,
+        kDusty_ember    = 77,
+        kDusty_falcon   = 78,
+        kDusty_glacier  = 79,
+        kDusty_harbor   = 80,
+        kDusty_island   = 81,
+        kDusty_jungle   = 82,
+        kDusty_kernel   = 83,
+        kDusty_lagoon   = 84,
+        kDusty_meadow   = 85,
+        kDusty_nebula   = 86,
+        kDusty_orchard  = 87,
+        kDusty_prairie  = 88,
+        kDusty_quarry   = 89,
+        kDusty_river    = 90,
+        kDusty_summit   = 91,
+        kDusty_tundra   = 92,
+        kDusty_valley   = 93,
+        kDusty_willow   = 94,
+        kDusty_yonder   = 95,
+        kDusty_zenith   = 96,
+        kEarly_anchor   = 97,
+        kEarly_bridge   = 98,
+        kEarly_canyon   = 99,
+        kEarly_delta    = 100,
+        kEarly_ember    = 101,
+        kEarly_falcon   = 102,
+        kEarly_glacier  = 103,
+        kEarly_harbor   = 104,
+        kEarly_island   = 105,
+        kEarly_jungle   = 106,
+        kEarly_kernel   = 107,
+        kEarly_lagoon   = 108,
+        kEarly_meadow   = 109,
+        kEarly_nebula   = 110,
+        kEarly_orchard  = 111,
+        kEarly_prairie  = 112,
+        kEarly_quarry   = 113,
+        kEarly_river    = 114,
+        kEarly_summit   = 115,
+        kEarly_tundra   = 116,
+        kEarly_valley   = 117,
+        kEarly_willow   = 118,
+        kEarly_yonder   = 119,
+        kEarly_zenith   = 120,
+        kFaint_anchor   = 121,
+        kFaint_bridge   = 122,
+        kFaint_canyon   = 123,
+        kFaint_delta    = 124,
+        kFaint_ember    = 125,
+        kFaint_falcon   = 126,
+        kFaint_glacier  = 127,
+        kFaint_harbor   = 128,
+        kFaint_island   = 129,
+        kFaint_jungle   = 130,
+        kFaint_kernel   = 131,
+        kFaint_lagoon   = 132,
+        kFaint_meadow   = 133,
+        kFaint_nebula   = 134,
+        kFaint_orchard  = 135,
+        kFaint_prairie  = 136,
+        kFaint_quarry   = 137,
+        kFaint_river    = 138,
+        kFaint_summit   = 139,
+        kFaint_tundra   = 140,
+        kFaint_valley   = 141,
+        kFaint_willow   = 142,
+        kFaint_yonder   = 143,
+        kFaint_zenith   = 144,
+        kGiant_anchor   = 145,
+        kGiant_bridge   = 146,
+        kGiant_canyon   = 147,
+        kGiant_delta    = 148,
+        kGiant_ember    = 149,
+        kGiant_falcon   = 150,
+        kGiant_glacier  = 151,
+        kGiant_harbor   = 152,
+        kGiant_island   = 153,
+        kGiant_jungle   = 154,
+        kGiant_kernel   = 155,
+        kGiant_lagoon   = 156,
+        kGiant_meadow   = 157,
+        kGiant_nebula   = 158,
+        kGiant_orchard  = 159,
+        kGiant_prairie  = 160,
+        kGiant_quarry   = 161,
+        kGiant_river    = 162,
+        kGiant_summit   = 163,
+        kGiant_tundra   = 164,
+        kGiant_valley   = 165,
+        kGiant_willow   = 166,
+        kGiant_yonder   = 167,
+        kGiant_zenith   = 168,
+        kHollow_anchor  = 169,
+        kHollow_bridge  = 170,
+        kHollow_canyon  = 171,
+        kHollow_delta   = 172,
+        kHollow_ember   = 173,
+        kHollow_falcon  = 174,
+        kHollow_glacier = 175,
+        kHollow_harbor  = 176,
+        kHollow_island  = 177,
+        kHollow_jungle  = 178,
+        kHollow_kernel  = 179,
+        kHollow_lagoon  = 180,
+        kHollow_meadow  = 181,
+        kHollow_nebula  = 182,
+        kHollow_orchard = 183,
+        kHollow_prairie = 184,
+        kHollow_quarry  = 185,
+        kHollow_river   = 186,
+        kHollow_summit  = 187,
+        kHollow_tundra  = 188,
+        kHollow_valley  = 189,
+        kHollow_willow  = 190,
+        kHollow_yonder  = 191,
+        kHollow_zenith  = 192,
+        kIvory_anchor   = 193,
+        kIvory_bridge   = 194,
+        kIvory_canyon   = 195,
+        kIvory_delta    = 196,
+        kIvory_ember    = 197,
+        kIvory_falcon   = 198,
+        kIvory_glacier  = 199,
+        kIvory_harbor   = 200,
+        kIvory_island   = 201,
+        kIvory_jungle   = 202,
+        kIvory_kernel   = 203,
+        kIvory_lagoon   = 204,
+        kIvory_meadow   = 205,
+        kIvory_nebula   = 206,
+        kIvory_orchard  = 207,
+        kIvory_prairie  = 208,
+        kIvory_quarry   = 209,
+        kIvory_river    = 210,
+        kIvory_summit   = 211,
+        kIvory_tundra   = 212,
+        kIvory_valley   = 213,
+        kIvory_willow   = 214,
+        kIvory_yonder   = 215,
+        kIvory_zenith   = 216,
+        kJolly_anchor   = 217,
+        kJolly_bridge   = 218,
+        kJolly_canyon   = 219,
+        kJolly_delta    = 220,
+        kJolly_ember    = 221,
+        kJolly_falcon   = 222,
+        kJolly_glacier  = 223,
+        kJolly_harbor   = 224,
+        kJolly_island   = 225,
+        kJolly_jungle   = 226,
+        kJolly_kernel   = 227,
+        kJolly_lagoon   = 228,
+        kJolly_meadow   = 229,
+        kJolly_nebula   = 230,
+        kJolly_orchard  = 231,
+        kJolly_prairie  = 232,
+        kJolly_quarry   = 233,
+        kJolly_river    = 234,
+        kJolly_summit   = 235,
+        kJolly_tundra   = 236,
+        kJolly_valley   = 237,
+        kJolly_willow   = 238,
+        kJolly_yonder   = 239,
+        kJolly_zenith   = 240,
+        kKeen_anchor    = 241,
+        kKeen_bridge    = 242,
+        kKeen_canyon    = 243,
+        kKeen_delta     = 244,
+        kKeen_ember     = 245,
+        kKeen_falcon    = 246,
+        kKeen_glacier   = 247,
+        kKeen_harbor    = 248,
+        kKeen_island    = 249,
+        kKeen_jungle    = 250,
+        kKeen_kernel    = 251,
+        kKeen_lagoon    = 252,
+        kKeen_meadow    = 253,
+        kKeen_nebula    = 254,
+        kKeen_orchard   = 255,
+        kKeen_prairie   = 256,
+        kKeen_quarry    = 257,
+        kKeen_river     = 258,
+        kKeen_summit    = 259,
+        kKeen_tundra    = 260,
+        kKeen_valley    = 261,
+        kKeen_willow    = 262,
+        kKeen_yonder    = 263,
+        kKeen_zenith    = 264,
+        kLunar_anchor   = 265,
+        kLunar_bridge   = 266,
+        kLunar_canyon   = 267,
+        kLunar_delta    = 268,
+        kLunar_ember    = 269,
+        kLunar_falcon   = 270,
+        kLunar_glacier  = 271,
+        kLunar_harbor   = 272,
+        kLunar_island   = 273,
+        kLunar_jungle   = 274,
+        kLunar_kernel   = 275,
+        kLunar_lagoon   = 276,
+        kLunar_meadow   = 277,
+        kLunar_nebula   = 278,
+        kLunar_orchard  = 279,
+        kLunar_prairie  = 280,
+        kLunar_quarry   = 281,
+        kLunar_river    = 282,
+        kLunar_summit   = 283,
+        kLunar_tundra   = 284,
+        kLunar_valley   = 285,
+        kLunar_willow   = 286,
+        kLunar_yonder   = 287,
+        kLunar_zenith   = 288,
+        kMisty_anchor   = 289,
+        kMisty_bridge   = 290,
+        kMisty_canyon   = 291,
+        kMisty_delta    = 292,
+        kMisty_ember    = 293,
+        kMisty_falcon   = 294,
+        kMisty_glacier  = 295,
+        kMisty_harbor   = 296,
+        kMisty_island   = 297,
+        kMisty_jungle   = 298,
+        kMisty_kernel   = 299,
+        kMisty_lagoon   = 300,
+        kMisty_meadow   = 301,
+        kMisty_nebula   = 302,
+        kMisty_orchard  = 303,
+        kMisty_prairie  = 304,
+        kMisty_quarry   = 305,
+        kMisty_river    = 306,
+        kMisty_summit   = 307,
+        kMisty_tundra   = 308,
+        kMisty_valley   = 309,
+        kMisty_willow   = 310,
+        kMisty_yonder   = 311,
+        kMisty_zenith   = 312,
+        kNoble_anchor   = 313,
+        kNoble_bridge   = 314,
+        kNoble_canyon   = 315,
+        kNoble_delta    = 316,
+        kNoble_ember    = 317,
+        kNoble_falcon   = 318,
+        kNoble_glacier  = 319,
+        kNoble_harbor   = 320,
+        kNoble_island   = 321,
+        kNoble_jungle   = 322,
+        kNoble_kernel   = 323,
+        kNoble_lagoon   = 324,
+        kNoble_meadow   = 325,
+        kNoble_nebula   = 326,
+        kNoble_orchard  = 327,
+        kNoble_prairie  = 328,
+        kNoble_quarry   = 329,
+        kNoble_river    = 330,
+        kNoble_summit   = 331,
+        kNoble_tundra   = 332,
+        kNoble_valley   = 333,
+        kNoble_willow   = 334,
+        kNoble_yonder   = 335,
+        kNoble_zenith   = 336,
+        kOlive_anchor   = 337,
+        kOlive_bridge   = 338,
+        kOlive_canyon   = 339,
+        kOlive_delta    = 340,
+        kOlive_ember    = 341,
+        kOlive_falcon   = 342,
+        kOlive_glacier  = 343,
+        kOlive_harbor   = 344,
+        kOlive_island   = 345,
+        kOlive_jungle   = 346,
+        kOlive_kernel   = 347,
+        kOlive_lagoon   = 348,
+        kOlive_meadow   = 349,
+        kOlive_nebula   = 350,
+        kOlive_orchard  = 351,
+        kOlive_prairie  = 352,
+        kOlive_quarry   = 353,
+        kOlive_river    = 354,
+        kOlive_summit   = 355,
+        kOlive_tundra   = 356,
+        kOlive_valley   = 357,
+        kOlive_willow   = 358,
+        kOlive_yonder   = 359,
+        kOlive_zenith   = 360,
+        kPrime_anchor   = 361,
+        kPrime_bridge   = 362,
+        kPrime_canyon   = 363,
+        kPrime_delta    = 364,
+        kPrime_ember    = 365,
+        kPrime_falcon   = 366,
+        kPrime_glacier  = 367,
+        kPrime_harbor   = 368,
+        kPrime_island   = 369,
+        kPrime_jungle   = 370,
+        kPrime_kernel   = 371,
+        kPrime_lagoon   = 372,
+        kPrime_meadow   = 373,
+        kPrime_nebula   = 374,
+        kPrime_orchard  = 375,
+        kPrime_prairie  = 376,
+        kPrime_quarry   = 377,
+        kPrime_river    = 378,
+        kPrime_summit   = 379,
+        kPrime_tundra   = 380,
+        kPrime_valley   = 381,
+        kPrime_willow   = 382,
+        kPrime_yonder   = 383,
+        kPrime_zenith   = 384,
+        kQuiet_anchor   = 385,
+        kQuiet_bridge   = 386,
+        kQuiet_canyon   = 387,
+        kQuiet_delta    = 388,
+        kQuiet_ember    = 389,
+        kQuiet_falcon   = 390,
+        kQuiet_glacier  = 391,
+        kQuiet_harbor   = 392,
+        kQuiet_island   = 393,
+        kQuiet_jungle   = 394,
+        kQuiet_kernel   = 395,
+        kQuiet_lagoon   = 396,
+        kQuiet_meadow   = 397,
+        kQuiet_nebula   = 398,
+        kQuiet_orchard  = 399,
+        kQuiet_prairie  = 400,
+        kQuiet_quarry   = 401,
+        kQuiet_river    = 402,
+        kQuiet_summit   = 403,
+        kQuiet_tundra   = 404,
+        kQuiet_valley   = 405,
+        kQuiet_willow   = 406,
+        kQuiet_yonder   = 407,
+        kQuiet_zenith   = 408,
+        kRapid_anchor   = 409,
+        kRapid_bridge   = 410,
+        kRapid_canyon   = 411,
+        kRapid_delta    = 412,
+        kRapid_ember    = 413,
+        kRapid_falcon   = 414,
+        kRapid_glacier  = 415,
+        kRapid_harbor   = 416,
+        kRapid_island   = 417,
+        kRapid_jungle   = 418,
+        kRapid_kernel   = 419,
+        kRapid_lagoon   = 420,
+        kRapid_meadow   = 421,
+        kRapid_nebula   = 422,
+        kRapid_orchard  = 423,
+        kRapid_prairie  = 424,
+        kRapid_quarry   = 425,
+        kRapid_river    = 426,
+        kRapid_summit   = 427,
+        kRapid_tundra   = 428,
+        kRapid_valley   = 429,
+        kRapid_willow   = 430,
+        kRapid_yonder   = 431,
+        kRapid_zenith   = 432,
+        kSolar_anchor   = 433,
+        kSolar_bridge   = 434,
+        kSolar_canyon   = 435,
+        kSolar_delta    = 436,
+        kSolar_ember    = 437,
+        kSolar_falcon   = 438,
+        kSolar_glacier  = 439,
+        kSolar_harbor   = 440,
+        kSolar_island   = 441,
+        kSolar_jungle   = 442,
+        kSolar_kernel   = 443,
+        kSolar_lagoon   = 444,
+        kSolar_meadow   = 445,
+        kSolar_nebula   = 446,
+        kSolar_orchard  = 447,
+        kSolar_prairie  = 448,
+        kSolar_quarry   = 449,
+        kSolar_river    = 450,
+        kSolar_summit   = 451,
+        kSolar_tundra   = 452,
+        kSolar_valley   = 453,
+        kSolar_willow   = 454,
+        kSolar_yonder   = 455,
+        kSolar_zenith   = 456,
+        kTidal_anchor   = 457,
+        kTidal_bridge   = 458,
+        kTidal_canyon   = 459,
+        kTidal_delta    = 460,
+        kTidal_ember    = 461,
+        kTidal_falcon   = 462,
+        kTidal_glacier  = 463,
+        kTidal_harbor   = 464,
+        kTidal_island   = 465,
+        kTidal_jungle   = 466,
+        kTidal_kernel   = 467,
+        kTidal_lagoon   = 468,
+        kTidal_meadow   = 469,
+        kTidal_nebula   = 470,
+        kTidal_orchard  = 471,
+        kTidal_prairie  = 472,
+        kTidal_quarry   = 473,
+        kTidal_river    = 474,
+        kTidal_summit   = 475,
+        kTidal_tundra   = 476,
+        kTidal_valley   = 477,
+        kTidal_willow   = 478,
+        kTidal_yonder   = 479,
+        kTidal_zenith   = 480,
+        kUrban_anchor   = 481,
+        kUrban_bridge   = 482,
+        kUrban_canyon   = 483,
+        kUrban_delta    = 484,
+        kUrban_ember    = 485,
+        kUrban_falcon   = 486,
+        kUrban_glacier  = 487,
+        kUrban_harbor   = 488,
+        kUrban_island   = 489,
+        kUrban_jungle   = 490,
+        kUrban_kernel   = 491,
+        kUrban_lagoon   = 492,
+        kUrban_meadow   = 493,
+        kUrban_nebula   = 494,
+        kUrban_orchard  = 495,
+        kUrban_prairie  = 496,
+        kUrban_quarry   = 497,
+        kUrban_river    = 498,
+        kUrban_summit   = 499,
+        kUrban_tundra   = 500,
+        kUrban_valley   = 501,
+        kUrban_willow   = 502,
+        kUrban_yonder   = 503,
+        kUrban_zenith   = 504,
+        kVivid_anchor   = 505,
+        kVivid_bridge   = 506,
+        kVivid_canyon   = 507,
+        kVivid_delta    = 508,
+        kVivid_ember    = 509,
+        kVivid_falcon   = 510,
+        kVivid_glacier  = 511,
+        kVivid_harbor   = 512,
+        kVivid_island   = 513,
+        kVivid_jungle   = 514,
+        kVivid_kernel   = 515,
+        kVivid_lagoon   = 516,
+        kVivid_meadow   = 517,
+        kVivid_nebula   = 518,
+        kVivid_orchard  = 519,
+        kVivid_prairie  = 520,
+        kVivid_quarry   = 521,
+        kVivid_river    = 522,
+        kVivid_summit   = 523,
+        kVivid_tundra   = 524,
+        kVivid_valley   = 525,
+        kVivid_willow   = 526,
+        kVivid_yonder   = 527,
+        kVivid_zenith   = 528,
+        kWindy_anchor   = 529,
+        kWindy_bridge   = 530,
+        kWindy_canyon   = 531,
+        kWindy_delta    = 532,
+        kWindy_ember    = 533,
+        kWindy_falcon   = 534,
+        kWindy_glacier  = 535,
+        kWindy_harbor   = 536,
+        kWindy_island   = 537,
+        kWindy_jungle   = 538,
+        kWindy_kernel   = 539,
+        kWindy_lagoon   = 540,
+        kWindy_meadow   = 541,
+        kWindy_nebula   = 542,
+        kWindy_orchard  = 543,
+        kWindy_prairie  = 544,
+        kWindy_quarry   = 545,
+        kWindy_river    = 546,
+        kWindy_summit   = 547,
+        kWindy_tundra   = 548,
+        kWindy_valley   = 549,
+        kWindy_willow   = 550,
+        kWindy_yonder   = 551,
+        kWindy_zenith   = 552,
+        kYoung_anchor   = 553,
+        kYoung_bridge   = 554,
+        kYoung_canyon   = 555,
+        kYoung_delta    = 556,
+        kYoung_ember    = 557,
+        kYoung_falcon   = 558,
+        kYoung_glacier  = 559,
+        kYoung_harbor   = 560,
+        kYoung_island   = 561,
+        kYoung_jungle   = 562,
+        kYoung_kernel   = 563,
+        kYoung_lagoon   = 564,
+        kYoung_meadow   = 565,
+        kYoung_nebula   = 566,
+        kYoung_orchard  = 567,
+        kYoung_prairie  = 568,
+        kYoung_quarry   = 569,
+        kYoung_river    = 570,
+        kYoung_summit   = 571,
+        kYoung_tundra   = 572,
+        kYoung_valley   = 573,
+        kYoung_willow   = 574,
+        kYoung_yonder   = 575,
+        kYoung_zenith   = 576,
+        kZonal_anchor   = 577,
+        kZonal_bridge   = 578,
+        kZonal_canyon   = 579,
+        kZonal_delta    = 580,
+        kZonal_ember    = 581,
+        kZonal_falcon   = 582,
+        kZonal_glacier  = 583,
+        kZonal_harbor   = 584,
+        kZonal_island   = 585,
+        kZonal_jungle   = 586,
+        kZonal_kernel   = 587,
+        kZonal_lagoon   = 588,
+        kZonal_meadow   = 589,
+        kZonal_nebula   = 590,
+        kZonal_orchard  = 591,
+        kZonal_prairie  = 592,
+        kZonal_quarry   = 593,
+        kZonal_river    = 594,
+        kZonal_summit   = 595,
+        kZonal_tundra   = 596,
+        kZonal_valley   = 597,
+        kZonal_willow   = 598,
+        kZonal_yonder   = 599,
+        kZonal_zenith   = 600,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+}
+
+#endif // __STRUCTURE_FROM_STRING_COMPIL_H_
+
@@ -0,0 +1,95 @@
+#ifndef __STRUCTURE_IDENTIFICATION_COMPIL__FWD_H_
+#define __STRUCTURE_IDENTIFICATION_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace identification
+{
+
+// Forward declarations
+class Structure1;
+typedef Structure1*                         Structure1RPtr;
+typedef boost::shared_ptr<Structure1>       Structure1SPtr;
+typedef boost::shared_ptr<const Structure1> Structure1SCPtr;
+typedef boost::weak_ptr<Structure1>         Structure1WPtr;
+
+class EStructure1Id;
+
+class Structure2a;
+typedef Structure2a*                         Structure2aRPtr;
+typedef boost::shared_ptr<Structure2a>       Structure2aSPtr;
+typedef boost::shared_ptr<const Structure2a> Structure2aSCPtr;
+typedef boost::weak_ptr<Structure2a>         Structure2aWPtr;
+
+class Structure2b;
+typedef Structure2b*                         Structure2bRPtr;
+typedef boost::shared_ptr<Structure2b>       Structure2bSPtr;
+typedef boost::shared_ptr<const Structure2b> Structure2bSCPtr;
+typedef boost::weak_ptr<Structure2b>         Structure2bWPtr;
+
+class Structure3aa;
+typedef Structure3aa*                         Structure3aaRPtr;
+typedef boost::shared_ptr<Structure3aa>       Structure3aaSPtr;
+typedef boost::shared_ptr<const Structure3aa> Structure3aaSCPtr;
+typedef boost::weak_ptr<Structure3aa>         Structure3aaWPtr;
+
+class Structure3ab;
+typedef Structure3ab*                         Structure3abRPtr;
+typedef boost::shared_ptr<Structure3ab>       Structure3abSPtr;
+typedef boost::shared_ptr<const Structure3ab> Structure3abSCPtr;
+typedef boost::weak_ptr<Structure3ab>         Structure3abWPtr;
+
+class Structure3ba;
+typedef Structure3ba*                         Structure3baRPtr;
+typedef boost::shared_ptr<Structure3ba>       Structure3baSPtr;
+typedef boost::shared_ptr<const Structure3ba> Structure3baSCPtr;
+typedef boost::weak_ptr<Structure3ba>         Structure3baWPtr;
+
+class Structure3bb;
+typedef Structure3bb*                         Structure3bbRPtr;
+typedef boost::shared_ptr<Structure3bb>       Structure3bbSPtr;
+typedef boost::shared_ptr<const Structure3bb> Structure3bbSCPtr;
+typedef boost::weak_ptr<Structure3bb>         Structure3bbWPtr;
+
+class Structure1aFactory;
+typedef Structure1aFactory*                         Structure1aFactoryRPtr;
+typedef boost::shared_ptr<Structure1aFactory>       Structure1aFactorySPtr;
+typedef boost::shared_ptr<const Structure1aFactory> Structure1aFactorySCPtr;
+typedef boost::weak_ptr<Structure1aFactory>         Structure1aFactoryWPtr;
+
+typedef EStructure1Id*                         EStructure1IdRPtr;
+typedef boost::shared_ptr<EStructure1Id>       EStructure1IdSPtr;
+typedef boost::shared_ptr<const EStructure1Id> EStructure1IdSCPtr;
+typedef boost::weak_ptr<EStructure1Id>         EStructure1IdWPtr;
+
+class SharedStructure1;
+typedef SharedStructure1*                         SharedStructure1RPtr;
+typedef boost::shared_ptr<SharedStructure1>       SharedStructure1SPtr;
+typedef boost::shared_ptr<const SharedStructure1> SharedStructure1SCPtr;
+typedef boost::weak_ptr<SharedStructure1>         SharedStructure1WPtr;
+
+class ESharedStructure1Id;
+
+class SharedStructure2;
+typedef SharedStructure2*                         SharedStructure2RPtr;
+typedef boost::shared_ptr<SharedStructure2>       SharedStructure2SPtr;
+typedef boost::shared_ptr<const SharedStructure2> SharedStructure2SCPtr;
+typedef boost::weak_ptr<SharedStructure2>         SharedStructure2WPtr;
+
+class SharedStructure1Factory;
+typedef SharedStructure1Factory*                         SharedStructure1FactoryRPtr;
+typedef boost::shared_ptr<SharedStructure1Factory>       SharedStructure1FactorySPtr;
+typedef boost::shared_ptr<const SharedStructure1Factory> SharedStructure1FactorySCPtr;
+typedef boost::weak_ptr<SharedStructure1Factory>         SharedStructure1FactoryWPtr;
+
+typedef ESharedStructure1Id*                         ESharedStructure1IdRPtr;
+typedef boost::shared_ptr<ESharedStructure1Id>       ESharedStructure1IdSPtr;
+typedef boost::shared_ptr<const ESharedStructure1Id> ESharedStructure1IdSCPtr;
+typedef boost::weak_ptr<ESharedStructure1Id>         ESharedStructure1IdWPtr;
+
+}
+
+#endif // __STRUCTURE_IDENTIFICATION_COMPIL__FWD_H_
+
@@ -0,0 +1,20 @@
+#include "structure/identification.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace identification
+{
+
+
+
+
+
+
+
+
+
+
+}
+
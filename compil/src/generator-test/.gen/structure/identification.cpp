@@ -0,0 +1,1082 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "structure/identification.h"
+// Compil C++ Template Library
+#include "core/compil/object_slab.h"
+// Standard C Library
+#include <string.h>
+
+namespace identification
+{
+
+Structure1::Structure1()
+        : mWeight(default_weight())
+{
+}
+
+Structure1::~Structure1()
+{
+}
+
+size_t Structure1::staticInprocId()
+{
+    return (size_t)"structure.Structure1";
+}
+
+size_t Structure1::runtimeInprocId() const
+{
+    return staticInprocId();
+}
+
+long Structure1::weight() const
+{
+    return mWeight;
+}
+
+long Structure1::default_weight()
+{
+    return 0;
+}
+
+Structure1& Structure1::set_weight(long weight)
+{
+    mWeight = weight;
+    return *this;
+}
+
+Structure1Columns::Row::Row(const Structure1Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure1Columns::Row::weight() const
+{
+    return mColumns.weight()[mIndex];
+}
+
+Structure1Columns::Structure1Columns()
+{
+}
+
+Structure1Columns::~Structure1Columns()
+{
+}
+
+size_t Structure1Columns::size() const
+{
+    return mWeight.size();
+}
+
+bool Structure1Columns::empty() const
+{
+    return mWeight.empty();
+}
+
+void Structure1Columns::reserve(size_t size)
+{
+    mWeight.reserve(size);
+}
+
+void Structure1Columns::clear()
+{
+    mWeight.clear();
+}
+
+void Structure1Columns::push_back(const Structure1& object)
+{
+    mWeight.push_back(object.weight());
+}
+
+Structure1Columns::Row Structure1Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure1Columns::weight() const
+{
+    return mWeight;
+}
+
+Structure2a::Structure2a()
+{
+}
+
+Structure2a::~Structure2a()
+{
+}
+
+Structure2aSPtr Structure2a::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2a>(object);
+}
+
+Structure2a& Structure2a::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure2aColumns::Row::Row(const Structure2aColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure2aColumns::Row::weight() const
+{
+    return mColumns.weight()[mIndex];
+}
+
+Structure2aColumns::Structure2aColumns()
+{
+}
+
+Structure2aColumns::~Structure2aColumns()
+{
+}
+
+size_t Structure2aColumns::size() const
+{
+    return mWeight.size();
+}
+
+bool Structure2aColumns::empty() const
+{
+    return mWeight.empty();
+}
+
+void Structure2aColumns::reserve(size_t size)
+{
+    mWeight.reserve(size);
+}
+
+void Structure2aColumns::clear()
+{
+    mWeight.clear();
+}
+
+void Structure2aColumns::push_back(const Structure2a& object)
+{
+    mWeight.push_back(object.weight());
+}
+
+Structure2aColumns::Row Structure2aColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure2aColumns::weight() const
+{
+    return mWeight;
+}
+
+Structure2b::Structure2b()
+{
+}
+
+Structure2b::~Structure2b()
+{
+}
+
+Structure2bSPtr Structure2b::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2b>(object);
+}
+
+Structure2b& Structure2b::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure2bColumns::Row::Row(const Structure2bColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure2bColumns::Row::weight() const
+{
+    return mColumns.weight()[mIndex];
+}
+
+Structure2bColumns::Structure2bColumns()
+{
+}
+
+Structure2bColumns::~Structure2bColumns()
+{
+}
+
+size_t Structure2bColumns::size() const
+{
+    return mWeight.size();
+}
+
+bool Structure2bColumns::empty() const
+{
+    return mWeight.empty();
+}
+
+void Structure2bColumns::reserve(size_t size)
+{
+    mWeight.reserve(size);
+}
+
+void Structure2bColumns::clear()
+{
+    mWeight.clear();
+}
+
+void Structure2bColumns::push_back(const Structure2b& object)
+{
+    mWeight.push_back(object.weight());
+}
+
+Structure2bColumns::Row Structure2bColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure2bColumns::weight() const
+{
+    return mWeight;
+}
+
+Structure3aa::Structure3aa()
+{
+}
+
+Structure3aa::~Structure3aa()
+{
+}
+
+Structure3aaSPtr Structure3aa::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure3aa>(object);
+}
+
+Structure3aa& Structure3aa::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure3aaColumns::Row::Row(const Structure3aaColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure3aaColumns::Row::weight() const
+{
+    return mColumns.weight()[mIndex];
+}
+
+Structure3aaColumns::Structure3aaColumns()
+{
+}
+
+Structure3aaColumns::~Structure3aaColumns()
+{
+}
+
+size_t Structure3aaColumns::size() const
+{
+    return mWeight.size();
+}
+
+bool Structure3aaColumns::empty() const
+{
+    return mWeight.empty();
+}
+
+void Structure3aaColumns::reserve(size_t size)
+{
+    mWeight.reserve(size);
+}
+
+void Structure3aaColumns::clear()
+{
+    mWeight.clear();
+}
+
+void Structure3aaColumns::push_back(const Structure3aa& object)
+{
+    mWeight.push_back(object.weight());
+}
+
+Structure3aaColumns::Row Structure3aaColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure3aaColumns::weight() const
+{
+    return mWeight;
+}
+
+Structure3ab::Structure3ab()
+{
+}
+
+Structure3ab::~Structure3ab()
+{
+}
+
+Structure3abSPtr Structure3ab::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure3ab>(object);
+}
+
+Structure3ab& Structure3ab::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure3abColumns::Row::Row(const Structure3abColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure3abColumns::Row::weight() const
+{
+    return mColumns.weight()[mIndex];
+}
+
+Structure3abColumns::Structure3abColumns()
+{
+}
+
+Structure3abColumns::~Structure3abColumns()
+{
+}
+
+size_t Structure3abColumns::size() const
+{
+    return mWeight.size();
+}
+
+bool Structure3abColumns::empty() const
+{
+    return mWeight.empty();
+}
+
+void Structure3abColumns::reserve(size_t size)
+{
+    mWeight.reserve(size);
+}
+
+void Structure3abColumns::clear()
+{
+    mWeight.clear();
+}
+
+void Structure3abColumns::push_back(const Structure3ab& object)
+{
+    mWeight.push_back(object.weight());
+}
+
+Structure3abColumns::Row Structure3abColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure3abColumns::weight() const
+{
+    return mWeight;
+}
+
+Structure3ba::Structure3ba()
+{
+}
+
+Structure3ba::~Structure3ba()
+{
+}
+
+Structure3baSPtr Structure3ba::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure3ba>(object);
+}
+
+Structure3ba& Structure3ba::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure3baColumns::Row::Row(const Structure3baColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure3baColumns::Row::weight() const
+{
+    return mColumns.weight()[mIndex];
+}
+
+Structure3baColumns::Structure3baColumns()
+{
+}
+
+Structure3baColumns::~Structure3baColumns()
+{
+}
+
+size_t Structure3baColumns::size() const
+{
+    return mWeight.size();
+}
+
+bool Structure3baColumns::empty() const
+{
+    return mWeight.empty();
+}
+
+void Structure3baColumns::reserve(size_t size)
+{
+    mWeight.reserve(size);
+}
+
+void Structure3baColumns::clear()
+{
+    mWeight.clear();
+}
+
+void Structure3baColumns::push_back(const Structure3ba& object)
+{
+    mWeight.push_back(object.weight());
+}
+
+Structure3baColumns::Row Structure3baColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure3baColumns::weight() const
+{
+    return mWeight;
+}
+
+Structure3bb::Structure3bb()
+{
+}
+
+Structure3bb::~Structure3bb()
+{
+}
+
+Structure3bbSPtr Structure3bb::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure3bb>(object);
+}
+
+Structure3bb& Structure3bb::set_weight(long weight)
+{
+    Structure1::set_weight(weight);
+    return *this;
+}
+
+Structure3bbColumns::Row::Row(const Structure3bbColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure3bbColumns::Row::weight() const
+{
+    return mColumns.weight()[mIndex];
+}
+
+Structure3bbColumns::Structure3bbColumns()
+{
+}
+
+Structure3bbColumns::~Structure3bbColumns()
+{
+}
+
+size_t Structure3bbColumns::size() const
+{
+    return mWeight.size();
+}
+
+bool Structure3bbColumns::empty() const
+{
+    return mWeight.empty();
+}
+
+void Structure3bbColumns::reserve(size_t size)
+{
+    mWeight.reserve(size);
+}
+
+void Structure3bbColumns::clear()
+{
+    mWeight.clear();
+}
+
+void Structure3bbColumns::push_back(const Structure3bb& object)
+{
+    mWeight.push_back(object.weight());
+}
+
+Structure3bbColumns::Row Structure3bbColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure3bbColumns::weight() const
+{
+    return mWeight;
+}
+
+EStructure1Id::EStructure1Id()
+        : mValue(kInvalid)
+{
+}
+
+EStructure1Id::EStructure1Id(long value)
+        : mValue(value)
+{
+}
+
+const EStructure1Id EStructure1Id::invalid()
+{
+    return EStructure1Id(kInvalid);
+}
+
+const EStructure1Id EStructure1Id::structure1()
+{
+    return EStructure1Id(kStructure1);
+}
+
+const EStructure1Id EStructure1Id::structure2a()
+{
+    return EStructure1Id(kStructure2a);
+}
+
+const EStructure1Id EStructure1Id::structure3aa()
+{
+    return EStructure1Id(kStructure3aa);
+}
+
+const EStructure1Id EStructure1Id::structure3ba()
+{
+    return EStructure1Id(kStructure3ba);
+}
+
+long EStructure1Id::value() const
+{
+    return mValue;
+}
+
+const char* EStructure1Id::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "Structure1",
+        "Structure2a",
+        "Structure3aa",
+        "Structure3ba",
+    };
+    return names[(size_t)value];
+}
+
+const char* EStructure1Id::shortName() const
+{
+    return shortName(value());
+}
+
+EStructure1Id EStructure1Id::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        1, 0, 15,
+    };
+    static const char* names[] =
+    {
+        "Structure3ba",
+        "invalid",
+        "Structure2a",
+        "Structure1",
+        "Structure3aa",
+    };
+    static const size_t lengths[] =
+    {
+        12, 7, 11, 10, 12,
+    };
+    static const long values[] =
+    {
+        kStructure3ba,
+        kInvalid,
+        kStructure2a,
+        kStructure1,
+        kStructure3aa,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 3]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 5;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return EStructure1Id();
+    return EStructure1Id(values[slot]);
+}
+
+bool EStructure1Id::operator==(const EStructure1Id& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EStructure1Id::operator!=(const EStructure1Id& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EStructure1Id Structure1::staticStructure1Id()
+{
+    return EStructure1Id::structure1();
+}
+
+EStructure1Id Structure1::runtimeStructure1Id() const
+{
+    return staticStructure1Id();
+}
+
+EStructure1Id Structure2a::staticStructure1Id()
+{
+    return EStructure1Id::structure2a();
+}
+
+EStructure1Id Structure2a::runtimeStructure1Id() const
+{
+    return staticStructure1Id();
+}
+
+EStructure1Id Structure3aa::staticStructure1Id()
+{
+    return EStructure1Id::structure3aa();
+}
+
+EStructure1Id Structure3aa::runtimeStructure1Id() const
+{
+    return staticStructure1Id();
+}
+
+EStructure1Id Structure3ba::staticStructure1Id()
+{
+    return EStructure1Id::structure3ba();
+}
+
+EStructure1Id Structure3ba::runtimeStructure1Id() const
+{
+    return staticStructure1Id();
+}
+
+Structure1SPtr Structure1aFactory::clone(const Structure1SPtr& pObject)
+{
+    switch (pObject->runtimeStructure1Id().value())
+    {
+        case EStructure1Id::kStructure1:
+        {
+            Structure1SPtr pClone(new Structure1());
+            *pClone = *pObject;
+            return pClone;
+        }
+        case EStructure1Id::kStructure2a:
+        {
+            Structure2aSPtr pClone(new Structure2a());
+            *pClone = *downcastStructure2a(pObject);
+            return pClone;
+        }
+        case EStructure1Id::kStructure3aa:
+        {
+            Structure3aaSPtr pClone(new Structure3aa());
+            *pClone = *downcastStructure3aa(pObject);
+            return pClone;
+        }
+        case EStructure1Id::kStructure3ba:
+        {
+            Structure3baSPtr pClone(new Structure3ba());
+            *pClone = *downcastStructure3ba(pObject);
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return Structure1SPtr();
+}
+
+std::vector<Structure1SPtr> Structure1aFactory::cloneAll(const std::vector<Structure1SPtr>& objects)
+{
+    // the null objects get the invalid identifier and stay null
+    std::vector<long> ids(objects.size(), 0);
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i])
+            ids[i] = objects[i]->runtimeStructure1Id().value();
+    }
+
+    std::vector<Structure1SPtr> result;
+    slab_cloner<Structure1> cloner(objects, ids, 5, result);
+    cloner.clone<Structure1>(EStructure1Id::kStructure1);
+    cloner.clone<Structure2a>(EStructure1Id::kStructure2a);
+    cloner.clone<Structure3aa>(EStructure1Id::kStructure3aa);
+    cloner.clone<Structure3ba>(EStructure1Id::kStructure3ba);
+    return result;
+}
+
+Structure2aSPtr Structure1aFactory::downcastStructure2a(const Structure1SPtr& pObject)
+{
+    bool b = (pObject->runtimeStructure1Id() == Structure2a::staticStructure1Id())
+          // or any of the derived classes
+          || (pObject->runtimeStructure1Id() == Structure3aa::staticStructure1Id());
+
+    if (b)
+        return boost::static_pointer_cast<Structure2a>(pObject);
+    return Structure2aSPtr();
+}
+
+Structure3aaSPtr Structure1aFactory::downcastStructure3aa(const Structure1SPtr& pObject)
+{
+    bool b = (pObject->runtimeStructure1Id() == Structure3aa::staticStructure1Id());
+
+    if (b)
+        return boost::static_pointer_cast<Structure3aa>(pObject);
+    return Structure3aaSPtr();
+}
+
+Structure3baSPtr Structure1aFactory::downcastStructure3ba(const Structure1SPtr& pObject)
+{
+    bool b = (pObject->runtimeStructure1Id() == Structure3ba::staticStructure1Id());
+
+    if (b)
+        return boost::static_pointer_cast<Structure3ba>(pObject);
+    return Structure3baSPtr();
+}
+
+SharedStructure1::SharedStructure1()
+        : mWeight(default_weight())
+{
+}
+
+SharedStructure1::~SharedStructure1()
+{
+}
+
+long SharedStructure1::weight() const
+{
+    return mWeight;
+}
+
+long SharedStructure1::default_weight()
+{
+    return 0;
+}
+
+SharedStructure1& SharedStructure1::set_weight(long weight)
+{
+    mWeight = weight;
+    return *this;
+}
+
+SharedStructure1Columns::Row::Row(const SharedStructure1Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long SharedStructure1Columns::Row::weight() const
+{
+    return mColumns.weight()[mIndex];
+}
+
+SharedStructure1Columns::SharedStructure1Columns()
+{
+}
+
+SharedStructure1Columns::~SharedStructure1Columns()
+{
+}
+
+size_t SharedStructure1Columns::size() const
+{
+    return mWeight.size();
+}
+
+bool SharedStructure1Columns::empty() const
+{
+    return mWeight.empty();
+}
+
+void SharedStructure1Columns::reserve(size_t size)
+{
+    mWeight.reserve(size);
+}
+
+void SharedStructure1Columns::clear()
+{
+    mWeight.clear();
+}
+
+void SharedStructure1Columns::push_back(const SharedStructure1& object)
+{
+    mWeight.push_back(object.weight());
+}
+
+SharedStructure1Columns::Row SharedStructure1Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& SharedStructure1Columns::weight() const
+{
+    return mWeight;
+}
+
+SharedStructure2::SharedStructure2()
+{
+}
+
+SharedStructure2::~SharedStructure2()
+{
+}
+
+SharedStructure2SPtr SharedStructure2::downcast(const SharedStructure1SPtr& object)
+{
+    return boost::static_pointer_cast<SharedStructure2>(object);
+}
+
+SharedStructure2SPtr SharedStructure2::shared_from_this()
+{
+    return boost::static_pointer_cast<SharedStructure2>(
+        boost::enable_shared_from_this<SharedStructure1>::shared_from_this());
+}
+
+SharedStructure2SCPtr SharedStructure2::shared_from_this() const
+{
+    return boost::static_pointer_cast<const SharedStructure2>(
+        boost::enable_shared_from_this<SharedStructure1>::shared_from_this());
+}
+
+SharedStructure2& SharedStructure2::set_weight(long weight)
+{
+    SharedStructure1::set_weight(weight);
+    return *this;
+}
+
+SharedStructure2Columns::Row::Row(const SharedStructure2Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long SharedStructure2Columns::Row::weight() const
+{
+    return mColumns.weight()[mIndex];
+}
+
+SharedStructure2Columns::SharedStructure2Columns()
+{
+}
+
+SharedStructure2Columns::~SharedStructure2Columns()
+{
+}
+
+size_t SharedStructure2Columns::size() const
+{
+    return mWeight.size();
+}
+
+bool SharedStructure2Columns::empty() const
+{
+    return mWeight.empty();
+}
+
+void SharedStructure2Columns::reserve(size_t size)
+{
+    mWeight.reserve(size);
+}
+
+void SharedStructure2Columns::clear()
+{
+    mWeight.clear();
+}
+
+void SharedStructure2Columns::push_back(const SharedStructure2& object)
+{
+    mWeight.push_back(object.weight());
+}
+
+SharedStructure2Columns::Row SharedStructure2Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& SharedStructure2Columns::weight() const
+{
+    return mWeight;
+}
+
+ESharedStructure1Id::ESharedStructure1Id()
+        : mValue(kInvalid)
+{
+}
+
+ESharedStructure1Id::ESharedStructure1Id(long value)
+        : mValue(value)
+{
+}
+
+const ESharedStructure1Id ESharedStructure1Id::invalid()
+{
+    return ESharedStructure1Id(kInvalid);
+}
+
+const ESharedStructure1Id ESharedStructure1Id::sharedStructure1()
+{
+    return ESharedStructure1Id(kSharedStructure1);
+}
+
+const ESharedStructure1Id ESharedStructure1Id::sharedStructure2()
+{
+    return ESharedStructure1Id(kSharedStructure2);
+}
+
+long ESharedStructure1Id::value() const
+{
+    return mValue;
+}
+
+const char* ESharedStructure1Id::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "SharedStructure1",
+        "SharedStructure2",
+    };
+    return names[(size_t)value];
+}
+
+const char* ESharedStructure1Id::shortName() const
+{
+    return shortName(value());
+}
+
+ESharedStructure1Id ESharedStructure1Id::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        0, 0,
+    };
+    static const char* names[] =
+    {
+        "SharedStructure2",
+        "invalid",
+        "SharedStructure1",
+    };
+    static const size_t lengths[] =
+    {
+        16, 7, 16,
+    };
+    static const long values[] =
+    {
+        kSharedStructure2,
+        kInvalid,
+        kSharedStructure1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return ESharedStructure1Id();
+    return ESharedStructure1Id(values[slot]);
+}
+
+bool ESharedStructure1Id::operator==(const ESharedStructure1Id& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool ESharedStructure1Id::operator!=(const ESharedStructure1Id& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+ESharedStructure1Id SharedStructure1::staticSharedStructure1Id()
+{
+    return ESharedStructure1Id::sharedStructure1();
+}
+
+ESharedStructure1Id SharedStructure1::runtimeSharedStructure1Id() const
+{
+    return staticSharedStructure1Id();
+}
+
+ESharedStructure1Id SharedStructure2::staticSharedStructure1Id()
+{
+    return ESharedStructure1Id::sharedStructure2();
+}
+
+ESharedStructure1Id SharedStructure2::runtimeSharedStructure1Id() const
+{
+    return staticSharedStructure1Id();
+}
+
+SharedStructure1SPtr SharedStructure1Factory::clone(const SharedStructure1SPtr& pObject)
+{
+    switch (pObject->runtimeSharedStructure1Id().value())
+    {
+        case ESharedStructure1Id::kSharedStructure1:
+        {
+            SharedStructure1SPtr pClone(new SharedStructure1());
+            *pClone = *pObject;
+            return pClone;
+        }
+        case ESharedStructure1Id::kSharedStructure2:
+        {
+            SharedStructure2SPtr pClone(new SharedStructure2());
+            *pClone = *downcastSharedStructure2(pObject);
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return SharedStructure1SPtr();
+}
+
+SharedStructure2SPtr SharedStructure1Factory::downcastSharedStructure2(const SharedStructure1SPtr& pObject)
+{
+    bool b = (pObject->runtimeSharedStructure1Id() == SharedStructure2::staticSharedStructure1Id());
+
+    if (b)
+        return boost::static_pointer_cast<SharedStructure2>(pObject);
+    return SharedStructure2SPtr();
+}
+
+}
+
@@ -0,0 +1,1005 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <vector>
+
+#ifndef __STRUCTURE_IDENTIFICATION_COMPIL_H_
+#define __STRUCTURE_IDENTIFICATION_COMPIL_H_
+
+#include "structure/identification-fwd.h"
+// Boost C++ Smart Pointers
+#include <boost/enable_shared_from_this.hpp>
+// Standard C Library
+#include <stddef.h>
+
+namespace identification
+{
+
+class Structure1
+{
+public:
+    // Default constructor
+                          Structure1         ();
+    // Destructor
+    virtual               ~Structure1        ();
+
+    // Identifier for the objects from Structure1 class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructure1Id staticStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructure1Id runtimeStructure1Id()            const;
+
+    // Inproc identifier for the objects from Structure1 class.
+    // Note: this identificator is unique just for the process session.
+    // There is no guarantee that the id will be the same from session to
+    // session. Do not use for serialization.
+    static  size_t        staticInprocId     ();
+    // This virtual method provides runtime inproc object identification
+    // based on the polymorphic behavior of the virtual methods. Allows
+    // having a RTTI like mechanism significantly cheaper than the RTTI
+    // provided by the compilers themselves.
+    virtual size_t        runtimeInprocId    ()            const;
+
+    // Getter method for the data field weight
+            long          weight             ()            const;
+    // Returns the default value 0 of the field weight
+    static  long          default_weight     ();
+    // Setter method for the data field weight
+            Structure1&   set_weight         (long weight);
+
+private:
+    // variable for the data field weight
+    long mWeight;
+};
+
+// Structure1Columns holds Structure1 objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure1Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                          Row   (const Structure1Columns& columns, size_t index);
+
+        // Getter method for the data field weight
+                                 long     weight()                                               const;
+    private:
+        const Structure1Columns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                             Structure1Columns ();
+    // Destructor
+                             ~Structure1Columns();
+
+    // Returns the number of the rows
+    size_t                   size              ()                         const;
+    // Returns true if there are no rows
+    bool                     empty             ()                         const;
+    // Reserves memory for size rows in every column
+    void                     reserve           (size_t size);
+    // Removes all the rows
+    void                     clear             ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back         (const Structure1& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]        (size_t index)             const;
+
+    // Column of the data field weight
+    const std::vector<long>& weight            ()                         const;
+
+private:
+    // column of the data field weight
+    std::vector<long> mWeight;
+};
+
+class Structure2a : public Structure1
+{
+public:
+    // Default constructor
+                            Structure2a        ();
+    // Destructor
+    virtual                 ~Structure2a       ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2aSPtr downcast           (const Structure1SPtr& object);
+
+    // Identifier for the objects from Structure2a class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructure1Id   staticStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructure1Id   runtimeStructure1Id()                             const;
+
+    // Setter method for the data field weight
+            Structure2a&    set_weight         (long weight);
+};
+
+// Structure2aColumns holds Structure2a objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure2aColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                           Row   (const Structure2aColumns& columns, size_t index);
+
+        // Getter method for the data field weight
+                                  long     weight()                                                const;
+    private:
+        const Structure2aColumns& mColumns;
+        size_t                    mIndex;
+    };
+
+    // Default constructor
+                             Structure2aColumns ();
+    // Destructor
+                             ~Structure2aColumns();
+
+    // Returns the number of the rows
+    size_t                   size               ()                          const;
+    // Returns true if there are no rows
+    bool                     empty              ()                          const;
+    // Reserves memory for size rows in every column
+    void                     reserve            (size_t size);
+    // Removes all the rows
+    void                     clear              ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back          (const Structure2a& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]         (size_t index)              const;
+
+    // Column of the data field weight
+    const std::vector<long>& weight             ()                          const;
+
+private:
+    // column of the data field weight
+    std::vector<long> mWeight;
+};
+
+class Structure2b : public Structure1
+{
+public:
+    // Default constructor
+                            Structure2b ();
+    // Destructor
+    virtual                 ~Structure2b();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2bSPtr downcast    (const Structure1SPtr& object);
+
+    // Setter method for the data field weight
+            Structure2b&    set_weight  (long weight);
+};
+
+// Structure2bColumns holds Structure2b objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure2bColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                           Row   (const Structure2bColumns& columns, size_t index);
+
+        // Getter method for the data field weight
+                                  long     weight()                                                const;
+    private:
+        const Structure2bColumns& mColumns;
+        size_t                    mIndex;
+    };
+
+    // Default constructor
+                             Structure2bColumns ();
+    // Destructor
+                             ~Structure2bColumns();
+
+    // Returns the number of the rows
+    size_t                   size               ()                          const;
+    // Returns true if there are no rows
+    bool                     empty              ()                          const;
+    // Reserves memory for size rows in every column
+    void                     reserve            (size_t size);
+    // Removes all the rows
+    void                     clear              ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back          (const Structure2b& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]         (size_t index)              const;
+
+    // Column of the data field weight
+    const std::vector<long>& weight             ()                          const;
+
+private:
+    // column of the data field weight
+    std::vector<long> mWeight;
+};
+
+class Structure3aa : public Structure2a
+{
+public:
+    // Default constructor
+                             Structure3aa       ();
+    // Destructor
+    virtual                  ~Structure3aa      ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure3aaSPtr downcast           (const Structure1SPtr& object);
+
+    // Identifier for the objects from Structure3aa class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructure1Id    staticStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructure1Id    runtimeStructure1Id()                             const;
+
+    // Setter method for the data field weight
+            Structure3aa&    set_weight         (long weight);
+};
+
+// Structure3aaColumns holds Structure3aa objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure3aaColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                            Row   (const Structure3aaColumns& columns, size_t index);
+
+        // Getter method for the data field weight
+                                   long     weight()                                                 const;
+    private:
+        const Structure3aaColumns& mColumns;
+        size_t                     mIndex;
+    };
+
+    // Default constructor
+                             Structure3aaColumns ();
+    // Destructor
+                             ~Structure3aaColumns();
+
+    // Returns the number of the rows
+    size_t                   size                ()                           const;
+    // Returns true if there are no rows
+    bool                     empty               ()                           const;
+    // Reserves memory for size rows in every column
+    void                     reserve             (size_t size);
+    // Removes all the rows
+    void                     clear               ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back           (const Structure3aa& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]          (size_t index)               const;
+
+    // Column of the data field weight
+    const std::vector<long>& weight              ()                           const;
+
+private:
+    // column of the data field weight
+    std::vector<long> mWeight;
+};
+
+class Structure3ab : public Structure2a
+{
+public:
+    // Default constructor
+                             Structure3ab ();
+    // Destructor
+    virtual                  ~Structure3ab();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure3abSPtr downcast     (const Structure1SPtr& object);
+
+    // Setter method for the data field weight
+            Structure3ab&    set_weight   (long weight);
+};
+
+// Structure3abColumns holds Structure3ab objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure3abColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                            Row   (const Structure3abColumns& columns, size_t index);
+
+        // Getter method for the data field weight
+                                   long     weight()                                                 const;
+    private:
+        const Structure3abColumns& mColumns;
+        size_t                     mIndex;
+    };
+
+    // Default constructor
+                             Structure3abColumns ();
+    // Destructor
+                             ~Structure3abColumns();
+
+    // Returns the number of the rows
+    size_t                   size                ()                           const;
+    // Returns true if there are no rows
+    bool                     empty               ()                           const;
+    // Reserves memory for size rows in every column
+    void                     reserve             (size_t size);
+    // Removes all the rows
+    void                     clear               ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back           (const Structure3ab& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]          (size_t index)               const;
+
+    // Column of the data field weight
+    const std::vector<long>& weight              ()                           const;
+
+private:
+    // column of the data field weight
+    std::vector<long> mWeight;
+};
+
+class Structure3ba : public Structure2b
+{
+public:
+    // Default constructor
+                             Structure3ba       ();
+    // Destructor
+    virtual                  ~Structure3ba      ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure3baSPtr downcast           (const Structure1SPtr& object);
+
+    // Identifier for the objects from Structure3ba class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructure1Id    staticStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructure1Id    runtimeStructure1Id()                             const;
+
+    // Setter method for the data field weight
+            Structure3ba&    set_weight         (long weight);
+};
+
+// Structure3baColumns holds Structure3ba objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure3baColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                            Row   (const Structure3baColumns& columns, size_t index);
+
+        // Getter method for the data field weight
+                                   long     weight()                                                 const;
+    private:
+        const Structure3baColumns& mColumns;
+        size_t                     mIndex;
+    };
+
+    // Default constructor
+                             Structure3baColumns ();
+    // Destructor
+                             ~Structure3baColumns();
+
+    // Returns the number of the rows
+    size_t                   size                ()                           const;
+    // Returns true if there are no rows
+    bool                     empty               ()                           const;
+    // Reserves memory for size rows in every column
+    void                     reserve             (size_t size);
+    // Removes all the rows
+    void                     clear               ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back           (const Structure3ba& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]          (size_t index)               const;
+
+    // Column of the data field weight
+    const std::vector<long>& weight              ()                           const;
+
+private:
+    // column of the data field weight
+    std::vector<long> mWeight;
+};
+
+class Structure3bb : public Structure2b
+{
+public:
+    // Default constructor
+                             Structure3bb ();
+    // Destructor
+    virtual                  ~Structure3bb();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure3bbSPtr downcast     (const Structure1SPtr& object);
+
+    // Setter method for the data field weight
+            Structure3bb&    set_weight   (long weight);
+};
+
+// Structure3bbColumns holds Structure3bb objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure3bbColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                            Row   (const Structure3bbColumns& columns, size_t index);
+
+        // Getter method for the data field weight
+                                   long     weight()                                                 const;
+    private:
+        const Structure3bbColumns& mColumns;
+        size_t                     mIndex;
+    };
+
+    // Default constructor
+                             Structure3bbColumns ();
+    // Destructor
+                             ~Structure3bbColumns();
+
+    // Returns the number of the rows
+    size_t                   size                ()                           const;
+    // Returns true if there are no rows
+    bool                     empty               ()                           const;
+    // Reserves memory for size rows in every column
+    void                     reserve             (size_t size);
+    // Removes all the rows
+    void                     clear               ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back           (const Structure3bb& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]          (size_t index)               const;
+
+    // Column of the data field weight
+    const std::vector<long>& weight              ()                           const;
+
+private:
+    // column of the data field weight
+    std::vector<long> mWeight;
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EStructure1Id
+{
+public:
+    // Default constructor - sets the value to invalid
+                           EStructure1Id();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit               EStructure1Id(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long          value        ()                              const;
+    // Returns short name for a specified enum value
+    static   const char*   shortName    (long value);
+    // Returns short name of the enum value
+             const char*   shortName    ()                              const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   EStructure1Id fromString   (const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool          operator==   (const EStructure1Id& rValue)   const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool          operator!=   (const EStructure1Id& rValue)   const;
+
+    // static methods for enum class objects
+    static const EStructure1Id invalid     ();
+    static const EStructure1Id structure1  ();
+    static const EStructure1Id structure2a ();
+    static const EStructure1Id structure3aa();
+    static const EStructure1Id structure3ba();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid      = 0,
+        kStructure1   = 1,
+        kStructure2a  = 2,
+        kStructure3aa = 3,
+        kStructure3ba = 4,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class Structure1aFactory
+{
+public:
+    static Structure1SPtr   clone               (const Structure1SPtr& object);
+    static Structure2aSPtr  downcastStructure2a (const Structure1SPtr& object);
+    static Structure3aaSPtr downcastStructure3aa(const Structure1SPtr& object);
+    static Structure3baSPtr downcastStructure3ba(const Structure1SPtr& object);
+
+    // Clones all the objects, preserving their order. The objects of the
+    // same type are copied together in a contiguous slab. The slab and all
+    // its clones are released with the last of them, a surviving clone
+    // keeps its siblings alive without running their destructors.
+    static std::vector<Structure1SPtr> cloneAll(const std::vector<Structure1SPtr>& objects);
+};
+
+// Static visitor of the Structure1 hierarchy. The accept method dispatches
+// the object with a single indirect call through a table indexed by its
+// runtime identification. The derived visitor overrides visit for the
+// structures it handles and brings the rest in scope with a using
+// declaration. The visits it does not override fall back to the visit of
+// the nearest identified base structure.
+template<class Derived, class Result = void>
+class Structure1Visitor
+{
+public:
+    Result accept(const Structure1SPtr& object)
+    {
+        typedef Result (*Thunk)(Derived&, const Structure1SPtr&);
+        // the table follows the values of the identification enumeration
+        static const Thunk thunks[] =
+        {
+            &thunk<Structure1>,
+            &thunk<Structure1>,
+            &thunk<Structure2a>,
+            &thunk<Structure3aa>,
+            &thunk<Structure3ba>,
+        };
+        return thunks[object->runtimeStructure1Id().value()](static_cast<Derived&>(*this), object);
+    }
+
+    Result visit(const Structure1SPtr&)
+    {
+        return Result();
+    }
+
+    Result visit(const Structure2aSPtr& object)
+    {
+        return static_cast<Derived*>(this)->visit(Structure1SPtr(object));
+    }
+
+    Result visit(const Structure3aaSPtr& object)
+    {
+        return static_cast<Derived*>(this)->visit(Structure2aSPtr(object));
+    }
+
+    Result visit(const Structure3baSPtr& object)
+    {
+        return static_cast<Derived*>(this)->visit(Structure1SPtr(object));
+    }
+
+protected:
+    ~Structure1Visitor()
+    {
+    }
+
+private:
+    template<class T>
+    static Result thunk(Derived& visitor, const Structure1SPtr& object)
+    {
+        return visitor.visit(boost::static_pointer_cast<T>(object));
+    }
+};
+
+class SharedStructure1 : public boost::enable_shared_from_this<SharedStructure1>
+{
+public:
+    // Default constructor
+                                SharedStructure1         ();
+    // Destructor
+    virtual                     ~SharedStructure1        ();
+
+    // Identifier for the objects from SharedStructure1 class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  ESharedStructure1Id staticSharedStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual ESharedStructure1Id runtimeSharedStructure1Id()            const;
+
+    // Getter method for the data field weight
+            long                weight                   ()            const;
+    // Returns the default value 0 of the field weight
+    static  long                default_weight           ();
+    // Setter method for the data field weight
+            SharedStructure1&   set_weight               (long weight);
+
+private:
+    // variable for the data field weight
+    long mWeight;
+};
+
+// SharedStructure1Columns holds SharedStructure1 objects column by column
+// - one contiguous array per data field. Use it for large collections that
+// are scanned one or two fields at a time. Such scan touches only the
+// memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class SharedStructure1Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                Row   (const SharedStructure1Columns& columns, size_t index);
+
+        // Getter method for the data field weight
+                                       long     weight()                                                     const;
+    private:
+        const SharedStructure1Columns& mColumns;
+        size_t                         mIndex;
+    };
+
+    // Default constructor
+                             SharedStructure1Columns ();
+    // Destructor
+                             ~SharedStructure1Columns();
+
+    // Returns the number of the rows
+    size_t                   size                    ()                               const;
+    // Returns true if there are no rows
+    bool                     empty                   ()                               const;
+    // Reserves memory for size rows in every column
+    void                     reserve                 (size_t size);
+    // Removes all the rows
+    void                     clear                   ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back               (const SharedStructure1& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]              (size_t index)                   const;
+
+    // Column of the data field weight
+    const std::vector<long>& weight                  ()                               const;
+
+private:
+    // column of the data field weight
+    std::vector<long> mWeight;
+};
+
+class SharedStructure2 : public SharedStructure1
+{
+public:
+    // Default constructor
+                                  SharedStructure2         ();
+    // Destructor
+    virtual                       ~SharedStructure2        ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  SharedStructure2SPtr  downcast                 (const SharedStructure1SPtr& object);
+    // shared_from_this is a helper method that overrides the
+    // shared_from_this method that is implemented in
+    // boost::enable_shared_from_this base class. The only purpose of this
+    // helper method is to eliminate the need of downcasting to shared_ptr
+    // to this class.
+            SharedStructure2SPtr  shared_from_this         ();
+    // This method is exactly the same as the previous one with exception
+    // that it allows shared_from_this to be called from const methods.
+            SharedStructure2SCPtr shared_from_this         ()                                   const;
+
+    // Identifier for the objects from SharedStructure2 class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  ESharedStructure1Id   staticSharedStructure1Id ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual ESharedStructure1Id   runtimeSharedStructure1Id()                                   const;
+
+    // Setter method for the data field weight
+            SharedStructure2&     set_weight               (long weight);
+};
+
+// SharedStructure2Columns holds SharedStructure2 objects column by column
+// - one contiguous array per data field. Use it for large collections that
+// are scanned one or two fields at a time. Such scan touches only the
+// memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class SharedStructure2Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                Row   (const SharedStructure2Columns& columns, size_t index);
+
+        // Getter method for the data field weight
+                                       long     weight()                                                     const;
+    private:
+        const SharedStructure2Columns& mColumns;
+        size_t                         mIndex;
+    };
+
+    // Default constructor
+                             SharedStructure2Columns ();
+    // Destructor
+                             ~SharedStructure2Columns();
+
+    // Returns the number of the rows
+    size_t                   size                    ()                               const;
+    // Returns true if there are no rows
+    bool                     empty                   ()                               const;
+    // Reserves memory for size rows in every column
+    void                     reserve                 (size_t size);
+    // Removes all the rows
+    void                     clear                   ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back               (const SharedStructure2& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]              (size_t index)                   const;
+
+    // Column of the data field weight
+    const std::vector<long>& weight                  ()                               const;
+
+private:
+    // column of the data field weight
+    std::vector<long> mWeight;
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class ESharedStructure1Id
+{
+public:
+    // Default constructor - sets the value to invalid
+                                 ESharedStructure1Id();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit                     ESharedStructure1Id(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long                value              ()                                  const;
+    // Returns short name for a specified enum value
+    static   const char*         shortName          (long value);
+    // Returns short name of the enum value
+             const char*         shortName          ()                                  const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   ESharedStructure1Id fromString         (const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool                operator==         (const ESharedStructure1Id& rValue) const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool                operator!=         (const ESharedStructure1Id& rValue) const;
+
+    // static methods for enum class objects
+    static const ESharedStructure1Id invalid         ();
+    static const ESharedStructure1Id sharedStructure1();
+    static const ESharedStructure1Id sharedStructure2();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid          = 0,
+        kSharedStructure1 = 1,
+        kSharedStructure2 = 2,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class SharedStructure1Factory
+{
+public:
+    static SharedStructure1SPtr clone                   (const SharedStructure1SPtr& object);
+    static SharedStructure2SPtr downcastSharedStructure2(const SharedStructure1SPtr& object);
+};
+
+// Static visitor of the SharedStructure1 hierarchy. The accept method
+// dispatches the object with a single indirect call through a table
+// indexed by its runtime identification. The derived visitor overrides
+// visit for the structures it handles and brings the rest in scope with a
+// using declaration. The visits it does not override fall back to the
+// visit of the nearest identified base structure.
+template<class Derived, class Result = void>
+class SharedStructure1Visitor
+{
+public:
+    Result accept(const SharedStructure1SPtr& object)
+    {
+        typedef Result (*Thunk)(Derived&, const SharedStructure1SPtr&);
+        // the table follows the values of the identification enumeration
+        static const Thunk thunks[] =
+        {
+            &thunk<SharedStructure1>,
+            &thunk<SharedStructure1>,
+            &thunk<SharedStructure2>,
+        };
+        return thunks[object->runtimeSharedStructure1Id().value()](static_cast<Derived&>(*this), object);
+    }
+
+    Result visit(const SharedStructure1SPtr&)
+    {
+        return Result();
+    }
+
+    Result visit(const SharedStructure2SPtr& object)
+    {
+        return static_cast<Derived*>(this)->visit(SharedStructure1SPtr(object));
+    }
+
+protected:
+    ~SharedStructure1Visitor()
+    {
+    }
+
+private:
+    template<class T>
+    static Result thunk(Derived& visitor, const SharedStructure1SPtr& object)
+    {
+        return visitor.visit(boost::static_pointer_cast<T>(object));
+    }
+};
+
+}
+
+#endif // __STRUCTURE_IDENTIFICATION_COMPIL_H_
+
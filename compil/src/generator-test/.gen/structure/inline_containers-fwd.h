@@ -0,0 +1,27 @@
+#ifndef __STRUCTURE_INLINE_CONTAINERS_COMPIL__FWD_H_
+#define __STRUCTURE_INLINE_CONTAINERS_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace inline_containers
+{
+
+// Forward declarations
+class Sample;
+typedef Sample*                         SampleRPtr;
+typedef boost::shared_ptr<Sample>       SampleSPtr;
+typedef boost::shared_ptr<const Sample> SampleSCPtr;
+typedef boost::weak_ptr<Sample>         SampleWPtr;
+
+class Entry;
+typedef Entry*                         EntryRPtr;
+typedef boost::shared_ptr<Entry>       EntrySPtr;
+typedef boost::shared_ptr<const Entry> EntrySCPtr;
+typedef boost::weak_ptr<Entry>         EntryWPtr;
+
+}
+
+#endif // __STRUCTURE_INLINE_CONTAINERS_COMPIL__FWD_H_
+
@@ -0,0 +1,42 @@
+#include "structure/inline_containers.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace inline_containers
+{
+
+TEST(StructureSampleTest, available_DefaultValues)
+{
+    Sample structure1;
+    ASSERT_FALSE(structure1.exist_coordinates());
+    ASSERT_FALSE(structure1.exist_fills());
+    ASSERT_FALSE(structure1.exist_names());
+}
+
+TEST(StructureSampleTest, isInitialized)
+{
+    Sample structure1;
+    ASSERT_TRUE(structure1.isInitialized());
+}
+
+
+TEST(StructureEntryTest, available_DefaultValues)
+{
+    Entry structure1;
+    ASSERT_FALSE(structure1.valid_id());
+    ASSERT_FALSE(structure1.exist_fills());
+}
+
+TEST(StructureEntryTest, isInitialized)
+{
+    Entry structure1;
+    ASSERT_FALSE(structure1.isInitialized());
+    structure1.set_id(long());
+    ASSERT_TRUE(structure1.isInitialized());
+}
+
+
+}
+
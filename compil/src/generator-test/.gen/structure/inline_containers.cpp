@@ -0,0 +1,513 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <string>
+
+#include "structure/inline_containers.h"
+// Compil C++ Template Library
+#include "core/compil/small_vector.h"
+// Boost C++ Array
+#include <boost/array.hpp>
+
+namespace inline_containers
+{
+
+int Sample::bitmask_coordinates()
+{
+    return 0x1;
+}
+
+int Sample::bitmask_fills()
+{
+    return 0x2;
+}
+
+int Sample::bitmask_names()
+{
+    return 0x4;
+}
+
+Sample::Sample()
+        : mBits(0)
+{
+}
+
+Sample::~Sample()
+{
+}
+
+bool Sample::isInitialized() const
+{
+    return true;
+}
+
+bool Sample::isVoid() const
+{
+    if (exist_coordinates()) return false;
+    if (exist_fills()) return false;
+    if (exist_names()) return false;
+    return true;
+}
+
+const boost::array<long, 3>& Sample::coordinates() const
+{
+    BOOST_ASSERT(exist_coordinates());
+    return mCoordinates;
+}
+
+bool Sample::exist_coordinates() const
+{
+    return (mBits & bitmask_coordinates()) != 0;
+}
+
+Sample& Sample::set_coordinates(const boost::array<long, 3>& coordinates)
+{
+    mCoordinates  = coordinates;
+    mBits        |= bitmask_coordinates();
+    return *this;
+}
+
+boost::array<long, 3>& Sample::mutable_coordinates()
+{
+    mBits |= bitmask_coordinates();
+    return mCoordinates;
+}
+
+Sample& Sample::operator<<(const boost::array<long, 3>& coordinates)
+{
+    return set_coordinates(coordinates);
+}
+
+const SampleSPtr& operator<<(const SampleSPtr& object, const boost::array<long, 3>& coordinates)
+{
+    BOOST_ASSERT(object);
+    *object << coordinates;
+    return object;
+}
+
+void Sample::clear_coordinates()
+{
+    mCoordinates.assign(long());
+    mBits &= ~bitmask_coordinates();
+}
+
+const small_vector<long, 2>& Sample::fills() const
+{
+    BOOST_ASSERT(exist_fills());
+    return mFills;
+}
+
+bool Sample::exist_fills() const
+{
+    return (mBits & bitmask_fills()) != 0;
+}
+
+Sample& Sample::set_fills(const small_vector<long, 2>& fills)
+{
+    mFills  = fills;
+    mBits  |= bitmask_fills();
+    return *this;
+}
+
+small_vector<long, 2>& Sample::mutable_fills()
+{
+    mBits |= bitmask_fills();
+    return mFills;
+}
+
+Sample& Sample::operator<<(const small_vector<long, 2>& fills)
+{
+    return set_fills(fills);
+}
+
+const SampleSPtr& operator<<(const SampleSPtr& object, const small_vector<long, 2>& fills)
+{
+    BOOST_ASSERT(object);
+    *object << fills;
+    return object;
+}
+
+Sample& Sample::operator<<(long fillsItem)
+{
+    mBits |= bitmask_fills();
+    mFills.push_back(fillsItem);
+    return *this;
+}
+
+const SampleSPtr& operator<<(const SampleSPtr& object, long fillsItem)
+{
+    BOOST_ASSERT(object);
+    *object << fillsItem;
+    return object;
+}
+
+void Sample::clear_fills()
+{
+    mFills.clear();
+    mBits &= ~bitmask_fills();
+}
+
+const small_vector<std::string, 2>& Sample::names() const
+{
+    BOOST_ASSERT(exist_names());
+    return mNames;
+}
+
+bool Sample::exist_names() const
+{
+    return (mBits & bitmask_names()) != 0;
+}
+
+Sample& Sample::set_names(const small_vector<std::string, 2>& names)
+{
+    mNames  = names;
+    mBits  |= bitmask_names();
+    return *this;
+}
+
+small_vector<std::string, 2>& Sample::mutable_names()
+{
+    mBits |= bitmask_names();
+    return mNames;
+}
+
+Sample& Sample::operator<<(const small_vector<std::string, 2>& names)
+{
+    return set_names(names);
+}
+
+const SampleSPtr& operator<<(const SampleSPtr& object, const small_vector<std::string, 2>& names)
+{
+    BOOST_ASSERT(object);
+    *object << names;
+    return object;
+}
+
+Sample& Sample::operator<<(const std::string& namesItem)
+{
+    mBits |= bitmask_names();
+    mNames.push_back(namesItem);
+    return *this;
+}
+
+const SampleSPtr& operator<<(const SampleSPtr& object, const std::string& namesItem)
+{
+    BOOST_ASSERT(object);
+    *object << namesItem;
+    return object;
+}
+
+void Sample::clear_names()
+{
+    mNames.clear();
+    mBits &= ~bitmask_names();
+}
+
+SampleColumns::Row::Row(const SampleColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+const boost::array<long, 3>& SampleColumns::Row::coordinates() const
+{
+    return mColumns.coordinates()[mIndex];
+}
+
+bool SampleColumns::Row::exist_coordinates() const
+{
+    return mColumns.exist_coordinates()[mIndex];
+}
+
+const small_vector<long, 2>& SampleColumns::Row::fills() const
+{
+    return mColumns.fills()[mIndex];
+}
+
+bool SampleColumns::Row::exist_fills() const
+{
+    return mColumns.exist_fills()[mIndex];
+}
+
+const small_vector<std::string, 2>& SampleColumns::Row::names() const
+{
+    return mColumns.names()[mIndex];
+}
+
+bool SampleColumns::Row::exist_names() const
+{
+    return mColumns.exist_names()[mIndex];
+}
+
+SampleColumns::SampleColumns()
+{
+}
+
+SampleColumns::~SampleColumns()
+{
+}
+
+size_t SampleColumns::size() const
+{
+    return mCoordinates.size();
+}
+
+bool SampleColumns::empty() const
+{
+    return mCoordinates.empty();
+}
+
+void SampleColumns::reserve(size_t size)
+{
+    mCoordinates.reserve(size);
+    mCoordinatesAvailability.reserve(size);
+    mFills.reserve(size);
+    mFillsAvailability.reserve(size);
+    mNames.reserve(size);
+    mNamesAvailability.reserve(size);
+}
+
+void SampleColumns::clear()
+{
+    mCoordinates.clear();
+    mCoordinatesAvailability.clear();
+    mFills.clear();
+    mFillsAvailability.clear();
+    mNames.clear();
+    mNamesAvailability.clear();
+}
+
+void SampleColumns::push_back(const Sample& object)
+{
+    mCoordinatesAvailability.push_back(object.exist_coordinates());
+    if (mCoordinatesAvailability.back())
+        mCoordinates.push_back(object.coordinates());
+    else
+        mCoordinates.resize(mCoordinates.size() + 1);
+    mFillsAvailability.push_back(object.exist_fills());
+    if (mFillsAvailability.back())
+        mFills.push_back(object.fills());
+    else
+        mFills.resize(mFills.size() + 1);
+    mNamesAvailability.push_back(object.exist_names());
+    if (mNamesAvailability.back())
+        mNames.push_back(object.names());
+    else
+        mNames.resize(mNames.size() + 1);
+}
+
+SampleColumns::Row SampleColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<boost::array<long, 3> >& SampleColumns::coordinates() const
+{
+    return mCoordinates;
+}
+
+const std::vector<bool>& SampleColumns::exist_coordinates() const
+{
+    return mCoordinatesAvailability;
+}
+
+const std::vector<small_vector<long, 2> >& SampleColumns::fills() const
+{
+    return mFills;
+}
+
+const std::vector<bool>& SampleColumns::exist_fills() const
+{
+    return mFillsAvailability;
+}
+
+const std::vector<small_vector<std::string, 2> >& SampleColumns::names() const
+{
+    return mNames;
+}
+
+const std::vector<bool>& SampleColumns::exist_names() const
+{
+    return mNamesAvailability;
+}
+
+int Entry::bitmask_id()
+{
+    return 0x1;
+}
+
+int Entry::bitmask_fills()
+{
+    return 0x2;
+}
+
+Entry::Entry()
+        : mBits(0)
+{
+}
+
+Entry::~Entry()
+{
+}
+
+bool Entry::isInitialized() const
+{
+    if (!valid_id()) return false;
+    return true;
+}
+
+long Entry::id() const
+{
+    BOOST_ASSERT(valid_id());
+    return mId;
+}
+
+bool Entry::valid_id() const
+{
+    return (mBits & bitmask_id()) != 0;
+}
+
+Entry& Entry::set_id(long id)
+{
+    mId    = id;
+    mBits |= bitmask_id();
+    return *this;
+}
+
+void Entry::erase_id()
+{
+    mId    =  0;
+    mBits &= ~bitmask_id();
+}
+
+const small_vector<long, 4>& Entry::fills() const
+{
+    BOOST_ASSERT(exist_fills());
+    return mFills;
+}
+
+bool Entry::exist_fills() const
+{
+    return (mBits & bitmask_fills()) != 0;
+}
+
+Entry& Entry::set_fills(const small_vector<long, 4>& fills)
+{
+    mFills  = fills;
+    mBits  |= bitmask_fills();
+    return *this;
+}
+
+small_vector<long, 4>& Entry::mutable_fills()
+{
+    mBits |= bitmask_fills();
+    return mFills;
+}
+
+void Entry::clear_fills()
+{
+    mFills.clear();
+    mBits &= ~bitmask_fills();
+}
+
+EntryColumns::Row::Row(const EntryColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long EntryColumns::Row::id() const
+{
+    return mColumns.id()[mIndex];
+}
+
+bool EntryColumns::Row::valid_id() const
+{
+    return mColumns.valid_id()[mIndex];
+}
+
+const small_vector<long, 4>& EntryColumns::Row::fills() const
+{
+    return mColumns.fills()[mIndex];
+}
+
+bool EntryColumns::Row::exist_fills() const
+{
+    return mColumns.exist_fills()[mIndex];
+}
+
+EntryColumns::EntryColumns()
+{
+}
+
+EntryColumns::~EntryColumns()
+{
+}
+
+size_t EntryColumns::size() const
+{
+    return mId.size();
+}
+
+bool EntryColumns::empty() const
+{
+    return mId.empty();
+}
+
+void EntryColumns::reserve(size_t size)
+{
+    mId.reserve(size);
+    mIdAvailability.reserve(size);
+    mFills.reserve(size);
+    mFillsAvailability.reserve(size);
+}
+
+void EntryColumns::clear()
+{
+    mId.clear();
+    mIdAvailability.clear();
+    mFills.clear();
+    mFillsAvailability.clear();
+}
+
+void EntryColumns::push_back(const Entry& object)
+{
+    mIdAvailability.push_back(object.valid_id());
+    if (mIdAvailability.back())
+        mId.push_back(object.id());
+    else
+        mId.resize(mId.size() + 1);
+    mFillsAvailability.push_back(object.exist_fills());
+    if (mFillsAvailability.back())
+        mFills.push_back(object.fills());
+    else
+        mFills.resize(mFills.size() + 1);
+}
+
+EntryColumns::Row EntryColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& EntryColumns::id() const
+{
+    return mId;
+}
+
+const std::vector<bool>& EntryColumns::valid_id() const
+{
+    return mIdAvailability;
+}
+
+const std::vector<small_vector<long, 4> >& EntryColumns::fills() const
+{
+    return mFills;
+}
+
+const std::vector<bool>& EntryColumns::exist_fills() const
+{
+    return mFillsAvailability;
+}
+
+}
+
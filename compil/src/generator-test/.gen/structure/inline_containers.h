@@ -0,0 +1,326 @@
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __STRUCTURE_INLINE_CONTAINERS_COMPIL_H_
+#define __STRUCTURE_INLINE_CONTAINERS_COMPIL_H_
+
+#include "structure/inline_containers-fwd.h"
+// Compil C++ Template Library
+#include "core/compil/small_vector.h"
+// Boost C++ Array
+#include <boost/array.hpp>
+
+namespace inline_containers
+{
+
+class Sample
+{
+public:
+    // Default constructor
+                                                Sample             ();
+    // Destructor
+    /*lax*/                                     ~Sample            ();
+
+    // Returns true if every required field is initialized.
+            bool                                isInitialized      ()                                          const;
+
+            bool                                isVoid             ()                                          const;
+
+    // Getter method for the data field coordinates
+            const boost::array<long, 3>&        coordinates        ()                                          const;
+    // Checks if the optional field coordinates exists
+            bool                                exist_coordinates  ()                                          const;
+    // Setter method for the data field coordinates
+            Sample&                             set_coordinates    (const boost::array<long, 3>& coordinates);
+    // Provides mutable access to field coordinates
+            boost::array<long, 3>&              mutable_coordinates();
+    // Store operator for the data field coordinates
+            Sample&                             operator<<         (const boost::array<long, 3>& coordinates);
+    // Clears the optional data field coordinates
+            void                                clear_coordinates  ();
+
+    // Getter method for the data field fills
+            const small_vector<long, 2>&        fills              ()                                          const;
+    // Checks if the optional field fills exists
+            bool                                exist_fills        ()                                          const;
+    // Setter method for the data field fills
+            Sample&                             set_fills          (const small_vector<long, 2>& fills);
+    // Provides mutable access to field fills
+            small_vector<long, 2>&              mutable_fills      ();
+    // Store operator for the data field fills
+            Sample&                             operator<<         (const small_vector<long, 2>& fills);
+    // Store operator for an item of data field fills
+            Sample&                             operator<<         (long fillsItem);
+    // Clears the optional data field fills
+            void                                clear_fills        ();
+
+    // Getter method for the data field names
+            const small_vector<std::string, 2>& names              ()                                          const;
+    // Checks if the optional field names exists
+            bool                                exist_names        ()                                          const;
+    // Setter method for the data field names
+            Sample&                             set_names          (const small_vector<std::string, 2>& names);
+    // Provides mutable access to field names
+            small_vector<std::string, 2>&       mutable_names      ();
+    // Store operator for the data field names
+            Sample&                             operator<<         (const small_vector<std::string, 2>& names);
+    // Store operator for an item of data field names
+            Sample&                             operator<<         (const std::string& namesItem);
+    // Clears the optional data field names
+            void                                clear_names        ();
+
+private:
+    // Returns unique bitmask value for the field coordinates
+    static int bitmask_coordinates();
+    // Returns unique bitmask value for the field fills
+    static int bitmask_fills      ();
+    // Returns unique bitmask value for the field names
+    static int bitmask_names      ();
+
+    // Stores availability information for the fields
+    int                          mBits;
+
+    // variable for the data field coordinates
+    boost::array<long, 3>        mCoordinates;
+    // variable for the data field fills
+    small_vector<long, 2>        mFills;
+    // variable for the data field names
+    small_vector<std::string, 2> mNames;
+};
+
+// Reference store operator for the data field coordinates
+const SampleSPtr& operator<<(const SampleSPtr& , const boost::array<long, 3>& );
+// Reference store operator for the data field fills
+const SampleSPtr& operator<<(const SampleSPtr& , const small_vector<long, 2>& );
+// Reference store operator for an item of data field fills
+const SampleSPtr& operator<<(const SampleSPtr& , long );
+// Reference store operator for the data field names
+const SampleSPtr& operator<<(const SampleSPtr& , const small_vector<std::string, 2>& );
+// Reference store operator for an item of data field names
+const SampleSPtr& operator<<(const SampleSPtr& , const std::string& );
+
+// SampleColumns holds Sample objects column by column - one contiguous
+// array per data field. Use it for large collections that are scanned one
+// or two fields at a time. Such scan touches only the memory of the
+// columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class SampleColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                                 Row              (const SampleColumns& columns, size_t index);
+
+        // Getter method for the data field coordinates
+                             const boost::array<long, 3>&        coordinates      ()                                           const;
+        // Returns true if the data field coordinates is available in the
+        // row
+                             bool                                exist_coordinates()                                           const;
+
+        // Getter method for the data field fills
+                             const small_vector<long, 2>&        fills            ()                                           const;
+        // Returns true if the data field fills is available in the row
+                             bool                                exist_fills      ()                                           const;
+
+        // Getter method for the data field names
+                             const small_vector<std::string, 2>& names            ()                                           const;
+        // Returns true if the data field names is available in the row
+                             bool                                exist_names      ()                                           const;
+    private:
+        const SampleColumns& mColumns;
+        size_t               mIndex;
+    };
+
+    // Default constructor
+                                                      SampleColumns    ();
+    // Destructor
+                                                      ~SampleColumns   ();
+
+    // Returns the number of the rows
+    size_t                                            size             ()                     const;
+    // Returns true if there are no rows
+    bool                                              empty            ()                     const;
+    // Reserves memory for size rows in every column
+    void                                              reserve          (size_t size);
+    // Removes all the rows
+    void                                              clear            ();
+
+    // Appends a row with the data fields of the object
+    void                                              push_back        (const Sample& object);
+
+    // Returns proxy of the row index
+    Row                                               operator[]       (size_t index)         const;
+
+    // Column of the data field coordinates
+    const std::vector<boost::array<long, 3> >&        coordinates      ()                     const;
+    // Availability bitmap of the data field coordinates
+    const std::vector<bool>&                          exist_coordinates()                     const;
+
+    // Column of the data field fills
+    const std::vector<small_vector<long, 2> >&        fills            ()                     const;
+    // Availability bitmap of the data field fills
+    const std::vector<bool>&                          exist_fills      ()                     const;
+
+    // Column of the data field names
+    const std::vector<small_vector<std::string, 2> >& names            ()                     const;
+    // Availability bitmap of the data field names
+    const std::vector<bool>&                          exist_names      ()                     const;
+
+private:
+    // column of the data field coordinates
+    std::vector<boost::array<long, 3> >        mCoordinates;
+    // availability bitmap of the data field coordinates
+    std::vector<bool>                          mCoordinatesAvailability;
+    // column of the data field fills
+    std::vector<small_vector<long, 2> >        mFills;
+    // availability bitmap of the data field fills
+    std::vector<bool>                          mFillsAvailability;
+    // column of the data field names
+    std::vector<small_vector<std::string, 2> > mNames;
+    // availability bitmap of the data field names
+    std::vector<bool>                          mNamesAvailability;
+};
+
+class Entry
+{
+public:
+    // Default constructor
+                                         Entry        ();
+    // Destructor
+    /*lax*/                              ~Entry       ();
+
+    // Returns true if every required field is initialized.
+            bool                         isInitialized()                                   const;
+
+    // Getter method for the data field id
+            long                         id           ()                                   const;
+    // Returns true if the data field id was set and could be considered
+    // valid
+            bool                         valid_id     ()                                   const;
+    // Setter method for the data field id
+            Entry&                       set_id       (long id);
+    // Erases the required data field id. Object can not be instantiated
+    // before the field data is set again
+            void                         erase_id     ();
+
+    // Getter method for the data field fills
+            const small_vector<long, 4>& fills        ()                                   const;
+    // Checks if the optional field fills exists
+            bool                         exist_fills  ()                                   const;
+    // Setter method for the data field fills
+            Entry&                       set_fills    (const small_vector<long, 4>& fills);
+    // Provides mutable access to field fills
+            small_vector<long, 4>&       mutable_fills();
+    // Clears the optional data field fills
+            void                         clear_fills  ();
+
+private:
+    // Returns unique bitmask value for the field id
+    static int bitmask_id   ();
+    // Returns unique bitmask value for the field fills
+    static int bitmask_fills();
+
+    // Stores availability information for the fields
+    int                   mBits;
+
+    // variable for the data field id
+    long                  mId;
+    // variable for the data field fills
+    small_vector<long, 4> mFills;
+};
+
+// EntryColumns holds Entry objects column by column - one contiguous array
+// per data field. Use it for large collections that are scanned one or two
+// fields at a time. Such scan touches only the memory of the columns it
+// reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class EntryColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                         Row        (const EntryColumns& columns, size_t index);
+
+        // Getter method for the data field id
+                            long                         id         ()                                          const;
+        // Returns true if the data field id is available in the row
+                            bool                         valid_id   ()                                          const;
+
+        // Getter method for the data field fills
+                            const small_vector<long, 4>& fills      ()                                          const;
+        // Returns true if the data field fills is available in the row
+                            bool                         exist_fills()                                          const;
+    private:
+        const EntryColumns& mColumns;
+        size_t              mIndex;
+    };
+
+    // Default constructor
+                                               EntryColumns ();
+    // Destructor
+                                               ~EntryColumns();
+
+    // Returns the number of the rows
+    size_t                                     size         ()                    const;
+    // Returns true if there are no rows
+    bool                                       empty        ()                    const;
+    // Reserves memory for size rows in every column
+    void                                       reserve      (size_t size);
+    // Removes all the rows
+    void                                       clear        ();
+
+    // Appends a row with the data fields of the object
+    void                                       push_back    (const Entry& object);
+
+    // Returns proxy of the row index
+    Row                                        operator[]   (size_t index)        const;
+
+    // Column of the data field id
+    const std::vector<long>&                   id           ()                    const;
+    // Availability bitmap of the data field id
+    const std::vector<bool>&                   valid_id     ()                    const;
+
+    // Column of the data field fills
+    const std::vector<small_vector<long, 4> >& fills        ()                    const;
+    // Availability bitmap of the data field fills
+    const std::vector<bool>&                   exist_fills  ()                    const;
+
+private:
+    // column of the data field id
+    std::vector<long>                   mId;
+    // availability bitmap of the data field id
+    std::vector<bool>                   mIdAvailability;
+    // column of the data field fills
+    std::vector<small_vector<long, 4> > mFills;
+    // availability bitmap of the data field fills
+    std::vector<bool>                   mFillsAvailability;
+};
+
+inline SampleSPtr sampleRef()
+{
+    return boost::make_shared<Sample>();
+}
+
+}
+
+#endif // __STRUCTURE_INLINE_CONTAINERS_COMPIL_H_
+
@@ -0,0 +1,27 @@
+#ifndef __STRUCTURE_INTERNED_COMPIL__FWD_H_
+#define __STRUCTURE_INTERNED_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace interned
+{
+
+// Forward declarations
+class Point;
+typedef Point*                         PointRPtr;
+typedef boost::shared_ptr<Point>       PointSPtr;
+typedef boost::shared_ptr<const Point> PointSCPtr;
+typedef boost::weak_ptr<Point>         PointWPtr;
+
+class Segment;
+typedef Segment*                         SegmentRPtr;
+typedef boost::shared_ptr<Segment>       SegmentSPtr;
+typedef boost::shared_ptr<const Segment> SegmentSCPtr;
+typedef boost::weak_ptr<Segment>         SegmentWPtr;
+
+}
+
+#endif // __STRUCTURE_INTERNED_COMPIL__FWD_H_
+
@@ -0,0 +1,565 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <string>
+
+#include "structure/interned.h"
+// Compil C++ Template Library
+#include "core/compil/intern_table.h"
+// Boost C++ Hash
+#include <boost/functional/hash.hpp>
+// Standard C Library
+#include <stddef.h>
+
+namespace interned
+{
+
+Point::Builder::Builder()
+        : mpObject(new Point())
+{
+}
+
+Point::Builder::Builder(const Point& object)
+        : mpObject(new Point())
+{
+    *(Point*)mpObject = object;
+}
+
+Point::Builder::Builder(PointRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Point::Builder::~Builder()
+{
+    delete (PointRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Point& Point::Builder::build() const
+{
+    return *(PointRPtr)mpObject;
+}
+
+PointSPtr Point::Builder::finalize()
+{
+    PointRPtr objectRPtr = (PointRPtr)mpObject;
+    mpObject = NULL;
+    return internTable().intern(objectRPtr);
+}
+
+Point::Point()
+{
+}
+
+Point::~Point()
+{
+}
+
+bool Point::operator==(const Point& object) const
+{
+    if (this == &object) return true;
+    if (x() != object.x()) return false;
+    if (y() != object.y()) return false;
+    return label() == object.label();
+}
+
+bool Point::operator==(const PointSPtr& object) const
+{
+    return *this == *object;
+}
+
+long Point::x() const
+{
+    return mX;
+}
+
+Point::Builder& Point::Builder::set_x(long x)
+{
+    mpObject->mX = x;
+    return *this;
+}
+
+long Point::y() const
+{
+    return mY;
+}
+
+Point::Builder& Point::Builder::set_y(long y)
+{
+    mpObject->mY = y;
+    return *this;
+}
+
+const std::string& Point::label() const
+{
+    return mLabel;
+}
+
+Point::Builder& Point::Builder::set_label(const std::string& label)
+{
+    mpObject->mLabel = label;
+    return *this;
+}
+
+std::string& Point::Builder::mutable_label()
+{
+    return mpObject->mLabel.mutate();
+}
+
+size_t Point::internHash() const
+{
+    size_t seed = 0;
+    boost::hash_combine(seed, x());
+    boost::hash_combine(seed, y());
+    boost::hash_combine(seed, label());
+    return seed;
+}
+
+bool Point::internEquals(const Point& object) const
+{
+    if (this == &object) return true;
+    if (!(x() == object.x())) return false;
+    if (!(y() == object.y())) return false;
+    if (!(label() == object.label())) return false;
+    return true;
+}
+
+intern_table<Point>& Point::internTable()
+{
+    static intern_table<Point>* table = new intern_table<Point>();
+    return *table;
+}
+
+size_t Point::internTableSize()
+{
+    return internTable().size();
+}
+
+size_t Point::internTableLookups()
+{
+    return internTable().lookups();
+}
+
+size_t Point::internTableHits()
+{
+    return internTable().hits();
+}
+
+double Point::internTableHitRatio()
+{
+    return internTable().hit_ratio();
+}
+
+PointColumns::Row::Row(const PointColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long PointColumns::Row::x() const
+{
+    return mColumns.x()[mIndex];
+}
+
+long PointColumns::Row::y() const
+{
+    return mColumns.y()[mIndex];
+}
+
+const std::string& PointColumns::Row::label() const
+{
+    return mColumns.label()[mIndex];
+}
+
+PointColumns::PointColumns()
+{
+}
+
+PointColumns::~PointColumns()
+{
+}
+
+size_t PointColumns::size() const
+{
+    return mX.size();
+}
+
+bool PointColumns::empty() const
+{
+    return mX.empty();
+}
+
+void PointColumns::reserve(size_t size)
+{
+    mX.reserve(size);
+    mY.reserve(size);
+    mLabel.reserve(size);
+}
+
+void PointColumns::clear()
+{
+    mX.clear();
+    mY.clear();
+    mLabel.clear();
+}
+
+void PointColumns::push_back(const Point& object)
+{
+    mX.push_back(object.x());
+    mY.push_back(object.y());
+    mLabel.push_back(object.label());
+}
+
+void PointColumns::push_back(const Point::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+PointColumns::Row PointColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& PointColumns::x() const
+{
+    return mX;
+}
+
+const std::vector<long>& PointColumns::y() const
+{
+    return mY;
+}
+
+const std::vector<std::string>& PointColumns::label() const
+{
+    return mLabel;
+}
+
+int Segment::bitmask_from()
+{
+    return 0x1;
+}
+
+int Segment::bitmask_to()
+{
+    return 0x2;
+}
+
+int Segment::bitmask_name()
+{
+    return 0x4;
+}
+
+Segment::Builder::Builder()
+        : mpObject(new Segment())
+{
+}
+
+Segment::Builder::Builder(const Segment& object)
+        : mpObject(new Segment())
+{
+    *(Segment*)mpObject = object;
+}
+
+Segment::Builder::Builder(SegmentRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Segment::Builder::~Builder()
+{
+    delete (SegmentRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Segment& Segment::Builder::build() const
+{
+    BOOST_ASSERT(mpObject->isInitialized());
+    return *(SegmentRPtr)mpObject;
+}
+
+SegmentSPtr Segment::Builder::finalize()
+{
+    BOOST_ASSERT(mpObject->isInitialized());
+    SegmentRPtr objectRPtr = (SegmentRPtr)mpObject;
+    mpObject = NULL;
+    return internTable().intern(objectRPtr);
+}
+
+Segment::Segment()
+        : mBits(0)
+{
+}
+
+Segment::~Segment()
+{
+}
+
+bool Segment::isInitialized() const
+{
+    if (!valid_from()) return false;
+    if (!valid_to()) return false;
+    return true;
+}
+
+const PointSPtr& Segment::from() const
+{
+    BOOST_ASSERT(valid_from());
+    return mFrom;
+}
+
+bool Segment::valid_from() const
+{
+    return (mBits & bitmask_from()) != 0;
+}
+
+Segment::Builder& Segment::Builder::set_from(const PointSPtr& from)
+{
+    mpObject->mFrom  = from;
+    mpObject->mBits |= bitmask_from();
+    return *this;
+}
+
+void Segment::Builder::erase_from()
+{
+    mpObject->mFrom.reset();
+    mpObject->mBits &= ~bitmask_from();
+}
+
+const PointSPtr& Segment::to() const
+{
+    BOOST_ASSERT(valid_to());
+    return mTo;
+}
+
+bool Segment::valid_to() const
+{
+    return (mBits & bitmask_to()) != 0;
+}
+
+Segment::Builder& Segment::Builder::set_to(const PointSPtr& to)
+{
+    mpObject->mTo    = to;
+    mpObject->mBits |= bitmask_to();
+    return *this;
+}
+
+void Segment::Builder::erase_to()
+{
+    mpObject->mTo.reset();
+    mpObject->mBits &= ~bitmask_to();
+}
+
+const std::string& Segment::name() const
+{
+    BOOST_ASSERT(exist_name());
+    return mName;
+}
+
+bool Segment::exist_name() const
+{
+    return (mBits & bitmask_name()) != 0;
+}
+
+Segment::Builder& Segment::Builder::set_name(const std::string& name)
+{
+    mpObject->mName  = name;
+    mpObject->mBits |= bitmask_name();
+    return *this;
+}
+
+std::string& Segment::Builder::mutable_name()
+{
+    mpObject->mBits |= bitmask_name();
+    return mpObject->mName.mutate();
+}
+
+void Segment::Builder::clear_name()
+{
+    mpObject->mName.clear();
+    mpObject->mBits &= ~bitmask_name();
+}
+
+size_t Segment::internHash() const
+{
+    size_t seed = 0;
+    if (valid_from()) boost::hash_combine(seed, from().get());
+    if (valid_to()) boost::hash_combine(seed, to().get());
+    if (exist_name()) boost::hash_combine(seed, name());
+    return seed;
+}
+
+bool Segment::internEquals(const Segment& object) const
+{
+    if (this == &object) return true;
+    if (valid_from() != object.valid_from()) return false;
+    if (valid_from() && !(from() == object.from())) return false;
+    if (valid_to() != object.valid_to()) return false;
+    if (valid_to() && !(to() == object.to())) return false;
+    if (exist_name() != object.exist_name()) return false;
+    if (exist_name() && !(name() == object.name())) return false;
+    return true;
+}
+
+intern_table<Segment>& Segment::internTable()
+{
+    static intern_table<Segment>* table = new intern_table<Segment>();
+    return *table;
+}
+
+size_t Segment::internTableSize()
+{
+    return internTable().size();
+}
+
+size_t Segment::internTableLookups()
+{
+    return internTable().lookups();
+}
+
+size_t Segment::internTableHits()
+{
+    return internTable().hits();
+}
+
+double Segment::internTableHitRatio()
+{
+    return internTable().hit_ratio();
+}
+
+SegmentColumns::Row::Row(const SegmentColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+const PointSPtr& SegmentColumns::Row::from() const
+{
+    return mColumns.from()[mIndex];
+}
+
+bool SegmentColumns::Row::valid_from() const
+{
+    return mColumns.valid_from()[mIndex];
+}
+
+const PointSPtr& SegmentColumns::Row::to() const
+{
+    return mColumns.to()[mIndex];
+}
+
+bool SegmentColumns::Row::valid_to() const
+{
+    return mColumns.valid_to()[mIndex];
+}
+
+const std::string& SegmentColumns::Row::name() const
+{
+    return mColumns.name()[mIndex];
+}
+
+bool SegmentColumns::Row::exist_name() const
+{
+    return mColumns.exist_name()[mIndex];
+}
+
+SegmentColumns::SegmentColumns()
+{
+}
+
+SegmentColumns::~SegmentColumns()
+{
+}
+
+size_t SegmentColumns::size() const
+{
+    return mFrom.size();
+}
+
+bool SegmentColumns::empty() const
+{
+    return mFrom.empty();
+}
+
+void SegmentColumns::reserve(size_t size)
+{
+    mFrom.reserve(size);
+    mFromAvailability.reserve(size);
+    mTo.reserve(size);
+    mToAvailability.reserve(size);
+    mName.reserve(size);
+    mNameAvailability.reserve(size);
+}
+
+void SegmentColumns::clear()
+{
+    mFrom.clear();
+    mFromAvailability.clear();
+    mTo.clear();
+    mToAvailability.clear();
+    mName.clear();
+    mNameAvailability.clear();
+}
+
+void SegmentColumns::push_back(const Segment& object)
+{
+    mFromAvailability.push_back(object.valid_from());
+    if (mFromAvailability.back())
+        mFrom.push_back(object.from());
+    else
+        mFrom.resize(mFrom.size() + 1);
+    mToAvailability.push_back(object.valid_to());
+    if (mToAvailability.back())
+        mTo.push_back(object.to());
+    else
+        mTo.resize(mTo.size() + 1);
+    mNameAvailability.push_back(object.exist_name());
+    if (mNameAvailability.back())
+        mName.push_back(object.name());
+    else
+        mName.resize(mName.size() + 1);
+}
+
+void SegmentColumns::push_back(const Segment::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+SegmentColumns::Row SegmentColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<PointSPtr>& SegmentColumns::from() const
+{
+    return mFrom;
+}
+
+const std::vector<bool>& SegmentColumns::valid_from() const
+{
+    return mFromAvailability;
+}
+
+const std::vector<PointSPtr>& SegmentColumns::to() const
+{
+    return mTo;
+}
+
+const std::vector<bool>& SegmentColumns::valid_to() const
+{
+    return mToAvailability;
+}
+
+const std::vector<std::string>& SegmentColumns::name() const
+{
+    return mName;
+}
+
+const std::vector<bool>& SegmentColumns::exist_name() const
+{
+    return mNameAvailability;
+}
+
+}
+
@@ -0,0 +1,454 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __STRUCTURE_INTERNED_COMPIL_H_
+#define __STRUCTURE_INTERNED_COMPIL_H_
+
+#include "structure/interned-fwd.h"
+// Compil C++ Template Library
+#include "core/compil/intern_table.h"
+#include "core/compil/shared_value.h"
+
+template<class T> class snapshot;
+
+namespace interned
+{
+
+// Point is an immutable class - once instantiated none of the data fields
+// can be changed. For the initial initialization and instantiation use the
+// nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Point
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void         operator=    (const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                             Builder      ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                             Builder      (const Point& object);
+        // Destructor of Builder
+        /*lax*/              ~Builder     ();
+
+        // Instantiates Point instance with the current initialization of
+        // the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Point& build        ()                         const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+        // Note: Point is interned - finalize() provides the already
+        // interned instance with the same fields if there is one.
+                PointSPtr    finalize     ();
+
+
+        // Setter method for the data field x
+                Builder&     set_x        (long x);
+
+        // Setter method for the data field y
+                Builder&     set_y        (long y);
+
+        // Setter method for the data field label
+                Builder&     set_label    (const std::string& label);
+        // Provides mutable access to field label
+                std::string& mutable_label();
+
+    protected:
+        // constructor needed from potential derived classes
+                             Builder      (PointRPtr pObject);
+
+        PointRPtr mpObject;
+    };
+
+    // Default constructor
+                               Point              ();
+    // Destructor
+    /*lax*/                    ~Point             ();
+
+            bool               operator==         (const Point& object)     const;
+
+            bool               operator==         (const PointSPtr& object) const;
+
+    // Getter method for the data field x
+            long               x                  ()                        const;
+
+    // Getter method for the data field y
+            long               y                  ()                        const;
+
+    // Getter method for the data field label
+            const std::string& label              ()                        const;
+
+    // Returns hash of all the fields. Used by the intern table.
+            size_t             internHash         ()                        const;
+    // Returns true if all the fields are equal. Used by the intern table.
+    // Note: The interned instances are unique, so two instances provided
+    // by finalize() are equal only if they are the same instance.
+            bool               internEquals       (const Point& object)     const;
+
+    // Returns the number of the interned instances that are still
+    // referenced
+    static  size_t             internTableSize    ();
+    // Returns the number of the finalize() calls
+    static  size_t             internTableLookups ();
+    // Returns the number of the finalize() calls that provided an already
+    // interned instance
+    static  size_t             internTableHits    ();
+    // Returns the ratio between the hits and the lookups of the intern
+    // table
+    static  double             internTableHitRatio();
+
+private:
+    // Holds the canonical instances provided by finalize(). The table is
+    // never destroyed, because the instances could outlive the static
+    // objects.
+    static intern_table<Point>& internTable();
+
+    // variable for the data field x
+    long                      mX;
+    // variable for the data field y
+    long                      mY;
+    // variable for the data field label
+    shared_value<std::string> mLabel;
+};
+
+// Holder of the current Point shared between threads. The readers get the
+// current object wait-free through a view, the writers publish the results
+// of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Point> PointSnapshot;
+
+// PointColumns holds Point objects column by column - one contiguous array
+// per data field. Use it for large collections that are scanned one or two
+// fields at a time. Such scan touches only the memory of the columns it
+// reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class PointColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                               Row  (const PointColumns& columns, size_t index);
+
+        // Getter method for the data field x
+                            long               x    ()                                          const;
+
+        // Getter method for the data field y
+                            long               y    ()                                          const;
+
+        // Getter method for the data field label
+                            const std::string& label()                                          const;
+    private:
+        const PointColumns& mColumns;
+        size_t              mIndex;
+    };
+
+    // Default constructor
+                                    PointColumns ();
+    // Destructor
+                                    ~PointColumns();
+
+    // Returns the number of the rows
+    size_t                          size         ()                              const;
+    // Returns true if there are no rows
+    bool                            empty        ()                              const;
+    // Reserves memory for size rows in every column
+    void                            reserve      (size_t size);
+    // Removes all the rows
+    void                            clear        ();
+
+    // Appends a row with the data fields of the object
+    void                            push_back    (const Point& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                            push_back    (const Point::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                             operator[]   (size_t index)                  const;
+
+    // Column of the data field x
+    const std::vector<long>&        x            ()                              const;
+
+    // Column of the data field y
+    const std::vector<long>&        y            ()                              const;
+
+    // Column of the data field label
+    const std::vector<std::string>& label        ()                              const;
+
+private:
+    // column of the data field x
+    std::vector<long>        mX;
+    // column of the data field y
+    std::vector<long>        mY;
+    // column of the data field label
+    std::vector<std::string> mLabel;
+};
+
+// Segment is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Segment
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void           operator=   (const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                               Builder     ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                               Builder     (const Segment& object);
+        // Destructor of Builder
+        /*lax*/                ~Builder    ();
+
+        // Instantiates Segment instance with the current initialization of
+        // the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Segment& build       ()                        const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+        // Note: Segment is interned - finalize() provides the already
+        // interned instance with the same fields if there is one.
+                SegmentSPtr    finalize    ();
+
+
+        // Setter method for the data field from
+                Builder&       set_from    (const PointSPtr& from);
+        // Erases the required data field from. Object can not be
+        // instantiated before the field data is set again
+                void           erase_from  ();
+
+        // Setter method for the data field to
+                Builder&       set_to      (const PointSPtr& to);
+        // Erases the required data field to. Object can not be
+        // instantiated before the field data is set again
+                void           erase_to    ();
+
+        // Setter method for the data field name
+                Builder&       set_name    (const std::string& name);
+        // Provides mutable access to field name
+                std::string&   mutable_name();
+        // Clears the optional data field name
+                void           clear_name  ();
+
+    protected:
+        // constructor needed from potential derived classes
+                               Builder     (SegmentRPtr pObject);
+
+        SegmentRPtr mpObject;
+    };
+
+    // Default constructor
+                               Segment            ();
+    // Destructor
+    /*lax*/                    ~Segment           ();
+
+    // Returns true if every required field is initialized.
+    // Note: If the class is used properly it should always return true,
+    // because the object could be instantiated only if it is already
+    // initialized and can not be changed. Called by the Builder class.
+            bool               isInitialized      ()                      const;
+
+    // Getter method for the data field from
+            const PointSPtr&   from               ()                      const;
+    // Returns true if the data field from was set and could be considered
+    // valid
+    // Note: If the class is used properly it should always return true. It
+    // makes sense when it is called indirectly through isInitialized()
+    // from the Builder class
+            bool               valid_from         ()                      const;
+
+    // Getter method for the data field to
+            const PointSPtr&   to                 ()                      const;
+    // Returns true if the data field to was set and could be considered
+    // valid
+    // Note: If the class is used properly it should always return true. It
+    // makes sense when it is called indirectly through isInitialized()
+    // from the Builder class
+            bool               valid_to           ()                      const;
+
+    // Getter method for the data field name
+            const std::string& name               ()                      const;
+    // Checks if the optional field name exists
+            bool               exist_name         ()                      const;
+
+    // Returns hash of all the fields. Used by the intern table.
+            size_t             internHash         ()                      const;
+    // Returns true if all the fields are equal. Used by the intern table.
+    // Note: The interned instances are unique, so two instances provided
+    // by finalize() are equal only if they are the same instance.
+            bool               internEquals       (const Segment& object) const;
+
+    // Returns the number of the interned instances that are still
+    // referenced
+    static  size_t             internTableSize    ();
+    // Returns the number of the finalize() calls
+    static  size_t             internTableLookups ();
+    // Returns the number of the finalize() calls that provided an already
+    // interned instance
+    static  size_t             internTableHits    ();
+    // Returns the ratio between the hits and the lookups of the intern
+    // table
+    static  double             internTableHitRatio();
+
+private:
+    // Holds the canonical instances provided by finalize(). The table is
+    // never destroyed, because the instances could outlive the static
+    // objects.
+    static intern_table<Segment>& internTable();
+
+    // Returns unique bitmask value for the field from
+    static int bitmask_from();
+    // Returns unique bitmask value for the field to
+    static int bitmask_to  ();
+    // Returns unique bitmask value for the field name
+    static int bitmask_name();
+
+    // Stores availability information for the fields
+    int                       mBits;
+
+    // variable for the data field from
+    PointSPtr                 mFrom;
+    // variable for the data field to
+    PointSPtr                 mTo;
+    // variable for the data field name
+    shared_value<std::string> mName;
+};
+
+// Holder of the current Segment shared between threads. The readers get
+// the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Segment> SegmentSnapshot;
+
+// SegmentColumns holds Segment objects column by column - one contiguous
+// array per data field. Use it for large collections that are scanned one
+// or two fields at a time. Such scan touches only the memory of the
+// columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class SegmentColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                 Row       (const SegmentColumns& columns, size_t index);
+
+        // Getter method for the data field from
+                              const PointSPtr&   from      ()                                            const;
+        // Returns true if the data field from is available in the row
+                              bool               valid_from()                                            const;
+
+        // Getter method for the data field to
+                              const PointSPtr&   to        ()                                            const;
+        // Returns true if the data field to is available in the row
+                              bool               valid_to  ()                                            const;
+
+        // Getter method for the data field name
+                              const std::string& name      ()                                            const;
+        // Returns true if the data field name is available in the row
+                              bool               exist_name()                                            const;
+    private:
+        const SegmentColumns& mColumns;
+        size_t                mIndex;
+    };
+
+    // Default constructor
+                                    SegmentColumns ();
+    // Destructor
+                                    ~SegmentColumns();
+
+    // Returns the number of the rows
+    size_t                          size           ()                                const;
+    // Returns true if there are no rows
+    bool                            empty          ()                                const;
+    // Reserves memory for size rows in every column
+    void                            reserve        (size_t size);
+    // Removes all the rows
+    void                            clear          ();
+
+    // Appends a row with the data fields of the object
+    void                            push_back      (const Segment& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                            push_back      (const Segment::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                             operator[]     (size_t index)                    const;
+
+    // Column of the data field from
+    const std::vector<PointSPtr>&   from           ()                                const;
+    // Availability bitmap of the data field from
+    const std::vector<bool>&        valid_from     ()                                const;
+
+    // Column of the data field to
+    const std::vector<PointSPtr>&   to             ()                                const;
+    // Availability bitmap of the data field to
+    const std::vector<bool>&        valid_to       ()                                const;
+
+    // Column of the data field name
+    const std::vector<std::string>& name           ()                                const;
+    // Availability bitmap of the data field name
+    const std::vector<bool>&        exist_name     ()                                const;
+
+private:
+    // column of the data field from
+    std::vector<PointSPtr>   mFrom;
+    // availability bitmap of the data field from
+    std::vector<bool>        mFromAvailability;
+    // column of the data field to
+    std::vector<PointSPtr>   mTo;
+    // availability bitmap of the data field to
+    std::vector<bool>        mToAvailability;
+    // column of the data field name
+    std::vector<std::string> mName;
+    // availability bitmap of the data field name
+    std::vector<bool>        mNameAvailability;
+};
+
+}
+
+#endif // __STRUCTURE_INTERNED_COMPIL_H_
+
@@ -0,0 +1,123 @@
+#ifndef __STRUCTURE_OPERATOR_COMPIL__FWD_H_
+#define __STRUCTURE_OPERATOR_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace operator_
+{
+
+// Forward declarations
+class Structure1;
+typedef Structure1*                         Structure1RPtr;
+typedef boost::shared_ptr<Structure1>       Structure1SPtr;
+typedef boost::shared_ptr<const Structure1> Structure1SCPtr;
+typedef boost::weak_ptr<Structure1>         Structure1WPtr;
+
+class Structure2a;
+typedef Structure2a*                         Structure2aRPtr;
+typedef boost::shared_ptr<Structure2a>       Structure2aSPtr;
+typedef boost::shared_ptr<const Structure2a> Structure2aSCPtr;
+typedef boost::weak_ptr<Structure2a>         Structure2aWPtr;
+
+class Structure2b;
+typedef Structure2b*                         Structure2bRPtr;
+typedef boost::shared_ptr<Structure2b>       Structure2bSPtr;
+typedef boost::shared_ptr<const Structure2b> Structure2bSCPtr;
+typedef boost::weak_ptr<Structure2b>         Structure2bWPtr;
+
+class NoOperatorStructure;
+typedef NoOperatorStructure*                         NoOperatorStructureRPtr;
+typedef boost::shared_ptr<NoOperatorStructure>       NoOperatorStructureSPtr;
+typedef boost::shared_ptr<const NoOperatorStructure> NoOperatorStructureSCPtr;
+typedef boost::weak_ptr<NoOperatorStructure>         NoOperatorStructureWPtr;
+
+class INoOperatorWithNativeEqStructure;
+typedef INoOperatorWithNativeEqStructure*                         INoOperatorWithNativeEqStructureRPtr;
+typedef boost::shared_ptr<INoOperatorWithNativeEqStructure>       INoOperatorWithNativeEqStructureSPtr;
+typedef boost::shared_ptr<const INoOperatorWithNativeEqStructure> INoOperatorWithNativeEqStructureSCPtr;
+typedef boost::weak_ptr<INoOperatorWithNativeEqStructure>         INoOperatorWithNativeEqStructureWPtr;
+
+class INoOperatorWithNativeLtStructure;
+typedef INoOperatorWithNativeLtStructure*                         INoOperatorWithNativeLtStructureRPtr;
+typedef boost::shared_ptr<INoOperatorWithNativeLtStructure>       INoOperatorWithNativeLtStructureSPtr;
+typedef boost::shared_ptr<const INoOperatorWithNativeLtStructure> INoOperatorWithNativeLtStructureSCPtr;
+typedef boost::weak_ptr<INoOperatorWithNativeLtStructure>         INoOperatorWithNativeLtStructureWPtr;
+
+class INoOperatorWithFunctionalEqStructure;
+typedef INoOperatorWithFunctionalEqStructure*                         INoOperatorWithFunctionalEqStructureRPtr;
+typedef boost::shared_ptr<INoOperatorWithFunctionalEqStructure>       INoOperatorWithFunctionalEqStructureSPtr;
+typedef boost::shared_ptr<const INoOperatorWithFunctionalEqStructure> INoOperatorWithFunctionalEqStructureSCPtr;
+typedef boost::weak_ptr<INoOperatorWithFunctionalEqStructure>         INoOperatorWithFunctionalEqStructureWPtr;
+
+class INoOperatorWithFunctionalLtStructure;
+typedef INoOperatorWithFunctionalLtStructure*                         INoOperatorWithFunctionalLtStructureRPtr;
+typedef boost::shared_ptr<INoOperatorWithFunctionalLtStructure>       INoOperatorWithFunctionalLtStructureSPtr;
+typedef boost::shared_ptr<const INoOperatorWithFunctionalLtStructure> INoOperatorWithFunctionalLtStructureSCPtr;
+typedef boost::weak_ptr<INoOperatorWithFunctionalLtStructure>         INoOperatorWithFunctionalLtStructureWPtr;
+
+class FunctionalEqStructure;
+typedef FunctionalEqStructure*                         FunctionalEqStructureRPtr;
+typedef boost::shared_ptr<FunctionalEqStructure>       FunctionalEqStructureSPtr;
+typedef boost::shared_ptr<const FunctionalEqStructure> FunctionalEqStructureSCPtr;
+typedef boost::weak_ptr<FunctionalEqStructure>         FunctionalEqStructureWPtr;
+
+class IEqWithNativeEqStructure;
+typedef IEqWithNativeEqStructure*                         IEqWithNativeEqStructureRPtr;
+typedef boost::shared_ptr<IEqWithNativeEqStructure>       IEqWithNativeEqStructureSPtr;
+typedef boost::shared_ptr<const IEqWithNativeEqStructure> IEqWithNativeEqStructureSCPtr;
+typedef boost::weak_ptr<IEqWithNativeEqStructure>         IEqWithNativeEqStructureWPtr;
+
+class IEqWithNativeLtStructure;
+typedef IEqWithNativeLtStructure*                         IEqWithNativeLtStructureRPtr;
+typedef boost::shared_ptr<IEqWithNativeLtStructure>       IEqWithNativeLtStructureSPtr;
+typedef boost::shared_ptr<const IEqWithNativeLtStructure> IEqWithNativeLtStructureSCPtr;
+typedef boost::weak_ptr<IEqWithNativeLtStructure>         IEqWithNativeLtStructureWPtr;
+
+class IFunctionalEqWithFunctionalEqStructure;
+typedef IFunctionalEqWithFunctionalEqStructure*                         IFunctionalEqWithFunctionalEqStructureRPtr;
+typedef boost::shared_ptr<IFunctionalEqWithFunctionalEqStructure>       IFunctionalEqWithFunctionalEqStructureSPtr;
+typedef boost::shared_ptr<const IFunctionalEqWithFunctionalEqStructure> IFunctionalEqWithFunctionalEqStructureSCPtr;
+typedef boost::weak_ptr<IFunctionalEqWithFunctionalEqStructure>         IFunctionalEqWithFunctionalEqStructureWPtr;
+
+class IFunctionalEqWithFunctionalLtStructure;
+typedef IFunctionalEqWithFunctionalLtStructure*                         IFunctionalEqWithFunctionalLtStructureRPtr;
+typedef boost::shared_ptr<IFunctionalEqWithFunctionalLtStructure>       IFunctionalEqWithFunctionalLtStructureSPtr;
+typedef boost::shared_ptr<const IFunctionalEqWithFunctionalLtStructure> IFunctionalEqWithFunctionalLtStructureSCPtr;
+typedef boost::weak_ptr<IFunctionalEqWithFunctionalLtStructure>         IFunctionalEqWithFunctionalLtStructureWPtr;
+
+class IFunctionalEqWithFunctorEqStructure;
+typedef IFunctionalEqWithFunctorEqStructure*                         IFunctionalEqWithFunctorEqStructureRPtr;
+typedef boost::shared_ptr<IFunctionalEqWithFunctorEqStructure>       IFunctionalEqWithFunctorEqStructureSPtr;
+typedef boost::shared_ptr<const IFunctionalEqWithFunctorEqStructure> IFunctionalEqWithFunctorEqStructureSCPtr;
+typedef boost::weak_ptr<IFunctionalEqWithFunctorEqStructure>         IFunctionalEqWithFunctorEqStructureWPtr;
+
+class IFunctionalEqWithFunctorLtStructure;
+typedef IFunctionalEqWithFunctorLtStructure*                         IFunctionalEqWithFunctorLtStructureRPtr;
+typedef boost::shared_ptr<IFunctionalEqWithFunctorLtStructure>       IFunctionalEqWithFunctorLtStructureSPtr;
+typedef boost::shared_ptr<const IFunctionalEqWithFunctorLtStructure> IFunctionalEqWithFunctorLtStructureSCPtr;
+typedef boost::weak_ptr<IFunctionalEqWithFunctorLtStructure>         IFunctionalEqWithFunctorLtStructureWPtr;
+
+class CompareKey;
+typedef CompareKey*                         CompareKeyRPtr;
+typedef boost::shared_ptr<CompareKey>       CompareKeySPtr;
+typedef boost::shared_ptr<const CompareKey> CompareKeySCPtr;
+typedef boost::weak_ptr<CompareKey>         CompareKeyWPtr;
+
+class CompareRecord;
+typedef CompareRecord*                         CompareRecordRPtr;
+typedef boost::shared_ptr<CompareRecord>       CompareRecordSPtr;
+typedef boost::shared_ptr<const CompareRecord> CompareRecordSCPtr;
+typedef boost::weak_ptr<CompareRecord>         CompareRecordWPtr;
+
+class ICompareRecord;
+typedef ICompareRecord*                         ICompareRecordRPtr;
+typedef boost::shared_ptr<ICompareRecord>       ICompareRecordSPtr;
+typedef boost::shared_ptr<const ICompareRecord> ICompareRecordSCPtr;
+typedef boost::weak_ptr<ICompareRecord>         ICompareRecordWPtr;
+
+}
+
+#endif // __STRUCTURE_OPERATOR_COMPIL__FWD_H_
+
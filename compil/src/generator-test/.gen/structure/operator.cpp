@@ -0,0 +1,2015 @@
+// Standard Template Library
+#include <string>
+
+#include "structure/operator.h"
+// Standard C Library
+#include <string.h>
+
+namespace operator_
+{
+
+Structure1::Structure1()
+{
+}
+
+Structure1::~Structure1()
+{
+}
+
+bool Structure1::operator==(const Structure1& object) const
+{
+    if (i1() != object.i1()) return false;
+    if (w1() != object.w1()) return false;
+    if (s1() != object.s1()) return false;
+    return str1() == object.str1();
+}
+
+bool Structure1::operator==(const Structure1SPtr& object) const
+{
+    return *this == *object;
+}
+
+bool Structure1::isEqual(const Structure1& object) const
+{
+    return *this == object;
+}
+
+bool Structure1::isEqual(const Structure1SPtr& object) const
+{
+    return *this == *object;
+}
+
+int Structure1::compare(const Structure1& object) const
+{
+    // can not compare Strong
+    int result = ((object.i1() < i1()) - (i1() < object.i1())) * 2
+               + ((object.w1() < w1()) - (w1() < object.w1()));
+    if (result) return result;
+    return str1().compare(object.str1());
+}
+
+bool Structure1::operator<(const Structure1& object) const
+{
+    return compare(object) < 0;
+}
+
+bool Structure1::operator<(const Structure1SPtr& object) const
+{
+    return *this < *object;
+}
+
+bool Structure1::lessThan(const Structure1& object) const
+{
+    return *this < object;
+}
+
+bool Structure1::lessThan(const Structure1SPtr& object) const
+{
+    return *this < *object;
+}
+
+bool Structure1::lessThan::operator()(const Structure1& object1, const Structure1& object2) const
+{
+    return object1 < object2;
+}
+
+bool Structure1::lessThan::operator()(const Structure1SPtr& object1, const Structure1SPtr& object2) const
+{
+    return *object1 < *object2;
+}
+
+Structure1::EWeak::EWeak()
+        : mValue(kInvalid)
+{
+}
+
+Structure1::EWeak::EWeak(long value)
+        : mValue(value)
+{
+}
+
+const long Structure1::EWeak::invalid()
+{
+    return kInvalid;
+}
+
+const long Structure1::EWeak::value1()
+{
+    return kValue1;
+}
+
+const long Structure1::EWeak::value2()
+{
+    return kValue2;
+}
+
+long Structure1::EWeak::value() const
+{
+    return mValue;
+}
+
+const char* Structure1::EWeak::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "value1",
+        "value2",
+    };
+    return names[(size_t)value];
+}
+
+const char* Structure1::EWeak::shortName() const
+{
+    return shortName(value());
+}
+
+Structure1::EWeak Structure1::EWeak::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        2, 2,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "value2",
+        "value1",
+    };
+    static const size_t lengths[] =
+    {
+        7, 6, 6,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kValue2,
+        kValue1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return Structure1::EWeak();
+    return Structure1::EWeak(values[slot]);
+}
+
+Structure1::EWeak::operator long () const
+{
+    return mValue;
+}
+
+Structure1::EStrong::EStrong()
+        : mValue(kInvalid)
+{
+}
+
+Structure1::EStrong::EStrong(long value)
+        : mValue(value)
+{
+}
+
+const Structure1::EStrong Structure1::EStrong::invalid()
+{
+    return EStrong(kInvalid);
+}
+
+const Structure1::EStrong Structure1::EStrong::value1()
+{
+    return EStrong(kValue1);
+}
+
+const Structure1::EStrong Structure1::EStrong::value2()
+{
+    return EStrong(kValue2);
+}
+
+long Structure1::EStrong::value() const
+{
+    return mValue;
+}
+
+const char* Structure1::EStrong::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "value1",
+        "value2",
+    };
+    return names[(size_t)value];
+}
+
+const char* Structure1::EStrong::shortName() const
+{
+    return shortName(value());
+}
+
+Structure1::EStrong Structure1::EStrong::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        2, 2,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "value2",
+        "value1",
+    };
+    static const size_t lengths[] =
+    {
+        7, 6, 6,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kValue2,
+        kValue1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return Structure1::EStrong();
+    return Structure1::EStrong(values[slot]);
+}
+
+bool Structure1::EStrong::operator==(const EStrong& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool Structure1::EStrong::operator!=(const EStrong& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+long Structure1::i1() const
+{
+    return mI1;
+}
+
+Structure1& Structure1::set_i1(long i1)
+{
+    mI1 = i1;
+    return *this;
+}
+
+const Structure1::EWeak& Structure1::w1() const
+{
+    return mW1;
+}
+
+Structure1& Structure1::set_w1(const EWeak& w1)
+{
+    mW1 = w1;
+    return *this;
+}
+
+Structure1::EWeak& Structure1::mutable_w1()
+{
+    return mW1;
+}
+
+const Structure1::EStrong& Structure1::s1() const
+{
+    return mS1;
+}
+
+Structure1& Structure1::set_s1(const EStrong& s1)
+{
+    mS1 = s1;
+    return *this;
+}
+
+Structure1::EStrong& Structure1::mutable_s1()
+{
+    return mS1;
+}
+
+const std::string& Structure1::str1() const
+{
+    return mStr1;
+}
+
+Structure1& Structure1::set_str1(const std::string& str1)
+{
+    mStr1 = str1;
+    return *this;
+}
+
+std::string& Structure1::mutable_str1()
+{
+    return mStr1;
+}
+
+Structure1Columns::Row::Row(const Structure1Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure1Columns::Row::i1() const
+{
+    return mColumns.i1()[mIndex];
+}
+
+const Structure1::EWeak& Structure1Columns::Row::w1() const
+{
+    return mColumns.w1()[mIndex];
+}
+
+const Structure1::EStrong& Structure1Columns::Row::s1() const
+{
+    return mColumns.s1()[mIndex];
+}
+
+const std::string& Structure1Columns::Row::str1() const
+{
+    return mColumns.str1()[mIndex];
+}
+
+Structure1Columns::Structure1Columns()
+{
+}
+
+Structure1Columns::~Structure1Columns()
+{
+}
+
+size_t Structure1Columns::size() const
+{
+    return mI1.size();
+}
+
+bool Structure1Columns::empty() const
+{
+    return mI1.empty();
+}
+
+void Structure1Columns::reserve(size_t size)
+{
+    mI1.reserve(size);
+    mW1.reserve(size);
+    mS1.reserve(size);
+    mStr1.reserve(size);
+}
+
+void Structure1Columns::clear()
+{
+    mI1.clear();
+    mW1.clear();
+    mS1.clear();
+    mStr1.clear();
+}
+
+void Structure1Columns::push_back(const Structure1& object)
+{
+    mI1.push_back(object.i1());
+    mW1.push_back(object.w1());
+    mS1.push_back(object.s1());
+    mStr1.push_back(object.str1());
+}
+
+Structure1Columns::Row Structure1Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure1Columns::i1() const
+{
+    return mI1;
+}
+
+const std::vector<Structure1::EWeak>& Structure1Columns::w1() const
+{
+    return mW1;
+}
+
+const std::vector<Structure1::EStrong>& Structure1Columns::s1() const
+{
+    return mS1;
+}
+
+const std::vector<std::string>& Structure1Columns::str1() const
+{
+    return mStr1;
+}
+
+Structure2a::Structure2a()
+{
+}
+
+Structure2a::~Structure2a()
+{
+}
+
+Structure2aSPtr Structure2a::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2a>(object);
+}
+
+bool Structure2a::operator==(const Structure2a& object) const
+{
+    return (const Structure1&)*this == (const Structure1&)object;
+}
+
+bool Structure2a::operator==(const Structure2aSPtr& object) const
+{
+    return *this == *object;
+}
+
+bool Structure2a::isEqual(const Structure2a& object) const
+{
+    return *this == object;
+}
+
+bool Structure2a::isEqual(const Structure2aSPtr& object) const
+{
+    return *this == *object;
+}
+
+int Structure2a::compare(const Structure2a& object) const
+{
+    return Structure1::compare(object);
+}
+
+bool Structure2a::operator<(const Structure2a& object) const
+{
+    return compare(object) < 0;
+}
+
+bool Structure2a::operator<(const Structure2aSPtr& object) const
+{
+    return *this < *object;
+}
+
+bool Structure2a::lessThan(const Structure2a& object) const
+{
+    return *this < object;
+}
+
+bool Structure2a::lessThan(const Structure2aSPtr& object) const
+{
+    return *this < *object;
+}
+
+Structure2a& Structure2a::set_i1(long i1)
+{
+    Structure1::set_i1(i1);
+    return *this;
+}
+
+Structure2a& Structure2a::set_w1(const EWeak& w1)
+{
+    Structure1::set_w1(w1);
+    return *this;
+}
+
+Structure2a& Structure2a::set_s1(const EStrong& s1)
+{
+    Structure1::set_s1(s1);
+    return *this;
+}
+
+Structure2a& Structure2a::set_str1(const std::string& str1)
+{
+    Structure1::set_str1(str1);
+    return *this;
+}
+
+Structure2aColumns::Row::Row(const Structure2aColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure2aColumns::Row::i1() const
+{
+    return mColumns.i1()[mIndex];
+}
+
+const Structure1::EWeak& Structure2aColumns::Row::w1() const
+{
+    return mColumns.w1()[mIndex];
+}
+
+const Structure1::EStrong& Structure2aColumns::Row::s1() const
+{
+    return mColumns.s1()[mIndex];
+}
+
+const std::string& Structure2aColumns::Row::str1() const
+{
+    return mColumns.str1()[mIndex];
+}
+
+Structure2aColumns::Structure2aColumns()
+{
+}
+
+Structure2aColumns::~Structure2aColumns()
+{
+}
+
+size_t Structure2aColumns::size() const
+{
+    return mI1.size();
+}
+
+bool Structure2aColumns::empty() const
+{
+    return mI1.empty();
+}
+
+void Structure2aColumns::reserve(size_t size)
+{
+    mI1.reserve(size);
+    mW1.reserve(size);
+    mS1.reserve(size);
+    mStr1.reserve(size);
+}
+
+void Structure2aColumns::clear()
+{
+    mI1.clear();
+    mW1.clear();
+    mS1.clear();
+    mStr1.clear();
+}
+
+void Structure2aColumns::push_back(const Structure2a& object)
+{
+    mI1.push_back(object.i1());
+    mW1.push_back(object.w1());
+    mS1.push_back(object.s1());
+    mStr1.push_back(object.str1());
+}
+
+Structure2aColumns::Row Structure2aColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure2aColumns::i1() const
+{
+    return mI1;
+}
+
+const std::vector<Structure1::EWeak>& Structure2aColumns::w1() const
+{
+    return mW1;
+}
+
+const std::vector<Structure1::EStrong>& Structure2aColumns::s1() const
+{
+    return mS1;
+}
+
+const std::vector<std::string>& Structure2aColumns::str1() const
+{
+    return mStr1;
+}
+
+Structure2b::Structure2b()
+{
+}
+
+Structure2b::~Structure2b()
+{
+}
+
+Structure2bSPtr Structure2b::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2b>(object);
+}
+
+bool Structure2b::operator==(const Structure2b& object) const
+{
+    if (!((const Structure1&)*this == (const Structure1&)object)) return false;
+    if (i2() != object.i2()) return false;
+    return s2() == object.s2();
+}
+
+bool Structure2b::operator==(const Structure2bSPtr& object) const
+{
+    return *this == *object;
+}
+
+bool Structure2b::isEqual(const Structure2b& object) const
+{
+    return *this == object;
+}
+
+bool Structure2b::isEqual(const Structure2bSPtr& object) const
+{
+    return *this == *object;
+}
+
+int Structure2b::compare(const Structure2b& object) const
+{
+    int result = Structure1::compare(object);
+    if (result) return result;
+    result = (object.i2() < i2()) - (i2() < object.i2());
+    if (result) return result;
+    return s2().compare(object.s2());
+}
+
+bool Structure2b::operator<(const Structure2b& object) const
+{
+    return compare(object) < 0;
+}
+
+bool Structure2b::operator<(const Structure2bSPtr& object) const
+{
+    return *this < *object;
+}
+
+bool Structure2b::lessThan(const Structure2b& object) const
+{
+    return *this < object;
+}
+
+bool Structure2b::lessThan(const Structure2bSPtr& object) const
+{
+    return *this < *object;
+}
+
+long Structure2b::i2() const
+{
+    return mI2;
+}
+
+Structure2b& Structure2b::set_i2(long i2)
+{
+    mI2 = i2;
+    return *this;
+}
+
+const Structure2a& Structure2b::s2() const
+{
+    return mS2;
+}
+
+Structure2b& Structure2b::set_s2(const Structure2a& s2)
+{
+    mS2 = s2;
+    return *this;
+}
+
+Structure2a& Structure2b::mutable_s2()
+{
+    return mS2;
+}
+
+Structure2b& Structure2b::set_i1(long i1)
+{
+    Structure1::set_i1(i1);
+    return *this;
+}
+
+Structure2b& Structure2b::set_w1(const EWeak& w1)
+{
+    Structure1::set_w1(w1);
+    return *this;
+}
+
+Structure2b& Structure2b::set_s1(const EStrong& s1)
+{
+    Structure1::set_s1(s1);
+    return *this;
+}
+
+Structure2b& Structure2b::set_str1(const std::string& str1)
+{
+    Structure1::set_str1(str1);
+    return *this;
+}
+
+Structure2bColumns::Row::Row(const Structure2bColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure2bColumns::Row::i1() const
+{
+    return mColumns.i1()[mIndex];
+}
+
+const Structure1::EWeak& Structure2bColumns::Row::w1() const
+{
+    return mColumns.w1()[mIndex];
+}
+
+const Structure1::EStrong& Structure2bColumns::Row::s1() const
+{
+    return mColumns.s1()[mIndex];
+}
+
+const std::string& Structure2bColumns::Row::str1() const
+{
+    return mColumns.str1()[mIndex];
+}
+
+long Structure2bColumns::Row::i2() const
+{
+    return mColumns.i2()[mIndex];
+}
+
+const Structure2a& Structure2bColumns::Row::s2() const
+{
+    return mColumns.s2()[mIndex];
+}
+
+Structure2bColumns::Structure2bColumns()
+{
+}
+
+Structure2bColumns::~Structure2bColumns()
+{
+}
+
+size_t Structure2bColumns::size() const
+{
+    return mI1.size();
+}
+
+bool Structure2bColumns::empty() const
+{
+    return mI1.empty();
+}
+
+void Structure2bColumns::reserve(size_t size)
+{
+    mI1.reserve(size);
+    mW1.reserve(size);
+    mS1.reserve(size);
+    mStr1.reserve(size);
+    mI2.reserve(size);
+    mS2.reserve(size);
+}
+
+void Structure2bColumns::clear()
+{
+    mI1.clear();
+    mW1.clear();
+    mS1.clear();
+    mStr1.clear();
+    mI2.clear();
+    mS2.clear();
+}
+
+void Structure2bColumns::push_back(const Structure2b& object)
+{
+    mI1.push_back(object.i1());
+    mW1.push_back(object.w1());
+    mS1.push_back(object.s1());
+    mStr1.push_back(object.str1());
+    mI2.push_back(object.i2());
+    mS2.push_back(object.s2());
+}
+
+Structure2bColumns::Row Structure2bColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure2bColumns::i1() const
+{
+    return mI1;
+}
+
+const std::vector<Structure1::EWeak>& Structure2bColumns::w1() const
+{
+    return mW1;
+}
+
+const std::vector<Structure1::EStrong>& Structure2bColumns::s1() const
+{
+    return mS1;
+}
+
+const std::vector<std::string>& Structure2bColumns::str1() const
+{
+    return mStr1;
+}
+
+const std::vector<long>& Structure2bColumns::i2() const
+{
+    return mI2;
+}
+
+const std::vector<Structure2a>& Structure2bColumns::s2() const
+{
+    return mS2;
+}
+
+NoOperatorStructure::NoOperatorStructure()
+{
+}
+
+NoOperatorStructure::~NoOperatorStructure()
+{
+}
+
+long NoOperatorStructure::i() const
+{
+    return mI;
+}
+
+NoOperatorStructure& NoOperatorStructure::set_i(long i)
+{
+    mI = i;
+    return *this;
+}
+
+NoOperatorStructureColumns::Row::Row(const NoOperatorStructureColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long NoOperatorStructureColumns::Row::i() const
+{
+    return mColumns.i()[mIndex];
+}
+
+NoOperatorStructureColumns::NoOperatorStructureColumns()
+{
+}
+
+NoOperatorStructureColumns::~NoOperatorStructureColumns()
+{
+}
+
+size_t NoOperatorStructureColumns::size() const
+{
+    return mI.size();
+}
+
+bool NoOperatorStructureColumns::empty() const
+{
+    return mI.empty();
+}
+
+void NoOperatorStructureColumns::reserve(size_t size)
+{
+    mI.reserve(size);
+}
+
+void NoOperatorStructureColumns::clear()
+{
+    mI.clear();
+}
+
+void NoOperatorStructureColumns::push_back(const NoOperatorStructure& object)
+{
+    mI.push_back(object.i());
+}
+
+NoOperatorStructureColumns::Row NoOperatorStructureColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& NoOperatorStructureColumns::i() const
+{
+    return mI;
+}
+
+INoOperatorWithNativeEqStructure::INoOperatorWithNativeEqStructure()
+{
+}
+
+INoOperatorWithNativeEqStructure::~INoOperatorWithNativeEqStructure()
+{
+}
+
+INoOperatorWithNativeEqStructureSPtr INoOperatorWithNativeEqStructure::downcast(const NoOperatorStructureSPtr& object)
+{
+    return boost::static_pointer_cast<INoOperatorWithNativeEqStructure>(object);
+}
+
+bool INoOperatorWithNativeEqStructure::operator==(const INoOperatorWithNativeEqStructure& object) const
+{
+    return i() == object.i();
+}
+
+bool INoOperatorWithNativeEqStructure::operator==(const INoOperatorWithNativeEqStructureSPtr& object) const
+{
+    return *this == *object;
+}
+
+INoOperatorWithNativeEqStructure& INoOperatorWithNativeEqStructure::set_i(long i)
+{
+    NoOperatorStructure::set_i(i);
+    return *this;
+}
+
+INoOperatorWithNativeEqStructureColumns::Row::Row(const INoOperatorWithNativeEqStructureColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long INoOperatorWithNativeEqStructureColumns::Row::i() const
+{
+    return mColumns.i()[mIndex];
+}
+
+INoOperatorWithNativeEqStructureColumns::INoOperatorWithNativeEqStructureColumns()
+{
+}
+
+INoOperatorWithNativeEqStructureColumns::~INoOperatorWithNativeEqStructureColumns()
+{
+}
+
+size_t INoOperatorWithNativeEqStructureColumns::size() const
+{
+    return mI.size();
+}
+
+bool INoOperatorWithNativeEqStructureColumns::empty() const
+{
+    return mI.empty();
+}
+
+void INoOperatorWithNativeEqStructureColumns::reserve(size_t size)
+{
+    mI.reserve(size);
+}
+
+void INoOperatorWithNativeEqStructureColumns::clear()
+{
+    mI.clear();
+}
+
+void INoOperatorWithNativeEqStructureColumns::push_back(const INoOperatorWithNativeEqStructure& object)
+{
+    mI.push_back(object.i());
+}
+
+INoOperatorWithNativeEqStructureColumns::Row INoOperatorWithNativeEqStructureColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& INoOperatorWithNativeEqStructureColumns::i() const
+{
+    return mI;
+}
+
+INoOperatorWithNativeLtStructure::INoOperatorWithNativeLtStructure()
+{
+}
+
+INoOperatorWithNativeLtStructure::~INoOperatorWithNativeLtStructure()
+{
+}
+
+INoOperatorWithNativeLtStructureSPtr INoOperatorWithNativeLtStructure::downcast(const NoOperatorStructureSPtr& object)
+{
+    return boost::static_pointer_cast<INoOperatorWithNativeLtStructure>(object);
+}
+
+int INoOperatorWithNativeLtStructure::compare(const INoOperatorWithNativeLtStructure& object) const
+{
+    return (object.i() < i()) - (i() < object.i());
+}
+
+bool INoOperatorWithNativeLtStructure::operator<(const INoOperatorWithNativeLtStructure& object) const
+{
+    return compare(object) < 0;
+}
+
+bool INoOperatorWithNativeLtStructure::operator<(const INoOperatorWithNativeLtStructureSPtr& object) const
+{
+    return *this < *object;
+}
+
+INoOperatorWithNativeLtStructure& INoOperatorWithNativeLtStructure::set_i(long i)
+{
+    NoOperatorStructure::set_i(i);
+    return *this;
+}
+
+INoOperatorWithNativeLtStructureColumns::Row::Row(const INoOperatorWithNativeLtStructureColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long INoOperatorWithNativeLtStructureColumns::Row::i() const
+{
+    return mColumns.i()[mIndex];
+}
+
+INoOperatorWithNativeLtStructureColumns::INoOperatorWithNativeLtStructureColumns()
+{
+}
+
+INoOperatorWithNativeLtStructureColumns::~INoOperatorWithNativeLtStructureColumns()
+{
+}
+
+size_t INoOperatorWithNativeLtStructureColumns::size() const
+{
+    return mI.size();
+}
+
+bool INoOperatorWithNativeLtStructureColumns::empty() const
+{
+    return mI.empty();
+}
+
+void INoOperatorWithNativeLtStructureColumns::reserve(size_t size)
+{
+    mI.reserve(size);
+}
+
+void INoOperatorWithNativeLtStructureColumns::clear()
+{
+    mI.clear();
+}
+
+void INoOperatorWithNativeLtStructureColumns::push_back(const INoOperatorWithNativeLtStructure& object)
+{
+    mI.push_back(object.i());
+}
+
+INoOperatorWithNativeLtStructureColumns::Row INoOperatorWithNativeLtStructureColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& INoOperatorWithNativeLtStructureColumns::i() const
+{
+    return mI;
+}
+
+INoOperatorWithFunctionalEqStructure::INoOperatorWithFunctionalEqStructure()
+{
+}
+
+INoOperatorWithFunctionalEqStructure::~INoOperatorWithFunctionalEqStructure()
+{
+}
+
+INoOperatorWithFunctionalEqStructureSPtr INoOperatorWithFunctionalEqStructure::downcast(const NoOperatorStructureSPtr& object)
+{
+    return boost::static_pointer_cast<INoOperatorWithFunctionalEqStructure>(object);
+}
+
+bool INoOperatorWithFunctionalEqStructure::isEqual(const INoOperatorWithFunctionalEqStructure& object) const
+{
+    return i() == object.i();
+}
+
+bool INoOperatorWithFunctionalEqStructure::isEqual(const INoOperatorWithFunctionalEqStructureSPtr& object) const
+{
+    return isEqual(*object);
+}
+
+INoOperatorWithFunctionalEqStructure& INoOperatorWithFunctionalEqStructure::set_i(long i)
+{
+    NoOperatorStructure::set_i(i);
+    return *this;
+}
+
+INoOperatorWithFunctionalEqStructureColumns::Row::Row(const INoOperatorWithFunctionalEqStructureColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long INoOperatorWithFunctionalEqStructureColumns::Row::i() const
+{
+    return mColumns.i()[mIndex];
+}
+
+INoOperatorWithFunctionalEqStructureColumns::INoOperatorWithFunctionalEqStructureColumns()
+{
+}
+
+INoOperatorWithFunctionalEqStructureColumns::~INoOperatorWithFunctionalEqStructureColumns()
+{
+}
+
+size_t INoOperatorWithFunctionalEqStructureColumns::size() const
+{
+    return mI.size();
+}
+
+bool INoOperatorWithFunctionalEqStructureColumns::empty() const
+{
+    return mI.empty();
+}
+
+void INoOperatorWithFunctionalEqStructureColumns::reserve(size_t size)
+{
+    mI.reserve(size);
+}
+
+void INoOperatorWithFunctionalEqStructureColumns::clear()
+{
+    mI.clear();
+}
+
+void INoOperatorWithFunctionalEqStructureColumns::push_back(const INoOperatorWithFunctionalEqStructure& object)
+{
+    mI.push_back(object.i());
+}
+
+INoOperatorWithFunctionalEqStructureColumns::Row INoOperatorWithFunctionalEqStructureColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& INoOperatorWithFunctionalEqStructureColumns::i() const
+{
+    return mI;
+}
+
+INoOperatorWithFunctionalLtStructure::INoOperatorWithFunctionalLtStructure()
+{
+}
+
+INoOperatorWithFunctionalLtStructure::~INoOperatorWithFunctionalLtStructure()
+{
+}
+
+INoOperatorWithFunctionalLtStructureSPtr INoOperatorWithFunctionalLtStructure::downcast(const NoOperatorStructureSPtr& object)
+{
+    return boost::static_pointer_cast<INoOperatorWithFunctionalLtStructure>(object);
+}
+
+int INoOperatorWithFunctionalLtStructure::compare(const INoOperatorWithFunctionalLtStructure& object) const
+{
+    return (object.i() < i()) - (i() < object.i());
+}
+
+bool INoOperatorWithFunctionalLtStructure::lessThan(const INoOperatorWithFunctionalLtStructure& object) const
+{
+    return compare(object) < 0;
+}
+
+bool INoOperatorWithFunctionalLtStructure::lessThan(const INoOperatorWithFunctionalLtStructureSPtr& object) const
+{
+    return lessThan(*object);
+}
+
+INoOperatorWithFunctionalLtStructure& INoOperatorWithFunctionalLtStructure::set_i(long i)
+{
+    NoOperatorStructure::set_i(i);
+    return *this;
+}
+
+INoOperatorWithFunctionalLtStructureColumns::Row::Row(const INoOperatorWithFunctionalLtStructureColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long INoOperatorWithFunctionalLtStructureColumns::Row::i() const
+{
+    return mColumns.i()[mIndex];
+}
+
+INoOperatorWithFunctionalLtStructureColumns::INoOperatorWithFunctionalLtStructureColumns()
+{
+}
+
+INoOperatorWithFunctionalLtStructureColumns::~INoOperatorWithFunctionalLtStructureColumns()
+{
+}
+
+size_t INoOperatorWithFunctionalLtStructureColumns::size() const
+{
+    return mI.size();
+}
+
+bool INoOperatorWithFunctionalLtStructureColumns::empty() const
+{
+    return mI.empty();
+}
+
+void INoOperatorWithFunctionalLtStructureColumns::reserve(size_t size)
+{
+    mI.reserve(size);
+}
+
+void INoOperatorWithFunctionalLtStructureColumns::clear()
+{
+    mI.clear();
+}
+
+void INoOperatorWithFunctionalLtStructureColumns::push_back(const INoOperatorWithFunctionalLtStructure& object)
+{
+    mI.push_back(object.i());
+}
+
+INoOperatorWithFunctionalLtStructureColumns::Row INoOperatorWithFunctionalLtStructureColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& INoOperatorWithFunctionalLtStructureColumns::i() const
+{
+    return mI;
+}
+
+FunctionalEqStructure::FunctionalEqStructure()
+{
+}
+
+FunctionalEqStructure::~FunctionalEqStructure()
+{
+}
+
+bool FunctionalEqStructure::isEqual(const FunctionalEqStructure& object) const
+{
+    return true;
+}
+
+bool FunctionalEqStructure::isEqual(const FunctionalEqStructureSPtr& object) const
+{
+    return isEqual(*object);
+}
+
+IEqWithNativeEqStructure::IEqWithNativeEqStructure()
+{
+}
+
+IEqWithNativeEqStructure::~IEqWithNativeEqStructure()
+{
+}
+
+IEqWithNativeEqStructureSPtr IEqWithNativeEqStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IEqWithNativeEqStructure>(object);
+}
+
+bool IEqWithNativeEqStructure::operator==(const IEqWithNativeEqStructure& object) const
+{
+    return ((const FunctionalEqStructure&)*this).isEqual((const FunctionalEqStructure&)object);
+}
+
+bool IEqWithNativeEqStructure::operator==(const IEqWithNativeEqStructureSPtr& object) const
+{
+    return *this == *object;
+}
+
+IEqWithNativeLtStructure::IEqWithNativeLtStructure()
+{
+}
+
+IEqWithNativeLtStructure::~IEqWithNativeLtStructure()
+{
+}
+
+IEqWithNativeLtStructureSPtr IEqWithNativeLtStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IEqWithNativeLtStructure>(object);
+}
+
+int IEqWithNativeLtStructure::compare(const IEqWithNativeLtStructure& object) const
+{
+    return 0;
+}
+
+bool IEqWithNativeLtStructure::operator<(const IEqWithNativeLtStructure& object) const
+{
+    return compare(object) < 0;
+}
+
+bool IEqWithNativeLtStructure::operator<(const IEqWithNativeLtStructureSPtr& object) const
+{
+    return *this < *object;
+}
+
+IFunctionalEqWithFunctionalEqStructure::IFunctionalEqWithFunctionalEqStructure()
+{
+}
+
+IFunctionalEqWithFunctionalEqStructure::~IFunctionalEqWithFunctionalEqStructure()
+{
+}
+
+IFunctionalEqWithFunctionalEqStructureSPtr IFunctionalEqWithFunctionalEqStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IFunctionalEqWithFunctionalEqStructure>(object);
+}
+
+bool IFunctionalEqWithFunctionalEqStructure::isEqual(const IFunctionalEqWithFunctionalEqStructure& object) const
+{
+    return ((const FunctionalEqStructure&)*this).isEqual((const FunctionalEqStructure&)object);
+}
+
+bool IFunctionalEqWithFunctionalEqStructure::isEqual(const IFunctionalEqWithFunctionalEqStructureSPtr& object) const
+{
+    return isEqual(*object);
+}
+
+IFunctionalEqWithFunctionalLtStructure::IFunctionalEqWithFunctionalLtStructure()
+{
+}
+
+IFunctionalEqWithFunctionalLtStructure::~IFunctionalEqWithFunctionalLtStructure()
+{
+}
+
+IFunctionalEqWithFunctionalLtStructureSPtr IFunctionalEqWithFunctionalLtStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IFunctionalEqWithFunctionalLtStructure>(object);
+}
+
+int IFunctionalEqWithFunctionalLtStructure::compare(const IFunctionalEqWithFunctionalLtStructure& object) const
+{
+    return 0;
+}
+
+bool IFunctionalEqWithFunctionalLtStructure::lessThan(const IFunctionalEqWithFunctionalLtStructure& object) const
+{
+    return compare(object) < 0;
+}
+
+bool IFunctionalEqWithFunctionalLtStructure::lessThan(const IFunctionalEqWithFunctionalLtStructureSPtr& object) const
+{
+    return lessThan(*object);
+}
+
+IFunctionalEqWithFunctorEqStructure::IFunctionalEqWithFunctorEqStructure()
+{
+}
+
+IFunctionalEqWithFunctorEqStructure::~IFunctionalEqWithFunctorEqStructure()
+{
+}
+
+IFunctionalEqWithFunctorEqStructureSPtr IFunctionalEqWithFunctorEqStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IFunctionalEqWithFunctorEqStructure>(object);
+}
+
+bool IFunctionalEqWithFunctorEqStructure::isEqual::operator()(const IFunctionalEqWithFunctorEqStructure& object1,
+                                                              const IFunctionalEqWithFunctorEqStructure& object2)  const
+{
+    return true;
+}
+
+bool IFunctionalEqWithFunctorEqStructure::isEqual::operator()(const IFunctionalEqWithFunctorEqStructureSPtr& object1,
+                                                              const IFunctionalEqWithFunctorEqStructureSPtr& object2)  const
+{
+    return isEqual()(*object1, *object2);
+}
+
+IFunctionalEqWithFunctorLtStructure::IFunctionalEqWithFunctorLtStructure()
+{
+}
+
+IFunctionalEqWithFunctorLtStructure::~IFunctionalEqWithFunctorLtStructure()
+{
+}
+
+IFunctionalEqWithFunctorLtStructureSPtr IFunctionalEqWithFunctorLtStructure::downcast(const FunctionalEqStructureSPtr& object)
+{
+    return boost::static_pointer_cast<IFunctionalEqWithFunctorLtStructure>(object);
+}
+
+int IFunctionalEqWithFunctorLtStructure::compare(const IFunctionalEqWithFunctorLtStructure& object) const
+{
+    return 0;
+}
+
+bool IFunctionalEqWithFunctorLtStructure::lessThan::operator()(const IFunctionalEqWithFunctorLtStructure& object1,
+                                                               const IFunctionalEqWithFunctorLtStructure& object2)  const
+{
+    return object1.compare(object2) < 0;
+}
+
+bool IFunctionalEqWithFunctorLtStructure::lessThan::operator()(const IFunctionalEqWithFunctorLtStructureSPtr& object1,
+                                                               const IFunctionalEqWithFunctorLtStructureSPtr& object2)  const
+{
+    return lessThan()(*object1, *object2);
+}
+
+CompareKey::CompareKey()
+{
+}
+
+CompareKey::~CompareKey()
+{
+}
+
+bool CompareKey::operator==(const CompareKey& object) const
+{
+    return compare(object) == 0;
+}
+
+bool CompareKey::operator==(const CompareKeySPtr& object) const
+{
+    return *this == *object;
+}
+
+int CompareKey::compare(const CompareKey& object) const
+{
+    return ((object.venue() < venue()) - (venue() < object.venue())) * 8
+         + ((object.side() < side()) - (side() < object.side())) * 4
+         + ((object.price() < price()) - (price() < object.price())) * 2
+         + ((object.lot() < lot()) - (lot() < object.lot()));
+}
+
+bool CompareKey::operator<(const CompareKey& object) const
+{
+    return compare(object) < 0;
+}
+
+bool CompareKey::operator<(const CompareKeySPtr& object) const
+{
+    return *this < *object;
+}
+
+bool CompareKey::lessThan::operator()(const CompareKey& object1, const CompareKey& object2) const
+{
+    return object1 < object2;
+}
+
+bool CompareKey::lessThan::operator()(const CompareKeySPtr& object1, const CompareKeySPtr& object2) const
+{
+    return *object1 < *object2;
+}
+
+CompareKey::ESide::ESide()
+        : mValue(kInvalid)
+{
+}
+
+CompareKey::ESide::ESide(long value)
+        : mValue(value)
+{
+}
+
+const long CompareKey::ESide::invalid()
+{
+    return kInvalid;
+}
+
+const long CompareKey::ESide::buy()
+{
+    return kBuy;
+}
+
+const long CompareKey::ESide::sell()
+{
+    return kSell;
+}
+
+long CompareKey::ESide::value() const
+{
+    return mValue;
+}
+
+const char* CompareKey::ESide::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "buy",
+        "sell",
+    };
+    return names[(size_t)value];
+}
+
+const char* CompareKey::ESide::shortName() const
+{
+    return shortName(value());
+}
+
+CompareKey::ESide CompareKey::ESide::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        1, 0,
+    };
+    static const char* names[] =
+    {
+        "sell",
+        "buy",
+        "invalid",
+    };
+    static const size_t lengths[] =
+    {
+        4, 3, 7,
+    };
+    static const long values[] =
+    {
+        kSell,
+        kBuy,
+        kInvalid,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return CompareKey::ESide();
+    return CompareKey::ESide(values[slot]);
+}
+
+CompareKey::ESide::operator long () const
+{
+    return mValue;
+}
+
+long CompareKey::venue() const
+{
+    return mVenue;
+}
+
+CompareKey& CompareKey::set_venue(long venue)
+{
+    mVenue = venue;
+    return *this;
+}
+
+const CompareKey::ESide& CompareKey::side() const
+{
+    return mSide;
+}
+
+CompareKey& CompareKey::set_side(const ESide& side)
+{
+    mSide = side;
+    return *this;
+}
+
+CompareKey::ESide& CompareKey::mutable_side()
+{
+    return mSide;
+}
+
+long CompareKey::price() const
+{
+    return mPrice;
+}
+
+CompareKey& CompareKey::set_price(long price)
+{
+    mPrice = price;
+    return *this;
+}
+
+long CompareKey::lot() const
+{
+    return mLot;
+}
+
+CompareKey& CompareKey::set_lot(long lot)
+{
+    mLot = lot;
+    return *this;
+}
+
+CompareKeyColumns::Row::Row(const CompareKeyColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long CompareKeyColumns::Row::venue() const
+{
+    return mColumns.venue()[mIndex];
+}
+
+const CompareKey::ESide& CompareKeyColumns::Row::side() const
+{
+    return mColumns.side()[mIndex];
+}
+
+long CompareKeyColumns::Row::price() const
+{
+    return mColumns.price()[mIndex];
+}
+
+long CompareKeyColumns::Row::lot() const
+{
+    return mColumns.lot()[mIndex];
+}
+
+CompareKeyColumns::CompareKeyColumns()
+{
+}
+
+CompareKeyColumns::~CompareKeyColumns()
+{
+}
+
+size_t CompareKeyColumns::size() const
+{
+    return mVenue.size();
+}
+
+bool CompareKeyColumns::empty() const
+{
+    return mVenue.empty();
+}
+
+void CompareKeyColumns::reserve(size_t size)
+{
+    mVenue.reserve(size);
+    mSide.reserve(size);
+    mPrice.reserve(size);
+    mLot.reserve(size);
+}
+
+void CompareKeyColumns::clear()
+{
+    mVenue.clear();
+    mSide.clear();
+    mPrice.clear();
+    mLot.clear();
+}
+
+void CompareKeyColumns::push_back(const CompareKey& object)
+{
+    mVenue.push_back(object.venue());
+    mSide.push_back(object.side());
+    mPrice.push_back(object.price());
+    mLot.push_back(object.lot());
+}
+
+CompareKeyColumns::Row CompareKeyColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& CompareKeyColumns::venue() const
+{
+    return mVenue;
+}
+
+const std::vector<CompareKey::ESide>& CompareKeyColumns::side() const
+{
+    return mSide;
+}
+
+const std::vector<long>& CompareKeyColumns::price() const
+{
+    return mPrice;
+}
+
+const std::vector<long>& CompareKeyColumns::lot() const
+{
+    return mLot;
+}
+
+CompareRecord::CompareRecord()
+{
+}
+
+CompareRecord::~CompareRecord()
+{
+}
+
+bool CompareRecord::operator==(const CompareRecord& object) const
+{
+    return compare(object) == 0;
+}
+
+bool CompareRecord::operator==(const CompareRecordSPtr& object) const
+{
+    return *this == *object;
+}
+
+int CompareRecord::compare(const CompareRecord& object) const
+{
+    int result = symbol().compare(object.symbol());
+    if (result) return result;
+    result = key().compare(object.key());
+    if (result) return result;
+    return (object.quantity() < quantity()) - (quantity() < object.quantity());
+}
+
+bool CompareRecord::operator<(const CompareRecord& object) const
+{
+    return compare(object) < 0;
+}
+
+bool CompareRecord::operator<(const CompareRecordSPtr& object) const
+{
+    return *this < *object;
+}
+
+bool CompareRecord::lessThan(const CompareRecord& object) const
+{
+    return *this < object;
+}
+
+bool CompareRecord::lessThan(const CompareRecordSPtr& object) const
+{
+    return *this < *object;
+}
+
+const std::string& CompareRecord::symbol() const
+{
+    return mSymbol;
+}
+
+CompareRecord& CompareRecord::set_symbol(const std::string& symbol)
+{
+    mSymbol = symbol;
+    return *this;
+}
+
+std::string& CompareRecord::mutable_symbol()
+{
+    return mSymbol;
+}
+
+const CompareKey& CompareRecord::key() const
+{
+    return mKey;
+}
+
+CompareRecord& CompareRecord::set_key(const CompareKey& key)
+{
+    mKey = key;
+    return *this;
+}
+
+CompareKey& CompareRecord::mutable_key()
+{
+    return mKey;
+}
+
+long CompareRecord::quantity() const
+{
+    return mQuantity;
+}
+
+CompareRecord& CompareRecord::set_quantity(long quantity)
+{
+    mQuantity = quantity;
+    return *this;
+}
+
+CompareRecordColumns::Row::Row(const CompareRecordColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+const std::string& CompareRecordColumns::Row::symbol() const
+{
+    return mColumns.symbol()[mIndex];
+}
+
+const CompareKey& CompareRecordColumns::Row::key() const
+{
+    return mColumns.key()[mIndex];
+}
+
+long CompareRecordColumns::Row::quantity() const
+{
+    return mColumns.quantity()[mIndex];
+}
+
+CompareRecordColumns::CompareRecordColumns()
+{
+}
+
+CompareRecordColumns::~CompareRecordColumns()
+{
+}
+
+size_t CompareRecordColumns::size() const
+{
+    return mSymbol.size();
+}
+
+bool CompareRecordColumns::empty() const
+{
+    return mSymbol.empty();
+}
+
+void CompareRecordColumns::reserve(size_t size)
+{
+    mSymbol.reserve(size);
+    mKey.reserve(size);
+    mQuantity.reserve(size);
+}
+
+void CompareRecordColumns::clear()
+{
+    mSymbol.clear();
+    mKey.clear();
+    mQuantity.clear();
+}
+
+void CompareRecordColumns::push_back(const CompareRecord& object)
+{
+    mSymbol.push_back(object.symbol());
+    mKey.push_back(object.key());
+    mQuantity.push_back(object.quantity());
+}
+
+CompareRecordColumns::Row CompareRecordColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<std::string>& CompareRecordColumns::symbol() const
+{
+    return mSymbol;
+}
+
+const std::vector<CompareKey>& CompareRecordColumns::key() const
+{
+    return mKey;
+}
+
+const std::vector<long>& CompareRecordColumns::quantity() const
+{
+    return mQuantity;
+}
+
+ICompareRecord::ICompareRecord()
+{
+}
+
+ICompareRecord::~ICompareRecord()
+{
+}
+
+ICompareRecordSPtr ICompareRecord::downcast(const CompareRecordSPtr& object)
+{
+    return boost::static_pointer_cast<ICompareRecord>(object);
+}
+
+int ICompareRecord::compare(const ICompareRecord& object) const
+{
+    int result = CompareRecord::compare(object);
+    if (result) return result;
+    return (object.sequence() < sequence()) - (sequence() < object.sequence());
+}
+
+bool ICompareRecord::operator<(const ICompareRecord& object) const
+{
+    return compare(object) < 0;
+}
+
+bool ICompareRecord::operator<(const ICompareRecordSPtr& object) const
+{
+    return *this < *object;
+}
+
+long ICompareRecord::sequence() const
+{
+    return mSequence;
+}
+
+ICompareRecord& ICompareRecord::set_sequence(long sequence)
+{
+    mSequence = sequence;
+    return *this;
+}
+
+ICompareRecord& ICompareRecord::set_symbol(const std::string& symbol)
+{
+    CompareRecord::set_symbol(symbol);
+    return *this;
+}
+
+ICompareRecord& ICompareRecord::set_key(const CompareKey& key)
+{
+    CompareRecord::set_key(key);
+    return *this;
+}
+
+ICompareRecord& ICompareRecord::set_quantity(long quantity)
+{
+    CompareRecord::set_quantity(quantity);
+    return *this;
+}
+
+ICompareRecordColumns::Row::Row(const ICompareRecordColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+const std::string& ICompareRecordColumns::Row::symbol() const
+{
+    return mColumns.symbol()[mIndex];
+}
+
+const CompareKey& ICompareRecordColumns::Row::key() const
+{
+    return mColumns.key()[mIndex];
+}
+
+long ICompareRecordColumns::Row::quantity() const
+{
+    return mColumns.quantity()[mIndex];
+}
+
+long ICompareRecordColumns::Row::sequence() const
+{
+    return mColumns.sequence()[mIndex];
+}
+
+ICompareRecordColumns::ICompareRecordColumns()
+{
+}
+
+ICompareRecordColumns::~ICompareRecordColumns()
+{
+}
+
+size_t ICompareRecordColumns::size() const
+{
+    return mSymbol.size();
+}
+
+bool ICompareRecordColumns::empty() const
+{
+    return mSymbol.empty();
+}
+
+void ICompareRecordColumns::reserve(size_t size)
+{
+    mSymbol.reserve(size);
+    mKey.reserve(size);
+    mQuantity.reserve(size);
+    mSequence.reserve(size);
+}
+
+void ICompareRecordColumns::clear()
+{
+    mSymbol.clear();
+    mKey.clear();
+    mQuantity.clear();
+    mSequence.clear();
+}
+
+void ICompareRecordColumns::push_back(const ICompareRecord& object)
+{
+    mSymbol.push_back(object.symbol());
+    mKey.push_back(object.key());
+    mQuantity.push_back(object.quantity());
+    mSequence.push_back(object.sequence());
+}
+
+ICompareRecordColumns::Row ICompareRecordColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<std::string>& ICompareRecordColumns::symbol() const
+{
+    return mSymbol;
+}
+
+const std::vector<CompareKey>& ICompareRecordColumns::key() const
+{
+    return mKey;
+}
+
+const std::vector<long>& ICompareRecordColumns::quantity() const
+{
+    return mQuantity;
+}
+
+const std::vector<long>& ICompareRecordColumns::sequence() const
+{
+    return mSequence;
+}
+
+}
+
@@ -0,0 +1,1512 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __STRUCTURE_OPERATOR_COMPIL_H_
+#define __STRUCTURE_OPERATOR_COMPIL_H_
+
+#include "structure/operator-fwd.h"
+// Standard C Library
+#include <stddef.h>
+
+namespace operator_
+{
+
+class Structure1
+{
+public:
+    // Default constructor
+                 Structure1 ();
+    // Destructor
+    /*lax*/      ~Structure1();
+
+            bool operator== (const Structure1& object)                                     const;
+
+            bool operator== (const Structure1SPtr& object)                                 const;
+
+            bool isEqual    (const Structure1& object)                                     const;
+
+            bool isEqual    (const Structure1SPtr& object)                                 const;
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int  compare    (const Structure1& object)                                     const;
+
+            bool operator<  (const Structure1& object)                                     const;
+
+            bool operator<  (const Structure1SPtr& object)                                 const;
+
+            bool lessThan   (const Structure1& object)                                     const;
+
+            bool lessThan   (const Structure1SPtr& object)                                 const;
+
+    struct lessThan {
+            bool operator() (const Structure1& object1, const Structure1& object2)         const;
+
+            bool operator() (const Structure1SPtr& object1, const Structure1SPtr& object2) const;
+    };
+
+    // This enumeration class provides namespaced set of constant values.
+    class EWeak
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             EWeak     ( );
+        // Constructor from an integer value.
+                             EWeak     ( long value);
+
+        // Returns the integer value of the enum.
+               long          value     ( )                              const;
+        // Returns short name for a specified enum value
+        static const char*   shortName ( long value);
+        // Returns short name of the enum value
+               const char*   shortName ( )                              const;
+        // Returns the enum value with a specified short name or invalid if
+        // none of the values has this name. The lookup is a perfect hash.
+        static EWeak         fromString( const char* name, size_t size);
+        // Cast operator that casts the enum to its native type
+               operator long (         ) const;
+
+        // static methods for enum class objects
+        static const long invalid();
+        static const long value1 ();
+        static const long value2 ();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid = 0,
+            kValue1  = 1,
+            kValue2  = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // This enumeration class provides namespaced set of constant values.
+    // It is designed to provide type control over operations with enum
+    // values without need to wait all compilers you are going to use for
+    // this project to support C++0x standard. The type control do not
+    // prevent the variables to be used in switch statements.
+    class EStrong
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             EStrong   ();
+        // Constructor from an integer value.
+        // Note: Avoid using this constructor if possible. It is
+        // appropriate only in case of importing value from components that
+        // you do not have control over (such as 3rd party libraries or
+        // serialization functionality).
+        explicit             EStrong   (long value);
+
+        // Returns the integer value of the enum.
+        // Note: Avoid using this method if possible. It is appropriate
+        // only in case of exporting value to components that you do not
+        // have control over (such as 3rd party libraries or serialization
+        // functionality).
+                 long        value     ()                              const;
+        // Returns short name for a specified enum value
+        static   const char* shortName (long value);
+        // Returns short name of the enum value
+                 const char* shortName ()                              const;
+        // Returns the enum value with a specified short name or invalid if
+        // none of the values has this name. The lookup is a perfect hash.
+        static   EStrong     fromString(const char* name, size_t size);
+        // returns true if the value of the enum is equal to the value of
+        // the argument
+                 bool        operator==(const EStrong& rValue)         const;
+        // returns true if the value of the enum is not equal to the value
+        // of the argument
+                 bool        operator!=(const EStrong& rValue)         const;
+
+        // static methods for enum class objects
+        static const EStrong invalid();
+        static const EStrong value1 ();
+        static const EStrong value2 ();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid = 0,
+            kValue1  = 1,
+            kValue2  = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // Getter method for the data field i1
+    long               i1          ()                        const;
+    // Setter method for the data field i1
+    Structure1&        set_i1      (long i1);
+
+    // Getter method for the data field w1
+    const EWeak&       w1          ()                        const;
+    // Setter method for the data field w1
+    Structure1&        set_w1      (const EWeak& w1);
+    // Provides mutable access to field w1
+    EWeak&             mutable_w1  ();
+
+    // Getter method for the data field s1
+    const EStrong&     s1          ()                        const;
+    // Setter method for the data field s1
+    Structure1&        set_s1      (const EStrong& s1);
+    // Provides mutable access to field s1
+    EStrong&           mutable_s1  ();
+
+    // Getter method for the data field str1
+    const std::string& str1        ()                        const;
+    // Setter method for the data field str1
+    Structure1&        set_str1    (const std::string& str1);
+    // Provides mutable access to field str1
+    std::string&       mutable_str1();
+
+private:
+    // variable for the data field i1
+    long        mI1;
+    // variable for the data field w1
+    EWeak       mW1;
+    // variable for the data field s1
+    EStrong     mS1;
+    // variable for the data field str1
+    std::string mStr1;
+};
+
+// Structure1Columns holds Structure1 objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure1Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                            Row (const Structure1Columns& columns, size_t index);
+
+        // Getter method for the data field i1
+                                 long                       i1  ()                                               const;
+
+        // Getter method for the data field w1
+                                 const Structure1::EWeak&   w1  ()                                               const;
+
+        // Getter method for the data field s1
+                                 const Structure1::EStrong& s1  ()                                               const;
+
+        // Getter method for the data field str1
+                                 const std::string&         str1()                                               const;
+    private:
+        const Structure1Columns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                                            Structure1Columns ();
+    // Destructor
+                                            ~Structure1Columns();
+
+    // Returns the number of the rows
+    size_t                                  size              ()                         const;
+    // Returns true if there are no rows
+    bool                                    empty             ()                         const;
+    // Reserves memory for size rows in every column
+    void                                    reserve           (size_t size);
+    // Removes all the rows
+    void                                    clear             ();
+
+    // Appends a row with the data fields of the object
+    void                                    push_back         (const Structure1& object);
+
+    // Returns proxy of the row index
+    Row                                     operator[]        (size_t index)             const;
+
+    // Column of the data field i1
+    const std::vector<long>&                i1                ()                         const;
+
+    // Column of the data field w1
+    const std::vector<Structure1::EWeak>&   w1                ()                         const;
+
+    // Column of the data field s1
+    const std::vector<Structure1::EStrong>& s1                ()                         const;
+
+    // Column of the data field str1
+    const std::vector<std::string>&         str1              ()                         const;
+
+private:
+    // column of the data field i1
+    std::vector<long>                mI1;
+    // column of the data field w1
+    std::vector<Structure1::EWeak>   mW1;
+    // column of the data field s1
+    std::vector<Structure1::EStrong> mS1;
+    // column of the data field str1
+    std::vector<std::string>         mStr1;
+};
+
+class Structure2a : public Structure1
+{
+public:
+    // Default constructor
+                            Structure2a ();
+    // Destructor
+    /*lax*/                 ~Structure2a();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2aSPtr downcast    (const Structure1SPtr& object);
+
+            bool            operator==  (const Structure2a& object)     const;
+
+            bool            operator==  (const Structure2aSPtr& object) const;
+
+            bool            isEqual     (const Structure2a& object)     const;
+
+            bool            isEqual     (const Structure2aSPtr& object) const;
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int             compare     (const Structure2a& object)     const;
+
+            bool            operator<   (const Structure2a& object)     const;
+
+            bool            operator<   (const Structure2aSPtr& object) const;
+
+            bool            lessThan    (const Structure2a& object)     const;
+
+            bool            lessThan    (const Structure2aSPtr& object) const;
+
+    // Setter method for the data field i1
+            Structure2a&    set_i1      (long i1);
+
+    // Setter method for the data field w1
+            Structure2a&    set_w1      (const EWeak& w1);
+
+    // Setter method for the data field s1
+            Structure2a&    set_s1      (const EStrong& s1);
+
+    // Setter method for the data field str1
+            Structure2a&    set_str1    (const std::string& str1);
+};
+
+// Structure2aColumns holds Structure2a objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure2aColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                             Row (const Structure2aColumns& columns, size_t index);
+
+        // Getter method for the data field i1
+                                  long                       i1  ()                                                const;
+
+        // Getter method for the data field w1
+                                  const Structure1::EWeak&   w1  ()                                                const;
+
+        // Getter method for the data field s1
+                                  const Structure1::EStrong& s1  ()                                                const;
+
+        // Getter method for the data field str1
+                                  const std::string&         str1()                                                const;
+    private:
+        const Structure2aColumns& mColumns;
+        size_t                    mIndex;
+    };
+
+    // Default constructor
+                                            Structure2aColumns ();
+    // Destructor
+                                            ~Structure2aColumns();
+
+    // Returns the number of the rows
+    size_t                                  size               ()                          const;
+    // Returns true if there are no rows
+    bool                                    empty              ()                          const;
+    // Reserves memory for size rows in every column
+    void                                    reserve            (size_t size);
+    // Removes all the rows
+    void                                    clear              ();
+
+    // Appends a row with the data fields of the object
+    void                                    push_back          (const Structure2a& object);
+
+    // Returns proxy of the row index
+    Row                                     operator[]         (size_t index)              const;
+
+    // Column of the data field i1
+    const std::vector<long>&                i1                 ()                          const;
+
+    // Column of the data field w1
+    const std::vector<Structure1::EWeak>&   w1                 ()                          const;
+
+    // Column of the data field s1
+    const std::vector<Structure1::EStrong>& s1                 ()                          const;
+
+    // Column of the data field str1
+    const std::vector<std::string>&         str1               ()                          const;
+
+private:
+    // column of the data field i1
+    std::vector<long>                mI1;
+    // column of the data field w1
+    std::vector<Structure1::EWeak>   mW1;
+    // column of the data field s1
+    std::vector<Structure1::EStrong> mS1;
+    // column of the data field str1
+    std::vector<std::string>         mStr1;
+};
+
+class Structure2b : public Structure1
+{
+public:
+    // Default constructor
+                               Structure2b ();
+    // Destructor
+    /*lax*/                    ~Structure2b();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2bSPtr    downcast    (const Structure1SPtr& object);
+
+            bool               operator==  (const Structure2b& object)     const;
+
+            bool               operator==  (const Structure2bSPtr& object) const;
+
+            bool               isEqual     (const Structure2b& object)     const;
+
+            bool               isEqual     (const Structure2bSPtr& object) const;
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                compare     (const Structure2b& object)     const;
+
+            bool               operator<   (const Structure2b& object)     const;
+
+            bool               operator<   (const Structure2bSPtr& object) const;
+
+            bool               lessThan    (const Structure2b& object)     const;
+
+            bool               lessThan    (const Structure2bSPtr& object) const;
+
+    // Getter method for the data field i2
+            long               i2          ()                              const;
+    // Setter method for the data field i2
+            Structure2b&       set_i2      (long i2);
+
+    // Getter method for the data field s2
+            const Structure2a& s2          ()                              const;
+    // Setter method for the data field s2
+            Structure2b&       set_s2      (const Structure2a& s2);
+    // Provides mutable access to field s2
+            Structure2a&       mutable_s2  ();
+
+    // Setter method for the data field i1
+            Structure2b&       set_i1      (long i1);
+
+    // Setter method for the data field w1
+            Structure2b&       set_w1      (const EWeak& w1);
+
+    // Setter method for the data field s1
+            Structure2b&       set_s1      (const EStrong& s1);
+
+    // Setter method for the data field str1
+            Structure2b&       set_str1    (const std::string& str1);
+
+private:
+    // variable for the data field i2
+    long        mI2;
+    // variable for the data field s2
+    Structure2a mS2;
+};
+
+// Structure2bColumns holds Structure2b objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure2bColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                             Row (const Structure2bColumns& columns, size_t index);
+
+        // Getter method for the data field i1
+                                  long                       i1  ()                                                const;
+
+        // Getter method for the data field w1
+                                  const Structure1::EWeak&   w1  ()                                                const;
+
+        // Getter method for the data field s1
+                                  const Structure1::EStrong& s1  ()                                                const;
+
+        // Getter method for the data field str1
+                                  const std::string&         str1()                                                const;
+
+        // Getter method for the data field i2
+                                  long                       i2  ()                                                const;
+
+        // Getter method for the data field s2
+                                  const Structure2a&         s2  ()                                                const;
+    private:
+        const Structure2bColumns& mColumns;
+        size_t                    mIndex;
+    };
+
+    // Default constructor
+                                            Structure2bColumns ();
+    // Destructor
+                                            ~Structure2bColumns();
+
+    // Returns the number of the rows
+    size_t                                  size               ()                          const;
+    // Returns true if there are no rows
+    bool                                    empty              ()                          const;
+    // Reserves memory for size rows in every column
+    void                                    reserve            (size_t size);
+    // Removes all the rows
+    void                                    clear              ();
+
+    // Appends a row with the data fields of the object
+    void                                    push_back          (const Structure2b& object);
+
+    // Returns proxy of the row index
+    Row                                     operator[]         (size_t index)              const;
+
+    // Column of the data field i1
+    const std::vector<long>&                i1                 ()                          const;
+
+    // Column of the data field w1
+    const std::vector<Structure1::EWeak>&   w1                 ()                          const;
+
+    // Column of the data field s1
+    const std::vector<Structure1::EStrong>& s1                 ()                          const;
+
+    // Column of the data field str1
+    const std::vector<std::string>&         str1               ()                          const;
+
+    // Column of the data field i2
+    const std::vector<long>&                i2                 ()                          const;
+
+    // Column of the data field s2
+    const std::vector<Structure2a>&         s2                 ()                          const;
+
+private:
+    // column of the data field i1
+    std::vector<long>                mI1;
+    // column of the data field w1
+    std::vector<Structure1::EWeak>   mW1;
+    // column of the data field s1
+    std::vector<Structure1::EStrong> mS1;
+    // column of the data field str1
+    std::vector<std::string>         mStr1;
+    // column of the data field i2
+    std::vector<long>                mI2;
+    // column of the data field s2
+    std::vector<Structure2a>         mS2;
+};
+
+class NoOperatorStructure
+{
+public:
+    // Default constructor
+                                 NoOperatorStructure ();
+    // Destructor
+    /*lax*/                      ~NoOperatorStructure();
+
+    // Getter method for the data field i
+            long                 i                   ()       const;
+    // Setter method for the data field i
+            NoOperatorStructure& set_i               (long i);
+
+private:
+    // variable for the data field i
+    long mI;
+};
+
+// NoOperatorStructureColumns holds NoOperatorStructure objects column by
+// column - one contiguous array per data field. Use it for large
+// collections that are scanned one or two fields at a time. Such scan
+// touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class NoOperatorStructureColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                   Row(const NoOperatorStructureColumns& columns, size_t index);
+
+        // Getter method for the data field i
+                                          long     i  ()                                                        const;
+    private:
+        const NoOperatorStructureColumns& mColumns;
+        size_t                            mIndex;
+    };
+
+    // Default constructor
+                             NoOperatorStructureColumns ();
+    // Destructor
+                             ~NoOperatorStructureColumns();
+
+    // Returns the number of the rows
+    size_t                   size                       ()                                  const;
+    // Returns true if there are no rows
+    bool                     empty                      ()                                  const;
+    // Reserves memory for size rows in every column
+    void                     reserve                    (size_t size);
+    // Removes all the rows
+    void                     clear                      ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                  (const NoOperatorStructure& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                 (size_t index)                      const;
+
+    // Column of the data field i
+    const std::vector<long>& i                          ()                                  const;
+
+private:
+    // column of the data field i
+    std::vector<long> mI;
+};
+
+class INoOperatorWithNativeEqStructure : public NoOperatorStructure
+{
+public:
+    // Default constructor
+                                                 INoOperatorWithNativeEqStructure ();
+    // Destructor
+    /*lax*/                                      ~INoOperatorWithNativeEqStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  INoOperatorWithNativeEqStructureSPtr downcast                         (const NoOperatorStructureSPtr& object);
+
+            bool                                 operator==                       (const INoOperatorWithNativeEqStructure& object)     const;
+
+            bool                                 operator==                       (const INoOperatorWithNativeEqStructureSPtr& object) const;
+
+    // Setter method for the data field i
+            INoOperatorWithNativeEqStructure&    set_i                            (long i);
+};
+
+// INoOperatorWithNativeEqStructureColumns holds
+// INoOperatorWithNativeEqStructure objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class INoOperatorWithNativeEqStructureColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                                Row(const INoOperatorWithNativeEqStructureColumns& columns, size_t index);
+
+        // Getter method for the data field i
+                                                       long     i  ()                                                                     const;
+    private:
+        const INoOperatorWithNativeEqStructureColumns& mColumns;
+        size_t                                         mIndex;
+    };
+
+    // Default constructor
+                             INoOperatorWithNativeEqStructureColumns ();
+    // Destructor
+                             ~INoOperatorWithNativeEqStructureColumns();
+
+    // Returns the number of the rows
+    size_t                   size                                    ()                                               const;
+    // Returns true if there are no rows
+    bool                     empty                                   ()                                               const;
+    // Reserves memory for size rows in every column
+    void                     reserve                                 (size_t size);
+    // Removes all the rows
+    void                     clear                                   ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                               (const INoOperatorWithNativeEqStructure& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                              (size_t index)                                   const;
+
+    // Column of the data field i
+    const std::vector<long>& i                                       ()                                               const;
+
+private:
+    // column of the data field i
+    std::vector<long> mI;
+};
+
+class INoOperatorWithNativeLtStructure : public NoOperatorStructure
+{
+public:
+    // Default constructor
+                                                 INoOperatorWithNativeLtStructure ();
+    // Destructor
+    /*lax*/                                      ~INoOperatorWithNativeLtStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  INoOperatorWithNativeLtStructureSPtr downcast                         (const NoOperatorStructureSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                                  compare                          (const INoOperatorWithNativeLtStructure& object)     const;
+
+            bool                                 operator<                        (const INoOperatorWithNativeLtStructure& object)     const;
+
+            bool                                 operator<                        (const INoOperatorWithNativeLtStructureSPtr& object) const;
+
+    // Setter method for the data field i
+            INoOperatorWithNativeLtStructure&    set_i                            (long i);
+};
+
+// INoOperatorWithNativeLtStructureColumns holds
+// INoOperatorWithNativeLtStructure objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class INoOperatorWithNativeLtStructureColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                                Row(const INoOperatorWithNativeLtStructureColumns& columns, size_t index);
+
+        // Getter method for the data field i
+                                                       long     i  ()                                                                     const;
+    private:
+        const INoOperatorWithNativeLtStructureColumns& mColumns;
+        size_t                                         mIndex;
+    };
+
+    // Default constructor
+                             INoOperatorWithNativeLtStructureColumns ();
+    // Destructor
+                             ~INoOperatorWithNativeLtStructureColumns();
+
+    // Returns the number of the rows
+    size_t                   size                                    ()                                               const;
+    // Returns true if there are no rows
+    bool                     empty                                   ()                                               const;
+    // Reserves memory for size rows in every column
+    void                     reserve                                 (size_t size);
+    // Removes all the rows
+    void                     clear                                   ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                               (const INoOperatorWithNativeLtStructure& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                              (size_t index)                                   const;
+
+    // Column of the data field i
+    const std::vector<long>& i                                       ()                                               const;
+
+private:
+    // column of the data field i
+    std::vector<long> mI;
+};
+
+class INoOperatorWithFunctionalEqStructure : public NoOperatorStructure
+{
+public:
+    // Default constructor
+                                                     INoOperatorWithFunctionalEqStructure ();
+    // Destructor
+    /*lax*/                                          ~INoOperatorWithFunctionalEqStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  INoOperatorWithFunctionalEqStructureSPtr downcast                             (const NoOperatorStructureSPtr& object);
+
+            bool                                     isEqual                              (const INoOperatorWithFunctionalEqStructure& object)     const;
+
+            bool                                     isEqual                              (const INoOperatorWithFunctionalEqStructureSPtr& object) const;
+
+    // Setter method for the data field i
+            INoOperatorWithFunctionalEqStructure&    set_i                                (long i);
+};
+
+// INoOperatorWithFunctionalEqStructureColumns holds
+// INoOperatorWithFunctionalEqStructure objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class INoOperatorWithFunctionalEqStructureColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                                    Row(const INoOperatorWithFunctionalEqStructureColumns& columns, size_t index);
+
+        // Getter method for the data field i
+                                                           long     i  ()                                                                         const;
+    private:
+        const INoOperatorWithFunctionalEqStructureColumns& mColumns;
+        size_t                                             mIndex;
+    };
+
+    // Default constructor
+                             INoOperatorWithFunctionalEqStructureColumns ();
+    // Destructor
+                             ~INoOperatorWithFunctionalEqStructureColumns();
+
+    // Returns the number of the rows
+    size_t                   size                                        ()                                                   const;
+    // Returns true if there are no rows
+    bool                     empty                                       ()                                                   const;
+    // Reserves memory for size rows in every column
+    void                     reserve                                     (size_t size);
+    // Removes all the rows
+    void                     clear                                       ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                                   (const INoOperatorWithFunctionalEqStructure& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                                  (size_t index)                                       const;
+
+    // Column of the data field i
+    const std::vector<long>& i                                           ()                                                   const;
+
+private:
+    // column of the data field i
+    std::vector<long> mI;
+};
+
+class INoOperatorWithFunctionalLtStructure : public NoOperatorStructure
+{
+public:
+    // Default constructor
+                                                     INoOperatorWithFunctionalLtStructure ();
+    // Destructor
+    /*lax*/                                          ~INoOperatorWithFunctionalLtStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  INoOperatorWithFunctionalLtStructureSPtr downcast                             (const NoOperatorStructureSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                                      compare                              (const INoOperatorWithFunctionalLtStructure& object)     const;
+
+            bool                                     lessThan                             (const INoOperatorWithFunctionalLtStructure& object)     const;
+
+            bool                                     lessThan                             (const INoOperatorWithFunctionalLtStructureSPtr& object) const;
+
+    // Setter method for the data field i
+            INoOperatorWithFunctionalLtStructure&    set_i                                (long i);
+};
+
+// INoOperatorWithFunctionalLtStructureColumns holds
+// INoOperatorWithFunctionalLtStructure objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class INoOperatorWithFunctionalLtStructureColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                                    Row(const INoOperatorWithFunctionalLtStructureColumns& columns, size_t index);
+
+        // Getter method for the data field i
+                                                           long     i  ()                                                                         const;
+    private:
+        const INoOperatorWithFunctionalLtStructureColumns& mColumns;
+        size_t                                             mIndex;
+    };
+
+    // Default constructor
+                             INoOperatorWithFunctionalLtStructureColumns ();
+    // Destructor
+                             ~INoOperatorWithFunctionalLtStructureColumns();
+
+    // Returns the number of the rows
+    size_t                   size                                        ()                                                   const;
+    // Returns true if there are no rows
+    bool                     empty                                       ()                                                   const;
+    // Reserves memory for size rows in every column
+    void                     reserve                                     (size_t size);
+    // Removes all the rows
+    void                     clear                                       ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                                   (const INoOperatorWithFunctionalLtStructure& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                                  (size_t index)                                       const;
+
+    // Column of the data field i
+    const std::vector<long>& i                                           ()                                                   const;
+
+private:
+    // column of the data field i
+    std::vector<long> mI;
+};
+
+class FunctionalEqStructure
+{
+public:
+    // Default constructor
+                 FunctionalEqStructure ();
+    // Destructor
+    /*lax*/      ~FunctionalEqStructure();
+
+            bool isEqual               (const FunctionalEqStructure& object)     const;
+
+            bool isEqual               (const FunctionalEqStructureSPtr& object) const;
+};
+
+class IEqWithNativeEqStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                         IEqWithNativeEqStructure ();
+    // Destructor
+    /*lax*/                              ~IEqWithNativeEqStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IEqWithNativeEqStructureSPtr downcast                 (const FunctionalEqStructureSPtr& object);
+
+            bool                         operator==               (const IEqWithNativeEqStructure& object)     const;
+
+            bool                         operator==               (const IEqWithNativeEqStructureSPtr& object) const;
+};
+
+class IEqWithNativeLtStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                         IEqWithNativeLtStructure ();
+    // Destructor
+    /*lax*/                              ~IEqWithNativeLtStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IEqWithNativeLtStructureSPtr downcast                 (const FunctionalEqStructureSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                          compare                  (const IEqWithNativeLtStructure& object)     const;
+
+            bool                         operator<                (const IEqWithNativeLtStructure& object)     const;
+
+            bool                         operator<                (const IEqWithNativeLtStructureSPtr& object) const;
+};
+
+class IFunctionalEqWithFunctionalEqStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                                       IFunctionalEqWithFunctionalEqStructure ();
+    // Destructor
+    /*lax*/                                            ~IFunctionalEqWithFunctionalEqStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IFunctionalEqWithFunctionalEqStructureSPtr downcast                               (const FunctionalEqStructureSPtr& object);
+
+            bool                                       isEqual                                (const IFunctionalEqWithFunctionalEqStructure& object)     const;
+
+            bool                                       isEqual                                (const IFunctionalEqWithFunctionalEqStructureSPtr& object) const;
+};
+
+class IFunctionalEqWithFunctionalLtStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                                       IFunctionalEqWithFunctionalLtStructure ();
+    // Destructor
+    /*lax*/                                            ~IFunctionalEqWithFunctionalLtStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IFunctionalEqWithFunctionalLtStructureSPtr downcast                               (const FunctionalEqStructureSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                                        compare                                (const IFunctionalEqWithFunctionalLtStructure& object)     const;
+
+            bool                                       lessThan                               (const IFunctionalEqWithFunctionalLtStructure& object)     const;
+
+            bool                                       lessThan                               (const IFunctionalEqWithFunctionalLtStructureSPtr& object) const;
+};
+
+class IFunctionalEqWithFunctorEqStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                                    IFunctionalEqWithFunctorEqStructure ();
+    // Destructor
+    /*lax*/                                         ~IFunctionalEqWithFunctorEqStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IFunctionalEqWithFunctorEqStructureSPtr downcast                            (const FunctionalEqStructureSPtr& object);
+
+    struct isEqual {
+            bool                                    operator()                          (const IFunctionalEqWithFunctorEqStructure& object1,
+                                                                                         const IFunctionalEqWithFunctorEqStructure& object2)      const;
+
+            bool                                    operator()                          (const IFunctionalEqWithFunctorEqStructureSPtr& object1,
+                                                                                         const IFunctionalEqWithFunctorEqStructureSPtr& object2)  const;
+    };
+};
+
+class IFunctionalEqWithFunctorLtStructure : public FunctionalEqStructure
+{
+public:
+    // Default constructor
+                                                    IFunctionalEqWithFunctorLtStructure ();
+    // Destructor
+    /*lax*/                                         ~IFunctionalEqWithFunctorLtStructure();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IFunctionalEqWithFunctorLtStructureSPtr downcast                            (const FunctionalEqStructureSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                                     compare                             (const IFunctionalEqWithFunctorLtStructure& object)       const;
+
+    struct lessThan {
+            bool                                    operator()                          (const IFunctionalEqWithFunctorLtStructure& object1,
+                                                                                         const IFunctionalEqWithFunctorLtStructure& object2)      const;
+
+            bool                                    operator()                          (const IFunctionalEqWithFunctorLtStructureSPtr& object1,
+                                                                                         const IFunctionalEqWithFunctorLtStructureSPtr& object2)  const;
+    };
+};
+
+class CompareKey
+{
+public:
+    // Default constructor
+                 CompareKey ();
+    // Destructor
+    /*lax*/      ~CompareKey();
+
+            bool operator== (const CompareKey& object)                                     const;
+
+            bool operator== (const CompareKeySPtr& object)                                 const;
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int  compare    (const CompareKey& object)                                     const;
+
+            bool operator<  (const CompareKey& object)                                     const;
+
+            bool operator<  (const CompareKeySPtr& object)                                 const;
+
+    struct lessThan {
+            bool operator() (const CompareKey& object1, const CompareKey& object2)         const;
+
+            bool operator() (const CompareKeySPtr& object1, const CompareKeySPtr& object2) const;
+    };
+
+    // This enumeration class provides namespaced set of constant values.
+    class ESide
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             ESide     ( );
+        // Constructor from an integer value.
+                             ESide     ( long value);
+
+        // Returns the integer value of the enum.
+               long          value     ( )                              const;
+        // Returns short name for a specified enum value
+        static const char*   shortName ( long value);
+        // Returns short name of the enum value
+               const char*   shortName ( )                              const;
+        // Returns the enum value with a specified short name or invalid if
+        // none of the values has this name. The lookup is a perfect hash.
+        static ESide         fromString( const char* name, size_t size);
+        // Cast operator that casts the enum to its native type
+               operator long (         ) const;
+
+        // static methods for enum class objects
+        static const long invalid();
+        static const long buy    ();
+        static const long sell   ();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid = 0,
+            kBuy     = 1,
+            kSell    = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // Getter method for the data field venue
+    long         venue       ()                  const;
+    // Setter method for the data field venue
+    CompareKey&  set_venue   (long venue);
+
+    // Getter method for the data field side
+    const ESide& side        ()                  const;
+    // Setter method for the data field side
+    CompareKey&  set_side    (const ESide& side);
+    // Provides mutable access to field side
+    ESide&       mutable_side();
+
+    // Getter method for the data field price
+    long         price       ()                  const;
+    // Setter method for the data field price
+    CompareKey&  set_price   (long price);
+
+    // Getter method for the data field lot
+    long         lot         ()                  const;
+    // Setter method for the data field lot
+    CompareKey&  set_lot     (long lot);
+
+private:
+    // variable for the data field venue
+    long  mVenue;
+    // variable for the data field side
+    ESide mSide;
+    // variable for the data field price
+    long  mPrice;
+    // variable for the data field lot
+    long  mLot;
+};
+
+// CompareKeyColumns holds CompareKey objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class CompareKeyColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                          Row  (const CompareKeyColumns& columns, size_t index);
+
+        // Getter method for the data field venue
+                                 long                     venue()                                               const;
+
+        // Getter method for the data field side
+                                 const CompareKey::ESide& side ()                                               const;
+
+        // Getter method for the data field price
+                                 long                     price()                                               const;
+
+        // Getter method for the data field lot
+                                 long                     lot  ()                                               const;
+    private:
+        const CompareKeyColumns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                                          CompareKeyColumns ();
+    // Destructor
+                                          ~CompareKeyColumns();
+
+    // Returns the number of the rows
+    size_t                                size              ()                         const;
+    // Returns true if there are no rows
+    bool                                  empty             ()                         const;
+    // Reserves memory for size rows in every column
+    void                                  reserve           (size_t size);
+    // Removes all the rows
+    void                                  clear             ();
+
+    // Appends a row with the data fields of the object
+    void                                  push_back         (const CompareKey& object);
+
+    // Returns proxy of the row index
+    Row                                   operator[]        (size_t index)             const;
+
+    // Column of the data field venue
+    const std::vector<long>&              venue             ()                         const;
+
+    // Column of the data field side
+    const std::vector<CompareKey::ESide>& side              ()                         const;
+
+    // Column of the data field price
+    const std::vector<long>&              price             ()                         const;
+
+    // Column of the data field lot
+    const std::vector<long>&              lot               ()                         const;
+
+private:
+    // column of the data field venue
+    std::vector<long>              mVenue;
+    // column of the data field side
+    std::vector<CompareKey::ESide> mSide;
+    // column of the data field price
+    std::vector<long>              mPrice;
+    // column of the data field lot
+    std::vector<long>              mLot;
+};
+
+class CompareRecord
+{
+public:
+    // Default constructor
+                               CompareRecord ();
+    // Destructor
+    /*lax*/                    ~CompareRecord();
+
+            bool               operator==    (const CompareRecord& object)     const;
+
+            bool               operator==    (const CompareRecordSPtr& object) const;
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                compare       (const CompareRecord& object)     const;
+
+            bool               operator<     (const CompareRecord& object)     const;
+
+            bool               operator<     (const CompareRecordSPtr& object) const;
+
+            bool               lessThan      (const CompareRecord& object)     const;
+
+            bool               lessThan      (const CompareRecordSPtr& object) const;
+
+    // Getter method for the data field symbol
+            const std::string& symbol        ()                                const;
+    // Setter method for the data field symbol
+            CompareRecord&     set_symbol    (const std::string& symbol);
+    // Provides mutable access to field symbol
+            std::string&       mutable_symbol();
+
+    // Getter method for the data field key
+            const CompareKey&  key           ()                                const;
+    // Setter method for the data field key
+            CompareRecord&     set_key       (const CompareKey& key);
+    // Provides mutable access to field key
+            CompareKey&        mutable_key   ();
+
+    // Getter method for the data field quantity
+            long               quantity      ()                                const;
+    // Setter method for the data field quantity
+            CompareRecord&     set_quantity  (long quantity);
+
+private:
+    // variable for the data field symbol
+    std::string mSymbol;
+    // variable for the data field key
+    CompareKey  mKey;
+    // variable for the data field quantity
+    long        mQuantity;
+};
+
+// CompareRecordColumns holds CompareRecord objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class CompareRecordColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                       Row     (const CompareRecordColumns& columns, size_t index);
+
+        // Getter method for the data field symbol
+                                    const std::string& symbol  ()                                                  const;
+
+        // Getter method for the data field key
+                                    const CompareKey&  key     ()                                                  const;
+
+        // Getter method for the data field quantity
+                                    long               quantity()                                                  const;
+    private:
+        const CompareRecordColumns& mColumns;
+        size_t                      mIndex;
+    };
+
+    // Default constructor
+                                    CompareRecordColumns ();
+    // Destructor
+                                    ~CompareRecordColumns();
+
+    // Returns the number of the rows
+    size_t                          size                 ()                            const;
+    // Returns true if there are no rows
+    bool                            empty                ()                            const;
+    // Reserves memory for size rows in every column
+    void                            reserve              (size_t size);
+    // Removes all the rows
+    void                            clear                ();
+
+    // Appends a row with the data fields of the object
+    void                            push_back            (const CompareRecord& object);
+
+    // Returns proxy of the row index
+    Row                             operator[]           (size_t index)                const;
+
+    // Column of the data field symbol
+    const std::vector<std::string>& symbol               ()                            const;
+
+    // Column of the data field key
+    const std::vector<CompareKey>&  key                  ()                            const;
+
+    // Column of the data field quantity
+    const std::vector<long>&        quantity             ()                            const;
+
+private:
+    // column of the data field symbol
+    std::vector<std::string> mSymbol;
+    // column of the data field key
+    std::vector<CompareKey>  mKey;
+    // column of the data field quantity
+    std::vector<long>        mQuantity;
+};
+
+class ICompareRecord : public CompareRecord
+{
+public:
+    // Default constructor
+                               ICompareRecord ();
+    // Destructor
+    /*lax*/                    ~ICompareRecord();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  ICompareRecordSPtr downcast       (const CompareRecordSPtr& object);
+
+    // Three-way comparison of the fields. Returns a negative value, zero
+    // or a positive value if this object is less than, equal to or greater
+    // than the given one. The comparison operators of the structure are
+    // built on it.
+            int                compare        (const ICompareRecord& object)     const;
+
+            bool               operator<      (const ICompareRecord& object)     const;
+
+            bool               operator<      (const ICompareRecordSPtr& object) const;
+
+    // Getter method for the data field sequence
+            long               sequence       ()                                 const;
+    // Setter method for the data field sequence
+            ICompareRecord&    set_sequence   (long sequence);
+
+    // Setter method for the data field symbol
+            ICompareRecord&    set_symbol     (const std::string& symbol);
+
+    // Setter method for the data field key
+            ICompareRecord&    set_key        (const CompareKey& key);
+
+    // Setter method for the data field quantity
+            ICompareRecord&    set_quantity   (long quantity);
+
+private:
+    // variable for the data field sequence
+    long mSequence;
+};
+
+// ICompareRecordColumns holds ICompareRecord objects column by column -
+// one contiguous array per data field. Use it for large collections that
+// are scanned one or two fields at a time. Such scan touches only the
+// memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class ICompareRecordColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                        Row     (const ICompareRecordColumns& columns, size_t index);
+
+        // Getter method for the data field symbol
+                                     const std::string& symbol  ()                                                   const;
+
+        // Getter method for the data field key
+                                     const CompareKey&  key     ()                                                   const;
+
+        // Getter method for the data field quantity
+                                     long               quantity()                                                   const;
+
+        // Getter method for the data field sequence
+                                     long               sequence()                                                   const;
+    private:
+        const ICompareRecordColumns& mColumns;
+        size_t                       mIndex;
+    };
+
+    // Default constructor
+                                    ICompareRecordColumns ();
+    // Destructor
+                                    ~ICompareRecordColumns();
+
+    // Returns the number of the rows
+    size_t                          size                  ()                             const;
+    // Returns true if there are no rows
+    bool                            empty                 ()                             const;
+    // Reserves memory for size rows in every column
+    void                            reserve               (size_t size);
+    // Removes all the rows
+    void                            clear                 ();
+
+    // Appends a row with the data fields of the object
+    void                            push_back             (const ICompareRecord& object);
+
+    // Returns proxy of the row index
+    Row                             operator[]            (size_t index)                 const;
+
+    // Column of the data field symbol
+    const std::vector<std::string>& symbol                ()                             const;
+
+    // Column of the data field key
+    const std::vector<CompareKey>&  key                   ()                             const;
+
+    // Column of the data field quantity
+    const std::vector<long>&        quantity              ()                             const;
+
+    // Column of the data field sequence
+    const std::vector<long>&        sequence              ()                             const;
+
+private:
+    // column of the data field symbol
+    std::vector<std::string> mSymbol;
+    // column of the data field key
+    std::vector<CompareKey>  mKey;
+    // column of the data field quantity
+    std::vector<long>        mQuantity;
+    // column of the data field sequence
+    std::vector<long>        mSequence;
+};
+
+}
+
+#endif // __STRUCTURE_OPERATOR_COMPIL_H_
+
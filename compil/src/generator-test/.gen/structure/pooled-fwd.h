@@ -0,0 +1,45 @@
+#ifndef __STRUCTURE_POOLED_COMPIL__FWD_H_
+#define __STRUCTURE_POOLED_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace pooled
+{
+
+// Forward declarations
+class Order;
+typedef Order*                         OrderRPtr;
+typedef boost::shared_ptr<Order>       OrderSPtr;
+typedef boost::shared_ptr<const Order> OrderSCPtr;
+typedef boost::weak_ptr<Order>         OrderWPtr;
+
+class LimitOrder;
+typedef LimitOrder*                         LimitOrderRPtr;
+typedef boost::shared_ptr<LimitOrder>       LimitOrderSPtr;
+typedef boost::shared_ptr<const LimitOrder> LimitOrderSCPtr;
+typedef boost::weak_ptr<LimitOrder>         LimitOrderWPtr;
+
+class MarketOrder;
+typedef MarketOrder*                         MarketOrderRPtr;
+typedef boost::shared_ptr<MarketOrder>       MarketOrderSPtr;
+typedef boost::shared_ptr<const MarketOrder> MarketOrderSCPtr;
+typedef boost::weak_ptr<MarketOrder>         MarketOrderWPtr;
+
+class Quote;
+typedef Quote*                         QuoteRPtr;
+typedef boost::shared_ptr<Quote>       QuoteSPtr;
+typedef boost::shared_ptr<const Quote> QuoteSCPtr;
+typedef boost::weak_ptr<Quote>         QuoteWPtr;
+
+class PlainOrder;
+typedef PlainOrder*                         PlainOrderRPtr;
+typedef boost::shared_ptr<PlainOrder>       PlainOrderSPtr;
+typedef boost::shared_ptr<const PlainOrder> PlainOrderSCPtr;
+typedef boost::weak_ptr<PlainOrder>         PlainOrderWPtr;
+
+}
+
+#endif // __STRUCTURE_POOLED_COMPIL__FWD_H_
+
@@ -0,0 +1,832 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <string>
+
+#include "structure/pooled.h"
+// Compil C++ Template Library
+#include "core/compil/object_pool.h"
+// Standard C Library
+#include <stddef.h>
+
+namespace pooled
+{
+
+Order::Order()
+        : mBuy(default_buy())
+{
+}
+
+Order::~Order()
+{
+}
+
+long Order::id() const
+{
+    return mId;
+}
+
+Order& Order::set_id(long id)
+{
+    mId = id;
+    return *this;
+}
+
+Order& Order::operator<<(long id)
+{
+    return set_id(id);
+}
+
+const OrderSPtr& operator<<(const OrderSPtr& object, long id)
+{
+    BOOST_ASSERT(object);
+    *object << id;
+    return object;
+}
+
+bool Order::buy() const
+{
+    return mBuy;
+}
+
+bool Order::default_buy()
+{
+    return true;
+}
+
+Order& Order::set_buy(bool buy)
+{
+    mBuy = buy;
+    return *this;
+}
+
+Order& Order::operator<<(bool buy)
+{
+    return set_buy(buy);
+}
+
+const OrderSPtr& operator<<(const OrderSPtr& object, bool buy)
+{
+    BOOST_ASSERT(object);
+    *object << buy;
+    return object;
+}
+
+void* Order::operator new(size_t size)
+{
+    // the derived classes inherit the operator
+    if (size != sizeof(Order))
+        return ::operator new(size);
+    return object_pool<Order>::allocate();
+}
+
+void Order::operator delete(void* object, size_t size)
+{
+    if (size != sizeof(Order))
+        ::operator delete(object);
+    else
+        object_pool<Order>::deallocate(object);
+}
+
+size_t Order::poolThreads()
+{
+    return object_pool<Order>::threads();
+}
+
+size_t Order::poolBlocks()
+{
+    return object_pool<Order>::blocks();
+}
+
+size_t Order::poolAvailable()
+{
+    return object_pool<Order>::available();
+}
+
+size_t Order::poolUsed()
+{
+    return object_pool<Order>::used();
+}
+
+OrderColumns::Row::Row(const OrderColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long OrderColumns::Row::id() const
+{
+    return mColumns.id()[mIndex];
+}
+
+bool OrderColumns::Row::buy() const
+{
+    return mColumns.buy()[mIndex] != 0;
+}
+
+OrderColumns::OrderColumns()
+{
+}
+
+OrderColumns::~OrderColumns()
+{
+}
+
+size_t OrderColumns::size() const
+{
+    return mId.size();
+}
+
+bool OrderColumns::empty() const
+{
+    return mId.empty();
+}
+
+void OrderColumns::reserve(size_t size)
+{
+    mId.reserve(size);
+    mBuy.reserve(size);
+}
+
+void OrderColumns::clear()
+{
+    mId.clear();
+    mBuy.clear();
+}
+
+void OrderColumns::push_back(const Order& object)
+{
+    mId.push_back(object.id());
+    mBuy.push_back(object.buy());
+}
+
+OrderColumns::Row OrderColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& OrderColumns::id() const
+{
+    return mId;
+}
+
+const std::vector<unsigned char>& OrderColumns::buy() const
+{
+    return mBuy;
+}
+
+LimitOrder::LimitOrder()
+{
+}
+
+LimitOrder::~LimitOrder()
+{
+}
+
+LimitOrderSPtr LimitOrder::downcast(const OrderSPtr& object)
+{
+    return boost::static_pointer_cast<LimitOrder>(object);
+}
+
+const std::string& LimitOrder::account() const
+{
+    return mAccount;
+}
+
+LimitOrder& LimitOrder::set_account(const std::string& account)
+{
+    mAccount = account;
+    return *this;
+}
+
+std::string& LimitOrder::mutable_account()
+{
+    return mAccount;
+}
+
+LimitOrder& LimitOrder::operator<<(const std::string& account)
+{
+    return set_account(account);
+}
+
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& object, const std::string& account)
+{
+    BOOST_ASSERT(object);
+    *object << account;
+    return object;
+}
+
+LimitOrder& LimitOrder::set_id(long id)
+{
+    Order::set_id(id);
+    return *this;
+}
+
+LimitOrder& LimitOrder::operator<<(long id)
+{
+    *(Order*)this << id;
+    return *this;
+}
+
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& object, long id)
+{
+    BOOST_ASSERT(object);
+    *object << id;
+    return object;
+}
+
+LimitOrder& LimitOrder::set_buy(bool buy)
+{
+    Order::set_buy(buy);
+    return *this;
+}
+
+LimitOrder& LimitOrder::operator<<(bool buy)
+{
+    *(Order*)this << buy;
+    return *this;
+}
+
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& object, bool buy)
+{
+    BOOST_ASSERT(object);
+    *object << buy;
+    return object;
+}
+
+void* LimitOrder::operator new(size_t size)
+{
+    // the derived classes inherit the operator
+    if (size != sizeof(LimitOrder))
+        return ::operator new(size);
+    return object_pool<LimitOrder>::allocate();
+}
+
+void LimitOrder::operator delete(void* object, size_t size)
+{
+    if (size != sizeof(LimitOrder))
+        ::operator delete(object);
+    else
+        object_pool<LimitOrder>::deallocate(object);
+}
+
+size_t LimitOrder::poolThreads()
+{
+    return object_pool<LimitOrder>::threads();
+}
+
+size_t LimitOrder::poolBlocks()
+{
+    return object_pool<LimitOrder>::blocks();
+}
+
+size_t LimitOrder::poolAvailable()
+{
+    return object_pool<LimitOrder>::available();
+}
+
+size_t LimitOrder::poolUsed()
+{
+    return object_pool<LimitOrder>::used();
+}
+
+LimitOrderColumns::Row::Row(const LimitOrderColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long LimitOrderColumns::Row::id() const
+{
+    return mColumns.id()[mIndex];
+}
+
+bool LimitOrderColumns::Row::buy() const
+{
+    return mColumns.buy()[mIndex] != 0;
+}
+
+const std::string& LimitOrderColumns::Row::account() const
+{
+    return mColumns.account()[mIndex];
+}
+
+LimitOrderColumns::LimitOrderColumns()
+{
+}
+
+LimitOrderColumns::~LimitOrderColumns()
+{
+}
+
+size_t LimitOrderColumns::size() const
+{
+    return mId.size();
+}
+
+bool LimitOrderColumns::empty() const
+{
+    return mId.empty();
+}
+
+void LimitOrderColumns::reserve(size_t size)
+{
+    mId.reserve(size);
+    mBuy.reserve(size);
+    mAccount.reserve(size);
+}
+
+void LimitOrderColumns::clear()
+{
+    mId.clear();
+    mBuy.clear();
+    mAccount.clear();
+}
+
+void LimitOrderColumns::push_back(const LimitOrder& object)
+{
+    mId.push_back(object.id());
+    mBuy.push_back(object.buy());
+    mAccount.push_back(object.account());
+}
+
+LimitOrderColumns::Row LimitOrderColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& LimitOrderColumns::id() const
+{
+    return mId;
+}
+
+const std::vector<unsigned char>& LimitOrderColumns::buy() const
+{
+    return mBuy;
+}
+
+const std::vector<std::string>& LimitOrderColumns::account() const
+{
+    return mAccount;
+}
+
+MarketOrder::MarketOrder()
+{
+}
+
+MarketOrder::~MarketOrder()
+{
+}
+
+MarketOrderSPtr MarketOrder::downcast(const OrderSPtr& object)
+{
+    return boost::static_pointer_cast<MarketOrder>(object);
+}
+
+const std::string& MarketOrder::venue() const
+{
+    return mVenue;
+}
+
+MarketOrder& MarketOrder::set_venue(const std::string& venue)
+{
+    mVenue = venue;
+    return *this;
+}
+
+std::string& MarketOrder::mutable_venue()
+{
+    return mVenue;
+}
+
+MarketOrder& MarketOrder::operator<<(const std::string& venue)
+{
+    return set_venue(venue);
+}
+
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& object, const std::string& venue)
+{
+    BOOST_ASSERT(object);
+    *object << venue;
+    return object;
+}
+
+MarketOrder& MarketOrder::set_id(long id)
+{
+    Order::set_id(id);
+    return *this;
+}
+
+MarketOrder& MarketOrder::operator<<(long id)
+{
+    *(Order*)this << id;
+    return *this;
+}
+
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& object, long id)
+{
+    BOOST_ASSERT(object);
+    *object << id;
+    return object;
+}
+
+MarketOrder& MarketOrder::set_buy(bool buy)
+{
+    Order::set_buy(buy);
+    return *this;
+}
+
+MarketOrder& MarketOrder::operator<<(bool buy)
+{
+    *(Order*)this << buy;
+    return *this;
+}
+
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& object, bool buy)
+{
+    BOOST_ASSERT(object);
+    *object << buy;
+    return object;
+}
+
+MarketOrderColumns::Row::Row(const MarketOrderColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long MarketOrderColumns::Row::id() const
+{
+    return mColumns.id()[mIndex];
+}
+
+bool MarketOrderColumns::Row::buy() const
+{
+    return mColumns.buy()[mIndex] != 0;
+}
+
+const std::string& MarketOrderColumns::Row::venue() const
+{
+    return mColumns.venue()[mIndex];
+}
+
+MarketOrderColumns::MarketOrderColumns()
+{
+}
+
+MarketOrderColumns::~MarketOrderColumns()
+{
+}
+
+size_t MarketOrderColumns::size() const
+{
+    return mId.size();
+}
+
+bool MarketOrderColumns::empty() const
+{
+    return mId.empty();
+}
+
+void MarketOrderColumns::reserve(size_t size)
+{
+    mId.reserve(size);
+    mBuy.reserve(size);
+    mVenue.reserve(size);
+}
+
+void MarketOrderColumns::clear()
+{
+    mId.clear();
+    mBuy.clear();
+    mVenue.clear();
+}
+
+void MarketOrderColumns::push_back(const MarketOrder& object)
+{
+    mId.push_back(object.id());
+    mBuy.push_back(object.buy());
+    mVenue.push_back(object.venue());
+}
+
+MarketOrderColumns::Row MarketOrderColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& MarketOrderColumns::id() const
+{
+    return mId;
+}
+
+const std::vector<unsigned char>& MarketOrderColumns::buy() const
+{
+    return mBuy;
+}
+
+const std::vector<std::string>& MarketOrderColumns::venue() const
+{
+    return mVenue;
+}
+
+Quote::Builder::Builder()
+        : mpObject(new Quote())
+{
+}
+
+Quote::Builder::Builder(const Quote& object)
+        : mpObject(new Quote())
+{
+    *(Quote*)mpObject = object;
+}
+
+Quote::Builder::Builder(QuoteRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Quote::Builder::~Builder()
+{
+    delete (QuoteRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Quote& Quote::Builder::build() const
+{
+    return *(QuoteRPtr)mpObject;
+}
+
+QuoteSPtr Quote::Builder::finalize()
+{
+    QuoteRPtr objectRPtr = (QuoteRPtr)mpObject;
+    mpObject = NULL;
+    return QuoteSPtr(objectRPtr, boost::checked_deleter<Quote>(), object_pool_allocator<Quote>());
+}
+
+Quote::Quote()
+{
+}
+
+Quote::~Quote()
+{
+}
+
+long Quote::bid() const
+{
+    return mBid;
+}
+
+Quote::Builder& Quote::Builder::set_bid(long bid)
+{
+    mpObject->mBid = bid;
+    return *this;
+}
+
+long Quote::ask() const
+{
+    return mAsk;
+}
+
+Quote::Builder& Quote::Builder::set_ask(long ask)
+{
+    mpObject->mAsk = ask;
+    return *this;
+}
+
+void* Quote::operator new(size_t size)
+{
+    // the derived classes inherit the operator
+    if (size != sizeof(Quote))
+        return ::operator new(size);
+    return object_pool<Quote>::allocate();
+}
+
+void Quote::operator delete(void* object, size_t size)
+{
+    if (size != sizeof(Quote))
+        ::operator delete(object);
+    else
+        object_pool<Quote>::deallocate(object);
+}
+
+size_t Quote::poolThreads()
+{
+    return object_pool<Quote>::threads();
+}
+
+size_t Quote::poolBlocks()
+{
+    return object_pool<Quote>::blocks();
+}
+
+size_t Quote::poolAvailable()
+{
+    return object_pool<Quote>::available();
+}
+
+size_t Quote::poolUsed()
+{
+    return object_pool<Quote>::used();
+}
+
+QuoteColumns::Row::Row(const QuoteColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long QuoteColumns::Row::bid() const
+{
+    return mColumns.bid()[mIndex];
+}
+
+long QuoteColumns::Row::ask() const
+{
+    return mColumns.ask()[mIndex];
+}
+
+QuoteColumns::QuoteColumns()
+{
+}
+
+QuoteColumns::~QuoteColumns()
+{
+}
+
+size_t QuoteColumns::size() const
+{
+    return mBid.size();
+}
+
+bool QuoteColumns::empty() const
+{
+    return mBid.empty();
+}
+
+void QuoteColumns::reserve(size_t size)
+{
+    mBid.reserve(size);
+    mAsk.reserve(size);
+}
+
+void QuoteColumns::clear()
+{
+    mBid.clear();
+    mAsk.clear();
+}
+
+void QuoteColumns::push_back(const Quote& object)
+{
+    mBid.push_back(object.bid());
+    mAsk.push_back(object.ask());
+}
+
+void QuoteColumns::push_back(const Quote::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+QuoteColumns::Row QuoteColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& QuoteColumns::bid() const
+{
+    return mBid;
+}
+
+const std::vector<long>& QuoteColumns::ask() const
+{
+    return mAsk;
+}
+
+PlainOrder::PlainOrder()
+        : mBuy(default_buy())
+{
+}
+
+PlainOrder::~PlainOrder()
+{
+}
+
+long PlainOrder::id() const
+{
+    return mId;
+}
+
+PlainOrder& PlainOrder::set_id(long id)
+{
+    mId = id;
+    return *this;
+}
+
+PlainOrder& PlainOrder::operator<<(long id)
+{
+    return set_id(id);
+}
+
+const PlainOrderSPtr& operator<<(const PlainOrderSPtr& object, long id)
+{
+    BOOST_ASSERT(object);
+    *object << id;
+    return object;
+}
+
+bool PlainOrder::buy() const
+{
+    return mBuy;
+}
+
+bool PlainOrder::default_buy()
+{
+    return true;
+}
+
+PlainOrder& PlainOrder::set_buy(bool buy)
+{
+    mBuy = buy;
+    return *this;
+}
+
+PlainOrder& PlainOrder::operator<<(bool buy)
+{
+    return set_buy(buy);
+}
+
+const PlainOrderSPtr& operator<<(const PlainOrderSPtr& object, bool buy)
+{
+    BOOST_ASSERT(object);
+    *object << buy;
+    return object;
+}
+
+PlainOrderColumns::Row::Row(const PlainOrderColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long PlainOrderColumns::Row::id() const
+{
+    return mColumns.id()[mIndex];
+}
+
+bool PlainOrderColumns::Row::buy() const
+{
+    return mColumns.buy()[mIndex] != 0;
+}
+
+PlainOrderColumns::PlainOrderColumns()
+{
+}
+
+PlainOrderColumns::~PlainOrderColumns()
+{
+}
+
+size_t PlainOrderColumns::size() const
+{
+    return mId.size();
+}
+
+bool PlainOrderColumns::empty() const
+{
+    return mId.empty();
+}
+
+void PlainOrderColumns::reserve(size_t size)
+{
+    mId.reserve(size);
+    mBuy.reserve(size);
+}
+
+void PlainOrderColumns::clear()
+{
+    mId.clear();
+    mBuy.clear();
+}
+
+void PlainOrderColumns::push_back(const PlainOrder& object)
+{
+    mId.push_back(object.id());
+    mBuy.push_back(object.buy());
+}
+
+PlainOrderColumns::Row PlainOrderColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& PlainOrderColumns::id() const
+{
+    return mId;
+}
+
+const std::vector<unsigned char>& PlainOrderColumns::buy() const
+{
+    return mBuy;
+}
+
+}
+
@@ -0,0 +1,660 @@
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __STRUCTURE_POOLED_COMPIL_H_
+#define __STRUCTURE_POOLED_COMPIL_H_
+
+#include "structure/pooled-fwd.h"
+// Compil C++ Template Library
+#include "core/compil/object_pool.h"
+
+template<class T> class snapshot;
+
+namespace pooled
+{
+
+class Order
+{
+public:
+    // Default constructor
+                   Order          ();
+    // Destructor
+    /*lax*/        ~Order         ();
+
+    // Getter method for the data field id
+            long   id             ()                          const;
+    // Setter method for the data field id
+            Order& set_id         (long id);
+    // Store operator for the data field id
+            Order& operator<<     (long id);
+
+    // Getter method for the data field buy
+            bool   buy            ()                          const;
+    // Returns the default value true of the field buy
+    static  bool   default_buy    ();
+    // Setter method for the data field buy
+            Order& set_buy        (bool buy);
+    // Store operator for the data field buy
+            Order& operator<<     (bool buy);
+
+    // Allocates the instances from the per-thread free list pool of the
+    // class. The instances of the derived classes that have other size
+    // come from the heap.
+    static  void*  operator new   (size_t size);
+    // Returns the instance to the pool of the thread that allocated it
+    static  void   operator delete(void* object, size_t size);
+
+    // Returns the number of the running threads that allocated instances
+    static  size_t poolThreads    ();
+    // Returns the number of the pool blocks taken from the heap
+    static  size_t poolBlocks     ();
+    // Returns the number of the pool blocks that are free for reuse
+    static  size_t poolAvailable  ();
+    // Returns the number of the pool blocks that hold instances. It is
+    // approximate while other threads allocate or release instances.
+    static  size_t poolUsed       ();
+
+private:
+    // variable for the data field id
+    long mId;
+    // variable for the data field buy
+    bool mBuy;
+};
+
+// Reference store operator for the data field id
+const OrderSPtr& operator<<(const OrderSPtr& , long );
+// Reference store operator for the data field buy
+const OrderSPtr& operator<<(const OrderSPtr& , bool );
+
+// OrderColumns holds Order objects column by column - one contiguous array
+// per data field. Use it for large collections that are scanned one or two
+// fields at a time. Such scan touches only the memory of the columns it
+// reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class OrderColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                     Row(const OrderColumns& columns, size_t index);
+
+        // Getter method for the data field id
+                            long     id ()                                          const;
+
+        // Getter method for the data field buy
+                            bool     buy()                                          const;
+    private:
+        const OrderColumns& mColumns;
+        size_t              mIndex;
+    };
+
+    // Default constructor
+                                      OrderColumns ();
+    // Destructor
+                                      ~OrderColumns();
+
+    // Returns the number of the rows
+    size_t                            size         ()                    const;
+    // Returns true if there are no rows
+    bool                              empty        ()                    const;
+    // Reserves memory for size rows in every column
+    void                              reserve      (size_t size);
+    // Removes all the rows
+    void                              clear        ();
+
+    // Appends a row with the data fields of the object
+    void                              push_back    (const Order& object);
+
+    // Returns proxy of the row index
+    Row                               operator[]   (size_t index)        const;
+
+    // Column of the data field id
+    const std::vector<long>&          id           ()                    const;
+
+    // Column of the data field buy
+    const std::vector<unsigned char>& buy          ()                    const;
+
+private:
+    // column of the data field id
+    std::vector<long>          mId;
+    // column of the data field buy
+    std::vector<unsigned char> mBuy;
+};
+
+class LimitOrder : public Order
+{
+public:
+    // Default constructor
+                               LimitOrder     ();
+    // Destructor
+    /*lax*/                    ~LimitOrder    ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  LimitOrderSPtr     downcast       (const OrderSPtr& object);
+
+    // Getter method for the data field account
+            const std::string& account        ()                           const;
+    // Setter method for the data field account
+            LimitOrder&        set_account    (const std::string& account);
+    // Provides mutable access to field account
+            std::string&       mutable_account();
+    // Store operator for the data field account
+            LimitOrder&        operator<<     (const std::string& account);
+
+    // Setter method for the data field id
+            LimitOrder&        set_id         (long id);
+    // Store operator for the data field id
+            LimitOrder&        operator<<     (long id);
+
+    // Setter method for the data field buy
+            LimitOrder&        set_buy        (bool buy);
+    // Store operator for the data field buy
+            LimitOrder&        operator<<     (bool buy);
+
+    // Allocates the instances from the per-thread free list pool of the
+    // class. The instances of the derived classes that have other size
+    // come from the heap.
+    static  void*              operator new   (size_t size);
+    // Returns the instance to the pool of the thread that allocated it
+    static  void               operator delete(void* object, size_t size);
+
+    // Returns the number of the running threads that allocated instances
+    static  size_t             poolThreads    ();
+    // Returns the number of the pool blocks taken from the heap
+    static  size_t             poolBlocks     ();
+    // Returns the number of the pool blocks that are free for reuse
+    static  size_t             poolAvailable  ();
+    // Returns the number of the pool blocks that hold instances. It is
+    // approximate while other threads allocate or release instances.
+    static  size_t             poolUsed       ();
+
+private:
+    // variable for the data field account
+    std::string mAccount;
+};
+
+// Reference store operator for the data field id
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& , long );
+// Reference store operator for the data field buy
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& , bool );
+// Reference store operator for the data field account
+const LimitOrderSPtr& operator<<(const LimitOrderSPtr& , const std::string& );
+
+// LimitOrderColumns holds LimitOrder objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class LimitOrderColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                    Row    (const LimitOrderColumns& columns, size_t index);
+
+        // Getter method for the data field id
+                                 long               id     ()                                               const;
+
+        // Getter method for the data field buy
+                                 bool               buy    ()                                               const;
+
+        // Getter method for the data field account
+                                 const std::string& account()                                               const;
+    private:
+        const LimitOrderColumns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                                      LimitOrderColumns ();
+    // Destructor
+                                      ~LimitOrderColumns();
+
+    // Returns the number of the rows
+    size_t                            size              ()                         const;
+    // Returns true if there are no rows
+    bool                              empty             ()                         const;
+    // Reserves memory for size rows in every column
+    void                              reserve           (size_t size);
+    // Removes all the rows
+    void                              clear             ();
+
+    // Appends a row with the data fields of the object
+    void                              push_back         (const LimitOrder& object);
+
+    // Returns proxy of the row index
+    Row                               operator[]        (size_t index)             const;
+
+    // Column of the data field id
+    const std::vector<long>&          id                ()                         const;
+
+    // Column of the data field buy
+    const std::vector<unsigned char>& buy               ()                         const;
+
+    // Column of the data field account
+    const std::vector<std::string>&   account           ()                         const;
+
+private:
+    // column of the data field id
+    std::vector<long>          mId;
+    // column of the data field buy
+    std::vector<unsigned char> mBuy;
+    // column of the data field account
+    std::vector<std::string>   mAccount;
+};
+
+class MarketOrder : public Order
+{
+public:
+    // Default constructor
+                               MarketOrder  ();
+    // Destructor
+    /*lax*/                    ~MarketOrder ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  MarketOrderSPtr    downcast     (const OrderSPtr& object);
+
+    // Getter method for the data field venue
+            const std::string& venue        ()                         const;
+    // Setter method for the data field venue
+            MarketOrder&       set_venue    (const std::string& venue);
+    // Provides mutable access to field venue
+            std::string&       mutable_venue();
+    // Store operator for the data field venue
+            MarketOrder&       operator<<   (const std::string& venue);
+
+    // Setter method for the data field id
+            MarketOrder&       set_id       (long id);
+    // Store operator for the data field id
+            MarketOrder&       operator<<   (long id);
+
+    // Setter method for the data field buy
+            MarketOrder&       set_buy      (bool buy);
+    // Store operator for the data field buy
+            MarketOrder&       operator<<   (bool buy);
+
+private:
+    // variable for the data field venue
+    std::string mVenue;
+};
+
+// Reference store operator for the data field id
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& , long );
+// Reference store operator for the data field buy
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& , bool );
+// Reference store operator for the data field venue
+const MarketOrderSPtr& operator<<(const MarketOrderSPtr& , const std::string& );
+
+// MarketOrderColumns holds MarketOrder objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class MarketOrderColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                     Row  (const MarketOrderColumns& columns, size_t index);
+
+        // Getter method for the data field id
+                                  long               id   ()                                                const;
+
+        // Getter method for the data field buy
+                                  bool               buy  ()                                                const;
+
+        // Getter method for the data field venue
+                                  const std::string& venue()                                                const;
+    private:
+        const MarketOrderColumns& mColumns;
+        size_t                    mIndex;
+    };
+
+    // Default constructor
+                                      MarketOrderColumns ();
+    // Destructor
+                                      ~MarketOrderColumns();
+
+    // Returns the number of the rows
+    size_t                            size               ()                          const;
+    // Returns true if there are no rows
+    bool                              empty              ()                          const;
+    // Reserves memory for size rows in every column
+    void                              reserve            (size_t size);
+    // Removes all the rows
+    void                              clear              ();
+
+    // Appends a row with the data fields of the object
+    void                              push_back          (const MarketOrder& object);
+
+    // Returns proxy of the row index
+    Row                               operator[]         (size_t index)              const;
+
+    // Column of the data field id
+    const std::vector<long>&          id                 ()                          const;
+
+    // Column of the data field buy
+    const std::vector<unsigned char>& buy                ()                          const;
+
+    // Column of the data field venue
+    const std::vector<std::string>&   venue              ()                          const;
+
+private:
+    // column of the data field id
+    std::vector<long>          mId;
+    // column of the data field buy
+    std::vector<unsigned char> mBuy;
+    // column of the data field venue
+    std::vector<std::string>   mVenue;
+};
+
+// Quote is an immutable class - once instantiated none of the data fields
+// can be changed. For the initial initialization and instantiation use the
+// nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Quote
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void         operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                             Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                             Builder  (const Quote& object);
+        // Destructor of Builder
+        /*lax*/              ~Builder ();
+
+        // Instantiates Quote instance with the current initialization of
+        // the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Quote& build    ()                    const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                QuoteSPtr    finalize ();
+
+
+        // Setter method for the data field bid
+                Builder&     set_bid  (long bid);
+
+        // Setter method for the data field ask
+                Builder&     set_ask  (long ask);
+
+    protected:
+        // constructor needed from potential derived classes
+                             Builder  (QuoteRPtr pObject);
+
+        QuoteRPtr mpObject;
+    };
+
+    // Default constructor
+                   Quote          ();
+    // Destructor
+    /*lax*/        ~Quote         ();
+
+    // Getter method for the data field bid
+            long   bid            ()                          const;
+
+    // Getter method for the data field ask
+            long   ask            ()                          const;
+
+    // Allocates the instances from the per-thread free list pool of the
+    // class. The instances of the derived classes that have other size
+    // come from the heap.
+    static  void*  operator new   (size_t size);
+    // Returns the instance to the pool of the thread that allocated it
+    static  void   operator delete(void* object, size_t size);
+
+    // Returns the number of the running threads that allocated instances
+    static  size_t poolThreads    ();
+    // Returns the number of the pool blocks taken from the heap
+    static  size_t poolBlocks     ();
+    // Returns the number of the pool blocks that are free for reuse
+    static  size_t poolAvailable  ();
+    // Returns the number of the pool blocks that hold instances. It is
+    // approximate while other threads allocate or release instances.
+    static  size_t poolUsed       ();
+
+private:
+    // variable for the data field bid
+    long mBid;
+    // variable for the data field ask
+    long mAsk;
+};
+
+// Holder of the current Quote shared between threads. The readers get the
+// current object wait-free through a view, the writers publish the results
+// of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Quote> QuoteSnapshot;
+
+// QuoteColumns holds Quote objects column by column - one contiguous array
+// per data field. Use it for large collections that are scanned one or two
+// fields at a time. Such scan touches only the memory of the columns it
+// reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class QuoteColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                     Row(const QuoteColumns& columns, size_t index);
+
+        // Getter method for the data field bid
+                            long     bid()                                          const;
+
+        // Getter method for the data field ask
+                            long     ask()                                          const;
+    private:
+        const QuoteColumns& mColumns;
+        size_t              mIndex;
+    };
+
+    // Default constructor
+                             QuoteColumns ();
+    // Destructor
+                             ~QuoteColumns();
+
+    // Returns the number of the rows
+    size_t                   size         ()                              const;
+    // Returns true if there are no rows
+    bool                     empty        ()                              const;
+    // Reserves memory for size rows in every column
+    void                     reserve      (size_t size);
+    // Removes all the rows
+    void                     clear        ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back    (const Quote& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                     push_back    (const Quote::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                      operator[]   (size_t index)                  const;
+
+    // Column of the data field bid
+    const std::vector<long>& bid          ()                              const;
+
+    // Column of the data field ask
+    const std::vector<long>& ask          ()                              const;
+
+private:
+    // column of the data field bid
+    std::vector<long> mBid;
+    // column of the data field ask
+    std::vector<long> mAsk;
+};
+
+class PlainOrder
+{
+public:
+    // Default constructor
+                        PlainOrder ();
+    // Destructor
+    /*lax*/             ~PlainOrder();
+
+    // Getter method for the data field id
+            long        id         ()         const;
+    // Setter method for the data field id
+            PlainOrder& set_id     (long id);
+    // Store operator for the data field id
+            PlainOrder& operator<< (long id);
+
+    // Getter method for the data field buy
+            bool        buy        ()         const;
+    // Returns the default value true of the field buy
+    static  bool        default_buy();
+    // Setter method for the data field buy
+            PlainOrder& set_buy    (bool buy);
+    // Store operator for the data field buy
+            PlainOrder& operator<< (bool buy);
+
+private:
+    // variable for the data field id
+    long mId;
+    // variable for the data field buy
+    bool mBuy;
+};
+
+// Reference store operator for the data field id
+const PlainOrderSPtr& operator<<(const PlainOrderSPtr& , long );
+// Reference store operator for the data field buy
+const PlainOrderSPtr& operator<<(const PlainOrderSPtr& , bool );
+
+// PlainOrderColumns holds PlainOrder objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class PlainOrderColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                          Row(const PlainOrderColumns& columns, size_t index);
+
+        // Getter method for the data field id
+                                 long     id ()                                               const;
+
+        // Getter method for the data field buy
+                                 bool     buy()                                               const;
+    private:
+        const PlainOrderColumns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                                      PlainOrderColumns ();
+    // Destructor
+                                      ~PlainOrderColumns();
+
+    // Returns the number of the rows
+    size_t                            size              ()                         const;
+    // Returns true if there are no rows
+    bool                              empty             ()                         const;
+    // Reserves memory for size rows in every column
+    void                              reserve           (size_t size);
+    // Removes all the rows
+    void                              clear             ();
+
+    // Appends a row with the data fields of the object
+    void                              push_back         (const PlainOrder& object);
+
+    // Returns proxy of the row index
+    Row                               operator[]        (size_t index)             const;
+
+    // Column of the data field id
+    const std::vector<long>&          id                ()                         const;
+
+    // Column of the data field buy
+    const std::vector<unsigned char>& buy               ()                         const;
+
+private:
+    // column of the data field id
+    std::vector<long>          mId;
+    // column of the data field buy
+    std::vector<unsigned char> mBuy;
+};
+
+inline OrderSPtr orderRef()
+{
+    return OrderSPtr(new Order(), boost::checked_deleter<Order>(), object_pool_allocator<Order>());
+}
+
+inline LimitOrderSPtr limitOrderRef()
+{
+    return LimitOrderSPtr(new LimitOrder(), boost::checked_deleter<LimitOrder>(), object_pool_allocator<LimitOrder>());
+}
+
+inline MarketOrderSPtr marketOrderRef()
+{
+    return boost::make_shared<MarketOrder>();
+}
+
+inline PlainOrderSPtr plainOrderRef()
+{
+    return boost::make_shared<PlainOrder>();
+}
+
+}
+
+#endif // __STRUCTURE_POOLED_COMPIL_H_
+
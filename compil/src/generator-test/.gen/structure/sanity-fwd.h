@@ -0,0 +1,143 @@
+#ifndef __STRUCTURE_SANITY_COMPIL__FWD_H_
+#define __STRUCTURE_SANITY_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace sanity
+{
+
+// Forward declarations
+class StructureIsInitialize;
+typedef StructureIsInitialize*                         StructureIsInitializeRPtr;
+typedef boost::shared_ptr<StructureIsInitialize>       StructureIsInitializeSPtr;
+typedef boost::shared_ptr<const StructureIsInitialize> StructureIsInitializeSCPtr;
+typedef boost::weak_ptr<StructureIsInitialize>         StructureIsInitializeWPtr;
+
+class StructureIsInitialize1;
+typedef StructureIsInitialize1*                         StructureIsInitialize1RPtr;
+typedef boost::shared_ptr<StructureIsInitialize1>       StructureIsInitialize1SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize1> StructureIsInitialize1SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize1>         StructureIsInitialize1WPtr;
+
+class StructureIsInitialize2;
+typedef StructureIsInitialize2*                         StructureIsInitialize2RPtr;
+typedef boost::shared_ptr<StructureIsInitialize2>       StructureIsInitialize2SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize2> StructureIsInitialize2SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize2>         StructureIsInitialize2WPtr;
+
+class StructureNonControlledInherit;
+typedef StructureNonControlledInherit*                         StructureNonControlledInheritRPtr;
+typedef boost::shared_ptr<StructureNonControlledInherit>       StructureNonControlledInheritSPtr;
+typedef boost::shared_ptr<const StructureNonControlledInherit> StructureNonControlledInheritSCPtr;
+typedef boost::weak_ptr<StructureNonControlledInherit>         StructureNonControlledInheritWPtr;
+
+class StructureIsInitialize3;
+typedef StructureIsInitialize3*                         StructureIsInitialize3RPtr;
+typedef boost::shared_ptr<StructureIsInitialize3>       StructureIsInitialize3SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize3> StructureIsInitialize3SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize3>         StructureIsInitialize3WPtr;
+
+class StructureNonControlled;
+typedef StructureNonControlled*                         StructureNonControlledRPtr;
+typedef boost::shared_ptr<StructureNonControlled>       StructureNonControlledSPtr;
+typedef boost::shared_ptr<const StructureNonControlled> StructureNonControlledSCPtr;
+typedef boost::weak_ptr<StructureNonControlled>         StructureNonControlledWPtr;
+
+class StructureIsInitialize4;
+typedef StructureIsInitialize4*                         StructureIsInitialize4RPtr;
+typedef boost::shared_ptr<StructureIsInitialize4>       StructureIsInitialize4SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize4> StructureIsInitialize4SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize4>         StructureIsInitialize4WPtr;
+
+class StructureIsInitializeVirtual;
+typedef StructureIsInitializeVirtual*                         StructureIsInitializeVirtualRPtr;
+typedef boost::shared_ptr<StructureIsInitializeVirtual>       StructureIsInitializeVirtualSPtr;
+typedef boost::shared_ptr<const StructureIsInitializeVirtual> StructureIsInitializeVirtualSCPtr;
+typedef boost::weak_ptr<StructureIsInitializeVirtual>         StructureIsInitializeVirtualWPtr;
+
+class EStructureIsInitializeVirtualId;
+
+class StructureNonControlledVirtualInherit;
+typedef StructureNonControlledVirtualInherit*                         StructureNonControlledVirtualInheritRPtr;
+typedef boost::shared_ptr<StructureNonControlledVirtualInherit>       StructureNonControlledVirtualInheritSPtr;
+typedef boost::shared_ptr<const StructureNonControlledVirtualInherit> StructureNonControlledVirtualInheritSCPtr;
+typedef boost::weak_ptr<StructureNonControlledVirtualInherit>         StructureNonControlledVirtualInheritWPtr;
+
+class StructureIsInitialize5;
+typedef StructureIsInitialize5*                         StructureIsInitialize5RPtr;
+typedef boost::shared_ptr<StructureIsInitialize5>       StructureIsInitialize5SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize5> StructureIsInitialize5SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize5>         StructureIsInitialize5WPtr;
+
+class StructureNonControlledVirtual;
+typedef StructureNonControlledVirtual*                         StructureNonControlledVirtualRPtr;
+typedef boost::shared_ptr<StructureNonControlledVirtual>       StructureNonControlledVirtualSPtr;
+typedef boost::shared_ptr<const StructureNonControlledVirtual> StructureNonControlledVirtualSCPtr;
+typedef boost::weak_ptr<StructureNonControlledVirtual>         StructureNonControlledVirtualWPtr;
+
+class EStructureNonControlledVirtualId;
+
+class StructureIsInitialize6;
+typedef StructureIsInitialize6*                         StructureIsInitialize6RPtr;
+typedef boost::shared_ptr<StructureIsInitialize6>       StructureIsInitialize6SPtr;
+typedef boost::shared_ptr<const StructureIsInitialize6> StructureIsInitialize6SCPtr;
+typedef boost::weak_ptr<StructureIsInitialize6>         StructureIsInitialize6WPtr;
+
+class StructureIsVoid;
+typedef StructureIsVoid*                         StructureIsVoidRPtr;
+typedef boost::shared_ptr<StructureIsVoid>       StructureIsVoidSPtr;
+typedef boost::shared_ptr<const StructureIsVoid> StructureIsVoidSCPtr;
+typedef boost::weak_ptr<StructureIsVoid>         StructureIsVoidWPtr;
+
+class StructureIsVoid1;
+typedef StructureIsVoid1*                         StructureIsVoid1RPtr;
+typedef boost::shared_ptr<StructureIsVoid1>       StructureIsVoid1SPtr;
+typedef boost::shared_ptr<const StructureIsVoid1> StructureIsVoid1SCPtr;
+typedef boost::weak_ptr<StructureIsVoid1>         StructureIsVoid1WPtr;
+
+class StructureIsInitializeVirtualFactory;
+typedef StructureIsInitializeVirtualFactory*                         StructureIsInitializeVirtualFactoryRPtr;
+typedef boost::shared_ptr<StructureIsInitializeVirtualFactory>       StructureIsInitializeVirtualFactorySPtr;
+typedef boost::shared_ptr<const StructureIsInitializeVirtualFactory> StructureIsInitializeVirtualFactorySCPtr;
+typedef boost::weak_ptr<StructureIsInitializeVirtualFactory>         StructureIsInitializeVirtualFactoryWPtr;
+
+typedef EStructureIsInitializeVirtualId*                         EStructureIsInitializeVirtualIdRPtr;
+typedef boost::shared_ptr<EStructureIsInitializeVirtualId>       EStructureIsInitializeVirtualIdSPtr;
+typedef boost::shared_ptr<const EStructureIsInitializeVirtualId> EStructureIsInitializeVirtualIdSCPtr;
+typedef boost::weak_ptr<EStructureIsInitializeVirtualId>         EStructureIsInitializeVirtualIdWPtr;
+
+class StructureNonControlledVirtualFactory;
+typedef StructureNonControlledVirtualFactory*                         StructureNonControlledVirtualFactoryRPtr;
+typedef boost::shared_ptr<StructureNonControlledVirtualFactory>       StructureNonControlledVirtualFactorySPtr;
+typedef boost::shared_ptr<const StructureNonControlledVirtualFactory> StructureNonControlledVirtualFactorySCPtr;
+typedef boost::weak_ptr<StructureNonControlledVirtualFactory>         StructureNonControlledVirtualFactoryWPtr;
+
+typedef EStructureNonControlledVirtualId*                         EStructureNonControlledVirtualIdRPtr;
+typedef boost::shared_ptr<EStructureNonControlledVirtualId>       EStructureNonControlledVirtualIdSPtr;
+typedef boost::shared_ptr<const EStructureNonControlledVirtualId> EStructureNonControlledVirtualIdSCPtr;
+typedef boost::weak_ptr<EStructureNonControlledVirtualId>         EStructureNonControlledVirtualIdWPtr;
+
+class StructureBase;
+typedef StructureBase*                         StructureBaseRPtr;
+typedef boost::shared_ptr<StructureBase>       StructureBaseSPtr;
+typedef boost::shared_ptr<const StructureBase> StructureBaseSCPtr;
+typedef boost::weak_ptr<StructureBase>         StructureBaseWPtr;
+
+class StructureAbstract;
+typedef StructureAbstract*                         StructureAbstractRPtr;
+typedef boost::shared_ptr<StructureAbstract>       StructureAbstractSPtr;
+typedef boost::shared_ptr<const StructureAbstract> StructureAbstractSCPtr;
+typedef boost::weak_ptr<StructureAbstract>         StructureAbstractWPtr;
+
+class StructureLeaf;
+typedef StructureLeaf*                         StructureLeafRPtr;
+typedef boost::shared_ptr<StructureLeaf>       StructureLeafSPtr;
+typedef boost::shared_ptr<const StructureLeaf> StructureLeafSCPtr;
+typedef boost::weak_ptr<StructureLeaf>         StructureLeafWPtr;
+
+}
+
+#endif // __STRUCTURE_SANITY_COMPIL__FWD_H_
+
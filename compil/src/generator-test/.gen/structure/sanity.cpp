@@ -0,0 +1,2540 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "structure/sanity.h"
+// Compil C++ Template Library
+#include "core/compil/object_slab.h"
+// Standard C Library
+#include <stddef.h>
+#include <string.h>
+
+namespace sanity
+{
+
+int StructureIsInitialize::bitmask_r()
+{
+    return 0x1;
+}
+
+int StructureIsInitialize::bitmask_o()
+{
+    return 0x2;
+}
+
+int StructureIsInitialize::bitmask_d()
+{
+    return 0x4;
+}
+
+StructureIsInitialize::StructureIsInitialize()
+        : mBits(0)
+        , mD   (default_d())
+{
+}
+
+StructureIsInitialize::~StructureIsInitialize()
+{
+}
+
+bool StructureIsInitialize::isInitialized() const
+{
+    if (!valid_r()) return false;
+    return true;
+}
+
+long StructureIsInitialize::r() const
+{
+    BOOST_ASSERT(valid_r());
+    return mR;
+}
+
+bool StructureIsInitialize::valid_r() const
+{
+    return (mBits & bitmask_r()) != 0;
+}
+
+StructureIsInitialize& StructureIsInitialize::set_r(long r)
+{
+    mR     = r;
+    mBits |= bitmask_r();
+    return *this;
+}
+
+void StructureIsInitialize::erase_r()
+{
+    mR     =  0;
+    mBits &= ~bitmask_r();
+}
+
+long StructureIsInitialize::o() const
+{
+    BOOST_ASSERT(exist_o());
+    return mO;
+}
+
+bool StructureIsInitialize::exist_o() const
+{
+    return (mBits & bitmask_o()) != 0;
+}
+
+StructureIsInitialize& StructureIsInitialize::set_o(long o)
+{
+    mO     = o;
+    mBits |= bitmask_o();
+    return *this;
+}
+
+void StructureIsInitialize::clear_o()
+{
+    mO     =  0;
+    mBits &= ~bitmask_o();
+}
+
+long StructureIsInitialize::d() const
+{
+    return mD;
+}
+
+bool StructureIsInitialize::changed_d() const
+{
+    return (mBits & bitmask_d()) != 0;
+}
+
+long StructureIsInitialize::default_d()
+{
+    return 1;
+}
+
+StructureIsInitialize& StructureIsInitialize::set_d(long d)
+{
+    mD     = d;
+    mBits |= bitmask_d();
+    return *this;
+}
+
+StructureIsInitialize& StructureIsInitialize::update_d(long d)
+{
+    if (default_d() != d)
+        return set_d(d);
+
+    reset_d();
+    return *this;
+}
+
+void StructureIsInitialize::reset_d()
+{
+    mD     =  default_d();
+    mBits &= ~bitmask_d();
+}
+
+StructureIsInitializeColumns::Row::Row(const StructureIsInitializeColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureIsInitializeColumns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+bool StructureIsInitializeColumns::Row::valid_r() const
+{
+    return mColumns.valid_r()[mIndex];
+}
+
+long StructureIsInitializeColumns::Row::o() const
+{
+    return mColumns.o()[mIndex];
+}
+
+bool StructureIsInitializeColumns::Row::exist_o() const
+{
+    return mColumns.exist_o()[mIndex];
+}
+
+long StructureIsInitializeColumns::Row::d() const
+{
+    return mColumns.d()[mIndex];
+}
+
+StructureIsInitializeColumns::StructureIsInitializeColumns()
+{
+}
+
+StructureIsInitializeColumns::~StructureIsInitializeColumns()
+{
+}
+
+size_t StructureIsInitializeColumns::size() const
+{
+    return mR.size();
+}
+
+bool StructureIsInitializeColumns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureIsInitializeColumns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mRAvailability.reserve(size);
+    mO.reserve(size);
+    mOAvailability.reserve(size);
+    mD.reserve(size);
+}
+
+void StructureIsInitializeColumns::clear()
+{
+    mR.clear();
+    mRAvailability.clear();
+    mO.clear();
+    mOAvailability.clear();
+    mD.clear();
+}
+
+void StructureIsInitializeColumns::push_back(const StructureIsInitialize& object)
+{
+    mRAvailability.push_back(object.valid_r());
+    if (mRAvailability.back())
+        mR.push_back(object.r());
+    else
+        mR.resize(mR.size() + 1);
+    mOAvailability.push_back(object.exist_o());
+    if (mOAvailability.back())
+        mO.push_back(object.o());
+    else
+        mO.resize(mO.size() + 1);
+    mD.push_back(object.d());
+}
+
+StructureIsInitializeColumns::Row StructureIsInitializeColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureIsInitializeColumns::r() const
+{
+    return mR;
+}
+
+const std::vector<bool>& StructureIsInitializeColumns::valid_r() const
+{
+    return mRAvailability;
+}
+
+const std::vector<long>& StructureIsInitializeColumns::o() const
+{
+    return mO;
+}
+
+const std::vector<bool>& StructureIsInitializeColumns::exist_o() const
+{
+    return mOAvailability;
+}
+
+const std::vector<long>& StructureIsInitializeColumns::d() const
+{
+    return mD;
+}
+
+StructureIsInitialize1::StructureIsInitialize1()
+{
+    set_r(alter_r());
+}
+
+StructureIsInitialize1::~StructureIsInitialize1()
+{
+}
+
+StructureIsInitialize1SPtr StructureIsInitialize1::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize1>(object);
+}
+
+long StructureIsInitialize1::alter_r()
+{
+    return 5;
+}
+
+StructureIsInitialize1& StructureIsInitialize1::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize1& StructureIsInitialize1::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureIsInitialize1& StructureIsInitialize1::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureIsInitialize1Columns::Row::Row(const StructureIsInitialize1Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureIsInitialize1Columns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+bool StructureIsInitialize1Columns::Row::valid_r() const
+{
+    return mColumns.valid_r()[mIndex];
+}
+
+long StructureIsInitialize1Columns::Row::o() const
+{
+    return mColumns.o()[mIndex];
+}
+
+bool StructureIsInitialize1Columns::Row::exist_o() const
+{
+    return mColumns.exist_o()[mIndex];
+}
+
+long StructureIsInitialize1Columns::Row::d() const
+{
+    return mColumns.d()[mIndex];
+}
+
+StructureIsInitialize1Columns::StructureIsInitialize1Columns()
+{
+}
+
+StructureIsInitialize1Columns::~StructureIsInitialize1Columns()
+{
+}
+
+size_t StructureIsInitialize1Columns::size() const
+{
+    return mR.size();
+}
+
+bool StructureIsInitialize1Columns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureIsInitialize1Columns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mRAvailability.reserve(size);
+    mO.reserve(size);
+    mOAvailability.reserve(size);
+    mD.reserve(size);
+}
+
+void StructureIsInitialize1Columns::clear()
+{
+    mR.clear();
+    mRAvailability.clear();
+    mO.clear();
+    mOAvailability.clear();
+    mD.clear();
+}
+
+void StructureIsInitialize1Columns::push_back(const StructureIsInitialize1& object)
+{
+    mRAvailability.push_back(object.valid_r());
+    if (mRAvailability.back())
+        mR.push_back(object.r());
+    else
+        mR.resize(mR.size() + 1);
+    mOAvailability.push_back(object.exist_o());
+    if (mOAvailability.back())
+        mO.push_back(object.o());
+    else
+        mO.resize(mO.size() + 1);
+    mD.push_back(object.d());
+}
+
+StructureIsInitialize1Columns::Row StructureIsInitialize1Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureIsInitialize1Columns::r() const
+{
+    return mR;
+}
+
+const std::vector<bool>& StructureIsInitialize1Columns::valid_r() const
+{
+    return mRAvailability;
+}
+
+const std::vector<long>& StructureIsInitialize1Columns::o() const
+{
+    return mO;
+}
+
+const std::vector<bool>& StructureIsInitialize1Columns::exist_o() const
+{
+    return mOAvailability;
+}
+
+const std::vector<long>& StructureIsInitialize1Columns::d() const
+{
+    return mD;
+}
+
+int StructureIsInitialize2::bitmask_r2()
+{
+    return 0x1;
+}
+
+StructureIsInitialize2::StructureIsInitialize2()
+        : mBits(0)
+{
+}
+
+StructureIsInitialize2::~StructureIsInitialize2()
+{
+}
+
+StructureIsInitialize2SPtr StructureIsInitialize2::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize2>(object);
+}
+
+bool StructureIsInitialize2::isInitialized() const
+{
+    if (!StructureIsInitialize::isInitialized()) return false;
+    if (!valid_r2()) return false;
+    return true;
+}
+
+long StructureIsInitialize2::r2() const
+{
+    BOOST_ASSERT(valid_r2());
+    return mR2;
+}
+
+bool StructureIsInitialize2::valid_r2() const
+{
+    return (mBits & bitmask_r2()) != 0;
+}
+
+StructureIsInitialize2& StructureIsInitialize2::set_r2(long r2)
+{
+    mR2    = r2;
+    mBits |= bitmask_r2();
+    return *this;
+}
+
+void StructureIsInitialize2::erase_r2()
+{
+    mR2    =  0;
+    mBits &= ~bitmask_r2();
+}
+
+StructureIsInitialize2& StructureIsInitialize2::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize2& StructureIsInitialize2::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureIsInitialize2& StructureIsInitialize2::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureIsInitialize2Columns::Row::Row(const StructureIsInitialize2Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureIsInitialize2Columns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+bool StructureIsInitialize2Columns::Row::valid_r() const
+{
+    return mColumns.valid_r()[mIndex];
+}
+
+long StructureIsInitialize2Columns::Row::o() const
+{
+    return mColumns.o()[mIndex];
+}
+
+bool StructureIsInitialize2Columns::Row::exist_o() const
+{
+    return mColumns.exist_o()[mIndex];
+}
+
+long StructureIsInitialize2Columns::Row::d() const
+{
+    return mColumns.d()[mIndex];
+}
+
+long StructureIsInitialize2Columns::Row::r2() const
+{
+    return mColumns.r2()[mIndex];
+}
+
+bool StructureIsInitialize2Columns::Row::valid_r2() const
+{
+    return mColumns.valid_r2()[mIndex];
+}
+
+StructureIsInitialize2Columns::StructureIsInitialize2Columns()
+{
+}
+
+StructureIsInitialize2Columns::~StructureIsInitialize2Columns()
+{
+}
+
+size_t StructureIsInitialize2Columns::size() const
+{
+    return mR.size();
+}
+
+bool StructureIsInitialize2Columns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureIsInitialize2Columns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mRAvailability.reserve(size);
+    mO.reserve(size);
+    mOAvailability.reserve(size);
+    mD.reserve(size);
+    mR2.reserve(size);
+    mR2Availability.reserve(size);
+}
+
+void StructureIsInitialize2Columns::clear()
+{
+    mR.clear();
+    mRAvailability.clear();
+    mO.clear();
+    mOAvailability.clear();
+    mD.clear();
+    mR2.clear();
+    mR2Availability.clear();
+}
+
+void StructureIsInitialize2Columns::push_back(const StructureIsInitialize2& object)
+{
+    mRAvailability.push_back(object.valid_r());
+    if (mRAvailability.back())
+        mR.push_back(object.r());
+    else
+        mR.resize(mR.size() + 1);
+    mOAvailability.push_back(object.exist_o());
+    if (mOAvailability.back())
+        mO.push_back(object.o());
+    else
+        mO.resize(mO.size() + 1);
+    mD.push_back(object.d());
+    mR2Availability.push_back(object.valid_r2());
+    if (mR2Availability.back())
+        mR2.push_back(object.r2());
+    else
+        mR2.resize(mR2.size() + 1);
+}
+
+StructureIsInitialize2Columns::Row StructureIsInitialize2Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureIsInitialize2Columns::r() const
+{
+    return mR;
+}
+
+const std::vector<bool>& StructureIsInitialize2Columns::valid_r() const
+{
+    return mRAvailability;
+}
+
+const std::vector<long>& StructureIsInitialize2Columns::o() const
+{
+    return mO;
+}
+
+const std::vector<bool>& StructureIsInitialize2Columns::exist_o() const
+{
+    return mOAvailability;
+}
+
+const std::vector<long>& StructureIsInitialize2Columns::d() const
+{
+    return mD;
+}
+
+const std::vector<long>& StructureIsInitialize2Columns::r2() const
+{
+    return mR2;
+}
+
+const std::vector<bool>& StructureIsInitialize2Columns::valid_r2() const
+{
+    return mR2Availability;
+}
+
+StructureNonControlledInherit::StructureNonControlledInherit()
+{
+}
+
+StructureNonControlledInherit::~StructureNonControlledInherit()
+{
+}
+
+StructureNonControlledInheritSPtr StructureNonControlledInherit::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureNonControlledInherit>(object);
+}
+
+StructureNonControlledInheritSPtr StructureNonControlledInherit::shared_from_this()
+{
+    return boost::static_pointer_cast<StructureNonControlledInherit>(
+        boost::enable_shared_from_this<StructureIsInitialize>::shared_from_this());
+}
+
+StructureNonControlledInheritSCPtr StructureNonControlledInherit::shared_from_this() const
+{
+    return boost::static_pointer_cast<const StructureNonControlledInherit>(
+        boost::enable_shared_from_this<StructureIsInitialize>::shared_from_this());
+}
+
+StructureNonControlledInherit& StructureNonControlledInherit::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureNonControlledInherit& StructureNonControlledInherit::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureNonControlledInherit& StructureNonControlledInherit::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureNonControlledInheritColumns::Row::Row(const StructureNonControlledInheritColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureNonControlledInheritColumns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+bool StructureNonControlledInheritColumns::Row::valid_r() const
+{
+    return mColumns.valid_r()[mIndex];
+}
+
+long StructureNonControlledInheritColumns::Row::o() const
+{
+    return mColumns.o()[mIndex];
+}
+
+bool StructureNonControlledInheritColumns::Row::exist_o() const
+{
+    return mColumns.exist_o()[mIndex];
+}
+
+long StructureNonControlledInheritColumns::Row::d() const
+{
+    return mColumns.d()[mIndex];
+}
+
+StructureNonControlledInheritColumns::StructureNonControlledInheritColumns()
+{
+}
+
+StructureNonControlledInheritColumns::~StructureNonControlledInheritColumns()
+{
+}
+
+size_t StructureNonControlledInheritColumns::size() const
+{
+    return mR.size();
+}
+
+bool StructureNonControlledInheritColumns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureNonControlledInheritColumns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mRAvailability.reserve(size);
+    mO.reserve(size);
+    mOAvailability.reserve(size);
+    mD.reserve(size);
+}
+
+void StructureNonControlledInheritColumns::clear()
+{
+    mR.clear();
+    mRAvailability.clear();
+    mO.clear();
+    mOAvailability.clear();
+    mD.clear();
+}
+
+void StructureNonControlledInheritColumns::push_back(const StructureNonControlledInherit& object)
+{
+    mRAvailability.push_back(object.valid_r());
+    if (mRAvailability.back())
+        mR.push_back(object.r());
+    else
+        mR.resize(mR.size() + 1);
+    mOAvailability.push_back(object.exist_o());
+    if (mOAvailability.back())
+        mO.push_back(object.o());
+    else
+        mO.resize(mO.size() + 1);
+    mD.push_back(object.d());
+}
+
+StructureNonControlledInheritColumns::Row StructureNonControlledInheritColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureNonControlledInheritColumns::r() const
+{
+    return mR;
+}
+
+const std::vector<bool>& StructureNonControlledInheritColumns::valid_r() const
+{
+    return mRAvailability;
+}
+
+const std::vector<long>& StructureNonControlledInheritColumns::o() const
+{
+    return mO;
+}
+
+const std::vector<bool>& StructureNonControlledInheritColumns::exist_o() const
+{
+    return mOAvailability;
+}
+
+const std::vector<long>& StructureNonControlledInheritColumns::d() const
+{
+    return mD;
+}
+
+int StructureIsInitialize3::bitmask_r3()
+{
+    return 0x1;
+}
+
+StructureIsInitialize3::StructureIsInitialize3()
+        : mBits(0)
+{
+}
+
+StructureIsInitialize3::~StructureIsInitialize3()
+{
+}
+
+StructureIsInitialize3SPtr StructureIsInitialize3::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize3>(object);
+}
+
+StructureIsInitialize3SPtr StructureIsInitialize3::shared_from_this()
+{
+    return boost::static_pointer_cast<StructureIsInitialize3>(
+        boost::enable_shared_from_this<StructureIsInitialize>::shared_from_this());
+}
+
+StructureIsInitialize3SCPtr StructureIsInitialize3::shared_from_this() const
+{
+    return boost::static_pointer_cast<const StructureIsInitialize3>(
+        boost::enable_shared_from_this<StructureIsInitialize>::shared_from_this());
+}
+
+bool StructureIsInitialize3::isInitialized() const
+{
+    // structure StructureNonControlledInherit is not controlled. This function assume it is initilized
+    if (!StructureIsInitialize::isInitialized()) return false;
+    if (!valid_r3()) return false;
+    return true;
+}
+
+long StructureIsInitialize3::r3() const
+{
+    BOOST_ASSERT(valid_r3());
+    return mR3;
+}
+
+bool StructureIsInitialize3::valid_r3() const
+{
+    return (mBits & bitmask_r3()) != 0;
+}
+
+StructureIsInitialize3& StructureIsInitialize3::set_r3(long r3)
+{
+    mR3    = r3;
+    mBits |= bitmask_r3();
+    return *this;
+}
+
+void StructureIsInitialize3::erase_r3()
+{
+    mR3    =  0;
+    mBits &= ~bitmask_r3();
+}
+
+StructureIsInitialize3& StructureIsInitialize3::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize3& StructureIsInitialize3::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureIsInitialize3& StructureIsInitialize3::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureIsInitialize3Columns::Row::Row(const StructureIsInitialize3Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureIsInitialize3Columns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+bool StructureIsInitialize3Columns::Row::valid_r() const
+{
+    return mColumns.valid_r()[mIndex];
+}
+
+long StructureIsInitialize3Columns::Row::o() const
+{
+    return mColumns.o()[mIndex];
+}
+
+bool StructureIsInitialize3Columns::Row::exist_o() const
+{
+    return mColumns.exist_o()[mIndex];
+}
+
+long StructureIsInitialize3Columns::Row::d() const
+{
+    return mColumns.d()[mIndex];
+}
+
+long StructureIsInitialize3Columns::Row::r3() const
+{
+    return mColumns.r3()[mIndex];
+}
+
+bool StructureIsInitialize3Columns::Row::valid_r3() const
+{
+    return mColumns.valid_r3()[mIndex];
+}
+
+StructureIsInitialize3Columns::StructureIsInitialize3Columns()
+{
+}
+
+StructureIsInitialize3Columns::~StructureIsInitialize3Columns()
+{
+}
+
+size_t StructureIsInitialize3Columns::size() const
+{
+    return mR.size();
+}
+
+bool StructureIsInitialize3Columns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureIsInitialize3Columns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mRAvailability.reserve(size);
+    mO.reserve(size);
+    mOAvailability.reserve(size);
+    mD.reserve(size);
+    mR3.reserve(size);
+    mR3Availability.reserve(size);
+}
+
+void StructureIsInitialize3Columns::clear()
+{
+    mR.clear();
+    mRAvailability.clear();
+    mO.clear();
+    mOAvailability.clear();
+    mD.clear();
+    mR3.clear();
+    mR3Availability.clear();
+}
+
+void StructureIsInitialize3Columns::push_back(const StructureIsInitialize3& object)
+{
+    mRAvailability.push_back(object.valid_r());
+    if (mRAvailability.back())
+        mR.push_back(object.r());
+    else
+        mR.resize(mR.size() + 1);
+    mOAvailability.push_back(object.exist_o());
+    if (mOAvailability.back())
+        mO.push_back(object.o());
+    else
+        mO.resize(mO.size() + 1);
+    mD.push_back(object.d());
+    mR3Availability.push_back(object.valid_r3());
+    if (mR3Availability.back())
+        mR3.push_back(object.r3());
+    else
+        mR3.resize(mR3.size() + 1);
+}
+
+StructureIsInitialize3Columns::Row StructureIsInitialize3Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureIsInitialize3Columns::r() const
+{
+    return mR;
+}
+
+const std::vector<bool>& StructureIsInitialize3Columns::valid_r() const
+{
+    return mRAvailability;
+}
+
+const std::vector<long>& StructureIsInitialize3Columns::o() const
+{
+    return mO;
+}
+
+const std::vector<bool>& StructureIsInitialize3Columns::exist_o() const
+{
+    return mOAvailability;
+}
+
+const std::vector<long>& StructureIsInitialize3Columns::d() const
+{
+    return mD;
+}
+
+const std::vector<long>& StructureIsInitialize3Columns::r3() const
+{
+    return mR3;
+}
+
+const std::vector<bool>& StructureIsInitialize3Columns::valid_r3() const
+{
+    return mR3Availability;
+}
+
+StructureNonControlled::StructureNonControlled()
+{
+}
+
+StructureNonControlled::~StructureNonControlled()
+{
+}
+
+StructureNonControlledSPtr StructureNonControlled::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureNonControlled>(object);
+}
+
+StructureNonControlled& StructureNonControlled::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureNonControlled& StructureNonControlled::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureNonControlled& StructureNonControlled::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureNonControlledColumns::Row::Row(const StructureNonControlledColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureNonControlledColumns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+bool StructureNonControlledColumns::Row::valid_r() const
+{
+    return mColumns.valid_r()[mIndex];
+}
+
+long StructureNonControlledColumns::Row::o() const
+{
+    return mColumns.o()[mIndex];
+}
+
+bool StructureNonControlledColumns::Row::exist_o() const
+{
+    return mColumns.exist_o()[mIndex];
+}
+
+long StructureNonControlledColumns::Row::d() const
+{
+    return mColumns.d()[mIndex];
+}
+
+StructureNonControlledColumns::StructureNonControlledColumns()
+{
+}
+
+StructureNonControlledColumns::~StructureNonControlledColumns()
+{
+}
+
+size_t StructureNonControlledColumns::size() const
+{
+    return mR.size();
+}
+
+bool StructureNonControlledColumns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureNonControlledColumns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mRAvailability.reserve(size);
+    mO.reserve(size);
+    mOAvailability.reserve(size);
+    mD.reserve(size);
+}
+
+void StructureNonControlledColumns::clear()
+{
+    mR.clear();
+    mRAvailability.clear();
+    mO.clear();
+    mOAvailability.clear();
+    mD.clear();
+}
+
+void StructureNonControlledColumns::push_back(const StructureNonControlled& object)
+{
+    mRAvailability.push_back(object.valid_r());
+    if (mRAvailability.back())
+        mR.push_back(object.r());
+    else
+        mR.resize(mR.size() + 1);
+    mOAvailability.push_back(object.exist_o());
+    if (mOAvailability.back())
+        mO.push_back(object.o());
+    else
+        mO.resize(mO.size() + 1);
+    mD.push_back(object.d());
+}
+
+StructureNonControlledColumns::Row StructureNonControlledColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureNonControlledColumns::r() const
+{
+    return mR;
+}
+
+const std::vector<bool>& StructureNonControlledColumns::valid_r() const
+{
+    return mRAvailability;
+}
+
+const std::vector<long>& StructureNonControlledColumns::o() const
+{
+    return mO;
+}
+
+const std::vector<bool>& StructureNonControlledColumns::exist_o() const
+{
+    return mOAvailability;
+}
+
+const std::vector<long>& StructureNonControlledColumns::d() const
+{
+    return mD;
+}
+
+int StructureIsInitialize4::bitmask_r4()
+{
+    return 0x1;
+}
+
+StructureIsInitialize4::StructureIsInitialize4()
+        : mBits(0)
+{
+}
+
+StructureIsInitialize4::~StructureIsInitialize4()
+{
+}
+
+StructureIsInitialize4SPtr StructureIsInitialize4::downcast(const StructureIsInitializeSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize4>(object);
+}
+
+bool StructureIsInitialize4::isInitialized() const
+{
+    // structure StructureNonControlled is not controlled. This function assume it is initilized
+    if (!StructureIsInitialize::isInitialized()) return false;
+    if (!valid_r4()) return false;
+    return true;
+}
+
+long StructureIsInitialize4::r4() const
+{
+    BOOST_ASSERT(valid_r4());
+    return mR4;
+}
+
+bool StructureIsInitialize4::valid_r4() const
+{
+    return (mBits & bitmask_r4()) != 0;
+}
+
+StructureIsInitialize4& StructureIsInitialize4::set_r4(long r4)
+{
+    mR4    = r4;
+    mBits |= bitmask_r4();
+    return *this;
+}
+
+void StructureIsInitialize4::erase_r4()
+{
+    mR4    =  0;
+    mBits &= ~bitmask_r4();
+}
+
+StructureIsInitialize4& StructureIsInitialize4::set_r(long r)
+{
+    StructureIsInitialize::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize4& StructureIsInitialize4::set_o(long o)
+{
+    StructureIsInitialize::set_o(o);
+    return *this;
+}
+
+StructureIsInitialize4& StructureIsInitialize4::set_d(long d)
+{
+    StructureIsInitialize::set_d(d);
+    return *this;
+}
+
+StructureIsInitialize4Columns::Row::Row(const StructureIsInitialize4Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureIsInitialize4Columns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+bool StructureIsInitialize4Columns::Row::valid_r() const
+{
+    return mColumns.valid_r()[mIndex];
+}
+
+long StructureIsInitialize4Columns::Row::o() const
+{
+    return mColumns.o()[mIndex];
+}
+
+bool StructureIsInitialize4Columns::Row::exist_o() const
+{
+    return mColumns.exist_o()[mIndex];
+}
+
+long StructureIsInitialize4Columns::Row::d() const
+{
+    return mColumns.d()[mIndex];
+}
+
+long StructureIsInitialize4Columns::Row::r4() const
+{
+    return mColumns.r4()[mIndex];
+}
+
+bool StructureIsInitialize4Columns::Row::valid_r4() const
+{
+    return mColumns.valid_r4()[mIndex];
+}
+
+StructureIsInitialize4Columns::StructureIsInitialize4Columns()
+{
+}
+
+StructureIsInitialize4Columns::~StructureIsInitialize4Columns()
+{
+}
+
+size_t StructureIsInitialize4Columns::size() const
+{
+    return mR.size();
+}
+
+bool StructureIsInitialize4Columns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureIsInitialize4Columns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mRAvailability.reserve(size);
+    mO.reserve(size);
+    mOAvailability.reserve(size);
+    mD.reserve(size);
+    mR4.reserve(size);
+    mR4Availability.reserve(size);
+}
+
+void StructureIsInitialize4Columns::clear()
+{
+    mR.clear();
+    mRAvailability.clear();
+    mO.clear();
+    mOAvailability.clear();
+    mD.clear();
+    mR4.clear();
+    mR4Availability.clear();
+}
+
+void StructureIsInitialize4Columns::push_back(const StructureIsInitialize4& object)
+{
+    mRAvailability.push_back(object.valid_r());
+    if (mRAvailability.back())
+        mR.push_back(object.r());
+    else
+        mR.resize(mR.size() + 1);
+    mOAvailability.push_back(object.exist_o());
+    if (mOAvailability.back())
+        mO.push_back(object.o());
+    else
+        mO.resize(mO.size() + 1);
+    mD.push_back(object.d());
+    mR4Availability.push_back(object.valid_r4());
+    if (mR4Availability.back())
+        mR4.push_back(object.r4());
+    else
+        mR4.resize(mR4.size() + 1);
+}
+
+StructureIsInitialize4Columns::Row StructureIsInitialize4Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureIsInitialize4Columns::r() const
+{
+    return mR;
+}
+
+const std::vector<bool>& StructureIsInitialize4Columns::valid_r() const
+{
+    return mRAvailability;
+}
+
+const std::vector<long>& StructureIsInitialize4Columns::o() const
+{
+    return mO;
+}
+
+const std::vector<bool>& StructureIsInitialize4Columns::exist_o() const
+{
+    return mOAvailability;
+}
+
+const std::vector<long>& StructureIsInitialize4Columns::d() const
+{
+    return mD;
+}
+
+const std::vector<long>& StructureIsInitialize4Columns::r4() const
+{
+    return mR4;
+}
+
+const std::vector<bool>& StructureIsInitialize4Columns::valid_r4() const
+{
+    return mR4Availability;
+}
+
+int StructureIsInitializeVirtual::bitmask_r()
+{
+    return 0x1;
+}
+
+StructureIsInitializeVirtual::StructureIsInitializeVirtual()
+        : mBits(0)
+{
+}
+
+StructureIsInitializeVirtual::~StructureIsInitializeVirtual()
+{
+}
+
+bool StructureIsInitializeVirtual::isInitialized() const
+{
+    if (!valid_r()) return false;
+    return true;
+}
+
+long StructureIsInitializeVirtual::r() const
+{
+    BOOST_ASSERT(valid_r());
+    return mR;
+}
+
+bool StructureIsInitializeVirtual::valid_r() const
+{
+    return (mBits & bitmask_r()) != 0;
+}
+
+StructureIsInitializeVirtual& StructureIsInitializeVirtual::set_r(long r)
+{
+    mR     = r;
+    mBits |= bitmask_r();
+    return *this;
+}
+
+void StructureIsInitializeVirtual::erase_r()
+{
+    mR     =  0;
+    mBits &= ~bitmask_r();
+}
+
+StructureIsInitializeVirtualColumns::Row::Row(const StructureIsInitializeVirtualColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureIsInitializeVirtualColumns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+bool StructureIsInitializeVirtualColumns::Row::valid_r() const
+{
+    return mColumns.valid_r()[mIndex];
+}
+
+StructureIsInitializeVirtualColumns::StructureIsInitializeVirtualColumns()
+{
+}
+
+StructureIsInitializeVirtualColumns::~StructureIsInitializeVirtualColumns()
+{
+}
+
+size_t StructureIsInitializeVirtualColumns::size() const
+{
+    return mR.size();
+}
+
+bool StructureIsInitializeVirtualColumns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureIsInitializeVirtualColumns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mRAvailability.reserve(size);
+}
+
+void StructureIsInitializeVirtualColumns::clear()
+{
+    mR.clear();
+    mRAvailability.clear();
+}
+
+void StructureIsInitializeVirtualColumns::push_back(const StructureIsInitializeVirtual& object)
+{
+    mRAvailability.push_back(object.valid_r());
+    if (mRAvailability.back())
+        mR.push_back(object.r());
+    else
+        mR.resize(mR.size() + 1);
+}
+
+StructureIsInitializeVirtualColumns::Row StructureIsInitializeVirtualColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureIsInitializeVirtualColumns::r() const
+{
+    return mR;
+}
+
+const std::vector<bool>& StructureIsInitializeVirtualColumns::valid_r() const
+{
+    return mRAvailability;
+}
+
+StructureNonControlledVirtualInherit::StructureNonControlledVirtualInherit()
+{
+}
+
+StructureNonControlledVirtualInherit::~StructureNonControlledVirtualInherit()
+{
+}
+
+StructureNonControlledVirtualInheritSPtr StructureNonControlledVirtualInherit::downcast(const StructureIsInitializeVirtualSPtr& object)
+{
+    return boost::static_pointer_cast<StructureNonControlledVirtualInherit>(object);
+}
+
+StructureNonControlledVirtualInherit& StructureNonControlledVirtualInherit::set_r(long r)
+{
+    StructureIsInitializeVirtual::set_r(r);
+    return *this;
+}
+
+StructureNonControlledVirtualInheritColumns::Row::Row(const StructureNonControlledVirtualInheritColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureNonControlledVirtualInheritColumns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+bool StructureNonControlledVirtualInheritColumns::Row::valid_r() const
+{
+    return mColumns.valid_r()[mIndex];
+}
+
+StructureNonControlledVirtualInheritColumns::StructureNonControlledVirtualInheritColumns()
+{
+}
+
+StructureNonControlledVirtualInheritColumns::~StructureNonControlledVirtualInheritColumns()
+{
+}
+
+size_t StructureNonControlledVirtualInheritColumns::size() const
+{
+    return mR.size();
+}
+
+bool StructureNonControlledVirtualInheritColumns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureNonControlledVirtualInheritColumns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mRAvailability.reserve(size);
+}
+
+void StructureNonControlledVirtualInheritColumns::clear()
+{
+    mR.clear();
+    mRAvailability.clear();
+}
+
+void StructureNonControlledVirtualInheritColumns::push_back(const StructureNonControlledVirtualInherit& object)
+{
+    mRAvailability.push_back(object.valid_r());
+    if (mRAvailability.back())
+        mR.push_back(object.r());
+    else
+        mR.resize(mR.size() + 1);
+}
+
+StructureNonControlledVirtualInheritColumns::Row StructureNonControlledVirtualInheritColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureNonControlledVirtualInheritColumns::r() const
+{
+    return mR;
+}
+
+const std::vector<bool>& StructureNonControlledVirtualInheritColumns::valid_r() const
+{
+    return mRAvailability;
+}
+
+int StructureIsInitialize5::bitmask_r5()
+{
+    return 0x1;
+}
+
+StructureIsInitialize5::StructureIsInitialize5()
+        : mBits(0)
+{
+}
+
+StructureIsInitialize5::~StructureIsInitialize5()
+{
+}
+
+StructureIsInitialize5SPtr StructureIsInitialize5::downcast(const StructureIsInitializeVirtualSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize5>(object);
+}
+
+bool StructureIsInitialize5::isInitialized() const
+{
+    // structure StructureNonControlledVirtualInherit is not controlled. This function assume it is initilized
+    if (!StructureIsInitializeVirtual::isInitialized()) return false;
+    if (!valid_r5()) return false;
+    return true;
+}
+
+long StructureIsInitialize5::r5() const
+{
+    BOOST_ASSERT(valid_r5());
+    return mR5;
+}
+
+bool StructureIsInitialize5::valid_r5() const
+{
+    return (mBits & bitmask_r5()) != 0;
+}
+
+StructureIsInitialize5& StructureIsInitialize5::set_r5(long r5)
+{
+    mR5    = r5;
+    mBits |= bitmask_r5();
+    return *this;
+}
+
+void StructureIsInitialize5::erase_r5()
+{
+    mR5    =  0;
+    mBits &= ~bitmask_r5();
+}
+
+StructureIsInitialize5& StructureIsInitialize5::set_r(long r)
+{
+    StructureIsInitializeVirtual::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize5Columns::Row::Row(const StructureIsInitialize5Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureIsInitialize5Columns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+bool StructureIsInitialize5Columns::Row::valid_r() const
+{
+    return mColumns.valid_r()[mIndex];
+}
+
+long StructureIsInitialize5Columns::Row::r5() const
+{
+    return mColumns.r5()[mIndex];
+}
+
+bool StructureIsInitialize5Columns::Row::valid_r5() const
+{
+    return mColumns.valid_r5()[mIndex];
+}
+
+StructureIsInitialize5Columns::StructureIsInitialize5Columns()
+{
+}
+
+StructureIsInitialize5Columns::~StructureIsInitialize5Columns()
+{
+}
+
+size_t StructureIsInitialize5Columns::size() const
+{
+    return mR.size();
+}
+
+bool StructureIsInitialize5Columns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureIsInitialize5Columns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mRAvailability.reserve(size);
+    mR5.reserve(size);
+    mR5Availability.reserve(size);
+}
+
+void StructureIsInitialize5Columns::clear()
+{
+    mR.clear();
+    mRAvailability.clear();
+    mR5.clear();
+    mR5Availability.clear();
+}
+
+void StructureIsInitialize5Columns::push_back(const StructureIsInitialize5& object)
+{
+    mRAvailability.push_back(object.valid_r());
+    if (mRAvailability.back())
+        mR.push_back(object.r());
+    else
+        mR.resize(mR.size() + 1);
+    mR5Availability.push_back(object.valid_r5());
+    if (mR5Availability.back())
+        mR5.push_back(object.r5());
+    else
+        mR5.resize(mR5.size() + 1);
+}
+
+StructureIsInitialize5Columns::Row StructureIsInitialize5Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureIsInitialize5Columns::r() const
+{
+    return mR;
+}
+
+const std::vector<bool>& StructureIsInitialize5Columns::valid_r() const
+{
+    return mRAvailability;
+}
+
+const std::vector<long>& StructureIsInitialize5Columns::r5() const
+{
+    return mR5;
+}
+
+const std::vector<bool>& StructureIsInitialize5Columns::valid_r5() const
+{
+    return mR5Availability;
+}
+
+StructureNonControlledVirtual::StructureNonControlledVirtual()
+{
+}
+
+StructureNonControlledVirtual::~StructureNonControlledVirtual()
+{
+}
+
+long StructureNonControlledVirtual::r() const
+{
+    return mR;
+}
+
+StructureNonControlledVirtual& StructureNonControlledVirtual::set_r(long r)
+{
+    mR = r;
+    return *this;
+}
+
+StructureNonControlledVirtualColumns::Row::Row(const StructureNonControlledVirtualColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureNonControlledVirtualColumns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+StructureNonControlledVirtualColumns::StructureNonControlledVirtualColumns()
+{
+}
+
+StructureNonControlledVirtualColumns::~StructureNonControlledVirtualColumns()
+{
+}
+
+size_t StructureNonControlledVirtualColumns::size() const
+{
+    return mR.size();
+}
+
+bool StructureNonControlledVirtualColumns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureNonControlledVirtualColumns::reserve(size_t size)
+{
+    mR.reserve(size);
+}
+
+void StructureNonControlledVirtualColumns::clear()
+{
+    mR.clear();
+}
+
+void StructureNonControlledVirtualColumns::push_back(const StructureNonControlledVirtual& object)
+{
+    mR.push_back(object.r());
+}
+
+StructureNonControlledVirtualColumns::Row StructureNonControlledVirtualColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureNonControlledVirtualColumns::r() const
+{
+    return mR;
+}
+
+int StructureIsInitialize6::bitmask_r6()
+{
+    return 0x1;
+}
+
+StructureIsInitialize6::StructureIsInitialize6()
+        : mBits(0)
+{
+}
+
+StructureIsInitialize6::~StructureIsInitialize6()
+{
+}
+
+StructureIsInitialize6SPtr StructureIsInitialize6::downcast(const StructureNonControlledVirtualSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsInitialize6>(object);
+}
+
+bool StructureIsInitialize6::isInitialized() const
+{
+    // structure StructureNonControlledVirtual is not controlled. This function assume it is initilized
+    if (!valid_r6()) return false;
+    return true;
+}
+
+long StructureIsInitialize6::r6() const
+{
+    BOOST_ASSERT(valid_r6());
+    return mR6;
+}
+
+bool StructureIsInitialize6::valid_r6() const
+{
+    return (mBits & bitmask_r6()) != 0;
+}
+
+StructureIsInitialize6& StructureIsInitialize6::set_r6(long r6)
+{
+    mR6    = r6;
+    mBits |= bitmask_r6();
+    return *this;
+}
+
+void StructureIsInitialize6::erase_r6()
+{
+    mR6    =  0;
+    mBits &= ~bitmask_r6();
+}
+
+StructureIsInitialize6& StructureIsInitialize6::set_r(long r)
+{
+    StructureNonControlledVirtual::set_r(r);
+    return *this;
+}
+
+StructureIsInitialize6Columns::Row::Row(const StructureIsInitialize6Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureIsInitialize6Columns::Row::r() const
+{
+    return mColumns.r()[mIndex];
+}
+
+long StructureIsInitialize6Columns::Row::r6() const
+{
+    return mColumns.r6()[mIndex];
+}
+
+bool StructureIsInitialize6Columns::Row::valid_r6() const
+{
+    return mColumns.valid_r6()[mIndex];
+}
+
+StructureIsInitialize6Columns::StructureIsInitialize6Columns()
+{
+}
+
+StructureIsInitialize6Columns::~StructureIsInitialize6Columns()
+{
+}
+
+size_t StructureIsInitialize6Columns::size() const
+{
+    return mR.size();
+}
+
+bool StructureIsInitialize6Columns::empty() const
+{
+    return mR.empty();
+}
+
+void StructureIsInitialize6Columns::reserve(size_t size)
+{
+    mR.reserve(size);
+    mR6.reserve(size);
+    mR6Availability.reserve(size);
+}
+
+void StructureIsInitialize6Columns::clear()
+{
+    mR.clear();
+    mR6.clear();
+    mR6Availability.clear();
+}
+
+void StructureIsInitialize6Columns::push_back(const StructureIsInitialize6& object)
+{
+    mR.push_back(object.r());
+    mR6Availability.push_back(object.valid_r6());
+    if (mR6Availability.back())
+        mR6.push_back(object.r6());
+    else
+        mR6.resize(mR6.size() + 1);
+}
+
+StructureIsInitialize6Columns::Row StructureIsInitialize6Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureIsInitialize6Columns::r() const
+{
+    return mR;
+}
+
+const std::vector<long>& StructureIsInitialize6Columns::r6() const
+{
+    return mR6;
+}
+
+const std::vector<bool>& StructureIsInitialize6Columns::valid_r6() const
+{
+    return mR6Availability;
+}
+
+int StructureIsVoid::bitmask_o()
+{
+    return 0x1;
+}
+
+StructureIsVoid::StructureIsVoid()
+        : mBits(0)
+{
+}
+
+StructureIsVoid::~StructureIsVoid()
+{
+}
+
+bool StructureIsVoid::isInitialized() const
+{
+    return true;
+}
+
+bool StructureIsVoid::isVoid() const
+{
+    if (exist_o()) return false;
+    return true;
+}
+
+long StructureIsVoid::o() const
+{
+    BOOST_ASSERT(exist_o());
+    return mO;
+}
+
+bool StructureIsVoid::exist_o() const
+{
+    return (mBits & bitmask_o()) != 0;
+}
+
+StructureIsVoid& StructureIsVoid::set_o(long o)
+{
+    mO     = o;
+    mBits |= bitmask_o();
+    return *this;
+}
+
+void StructureIsVoid::clear_o()
+{
+    mO     =  0;
+    mBits &= ~bitmask_o();
+}
+
+StructureIsVoidColumns::Row::Row(const StructureIsVoidColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureIsVoidColumns::Row::o() const
+{
+    return mColumns.o()[mIndex];
+}
+
+bool StructureIsVoidColumns::Row::exist_o() const
+{
+    return mColumns.exist_o()[mIndex];
+}
+
+StructureIsVoidColumns::StructureIsVoidColumns()
+{
+}
+
+StructureIsVoidColumns::~StructureIsVoidColumns()
+{
+}
+
+size_t StructureIsVoidColumns::size() const
+{
+    return mO.size();
+}
+
+bool StructureIsVoidColumns::empty() const
+{
+    return mO.empty();
+}
+
+void StructureIsVoidColumns::reserve(size_t size)
+{
+    mO.reserve(size);
+    mOAvailability.reserve(size);
+}
+
+void StructureIsVoidColumns::clear()
+{
+    mO.clear();
+    mOAvailability.clear();
+}
+
+void StructureIsVoidColumns::push_back(const StructureIsVoid& object)
+{
+    mOAvailability.push_back(object.exist_o());
+    if (mOAvailability.back())
+        mO.push_back(object.o());
+    else
+        mO.resize(mO.size() + 1);
+}
+
+StructureIsVoidColumns::Row StructureIsVoidColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureIsVoidColumns::o() const
+{
+    return mO;
+}
+
+const std::vector<bool>& StructureIsVoidColumns::exist_o() const
+{
+    return mOAvailability;
+}
+
+int StructureIsVoid1::bitmask_o1()
+{
+    return 0x1;
+}
+
+StructureIsVoid1::StructureIsVoid1()
+        : mBits(0)
+{
+}
+
+StructureIsVoid1::~StructureIsVoid1()
+{
+}
+
+StructureIsVoid1SPtr StructureIsVoid1::downcast(const StructureIsVoidSPtr& object)
+{
+    return boost::static_pointer_cast<StructureIsVoid1>(object);
+}
+
+bool StructureIsVoid1::isInitialized() const
+{
+    if (!StructureIsVoid::isInitialized()) return false;
+    return true;
+}
+
+bool StructureIsVoid1::isVoid() const
+{
+    if (!StructureIsVoid::isVoid()) return false;
+    if (exist_o1()) return false;
+    return true;
+}
+
+long StructureIsVoid1::o1() const
+{
+    BOOST_ASSERT(exist_o1());
+    return mO1;
+}
+
+bool StructureIsVoid1::exist_o1() const
+{
+    return (mBits & bitmask_o1()) != 0;
+}
+
+StructureIsVoid1& StructureIsVoid1::set_o1(long o1)
+{
+    mO1    = o1;
+    mBits |= bitmask_o1();
+    return *this;
+}
+
+void StructureIsVoid1::clear_o1()
+{
+    mO1    =  0;
+    mBits &= ~bitmask_o1();
+}
+
+StructureIsVoid1& StructureIsVoid1::set_o(long o)
+{
+    StructureIsVoid::set_o(o);
+    return *this;
+}
+
+StructureIsVoid1Columns::Row::Row(const StructureIsVoid1Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long StructureIsVoid1Columns::Row::o() const
+{
+    return mColumns.o()[mIndex];
+}
+
+bool StructureIsVoid1Columns::Row::exist_o() const
+{
+    return mColumns.exist_o()[mIndex];
+}
+
+long StructureIsVoid1Columns::Row::o1() const
+{
+    return mColumns.o1()[mIndex];
+}
+
+bool StructureIsVoid1Columns::Row::exist_o1() const
+{
+    return mColumns.exist_o1()[mIndex];
+}
+
+StructureIsVoid1Columns::StructureIsVoid1Columns()
+{
+}
+
+StructureIsVoid1Columns::~StructureIsVoid1Columns()
+{
+}
+
+size_t StructureIsVoid1Columns::size() const
+{
+    return mO.size();
+}
+
+bool StructureIsVoid1Columns::empty() const
+{
+    return mO.empty();
+}
+
+void StructureIsVoid1Columns::reserve(size_t size)
+{
+    mO.reserve(size);
+    mOAvailability.reserve(size);
+    mO1.reserve(size);
+    mO1Availability.reserve(size);
+}
+
+void StructureIsVoid1Columns::clear()
+{
+    mO.clear();
+    mOAvailability.clear();
+    mO1.clear();
+    mO1Availability.clear();
+}
+
+void StructureIsVoid1Columns::push_back(const StructureIsVoid1& object)
+{
+    mOAvailability.push_back(object.exist_o());
+    if (mOAvailability.back())
+        mO.push_back(object.o());
+    else
+        mO.resize(mO.size() + 1);
+    mO1Availability.push_back(object.exist_o1());
+    if (mO1Availability.back())
+        mO1.push_back(object.o1());
+    else
+        mO1.resize(mO1.size() + 1);
+}
+
+StructureIsVoid1Columns::Row StructureIsVoid1Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& StructureIsVoid1Columns::o() const
+{
+    return mO;
+}
+
+const std::vector<bool>& StructureIsVoid1Columns::exist_o() const
+{
+    return mOAvailability;
+}
+
+const std::vector<long>& StructureIsVoid1Columns::o1() const
+{
+    return mO1;
+}
+
+const std::vector<bool>& StructureIsVoid1Columns::exist_o1() const
+{
+    return mO1Availability;
+}
+
+EStructureIsInitializeVirtualId::EStructureIsInitializeVirtualId()
+        : mValue(kInvalid)
+{
+}
+
+EStructureIsInitializeVirtualId::EStructureIsInitializeVirtualId(long value)
+        : mValue(value)
+{
+}
+
+const EStructureIsInitializeVirtualId EStructureIsInitializeVirtualId::invalid()
+{
+    return EStructureIsInitializeVirtualId(kInvalid);
+}
+
+const EStructureIsInitializeVirtualId EStructureIsInitializeVirtualId::structureIsInitializeVirtual()
+{
+    return EStructureIsInitializeVirtualId(kStructureIsInitializeVirtual);
+}
+
+long EStructureIsInitializeVirtualId::value() const
+{
+    return mValue;
+}
+
+const char* EStructureIsInitializeVirtualId::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "StructureIsInitializeVirtual",
+    };
+    return names[(size_t)value];
+}
+
+const char* EStructureIsInitializeVirtualId::shortName() const
+{
+    return shortName(value());
+}
+
+EStructureIsInitializeVirtualId EStructureIsInitializeVirtualId::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        0, 0,
+    };
+    static const char* names[] =
+    {
+        "StructureIsInitializeVirtual",
+        "invalid",
+    };
+    static const size_t lengths[] =
+    {
+        28, 7,
+    };
+    static const long values[] =
+    {
+        kStructureIsInitializeVirtual,
+        kInvalid,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 2;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return EStructureIsInitializeVirtualId();
+    return EStructureIsInitializeVirtualId(values[slot]);
+}
+
+bool EStructureIsInitializeVirtualId::operator==(const EStructureIsInitializeVirtualId& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EStructureIsInitializeVirtualId::operator!=(const EStructureIsInitializeVirtualId& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EStructureIsInitializeVirtualId StructureIsInitializeVirtual::staticStructureIsInitializeVirtualId()
+{
+    return EStructureIsInitializeVirtualId::structureIsInitializeVirtual();
+}
+
+EStructureIsInitializeVirtualId StructureIsInitializeVirtual::runtimeStructureIsInitializeVirtualId() const
+{
+    return staticStructureIsInitializeVirtualId();
+}
+
+StructureIsInitializeVirtualSPtr StructureIsInitializeVirtualFactory::clone(const StructureIsInitializeVirtualSPtr& pObject)
+{
+    switch (pObject->runtimeStructureIsInitializeVirtualId().value())
+    {
+        case EStructureIsInitializeVirtualId::kStructureIsInitializeVirtual:
+        {
+            StructureIsInitializeVirtualSPtr pClone(new StructureIsInitializeVirtual());
+            *pClone = *pObject;
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return StructureIsInitializeVirtualSPtr();
+}
+
+std::vector<StructureIsInitializeVirtualSPtr> StructureIsInitializeVirtualFactory::cloneAll(const std::vector<StructureIsInitializeVirtualSPtr>& objects)
+{
+    // the null objects get the invalid identifier and stay null
+    std::vector<long> ids(objects.size(), 0);
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i])
+            ids[i] = objects[i]->runtimeStructureIsInitializeVirtualId().value();
+    }
+
+    std::vector<StructureIsInitializeVirtualSPtr> result;
+    slab_cloner<StructureIsInitializeVirtual> cloner(objects, ids, 2, result);
+    cloner.clone<StructureIsInitializeVirtual>(EStructureIsInitializeVirtualId::kStructureIsInitializeVirtual);
+    return result;
+}
+
+EStructureNonControlledVirtualId::EStructureNonControlledVirtualId()
+        : mValue(kInvalid)
+{
+}
+
+EStructureNonControlledVirtualId::EStructureNonControlledVirtualId(long value)
+        : mValue(value)
+{
+}
+
+const EStructureNonControlledVirtualId EStructureNonControlledVirtualId::invalid()
+{
+    return EStructureNonControlledVirtualId(kInvalid);
+}
+
+const EStructureNonControlledVirtualId EStructureNonControlledVirtualId::structureNonControlledVirtual()
+{
+    return EStructureNonControlledVirtualId(kStructureNonControlledVirtual);
+}
+
+long EStructureNonControlledVirtualId::value() const
+{
+    return mValue;
+}
+
+const char* EStructureNonControlledVirtualId::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "StructureNonControlledVirtual",
+    };
+    return names[(size_t)value];
+}
+
+const char* EStructureNonControlledVirtualId::shortName() const
+{
+    return shortName(value());
+}
+
+EStructureNonControlledVirtualId EStructureNonControlledVirtualId::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        1, 0,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "StructureNonControlledVirtual",
+    };
+    static const size_t lengths[] =
+    {
+        7, 29,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kStructureNonControlledVirtual,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 2;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return EStructureNonControlledVirtualId();
+    return EStructureNonControlledVirtualId(values[slot]);
+}
+
+bool EStructureNonControlledVirtualId::operator==(const EStructureNonControlledVirtualId& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EStructureNonControlledVirtualId::operator!=(const EStructureNonControlledVirtualId& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EStructureNonControlledVirtualId StructureNonControlledVirtual::staticStructureNonControlledVirtualId()
+{
+    return EStructureNonControlledVirtualId::structureNonControlledVirtual();
+}
+
+EStructureNonControlledVirtualId StructureNonControlledVirtual::runtimeStructureNonControlledVirtualId() const
+{
+    return staticStructureNonControlledVirtualId();
+}
+
+StructureNonControlledVirtualSPtr StructureNonControlledVirtualFactory::clone(const StructureNonControlledVirtualSPtr& pObject)
+{
+    switch (pObject->runtimeStructureNonControlledVirtualId().value())
+    {
+        case EStructureNonControlledVirtualId::kStructureNonControlledVirtual:
+        {
+            StructureNonControlledVirtualSPtr pClone(new StructureNonControlledVirtual());
+            *pClone = *pObject;
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return StructureNonControlledVirtualSPtr();
+}
+
+std::vector<StructureNonControlledVirtualSPtr> StructureNonControlledVirtualFactory::cloneAll(const std::vector<StructureNonControlledVirtualSPtr>& objects)
+{
+    // the null objects get the invalid identifier and stay null
+    std::vector<long> ids(objects.size(), 0);
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i])
+            ids[i] = objects[i]->runtimeStructureNonControlledVirtualId().value();
+    }
+
+    std::vector<StructureNonControlledVirtualSPtr> result;
+    slab_cloner<StructureNonControlledVirtual> cloner(objects, ids, 2, result);
+    cloner.clone<StructureNonControlledVirtual>(EStructureNonControlledVirtualId::kStructureNonControlledVirtual);
+    return result;
+}
+
+StructureBase::Builder::Builder()
+        : mpObject(new StructureBase())
+{
+}
+
+StructureBase::Builder::Builder(const StructureBase& object)
+        : mpObject(new StructureBase())
+{
+    *(StructureBase*)mpObject = object;
+}
+
+StructureBase::Builder::Builder(StructureBaseRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+StructureBase::Builder::~Builder()
+{
+    delete (StructureBaseRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const StructureBase& StructureBase::Builder::build() const
+{
+    return *(StructureBaseRPtr)mpObject;
+}
+
+StructureBaseSPtr StructureBase::Builder::finalize()
+{
+    StructureBaseRPtr objectRPtr = (StructureBaseRPtr)mpObject;
+    mpObject = NULL;
+    return StructureBaseSPtr(objectRPtr);
+}
+
+StructureBase::StructureBase()
+{
+}
+
+StructureBase::~StructureBase()
+{
+}
+
+StructureAbstract::StructureAbstract()
+{
+}
+
+StructureAbstract::~StructureAbstract()
+{
+}
+
+StructureAbstractSPtr StructureAbstract::downcast(const StructureBaseSPtr& object)
+{
+    return boost::static_pointer_cast<StructureAbstract>(object);
+}
+
+StructureLeaf::Builder::Builder()
+        : StructureAbstract::Builder(new StructureLeaf())
+{
+}
+
+StructureLeaf::Builder::Builder(const StructureLeaf& object)
+        : StructureAbstract::Builder(new StructureLeaf())
+{
+    *(StructureLeaf*)mpObject = object;
+}
+
+StructureLeaf::Builder::Builder(StructureLeafRPtr pObject)
+        : StructureAbstract::Builder(pObject)
+{
+}
+
+StructureLeaf::Builder::~Builder()
+{
+    delete (StructureLeafRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const StructureLeaf& StructureLeaf::Builder::build() const
+{
+    return *(StructureLeafRPtr)mpObject;
+}
+
+StructureLeafSPtr StructureLeaf::Builder::finalize()
+{
+    StructureLeafRPtr objectRPtr = (StructureLeafRPtr)mpObject;
+    mpObject = NULL;
+    return StructureLeafSPtr(objectRPtr);
+}
+
+StructureLeaf::StructureLeaf()
+{
+}
+
+StructureLeaf::~StructureLeaf()
+{
+}
+
+StructureLeafSPtr StructureLeaf::downcast(const StructureBaseSPtr& object)
+{
+    return boost::static_pointer_cast<StructureLeaf>(object);
+}
+
+}
+
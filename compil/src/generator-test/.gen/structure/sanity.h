@@ -0,0 +1,1993 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <vector>
+
+#ifndef __STRUCTURE_SANITY_COMPIL_H_
+#define __STRUCTURE_SANITY_COMPIL_H_
+
+#include "structure/sanity-fwd.h"
+// Boost C++ Smart Pointers
+#include <boost/enable_shared_from_this.hpp>
+// Standard C Library
+#include <stddef.h>
+
+template<class T> class snapshot;
+
+namespace sanity
+{
+
+class StructureIsInitialize : public boost::enable_shared_from_this<StructureIsInitialize>
+{
+public:
+    // Default constructor
+                                   StructureIsInitialize ();
+    // Destructor
+    /*lax*/                        ~StructureIsInitialize();
+
+    // Returns true if every required field is initialized.
+            bool                   isInitialized         ()       const;
+
+    // Getter method for the data field r
+            long                   r                     ()       const;
+    // Returns true if the data field r was set and could be considered
+    // valid
+            bool                   valid_r               ()       const;
+    // Setter method for the data field r
+            StructureIsInitialize& set_r                 (long r);
+    // Erases the required data field r. Object can not be instantiated
+    // before the field data is set again
+            void                   erase_r               ();
+
+    // Getter method for the data field o
+            long                   o                     ()       const;
+    // Checks if the optional field o exists
+            bool                   exist_o               ()       const;
+    // Setter method for the data field o
+            StructureIsInitialize& set_o                 (long o);
+    // Clears the optional data field o
+            void                   clear_o               ();
+
+    // Getter method for the data field d
+            long                   d                     ()       const;
+    // Returns true if the data field value d was changed from its default
+    // value 1
+            bool                   changed_d             ()       const;
+    // Returns the default value 1 of the field d
+    static  long                   default_d             ();
+    // Setter method for the data field d
+            StructureIsInitialize& set_d                 (long d);
+    // Updates the data field d. If the new value is equal to the default
+    // it clears the field else it sets it to the new value
+            StructureIsInitialize& update_d              (long d);
+    // Resets the data field d to its default value 1
+            void                   reset_d               ();
+
+private:
+    // Returns unique bitmask value for the field r
+    static int bitmask_r();
+    // Returns unique bitmask value for the field o
+    static int bitmask_o();
+    // Returns unique bitmask value for the field d
+    static int bitmask_d();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r
+    long mR;
+    // variable for the data field o
+    long mO;
+    // variable for the data field d
+    long mD;
+};
+
+// StructureIsInitializeColumns holds StructureIsInitialize objects column
+// by column - one contiguous array per data field. Use it for large
+// collections that are scanned one or two fields at a time. Such scan
+// touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureIsInitializeColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                     Row    (const StructureIsInitializeColumns& columns, size_t index);
+
+        // Getter method for the data field r
+                                            long     r      ()                                                          const;
+        // Returns true if the data field r is available in the row
+                                            bool     valid_r()                                                          const;
+
+        // Getter method for the data field o
+                                            long     o      ()                                                          const;
+        // Returns true if the data field o is available in the row
+                                            bool     exist_o()                                                          const;
+
+        // Getter method for the data field d
+                                            long     d      ()                                                          const;
+    private:
+        const StructureIsInitializeColumns& mColumns;
+        size_t                              mIndex;
+    };
+
+    // Default constructor
+                             StructureIsInitializeColumns ();
+    // Destructor
+                             ~StructureIsInitializeColumns();
+
+    // Returns the number of the rows
+    size_t                   size                         ()                                    const;
+    // Returns true if there are no rows
+    bool                     empty                        ()                                    const;
+    // Reserves memory for size rows in every column
+    void                     reserve                      (size_t size);
+    // Removes all the rows
+    void                     clear                        ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                    (const StructureIsInitialize& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                   (size_t index)                        const;
+
+    // Column of the data field r
+    const std::vector<long>& r                            ()                                    const;
+    // Availability bitmap of the data field r
+    const std::vector<bool>& valid_r                      ()                                    const;
+
+    // Column of the data field o
+    const std::vector<long>& o                            ()                                    const;
+    // Availability bitmap of the data field o
+    const std::vector<bool>& exist_o                      ()                                    const;
+
+    // Column of the data field d
+    const std::vector<long>& d                            ()                                    const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // availability bitmap of the data field r
+    std::vector<bool> mRAvailability;
+    // column of the data field o
+    std::vector<long> mO;
+    // availability bitmap of the data field o
+    std::vector<bool> mOAvailability;
+    // column of the data field d
+    std::vector<long> mD;
+};
+
+class StructureIsInitialize1 : public StructureIsInitialize
+{
+public:
+    // Default constructor
+                                       StructureIsInitialize1 ();
+    // Destructor
+    /*lax*/                            ~StructureIsInitialize1();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize1SPtr downcast               (const StructureIsInitializeSPtr& object);
+
+    // Returns the alter value 5 of the field r
+    static  long                       alter_r                ();
+
+    // Setter method for the data field r
+            StructureIsInitialize1&    set_r                  (long r);
+
+    // Setter method for the data field o
+            StructureIsInitialize1&    set_o                  (long o);
+
+    // Setter method for the data field d
+            StructureIsInitialize1&    set_d                  (long d);
+};
+
+// StructureIsInitialize1Columns holds StructureIsInitialize1 objects
+// column by column - one contiguous array per data field. Use it for large
+// collections that are scanned one or two fields at a time. Such scan
+// touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureIsInitialize1Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                      Row    (const StructureIsInitialize1Columns& columns, size_t index);
+
+        // Getter method for the data field r
+                                             long     r      ()                                                           const;
+        // Returns true if the data field r is available in the row
+                                             bool     valid_r()                                                           const;
+
+        // Getter method for the data field o
+                                             long     o      ()                                                           const;
+        // Returns true if the data field o is available in the row
+                                             bool     exist_o()                                                           const;
+
+        // Getter method for the data field d
+                                             long     d      ()                                                           const;
+    private:
+        const StructureIsInitialize1Columns& mColumns;
+        size_t                               mIndex;
+    };
+
+    // Default constructor
+                             StructureIsInitialize1Columns ();
+    // Destructor
+                             ~StructureIsInitialize1Columns();
+
+    // Returns the number of the rows
+    size_t                   size                          ()                                     const;
+    // Returns true if there are no rows
+    bool                     empty                         ()                                     const;
+    // Reserves memory for size rows in every column
+    void                     reserve                       (size_t size);
+    // Removes all the rows
+    void                     clear                         ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                     (const StructureIsInitialize1& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                    (size_t index)                         const;
+
+    // Column of the data field r
+    const std::vector<long>& r                             ()                                     const;
+    // Availability bitmap of the data field r
+    const std::vector<bool>& valid_r                       ()                                     const;
+
+    // Column of the data field o
+    const std::vector<long>& o                             ()                                     const;
+    // Availability bitmap of the data field o
+    const std::vector<bool>& exist_o                       ()                                     const;
+
+    // Column of the data field d
+    const std::vector<long>& d                             ()                                     const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // availability bitmap of the data field r
+    std::vector<bool> mRAvailability;
+    // column of the data field o
+    std::vector<long> mO;
+    // availability bitmap of the data field o
+    std::vector<bool> mOAvailability;
+    // column of the data field d
+    std::vector<long> mD;
+};
+
+class StructureIsInitialize2 : public StructureIsInitialize
+{
+public:
+    // Default constructor
+                                       StructureIsInitialize2 ();
+    // Destructor
+    /*lax*/                            ~StructureIsInitialize2();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize2SPtr downcast               (const StructureIsInitializeSPtr& object);
+
+    // Returns true if every required field is initialized.
+            bool                       isInitialized          ()                                        const;
+
+    // Getter method for the data field r2
+            long                       r2                     ()                                        const;
+    // Returns true if the data field r2 was set and could be considered
+    // valid
+            bool                       valid_r2               ()                                        const;
+    // Setter method for the data field r2
+            StructureIsInitialize2&    set_r2                 (long r2);
+    // Erases the required data field r2. Object can not be instantiated
+    // before the field data is set again
+            void                       erase_r2               ();
+
+    // Setter method for the data field r
+            StructureIsInitialize2&    set_r                  (long r);
+
+    // Setter method for the data field o
+            StructureIsInitialize2&    set_o                  (long o);
+
+    // Setter method for the data field d
+            StructureIsInitialize2&    set_d                  (long d);
+
+private:
+    // Returns unique bitmask value for the field r2
+    static int bitmask_r2();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r2
+    long mR2;
+};
+
+// StructureIsInitialize2Columns holds StructureIsInitialize2 objects
+// column by column - one contiguous array per data field. Use it for large
+// collections that are scanned one or two fields at a time. Such scan
+// touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureIsInitialize2Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                      Row     (const StructureIsInitialize2Columns& columns, size_t index);
+
+        // Getter method for the data field r
+                                             long     r       ()                                                           const;
+        // Returns true if the data field r is available in the row
+                                             bool     valid_r ()                                                           const;
+
+        // Getter method for the data field o
+                                             long     o       ()                                                           const;
+        // Returns true if the data field o is available in the row
+                                             bool     exist_o ()                                                           const;
+
+        // Getter method for the data field d
+                                             long     d       ()                                                           const;
+
+        // Getter method for the data field r2
+                                             long     r2      ()                                                           const;
+        // Returns true if the data field r2 is available in the row
+                                             bool     valid_r2()                                                           const;
+    private:
+        const StructureIsInitialize2Columns& mColumns;
+        size_t                               mIndex;
+    };
+
+    // Default constructor
+                             StructureIsInitialize2Columns ();
+    // Destructor
+                             ~StructureIsInitialize2Columns();
+
+    // Returns the number of the rows
+    size_t                   size                          ()                                     const;
+    // Returns true if there are no rows
+    bool                     empty                         ()                                     const;
+    // Reserves memory for size rows in every column
+    void                     reserve                       (size_t size);
+    // Removes all the rows
+    void                     clear                         ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                     (const StructureIsInitialize2& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                    (size_t index)                         const;
+
+    // Column of the data field r
+    const std::vector<long>& r                             ()                                     const;
+    // Availability bitmap of the data field r
+    const std::vector<bool>& valid_r                       ()                                     const;
+
+    // Column of the data field o
+    const std::vector<long>& o                             ()                                     const;
+    // Availability bitmap of the data field o
+    const std::vector<bool>& exist_o                       ()                                     const;
+
+    // Column of the data field d
+    const std::vector<long>& d                             ()                                     const;
+
+    // Column of the data field r2
+    const std::vector<long>& r2                            ()                                     const;
+    // Availability bitmap of the data field r2
+    const std::vector<bool>& valid_r2                      ()                                     const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // availability bitmap of the data field r
+    std::vector<bool> mRAvailability;
+    // column of the data field o
+    std::vector<long> mO;
+    // availability bitmap of the data field o
+    std::vector<bool> mOAvailability;
+    // column of the data field d
+    std::vector<long> mD;
+    // column of the data field r2
+    std::vector<long> mR2;
+    // availability bitmap of the data field r2
+    std::vector<bool> mR2Availability;
+};
+
+class StructureNonControlledInherit : public StructureIsInitialize
+{
+public:
+    // Default constructor
+                                               StructureNonControlledInherit ();
+    // Destructor
+    /*lax*/                                    ~StructureNonControlledInherit();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureNonControlledInheritSPtr  downcast                      (const StructureIsInitializeSPtr& object);
+    // shared_from_this is a helper method that overrides the
+    // shared_from_this method that is implemented in
+    // boost::enable_shared_from_this base class. The only purpose of this
+    // helper method is to eliminate the need of downcasting to shared_ptr
+    // to this class.
+            StructureNonControlledInheritSPtr  shared_from_this              ();
+    // This method is exactly the same as the previous one with exception
+    // that it allows shared_from_this to be called from const methods.
+            StructureNonControlledInheritSCPtr shared_from_this              ()                                        const;
+
+    // Setter method for the data field r
+            StructureNonControlledInherit&     set_r                         (long r);
+
+    // Setter method for the data field o
+            StructureNonControlledInherit&     set_o                         (long o);
+
+    // Setter method for the data field d
+            StructureNonControlledInherit&     set_d                         (long d);
+};
+
+// StructureNonControlledInheritColumns holds StructureNonControlledInherit
+// objects column by column - one contiguous array per data field. Use it
+// for large collections that are scanned one or two fields at a time. Such
+// scan touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureNonControlledInheritColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                             Row    (const StructureNonControlledInheritColumns& columns, size_t index);
+
+        // Getter method for the data field r
+                                                    long     r      ()                                                                  const;
+        // Returns true if the data field r is available in the row
+                                                    bool     valid_r()                                                                  const;
+
+        // Getter method for the data field o
+                                                    long     o      ()                                                                  const;
+        // Returns true if the data field o is available in the row
+                                                    bool     exist_o()                                                                  const;
+
+        // Getter method for the data field d
+                                                    long     d      ()                                                                  const;
+    private:
+        const StructureNonControlledInheritColumns& mColumns;
+        size_t                                      mIndex;
+    };
+
+    // Default constructor
+                             StructureNonControlledInheritColumns ();
+    // Destructor
+                             ~StructureNonControlledInheritColumns();
+
+    // Returns the number of the rows
+    size_t                   size                                 ()                                            const;
+    // Returns true if there are no rows
+    bool                     empty                                ()                                            const;
+    // Reserves memory for size rows in every column
+    void                     reserve                              (size_t size);
+    // Removes all the rows
+    void                     clear                                ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                            (const StructureNonControlledInherit& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                           (size_t index)                                const;
+
+    // Column of the data field r
+    const std::vector<long>& r                                    ()                                            const;
+    // Availability bitmap of the data field r
+    const std::vector<bool>& valid_r                              ()                                            const;
+
+    // Column of the data field o
+    const std::vector<long>& o                                    ()                                            const;
+    // Availability bitmap of the data field o
+    const std::vector<bool>& exist_o                              ()                                            const;
+
+    // Column of the data field d
+    const std::vector<long>& d                                    ()                                            const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // availability bitmap of the data field r
+    std::vector<bool> mRAvailability;
+    // column of the data field o
+    std::vector<long> mO;
+    // availability bitmap of the data field o
+    std::vector<bool> mOAvailability;
+    // column of the data field d
+    std::vector<long> mD;
+};
+
+class StructureIsInitialize3 : public StructureNonControlledInherit
+{
+public:
+    // Default constructor
+                                        StructureIsInitialize3 ();
+    // Destructor
+    /*lax*/                             ~StructureIsInitialize3();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize3SPtr  downcast               (const StructureIsInitializeSPtr& object);
+    // shared_from_this is a helper method that overrides the
+    // shared_from_this method that is implemented in
+    // boost::enable_shared_from_this base class. The only purpose of this
+    // helper method is to eliminate the need of downcasting to shared_ptr
+    // to this class.
+            StructureIsInitialize3SPtr  shared_from_this       ();
+    // This method is exactly the same as the previous one with exception
+    // that it allows shared_from_this to be called from const methods.
+            StructureIsInitialize3SCPtr shared_from_this       ()                                        const;
+
+    // Returns true if every required field is initialized.
+            bool                        isInitialized          ()                                        const;
+
+    // Getter method for the data field r3
+            long                        r3                     ()                                        const;
+    // Returns true if the data field r3 was set and could be considered
+    // valid
+            bool                        valid_r3               ()                                        const;
+    // Setter method for the data field r3
+            StructureIsInitialize3&     set_r3                 (long r3);
+    // Erases the required data field r3. Object can not be instantiated
+    // before the field data is set again
+            void                        erase_r3               ();
+
+    // Setter method for the data field r
+            StructureIsInitialize3&     set_r                  (long r);
+
+    // Setter method for the data field o
+            StructureIsInitialize3&     set_o                  (long o);
+
+    // Setter method for the data field d
+            StructureIsInitialize3&     set_d                  (long d);
+
+private:
+    // Returns unique bitmask value for the field r3
+    static int bitmask_r3();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r3
+    long mR3;
+};
+
+// StructureIsInitialize3Columns holds StructureIsInitialize3 objects
+// column by column - one contiguous array per data field. Use it for large
+// collections that are scanned one or two fields at a time. Such scan
+// touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureIsInitialize3Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                      Row     (const StructureIsInitialize3Columns& columns, size_t index);
+
+        // Getter method for the data field r
+                                             long     r       ()                                                           const;
+        // Returns true if the data field r is available in the row
+                                             bool     valid_r ()                                                           const;
+
+        // Getter method for the data field o
+                                             long     o       ()                                                           const;
+        // Returns true if the data field o is available in the row
+                                             bool     exist_o ()                                                           const;
+
+        // Getter method for the data field d
+                                             long     d       ()                                                           const;
+
+        // Getter method for the data field r3
+                                             long     r3      ()                                                           const;
+        // Returns true if the data field r3 is available in the row
+                                             bool     valid_r3()                                                           const;
+    private:
+        const StructureIsInitialize3Columns& mColumns;
+        size_t                               mIndex;
+    };
+
+    // Default constructor
+                             StructureIsInitialize3Columns ();
+    // Destructor
+                             ~StructureIsInitialize3Columns();
+
+    // Returns the number of the rows
+    size_t                   size                          ()                                     const;
+    // Returns true if there are no rows
+    bool                     empty                         ()                                     const;
+    // Reserves memory for size rows in every column
+    void                     reserve                       (size_t size);
+    // Removes all the rows
+    void                     clear                         ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                     (const StructureIsInitialize3& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                    (size_t index)                         const;
+
+    // Column of the data field r
+    const std::vector<long>& r                             ()                                     const;
+    // Availability bitmap of the data field r
+    const std::vector<bool>& valid_r                       ()                                     const;
+
+    // Column of the data field o
+    const std::vector<long>& o                             ()                                     const;
+    // Availability bitmap of the data field o
+    const std::vector<bool>& exist_o                       ()                                     const;
+
+    // Column of the data field d
+    const std::vector<long>& d                             ()                                     const;
+
+    // Column of the data field r3
+    const std::vector<long>& r3                            ()                                     const;
+    // Availability bitmap of the data field r3
+    const std::vector<bool>& valid_r3                      ()                                     const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // availability bitmap of the data field r
+    std::vector<bool> mRAvailability;
+    // column of the data field o
+    std::vector<long> mO;
+    // availability bitmap of the data field o
+    std::vector<bool> mOAvailability;
+    // column of the data field d
+    std::vector<long> mD;
+    // column of the data field r3
+    std::vector<long> mR3;
+    // availability bitmap of the data field r3
+    std::vector<bool> mR3Availability;
+};
+
+class StructureNonControlled : public StructureIsInitialize
+{
+public:
+    // Default constructor
+                                       StructureNonControlled ();
+    // Destructor
+    /*lax*/                            ~StructureNonControlled();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureNonControlledSPtr downcast               (const StructureIsInitializeSPtr& object);
+
+    // Setter method for the data field r
+            StructureNonControlled&    set_r                  (long r);
+
+    // Setter method for the data field o
+            StructureNonControlled&    set_o                  (long o);
+
+    // Setter method for the data field d
+            StructureNonControlled&    set_d                  (long d);
+};
+
+// StructureNonControlledColumns holds StructureNonControlled objects
+// column by column - one contiguous array per data field. Use it for large
+// collections that are scanned one or two fields at a time. Such scan
+// touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureNonControlledColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                      Row    (const StructureNonControlledColumns& columns, size_t index);
+
+        // Getter method for the data field r
+                                             long     r      ()                                                           const;
+        // Returns true if the data field r is available in the row
+                                             bool     valid_r()                                                           const;
+
+        // Getter method for the data field o
+                                             long     o      ()                                                           const;
+        // Returns true if the data field o is available in the row
+                                             bool     exist_o()                                                           const;
+
+        // Getter method for the data field d
+                                             long     d      ()                                                           const;
+    private:
+        const StructureNonControlledColumns& mColumns;
+        size_t                               mIndex;
+    };
+
+    // Default constructor
+                             StructureNonControlledColumns ();
+    // Destructor
+                             ~StructureNonControlledColumns();
+
+    // Returns the number of the rows
+    size_t                   size                          ()                                     const;
+    // Returns true if there are no rows
+    bool                     empty                         ()                                     const;
+    // Reserves memory for size rows in every column
+    void                     reserve                       (size_t size);
+    // Removes all the rows
+    void                     clear                         ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                     (const StructureNonControlled& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                    (size_t index)                         const;
+
+    // Column of the data field r
+    const std::vector<long>& r                             ()                                     const;
+    // Availability bitmap of the data field r
+    const std::vector<bool>& valid_r                       ()                                     const;
+
+    // Column of the data field o
+    const std::vector<long>& o                             ()                                     const;
+    // Availability bitmap of the data field o
+    const std::vector<bool>& exist_o                       ()                                     const;
+
+    // Column of the data field d
+    const std::vector<long>& d                             ()                                     const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // availability bitmap of the data field r
+    std::vector<bool> mRAvailability;
+    // column of the data field o
+    std::vector<long> mO;
+    // availability bitmap of the data field o
+    std::vector<bool> mOAvailability;
+    // column of the data field d
+    std::vector<long> mD;
+};
+
+class StructureIsInitialize4 : public StructureNonControlled
+{
+public:
+    // Default constructor
+                                       StructureIsInitialize4 ();
+    // Destructor
+    /*lax*/                            ~StructureIsInitialize4();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize4SPtr downcast               (const StructureIsInitializeSPtr& object);
+
+    // Returns true if every required field is initialized.
+            bool                       isInitialized          ()                                        const;
+
+    // Getter method for the data field r4
+            long                       r4                     ()                                        const;
+    // Returns true if the data field r4 was set and could be considered
+    // valid
+            bool                       valid_r4               ()                                        const;
+    // Setter method for the data field r4
+            StructureIsInitialize4&    set_r4                 (long r4);
+    // Erases the required data field r4. Object can not be instantiated
+    // before the field data is set again
+            void                       erase_r4               ();
+
+    // Setter method for the data field r
+            StructureIsInitialize4&    set_r                  (long r);
+
+    // Setter method for the data field o
+            StructureIsInitialize4&    set_o                  (long o);
+
+    // Setter method for the data field d
+            StructureIsInitialize4&    set_d                  (long d);
+
+private:
+    // Returns unique bitmask value for the field r4
+    static int bitmask_r4();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r4
+    long mR4;
+};
+
+// StructureIsInitialize4Columns holds StructureIsInitialize4 objects
+// column by column - one contiguous array per data field. Use it for large
+// collections that are scanned one or two fields at a time. Such scan
+// touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureIsInitialize4Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                      Row     (const StructureIsInitialize4Columns& columns, size_t index);
+
+        // Getter method for the data field r
+                                             long     r       ()                                                           const;
+        // Returns true if the data field r is available in the row
+                                             bool     valid_r ()                                                           const;
+
+        // Getter method for the data field o
+                                             long     o       ()                                                           const;
+        // Returns true if the data field o is available in the row
+                                             bool     exist_o ()                                                           const;
+
+        // Getter method for the data field d
+                                             long     d       ()                                                           const;
+
+        // Getter method for the data field r4
+                                             long     r4      ()                                                           const;
+        // Returns true if the data field r4 is available in the row
+                                             bool     valid_r4()                                                           const;
+    private:
+        const StructureIsInitialize4Columns& mColumns;
+        size_t                               mIndex;
+    };
+
+    // Default constructor
+                             StructureIsInitialize4Columns ();
+    // Destructor
+                             ~StructureIsInitialize4Columns();
+
+    // Returns the number of the rows
+    size_t                   size                          ()                                     const;
+    // Returns true if there are no rows
+    bool                     empty                         ()                                     const;
+    // Reserves memory for size rows in every column
+    void                     reserve                       (size_t size);
+    // Removes all the rows
+    void                     clear                         ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                     (const StructureIsInitialize4& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                    (size_t index)                         const;
+
+    // Column of the data field r
+    const std::vector<long>& r                             ()                                     const;
+    // Availability bitmap of the data field r
+    const std::vector<bool>& valid_r                       ()                                     const;
+
+    // Column of the data field o
+    const std::vector<long>& o                             ()                                     const;
+    // Availability bitmap of the data field o
+    const std::vector<bool>& exist_o                       ()                                     const;
+
+    // Column of the data field d
+    const std::vector<long>& d                             ()                                     const;
+
+    // Column of the data field r4
+    const std::vector<long>& r4                            ()                                     const;
+    // Availability bitmap of the data field r4
+    const std::vector<bool>& valid_r4                      ()                                     const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // availability bitmap of the data field r
+    std::vector<bool> mRAvailability;
+    // column of the data field o
+    std::vector<long> mO;
+    // availability bitmap of the data field o
+    std::vector<bool> mOAvailability;
+    // column of the data field d
+    std::vector<long> mD;
+    // column of the data field r4
+    std::vector<long> mR4;
+    // availability bitmap of the data field r4
+    std::vector<bool> mR4Availability;
+};
+
+class StructureIsInitializeVirtual
+{
+public:
+    // Default constructor
+                                            StructureIsInitializeVirtual         ();
+    // Destructor
+    virtual                                 ~StructureIsInitializeVirtual        ();
+
+    // Returns true if every required field is initialized.
+    virtual bool                            isInitialized                        ()       const;
+
+    // Identifier for the objects from StructureIsInitializeVirtual class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructureIsInitializeVirtualId staticStructureIsInitializeVirtualId ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructureIsInitializeVirtualId runtimeStructureIsInitializeVirtualId()       const;
+
+    // Getter method for the data field r
+            long                            r                                    ()       const;
+    // Returns true if the data field r was set and could be considered
+    // valid
+            bool                            valid_r                              ()       const;
+    // Setter method for the data field r
+            StructureIsInitializeVirtual&   set_r                                (long r);
+    // Erases the required data field r. Object can not be instantiated
+    // before the field data is set again
+            void                            erase_r                              ();
+
+private:
+    // Returns unique bitmask value for the field r
+    static int bitmask_r();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r
+    long mR;
+};
+
+// StructureIsInitializeVirtualColumns holds StructureIsInitializeVirtual
+// objects column by column - one contiguous array per data field. Use it
+// for large collections that are scanned one or two fields at a time. Such
+// scan touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureIsInitializeVirtualColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                            Row    (const StructureIsInitializeVirtualColumns& columns, size_t index);
+
+        // Getter method for the data field r
+                                                   long     r      ()                                                                 const;
+        // Returns true if the data field r is available in the row
+                                                   bool     valid_r()                                                                 const;
+    private:
+        const StructureIsInitializeVirtualColumns& mColumns;
+        size_t                                     mIndex;
+    };
+
+    // Default constructor
+                             StructureIsInitializeVirtualColumns ();
+    // Destructor
+                             ~StructureIsInitializeVirtualColumns();
+
+    // Returns the number of the rows
+    size_t                   size                                ()                                           const;
+    // Returns true if there are no rows
+    bool                     empty                               ()                                           const;
+    // Reserves memory for size rows in every column
+    void                     reserve                             (size_t size);
+    // Removes all the rows
+    void                     clear                               ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                           (const StructureIsInitializeVirtual& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                          (size_t index)                               const;
+
+    // Column of the data field r
+    const std::vector<long>& r                                   ()                                           const;
+    // Availability bitmap of the data field r
+    const std::vector<bool>& valid_r                             ()                                           const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // availability bitmap of the data field r
+    std::vector<bool> mRAvailability;
+};
+
+class StructureNonControlledVirtualInherit : public StructureIsInitializeVirtual
+{
+public:
+    // Default constructor
+                                                     StructureNonControlledVirtualInherit ();
+    // Destructor
+    virtual                                          ~StructureNonControlledVirtualInherit();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureNonControlledVirtualInheritSPtr downcast                             (const StructureIsInitializeVirtualSPtr& object);
+
+    // Setter method for the data field r
+            StructureNonControlledVirtualInherit&    set_r                                (long r);
+};
+
+// StructureNonControlledVirtualInheritColumns holds
+// StructureNonControlledVirtualInherit objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureNonControlledVirtualInheritColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                                    Row    (const StructureNonControlledVirtualInheritColumns& columns, size_t index);
+
+        // Getter method for the data field r
+                                                           long     r      ()                                                                         const;
+        // Returns true if the data field r is available in the row
+                                                           bool     valid_r()                                                                         const;
+    private:
+        const StructureNonControlledVirtualInheritColumns& mColumns;
+        size_t                                             mIndex;
+    };
+
+    // Default constructor
+                             StructureNonControlledVirtualInheritColumns ();
+    // Destructor
+                             ~StructureNonControlledVirtualInheritColumns();
+
+    // Returns the number of the rows
+    size_t                   size                                        ()                                                   const;
+    // Returns true if there are no rows
+    bool                     empty                                       ()                                                   const;
+    // Reserves memory for size rows in every column
+    void                     reserve                                     (size_t size);
+    // Removes all the rows
+    void                     clear                                       ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                                   (const StructureNonControlledVirtualInherit& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                                  (size_t index)                                       const;
+
+    // Column of the data field r
+    const std::vector<long>& r                                           ()                                                   const;
+    // Availability bitmap of the data field r
+    const std::vector<bool>& valid_r                                     ()                                                   const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // availability bitmap of the data field r
+    std::vector<bool> mRAvailability;
+};
+
+class StructureIsInitialize5 : public StructureNonControlledVirtualInherit
+{
+public:
+    // Default constructor
+                                       StructureIsInitialize5 ();
+    // Destructor
+    virtual                            ~StructureIsInitialize5();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize5SPtr downcast               (const StructureIsInitializeVirtualSPtr& object);
+
+    // Returns true if every required field is initialized.
+    virtual bool                       isInitialized          ()                                               const;
+
+    // Getter method for the data field r5
+            long                       r5                     ()                                               const;
+    // Returns true if the data field r5 was set and could be considered
+    // valid
+            bool                       valid_r5               ()                                               const;
+    // Setter method for the data field r5
+            StructureIsInitialize5&    set_r5                 (long r5);
+    // Erases the required data field r5. Object can not be instantiated
+    // before the field data is set again
+            void                       erase_r5               ();
+
+    // Setter method for the data field r
+            StructureIsInitialize5&    set_r                  (long r);
+
+private:
+    // Returns unique bitmask value for the field r5
+    static int bitmask_r5();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r5
+    long mR5;
+};
+
+// StructureIsInitialize5Columns holds StructureIsInitialize5 objects
+// column by column - one contiguous array per data field. Use it for large
+// collections that are scanned one or two fields at a time. Such scan
+// touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureIsInitialize5Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                      Row     (const StructureIsInitialize5Columns& columns, size_t index);
+
+        // Getter method for the data field r
+                                             long     r       ()                                                           const;
+        // Returns true if the data field r is available in the row
+                                             bool     valid_r ()                                                           const;
+
+        // Getter method for the data field r5
+                                             long     r5      ()                                                           const;
+        // Returns true if the data field r5 is available in the row
+                                             bool     valid_r5()                                                           const;
+    private:
+        const StructureIsInitialize5Columns& mColumns;
+        size_t                               mIndex;
+    };
+
+    // Default constructor
+                             StructureIsInitialize5Columns ();
+    // Destructor
+                             ~StructureIsInitialize5Columns();
+
+    // Returns the number of the rows
+    size_t                   size                          ()                                     const;
+    // Returns true if there are no rows
+    bool                     empty                         ()                                     const;
+    // Reserves memory for size rows in every column
+    void                     reserve                       (size_t size);
+    // Removes all the rows
+    void                     clear                         ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                     (const StructureIsInitialize5& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                    (size_t index)                         const;
+
+    // Column of the data field r
+    const std::vector<long>& r                             ()                                     const;
+    // Availability bitmap of the data field r
+    const std::vector<bool>& valid_r                       ()                                     const;
+
+    // Column of the data field r5
+    const std::vector<long>& r5                            ()                                     const;
+    // Availability bitmap of the data field r5
+    const std::vector<bool>& valid_r5                      ()                                     const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // availability bitmap of the data field r
+    std::vector<bool> mRAvailability;
+    // column of the data field r5
+    std::vector<long> mR5;
+    // availability bitmap of the data field r5
+    std::vector<bool> mR5Availability;
+};
+
+class StructureNonControlledVirtual
+{
+public:
+    // Default constructor
+                                             StructureNonControlledVirtual         ();
+    // Destructor
+    virtual                                  ~StructureNonControlledVirtual        ();
+
+    // Identifier for the objects from StructureNonControlledVirtual class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EStructureNonControlledVirtualId staticStructureNonControlledVirtualId ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EStructureNonControlledVirtualId runtimeStructureNonControlledVirtualId()       const;
+
+    // Getter method for the data field r
+            long                             r                                     ()       const;
+    // Setter method for the data field r
+            StructureNonControlledVirtual&   set_r                                 (long r);
+
+private:
+    // variable for the data field r
+    long mR;
+};
+
+// StructureNonControlledVirtualColumns holds StructureNonControlledVirtual
+// objects column by column - one contiguous array per data field. Use it
+// for large collections that are scanned one or two fields at a time. Such
+// scan touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureNonControlledVirtualColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                             Row(const StructureNonControlledVirtualColumns& columns, size_t index);
+
+        // Getter method for the data field r
+                                                    long     r  ()                                                                  const;
+    private:
+        const StructureNonControlledVirtualColumns& mColumns;
+        size_t                                      mIndex;
+    };
+
+    // Default constructor
+                             StructureNonControlledVirtualColumns ();
+    // Destructor
+                             ~StructureNonControlledVirtualColumns();
+
+    // Returns the number of the rows
+    size_t                   size                                 ()                                            const;
+    // Returns true if there are no rows
+    bool                     empty                                ()                                            const;
+    // Reserves memory for size rows in every column
+    void                     reserve                              (size_t size);
+    // Removes all the rows
+    void                     clear                                ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                            (const StructureNonControlledVirtual& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                           (size_t index)                                const;
+
+    // Column of the data field r
+    const std::vector<long>& r                                    ()                                            const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+};
+
+class StructureIsInitialize6 : public StructureNonControlledVirtual
+{
+public:
+    // Default constructor
+                                       StructureIsInitialize6 ();
+    // Destructor
+    virtual                            ~StructureIsInitialize6();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsInitialize6SPtr downcast               (const StructureNonControlledVirtualSPtr& object);
+
+    // Returns true if every required field is initialized.
+    virtual bool                       isInitialized          ()                                                const;
+
+    // Getter method for the data field r6
+            long                       r6                     ()                                                const;
+    // Returns true if the data field r6 was set and could be considered
+    // valid
+            bool                       valid_r6               ()                                                const;
+    // Setter method for the data field r6
+            StructureIsInitialize6&    set_r6                 (long r6);
+    // Erases the required data field r6. Object can not be instantiated
+    // before the field data is set again
+            void                       erase_r6               ();
+
+    // Setter method for the data field r
+            StructureIsInitialize6&    set_r                  (long r);
+
+private:
+    // Returns unique bitmask value for the field r6
+    static int bitmask_r6();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field r6
+    long mR6;
+};
+
+// StructureIsInitialize6Columns holds StructureIsInitialize6 objects
+// column by column - one contiguous array per data field. Use it for large
+// collections that are scanned one or two fields at a time. Such scan
+// touches only the memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureIsInitialize6Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                      Row     (const StructureIsInitialize6Columns& columns, size_t index);
+
+        // Getter method for the data field r
+                                             long     r       ()                                                           const;
+
+        // Getter method for the data field r6
+                                             long     r6      ()                                                           const;
+        // Returns true if the data field r6 is available in the row
+                                             bool     valid_r6()                                                           const;
+    private:
+        const StructureIsInitialize6Columns& mColumns;
+        size_t                               mIndex;
+    };
+
+    // Default constructor
+                             StructureIsInitialize6Columns ();
+    // Destructor
+                             ~StructureIsInitialize6Columns();
+
+    // Returns the number of the rows
+    size_t                   size                          ()                                     const;
+    // Returns true if there are no rows
+    bool                     empty                         ()                                     const;
+    // Reserves memory for size rows in every column
+    void                     reserve                       (size_t size);
+    // Removes all the rows
+    void                     clear                         ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back                     (const StructureIsInitialize6& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]                    (size_t index)                         const;
+
+    // Column of the data field r
+    const std::vector<long>& r                             ()                                     const;
+
+    // Column of the data field r6
+    const std::vector<long>& r6                            ()                                     const;
+    // Availability bitmap of the data field r6
+    const std::vector<bool>& valid_r6                      ()                                     const;
+
+private:
+    // column of the data field r
+    std::vector<long> mR;
+    // column of the data field r6
+    std::vector<long> mR6;
+    // availability bitmap of the data field r6
+    std::vector<bool> mR6Availability;
+};
+
+class StructureIsVoid
+{
+public:
+    // Default constructor
+                             StructureIsVoid ();
+    // Destructor
+    /*lax*/                  ~StructureIsVoid();
+
+    // Returns true if every required field is initialized.
+            bool             isInitialized   ()       const;
+
+            bool             isVoid          ()       const;
+
+    // Getter method for the data field o
+            long             o               ()       const;
+    // Checks if the optional field o exists
+            bool             exist_o         ()       const;
+    // Setter method for the data field o
+            StructureIsVoid& set_o           (long o);
+    // Clears the optional data field o
+            void             clear_o         ();
+
+private:
+    // Returns unique bitmask value for the field o
+    static int bitmask_o();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field o
+    long mO;
+};
+
+// StructureIsVoidColumns holds StructureIsVoid objects column by column -
+// one contiguous array per data field. Use it for large collections that
+// are scanned one or two fields at a time. Such scan touches only the
+// memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureIsVoidColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                               Row    (const StructureIsVoidColumns& columns, size_t index);
+
+        // Getter method for the data field o
+                                      long     o      ()                                                    const;
+        // Returns true if the data field o is available in the row
+                                      bool     exist_o()                                                    const;
+    private:
+        const StructureIsVoidColumns& mColumns;
+        size_t                        mIndex;
+    };
+
+    // Default constructor
+                             StructureIsVoidColumns ();
+    // Destructor
+                             ~StructureIsVoidColumns();
+
+    // Returns the number of the rows
+    size_t                   size                   ()                              const;
+    // Returns true if there are no rows
+    bool                     empty                  ()                              const;
+    // Reserves memory for size rows in every column
+    void                     reserve                (size_t size);
+    // Removes all the rows
+    void                     clear                  ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back              (const StructureIsVoid& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]             (size_t index)                  const;
+
+    // Column of the data field o
+    const std::vector<long>& o                      ()                              const;
+    // Availability bitmap of the data field o
+    const std::vector<bool>& exist_o                ()                              const;
+
+private:
+    // column of the data field o
+    std::vector<long> mO;
+    // availability bitmap of the data field o
+    std::vector<bool> mOAvailability;
+};
+
+class StructureIsVoid1 : public StructureIsVoid
+{
+public:
+    // Default constructor
+                                 StructureIsVoid1 ();
+    // Destructor
+    /*lax*/                      ~StructureIsVoid1();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureIsVoid1SPtr downcast         (const StructureIsVoidSPtr& object);
+
+    // Returns true if every required field is initialized.
+            bool                 isInitialized    ()                                  const;
+
+            bool                 isVoid           ()                                  const;
+
+    // Getter method for the data field o1
+            long                 o1               ()                                  const;
+    // Checks if the optional field o1 exists
+            bool                 exist_o1         ()                                  const;
+    // Setter method for the data field o1
+            StructureIsVoid1&    set_o1           (long o1);
+    // Clears the optional data field o1
+            void                 clear_o1         ();
+
+    // Setter method for the data field o
+            StructureIsVoid1&    set_o            (long o);
+
+private:
+    // Returns unique bitmask value for the field o1
+    static int bitmask_o1();
+
+    // Stores availability information for the fields
+    int  mBits;
+
+    // variable for the data field o1
+    long mO1;
+};
+
+// StructureIsVoid1Columns holds StructureIsVoid1 objects column by column
+// - one contiguous array per data field. Use it for large collections that
+// are scanned one or two fields at a time. Such scan touches only the
+// memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class StructureIsVoid1Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                Row     (const StructureIsVoid1Columns& columns, size_t index);
+
+        // Getter method for the data field o
+                                       long     o       ()                                                     const;
+        // Returns true if the data field o is available in the row
+                                       bool     exist_o ()                                                     const;
+
+        // Getter method for the data field o1
+                                       long     o1      ()                                                     const;
+        // Returns true if the data field o1 is available in the row
+                                       bool     exist_o1()                                                     const;
+    private:
+        const StructureIsVoid1Columns& mColumns;
+        size_t                         mIndex;
+    };
+
+    // Default constructor
+                             StructureIsVoid1Columns ();
+    // Destructor
+                             ~StructureIsVoid1Columns();
+
+    // Returns the number of the rows
+    size_t                   size                    ()                               const;
+    // Returns true if there are no rows
+    bool                     empty                   ()                               const;
+    // Reserves memory for size rows in every column
+    void                     reserve                 (size_t size);
+    // Removes all the rows
+    void                     clear                   ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back               (const StructureIsVoid1& object);
+
+    // Returns proxy of the row index
+    Row                      operator[]              (size_t index)                   const;
+
+    // Column of the data field o
+    const std::vector<long>& o                       ()                               const;
+    // Availability bitmap of the data field o
+    const std::vector<bool>& exist_o                 ()                               const;
+
+    // Column of the data field o1
+    const std::vector<long>& o1                      ()                               const;
+    // Availability bitmap of the data field o1
+    const std::vector<bool>& exist_o1                ()                               const;
+
+private:
+    // column of the data field o
+    std::vector<long> mO;
+    // availability bitmap of the data field o
+    std::vector<bool> mOAvailability;
+    // column of the data field o1
+    std::vector<long> mO1;
+    // availability bitmap of the data field o1
+    std::vector<bool> mO1Availability;
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EStructureIsInitializeVirtualId
+{
+public:
+    // Default constructor - sets the value to invalid
+                                             EStructureIsInitializeVirtualId();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit                                 EStructureIsInitializeVirtualId(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long                            value                          ()                                              const;
+    // Returns short name for a specified enum value
+    static   const char*                     shortName                      (long value);
+    // Returns short name of the enum value
+             const char*                     shortName                      ()                                              const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   EStructureIsInitializeVirtualId fromString                     (const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool                            operator==                     (const EStructureIsInitializeVirtualId& rValue) const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool                            operator!=                     (const EStructureIsInitializeVirtualId& rValue) const;
+
+    // static methods for enum class objects
+    static const EStructureIsInitializeVirtualId invalid                     ();
+    static const EStructureIsInitializeVirtualId structureIsInitializeVirtual();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid                      = 0,
+        kStructureIsInitializeVirtual = 1,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class StructureIsInitializeVirtualFactory
+{
+public:
+    static StructureIsInitializeVirtualSPtr clone(const StructureIsInitializeVirtualSPtr& object);
+
+    // Clones all the objects, preserving their order. The objects of the
+    // same type are copied together in a contiguous slab. The slab and all
+    // its clones are released with the last of them, a surviving clone
+    // keeps its siblings alive without running their destructors.
+    static std::vector<StructureIsInitializeVirtualSPtr> cloneAll(const std::vector<StructureIsInitializeVirtualSPtr>& objects);
+};
+
+// Static visitor of the StructureIsInitializeVirtual hierarchy. The accept
+// method dispatches the object with a single indirect call through a table
+// indexed by its runtime identification. The derived visitor overrides
+// visit for the structures it handles and brings the rest in scope with a
+// using declaration. The visits it does not override fall back to the
+// visit of the nearest identified base structure.
+template<class Derived, class Result = void>
+class StructureIsInitializeVirtualVisitor
+{
+public:
+    Result accept(const StructureIsInitializeVirtualSPtr& object)
+    {
+        typedef Result (*Thunk)(Derived&, const StructureIsInitializeVirtualSPtr&);
+        // the table follows the values of the identification enumeration
+        static const Thunk thunks[] =
+        {
+            &thunk<StructureIsInitializeVirtual>,
+            &thunk<StructureIsInitializeVirtual>,
+        };
+        return thunks[object->runtimeStructureIsInitializeVirtualId().value()](static_cast<Derived&>(*this), object);
+    }
+
+    Result visit(const StructureIsInitializeVirtualSPtr&)
+    {
+        return Result();
+    }
+
+protected:
+    ~StructureIsInitializeVirtualVisitor()
+    {
+    }
+
+private:
+    template<class T>
+    static Result thunk(Derived& visitor, const StructureIsInitializeVirtualSPtr& object)
+    {
+        return visitor.visit(boost::static_pointer_cast<T>(object));
+    }
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EStructureNonControlledVirtualId
+{
+public:
+    // Default constructor - sets the value to invalid
+                                              EStructureNonControlledVirtualId();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit                                  EStructureNonControlledVirtualId(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long                             value                           ()                                               const;
+    // Returns short name for a specified enum value
+    static   const char*                      shortName                       (long value);
+    // Returns short name of the enum value
+             const char*                      shortName                       ()                                               const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   EStructureNonControlledVirtualId fromString                      (const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool                             operator==                      (const EStructureNonControlledVirtualId& rValue) const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool                             operator!=                      (const EStructureNonControlledVirtualId& rValue) const;
+
+    // static methods for enum class objects
+    static const EStructureNonControlledVirtualId invalid                      ();
+    static const EStructureNonControlledVirtualId structureNonControlledVirtual();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid                       = 0,
+        kStructureNonControlledVirtual = 1,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class StructureNonControlledVirtualFactory
+{
+public:
+    static StructureNonControlledVirtualSPtr clone(const StructureNonControlledVirtualSPtr& object);
+
+    // Clones all the objects, preserving their order. The objects of the
+    // same type are copied together in a contiguous slab. The slab and all
+    // its clones are released with the last of them, a surviving clone
+    // keeps its siblings alive without running their destructors.
+    static std::vector<StructureNonControlledVirtualSPtr> cloneAll(const std::vector<StructureNonControlledVirtualSPtr>& objects);
+};
+
+// Static visitor of the StructureNonControlledVirtual hierarchy. The
+// accept method dispatches the object with a single indirect call through
+// a table indexed by its runtime identification. The derived visitor
+// overrides visit for the structures it handles and brings the rest in
+// scope with a using declaration. The visits it does not override fall
+// back to the visit of the nearest identified base structure.
+template<class Derived, class Result = void>
+class StructureNonControlledVirtualVisitor
+{
+public:
+    Result accept(const StructureNonControlledVirtualSPtr& object)
+    {
+        typedef Result (*Thunk)(Derived&, const StructureNonControlledVirtualSPtr&);
+        // the table follows the values of the identification enumeration
+        static const Thunk thunks[] =
+        {
+            &thunk<StructureNonControlledVirtual>,
+            &thunk<StructureNonControlledVirtual>,
+        };
+        return thunks[object->runtimeStructureNonControlledVirtualId().value()](static_cast<Derived&>(*this), object);
+    }
+
+    Result visit(const StructureNonControlledVirtualSPtr&)
+    {
+        return Result();
+    }
+
+protected:
+    ~StructureNonControlledVirtualVisitor()
+    {
+    }
+
+private:
+    template<class T>
+    static Result thunk(Derived& visitor, const StructureNonControlledVirtualSPtr& object)
+    {
+        return visitor.visit(boost::static_pointer_cast<T>(object));
+    }
+};
+
+// StructureBase is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class StructureBase
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                 operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                     Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                     Builder  (const StructureBase& object);
+        // Destructor of Builder
+        /*lax*/                      ~Builder ();
+
+        // Instantiates StructureBase instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const StructureBase& build    ()                            const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                StructureBaseSPtr    finalize ();
+
+
+    protected:
+        // constructor needed from potential derived classes
+                                     Builder  (StructureBaseRPtr pObject);
+
+        StructureBaseRPtr mpObject;
+    };
+
+    // Default constructor
+            StructureBase ();
+    // Destructor
+    /*lax*/ ~StructureBase();
+};
+
+// Holder of the current StructureBase shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<StructureBase> StructureBaseSnapshot;
+
+// StructureAbstract is an immutable class - once instantiated none of the
+// data fields can be changed. For the initial initialization and
+// instantiation use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class StructureAbstract : public StructureBase
+{
+public:
+    // Default constructor
+                                  StructureAbstract ();
+    // Destructor
+    /*lax*/                       ~StructureAbstract();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureAbstractSPtr downcast          (const StructureBaseSPtr& object);
+};
+
+// Holder of the current StructureAbstract shared between threads. The
+// readers get the current object wait-free through a view, the writers
+// publish the results of Builder::finalize(). It needs the core snapshot
+// header.
+typedef snapshot<StructureAbstract> StructureAbstractSnapshot;
+
+// StructureLeaf is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class StructureLeaf : public StructureAbstract
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder : public StructureAbstract::Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                 operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                     Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                     Builder  (const StructureLeaf& object);
+        // Destructor of Builder
+        /*lax*/                      ~Builder ();
+
+        // Instantiates StructureLeaf instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const StructureLeaf& build    ()                            const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                StructureLeafSPtr    finalize ();
+
+
+    protected:
+        // constructor needed from potential derived classes
+                                     Builder  (StructureLeafRPtr pObject);
+    };
+
+    // Default constructor
+                              StructureLeaf ();
+    // Destructor
+    /*lax*/                   ~StructureLeaf();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  StructureLeafSPtr downcast      (const StructureBaseSPtr& object);
+};
+
+// Holder of the current StructureLeaf shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<StructureLeaf> StructureLeafSnapshot;
+
+}
+
+#endif // __STRUCTURE_SANITY_COMPIL_H_
+
@@ -0,0 +1,21 @@
+#ifndef __STRUCTURE_SNAPSHOT_COMPIL__FWD_H_
+#define __STRUCTURE_SNAPSHOT_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace configuration
+{
+
+// Forward declarations
+class Configuration;
+typedef Configuration*                         ConfigurationRPtr;
+typedef boost::shared_ptr<Configuration>       ConfigurationSPtr;
+typedef boost::shared_ptr<const Configuration> ConfigurationSCPtr;
+typedef boost::weak_ptr<Configuration>         ConfigurationWPtr;
+
+}
+
+#endif // __STRUCTURE_SNAPSHOT_COMPIL__FWD_H_
+
@@ -0,0 +1,177 @@
+// Standard Template Library
+#include <string>
+
+#include "structure/snapshot.h"
+// Standard C Library
+#include <stddef.h>
+
+namespace configuration
+{
+
+Configuration::Builder::Builder()
+        : mpObject(new Configuration())
+{
+}
+
+Configuration::Builder::Builder(const Configuration& object)
+        : mpObject(new Configuration())
+{
+    *(Configuration*)mpObject = object;
+}
+
+Configuration::Builder::Builder(ConfigurationRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Configuration::Builder::~Builder()
+{
+    delete (ConfigurationRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Configuration& Configuration::Builder::build() const
+{
+    return *(ConfigurationRPtr)mpObject;
+}
+
+ConfigurationSPtr Configuration::Builder::finalize()
+{
+    ConfigurationRPtr objectRPtr = (ConfigurationRPtr)mpObject;
+    mpObject = NULL;
+    return ConfigurationSPtr(objectRPtr);
+}
+
+Configuration::Configuration()
+{
+}
+
+Configuration::~Configuration()
+{
+}
+
+long Configuration::revision() const
+{
+    return mRevision;
+}
+
+Configuration::Builder& Configuration::Builder::set_revision(long revision)
+{
+    mpObject->mRevision = revision;
+    return *this;
+}
+
+long Configuration::limit() const
+{
+    return mLimit;
+}
+
+Configuration::Builder& Configuration::Builder::set_limit(long limit)
+{
+    mpObject->mLimit = limit;
+    return *this;
+}
+
+const std::string& Configuration::name() const
+{
+    return mName;
+}
+
+Configuration::Builder& Configuration::Builder::set_name(const std::string& name)
+{
+    mpObject->mName = name;
+    return *this;
+}
+
+std::string& Configuration::Builder::mutable_name()
+{
+    return mpObject->mName.mutate();
+}
+
+ConfigurationColumns::Row::Row(const ConfigurationColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long ConfigurationColumns::Row::revision() const
+{
+    return mColumns.revision()[mIndex];
+}
+
+long ConfigurationColumns::Row::limit() const
+{
+    return mColumns.limit()[mIndex];
+}
+
+const std::string& ConfigurationColumns::Row::name() const
+{
+    return mColumns.name()[mIndex];
+}
+
+ConfigurationColumns::ConfigurationColumns()
+{
+}
+
+ConfigurationColumns::~ConfigurationColumns()
+{
+}
+
+size_t ConfigurationColumns::size() const
+{
+    return mRevision.size();
+}
+
+bool ConfigurationColumns::empty() const
+{
+    return mRevision.empty();
+}
+
+void ConfigurationColumns::reserve(size_t size)
+{
+    mRevision.reserve(size);
+    mLimit.reserve(size);
+    mName.reserve(size);
+}
+
+void ConfigurationColumns::clear()
+{
+    mRevision.clear();
+    mLimit.clear();
+    mName.clear();
+}
+
+void ConfigurationColumns::push_back(const Configuration& object)
+{
+    mRevision.push_back(object.revision());
+    mLimit.push_back(object.limit());
+    mName.push_back(object.name());
+}
+
+void ConfigurationColumns::push_back(const Configuration::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+ConfigurationColumns::Row ConfigurationColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& ConfigurationColumns::revision() const
+{
+    return mRevision;
+}
+
+const std::vector<long>& ConfigurationColumns::limit() const
+{
+    return mLimit;
+}
+
+const std::vector<std::string>& ConfigurationColumns::name() const
+{
+    return mName;
+}
+
+}
+
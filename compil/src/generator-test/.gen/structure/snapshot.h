@@ -0,0 +1,182 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __STRUCTURE_SNAPSHOT_COMPIL_H_
+#define __STRUCTURE_SNAPSHOT_COMPIL_H_
+
+#include "structure/snapshot-fwd.h"
+// Compil C++ Template Library
+#include "core/compil/shared_value.h"
+
+template<class T> class snapshot;
+
+namespace configuration
+{
+
+// Configuration is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Configuration
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                 operator=   (const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                     Builder     ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                     Builder     (const Configuration& object);
+        // Destructor of Builder
+        /*lax*/                      ~Builder    ();
+
+        // Instantiates Configuration instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const Configuration& build       ()                            const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                ConfigurationSPtr    finalize    ();
+
+
+        // Setter method for the data field revision
+                Builder&             set_revision(long revision);
+
+        // Setter method for the data field limit
+                Builder&             set_limit   (long limit);
+
+        // Setter method for the data field name
+                Builder&             set_name    (const std::string& name);
+        // Provides mutable access to field name
+                std::string&         mutable_name();
+
+    protected:
+        // constructor needed from potential derived classes
+                                     Builder     (ConfigurationRPtr pObject);
+
+        ConfigurationRPtr mpObject;
+    };
+
+    // Default constructor
+                               Configuration ();
+    // Destructor
+    /*lax*/                    ~Configuration();
+
+    // Getter method for the data field revision
+            long               revision      () const;
+
+    // Getter method for the data field limit
+            long               limit         () const;
+
+    // Getter method for the data field name
+            const std::string& name          () const;
+
+private:
+    // variable for the data field revision
+    long                      mRevision;
+    // variable for the data field limit
+    long                      mLimit;
+    // variable for the data field name
+    shared_value<std::string> mName;
+};
+
+// Holder of the current Configuration shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Configuration> ConfigurationSnapshot;
+
+// ConfigurationColumns holds Configuration objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class ConfigurationColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                       Row     (const ConfigurationColumns& columns, size_t index);
+
+        // Getter method for the data field revision
+                                    long               revision()                                                  const;
+
+        // Getter method for the data field limit
+                                    long               limit   ()                                                  const;
+
+        // Getter method for the data field name
+                                    const std::string& name    ()                                                  const;
+    private:
+        const ConfigurationColumns& mColumns;
+        size_t                      mIndex;
+    };
+
+    // Default constructor
+                                    ConfigurationColumns ();
+    // Destructor
+                                    ~ConfigurationColumns();
+
+    // Returns the number of the rows
+    size_t                          size                 ()                                      const;
+    // Returns true if there are no rows
+    bool                            empty                ()                                      const;
+    // Reserves memory for size rows in every column
+    void                            reserve              (size_t size);
+    // Removes all the rows
+    void                            clear                ();
+
+    // Appends a row with the data fields of the object
+    void                            push_back            (const Configuration& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                            push_back            (const Configuration::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                             operator[]           (size_t index)                          const;
+
+    // Column of the data field revision
+    const std::vector<long>&        revision             ()                                      const;
+
+    // Column of the data field limit
+    const std::vector<long>&        limit                ()                                      const;
+
+    // Column of the data field name
+    const std::vector<std::string>& name                 ()                                      const;
+
+private:
+    // column of the data field revision
+    std::vector<long>        mRevision;
+    // column of the data field limit
+    std::vector<long>        mLimit;
+    // column of the data field name
+    std::vector<std::string> mName;
+};
+
+}
+
+#endif // __STRUCTURE_SNAPSHOT_COMPIL_H_
+
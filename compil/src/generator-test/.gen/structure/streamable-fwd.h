@@ -0,0 +1,57 @@
+#ifndef __STRUCTURE_STREAMABLE_COMPIL__FWD_H_
+#define __STRUCTURE_STREAMABLE_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace streamable
+{
+
+// Forward declarations
+class EEnum;
+typedef EEnum*                         EEnumRPtr;
+typedef boost::shared_ptr<EEnum>       EEnumSPtr;
+typedef boost::shared_ptr<const EEnum> EEnumSCPtr;
+typedef boost::weak_ptr<EEnum>         EEnumWPtr;
+
+class Item1;
+typedef Item1*                         Item1RPtr;
+typedef boost::shared_ptr<Item1>       Item1SPtr;
+typedef boost::shared_ptr<const Item1> Item1SCPtr;
+typedef boost::weak_ptr<Item1>         Item1WPtr;
+
+class Item2;
+typedef Item2*                         Item2RPtr;
+typedef boost::shared_ptr<Item2>       Item2SPtr;
+typedef boost::shared_ptr<const Item2> Item2SCPtr;
+typedef boost::weak_ptr<Item2>         Item2WPtr;
+
+class Structure1;
+typedef Structure1*                         Structure1RPtr;
+typedef boost::shared_ptr<Structure1>       Structure1SPtr;
+typedef boost::shared_ptr<const Structure1> Structure1SCPtr;
+typedef boost::weak_ptr<Structure1>         Structure1WPtr;
+
+class Structure2;
+typedef Structure2*                         Structure2RPtr;
+typedef boost::shared_ptr<Structure2>       Structure2SPtr;
+typedef boost::shared_ptr<const Structure2> Structure2SCPtr;
+typedef boost::weak_ptr<Structure2>         Structure2WPtr;
+
+class IStructure1;
+typedef IStructure1*                         IStructure1RPtr;
+typedef boost::shared_ptr<IStructure1>       IStructure1SPtr;
+typedef boost::shared_ptr<const IStructure1> IStructure1SCPtr;
+typedef boost::weak_ptr<IStructure1>         IStructure1WPtr;
+
+class IStructure2;
+typedef IStructure2*                         IStructure2RPtr;
+typedef boost::shared_ptr<IStructure2>       IStructure2SPtr;
+typedef boost::shared_ptr<const IStructure2> IStructure2SCPtr;
+typedef boost::weak_ptr<IStructure2>         IStructure2WPtr;
+
+}
+
+#endif // __STRUCTURE_STREAMABLE_COMPIL__FWD_H_
+
@@ -0,0 +1,17 @@
+#include "structure/streamable.h"
+// Boost C++ core
+#include <core/boost/boost_assert_handler.h>
+// Google Test framework
+#include <gtest/gtest.h>
+
+namespace streamable
+{
+
+
+
+
+
+
+
+}
+
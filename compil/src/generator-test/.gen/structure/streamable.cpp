@@ -0,0 +1,1584 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <vector>
+
+#include "structure/streamable.h"
+// Standard C Library
+#include <stddef.h>
+#include <string.h>
+
+namespace streamable
+{
+
+EEnum::EEnum()
+        : mValue(kInvalid)
+{
+}
+
+EEnum::EEnum(long value)
+        : mValue(value)
+{
+}
+
+const EEnum EEnum::invalid()
+{
+    return EEnum(kInvalid);
+}
+
+const EEnum EEnum::value1()
+{
+    return EEnum(kValue1);
+}
+
+const EEnum EEnum::value2()
+{
+    return EEnum(kValue2);
+}
+
+long EEnum::value() const
+{
+    return mValue;
+}
+
+const char* EEnum::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "value1",
+        "value2",
+    };
+    return names[(size_t)value];
+}
+
+const char* EEnum::shortName() const
+{
+    return shortName(value());
+}
+
+EEnum EEnum::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        2, 2,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "value2",
+        "value1",
+    };
+    static const size_t lengths[] =
+    {
+        7, 6, 6,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kValue2,
+        kValue1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return EEnum();
+    return EEnum(values[slot]);
+}
+
+bool EEnum::operator==(const EEnum& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EEnum::operator!=(const EEnum& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+Item1::Item1()
+{
+}
+
+Item1::~Item1()
+{
+}
+
+Item2::Item2()
+{
+}
+
+Item2::~Item2()
+{
+}
+
+Item2SPtr Item2::downcast(const Item1SPtr& object)
+{
+    return boost::static_pointer_cast<Item2>(object);
+}
+
+Structure1::Structure1()
+{
+}
+
+Structure1::~Structure1()
+{
+}
+
+Structure1::EWeak::EWeak()
+        : mValue(kInvalid)
+{
+}
+
+Structure1::EWeak::EWeak(long value)
+        : mValue(value)
+{
+}
+
+const long Structure1::EWeak::invalid()
+{
+    return kInvalid;
+}
+
+const long Structure1::EWeak::value1()
+{
+    return kValue1;
+}
+
+const long Structure1::EWeak::value2()
+{
+    return kValue2;
+}
+
+long Structure1::EWeak::value() const
+{
+    return mValue;
+}
+
+const char* Structure1::EWeak::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "value1",
+        "value2",
+    };
+    return names[(size_t)value];
+}
+
+const char* Structure1::EWeak::shortName() const
+{
+    return shortName(value());
+}
+
+Structure1::EWeak Structure1::EWeak::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        2, 2,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "value2",
+        "value1",
+    };
+    static const size_t lengths[] =
+    {
+        7, 6, 6,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kValue2,
+        kValue1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return Structure1::EWeak();
+    return Structure1::EWeak(values[slot]);
+}
+
+Structure1::EWeak::operator long () const
+{
+    return mValue;
+}
+
+Structure1::EStrong::EStrong()
+        : mValue(kInvalid)
+{
+}
+
+Structure1::EStrong::EStrong(long value)
+        : mValue(value)
+{
+}
+
+const Structure1::EStrong Structure1::EStrong::invalid()
+{
+    return EStrong(kInvalid);
+}
+
+const Structure1::EStrong Structure1::EStrong::value1()
+{
+    return EStrong(kValue1);
+}
+
+const Structure1::EStrong Structure1::EStrong::value2()
+{
+    return EStrong(kValue2);
+}
+
+long Structure1::EStrong::value() const
+{
+    return mValue;
+}
+
+const char* Structure1::EStrong::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "value1",
+        "value2",
+    };
+    return names[(size_t)value];
+}
+
+const char* Structure1::EStrong::shortName() const
+{
+    return shortName(value());
+}
+
+Structure1::EStrong Structure1::EStrong::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        2, 2,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "value2",
+        "value1",
+    };
+    static const size_t lengths[] =
+    {
+        7, 6, 6,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kValue2,
+        kValue1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return Structure1::EStrong();
+    return Structure1::EStrong(values[slot]);
+}
+
+bool Structure1::EStrong::operator==(const EStrong& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool Structure1::EStrong::operator!=(const EStrong& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+long Structure1::i1() const
+{
+    return mI1;
+}
+
+Structure1& Structure1::set_i1(long i1)
+{
+    mI1 = i1;
+    return *this;
+}
+
+Structure1& Structure1::operator<<(long i1)
+{
+    return set_i1(i1);
+}
+
+const Structure1SPtr& operator<<(const Structure1SPtr& object, long i1)
+{
+    BOOST_ASSERT(object);
+    *object << i1;
+    return object;
+}
+
+const Structure1::EWeak& Structure1::w1() const
+{
+    return mW1;
+}
+
+Structure1& Structure1::set_w1(const EWeak& w1)
+{
+    mW1 = w1;
+    return *this;
+}
+
+Structure1::EWeak& Structure1::mutable_w1()
+{
+    return mW1;
+}
+
+Structure1& Structure1::operator<<(const EWeak& w1)
+{
+    return set_w1(w1);
+}
+
+const Structure1SPtr& operator<<(const Structure1SPtr& object, const Structure1::EWeak& w1)
+{
+    BOOST_ASSERT(object);
+    *object << w1;
+    return object;
+}
+
+const Structure1::EStrong& Structure1::s1() const
+{
+    return mS1;
+}
+
+Structure1& Structure1::set_s1(const EStrong& s1)
+{
+    mS1 = s1;
+    return *this;
+}
+
+Structure1::EStrong& Structure1::mutable_s1()
+{
+    return mS1;
+}
+
+Structure1& Structure1::operator<<(const EStrong& s1)
+{
+    return set_s1(s1);
+}
+
+const Structure1SPtr& operator<<(const Structure1SPtr& object, const Structure1::EStrong& s1)
+{
+    BOOST_ASSERT(object);
+    *object << s1;
+    return object;
+}
+
+const Item1& Structure1::item1() const
+{
+    return mItem1;
+}
+
+Structure1& Structure1::set_item1(const Item1& item1)
+{
+    mItem1 = item1;
+    return *this;
+}
+
+Item1& Structure1::mutable_item1()
+{
+    return mItem1;
+}
+
+Structure1& Structure1::operator<<(const Item1& item1)
+{
+    return set_item1(item1);
+}
+
+const Structure1SPtr& operator<<(const Structure1SPtr& object, const Item1& item1)
+{
+    BOOST_ASSERT(object);
+    *object << item1;
+    return object;
+}
+
+const Item1SPtr& Structure1::refItem1() const
+{
+    return mRefItem1;
+}
+
+Structure1& Structure1::set_refItem1(const Item1SPtr& refItem1)
+{
+    mRefItem1 = refItem1;
+    return *this;
+}
+
+Structure1& Structure1::operator<<(const Item1SPtr& refItem1)
+{
+    return set_refItem1(refItem1);
+}
+
+const Structure1SPtr& operator<<(const Structure1SPtr& object, const Item1SPtr& refItem1)
+{
+    BOOST_ASSERT(object);
+    *object << refItem1;
+    return object;
+}
+
+const std::vector<EEnum>& Structure1::es1() const
+{
+    return mEs1;
+}
+
+Structure1& Structure1::set_es1(const std::vector<EEnum>& es1)
+{
+    mEs1 = es1;
+    return *this;
+}
+
+std::vector<EEnum>& Structure1::mutable_es1()
+{
+    return mEs1;
+}
+
+Structure1& Structure1::operator<<(const std::vector<EEnum>& es1)
+{
+    return set_es1(es1);
+}
+
+const Structure1SPtr& operator<<(const Structure1SPtr& object, const std::vector<EEnum>& es1)
+{
+    BOOST_ASSERT(object);
+    *object << es1;
+    return object;
+}
+
+Structure1& Structure1::operator<<(const EEnum& es1Item)
+{
+    mEs1.push_back(es1Item);
+    return *this;
+}
+
+const Structure1SPtr& operator<<(const Structure1SPtr& object, const EEnum& es1Item)
+{
+    BOOST_ASSERT(object);
+    *object << es1Item;
+    return object;
+}
+
+Structure1Columns::Row::Row(const Structure1Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure1Columns::Row::i1() const
+{
+    return mColumns.i1()[mIndex];
+}
+
+const Structure1::EWeak& Structure1Columns::Row::w1() const
+{
+    return mColumns.w1()[mIndex];
+}
+
+const Structure1::EStrong& Structure1Columns::Row::s1() const
+{
+    return mColumns.s1()[mIndex];
+}
+
+const Item1& Structure1Columns::Row::item1() const
+{
+    return mColumns.item1()[mIndex];
+}
+
+const Item1SPtr& Structure1Columns::Row::refItem1() const
+{
+    return mColumns.refItem1()[mIndex];
+}
+
+const std::vector<EEnum>& Structure1Columns::Row::es1() const
+{
+    return mColumns.es1()[mIndex];
+}
+
+Structure1Columns::Structure1Columns()
+{
+}
+
+Structure1Columns::~Structure1Columns()
+{
+}
+
+size_t Structure1Columns::size() const
+{
+    return mI1.size();
+}
+
+bool Structure1Columns::empty() const
+{
+    return mI1.empty();
+}
+
+void Structure1Columns::reserve(size_t size)
+{
+    mI1.reserve(size);
+    mW1.reserve(size);
+    mS1.reserve(size);
+    mItem1.reserve(size);
+    mRefItem1.reserve(size);
+    mEs1.reserve(size);
+}
+
+void Structure1Columns::clear()
+{
+    mI1.clear();
+    mW1.clear();
+    mS1.clear();
+    mItem1.clear();
+    mRefItem1.clear();
+    mEs1.clear();
+}
+
+void Structure1Columns::push_back(const Structure1& object)
+{
+    mI1.push_back(object.i1());
+    mW1.push_back(object.w1());
+    mS1.push_back(object.s1());
+    mItem1.push_back(object.item1());
+    mRefItem1.push_back(object.refItem1());
+    mEs1.push_back(object.es1());
+}
+
+Structure1Columns::Row Structure1Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure1Columns::i1() const
+{
+    return mI1;
+}
+
+const std::vector<Structure1::EWeak>& Structure1Columns::w1() const
+{
+    return mW1;
+}
+
+const std::vector<Structure1::EStrong>& Structure1Columns::s1() const
+{
+    return mS1;
+}
+
+const std::vector<Item1>& Structure1Columns::item1() const
+{
+    return mItem1;
+}
+
+const std::vector<Item1SPtr>& Structure1Columns::refItem1() const
+{
+    return mRefItem1;
+}
+
+const std::vector<std::vector<EEnum> >& Structure1Columns::es1() const
+{
+    return mEs1;
+}
+
+Structure2::Structure2()
+{
+}
+
+Structure2::~Structure2()
+{
+}
+
+Structure2SPtr Structure2::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2>(object);
+}
+
+Structure2& Structure2::set_i1(long i1)
+{
+    Structure1::set_i1(i1);
+    return *this;
+}
+
+Structure2& Structure2::operator<<(long i1)
+{
+    *(Structure1*)this << i1;
+    return *this;
+}
+
+const Structure2SPtr& operator<<(const Structure2SPtr& object, long i1)
+{
+    BOOST_ASSERT(object);
+    *object << i1;
+    return object;
+}
+
+Structure2& Structure2::set_w1(const EWeak& w1)
+{
+    Structure1::set_w1(w1);
+    return *this;
+}
+
+Structure2& Structure2::operator<<(const EWeak& w1)
+{
+    *(Structure1*)this << w1;
+    return *this;
+}
+
+const Structure2SPtr& operator<<(const Structure2SPtr& object, const Structure1::EWeak& w1)
+{
+    BOOST_ASSERT(object);
+    *object << w1;
+    return object;
+}
+
+Structure2& Structure2::set_s1(const EStrong& s1)
+{
+    Structure1::set_s1(s1);
+    return *this;
+}
+
+Structure2& Structure2::operator<<(const EStrong& s1)
+{
+    *(Structure1*)this << s1;
+    return *this;
+}
+
+const Structure2SPtr& operator<<(const Structure2SPtr& object, const Structure1::EStrong& s1)
+{
+    BOOST_ASSERT(object);
+    *object << s1;
+    return object;
+}
+
+Structure2& Structure2::set_item1(const Item1& item1)
+{
+    Structure1::set_item1(item1);
+    return *this;
+}
+
+Structure2& Structure2::operator<<(const Item1& item1)
+{
+    *(Structure1*)this << item1;
+    return *this;
+}
+
+const Structure2SPtr& operator<<(const Structure2SPtr& object, const Item1& item1)
+{
+    BOOST_ASSERT(object);
+    *object << item1;
+    return object;
+}
+
+Structure2& Structure2::set_refItem1(const Item1SPtr& refItem1)
+{
+    Structure1::set_refItem1(refItem1);
+    return *this;
+}
+
+Structure2& Structure2::operator<<(const Item1SPtr& refItem1)
+{
+    *(Structure1*)this << refItem1;
+    return *this;
+}
+
+const Structure2SPtr& operator<<(const Structure2SPtr& object, const Item1SPtr& refItem1)
+{
+    BOOST_ASSERT(object);
+    *object << refItem1;
+    return object;
+}
+
+Structure2& Structure2::set_es1(const std::vector<EEnum>& es1)
+{
+    Structure1::set_es1(es1);
+    return *this;
+}
+
+Structure2& Structure2::operator<<(const std::vector<EEnum>& es1)
+{
+    *(Structure1*)this << es1;
+    return *this;
+}
+
+const Structure2SPtr& operator<<(const Structure2SPtr& object, const std::vector<EEnum>& es1)
+{
+    BOOST_ASSERT(object);
+    *object << es1;
+    return object;
+}
+
+Structure2& Structure2::operator<<(const EEnum& es1Item)
+{
+    *(Structure1*)this << es1Item;
+    return *this;
+}
+
+const Structure2SPtr& operator<<(const Structure2SPtr& object, const EEnum& es1Item)
+{
+    BOOST_ASSERT(object);
+    *object << es1Item;
+    return object;
+}
+
+Structure2Columns::Row::Row(const Structure2Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure2Columns::Row::i1() const
+{
+    return mColumns.i1()[mIndex];
+}
+
+const Structure1::EWeak& Structure2Columns::Row::w1() const
+{
+    return mColumns.w1()[mIndex];
+}
+
+const Structure1::EStrong& Structure2Columns::Row::s1() const
+{
+    return mColumns.s1()[mIndex];
+}
+
+const Item1& Structure2Columns::Row::item1() const
+{
+    return mColumns.item1()[mIndex];
+}
+
+const Item1SPtr& Structure2Columns::Row::refItem1() const
+{
+    return mColumns.refItem1()[mIndex];
+}
+
+const std::vector<EEnum>& Structure2Columns::Row::es1() const
+{
+    return mColumns.es1()[mIndex];
+}
+
+Structure2Columns::Structure2Columns()
+{
+}
+
+Structure2Columns::~Structure2Columns()
+{
+}
+
+size_t Structure2Columns::size() const
+{
+    return mI1.size();
+}
+
+bool Structure2Columns::empty() const
+{
+    return mI1.empty();
+}
+
+void Structure2Columns::reserve(size_t size)
+{
+    mI1.reserve(size);
+    mW1.reserve(size);
+    mS1.reserve(size);
+    mItem1.reserve(size);
+    mRefItem1.reserve(size);
+    mEs1.reserve(size);
+}
+
+void Structure2Columns::clear()
+{
+    mI1.clear();
+    mW1.clear();
+    mS1.clear();
+    mItem1.clear();
+    mRefItem1.clear();
+    mEs1.clear();
+}
+
+void Structure2Columns::push_back(const Structure2& object)
+{
+    mI1.push_back(object.i1());
+    mW1.push_back(object.w1());
+    mS1.push_back(object.s1());
+    mItem1.push_back(object.item1());
+    mRefItem1.push_back(object.refItem1());
+    mEs1.push_back(object.es1());
+}
+
+Structure2Columns::Row Structure2Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure2Columns::i1() const
+{
+    return mI1;
+}
+
+const std::vector<Structure1::EWeak>& Structure2Columns::w1() const
+{
+    return mW1;
+}
+
+const std::vector<Structure1::EStrong>& Structure2Columns::s1() const
+{
+    return mS1;
+}
+
+const std::vector<Item1>& Structure2Columns::item1() const
+{
+    return mItem1;
+}
+
+const std::vector<Item1SPtr>& Structure2Columns::refItem1() const
+{
+    return mRefItem1;
+}
+
+const std::vector<std::vector<EEnum> >& Structure2Columns::es1() const
+{
+    return mEs1;
+}
+
+IStructure1::Builder::Builder()
+        : mpObject(new IStructure1())
+{
+}
+
+IStructure1::Builder::Builder(const IStructure1& object)
+        : mpObject(new IStructure1())
+{
+    *(IStructure1*)mpObject = object;
+}
+
+IStructure1::Builder::Builder(IStructure1RPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+IStructure1::Builder::~Builder()
+{
+    delete (IStructure1RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const IStructure1& IStructure1::Builder::build() const
+{
+    return *(IStructure1RPtr)mpObject;
+}
+
+IStructure1SPtr IStructure1::Builder::finalize()
+{
+    IStructure1RPtr objectRPtr = (IStructure1RPtr)mpObject;
+    mpObject = NULL;
+    return IStructure1SPtr(objectRPtr);
+}
+
+IStructure1::IStructure1()
+{
+}
+
+IStructure1::~IStructure1()
+{
+}
+
+IStructure1::EWeak::EWeak()
+        : mValue(kInvalid)
+{
+}
+
+IStructure1::EWeak::EWeak(long value)
+        : mValue(value)
+{
+}
+
+const long IStructure1::EWeak::invalid()
+{
+    return kInvalid;
+}
+
+const long IStructure1::EWeak::value1()
+{
+    return kValue1;
+}
+
+const long IStructure1::EWeak::value2()
+{
+    return kValue2;
+}
+
+long IStructure1::EWeak::value() const
+{
+    return mValue;
+}
+
+const char* IStructure1::EWeak::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "value1",
+        "value2",
+    };
+    return names[(size_t)value];
+}
+
+const char* IStructure1::EWeak::shortName() const
+{
+    return shortName(value());
+}
+
+IStructure1::EWeak IStructure1::EWeak::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        2, 2,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "value2",
+        "value1",
+    };
+    static const size_t lengths[] =
+    {
+        7, 6, 6,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kValue2,
+        kValue1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return IStructure1::EWeak();
+    return IStructure1::EWeak(values[slot]);
+}
+
+IStructure1::EWeak::operator long () const
+{
+    return mValue;
+}
+
+IStructure1::EStrong::EStrong()
+        : mValue(kInvalid)
+{
+}
+
+IStructure1::EStrong::EStrong(long value)
+        : mValue(value)
+{
+}
+
+const IStructure1::EStrong IStructure1::EStrong::invalid()
+{
+    return EStrong(kInvalid);
+}
+
+const IStructure1::EStrong IStructure1::EStrong::value1()
+{
+    return EStrong(kValue1);
+}
+
+const IStructure1::EStrong IStructure1::EStrong::value2()
+{
+    return EStrong(kValue2);
+}
+
+long IStructure1::EStrong::value() const
+{
+    return mValue;
+}
+
+const char* IStructure1::EStrong::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "value1",
+        "value2",
+    };
+    return names[(size_t)value];
+}
+
+const char* IStructure1::EStrong::shortName() const
+{
+    return shortName(value());
+}
+
+IStructure1::EStrong IStructure1::EStrong::fromString(const char* name, size_t size)
+{
+    static const unsigned long displacements[] =
+    {
+        2, 2,
+    };
+    static const char* names[] =
+    {
+        "invalid",
+        "value2",
+        "value1",
+    };
+    static const size_t lengths[] =
+    {
+        7, 6, 6,
+    };
+    static const long values[] =
+    {
+        kInvalid,
+        kValue2,
+        kValue1,
+    };
+
+    unsigned long hash = 2166136261UL;
+    for (size_t i = 0; i < size; ++i)
+        hash = ((hash ^ (unsigned char)name[i]) * 16777619UL) & 0xffffffffUL;
+
+    unsigned long slot = (hash ^ displacements[hash % 2]) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot = (slot * 0x45d9f3bUL) & 0xffffffffUL;
+    slot ^= slot >> 16;
+    slot %= 3;
+
+    if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))
+        return IStructure1::EStrong();
+    return IStructure1::EStrong(values[slot]);
+}
+
+bool IStructure1::EStrong::operator==(const EStrong& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool IStructure1::EStrong::operator!=(const EStrong& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+long IStructure1::i1() const
+{
+    return mI1;
+}
+
+IStructure1::Builder& IStructure1::Builder::set_i1(long i1)
+{
+    mpObject->mI1 = i1;
+    return *this;
+}
+
+IStructure1::Builder& IStructure1::Builder::operator<<(long i1)
+{
+    return set_i1(i1);
+}
+
+const IStructure1::EWeak& IStructure1::w1() const
+{
+    return mW1;
+}
+
+IStructure1::Builder& IStructure1::Builder::set_w1(const EWeak& w1)
+{
+    mpObject->mW1 = w1;
+    return *this;
+}
+
+IStructure1::EWeak& IStructure1::Builder::mutable_w1()
+{
+    return mpObject->mW1;
+}
+
+IStructure1::Builder& IStructure1::Builder::operator<<(const EWeak& w1)
+{
+    return set_w1(w1);
+}
+
+const IStructure1::EStrong& IStructure1::s1() const
+{
+    return mS1;
+}
+
+IStructure1::Builder& IStructure1::Builder::set_s1(const EStrong& s1)
+{
+    mpObject->mS1 = s1;
+    return *this;
+}
+
+IStructure1::EStrong& IStructure1::Builder::mutable_s1()
+{
+    return mpObject->mS1;
+}
+
+IStructure1::Builder& IStructure1::Builder::operator<<(const EStrong& s1)
+{
+    return set_s1(s1);
+}
+
+const Item1& IStructure1::item1() const
+{
+    return mItem1;
+}
+
+IStructure1::Builder& IStructure1::Builder::set_item1(const Item1& item1)
+{
+    mpObject->mItem1 = item1;
+    return *this;
+}
+
+Item1& IStructure1::Builder::mutable_item1()
+{
+    return mpObject->mItem1;
+}
+
+IStructure1::Builder& IStructure1::Builder::operator<<(const Item1& item1)
+{
+    return set_item1(item1);
+}
+
+const Item1SPtr& IStructure1::refItem1() const
+{
+    return mRefItem1;
+}
+
+IStructure1::Builder& IStructure1::Builder::set_refItem1(const Item1SPtr& refItem1)
+{
+    mpObject->mRefItem1 = refItem1;
+    return *this;
+}
+
+IStructure1::Builder& IStructure1::Builder::operator<<(const Item1SPtr& refItem1)
+{
+    return set_refItem1(refItem1);
+}
+
+const std::vector<EEnum>& IStructure1::es1() const
+{
+    return mEs1;
+}
+
+IStructure1::Builder& IStructure1::Builder::set_es1(const std::vector<EEnum>& es1)
+{
+    mpObject->mEs1 = es1;
+    return *this;
+}
+
+std::vector<EEnum>& IStructure1::Builder::mutable_es1()
+{
+    return mpObject->mEs1.mutate();
+}
+
+IStructure1::Builder& IStructure1::Builder::operator<<(const std::vector<EEnum>& es1)
+{
+    return set_es1(es1);
+}
+
+IStructure1::Builder& IStructure1::Builder::operator<<(const EEnum& es1Item)
+{
+    mpObject->mEs1.mutate().push_back(es1Item);
+    return *this;
+}
+
+IStructure1Columns::Row::Row(const IStructure1Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long IStructure1Columns::Row::i1() const
+{
+    return mColumns.i1()[mIndex];
+}
+
+const IStructure1::EWeak& IStructure1Columns::Row::w1() const
+{
+    return mColumns.w1()[mIndex];
+}
+
+const IStructure1::EStrong& IStructure1Columns::Row::s1() const
+{
+    return mColumns.s1()[mIndex];
+}
+
+const Item1& IStructure1Columns::Row::item1() const
+{
+    return mColumns.item1()[mIndex];
+}
+
+const Item1SPtr& IStructure1Columns::Row::refItem1() const
+{
+    return mColumns.refItem1()[mIndex];
+}
+
+const std::vector<EEnum>& IStructure1Columns::Row::es1() const
+{
+    return mColumns.es1()[mIndex];
+}
+
+IStructure1Columns::IStructure1Columns()
+{
+}
+
+IStructure1Columns::~IStructure1Columns()
+{
+}
+
+size_t IStructure1Columns::size() const
+{
+    return mI1.size();
+}
+
+bool IStructure1Columns::empty() const
+{
+    return mI1.empty();
+}
+
+void IStructure1Columns::reserve(size_t size)
+{
+    mI1.reserve(size);
+    mW1.reserve(size);
+    mS1.reserve(size);
+    mItem1.reserve(size);
+    mRefItem1.reserve(size);
+    mEs1.reserve(size);
+}
+
+void IStructure1Columns::clear()
+{
+    mI1.clear();
+    mW1.clear();
+    mS1.clear();
+    mItem1.clear();
+    mRefItem1.clear();
+    mEs1.clear();
+}
+
+void IStructure1Columns::push_back(const IStructure1& object)
+{
+    mI1.push_back(object.i1());
+    mW1.push_back(object.w1());
+    mS1.push_back(object.s1());
+    mItem1.push_back(object.item1());
+    mRefItem1.push_back(object.refItem1());
+    mEs1.push_back(object.es1());
+}
+
+void IStructure1Columns::push_back(const IStructure1::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+IStructure1Columns::Row IStructure1Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& IStructure1Columns::i1() const
+{
+    return mI1;
+}
+
+const std::vector<IStructure1::EWeak>& IStructure1Columns::w1() const
+{
+    return mW1;
+}
+
+const std::vector<IStructure1::EStrong>& IStructure1Columns::s1() const
+{
+    return mS1;
+}
+
+const std::vector<Item1>& IStructure1Columns::item1() const
+{
+    return mItem1;
+}
+
+const std::vector<Item1SPtr>& IStructure1Columns::refItem1() const
+{
+    return mRefItem1;
+}
+
+const std::vector<std::vector<EEnum> >& IStructure1Columns::es1() const
+{
+    return mEs1;
+}
+
+IStructure2::Builder::Builder()
+        : IStructure1::Builder(new IStructure2())
+{
+}
+
+IStructure2::Builder::Builder(const IStructure2& object)
+        : IStructure1::Builder(new IStructure2())
+{
+    *(IStructure2*)mpObject = object;
+}
+
+IStructure2::Builder::Builder(IStructure2RPtr pObject)
+        : IStructure1::Builder(pObject)
+{
+}
+
+IStructure2::Builder::~Builder()
+{
+    delete (IStructure2RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const IStructure2& IStructure2::Builder::build() const
+{
+    return *(IStructure2RPtr)mpObject;
+}
+
+IStructure2SPtr IStructure2::Builder::finalize()
+{
+    IStructure2RPtr objectRPtr = (IStructure2RPtr)mpObject;
+    mpObject = NULL;
+    return IStructure2SPtr(objectRPtr);
+}
+
+IStructure2::IStructure2()
+{
+}
+
+IStructure2::~IStructure2()
+{
+}
+
+IStructure2SPtr IStructure2::downcast(const IStructure1SPtr& object)
+{
+    return boost::static_pointer_cast<IStructure2>(object);
+}
+
+IStructure2::Builder& IStructure2::Builder::set_i1(long i1)
+{
+    return (IStructure2::Builder&)IStructure1::Builder::set_i1(i1);
+}
+
+IStructure2::Builder& IStructure2::Builder::operator<<(long i1)
+{
+    *(IStructure1::Builder*)this << i1;
+    return *this;
+}
+
+IStructure2::Builder& IStructure2::Builder::set_w1(const EWeak& w1)
+{
+    return (IStructure2::Builder&)IStructure1::Builder::set_w1(w1);
+}
+
+IStructure2::Builder& IStructure2::Builder::operator<<(const EWeak& w1)
+{
+    *(IStructure1::Builder*)this << w1;
+    return *this;
+}
+
+IStructure2::Builder& IStructure2::Builder::set_s1(const EStrong& s1)
+{
+    return (IStructure2::Builder&)IStructure1::Builder::set_s1(s1);
+}
+
+IStructure2::Builder& IStructure2::Builder::operator<<(const EStrong& s1)
+{
+    *(IStructure1::Builder*)this << s1;
+    return *this;
+}
+
+IStructure2::Builder& IStructure2::Builder::set_item1(const Item1& item1)
+{
+    return (IStructure2::Builder&)IStructure1::Builder::set_item1(item1);
+}
+
+IStructure2::Builder& IStructure2::Builder::operator<<(const Item1& item1)
+{
+    *(IStructure1::Builder*)this << item1;
+    return *this;
+}
+
+IStructure2::Builder& IStructure2::Builder::set_refItem1(const Item1SPtr& refItem1)
+{
+    return (IStructure2::Builder&)IStructure1::Builder::set_refItem1(refItem1);
+}
+
+IStructure2::Builder& IStructure2::Builder::operator<<(const Item1SPtr& refItem1)
+{
+    *(IStructure1::Builder*)this << refItem1;
+    return *this;
+}
+
+IStructure2::Builder& IStructure2::Builder::set_es1(const std::vector<EEnum>& es1)
+{
+    return (IStructure2::Builder&)IStructure1::Builder::set_es1(es1);
+}
+
+IStructure2::Builder& IStructure2::Builder::operator<<(const std::vector<EEnum>& es1)
+{
+    *(IStructure1::Builder*)this << es1;
+    return *this;
+}
+
+IStructure2::Builder& IStructure2::Builder::operator<<(const EEnum& es1Item)
+{
+    *(IStructure1::Builder*)this << es1Item;
+    return *this;
+}
+
+IStructure2Columns::Row::Row(const IStructure2Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long IStructure2Columns::Row::i1() const
+{
+    return mColumns.i1()[mIndex];
+}
+
+const IStructure1::EWeak& IStructure2Columns::Row::w1() const
+{
+    return mColumns.w1()[mIndex];
+}
+
+const IStructure1::EStrong& IStructure2Columns::Row::s1() const
+{
+    return mColumns.s1()[mIndex];
+}
+
+const Item1& IStructure2Columns::Row::item1() const
+{
+    return mColumns.item1()[mIndex];
+}
+
+const Item1SPtr& IStructure2Columns::Row::refItem1() const
+{
+    return mColumns.refItem1()[mIndex];
+}
+
+const std::vector<EEnum>& IStructure2Columns::Row::es1() const
+{
+    return mColumns.es1()[mIndex];
+}
+
+IStructure2Columns::IStructure2Columns()
+{
+}
+
+IStructure2Columns::~IStructure2Columns()
+{
+}
+
+size_t IStructure2Columns::size() const
+{
+    return mI1.size();
+}
+
+bool IStructure2Columns::empty() const
+{
+    return mI1.empty();
+}
+
+void IStructure2Columns::reserve(size_t size)
+{
+    mI1.reserve(size);
+    mW1.reserve(size);
+    mS1.reserve(size);
+    mItem1.reserve(size);
+    mRefItem1.reserve(size);
+    mEs1.reserve(size);
+}
+
+void IStructure2Columns::clear()
+{
+    mI1.clear();
+    mW1.clear();
+    mS1.clear();
+    mItem1.clear();
+    mRefItem1.clear();
+    mEs1.clear();
+}
+
+void IStructure2Columns::push_back(const IStructure2& object)
+{
+    mI1.push_back(object.i1());
+    mW1.push_back(object.w1());
+    mS1.push_back(object.s1());
+    mItem1.push_back(object.item1());
+    mRefItem1.push_back(object.refItem1());
+    mEs1.push_back(object.es1());
+}
+
+void IStructure2Columns::push_back(const IStructure2::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+IStructure2Columns::Row IStructure2Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& IStructure2Columns::i1() const
+{
+    return mI1;
+}
+
+const std::vector<IStructure1::EWeak>& IStructure2Columns::w1() const
+{
+    return mW1;
+}
+
+const std::vector<IStructure1::EStrong>& IStructure2Columns::s1() const
+{
+    return mS1;
+}
+
+const std::vector<Item1>& IStructure2Columns::item1() const
+{
+    return mItem1;
+}
+
+const std::vector<Item1SPtr>& IStructure2Columns::refItem1() const
+{
+    return mRefItem1;
+}
+
+const std::vector<std::vector<EEnum> >& IStructure2Columns::es1() const
+{
+    return mEs1;
+}
+
+}
+
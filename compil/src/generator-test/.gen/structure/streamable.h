@@ -0,0 +1,1064 @@
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <vector>
+
+#ifndef __STRUCTURE_STREAMABLE_COMPIL_H_
+#define __STRUCTURE_STREAMABLE_COMPIL_H_
+
+#include "structure/streamable-fwd.h"
+// Compil C++ Template Library
+#include "core/compil/shared_value.h"
+// Standard C Library
+#include <stddef.h>
+
+template<class T> class snapshot;
+
+namespace streamable
+{
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EEnum
+{
+public:
+    // Default constructor - sets the value to invalid
+                         EEnum     ();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit             EEnum     (long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long        value     ()                              const;
+    // Returns short name for a specified enum value
+    static   const char* shortName (long value);
+    // Returns short name of the enum value
+             const char* shortName ()                              const;
+    // Returns the enum value with a specified short name or invalid if
+    // none of the values has this name. The lookup is a perfect hash.
+    static   EEnum       fromString(const char* name, size_t size);
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool        operator==(const EEnum& rValue)           const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool        operator!=(const EEnum& rValue)           const;
+
+    // static methods for enum class objects
+    static const EEnum invalid();
+    static const EEnum value1 ();
+    static const EEnum value2 ();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid = 0,
+        kValue1  = 1,
+        kValue2  = 2,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class Item1
+{
+public:
+    // Default constructor
+            Item1 ();
+    // Destructor
+    /*lax*/ ~Item1();
+};
+
+class Item2 : public Item1
+{
+public:
+    // Default constructor
+                      Item2   ();
+    // Destructor
+    /*lax*/           ~Item2  ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Item2SPtr downcast(const Item1SPtr& object);
+};
+
+class Structure1
+{
+public:
+    // Default constructor
+            Structure1 ();
+    // Destructor
+    /*lax*/ ~Structure1();
+
+    // This enumeration class provides namespaced set of constant values.
+    class EWeak
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             EWeak     ( );
+        // Constructor from an integer value.
+                             EWeak     ( long value);
+
+        // Returns the integer value of the enum.
+               long          value     ( )                              const;
+        // Returns short name for a specified enum value
+        static const char*   shortName ( long value);
+        // Returns short name of the enum value
+               const char*   shortName ( )                              const;
+        // Returns the enum value with a specified short name or invalid if
+        // none of the values has this name. The lookup is a perfect hash.
+        static EWeak         fromString( const char* name, size_t size);
+        // Cast operator that casts the enum to its native type
+               operator long (         ) const;
+
+        // static methods for enum class objects
+        static const long invalid();
+        static const long value1 ();
+        static const long value2 ();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid = 0,
+            kValue1  = 1,
+            kValue2  = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // This enumeration class provides namespaced set of constant values.
+    // It is designed to provide type control over operations with enum
+    // values without need to wait all compilers you are going to use for
+    // this project to support C++0x standard. The type control do not
+    // prevent the variables to be used in switch statements.
+    class EStrong
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             EStrong   ();
+        // Constructor from an integer value.
+        // Note: Avoid using this constructor if possible. It is
+        // appropriate only in case of importing value from components that
+        // you do not have control over (such as 3rd party libraries or
+        // serialization functionality).
+        explicit             EStrong   (long value);
+
+        // Returns the integer value of the enum.
+        // Note: Avoid using this method if possible. It is appropriate
+        // only in case of exporting value to components that you do not
+        // have control over (such as 3rd party libraries or serialization
+        // functionality).
+                 long        value     ()                              const;
+        // Returns short name for a specified enum value
+        static   const char* shortName (long value);
+        // Returns short name of the enum value
+                 const char* shortName ()                              const;
+        // Returns the enum value with a specified short name or invalid if
+        // none of the values has this name. The lookup is a perfect hash.
+        static   EStrong     fromString(const char* name, size_t size);
+        // returns true if the value of the enum is equal to the value of
+        // the argument
+                 bool        operator==(const EStrong& rValue)         const;
+        // returns true if the value of the enum is not equal to the value
+        // of the argument
+                 bool        operator!=(const EStrong& rValue)         const;
+
+        // static methods for enum class objects
+        static const EStrong invalid();
+        static const EStrong value1 ();
+        static const EStrong value2 ();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid = 0,
+            kValue1  = 1,
+            kValue2  = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // Getter method for the data field i1
+    long                      i1           ()                              const;
+    // Setter method for the data field i1
+    Structure1&               set_i1       (long i1);
+    // Store operator for the data field i1
+    Structure1&               operator<<   (long i1);
+
+    // Getter method for the data field w1
+    const EWeak&              w1           ()                              const;
+    // Setter method for the data field w1
+    Structure1&               set_w1       (const EWeak& w1);
+    // Provides mutable access to field w1
+    EWeak&                    mutable_w1   ();
+    // Store operator for the data field w1
+    Structure1&               operator<<   (const EWeak& w1);
+
+    // Getter method for the data field s1
+    const EStrong&            s1           ()                              const;
+    // Setter method for the data field s1
+    Structure1&               set_s1       (const EStrong& s1);
+    // Provides mutable access to field s1
+    EStrong&                  mutable_s1   ();
+    // Store operator for the data field s1
+    Structure1&               operator<<   (const EStrong& s1);
+
+    // Getter method for the data field item1
+    const Item1&              item1        ()                              const;
+    // Setter method for the data field item1
+    Structure1&               set_item1    (const Item1& item1);
+    // Provides mutable access to field item1
+    Item1&                    mutable_item1();
+    // Store operator for the data field item1
+    Structure1&               operator<<   (const Item1& item1);
+
+    // Getter method for the data field refItem1
+    const Item1SPtr&          refItem1     ()                              const;
+    // Setter method for the data field refItem1
+    Structure1&               set_refItem1 (const Item1SPtr& refItem1);
+    // Store operator for the data field refItem1
+    Structure1&               operator<<   (const Item1SPtr& refItem1);
+
+    // Getter method for the data field es1
+    const std::vector<EEnum>& es1          ()                              const;
+    // Setter method for the data field es1
+    Structure1&               set_es1      (const std::vector<EEnum>& es1);
+    // Provides mutable access to field es1
+    std::vector<EEnum>&       mutable_es1  ();
+    // Store operator for the data field es1
+    Structure1&               operator<<   (const std::vector<EEnum>& es1);
+    // Store operator for an item of data field es1
+    Structure1&               operator<<   (const EEnum& es1Item);
+
+private:
+    // variable for the data field i1
+    long               mI1;
+    // variable for the data field w1
+    EWeak              mW1;
+    // variable for the data field s1
+    EStrong            mS1;
+    // variable for the data field item1
+    Item1              mItem1;
+    // variable for the data field refItem1
+    Item1SPtr          mRefItem1;
+    // variable for the data field es1
+    std::vector<EEnum> mEs1;
+};
+
+// Reference store operator for the data field i1
+const Structure1SPtr& operator<<(const Structure1SPtr& , long );
+// Reference store operator for the data field w1
+const Structure1SPtr& operator<<(const Structure1SPtr& , const Structure1::EWeak& );
+// Reference store operator for the data field s1
+const Structure1SPtr& operator<<(const Structure1SPtr& , const Structure1::EStrong& );
+// Reference store operator for the data field item1
+const Structure1SPtr& operator<<(const Structure1SPtr& , const Item1& );
+// Reference store operator for the data field refItem1
+const Structure1SPtr& operator<<(const Structure1SPtr& , const Item1SPtr& );
+// Reference store operator for the data field es1
+const Structure1SPtr& operator<<(const Structure1SPtr& , const std::vector<EEnum>& );
+// Reference store operator for an item of data field es1
+const Structure1SPtr& operator<<(const Structure1SPtr& , const EEnum& );
+
+// Structure1Columns holds Structure1 objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure1Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                            Row     (const Structure1Columns& columns, size_t index);
+
+        // Getter method for the data field i1
+                                 long                       i1      ()                                               const;
+
+        // Getter method for the data field w1
+                                 const Structure1::EWeak&   w1      ()                                               const;
+
+        // Getter method for the data field s1
+                                 const Structure1::EStrong& s1      ()                                               const;
+
+        // Getter method for the data field item1
+                                 const Item1&               item1   ()                                               const;
+
+        // Getter method for the data field refItem1
+                                 const Item1SPtr&           refItem1()                                               const;
+
+        // Getter method for the data field es1
+                                 const std::vector<EEnum>&  es1     ()                                               const;
+    private:
+        const Structure1Columns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                                            Structure1Columns ();
+    // Destructor
+                                            ~Structure1Columns();
+
+    // Returns the number of the rows
+    size_t                                  size              ()                         const;
+    // Returns true if there are no rows
+    bool                                    empty             ()                         const;
+    // Reserves memory for size rows in every column
+    void                                    reserve           (size_t size);
+    // Removes all the rows
+    void                                    clear             ();
+
+    // Appends a row with the data fields of the object
+    void                                    push_back         (const Structure1& object);
+
+    // Returns proxy of the row index
+    Row                                     operator[]        (size_t index)             const;
+
+    // Column of the data field i1
+    const std::vector<long>&                i1                ()                         const;
+
+    // Column of the data field w1
+    const std::vector<Structure1::EWeak>&   w1                ()                         const;
+
+    // Column of the data field s1
+    const std::vector<Structure1::EStrong>& s1                ()                         const;
+
+    // Column of the data field item1
+    const std::vector<Item1>&               item1             ()                         const;
+
+    // Column of the data field refItem1
+    const std::vector<Item1SPtr>&           refItem1          ()                         const;
+
+    // Column of the data field es1
+    const std::vector<std::vector<EEnum> >& es1               ()                         const;
+
+private:
+    // column of the data field i1
+    std::vector<long>                mI1;
+    // column of the data field w1
+    std::vector<Structure1::EWeak>   mW1;
+    // column of the data field s1
+    std::vector<Structure1::EStrong> mS1;
+    // column of the data field item1
+    std::vector<Item1>               mItem1;
+    // column of the data field refItem1
+    std::vector<Item1SPtr>           mRefItem1;
+    // column of the data field es1
+    std::vector<std::vector<EEnum> > mEs1;
+};
+
+class Structure2 : public Structure1
+{
+public:
+    // Default constructor
+                           Structure2  ();
+    // Destructor
+    /*lax*/                ~Structure2 ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2SPtr downcast    (const Structure1SPtr& object);
+
+    // Setter method for the data field i1
+            Structure2&    set_i1      (long i1);
+    // Store operator for the data field i1
+            Structure2&    operator<<  (long i1);
+
+    // Setter method for the data field w1
+            Structure2&    set_w1      (const EWeak& w1);
+    // Store operator for the data field w1
+            Structure2&    operator<<  (const EWeak& w1);
+
+    // Setter method for the data field s1
+            Structure2&    set_s1      (const EStrong& s1);
+    // Store operator for the data field s1
+            Structure2&    operator<<  (const EStrong& s1);
+
+    // Setter method for the data field item1
+            Structure2&    set_item1   (const Item1& item1);
+    // Store operator for the data field item1
+            Structure2&    operator<<  (const Item1& item1);
+
+    // Setter method for the data field refItem1
+            Structure2&    set_refItem1(const Item1SPtr& refItem1);
+    // Store operator for the data field refItem1
+            Structure2&    operator<<  (const Item1SPtr& refItem1);
+
+    // Setter method for the data field es1
+            Structure2&    set_es1     (const std::vector<EEnum>& es1);
+    // Store operator for the data field es1
+            Structure2&    operator<<  (const std::vector<EEnum>& es1);
+    // Store operator for an item of data field es1
+            Structure2&    operator<<  (const EEnum& es1Item);
+};
+
+// Reference store operator for the data field i1
+const Structure2SPtr& operator<<(const Structure2SPtr& , long );
+// Reference store operator for the data field w1
+const Structure2SPtr& operator<<(const Structure2SPtr& , const Structure1::EWeak& );
+// Reference store operator for the data field s1
+const Structure2SPtr& operator<<(const Structure2SPtr& , const Structure1::EStrong& );
+// Reference store operator for the data field item1
+const Structure2SPtr& operator<<(const Structure2SPtr& , const Item1& );
+// Reference store operator for the data field refItem1
+const Structure2SPtr& operator<<(const Structure2SPtr& , const Item1SPtr& );
+// Reference store operator for the data field es1
+const Structure2SPtr& operator<<(const Structure2SPtr& , const std::vector<EEnum>& );
+// Reference store operator for an item of data field es1
+const Structure2SPtr& operator<<(const Structure2SPtr& , const EEnum& );
+
+// Structure2Columns holds Structure2 objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure2Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                            Row     (const Structure2Columns& columns, size_t index);
+
+        // Getter method for the data field i1
+                                 long                       i1      ()                                               const;
+
+        // Getter method for the data field w1
+                                 const Structure1::EWeak&   w1      ()                                               const;
+
+        // Getter method for the data field s1
+                                 const Structure1::EStrong& s1      ()                                               const;
+
+        // Getter method for the data field item1
+                                 const Item1&               item1   ()                                               const;
+
+        // Getter method for the data field refItem1
+                                 const Item1SPtr&           refItem1()                                               const;
+
+        // Getter method for the data field es1
+                                 const std::vector<EEnum>&  es1     ()                                               const;
+    private:
+        const Structure2Columns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                                            Structure2Columns ();
+    // Destructor
+                                            ~Structure2Columns();
+
+    // Returns the number of the rows
+    size_t                                  size              ()                         const;
+    // Returns true if there are no rows
+    bool                                    empty             ()                         const;
+    // Reserves memory for size rows in every column
+    void                                    reserve           (size_t size);
+    // Removes all the rows
+    void                                    clear             ();
+
+    // Appends a row with the data fields of the object
+    void                                    push_back         (const Structure2& object);
+
+    // Returns proxy of the row index
+    Row                                     operator[]        (size_t index)             const;
+
+    // Column of the data field i1
+    const std::vector<long>&                i1                ()                         const;
+
+    // Column of the data field w1
+    const std::vector<Structure1::EWeak>&   w1                ()                         const;
+
+    // Column of the data field s1
+    const std::vector<Structure1::EStrong>& s1                ()                         const;
+
+    // Column of the data field item1
+    const std::vector<Item1>&               item1             ()                         const;
+
+    // Column of the data field refItem1
+    const std::vector<Item1SPtr>&           refItem1          ()                         const;
+
+    // Column of the data field es1
+    const std::vector<std::vector<EEnum> >& es1               ()                         const;
+
+private:
+    // column of the data field i1
+    std::vector<long>                mI1;
+    // column of the data field w1
+    std::vector<Structure1::EWeak>   mW1;
+    // column of the data field s1
+    std::vector<Structure1::EStrong> mS1;
+    // column of the data field item1
+    std::vector<Item1>               mItem1;
+    // column of the data field refItem1
+    std::vector<Item1SPtr>           mRefItem1;
+    // column of the data field es1
+    std::vector<std::vector<EEnum> > mEs1;
+};
+
+// IStructure1 is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class IStructure1
+{
+public:
+    class EWeak;
+    class EStrong;
+
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void                operator=    (const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                    Builder      ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                    Builder      (const IStructure1& object);
+        // Destructor of Builder
+        /*lax*/                     ~Builder     ();
+
+        // Instantiates IStructure1 instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const IStructure1&  build        ()                              const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                IStructure1SPtr     finalize     ();
+
+
+        // Setter method for the data field i1
+                Builder&            set_i1       (long i1);
+        // Store operator for the data field i1
+                Builder&            operator<<   (long i1);
+
+        // Setter method for the data field w1
+                Builder&            set_w1       (const EWeak& w1);
+        // Provides mutable access to field w1
+                EWeak&              mutable_w1   ();
+        // Store operator for the data field w1
+                Builder&            operator<<   (const EWeak& w1);
+
+        // Setter method for the data field s1
+                Builder&            set_s1       (const EStrong& s1);
+        // Provides mutable access to field s1
+                EStrong&            mutable_s1   ();
+        // Store operator for the data field s1
+                Builder&            operator<<   (const EStrong& s1);
+
+        // Setter method for the data field item1
+                Builder&            set_item1    (const Item1& item1);
+        // Provides mutable access to field item1
+                Item1&              mutable_item1();
+        // Store operator for the data field item1
+                Builder&            operator<<   (const Item1& item1);
+
+        // Setter method for the data field refItem1
+                Builder&            set_refItem1 (const Item1SPtr& refItem1);
+        // Store operator for the data field refItem1
+                Builder&            operator<<   (const Item1SPtr& refItem1);
+
+        // Setter method for the data field es1
+                Builder&            set_es1      (const std::vector<EEnum>& es1);
+        // Provides mutable access to field es1
+                std::vector<EEnum>& mutable_es1  ();
+        // Store operator for the data field es1
+                Builder&            operator<<   (const std::vector<EEnum>& es1);
+        // Store operator for an item of data field es1
+                Builder&            operator<<   (const EEnum& es1Item);
+
+    protected:
+        // constructor needed from potential derived classes
+                                    Builder      (IStructure1RPtr pObject);
+
+        IStructure1RPtr mpObject;
+    };
+
+    // Default constructor
+            IStructure1 ();
+    // Destructor
+    /*lax*/ ~IStructure1();
+
+    // This enumeration class provides namespaced set of constant values.
+    class EWeak
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             EWeak     ( );
+        // Constructor from an integer value.
+                             EWeak     ( long value);
+
+        // Returns the integer value of the enum.
+               long          value     ( )                              const;
+        // Returns short name for a specified enum value
+        static const char*   shortName ( long value);
+        // Returns short name of the enum value
+               const char*   shortName ( )                              const;
+        // Returns the enum value with a specified short name or invalid if
+        // none of the values has this name. The lookup is a perfect hash.
+        static EWeak         fromString( const char* name, size_t size);
+        // Cast operator that casts the enum to its native type
+               operator long (         ) const;
+
+        // static methods for enum class objects
+        static const long invalid();
+        static const long value1 ();
+        static const long value2 ();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid = 0,
+            kValue1  = 1,
+            kValue2  = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // This enumeration class provides namespaced set of constant values.
+    // It is designed to provide type control over operations with enum
+    // values without need to wait all compilers you are going to use for
+    // this project to support C++0x standard. The type control do not
+    // prevent the variables to be used in switch statements.
+    class EStrong
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             EStrong   ();
+        // Constructor from an integer value.
+        // Note: Avoid using this constructor if possible. It is
+        // appropriate only in case of importing value from components that
+        // you do not have control over (such as 3rd party libraries or
+        // serialization functionality).
+        explicit             EStrong   (long value);
+
+        // Returns the integer value of the enum.
+        // Note: Avoid using this method if possible. It is appropriate
+        // only in case of exporting value to components that you do not
+        // have control over (such as 3rd party libraries or serialization
+        // functionality).
+                 long        value     ()                              const;
+        // Returns short name for a specified enum value
+        static   const char* shortName (long value);
+        // Returns short name of the enum value
+                 const char* shortName ()                              const;
+        // Returns the enum value with a specified short name or invalid if
+        // none of the values has this name. The lookup is a perfect hash.
+        static   EStrong     fromString(const char* name, size_t size);
+        // returns true if the value of the enum is equal to the value of
+        // the argument
+                 bool        operator==(const EStrong& rValue)         const;
+        // returns true if the value of the enum is not equal to the value
+        // of the argument
+                 bool        operator!=(const EStrong& rValue)         const;
+
+        // static methods for enum class objects
+        static const EStrong invalid();
+        static const EStrong value1 ();
+        static const EStrong value2 ();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid = 0,
+            kValue1  = 1,
+            kValue2  = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // Getter method for the data field i1
+    long                      i1      () const;
+
+    // Getter method for the data field w1
+    const EWeak&              w1      () const;
+
+    // Getter method for the data field s1
+    const EStrong&            s1      () const;
+
+    // Getter method for the data field item1
+    const Item1&              item1   () const;
+
+    // Getter method for the data field refItem1
+    const Item1SPtr&          refItem1() const;
+
+    // Getter method for the data field es1
+    const std::vector<EEnum>& es1     () const;
+
+private:
+    // variable for the data field i1
+    long                              mI1;
+    // variable for the data field w1
+    EWeak                             mW1;
+    // variable for the data field s1
+    EStrong                           mS1;
+    // variable for the data field item1
+    Item1                             mItem1;
+    // variable for the data field refItem1
+    Item1SPtr                         mRefItem1;
+    // variable for the data field es1
+    shared_value<std::vector<EEnum> > mEs1;
+};
+
+// Holder of the current IStructure1 shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<IStructure1> IStructure1Snapshot;
+
+// IStructure1Columns holds IStructure1 objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class IStructure1Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                              Row     (const IStructure1Columns& columns, size_t index);
+
+        // Getter method for the data field i1
+                                  long                        i1      ()                                                const;
+
+        // Getter method for the data field w1
+                                  const IStructure1::EWeak&   w1      ()                                                const;
+
+        // Getter method for the data field s1
+                                  const IStructure1::EStrong& s1      ()                                                const;
+
+        // Getter method for the data field item1
+                                  const Item1&                item1   ()                                                const;
+
+        // Getter method for the data field refItem1
+                                  const Item1SPtr&            refItem1()                                                const;
+
+        // Getter method for the data field es1
+                                  const std::vector<EEnum>&   es1     ()                                                const;
+    private:
+        const IStructure1Columns& mColumns;
+        size_t                    mIndex;
+    };
+
+    // Default constructor
+                                             IStructure1Columns ();
+    // Destructor
+                                             ~IStructure1Columns();
+
+    // Returns the number of the rows
+    size_t                                   size               ()                                    const;
+    // Returns true if there are no rows
+    bool                                     empty              ()                                    const;
+    // Reserves memory for size rows in every column
+    void                                     reserve            (size_t size);
+    // Removes all the rows
+    void                                     clear              ();
+
+    // Appends a row with the data fields of the object
+    void                                     push_back          (const IStructure1& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                                     push_back          (const IStructure1::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                                      operator[]         (size_t index)                        const;
+
+    // Column of the data field i1
+    const std::vector<long>&                 i1                 ()                                    const;
+
+    // Column of the data field w1
+    const std::vector<IStructure1::EWeak>&   w1                 ()                                    const;
+
+    // Column of the data field s1
+    const std::vector<IStructure1::EStrong>& s1                 ()                                    const;
+
+    // Column of the data field item1
+    const std::vector<Item1>&                item1              ()                                    const;
+
+    // Column of the data field refItem1
+    const std::vector<Item1SPtr>&            refItem1           ()                                    const;
+
+    // Column of the data field es1
+    const std::vector<std::vector<EEnum> >&  es1                ()                                    const;
+
+private:
+    // column of the data field i1
+    std::vector<long>                 mI1;
+    // column of the data field w1
+    std::vector<IStructure1::EWeak>   mW1;
+    // column of the data field s1
+    std::vector<IStructure1::EStrong> mS1;
+    // column of the data field item1
+    std::vector<Item1>                mItem1;
+    // column of the data field refItem1
+    std::vector<Item1SPtr>            mRefItem1;
+    // column of the data field es1
+    std::vector<std::vector<EEnum> >  mEs1;
+};
+
+// IStructure2 is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class IStructure2 : public IStructure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder : public IStructure1::Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void               operator=   (const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                   Builder     ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                   Builder     (const IStructure2& object);
+        // Destructor of Builder
+        /*lax*/                    ~Builder    ();
+
+        // Instantiates IStructure2 instance with the current
+        // initialization of the fields. After the instance is ready the
+        // builder could be reused to instantiate more objects. The data is
+        // not reset. Second call of build() will instantiate object with
+        // the same data.
+                const IStructure2& build       ()                              const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                IStructure2SPtr    finalize    ();
+
+
+        // Setter method for the data field i1
+                Builder&           set_i1      (long i1);
+        // Store operator for the data field i1
+                Builder&           operator<<  (long i1);
+
+        // Setter method for the data field w1
+                Builder&           set_w1      (const EWeak& w1);
+        // Store operator for the data field w1
+                Builder&           operator<<  (const EWeak& w1);
+
+        // Setter method for the data field s1
+                Builder&           set_s1      (const EStrong& s1);
+        // Store operator for the data field s1
+                Builder&           operator<<  (const EStrong& s1);
+
+        // Setter method for the data field item1
+                Builder&           set_item1   (const Item1& item1);
+        // Store operator for the data field item1
+                Builder&           operator<<  (const Item1& item1);
+
+        // Setter method for the data field refItem1
+                Builder&           set_refItem1(const Item1SPtr& refItem1);
+        // Store operator for the data field refItem1
+                Builder&           operator<<  (const Item1SPtr& refItem1);
+
+        // Setter method for the data field es1
+                Builder&           set_es1     (const std::vector<EEnum>& es1);
+        // Store operator for the data field es1
+                Builder&           operator<<  (const std::vector<EEnum>& es1);
+        // Store operator for an item of data field es1
+                Builder&           operator<<  (const EEnum& es1Item);
+
+    protected:
+        // constructor needed from potential derived classes
+                                   Builder     (IStructure2RPtr pObject);
+    };
+
+    // Default constructor
+                            IStructure2 ();
+    // Destructor
+    /*lax*/                 ~IStructure2();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  IStructure2SPtr downcast    (const IStructure1SPtr& object);
+};
+
+// Holder of the current IStructure2 shared between threads. The readers
+// get the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<IStructure2> IStructure2Snapshot;
+
+// IStructure2Columns holds IStructure2 objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class IStructure2Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                              Row     (const IStructure2Columns& columns, size_t index);
+
+        // Getter method for the data field i1
+                                  long                        i1      ()                                                const;
+
+        // Getter method for the data field w1
+                                  const IStructure1::EWeak&   w1      ()                                                const;
+
+        // Getter method for the data field s1
+                                  const IStructure1::EStrong& s1      ()                                                const;
+
+        // Getter method for the data field item1
+                                  const Item1&                item1   ()                                                const;
+
+        // Getter method for the data field refItem1
+                                  const Item1SPtr&            refItem1()                                                const;
+
+        // Getter method for the data field es1
+                                  const std::vector<EEnum>&   es1     ()                                                const;
+    private:
+        const IStructure2Columns& mColumns;
+        size_t                    mIndex;
+    };
+
+    // Default constructor
+                                             IStructure2Columns ();
+    // Destructor
+                                             ~IStructure2Columns();
+
+    // Returns the number of the rows
+    size_t                                   size               ()                                    const;
+    // Returns true if there are no rows
+    bool                                     empty              ()                                    const;
+    // Reserves memory for size rows in every column
+    void                                     reserve            (size_t size);
+    // Removes all the rows
+    void                                     clear              ();
+
+    // Appends a row with the data fields of the object
+    void                                     push_back          (const IStructure2& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                                     push_back          (const IStructure2::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                                      operator[]         (size_t index)                        const;
+
+    // Column of the data field i1
+    const std::vector<long>&                 i1                 ()                                    const;
+
+    // Column of the data field w1
+    const std::vector<IStructure1::EWeak>&   w1                 ()                                    const;
+
+    // Column of the data field s1
+    const std::vector<IStructure1::EStrong>& s1                 ()                                    const;
+
+    // Column of the data field item1
+    const std::vector<Item1>&                item1              ()                                    const;
+
+    // Column of the data field refItem1
+    const std::vector<Item1SPtr>&            refItem1           ()                                    const;
+
+    // Column of the data field es1
+    const std::vector<std::vector<EEnum> >&  es1                ()                                    const;
+
+private:
+    // column of the data field i1
+    std::vector<long>                 mI1;
+    // column of the data field w1
+    std::vector<IStructure1::EWeak>   mW1;
+    // column of the data field s1
+    std::vector<IStructure1::EStrong> mS1;
+    // column of the data field item1
+    std::vector<Item1>                mItem1;
+    // column of the data field refItem1
+    std::vector<Item1SPtr>            mRefItem1;
+    // column of the data field es1
+    std::vector<std::vector<EEnum> >  mEs1;
+};
+
+inline Structure1SPtr structure1Ref()
+{
+    return boost::make_shared<Structure1>();
+}
+
+inline Structure2SPtr structure2Ref()
+{
+    return boost::make_shared<Structure2>();
+}
+
+}
+
+#endif // __STRUCTURE_STREAMABLE_COMPIL_H_
+
@@ -0,0 +1,8 @@
+// Unity translation unit of the package structure (1 of 2)
+
+#include "columns.cpp"
+#include "field_override.cpp"
+#include "from_string.cpp"
+#include "identification.cpp"
+#include "pooled.cpp"
+#include "upcopy.cpp"
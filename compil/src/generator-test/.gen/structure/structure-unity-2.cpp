@@ -0,0 +1,9 @@
+// Unity translation unit of the package structure (2 of 2)
+
+#include "inline_containers.cpp"
+#include "interned.cpp"
+#include "operator.cpp"
+#include "sanity.cpp"
+#include "snapshot.cpp"
+#include "streamable.cpp"
+#include "tracked.cpp"
@@ -0,0 +1,27 @@
+#ifndef __STRUCTURE_TRACKED_COMPIL__FWD_H_
+#define __STRUCTURE_TRACKED_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace tracked
+{
+
+// Forward declarations
+class Account;
+typedef Account*                         AccountRPtr;
+typedef boost::shared_ptr<Account>       AccountSPtr;
+typedef boost::shared_ptr<const Account> AccountSCPtr;
+typedef boost::weak_ptr<Account>         AccountWPtr;
+
+class SavingsAccount;
+typedef SavingsAccount*                         SavingsAccountRPtr;
+typedef boost::shared_ptr<SavingsAccount>       SavingsAccountSPtr;
+typedef boost::shared_ptr<const SavingsAccount> SavingsAccountSCPtr;
+typedef boost::weak_ptr<SavingsAccount>         SavingsAccountWPtr;
+
+}
+
+#endif // __STRUCTURE_TRACKED_COMPIL__FWD_H_
+
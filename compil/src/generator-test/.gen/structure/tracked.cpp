@@ -0,0 +1,719 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#include "structure/tracked.h"
+
+namespace tracked
+{
+
+int Account::bitmask_id()
+{
+    return 0x1;
+}
+
+int Account::bitmask_owner()
+{
+    return 0x2;
+}
+
+int Account::bitmask_limit()
+{
+    return 0x4;
+}
+
+int Account::bitmask_history()
+{
+    return 0x8;
+}
+
+Account::Account()
+        : mBits    (0)
+        , mModified(0)
+        , mLimit   (default_limit())
+{
+}
+
+Account::~Account()
+{
+}
+
+bool Account::isInitialized() const
+{
+    if (!valid_id()) return false;
+    return true;
+}
+
+long Account::id() const
+{
+    BOOST_ASSERT(valid_id());
+    return mId;
+}
+
+bool Account::valid_id() const
+{
+    return (mBits & bitmask_id()) != 0;
+}
+
+bool Account::modified_id() const
+{
+    return (mModified & bitmask_id()) != 0;
+}
+
+Account& Account::set_id(long id)
+{
+    mId        = id;
+    mBits     |= bitmask_id();
+    mModified |= bitmask_id();
+    return *this;
+}
+
+void Account::erase_id()
+{
+    mId        =  0;
+    mBits     &= ~bitmask_id();
+    mModified |=  bitmask_id();
+}
+
+const std::string& Account::owner() const
+{
+    BOOST_ASSERT(exist_owner());
+    return mOwner;
+}
+
+bool Account::exist_owner() const
+{
+    return (mBits & bitmask_owner()) != 0;
+}
+
+bool Account::modified_owner() const
+{
+    return (mModified & bitmask_owner()) != 0;
+}
+
+Account& Account::set_owner(const std::string& owner)
+{
+    mOwner     = owner;
+    mBits     |= bitmask_owner();
+    mModified |= bitmask_owner();
+    return *this;
+}
+
+std::string& Account::mutable_owner()
+{
+    mBits |= bitmask_owner();
+    mModified |= bitmask_owner();
+    return mOwner;
+}
+
+void Account::clear_owner()
+{
+    mOwner.clear();
+    mBits     &= ~bitmask_owner();
+    mModified |=  bitmask_owner();
+}
+
+long Account::limit() const
+{
+    return mLimit;
+}
+
+bool Account::changed_limit() const
+{
+    return (mBits & bitmask_limit()) != 0;
+}
+
+bool Account::modified_limit() const
+{
+    return (mModified & bitmask_limit()) != 0;
+}
+
+long Account::default_limit()
+{
+    return 100;
+}
+
+Account& Account::set_limit(long limit)
+{
+    mLimit     = limit;
+    mBits     |= bitmask_limit();
+    mModified |= bitmask_limit();
+    return *this;
+}
+
+Account& Account::update_limit(long limit)
+{
+    if (default_limit() != limit)
+        return set_limit(limit);
+
+    reset_limit();
+    return *this;
+}
+
+void Account::reset_limit()
+{
+    mLimit     =  default_limit();
+    mBits     &= ~bitmask_limit();
+    mModified |=  bitmask_limit();
+}
+
+const std::vector<long>& Account::history() const
+{
+    BOOST_ASSERT(exist_history());
+    return mHistory;
+}
+
+bool Account::exist_history() const
+{
+    return (mBits & bitmask_history()) != 0;
+}
+
+bool Account::modified_history() const
+{
+    return (mModified & bitmask_history()) != 0;
+}
+
+Account& Account::set_history(const std::vector<long>& history)
+{
+    mHistory   = history;
+    mBits     |= bitmask_history();
+    mModified |= bitmask_history();
+    return *this;
+}
+
+std::vector<long>& Account::mutable_history()
+{
+    mBits |= bitmask_history();
+    mModified |= bitmask_history();
+    return mHistory;
+}
+
+void Account::clear_history()
+{
+    mHistory.clear();
+    mBits     &= ~bitmask_history();
+    mModified |=  bitmask_history();
+}
+
+bool Account::isModified() const
+{
+    if (mModified != 0) return true;
+    return false;
+}
+
+void Account::checkpoint()
+{
+    mModified = 0;
+}
+
+Account Account::diff(const Account& object1, const Account& object2)
+{
+    Account delta;
+    object1.copyDifferences(object2, delta);
+    return delta;
+}
+
+void Account::applyDelta(const Account& delta)
+{
+    if (delta.modified_id())
+    {
+        if (delta.valid_id())
+            set_id(delta.id());
+        else
+            erase_id();
+    }
+    if (delta.modified_owner())
+    {
+        if (delta.exist_owner())
+            set_owner(delta.owner());
+        else
+            clear_owner();
+    }
+    if (delta.modified_limit())
+    {
+        if (delta.changed_limit())
+            set_limit(delta.limit());
+        else
+            reset_limit();
+    }
+    if (delta.modified_history())
+    {
+        if (delta.exist_history())
+            set_history(delta.history());
+        else
+            clear_history();
+    }
+}
+
+void Account::copyDifferences(const Account& object, Account& delta) const
+{
+    if (valid_id() != object.valid_id() || (valid_id() && !(id() == object.id())))
+    {
+        if (object.valid_id())
+            delta.set_id(object.id());
+        else
+            delta.erase_id();
+    }
+    if (exist_owner() != object.exist_owner() || (exist_owner() && !(owner() == object.owner())))
+    {
+        if (object.exist_owner())
+            delta.set_owner(object.owner());
+        else
+            delta.clear_owner();
+    }
+    if (changed_limit() != object.changed_limit() || (changed_limit() && !(limit() == object.limit())))
+    {
+        if (object.changed_limit())
+            delta.set_limit(object.limit());
+        else
+            delta.reset_limit();
+    }
+    if (exist_history() != object.exist_history() || (exist_history() && !(history() == object.history())))
+    {
+        if (object.exist_history())
+            delta.set_history(object.history());
+        else
+            delta.clear_history();
+    }
+}
+
+AccountColumns::Row::Row(const AccountColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long AccountColumns::Row::id() const
+{
+    return mColumns.id()[mIndex];
+}
+
+bool AccountColumns::Row::valid_id() const
+{
+    return mColumns.valid_id()[mIndex];
+}
+
+const std::string& AccountColumns::Row::owner() const
+{
+    return mColumns.owner()[mIndex];
+}
+
+bool AccountColumns::Row::exist_owner() const
+{
+    return mColumns.exist_owner()[mIndex];
+}
+
+long AccountColumns::Row::limit() const
+{
+    return mColumns.limit()[mIndex];
+}
+
+const std::vector<long>& AccountColumns::Row::history() const
+{
+    return mColumns.history()[mIndex];
+}
+
+bool AccountColumns::Row::exist_history() const
+{
+    return mColumns.exist_history()[mIndex];
+}
+
+AccountColumns::AccountColumns()
+{
+}
+
+AccountColumns::~AccountColumns()
+{
+}
+
+size_t AccountColumns::size() const
+{
+    return mId.size();
+}
+
+bool AccountColumns::empty() const
+{
+    return mId.empty();
+}
+
+void AccountColumns::reserve(size_t size)
+{
+    mId.reserve(size);
+    mIdAvailability.reserve(size);
+    mOwner.reserve(size);
+    mOwnerAvailability.reserve(size);
+    mLimit.reserve(size);
+    mHistory.reserve(size);
+    mHistoryAvailability.reserve(size);
+}
+
+void AccountColumns::clear()
+{
+    mId.clear();
+    mIdAvailability.clear();
+    mOwner.clear();
+    mOwnerAvailability.clear();
+    mLimit.clear();
+    mHistory.clear();
+    mHistoryAvailability.clear();
+}
+
+void AccountColumns::push_back(const Account& object)
+{
+    mIdAvailability.push_back(object.valid_id());
+    if (mIdAvailability.back())
+        mId.push_back(object.id());
+    else
+        mId.resize(mId.size() + 1);
+    mOwnerAvailability.push_back(object.exist_owner());
+    if (mOwnerAvailability.back())
+        mOwner.push_back(object.owner());
+    else
+        mOwner.resize(mOwner.size() + 1);
+    mLimit.push_back(object.limit());
+    mHistoryAvailability.push_back(object.exist_history());
+    if (mHistoryAvailability.back())
+        mHistory.push_back(object.history());
+    else
+        mHistory.resize(mHistory.size() + 1);
+}
+
+AccountColumns::Row AccountColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& AccountColumns::id() const
+{
+    return mId;
+}
+
+const std::vector<bool>& AccountColumns::valid_id() const
+{
+    return mIdAvailability;
+}
+
+const std::vector<std::string>& AccountColumns::owner() const
+{
+    return mOwner;
+}
+
+const std::vector<bool>& AccountColumns::exist_owner() const
+{
+    return mOwnerAvailability;
+}
+
+const std::vector<long>& AccountColumns::limit() const
+{
+    return mLimit;
+}
+
+const std::vector<std::vector<long> >& AccountColumns::history() const
+{
+    return mHistory;
+}
+
+const std::vector<bool>& AccountColumns::exist_history() const
+{
+    return mHistoryAvailability;
+}
+
+int SavingsAccount::bitmask_rate()
+{
+    return 0x1;
+}
+
+SavingsAccount::SavingsAccount()
+        : mBits    (0)
+        , mModified(0)
+{
+}
+
+SavingsAccount::~SavingsAccount()
+{
+}
+
+SavingsAccountSPtr SavingsAccount::downcast(const AccountSPtr& object)
+{
+    return boost::static_pointer_cast<SavingsAccount>(object);
+}
+
+bool SavingsAccount::isInitialized() const
+{
+    if (!Account::isInitialized()) return false;
+    if (!valid_rate()) return false;
+    return true;
+}
+
+long SavingsAccount::rate() const
+{
+    BOOST_ASSERT(valid_rate());
+    return mRate;
+}
+
+bool SavingsAccount::valid_rate() const
+{
+    return (mBits & bitmask_rate()) != 0;
+}
+
+bool SavingsAccount::modified_rate() const
+{
+    return (mModified & bitmask_rate()) != 0;
+}
+
+SavingsAccount& SavingsAccount::set_rate(long rate)
+{
+    mRate      = rate;
+    mBits     |= bitmask_rate();
+    mModified |= bitmask_rate();
+    return *this;
+}
+
+void SavingsAccount::erase_rate()
+{
+    mRate      =  0;
+    mBits     &= ~bitmask_rate();
+    mModified |=  bitmask_rate();
+}
+
+SavingsAccount& SavingsAccount::set_id(long id)
+{
+    Account::set_id(id);
+    return *this;
+}
+
+SavingsAccount& SavingsAccount::set_owner(const std::string& owner)
+{
+    Account::set_owner(owner);
+    return *this;
+}
+
+SavingsAccount& SavingsAccount::set_limit(long limit)
+{
+    Account::set_limit(limit);
+    return *this;
+}
+
+SavingsAccount& SavingsAccount::set_history(const std::vector<long>& history)
+{
+    Account::set_history(history);
+    return *this;
+}
+
+bool SavingsAccount::isModified() const
+{
+    if (mModified != 0) return true;
+    return Account::isModified();
+}
+
+void SavingsAccount::checkpoint()
+{
+    Account::checkpoint();
+    mModified = 0;
+}
+
+SavingsAccount SavingsAccount::diff(const SavingsAccount& object1, const SavingsAccount& object2)
+{
+    SavingsAccount delta;
+    object1.copyDifferences(object2, delta);
+    return delta;
+}
+
+void SavingsAccount::applyDelta(const SavingsAccount& delta)
+{
+    Account::applyDelta(delta);
+    if (delta.modified_rate())
+    {
+        if (delta.valid_rate())
+            set_rate(delta.rate());
+        else
+            erase_rate();
+    }
+}
+
+void SavingsAccount::copyDifferences(const SavingsAccount& object, SavingsAccount& delta) const
+{
+    Account::copyDifferences(object, delta);
+    if (valid_rate() != object.valid_rate() || (valid_rate() && !(rate() == object.rate())))
+    {
+        if (object.valid_rate())
+            delta.set_rate(object.rate());
+        else
+            delta.erase_rate();
+    }
+}
+
+SavingsAccountColumns::Row::Row(const SavingsAccountColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long SavingsAccountColumns::Row::id() const
+{
+    return mColumns.id()[mIndex];
+}
+
+bool SavingsAccountColumns::Row::valid_id() const
+{
+    return mColumns.valid_id()[mIndex];
+}
+
+const std::string& SavingsAccountColumns::Row::owner() const
+{
+    return mColumns.owner()[mIndex];
+}
+
+bool SavingsAccountColumns::Row::exist_owner() const
+{
+    return mColumns.exist_owner()[mIndex];
+}
+
+long SavingsAccountColumns::Row::limit() const
+{
+    return mColumns.limit()[mIndex];
+}
+
+const std::vector<long>& SavingsAccountColumns::Row::history() const
+{
+    return mColumns.history()[mIndex];
+}
+
+bool SavingsAccountColumns::Row::exist_history() const
+{
+    return mColumns.exist_history()[mIndex];
+}
+
+long SavingsAccountColumns::Row::rate() const
+{
+    return mColumns.rate()[mIndex];
+}
+
+bool SavingsAccountColumns::Row::valid_rate() const
+{
+    return mColumns.valid_rate()[mIndex];
+}
+
+SavingsAccountColumns::SavingsAccountColumns()
+{
+}
+
+SavingsAccountColumns::~SavingsAccountColumns()
+{
+}
+
+size_t SavingsAccountColumns::size() const
+{
+    return mId.size();
+}
+
+bool SavingsAccountColumns::empty() const
+{
+    return mId.empty();
+}
+
+void SavingsAccountColumns::reserve(size_t size)
+{
+    mId.reserve(size);
+    mIdAvailability.reserve(size);
+    mOwner.reserve(size);
+    mOwnerAvailability.reserve(size);
+    mLimit.reserve(size);
+    mHistory.reserve(size);
+    mHistoryAvailability.reserve(size);
+    mRate.reserve(size);
+    mRateAvailability.reserve(size);
+}
+
+void SavingsAccountColumns::clear()
+{
+    mId.clear();
+    mIdAvailability.clear();
+    mOwner.clear();
+    mOwnerAvailability.clear();
+    mLimit.clear();
+    mHistory.clear();
+    mHistoryAvailability.clear();
+    mRate.clear();
+    mRateAvailability.clear();
+}
+
+void SavingsAccountColumns::push_back(const SavingsAccount& object)
+{
+    mIdAvailability.push_back(object.valid_id());
+    if (mIdAvailability.back())
+        mId.push_back(object.id());
+    else
+        mId.resize(mId.size() + 1);
+    mOwnerAvailability.push_back(object.exist_owner());
+    if (mOwnerAvailability.back())
+        mOwner.push_back(object.owner());
+    else
+        mOwner.resize(mOwner.size() + 1);
+    mLimit.push_back(object.limit());
+    mHistoryAvailability.push_back(object.exist_history());
+    if (mHistoryAvailability.back())
+        mHistory.push_back(object.history());
+    else
+        mHistory.resize(mHistory.size() + 1);
+    mRateAvailability.push_back(object.valid_rate());
+    if (mRateAvailability.back())
+        mRate.push_back(object.rate());
+    else
+        mRate.resize(mRate.size() + 1);
+}
+
+SavingsAccountColumns::Row SavingsAccountColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& SavingsAccountColumns::id() const
+{
+    return mId;
+}
+
+const std::vector<bool>& SavingsAccountColumns::valid_id() const
+{
+    return mIdAvailability;
+}
+
+const std::vector<std::string>& SavingsAccountColumns::owner() const
+{
+    return mOwner;
+}
+
+const std::vector<bool>& SavingsAccountColumns::exist_owner() const
+{
+    return mOwnerAvailability;
+}
+
+const std::vector<long>& SavingsAccountColumns::limit() const
+{
+    return mLimit;
+}
+
+const std::vector<std::vector<long> >& SavingsAccountColumns::history() const
+{
+    return mHistory;
+}
+
+const std::vector<bool>& SavingsAccountColumns::exist_history() const
+{
+    return mHistoryAvailability;
+}
+
+const std::vector<long>& SavingsAccountColumns::rate() const
+{
+    return mRate;
+}
+
+const std::vector<bool>& SavingsAccountColumns::valid_rate() const
+{
+    return mRateAvailability;
+}
+
+}
+
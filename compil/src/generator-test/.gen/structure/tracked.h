@@ -0,0 +1,410 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __STRUCTURE_TRACKED_COMPIL_H_
+#define __STRUCTURE_TRACKED_COMPIL_H_
+
+#include "structure/tracked-fwd.h"
+
+namespace tracked
+{
+
+class Account
+{
+public:
+    // Default constructor
+                                     Account         ();
+    // Destructor
+    /*lax*/                          ~Account        ();
+
+    // Returns true if every required field is initialized.
+            bool                     isInitialized   ()                                               const;
+
+    // Getter method for the data field id
+            long                     id              ()                                               const;
+    // Returns true if the data field id was set and could be considered
+    // valid
+            bool                     valid_id        ()                                               const;
+    // Returns true if the data field id was modified since the last
+    // checkpoint()
+            bool                     modified_id     ()                                               const;
+    // Setter method for the data field id
+            Account&                 set_id          (long id);
+    // Erases the required data field id. Object can not be instantiated
+    // before the field data is set again
+            void                     erase_id        ();
+
+    // Getter method for the data field owner
+            const std::string&       owner           ()                                               const;
+    // Checks if the optional field owner exists
+            bool                     exist_owner     ()                                               const;
+    // Returns true if the data field owner was modified since the last
+    // checkpoint()
+            bool                     modified_owner  ()                                               const;
+    // Setter method for the data field owner
+            Account&                 set_owner       (const std::string& owner);
+    // Provides mutable access to field owner
+            std::string&             mutable_owner   ();
+    // Clears the optional data field owner
+            void                     clear_owner     ();
+
+    // Getter method for the data field limit
+            long                     limit           ()                                               const;
+    // Returns true if the data field value limit was changed from its
+    // default value 100
+            bool                     changed_limit   ()                                               const;
+    // Returns true if the data field limit was modified since the last
+    // checkpoint()
+            bool                     modified_limit  ()                                               const;
+    // Returns the default value 100 of the field limit
+    static  long                     default_limit   ();
+    // Setter method for the data field limit
+            Account&                 set_limit       (long limit);
+    // Updates the data field limit. If the new value is equal to the
+    // default it clears the field else it sets it to the new value
+            Account&                 update_limit    (long limit);
+    // Resets the data field limit to its default value 100
+            void                     reset_limit     ();
+
+    // Getter method for the data field history
+            const std::vector<long>& history         ()                                               const;
+    // Checks if the optional field history exists
+            bool                     exist_history   ()                                               const;
+    // Returns true if the data field history was modified since the last
+    // checkpoint()
+            bool                     modified_history()                                               const;
+    // Setter method for the data field history
+            Account&                 set_history     (const std::vector<long>& history);
+    // Provides mutable access to field history
+            std::vector<long>&       mutable_history ();
+    // Clears the optional data field history
+            void                     clear_history   ();
+
+    // Returns true if any of the fields was modified since the last
+    // checkpoint()
+            bool                     isModified      ()                                               const;
+    // Forgets the modifications of the fields recorded so far
+            void                     checkpoint      ();
+    // Returns a delta that holds only the fields of object2 that differ
+    // from object1. They are marked as modified
+    static  Account                  diff            (const Account& object1, const Account& object2);
+    // Sets or clears the fields marked as modified in the delta. The other
+    // fields are not touched
+            void                     applyDelta      (const Account& delta);
+
+protected:
+    // Sets in the delta only the fields of the object that differ from
+    // this instance
+    void copyDifferences(const Account& object, Account& delta) const;
+
+private:
+    // Returns unique bitmask value for the field id
+    static int bitmask_id     ();
+    // Returns unique bitmask value for the field owner
+    static int bitmask_owner  ();
+    // Returns unique bitmask value for the field limit
+    static int bitmask_limit  ();
+    // Returns unique bitmask value for the field history
+    static int bitmask_history();
+
+    // Stores availability information for the fields
+    int               mBits;
+    // Stores the fields modified since the last checkpoint()
+    int               mModified;
+
+    // variable for the data field id
+    long              mId;
+    // variable for the data field owner
+    std::string       mOwner;
+    // variable for the data field limit
+    long              mLimit;
+    // variable for the data field history
+    std::vector<long> mHistory;
+};
+
+// AccountColumns holds Account objects column by column - one contiguous
+// array per data field. Use it for large collections that are scanned one
+// or two fields at a time. Such scan touches only the memory of the
+// columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class AccountColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                       Row          (const AccountColumns& columns, size_t index);
+
+        // Getter method for the data field id
+                              long                     id           ()                                            const;
+        // Returns true if the data field id is available in the row
+                              bool                     valid_id     ()                                            const;
+
+        // Getter method for the data field owner
+                              const std::string&       owner        ()                                            const;
+        // Returns true if the data field owner is available in the row
+                              bool                     exist_owner  ()                                            const;
+
+        // Getter method for the data field limit
+                              long                     limit        ()                                            const;
+
+        // Getter method for the data field history
+                              const std::vector<long>& history      ()                                            const;
+        // Returns true if the data field history is available in the row
+                              bool                     exist_history()                                            const;
+    private:
+        const AccountColumns& mColumns;
+        size_t                mIndex;
+    };
+
+    // Default constructor
+                                           AccountColumns ();
+    // Destructor
+                                           ~AccountColumns();
+
+    // Returns the number of the rows
+    size_t                                 size           ()                      const;
+    // Returns true if there are no rows
+    bool                                   empty          ()                      const;
+    // Reserves memory for size rows in every column
+    void                                   reserve        (size_t size);
+    // Removes all the rows
+    void                                   clear          ();
+
+    // Appends a row with the data fields of the object
+    void                                   push_back      (const Account& object);
+
+    // Returns proxy of the row index
+    Row                                    operator[]     (size_t index)          const;
+
+    // Column of the data field id
+    const std::vector<long>&               id             ()                      const;
+    // Availability bitmap of the data field id
+    const std::vector<bool>&               valid_id       ()                      const;
+
+    // Column of the data field owner
+    const std::vector<std::string>&        owner          ()                      const;
+    // Availability bitmap of the data field owner
+    const std::vector<bool>&               exist_owner    ()                      const;
+
+    // Column of the data field limit
+    const std::vector<long>&               limit          ()                      const;
+
+    // Column of the data field history
+    const std::vector<std::vector<long> >& history        ()                      const;
+    // Availability bitmap of the data field history
+    const std::vector<bool>&               exist_history  ()                      const;
+
+private:
+    // column of the data field id
+    std::vector<long>               mId;
+    // availability bitmap of the data field id
+    std::vector<bool>               mIdAvailability;
+    // column of the data field owner
+    std::vector<std::string>        mOwner;
+    // availability bitmap of the data field owner
+    std::vector<bool>               mOwnerAvailability;
+    // column of the data field limit
+    std::vector<long>               mLimit;
+    // column of the data field history
+    std::vector<std::vector<long> > mHistory;
+    // availability bitmap of the data field history
+    std::vector<bool>               mHistoryAvailability;
+};
+
+class SavingsAccount : public Account
+{
+public:
+    // Default constructor
+                               SavingsAccount ();
+    // Destructor
+    /*lax*/                    ~SavingsAccount();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  SavingsAccountSPtr downcast       (const AccountSPtr& object);
+
+    // Returns true if every required field is initialized.
+            bool               isInitialized  ()                                                             const;
+
+    // Getter method for the data field rate
+            long               rate           ()                                                             const;
+    // Returns true if the data field rate was set and could be considered
+    // valid
+            bool               valid_rate     ()                                                             const;
+    // Returns true if the data field rate was modified since the last
+    // checkpoint()
+            bool               modified_rate  ()                                                             const;
+    // Setter method for the data field rate
+            SavingsAccount&    set_rate       (long rate);
+    // Erases the required data field rate. Object can not be instantiated
+    // before the field data is set again
+            void               erase_rate     ();
+
+    // Setter method for the data field id
+            SavingsAccount&    set_id         (long id);
+
+    // Setter method for the data field owner
+            SavingsAccount&    set_owner      (const std::string& owner);
+
+    // Setter method for the data field limit
+            SavingsAccount&    set_limit      (long limit);
+
+    // Setter method for the data field history
+            SavingsAccount&    set_history    (const std::vector<long>& history);
+
+    // Returns true if any of the fields was modified since the last
+    // checkpoint()
+            bool               isModified     ()                                                             const;
+    // Forgets the modifications of the fields recorded so far
+            void               checkpoint     ();
+    // Returns a delta that holds only the fields of object2 that differ
+    // from object1. They are marked as modified
+    static  SavingsAccount     diff           (const SavingsAccount& object1, const SavingsAccount& object2);
+    // Sets or clears the fields marked as modified in the delta. The other
+    // fields are not touched
+            void               applyDelta     (const SavingsAccount& delta);
+
+protected:
+    // Sets in the delta only the fields of the object that differ from
+    // this instance
+    void copyDifferences(const SavingsAccount& object, SavingsAccount& delta) const;
+
+private:
+    // Returns unique bitmask value for the field rate
+    static int bitmask_rate();
+
+    // Stores availability information for the fields
+    int  mBits;
+    // Stores the fields modified since the last checkpoint()
+    int  mModified;
+
+    // variable for the data field rate
+    long mRate;
+};
+
+// SavingsAccountColumns holds SavingsAccount objects column by column -
+// one contiguous array per data field. Use it for large collections that
+// are scanned one or two fields at a time. Such scan touches only the
+// memory of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class SavingsAccountColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                              Row          (const SavingsAccountColumns& columns, size_t index);
+
+        // Getter method for the data field id
+                                     long                     id           ()                                                   const;
+        // Returns true if the data field id is available in the row
+                                     bool                     valid_id     ()                                                   const;
+
+        // Getter method for the data field owner
+                                     const std::string&       owner        ()                                                   const;
+        // Returns true if the data field owner is available in the row
+                                     bool                     exist_owner  ()                                                   const;
+
+        // Getter method for the data field limit
+                                     long                     limit        ()                                                   const;
+
+        // Getter method for the data field history
+                                     const std::vector<long>& history      ()                                                   const;
+        // Returns true if the data field history is available in the row
+                                     bool                     exist_history()                                                   const;
+
+        // Getter method for the data field rate
+                                     long                     rate         ()                                                   const;
+        // Returns true if the data field rate is available in the row
+                                     bool                     valid_rate   ()                                                   const;
+    private:
+        const SavingsAccountColumns& mColumns;
+        size_t                       mIndex;
+    };
+
+    // Default constructor
+                                           SavingsAccountColumns ();
+    // Destructor
+                                           ~SavingsAccountColumns();
+
+    // Returns the number of the rows
+    size_t                                 size                  ()                             const;
+    // Returns true if there are no rows
+    bool                                   empty                 ()                             const;
+    // Reserves memory for size rows in every column
+    void                                   reserve               (size_t size);
+    // Removes all the rows
+    void                                   clear                 ();
+
+    // Appends a row with the data fields of the object
+    void                                   push_back             (const SavingsAccount& object);
+
+    // Returns proxy of the row index
+    Row                                    operator[]            (size_t index)                 const;
+
+    // Column of the data field id
+    const std::vector<long>&               id                    ()                             const;
+    // Availability bitmap of the data field id
+    const std::vector<bool>&               valid_id              ()                             const;
+
+    // Column of the data field owner
+    const std::vector<std::string>&        owner                 ()                             const;
+    // Availability bitmap of the data field owner
+    const std::vector<bool>&               exist_owner           ()                             const;
+
+    // Column of the data field limit
+    const std::vector<long>&               limit                 ()                             const;
+
+    // Column of the data field history
+    const std::vector<std::vector<long> >& history               ()                             const;
+    // Availability bitmap of the data field history
+    const std::vector<bool>&               exist_history         ()                             const;
+
+    // Column of the data field rate
+    const std::vector<long>&               rate                  ()                             const;
+    // Availability bitmap of the data field rate
+    const std::vector<bool>&               valid_rate            ()                             const;
+
+private:
+    // column of the data field id
+    std::vector<long>               mId;
+    // availability bitmap of the data field id
+    std::vector<bool>               mIdAvailability;
+    // column of the data field owner
+    std::vector<std::string>        mOwner;
+    // availability bitmap of the data field owner
+    std::vector<bool>               mOwnerAvailability;
+    // column of the data field limit
+    std::vector<long>               mLimit;
+    // column of the data field history
+    std::vector<std::vector<long> > mHistory;
+    // availability bitmap of the data field history
+    std::vector<bool>               mHistoryAvailability;
+    // column of the data field rate
+    std::vector<long>               mRate;
+    // availability bitmap of the data field rate
+    std::vector<bool>               mRateAvailability;
+};
+
+}
+
+#endif // __STRUCTURE_TRACKED_COMPIL_H_
+
@@ -0,0 +1,39 @@
+#ifndef __STRUCTURE_UPCOPY_COMPIL__FWD_H_
+#define __STRUCTURE_UPCOPY_COMPIL__FWD_H_
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace upcopy
+{
+
+// Forward declarations
+class Structure1;
+typedef Structure1*                         Structure1RPtr;
+typedef boost::shared_ptr<Structure1>       Structure1SPtr;
+typedef boost::shared_ptr<const Structure1> Structure1SCPtr;
+typedef boost::weak_ptr<Structure1>         Structure1WPtr;
+
+class Structure2;
+typedef Structure2*                         Structure2RPtr;
+typedef boost::shared_ptr<Structure2>       Structure2SPtr;
+typedef boost::shared_ptr<const Structure2> Structure2SCPtr;
+typedef boost::weak_ptr<Structure2>         Structure2WPtr;
+
+class Structure3;
+typedef Structure3*                         Structure3RPtr;
+typedef boost::shared_ptr<Structure3>       Structure3SPtr;
+typedef boost::shared_ptr<const Structure3> Structure3SCPtr;
+typedef boost::weak_ptr<Structure3>         Structure3WPtr;
+
+class Document;
+typedef Document*                         DocumentRPtr;
+typedef boost::shared_ptr<Document>       DocumentSPtr;
+typedef boost::shared_ptr<const Document> DocumentSCPtr;
+typedef boost::weak_ptr<Document>         DocumentWPtr;
+
+}
+
+#endif // __STRUCTURE_UPCOPY_COMPIL__FWD_H_
+
@@ -0,0 +1,571 @@
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#include "structure/upcopy.h"
+// Standard C Library
+#include <stddef.h>
+
+namespace upcopy
+{
+
+Structure1::Builder::Builder()
+        : mpObject(new Structure1())
+{
+}
+
+Structure1::Builder::Builder(const Structure1& object)
+        : mpObject(new Structure1())
+{
+    *(Structure1*)mpObject = object;
+}
+
+Structure1::Builder::Builder(Structure1RPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Structure1::Builder::~Builder()
+{
+    delete (Structure1RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Structure1& Structure1::Builder::build() const
+{
+    return *(Structure1RPtr)mpObject;
+}
+
+Structure1SPtr Structure1::Builder::finalize()
+{
+    Structure1RPtr objectRPtr = (Structure1RPtr)mpObject;
+    mpObject = NULL;
+    return Structure1SPtr(objectRPtr);
+}
+
+Structure1::Structure1()
+{
+}
+
+Structure1::~Structure1()
+{
+}
+
+long Structure1::i1() const
+{
+    return mI1;
+}
+
+Structure1::Builder& Structure1::Builder::set_i1(long i1)
+{
+    mpObject->mI1 = i1;
+    return *this;
+}
+
+Structure1Columns::Row::Row(const Structure1Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure1Columns::Row::i1() const
+{
+    return mColumns.i1()[mIndex];
+}
+
+Structure1Columns::Structure1Columns()
+{
+}
+
+Structure1Columns::~Structure1Columns()
+{
+}
+
+size_t Structure1Columns::size() const
+{
+    return mI1.size();
+}
+
+bool Structure1Columns::empty() const
+{
+    return mI1.empty();
+}
+
+void Structure1Columns::reserve(size_t size)
+{
+    mI1.reserve(size);
+}
+
+void Structure1Columns::clear()
+{
+    mI1.clear();
+}
+
+void Structure1Columns::push_back(const Structure1& object)
+{
+    mI1.push_back(object.i1());
+}
+
+void Structure1Columns::push_back(const Structure1::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+Structure1Columns::Row Structure1Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure1Columns::i1() const
+{
+    return mI1;
+}
+
+Structure2::Builder::Builder()
+        : Structure1::Builder(new Structure2())
+{
+}
+
+Structure2::Builder::Builder(const Structure2& object)
+        : Structure1::Builder(new Structure2())
+{
+    *(Structure2*)mpObject = object;
+}
+
+Structure2::Builder::Builder(Structure2RPtr pObject)
+        : Structure1::Builder(pObject)
+{
+}
+
+Structure2::Builder::~Builder()
+{
+    delete (Structure2RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Structure2& Structure2::Builder::build() const
+{
+    return *(Structure2RPtr)mpObject;
+}
+
+Structure2SPtr Structure2::Builder::finalize()
+{
+    Structure2RPtr objectRPtr = (Structure2RPtr)mpObject;
+    mpObject = NULL;
+    return Structure2SPtr(objectRPtr);
+}
+
+Structure2::Structure2()
+{
+}
+
+Structure2::~Structure2()
+{
+}
+
+Structure2SPtr Structure2::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure2>(object);
+}
+
+Structure2::Builder& Structure2::Builder::set_i1(long i1)
+{
+    return (Structure2::Builder&)Structure1::Builder::set_i1(i1);
+}
+
+long Structure2::i2() const
+{
+    return mI2;
+}
+
+Structure2::Builder& Structure2::Builder::set_i2(long i2)
+{
+    ((Structure2*)mpObject)->mI2 = i2;
+    return *this;
+}
+
+Structure2Columns::Row::Row(const Structure2Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure2Columns::Row::i1() const
+{
+    return mColumns.i1()[mIndex];
+}
+
+long Structure2Columns::Row::i2() const
+{
+    return mColumns.i2()[mIndex];
+}
+
+Structure2Columns::Structure2Columns()
+{
+}
+
+Structure2Columns::~Structure2Columns()
+{
+}
+
+size_t Structure2Columns::size() const
+{
+    return mI1.size();
+}
+
+bool Structure2Columns::empty() const
+{
+    return mI1.empty();
+}
+
+void Structure2Columns::reserve(size_t size)
+{
+    mI1.reserve(size);
+    mI2.reserve(size);
+}
+
+void Structure2Columns::clear()
+{
+    mI1.clear();
+    mI2.clear();
+}
+
+void Structure2Columns::push_back(const Structure2& object)
+{
+    mI1.push_back(object.i1());
+    mI2.push_back(object.i2());
+}
+
+void Structure2Columns::push_back(const Structure2::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+Structure2Columns::Row Structure2Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure2Columns::i1() const
+{
+    return mI1;
+}
+
+const std::vector<long>& Structure2Columns::i2() const
+{
+    return mI2;
+}
+
+Structure3::Builder::Builder()
+        : Structure2::Builder(new Structure3())
+{
+}
+
+Structure3::Builder::Builder(const Structure3& object)
+        : Structure2::Builder(new Structure3())
+{
+    *(Structure3*)mpObject = object;
+}
+
+Structure3::Builder::Builder(const Structure1& object)
+        : Structure2::Builder(new Structure3())
+{
+    *(Structure1*)mpObject = object;
+}
+
+Structure3::Builder::Builder(const Structure2& object)
+        : Structure2::Builder(new Structure3())
+{
+    *(Structure2*)mpObject = object;
+}
+
+Structure3::Builder::Builder(Structure3RPtr pObject)
+        : Structure2::Builder(pObject)
+{
+}
+
+Structure3::Builder::~Builder()
+{
+    delete (Structure3RPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Structure3& Structure3::Builder::build() const
+{
+    return *(Structure3RPtr)mpObject;
+}
+
+Structure3SPtr Structure3::Builder::finalize()
+{
+    Structure3RPtr objectRPtr = (Structure3RPtr)mpObject;
+    mpObject = NULL;
+    return Structure3SPtr(objectRPtr);
+}
+
+Structure3::Structure3()
+{
+}
+
+Structure3::~Structure3()
+{
+}
+
+Structure3SPtr Structure3::downcast(const Structure1SPtr& object)
+{
+    return boost::static_pointer_cast<Structure3>(object);
+}
+
+Structure3::Builder& Structure3::Builder::set_i1(long i1)
+{
+    return (Structure3::Builder&)Structure1::Builder::set_i1(i1);
+}
+
+Structure3::Builder& Structure3::Builder::set_i2(long i2)
+{
+    return (Structure3::Builder&)Structure2::Builder::set_i2(i2);
+}
+
+Structure3Columns::Row::Row(const Structure3Columns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long Structure3Columns::Row::i1() const
+{
+    return mColumns.i1()[mIndex];
+}
+
+long Structure3Columns::Row::i2() const
+{
+    return mColumns.i2()[mIndex];
+}
+
+Structure3Columns::Structure3Columns()
+{
+}
+
+Structure3Columns::~Structure3Columns()
+{
+}
+
+size_t Structure3Columns::size() const
+{
+    return mI1.size();
+}
+
+bool Structure3Columns::empty() const
+{
+    return mI1.empty();
+}
+
+void Structure3Columns::reserve(size_t size)
+{
+    mI1.reserve(size);
+    mI2.reserve(size);
+}
+
+void Structure3Columns::clear()
+{
+    mI1.clear();
+    mI2.clear();
+}
+
+void Structure3Columns::push_back(const Structure3& object)
+{
+    mI1.push_back(object.i1());
+    mI2.push_back(object.i2());
+}
+
+void Structure3Columns::push_back(const Structure3::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+Structure3Columns::Row Structure3Columns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& Structure3Columns::i1() const
+{
+    return mI1;
+}
+
+const std::vector<long>& Structure3Columns::i2() const
+{
+    return mI2;
+}
+
+Document::Builder::Builder()
+        : mpObject(new Document())
+{
+}
+
+Document::Builder::Builder(const Document& object)
+        : mpObject(new Document())
+{
+    *(Document*)mpObject = object;
+}
+
+Document::Builder::Builder(DocumentRPtr pObject)
+        : mpObject(pObject)
+{
+}
+
+Document::Builder::~Builder()
+{
+    delete (DocumentRPtr)mpObject;
+    mpObject = NULL;
+}
+
+const Document& Document::Builder::build() const
+{
+    return *(DocumentRPtr)mpObject;
+}
+
+DocumentSPtr Document::Builder::finalize()
+{
+    DocumentRPtr objectRPtr = (DocumentRPtr)mpObject;
+    mpObject = NULL;
+    return DocumentSPtr(objectRPtr);
+}
+
+Document::Document()
+{
+}
+
+Document::~Document()
+{
+}
+
+long Document::revision() const
+{
+    return mRevision;
+}
+
+Document::Builder& Document::Builder::set_revision(long revision)
+{
+    mpObject->mRevision = revision;
+    return *this;
+}
+
+const std::string& Document::title() const
+{
+    return mTitle;
+}
+
+Document::Builder& Document::Builder::set_title(const std::string& title)
+{
+    mpObject->mTitle = title;
+    return *this;
+}
+
+std::string& Document::Builder::mutable_title()
+{
+    return mpObject->mTitle.mutate();
+}
+
+const std::vector<long>& Document::values() const
+{
+    return mValues;
+}
+
+Document::Builder& Document::Builder::set_values(const std::vector<long>& values)
+{
+    mpObject->mValues = values;
+    return *this;
+}
+
+std::vector<long>& Document::Builder::mutable_values()
+{
+    return mpObject->mValues.mutate();
+}
+
+DocumentColumns::Row::Row(const DocumentColumns& columns, size_t index)
+        : mColumns(columns)
+        , mIndex  (index)
+{
+}
+
+long DocumentColumns::Row::revision() const
+{
+    return mColumns.revision()[mIndex];
+}
+
+const std::string& DocumentColumns::Row::title() const
+{
+    return mColumns.title()[mIndex];
+}
+
+const std::vector<long>& DocumentColumns::Row::values() const
+{
+    return mColumns.values()[mIndex];
+}
+
+DocumentColumns::DocumentColumns()
+{
+}
+
+DocumentColumns::~DocumentColumns()
+{
+}
+
+size_t DocumentColumns::size() const
+{
+    return mRevision.size();
+}
+
+bool DocumentColumns::empty() const
+{
+    return mRevision.empty();
+}
+
+void DocumentColumns::reserve(size_t size)
+{
+    mRevision.reserve(size);
+    mTitle.reserve(size);
+    mValues.reserve(size);
+}
+
+void DocumentColumns::clear()
+{
+    mRevision.clear();
+    mTitle.clear();
+    mValues.clear();
+}
+
+void DocumentColumns::push_back(const Document& object)
+{
+    mRevision.push_back(object.revision());
+    mTitle.push_back(object.title());
+    mValues.push_back(object.values());
+}
+
+void DocumentColumns::push_back(const Document::Builder& builder)
+{
+    push_back(builder.build());
+}
+
+DocumentColumns::Row DocumentColumns::operator[](size_t index) const
+{
+    return Row(*this, index);
+}
+
+const std::vector<long>& DocumentColumns::revision() const
+{
+    return mRevision;
+}
+
+const std::vector<std::string>& DocumentColumns::title() const
+{
+    return mTitle;
+}
+
+const std::vector<std::vector<long> >& DocumentColumns::values() const
+{
+    return mValues;
+}
+
+}
+
@@ -0,0 +1,594 @@
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __STRUCTURE_UPCOPY_COMPIL_H_
+#define __STRUCTURE_UPCOPY_COMPIL_H_
+
+#include "structure/upcopy-fwd.h"
+// Compil C++ Template Library
+#include "core/compil/shared_value.h"
+
+template<class T> class snapshot;
+
+namespace upcopy
+{
+
+// Structure1 is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Structure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void              operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                  Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                  Builder  (const Structure1& object);
+        // Destructor of Builder
+        /*lax*/                   ~Builder ();
+
+        // Instantiates Structure1 instance with the current initialization
+        // of the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Structure1& build    ()                         const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                Structure1SPtr    finalize ();
+
+
+        // Setter method for the data field i1
+                Builder&          set_i1   (long i1);
+
+    protected:
+        // constructor needed from potential derived classes
+                                  Builder  (Structure1RPtr pObject);
+
+        Structure1RPtr mpObject;
+    };
+
+    // Default constructor
+                 Structure1 ();
+    // Destructor
+    /*lax*/      ~Structure1();
+
+    // Getter method for the data field i1
+            long i1         () const;
+
+private:
+    // variable for the data field i1
+    long mI1;
+};
+
+// Holder of the current Structure1 shared between threads. The readers get
+// the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Structure1> Structure1Snapshot;
+
+// Structure1Columns holds Structure1 objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure1Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                          Row(const Structure1Columns& columns, size_t index);
+
+        // Getter method for the data field i1
+                                 long     i1 ()                                               const;
+    private:
+        const Structure1Columns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                             Structure1Columns ();
+    // Destructor
+                             ~Structure1Columns();
+
+    // Returns the number of the rows
+    size_t                   size              ()                                   const;
+    // Returns true if there are no rows
+    bool                     empty             ()                                   const;
+    // Reserves memory for size rows in every column
+    void                     reserve           (size_t size);
+    // Removes all the rows
+    void                     clear             ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back         (const Structure1& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                     push_back         (const Structure1::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                      operator[]        (size_t index)                       const;
+
+    // Column of the data field i1
+    const std::vector<long>& i1                ()                                   const;
+
+private:
+    // column of the data field i1
+    std::vector<long> mI1;
+};
+
+// Structure2 is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Structure2 : public Structure1
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder : public Structure1::Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void              operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                  Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                  Builder  (const Structure2& object);
+        // Destructor of Builder
+        /*lax*/                   ~Builder ();
+
+        // Instantiates Structure2 instance with the current initialization
+        // of the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Structure2& build    ()                         const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                Structure2SPtr    finalize ();
+
+
+        // Setter method for the data field i1
+                Builder&          set_i1   (long i1);
+
+        // Setter method for the data field i2
+                Builder&          set_i2   (long i2);
+
+    protected:
+        // constructor needed from potential derived classes
+                                  Builder  (Structure2RPtr pObject);
+    };
+
+    // Default constructor
+                           Structure2 ();
+    // Destructor
+    /*lax*/                ~Structure2();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure2SPtr downcast   (const Structure1SPtr& object);
+
+    // Getter method for the data field i2
+            long           i2         ()                             const;
+
+private:
+    // variable for the data field i2
+    long mI2;
+};
+
+// Holder of the current Structure2 shared between threads. The readers get
+// the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Structure2> Structure2Snapshot;
+
+// Structure2Columns holds Structure2 objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure2Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                          Row(const Structure2Columns& columns, size_t index);
+
+        // Getter method for the data field i1
+                                 long     i1 ()                                               const;
+
+        // Getter method for the data field i2
+                                 long     i2 ()                                               const;
+    private:
+        const Structure2Columns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                             Structure2Columns ();
+    // Destructor
+                             ~Structure2Columns();
+
+    // Returns the number of the rows
+    size_t                   size              ()                                   const;
+    // Returns true if there are no rows
+    bool                     empty             ()                                   const;
+    // Reserves memory for size rows in every column
+    void                     reserve           (size_t size);
+    // Removes all the rows
+    void                     clear             ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back         (const Structure2& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                     push_back         (const Structure2::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                      operator[]        (size_t index)                       const;
+
+    // Column of the data field i1
+    const std::vector<long>& i1                ()                                   const;
+
+    // Column of the data field i2
+    const std::vector<long>& i2                ()                                   const;
+
+private:
+    // column of the data field i1
+    std::vector<long> mI1;
+    // column of the data field i2
+    std::vector<long> mI2;
+};
+
+// Structure3 is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Structure3 : public Structure2
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder : public Structure2::Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void              operator=(const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                  Builder  ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                  Builder  (const Structure3& object);
+        // Use this constructor when you need to upcopy an object from
+        // Structure1 type.
+        // Note: Obviously upcopy constructor initializes only the
+        // inherited fields from the base structure. All fields that are
+        // declared down will have their default value or will be
+        // uninitialized.
+                                  Builder  (const Structure1& object);
+        // Use this constructor when you need to upcopy an object from
+        // Structure2 type.
+        // Note: Obviously upcopy constructor initializes only the
+        // inherited fields from the base structure. All fields that are
+        // declared down will have their default value or will be
+        // uninitialized.
+                                  Builder  (const Structure2& object);
+        // Destructor of Builder
+        /*lax*/                   ~Builder ();
+
+        // Instantiates Structure3 instance with the current initialization
+        // of the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Structure3& build    ()                         const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                Structure3SPtr    finalize ();
+
+
+        // Setter method for the data field i1
+                Builder&          set_i1   (long i1);
+
+        // Setter method for the data field i2
+                Builder&          set_i2   (long i2);
+
+    protected:
+        // constructor needed from potential derived classes
+                                  Builder  (Structure3RPtr pObject);
+    };
+
+    // Default constructor
+                           Structure3 ();
+    // Destructor
+    /*lax*/                ~Structure3();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  Structure3SPtr downcast   (const Structure1SPtr& object);
+};
+
+// Holder of the current Structure3 shared between threads. The readers get
+// the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Structure3> Structure3Snapshot;
+
+// Structure3Columns holds Structure3 objects column by column - one
+// contiguous array per data field. Use it for large collections that are
+// scanned one or two fields at a time. Such scan touches only the memory
+// of the columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class Structure3Columns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                          Row(const Structure3Columns& columns, size_t index);
+
+        // Getter method for the data field i1
+                                 long     i1 ()                                               const;
+
+        // Getter method for the data field i2
+                                 long     i2 ()                                               const;
+    private:
+        const Structure3Columns& mColumns;
+        size_t                   mIndex;
+    };
+
+    // Default constructor
+                             Structure3Columns ();
+    // Destructor
+                             ~Structure3Columns();
+
+    // Returns the number of the rows
+    size_t                   size              ()                                   const;
+    // Returns true if there are no rows
+    bool                     empty             ()                                   const;
+    // Reserves memory for size rows in every column
+    void                     reserve           (size_t size);
+    // Removes all the rows
+    void                     clear             ();
+
+    // Appends a row with the data fields of the object
+    void                     push_back         (const Structure3& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                     push_back         (const Structure3::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                      operator[]        (size_t index)                       const;
+
+    // Column of the data field i1
+    const std::vector<long>& i1                ()                                   const;
+
+    // Column of the data field i2
+    const std::vector<long>& i2                ()                                   const;
+
+private:
+    // column of the data field i1
+    std::vector<long> mI1;
+    // column of the data field i2
+    std::vector<long> mI2;
+};
+
+// Document is an immutable class - once instantiated none of the data
+// fields can be changed. For the initial initialization and instantiation
+// use the nested Builder class.
+
+// Immutability is useful in multi-thread and subject observer
+// applications. It makes easy creation of models with object references.
+
+class Document
+{
+public:
+    // Use Builder to instantiate objects
+    class Builder
+    {
+        // hide evil auto created assignment operator, no implementation
+                void               operator=     (const Builder& );
+    public:
+        // Default constructor. All fields without default values are left
+        // uninitialized. Make sure you initialize all the necessary fields
+        // before instantiating
+                                   Builder       ();
+        // Use this constructor when you need to clone or create an object
+        // just slightly different from another object
+                                   Builder       (const Document& object);
+        // Destructor of Builder
+        /*lax*/                    ~Builder      ();
+
+        // Instantiates Document instance with the current initialization
+        // of the fields. After the instance is ready the builder could be
+        // reused to instantiate more objects. The data is not reset.
+        // Second call of build() will instantiate object with the same
+        // data.
+                const Document&    build         ()                                const;
+
+        // Provides the internal instantiated builder object and
+        // invalidates the builder status. Once finalize() is called, the
+        // builder can not be used again. Use finalize() when you no longer
+        // are going to use this builder.
+                DocumentSPtr       finalize      ();
+
+
+        // Setter method for the data field revision
+                Builder&           set_revision  (long revision);
+
+        // Setter method for the data field title
+                Builder&           set_title     (const std::string& title);
+        // Provides mutable access to field title
+                std::string&       mutable_title ();
+
+        // Setter method for the data field values
+                Builder&           set_values    (const std::vector<long>& values);
+        // Provides mutable access to field values
+                std::vector<long>& mutable_values();
+
+    protected:
+        // constructor needed from potential derived classes
+                                   Builder       (DocumentRPtr pObject);
+
+        DocumentRPtr mpObject;
+    };
+
+    // Default constructor
+                                     Document ();
+    // Destructor
+    /*lax*/                          ~Document();
+
+    // Getter method for the data field revision
+            long                     revision () const;
+
+    // Getter method for the data field title
+            const std::string&       title    () const;
+
+    // Getter method for the data field values
+            const std::vector<long>& values   () const;
+
+private:
+    // variable for the data field revision
+    long                             mRevision;
+    // variable for the data field title
+    shared_value<std::string>        mTitle;
+    // variable for the data field values
+    shared_value<std::vector<long> > mValues;
+};
+
+// Holder of the current Document shared between threads. The readers get
+// the current object wait-free through a view, the writers publish the
+// results of Builder::finalize(). It needs the core snapshot header.
+typedef snapshot<Document> DocumentSnapshot;
+
+// DocumentColumns holds Document objects column by column - one contiguous
+// array per data field. Use it for large collections that are scanned one
+// or two fields at a time. Such scan touches only the memory of the
+// columns it reads.
+
+// The availability of the optional fields is kept in packed bitmaps with
+// one bit per row. The boolean fields are kept as bytes, so that every
+// column is contiguous.
+
+class DocumentColumns
+{
+public:
+    // Read only proxy of a single row
+    class Row
+    {
+    public:
+        // Proxy of the row index of the columns
+                                                        Row     (const DocumentColumns& columns, size_t index);
+
+        // Getter method for the data field revision
+                               long                     revision()                                             const;
+
+        // Getter method for the data field title
+                               const std::string&       title   ()                                             const;
+
+        // Getter method for the data field values
+                               const std::vector<long>& values  ()                                             const;
+    private:
+        const DocumentColumns& mColumns;
+        size_t                 mIndex;
+    };
+
+    // Default constructor
+                                           DocumentColumns ();
+    // Destructor
+                                           ~DocumentColumns();
+
+    // Returns the number of the rows
+    size_t                                 size            ()                                 const;
+    // Returns true if there are no rows
+    bool                                   empty           ()                                 const;
+    // Reserves memory for size rows in every column
+    void                                   reserve         (size_t size);
+    // Removes all the rows
+    void                                   clear           ();
+
+    // Appends a row with the data fields of the object
+    void                                   push_back       (const Document& object);
+    // Appends a row with the data fields of the object instantiated by the
+    // builder
+    void                                   push_back       (const Document::Builder& builder);
+
+    // Returns proxy of the row index
+    Row                                    operator[]      (size_t index)                     const;
+
+    // Column of the data field revision
+    const std::vector<long>&               revision        ()                                 const;
+
+    // Column of the data field title
+    const std::vector<std::string>&        title           ()                                 const;
+
+    // Column of the data field values
+    const std::vector<std::vector<long> >& values          ()                                 const;
+
+private:
+    // column of the data field revision
+    std::vector<long>               mRevision;
+    // column of the data field title
+    std::vector<std::string>        mTitle;
+    // column of the data field values
+    std::vector<std::vector<long> > mValues;
+};
+
+}
+
+#endif // __STRUCTURE_UPCOPY_COMPIL_H_
+
@@ -0,0 +1,231 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "interface/async.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace async
+{
+
+class CounterImplementation : public Counter
+{
+public:
+    CounterImplementation()
+        : mSum(0)
+    {
+    }
+
+    virtual void add(long value)
+    {
+        mSum += value;
+        mValues.push_back(value);
+    }
+
+    virtual void addTwice(long value1, long value2)
+    {
+        add(value1);
+        add(value2);
+    }
+
+    virtual void total(long& sum)
+    {
+        sum = mSum;
+    }
+
+    virtual void scale(long factor, long& value)
+    {
+        value *= factor;
+    }
+
+    long mSum;
+    std::vector<long> mValues;
+};
+
+typedef boost::shared_ptr<CounterImplementation> CounterImplementationSPtr;
+
+TEST(InterfaceAsyncTest, postedCallsAreDispatchedInOrder)
+{
+    CounterImplementationSPtr implementation(new CounterImplementation());
+    async_queue queue;
+    CounterProxy proxy(implementation, queue);
+
+    for (long i = 0; i < 100; ++i)
+        proxy.add(i);
+    proxy.addTwice(1000, 2000);
+
+    // the out parameters wait for the dispatch of all the calls before them
+    long sum = 0;
+    proxy.total(sum);
+    EXPECT_EQ(4950 + 3000, sum);
+
+    ASSERT_EQ(102U, implementation->mValues.size());
+    for (long i = 0; i < 100; ++i)
+        EXPECT_EQ(i, implementation->mValues[i]);
+    EXPECT_EQ(1000, implementation->mValues[100]);
+    EXPECT_EQ(2000, implementation->mValues[101]);
+}
+
+TEST(InterfaceAsyncTest, ioParameter)
+{
+    CounterImplementationSPtr implementation(new CounterImplementation());
+    async_queue queue;
+    CounterProxy proxy(implementation, queue);
+
+    long value = 7;
+    proxy.scale(3, value);
+    EXPECT_EQ(21, value);
+}
+
+TEST(InterfaceAsyncTest, consecutiveCallsAreBatched)
+{
+    CounterImplementationSPtr implementation(new CounterImplementation());
+    async_queue queue;
+    CounterProxy proxy(implementation, queue);
+
+    for (long i = 0; i < 1000; ++i)
+        proxy.add(1);
+    long sum = 0;
+    proxy.total(sum);
+    EXPECT_EQ(1000, sum);
+
+    EXPECT_EQ(1001U, queue.calls());
+    EXPECT_LE(1U, queue.batches());
+    EXPECT_GE(queue.calls(), queue.batches());
+}
+
+TEST(InterfaceAsyncTest, destructionDispatchesPendingCalls)
+{
+    CounterImplementationSPtr implementation(new CounterImplementation());
+    {
+        async_queue queue;
+        CounterProxy proxy(implementation, queue);
+        for (long i = 0; i < 100; ++i)
+            proxy.add(1);
+    }
+    EXPECT_EQ(100, implementation->mSum);
+}
+
+static void idle()
+{
+    // long enough for the worker to stop spinning and park
+    for (int i = 0; i < 200; ++i)
+        boost::detail::yield(64);
+}
+
+TEST(InterfaceAsyncTest, parkedWorkerIsWoken)
+{
+    CounterImplementationSPtr implementation(new CounterImplementation());
+    {
+        async_queue queue;
+        CounterProxy proxy(implementation, queue);
+
+        idle();
+        proxy.add(1);
+        long sum = 0;
+        proxy.total(sum);
+        EXPECT_EQ(1, sum);
+
+        idle();
+        proxy.add(2);
+        idle();
+    }
+    // the destruction wakes the parked worker too
+    EXPECT_EQ(3, implementation->mSum);
+}
+
+class SlowCounterImplementation : public CounterImplementation
+{
+public:
+    virtual void total(long& sum)
+    {
+        idle();
+        CounterImplementation::total(sum);
+    }
+};
+
+TEST(InterfaceAsyncTest, slowCallWakesTheParkedCaller)
+{
+    CounterImplementationSPtr implementation(new SlowCounterImplementation());
+    async_queue queue;
+    CounterProxy proxy(implementation, queue);
+
+    // the caller stops spinning and parks long before the call returns
+    for (long i = 0; i < 3; ++i)
+    {
+        proxy.add(i);
+        long sum = 0;
+        proxy.total(sum);
+        EXPECT_EQ(i * (i + 1) / 2, sum);
+    }
+    EXPECT_EQ(6U, queue.calls());
+}
+
+struct Producer
+{
+    CounterProxy* mProxy;
+    long mCount;
+};
+
+static void produce(void* argument)
+{
+    Producer* producer = static_cast<Producer*>(argument);
+    for (long i = 0; i < producer->mCount; ++i)
+        producer->mProxy->add(1);
+}
+
+TEST(InterfaceAsyncTest, multipleProducers)
+{
+    CounterImplementationSPtr implementation(new CounterImplementation());
+    async_queue queue;
+    CounterProxy proxy(implementation, queue);
+
+    const int threads = 4;
+    Producer producers[threads];
+    async_thread producerThreads[threads];
+    for (int i = 0; i < threads; ++i)
+    {
+        producers[i].mProxy = &proxy;
+        producers[i].mCount = 10000;
+        producerThreads[i].start(&produce, &producers[i]);
+    }
+    for (int i = 0; i < threads; ++i)
+        producerThreads[i].join();
+
+    long sum = 0;
+    proxy.total(sum);
+    EXPECT_EQ(threads * 10000, sum);
+}
+
+}
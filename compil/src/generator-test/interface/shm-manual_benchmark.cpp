@@ -0,0 +1,203 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "interface/shm.h"
+
+#include "core/platform/benchmark.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace shm
+{
+
+class CountingJournal : public Journal
+{
+public:
+    CountingJournal()
+        : mCount(0)
+        , mSum(0)
+    {
+    }
+
+    virtual void record(const std::string&, const std::vector<long>& values)
+    {
+        ++mCount;
+        for (size_t i = 0; i < values.size(); ++i)
+            mSum += values[i];
+    }
+
+    virtual void echo(const std::string& text, std::string& copy)
+    {
+        copy = text;
+    }
+
+    virtual void summary(long& count, long& sum)
+    {
+        count = mCount;
+        sum = mSum;
+    }
+
+    virtual void reverse(std::vector<long>&)
+    {
+    }
+
+    virtual void ping(long sequence, long& reply)
+    {
+        reply = sequence;
+    }
+
+    long mCount;
+    long mSum;
+};
+
+// Serves the Journal in a child process while the object lives. The
+// benchmarks measure the client in the parent process, so every call
+// crosses the process boundary through the shared memory.
+class ServerProcess
+{
+public:
+    ServerProcess(const char* name)
+        : mName(name)
+    {
+        int ready[2];
+        if (pipe(ready) != 0)
+            return;
+
+        mPid = fork();
+        if (mPid == 0)
+        {
+            close(ready[0]);
+            shm_channel channel(name, shm_channel::server_side);
+            JournalShmServer server(JournalSPtr(new CountingJournal()), channel);
+            char signal = 1;
+            if (write(ready[1], &signal, 1) != 1)
+                _exit(1);
+            // the parent kills the server when the benchmark is over
+            for (unsigned k = 0;; ++k)
+            {
+                if (server.process())
+                    k = 0;
+                else
+                    boost::detail::yield(k);
+            }
+        }
+
+        close(ready[1]);
+        char signal = 0;
+        if (read(ready[0], &signal, 1) != 1)
+            signal = 0;
+        close(ready[0]);
+    }
+
+    ~ServerProcess()
+    {
+        kill(mPid, SIGKILL);
+        waitpid(mPid, 0, 0);
+        // the killed server could not remove the shared memory
+        boost::interprocess::shared_memory_object::remove(mName.c_str());
+    }
+
+private:
+    std::string mName;
+    pid_t mPid;
+};
+
+TEST(JournalShmBenchmark, roundTrip)
+{
+    ServerProcess process("compil-shm-benchmark-round-trip");
+    shm_channel channel("compil-shm-benchmark-round-trip", shm_channel::client_side);
+    JournalShmClient client(channel);
+
+    long sequence = 0;
+    plt::Benchmark benchmark("interface/shm.Journal.roundTrip");
+    while (benchmark.running())
+    {
+        long reply = 0;
+        client.ping(++sequence, reply);
+        benchmark.consume(reply);
+    }
+}
+
+TEST(JournalShmBenchmark, oneWay)
+{
+    ServerProcess process("compil-shm-benchmark-one-way");
+    shm_channel channel("compil-shm-benchmark-one-way", shm_channel::client_side);
+    JournalShmClient client(channel);
+
+    std::string text(32, 'x');
+    std::vector<long> values(8, 1);
+    {
+        plt::Benchmark benchmark("interface/shm.Journal.oneWay");
+        while (benchmark.running())
+            client.record(text, values);
+    }
+
+    // waits for the server to drain the ring
+    long count = 0;
+    long sum = 0;
+    client.summary(count, sum);
+    EXPECT_EQ(8 * count, sum);
+}
+
+TEST(JournalShmBenchmark, oneWayLarge)
+{
+    ServerProcess process("compil-shm-benchmark-one-way-large");
+    shm_channel channel("compil-shm-benchmark-one-way-large", shm_channel::client_side);
+    JournalShmClient client(channel);
+
+    std::string text(4096, 'x');
+    std::vector<long> values(1024, 1);
+    {
+        plt::Benchmark benchmark("interface/shm.Journal.oneWayLarge");
+        while (benchmark.running())
+            client.record(text, values);
+    }
+
+    long count = 0;
+    long sum = 0;
+    client.summary(count, sum);
+    EXPECT_EQ(1024 * count, sum);
+}
+
+}
+
+#endif
@@ -0,0 +1,280 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "interface/shm.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace shm
+{
+
+class JournalImplementation : public Journal
+{
+public:
+    JournalImplementation()
+        : mSum(0)
+    {
+    }
+
+    virtual void record(const std::string& text, const std::vector<long>& values)
+    {
+        mTexts.push_back(text);
+        for (size_t i = 0; i < values.size(); ++i)
+            mSum += values[i];
+    }
+
+    virtual void echo(const std::string& text, std::string& copy)
+    {
+        copy = text;
+    }
+
+    virtual void summary(long& count, long& sum)
+    {
+        count = (long)mTexts.size();
+        sum = mSum;
+    }
+
+    virtual void reverse(std::vector<long>& values)
+    {
+        std::reverse(values.begin(), values.end());
+    }
+
+    virtual void ping(long sequence, long& reply)
+    {
+        reply = sequence + 1;
+    }
+
+    std::vector<std::string> mTexts;
+    long mSum;
+};
+
+typedef boost::shared_ptr<JournalImplementation> JournalImplementationSPtr;
+
+// Serves the requests on a separate thread, the same way as a server
+// process would do
+class ServerThread
+{
+public:
+    ServerThread(JournalShmServer& server)
+        : mServer(server)
+        , mStop(0)
+    {
+        mThread.start(&ServerThread::run, this);
+    }
+
+    ~ServerThread()
+    {
+        async_exchange(&mStop, this);
+        mThread.join();
+    }
+
+private:
+    static void run(void* argument)
+    {
+        ServerThread* self = static_cast<ServerThread*>(argument);
+        for (unsigned k = 0; !self->mStop; ++k)
+        {
+            if (self->mServer.process())
+                k = 0;
+            else
+                boost::detail::yield(k);
+        }
+        self->mServer.process();
+    }
+
+    JournalShmServer& mServer;
+    void* volatile mStop;
+    async_thread mThread;
+};
+
+TEST(InterfaceShmTest, ringKeepsTheMessagesInPlace)
+{
+    shm_channel server("compil-shm-ring", shm_channel::server_side, 256);
+    shm_channel client("compil-shm-ring", shm_channel::client_side);
+
+    boost::uint32_t size = 0;
+    EXPECT_FALSE(server.requests().peek(size));
+
+    std::string text = "in place";
+    shm_writer writer(client.requests().reserve(shm_writer::size(text)));
+    writer.write(text);
+    EXPECT_FALSE(server.requests().peek(size));
+    client.requests().commit();
+
+    const char* frame = server.requests().peek(size);
+    ASSERT_TRUE(frame);
+    EXPECT_EQ(shm_writer::size(text), size);
+
+    shm_reader reader(frame);
+    boost::uint32_t length = 0;
+    const char* view = reader.view(length);
+    EXPECT_EQ(text, std::string(view, length));
+    server.requests().release();
+
+    EXPECT_FALSE(server.requests().peek(size));
+}
+
+TEST(InterfaceShmTest, messageLargerThanHalfTheRingThrows)
+{
+    shm_channel serverChannel("compil-shm-large", shm_channel::server_side, 1024);
+    shm_channel clientChannel("compil-shm-large", shm_channel::client_side);
+
+    EXPECT_THROW(clientChannel.requests().reserve(1024), std::length_error);
+    EXPECT_THROW(clientChannel.requests().reserve(0xFFFFFFFF), std::length_error);
+
+    JournalImplementationSPtr implementation(new JournalImplementation());
+    JournalShmServer server(implementation, serverChannel);
+    JournalShmClient client(clientChannel);
+
+    // the call fails before anything is written, so the channel stays usable
+    EXPECT_THROW(client.record(std::string(600, 'x'), std::vector<long>()), std::length_error);
+    client.record("small", std::vector<long>());
+    EXPECT_EQ(1U, server.process());
+    ASSERT_EQ(1U, implementation->mTexts.size());
+    EXPECT_EQ("small", implementation->mTexts[0]);
+}
+
+TEST(InterfaceShmTest, callWithoutServerTimesOut)
+{
+    // nothing serves the requests, as if the server process had died
+    shm_channel serverChannel("compil-shm-timeout", shm_channel::server_side, 1024);
+    shm_channel clientChannel("compil-shm-timeout", shm_channel::client_side, 1024, 50);
+
+    JournalShmClient client(clientChannel);
+
+    std::string copy;
+    EXPECT_THROW(client.echo("echo", copy), shm_timeout_error);
+
+    // the requests fill the ring and the next one does not fit
+    client.record(std::string(400, 'x'), std::vector<long>());
+    client.record(std::string(400, 'x'), std::vector<long>());
+    EXPECT_THROW(client.record(std::string(400, 'x'), std::vector<long>()), shm_timeout_error);
+}
+
+TEST(InterfaceShmTest, requestsAreDispatchedInOrder)
+{
+    shm_channel serverChannel("compil-shm-order", shm_channel::server_side);
+    shm_channel clientChannel("compil-shm-order", shm_channel::client_side);
+
+    JournalImplementationSPtr implementation(new JournalImplementation());
+    JournalShmServer server(implementation, serverChannel);
+    JournalShmClient client(clientChannel);
+
+    std::vector<long> values;
+    values.push_back(1);
+    values.push_back(2);
+    client.record("first", values);
+    client.record("second", std::vector<long>());
+    client.record("", values);
+
+    EXPECT_EQ(3U, server.process());
+    EXPECT_EQ(0U, server.process());
+
+    ASSERT_EQ(3U, implementation->mTexts.size());
+    EXPECT_EQ("first", implementation->mTexts[0]);
+    EXPECT_EQ("second", implementation->mTexts[1]);
+    EXPECT_EQ("", implementation->mTexts[2]);
+    EXPECT_EQ(6, implementation->mSum);
+}
+
+TEST(InterfaceShmTest, outAndIoArgumentsAreReturned)
+{
+    shm_channel serverChannel("compil-shm-response", shm_channel::server_side);
+    shm_channel clientChannel("compil-shm-response", shm_channel::client_side);
+
+    JournalImplementationSPtr implementation(new JournalImplementation());
+    JournalShmServer server(implementation, serverChannel);
+    JournalShmClient client(clientChannel);
+    ServerThread thread(server);
+
+    std::string copy;
+    client.echo("echo", copy);
+    EXPECT_EQ("echo", copy);
+
+    std::vector<long> values;
+    for (long i = 0; i < 5; ++i)
+        values.push_back(i);
+    client.record("values", values);
+    client.reverse(values);
+    ASSERT_EQ(5U, values.size());
+    EXPECT_EQ(4, values[0]);
+    EXPECT_EQ(0, values[4]);
+
+    long count = 0;
+    long sum = 0;
+    client.summary(count, sum);
+    EXPECT_EQ(1, count);
+    EXPECT_EQ(10, sum);
+
+    long reply = 0;
+    client.ping(41, reply);
+    EXPECT_EQ(42, reply);
+}
+
+TEST(InterfaceShmTest, messagesWrapAroundTheRing)
+{
+    // the ring is much smaller than the written data, so the messages
+    // wrap around its end many times
+    shm_channel serverChannel("compil-shm-wrap", shm_channel::server_side, 1024);
+    shm_channel clientChannel("compil-shm-wrap", shm_channel::client_side);
+
+    JournalImplementationSPtr implementation(new JournalImplementation());
+    JournalShmServer server(implementation, serverChannel);
+    JournalShmClient client(clientChannel);
+
+    {
+        ServerThread thread(server);
+        std::vector<long> values(1, 1);
+        for (long i = 0; i < 10000; ++i)
+        {
+            client.record(std::string(i % 200, 'x'), values);
+            if (i % 1000 == 0)
+            {
+                std::string copy;
+                client.echo(std::string(i % 300, 'y'), copy);
+                EXPECT_EQ(std::string(i % 300, 'y'), copy);
+            }
+        }
+    }
+
+    ASSERT_EQ(10000U, implementation->mTexts.size());
+    for (long i = 0; i < 10000; ++i)
+        ASSERT_EQ(std::string(i % 200, 'x'), implementation->mTexts[i]);
+    EXPECT_EQ(10000, implementation->mSum);
+}
+
+}
@@ -0,0 +1,138 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure/columns.h"
+
+#include "gtest/gtest.h"
+
+namespace columns
+{
+
+TEST(StructureColumnsTest, pushBack)
+{
+    TradeColumns trades;
+    EXPECT_TRUE(trades.empty());
+
+    Trade trade;
+    trade.set_id(1).set_side(ESide::buy()).set_venue("venue");
+    trade.mutable_fills().push_back(10);
+    trades.push_back(trade);
+
+    trade.set_id(2).set_quantity(5).set_settled(true).set_side(ESide::sell());
+    trade.clear_venue();
+    trades.push_back(trade);
+
+    ASSERT_EQ(2U, trades.size());
+    EXPECT_FALSE(trades.empty());
+
+    EXPECT_EQ(1, trades[0].id());
+    EXPECT_EQ(1, trades[0].quantity());
+    EXPECT_FALSE(trades[0].settled());
+    EXPECT_EQ(ESide::buy(), trades[0].side());
+    EXPECT_TRUE(trades[0].exist_venue());
+    EXPECT_EQ("venue", trades[0].venue());
+    ASSERT_EQ(1U, trades[0].fills().size());
+    EXPECT_EQ(10, trades[0].fills()[0]);
+
+    EXPECT_EQ(2, trades[1].id());
+    EXPECT_EQ(5, trades[1].quantity());
+    EXPECT_TRUE(trades[1].settled());
+    EXPECT_EQ(ESide::sell(), trades[1].side());
+    EXPECT_FALSE(trades[1].exist_venue());
+}
+
+TEST(StructureColumnsTest, columns)
+{
+    TradeColumns trades;
+    trades.reserve(100);
+
+    Trade trade;
+    trade.set_side(ESide::buy());
+    trade.set_fills(std::vector<long>());
+    for (long i = 0; i < 100; ++i)
+    {
+        trade.set_id(i).set_quantity(i % 10);
+        trades.push_back(trade);
+    }
+
+    // every column is contiguous and has a value for every row
+    const std::vector<long>& quantities = trades.quantity();
+    ASSERT_EQ(trades.size(), quantities.size());
+    ASSERT_EQ(trades.size(), trades.id().size());
+    ASSERT_EQ(trades.size(), trades.venue().size());
+    ASSERT_EQ(trades.size(), trades.exist_venue().size());
+
+    long sum = 0;
+    const long* data = &quantities[0];
+    for (size_t i = 0; i < quantities.size(); ++i)
+        sum += data[i];
+    EXPECT_EQ(450, sum);
+
+    EXPECT_TRUE(trades.valid_id()[99]);
+    EXPECT_FALSE(trades.exist_venue()[99]);
+
+    trades.clear();
+    EXPECT_TRUE(trades.empty());
+    EXPECT_TRUE(trades.venue().empty());
+    EXPECT_TRUE(trades.exist_venue().empty());
+}
+
+TEST(StructureColumnsTest, inheritedFields)
+{
+    BlockTradeColumns trades;
+
+    BlockTrade trade;
+    trade.set_id(3).set_side(ESide::buy());
+    trade.set_legs(4);
+    trades.push_back(trade);
+
+    ASSERT_EQ(1U, trades.size());
+    EXPECT_EQ(3, trades[0].id());
+    EXPECT_EQ(4, trades[0].legs());
+    EXPECT_TRUE(trades[0].valid_legs());
+    EXPECT_FALSE(trades[0].exist_fills());
+}
+
+TEST(StructureColumnsTest, pushBackBuilder)
+{
+    QuoteColumns quotes;
+    quotes.push_back(Quote::Builder().set_bid(1).set_ask(2));
+    quotes.push_back(*Quote::Builder().set_bid(3).set_ask(4).finalize());
+
+    ASSERT_EQ(2U, quotes.size());
+    EXPECT_EQ(1, quotes[0].bid());
+    EXPECT_EQ(2, quotes[0].ask());
+    EXPECT_EQ(3, quotes[1].bid());
+    EXPECT_EQ(4, quotes[1].ask());
+}
+
+}
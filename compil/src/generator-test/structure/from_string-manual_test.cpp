@@ -0,0 +1,100 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure/from_string.h"
+
+#include "gtest/gtest.h"
+
+#include <string.h>
+
+namespace from_string
+{
+
+static bool roundTrip(const char* name)
+{
+    return strcmp(name, EPlace::shortName(EPlace::fromString(name, strlen(name)).value())) == 0;
+}
+
+TEST(StructureFromStringTest, weak)
+{
+    EXPECT_EQ(EColor::red(), EColor::fromString("red", 3));
+    EXPECT_EQ(EColor::green(), EColor::fromString("green", 5));
+    EXPECT_EQ(EColor::blue(), EColor::fromString("blue", 4));
+    EXPECT_EQ(EColor::invalid(), EColor::fromString("invalid", 7));
+    EXPECT_EQ(EColor::invalid(), EColor::fromString("black", 5));
+}
+
+TEST(StructureFromStringTest, flags)
+{
+    EXPECT_EQ(EPermission::read(), EPermission::fromString("read", 4));
+    EXPECT_EQ(EPermission::execute(), EPermission::fromString("execute", 7));
+    EXPECT_EQ(EPermission::nil(), EPermission::fromString("nil", 3));
+    EXPECT_EQ(EPermission::all(), EPermission::fromString("all", 3));
+    EXPECT_EQ(EPermission::nil(), EPermission::fromString("none", 4));
+}
+
+TEST(StructureFromStringTest, manyValues)
+{
+    EXPECT_TRUE(roundTrip("amber_anchor"));
+    EXPECT_TRUE(roundTrip("misty_nebula"));
+    EXPECT_TRUE(roundTrip("zonal_zenith"));
+    EXPECT_EQ(EPlace::amber_anchor(), EPlace::fromString("amber_anchor", 12));
+    EXPECT_EQ(EPlace::zonal_zenith(), EPlace::fromString("zonal_zenith", 12));
+
+    for (long value = EPlace::amber_anchor().value(); value <= EPlace::zonal_zenith().value(); ++value)
+    {
+        const char* name = EPlace::shortName(value);
+        EXPECT_EQ(value, EPlace::fromString(name, strlen(name)).value());
+    }
+}
+
+TEST(StructureFromStringTest, unknownNames)
+{
+    EXPECT_EQ(EPlace::invalid(), EPlace::fromString("", 0));
+    EXPECT_EQ(EPlace::invalid(), EPlace::fromString("amber", 5));
+    EXPECT_EQ(EPlace::invalid(), EPlace::fromString("amber_anchors", 13));
+    EXPECT_EQ(EPlace::invalid(), EPlace::fromString("Amber_anchor", 12));
+
+    // the size limits the name, so it does not need to be zero terminated
+    EXPECT_EQ(EPlace::amber_anchor(), EPlace::fromString("amber_anchor_suffix", 12));
+}
+
+TEST(StructureFromStringTest, embeddedZero)
+{
+    // a zero inside the size is a part of the name, not its end
+    EXPECT_EQ(EColor::invalid(), EColor::fromString("red\0\0\0\0\0", 8));
+    EXPECT_EQ(EColor::invalid(), EColor::fromString("re\0", 3));
+    EXPECT_EQ(EPlace::invalid(), EPlace::fromString("amber_anchor\0", 13));
+    EXPECT_EQ(EPermission::nil(), EPermission::fromString("read\0xx", 7));
+}
+
+}
@@ -0,0 +1,99 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure/identification.h"
+
+#include "core/platform/benchmark.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace identification
+{
+
+// one million objects of all the types in the hierarchy in a random order
+static std::vector<Structure1SPtr> mixedObjects()
+{
+    std::vector<Structure1SPtr> objects;
+    objects.reserve(1000000);
+    for (int i = 0; i < 1000000; ++i)
+    {
+        Structure1SPtr object;
+        switch (i % 7)
+        {
+            case 0: object.reset(new Structure1()); break;
+            case 1: object.reset(new Structure2a()); break;
+            case 2: object.reset(new Structure2b()); break;
+            case 3: object.reset(new Structure3aa()); break;
+            case 4: object.reset(new Structure3ab()); break;
+            case 5: object.reset(new Structure3ba()); break;
+            default: object.reset(new Structure3bb()); break;
+        }
+        object->set_weight(i);
+        objects.push_back(object);
+    }
+    std::srand(1);
+    std::random_shuffle(objects.begin(), objects.end());
+    return objects;
+}
+
+TEST(Structure1aFactoryBenchmark, clone)
+{
+    std::vector<Structure1SPtr> objects = mixedObjects();
+
+    plt::Benchmark benchmark("structure/identification.Structure1aFactory.clone.1M");
+    while (benchmark.running())
+    {
+        std::vector<Structure1SPtr> clones;
+        clones.reserve(objects.size());
+        for (size_t i = 0; i < objects.size(); ++i)
+            clones.push_back(Structure1aFactory::clone(objects[i]));
+        benchmark.consume(clones);
+    }
+}
+
+TEST(Structure1aFactoryBenchmark, cloneAll)
+{
+    std::vector<Structure1SPtr> objects = mixedObjects();
+
+    plt::Benchmark benchmark("structure/identification.Structure1aFactory.cloneAll.1M");
+    while (benchmark.running())
+    {
+        std::vector<Structure1SPtr> clones = Structure1aFactory::cloneAll(objects);
+        benchmark.consume(clones);
+    }
+}
+
+}
@@ -69,4 +69,140 @@ TEST(StructureIdentificationTest, runtime_values)
     EXPECT_EQ(structure3ba.runtimeStructure1Id(), Structure3ba::staticStructure1Id());
 }
 
+class NameVisitor : public Structure1Visitor<NameVisitor, std::string>
+{
+public:
+    using Structure1Visitor<NameVisitor, std::string>::visit;
+
+    std::string visit(const Structure1SPtr&)
+    {
+        return "structure1";
+    }
+
+    std::string visit(const Structure3aaSPtr&)
+    {
+        return "structure3aa";
+    }
+};
+
+class Structure2aCounter : public Structure1Visitor<Structure2aCounter>
+{
+public:
+    using Structure1Visitor<Structure2aCounter>::visit;
+
+    Structure2aCounter()
+        : mCount(0)
+    {
+    }
+
+    void visit(const Structure2aSPtr&)
+    {
+        ++mCount;
+    }
+
+    int mCount;
+};
+
+TEST(StructureIdentificationTest, visitor)
+{
+    NameVisitor visitor;
+    EXPECT_EQ("structure1", visitor.accept(Structure1SPtr(new Structure1())));
+    EXPECT_EQ("structure1", visitor.accept(Structure1SPtr(new Structure2a())));
+    EXPECT_EQ("structure1", visitor.accept(Structure1SPtr(new Structure2b())));
+    EXPECT_EQ("structure3aa", visitor.accept(Structure1SPtr(new Structure3aa())));
+    EXPECT_EQ("structure1", visitor.accept(Structure1SPtr(new Structure3ab())));
+    EXPECT_EQ("structure1", visitor.accept(Structure1SPtr(new Structure3ba())));
+}
+
+TEST(StructureIdentificationTest, visitorFallsBackToTheNearestBase)
+{
+    Structure2aCounter counter;
+    counter.accept(Structure1SPtr(new Structure1()));
+    counter.accept(Structure1SPtr(new Structure2b()));
+    counter.accept(Structure1SPtr(new Structure3ba()));
+    EXPECT_EQ(0, counter.mCount);
+
+    counter.accept(Structure1SPtr(new Structure2a()));
+    counter.accept(Structure1SPtr(new Structure3aa()));
+    counter.accept(Structure1SPtr(new Structure3ab()));
+    EXPECT_EQ(3, counter.mCount);
+}
+
+TEST(StructureIdentificationTest, cloneAll)
+{
+    std::vector<Structure1SPtr> objects;
+    objects.push_back(Structure1SPtr(new Structure3aa()));
+    objects.push_back(Structure1SPtr(new Structure1()));
+    objects.push_back(Structure1SPtr(new Structure3ba()));
+    objects.push_back(Structure1SPtr(new Structure2a()));
+    objects.push_back(Structure1SPtr(new Structure3aa()));
+    objects.push_back(Structure1SPtr(new Structure1()));
+    for (size_t i = 0; i < objects.size(); ++i)
+        objects[i]->set_weight((long)i + 1);
+
+    std::vector<Structure1SPtr> clones = Structure1aFactory::cloneAll(objects);
+    ASSERT_EQ(objects.size(), clones.size());
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        ASSERT_TRUE(clones[i]);
+        EXPECT_NE(objects[i], clones[i]);
+        EXPECT_EQ(objects[i]->runtimeStructure1Id(), clones[i]->runtimeStructure1Id());
+        EXPECT_EQ((long)i + 1, clones[i]->weight());
+    }
+
+    objects[0]->set_weight(100);
+    EXPECT_EQ(1, clones[0]->weight());
+}
+
+TEST(StructureIdentificationTest, cloneAllKeepsNullObjects)
+{
+    std::vector<Structure1SPtr> objects;
+    objects.push_back(Structure1SPtr());
+    objects.push_back(Structure1SPtr(new Structure2a()));
+    objects.push_back(Structure1SPtr());
+
+    std::vector<Structure1SPtr> clones = Structure1aFactory::cloneAll(objects);
+    ASSERT_EQ(3U, clones.size());
+    EXPECT_FALSE(clones[0]);
+    ASSERT_TRUE(clones[1]);
+    EXPECT_EQ(Structure2a::staticStructure1Id(), clones[1]->runtimeStructure1Id());
+    EXPECT_FALSE(clones[2]);
+
+    EXPECT_TRUE(Structure1aFactory::cloneAll(std::vector<Structure1SPtr>()).empty());
+}
+
+TEST(StructureIdentificationTest, cloneAllOutlivesTheOriginals)
+{
+    std::vector<Structure1SPtr> clones;
+    {
+        std::vector<Structure1SPtr> objects;
+        objects.push_back(Structure1SPtr(new Structure3ba()));
+        objects.push_back(Structure1SPtr(new Structure3ba()));
+        objects[1]->set_weight(7);
+        clones = Structure1aFactory::cloneAll(objects);
+    }
+
+    // the clones of a group share one slab, releasing one keeps the other
+    clones.erase(clones.begin());
+    ASSERT_EQ(1U, clones.size());
+    EXPECT_EQ(7, clones[0]->weight());
+    EXPECT_TRUE(Structure1aFactory::downcastStructure3ba(clones[0]));
+}
+
+TEST(StructureIdentificationTest, sharableHierarchyClonesOneByOne)
+{
+    // the slab clones could not share themselves, so a sharable hierarchy
+    // has no cloneAll and its objects are cloned one by one
+    SharedStructure1SPtr object(new SharedStructure2());
+    object->set_weight(3);
+
+    SharedStructure1SPtr clone = SharedStructure1Factory::clone(object);
+    ASSERT_TRUE(clone);
+    EXPECT_NE(object, clone);
+    EXPECT_EQ(3, clone->weight());
+    EXPECT_EQ(SharedStructure2::staticSharedStructure1Id(), clone->runtimeSharedStructure1Id());
+    EXPECT_EQ(clone, clone->shared_from_this());
+    EXPECT_EQ(clone, SharedStructure1Factory::downcastSharedStructure2(clone)->shared_from_this());
+}
+
 }
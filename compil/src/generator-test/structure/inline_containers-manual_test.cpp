@@ -0,0 +1,117 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure/inline_containers.h"
+
+#include "gtest/gtest.h"
+
+namespace inline_containers
+{
+
+TEST(StructureInlineContainersTest, fixed)
+{
+    Sample sample;
+    EXPECT_FALSE(sample.exist_coordinates());
+    
+    boost::array<long, 3> coordinates = {{1, 2, 3}};
+    sample.set_coordinates(coordinates);
+    EXPECT_TRUE(sample.exist_coordinates());
+    EXPECT_EQ(2, sample.coordinates()[1]);
+    
+    sample.mutable_coordinates()[1] = 5;
+    EXPECT_EQ(5, sample.coordinates()[1]);
+    
+    sample.clear_coordinates();
+    EXPECT_FALSE(sample.exist_coordinates());
+    
+    // the cleared elements are reset to their default values
+    sample.mutable_coordinates();
+    EXPECT_EQ(3U, sample.coordinates().size());
+    EXPECT_EQ(0, sample.coordinates()[1]);
+}
+
+TEST(StructureInlineContainersTest, smallInline)
+{
+    Sample sample;
+    sample << 10 << 20;
+    EXPECT_TRUE(sample.exist_fills());
+    ASSERT_EQ(2U, sample.fills().size());
+    EXPECT_TRUE(sample.fills().is_inline());
+    EXPECT_EQ(10, sample.fills()[0]);
+    EXPECT_EQ(20, sample.fills()[1]);
+}
+
+TEST(StructureInlineContainersTest, smallSpill)
+{
+    small_vector<std::string, 2> names;
+    names.push_back("a");
+    names.push_back("b");
+    EXPECT_TRUE(names.is_inline());
+    names.push_back(names.front());
+    EXPECT_FALSE(names.is_inline());
+    ASSERT_EQ(3U, names.size());
+    EXPECT_EQ("a", names[0]);
+    EXPECT_EQ("b", names[1]);
+    EXPECT_EQ("a", names.back());
+    
+    Sample sample;
+    sample.set_names(names);
+    EXPECT_EQ(names, sample.names());
+    
+    small_vector<std::string, 2> copy = sample.names();
+    EXPECT_EQ(3U, copy.size());
+    copy.pop_back();
+    EXPECT_TRUE(copy < names);
+    EXPECT_TRUE(copy != names);
+    
+    copy.resize(1);
+    EXPECT_EQ(1U, copy.size());
+    copy.clear();
+    EXPECT_TRUE(copy.empty());
+}
+
+TEST(StructureInlineContainersTest, controlled)
+{
+    Entry entry;
+    EXPECT_FALSE(entry.exist_fills());
+    entry.mutable_fills().push_back(1);
+    EXPECT_TRUE(entry.exist_fills());
+    
+    Entry copy = entry;
+    EXPECT_EQ(entry.fills(), copy.fills());
+    
+    entry.clear_fills();
+    EXPECT_FALSE(entry.exist_fills());
+    EXPECT_TRUE(entry.mutable_fills().empty());
+}
+
+}
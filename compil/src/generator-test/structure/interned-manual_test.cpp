@@ -0,0 +1,102 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure/interned.h"
+
+#include "gtest/gtest.h"
+
+namespace interned
+{
+
+TEST(StructureInternedTest, finalizeEqual)
+{
+    size_t lookups = Point::internTableLookups();
+    size_t hits = Point::internTableHits();
+
+    PointSPtr point1 = Point::Builder().set_x(1).set_y(2).finalize();
+    PointSPtr point2 = Point::Builder().set_x(1).set_y(2).finalize();
+    PointSPtr point3 = Point::Builder().set_x(2).set_y(1).finalize();
+
+    EXPECT_EQ(point1, point2);
+    EXPECT_NE(point1, point3);
+    EXPECT_TRUE(*point1 == *point2);
+    EXPECT_FALSE(*point1 == *point3);
+
+    EXPECT_EQ(lookups + 3, Point::internTableLookups());
+    EXPECT_EQ(hits + 1, Point::internTableHits());
+    EXPECT_LT(0.0, Point::internTableHitRatio());
+}
+
+TEST(StructureInternedTest, finalizeOptional)
+{
+    PointSPtr point1 = Point::Builder().set_x(1).set_y(2).finalize();
+    PointSPtr point2 = Point::Builder().set_x(1).set_y(2).set_label("a").finalize();
+    PointSPtr point3 = Point::Builder().set_x(1).set_y(2).set_label("a").finalize();
+
+    EXPECT_NE(point1, point2);
+    EXPECT_EQ(point2, point3);
+}
+
+TEST(StructureInternedTest, release)
+{
+    size_t size = Point::internTableSize();
+    {
+        PointSPtr point = Point::Builder().set_x(3).set_y(4).finalize();
+        EXPECT_EQ(size + 1, Point::internTableSize());
+    }
+    EXPECT_EQ(size, Point::internTableSize());
+
+    PointSPtr point = Point::Builder().set_x(3).set_y(4).finalize();
+    EXPECT_EQ(size + 1, Point::internTableSize());
+}
+
+TEST(StructureInternedTest, references)
+{
+    PointSPtr from = Point::Builder().set_x(0).set_y(0).finalize();
+    PointSPtr to = Point::Builder().set_x(5).set_y(5).finalize();
+
+    SegmentSPtr segment1 = Segment::Builder().set_from(from).set_to(to).finalize();
+    SegmentSPtr segment2 = Segment::Builder()
+        .set_from(Point::Builder().set_x(0).set_y(0).finalize())
+        .set_to(Point::Builder().set_x(5).set_y(5).finalize())
+        .finalize();
+    SegmentSPtr segment3 = Segment::Builder().set_from(to).set_to(from).finalize();
+
+    EXPECT_EQ(segment1, segment2);
+    EXPECT_NE(segment1, segment3);
+
+    SegmentSPtr segment4 = Segment::Builder(*segment1).set_name("s").finalize();
+    EXPECT_NE(segment1, segment4);
+    EXPECT_EQ(3U, Segment::internTableSize());
+}
+
+}
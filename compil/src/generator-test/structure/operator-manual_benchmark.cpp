@@ -0,0 +1,101 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure/operator.h"
+
+#include "core/platform/benchmark.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace operator_
+{
+
+// the field by field chain the operators were generated as before compare()
+struct ChainLessThan
+{
+    bool operator()(const CompareKey& object1, const CompareKey& object2) const
+    {
+        if (object1.venue() < object2.venue()) return true;
+        if (object2.venue() < object1.venue()) return false;
+        if (object1.side() < object2.side()) return true;
+        if (object2.side() < object1.side()) return false;
+        if (object1.price() < object2.price()) return true;
+        if (object2.price() < object1.price()) return false;
+        return object1.lot() < object2.lot();
+    }
+};
+
+// one million keys with few distinct leading fields, so the comparisons
+// reach the later fields
+static std::vector<CompareKey> keys()
+{
+    std::vector<CompareKey> keys(1000000);
+    unsigned long seed = 1;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        keys[i].set_venue((seed >> 16) % 4)
+               .set_side((seed >> 8) % 2 + CompareKey::ESide::buy())
+               .set_price((seed >> 4) % 64)
+               .set_lot(seed % 1024);
+    }
+    return keys;
+}
+
+template<class Compare>
+static void sortKeys(const char* name, Compare compare)
+{
+    const std::vector<CompareKey> unsorted = keys();
+
+    plt::Benchmark benchmark(name);
+    while (benchmark.running())
+    {
+        std::vector<CompareKey> sorted = unsorted;
+        std::sort(sorted.begin(), sorted.end(), compare);
+        benchmark.consume(sorted);
+    }
+}
+
+TEST(StructureOperatorBenchmark, sortChain)
+{
+    sortKeys("structure/operator.CompareKey.sort.chain.1M", ChainLessThan());
+}
+
+TEST(StructureOperatorBenchmark, sortCompare)
+{
+    sortKeys("structure/operator.CompareKey.sort.compare.1M", CompareKey::lessThan());
+}
+
+}
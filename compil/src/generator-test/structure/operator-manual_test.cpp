@@ -0,0 +1,145 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure/operator.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace operator_
+{
+
+static CompareKey key(long venue, long side, long price, long lot)
+{
+    CompareKey key;
+    key.set_venue(venue).set_side(side).set_price(price).set_lot(lot);
+    return key;
+}
+
+TEST(StructureOperatorTest, compareIntegers)
+{
+    EXPECT_EQ(0, key(1, CompareKey::ESide::buy(), 100, 5).compare(key(1, CompareKey::ESide::buy(), 100, 5)));
+
+    // the earlier field decides regardless of the following fields
+    EXPECT_GT(0, key(1, CompareKey::ESide::sell(), 900, 9).compare(key(2, CompareKey::ESide::buy(), 100, 1)));
+    EXPECT_LT(0, key(2, CompareKey::ESide::buy(), 100, 1).compare(key(1, CompareKey::ESide::sell(), 900, 9)));
+    EXPECT_GT(0, key(1, CompareKey::ESide::buy(), 900, 9).compare(key(1, CompareKey::ESide::sell(), 100, 1)));
+    EXPECT_GT(0, key(1, CompareKey::ESide::buy(), 100, 9).compare(key(1, CompareKey::ESide::buy(), 900, 1)));
+    EXPECT_GT(0, key(1, CompareKey::ESide::buy(), 100, 1).compare(key(1, CompareKey::ESide::buy(), 100, 9)));
+}
+
+TEST(StructureOperatorTest, compareExtremes)
+{
+    EXPECT_GT(0, key(-2147483647L - 1, 0, 0, 0).compare(key(2147483647L, 0, 0, 0)));
+    EXPECT_LT(0, key(2147483647L, 0, 0, 0).compare(key(-2147483647L - 1, 0, 0, 0)));
+    EXPECT_GT(0, key(0, 0, -1, 0).compare(key(0, 0, 0, 0)));
+}
+
+TEST(StructureOperatorTest, operatorsAgree)
+{
+    std::vector<CompareKey> keys;
+    for (long venue = 0; venue < 3; ++venue)
+    for (long side = CompareKey::ESide::buy(); side <= CompareKey::ESide::sell(); ++side)
+    for (long price = -1; price <= 1; ++price)
+    for (long lot = 0; lot < 2; ++lot)
+        keys.push_back(key(venue, side, price, lot));
+
+    CompareKey::lessThan lessThan;
+    for (size_t i = 0; i < keys.size(); ++i)
+    for (size_t j = 0; j < keys.size(); ++j)
+    {
+        int result = keys[i].compare(keys[j]);
+        EXPECT_EQ(i < j, result < 0);
+        EXPECT_EQ(i == j, result == 0);
+        EXPECT_EQ(i < j, keys[i] < keys[j]);
+        EXPECT_EQ(i < j, lessThan(keys[i], keys[j]));
+        EXPECT_EQ(i == j, keys[i] == keys[j]);
+    }
+}
+
+TEST(StructureOperatorTest, compareNested)
+{
+    CompareRecord record1;
+    record1.set_symbol("abc").set_key(key(1, CompareKey::ESide::buy(), 100, 5)).set_quantity(10);
+
+    CompareRecord record2 = record1;
+    EXPECT_EQ(0, record1.compare(record2));
+    EXPECT_TRUE(record1 == record2);
+
+    record2.set_quantity(5);
+    EXPECT_LT(0, record1.compare(record2));
+    EXPECT_TRUE(record2 < record1);
+    EXPECT_TRUE(record2.lessThan(record1));
+
+    record2.set_key(key(1, CompareKey::ESide::buy(), 101, 0));
+    EXPECT_GT(0, record1.compare(record2));
+    EXPECT_TRUE(record1 < record2);
+
+    record2.set_symbol("abb");
+    EXPECT_LT(0, record1.compare(record2));
+    EXPECT_FALSE(record1 == record2);
+}
+
+TEST(StructureOperatorTest, compareInherited)
+{
+    ICompareRecord record1;
+    record1.set_symbol("abc").set_quantity(10);
+    record1.set_sequence(2);
+
+    ICompareRecord record2 = record1;
+    EXPECT_EQ(0, record1.compare(record2));
+
+    record2.set_sequence(1);
+    EXPECT_TRUE(record2 < record1);
+
+    record2.set_quantity(11);
+    EXPECT_TRUE(record1 < record2);
+}
+
+TEST(StructureOperatorTest, sort)
+{
+    std::vector<CompareKey> keys;
+    for (long i = 0; i < 1000; ++i)
+        keys.push_back(key((i * 7) % 3, (i * 5) % 2 + 1, (i * 13) % 17 - 8, (i * 11) % 5));
+
+    std::sort(keys.begin(), keys.end());
+    for (size_t i = 1; i < keys.size(); ++i)
+        EXPECT_FALSE(keys[i] < keys[i - 1]);
+
+    std::sort(keys.begin(), keys.end(), CompareKey::lessThan());
+    for (size_t i = 1; i < keys.size(); ++i)
+        EXPECT_LE(0, keys[i].compare(keys[i - 1]));
+}
+
+}
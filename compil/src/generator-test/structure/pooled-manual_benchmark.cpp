@@ -0,0 +1,76 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure/pooled.h"
+
+#include "core/platform/benchmark.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace pooled
+{
+
+// one million objects created while a window of one thousand of them is alive
+template<class T>
+static void churn(std::vector<T>& window, T (*create)())
+{
+    for (int i = 0; i < 1000000; ++i)
+        window[i % window.size()] = create();
+}
+
+TEST(StructurePooledBenchmark, makeShared)
+{
+    std::vector<PlainOrderSPtr> window(1000);
+
+    plt::Benchmark benchmark("structure/pooled.PlainOrder.ref.1M");
+    while (benchmark.running())
+    {
+        churn(window, &plainOrderRef);
+        benchmark.consume(window);
+    }
+}
+
+TEST(StructurePooledBenchmark, pooled)
+{
+    std::vector<OrderSPtr> window(1000);
+
+    plt::Benchmark benchmark("structure/pooled.Order.ref.1M");
+    while (benchmark.running())
+    {
+        churn(window, &orderRef);
+        benchmark.consume(window);
+    }
+}
+
+}
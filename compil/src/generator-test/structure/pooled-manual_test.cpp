@@ -0,0 +1,175 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// based on code from Adam Bowen posted on stackoverflow.com
+
+#include "structure/pooled.h"
+
+#include "gtest/gtest.h"
+
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+namespace pooled
+{
+
+TEST(StructurePooledTest, reuse)
+{
+    OrderSPtr order = orderRef();
+    const Order* address = order.get();
+    size_t used = Order::poolUsed();
+    order.reset();
+    EXPECT_EQ(used - 1, Order::poolUsed());
+    
+    order = orderRef();
+    EXPECT_EQ(address, order.get());
+    EXPECT_EQ(used, Order::poolUsed());
+}
+
+TEST(StructurePooledTest, statistics)
+{
+    std::vector<OrderSPtr> orders;
+    orders.push_back(orderRef());
+    
+    size_t blocks = Order::poolBlocks();
+    size_t available = Order::poolAvailable();
+    EXPECT_GE(Order::poolThreads(), 1U);
+    
+    for (size_t i = 0; i < available + 10; ++i)
+        orders.push_back(orderRef());
+    EXPECT_EQ(blocks + 10, Order::poolBlocks());
+    EXPECT_EQ(0U, Order::poolAvailable());
+    EXPECT_EQ(Order::poolBlocks(), Order::poolUsed());
+    
+    orders.clear();
+    EXPECT_EQ(blocks + 10, Order::poolBlocks());
+    EXPECT_EQ(Order::poolBlocks(), Order::poolAvailable());
+    EXPECT_EQ(0U, Order::poolUsed());
+}
+
+TEST(StructurePooledTest, derived)
+{
+    size_t used = Order::poolUsed();
+    size_t limitUsed = LimitOrder::poolUsed();
+    
+    // LimitOrder has its own pool
+    LimitOrderSPtr limit = limitOrderRef();
+    EXPECT_EQ(used, Order::poolUsed());
+    EXPECT_EQ(limitUsed + 1, LimitOrder::poolUsed());
+    
+    // MarketOrder is bigger than Order and is not pooled
+    OrderSPtr market(new MarketOrder());
+    EXPECT_EQ(used, Order::poolUsed());
+    
+    // the derived objects are returned through the base class
+    OrderSPtr order(new LimitOrder());
+    EXPECT_EQ(limitUsed + 2, LimitOrder::poolUsed());
+    order.reset();
+    limit.reset();
+    EXPECT_EQ(limitUsed, LimitOrder::poolUsed());
+    market.reset();
+    EXPECT_EQ(used, Order::poolUsed());
+}
+
+TEST(StructurePooledTest, immutable)
+{
+    QuoteSPtr quote = Quote::Builder().set_bid(10).set_ask(12).finalize();
+    const Quote* address = quote.get();
+    size_t used = Quote::poolUsed();
+    quote.reset();
+    EXPECT_EQ(used - 1, Quote::poolUsed());
+    
+    quote = Quote::Builder().set_bid(11).set_ask(13).finalize();
+    EXPECT_EQ(address, quote.get());
+    EXPECT_EQ(11, quote->bid());
+    EXPECT_EQ(13, quote->ask());
+}
+
+#if !defined(_WIN32)
+
+static void* release(void* order)
+{
+    ((OrderSPtr*)order)->reset();
+    return 0;
+}
+
+TEST(StructurePooledTest, releaseFromOtherThread)
+{
+    OrderSPtr order = orderRef();
+    const Order* address = order.get();
+    
+    pthread_t thread;
+    pthread_create(&thread, 0, &release, &order);
+    pthread_join(thread, 0);
+    EXPECT_FALSE(order);
+    
+    // the released block is back in the cache of this thread
+    std::vector<OrderSPtr> orders;
+    size_t available = Order::poolAvailable();
+    for (size_t i = 0; i <= available; ++i)
+        orders.push_back(orderRef());
+    bool reused = false;
+    for (size_t i = 0; i < orders.size(); ++i)
+        reused = reused || (orders[i].get() == address);
+    EXPECT_TRUE(reused);
+}
+
+static void* allocate(void* orders)
+{
+    std::vector<OrderSPtr>& result = *(std::vector<OrderSPtr>*)orders;
+    for (int i = 0; i < 100; ++i)
+        result.push_back(orderRef());
+    result.resize(10);
+    return 0;
+}
+
+TEST(StructurePooledTest, threadExit)
+{
+    size_t threads = Order::poolThreads();
+    size_t blocks = Order::poolBlocks();
+    
+    std::vector<OrderSPtr> orders;
+    pthread_t thread;
+    pthread_create(&thread, 0, &allocate, &orders);
+    pthread_join(thread, 0);
+    
+    // the free blocks of the thread are freed when it exits
+    EXPECT_EQ(threads, Order::poolThreads());
+    EXPECT_EQ(blocks + 10, Order::poolBlocks());
+    
+    // the blocks still in use are freed when they are released
+    orders.clear();
+    EXPECT_EQ(blocks, Order::poolBlocks());
+}
+
+#endif
+
+}
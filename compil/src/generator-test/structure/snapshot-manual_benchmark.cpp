@@ -0,0 +1,196 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure/snapshot.h"
+#include "core/compil/snapshot.h"
+
+#include "core/platform/benchmark.h"
+
+#include "gtest/gtest.h"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#if !defined(_WIN32)
+
+#include <pthread.h>
+#include <unistd.h>
+
+namespace configuration
+{
+
+static const long readsPerThread = 1 << 16;
+
+static ConfigurationSPtr configuration(long revision)
+{
+    return Configuration::Builder().set_revision(revision).set_limit(revision * 2).finalize();
+}
+
+// the shared configuration guarded by a mutex, as it is done without a snapshot
+class LockedConfiguration
+{
+public:
+    explicit LockedConfiguration(const ConfigurationSPtr& object)
+        : mObject(object)
+    {
+        pthread_mutex_init(&mMutex, 0);
+    }
+
+    ~LockedConfiguration()
+    {
+        pthread_mutex_destroy(&mMutex);
+    }
+
+    ConfigurationSPtr get()
+    {
+        pthread_mutex_lock(&mMutex);
+        ConfigurationSPtr object = mObject;
+        pthread_mutex_unlock(&mMutex);
+        return object;
+    }
+
+    void set(const ConfigurationSPtr& object)
+    {
+        pthread_mutex_lock(&mMutex);
+        mObject = object;
+        pthread_mutex_unlock(&mMutex);
+    }
+
+private:
+    pthread_mutex_t   mMutex;
+    ConfigurationSPtr mObject;
+};
+
+struct Shared
+{
+    ConfigurationSnapshot* mSnapshot;
+    LockedConfiguration* mLocked;
+    volatile bool mStop;
+};
+
+static void* readSnapshot(void* argument)
+{
+    Shared* shared = static_cast<Shared*>(argument);
+    ConfigurationSnapshot::reader reader(*shared->mSnapshot);
+    long sum = 0;
+    for (long i = 0; i < readsPerThread; ++i)
+    {
+        ConfigurationSnapshot::view view(reader);
+        sum += view->limit();
+    }
+    plt::Benchmark::consume(sum);
+    return 0;
+}
+
+static void* readLocked(void* argument)
+{
+    Shared* shared = static_cast<Shared*>(argument);
+    long sum = 0;
+    for (long i = 0; i < readsPerThread; ++i)
+        sum += shared->mLocked->get()->limit();
+    plt::Benchmark::consume(sum);
+    return 0;
+}
+
+// publishes a new configuration every millisecond while the readers run
+static void* write(void* argument)
+{
+    Shared* shared = static_cast<Shared*>(argument);
+    for (long revision = 1; !shared->mStop; ++revision)
+    {
+        ConfigurationSPtr object = configuration(revision);
+        if (shared->mSnapshot)
+            shared->mSnapshot->publish(object);
+        else
+            shared->mLocked->set(object);
+        usleep(1000);
+    }
+    return 0;
+}
+
+static void run(const std::string& name, void* (*routine)(void*), Shared& shared)
+{
+    for (int threads = 1; threads <= 64; threads *= 2)
+    {
+        shared.mStop = false;
+        pthread_t writer;
+        pthread_create(&writer, 0, &write, &shared);
+        
+        long long start = plt::getMonotonicTime();
+        pthread_t readers[64];
+        for (int i = 0; i < threads; ++i)
+            pthread_create(&readers[i], 0, routine, &shared);
+        for (int i = 0; i < threads; ++i)
+            pthread_join(readers[i], 0);
+        long long elapsed = plt::getMonotonicTime() - start;
+        
+        shared.mStop = true;
+        pthread_join(writer, 0);
+        
+        // the time of a read as seen by the whole process
+        std::cout << "[ BENCHMARK] "
+                  << name
+                  << "."
+                  << threads
+                  << "threads: "
+                  << threads * readsPerThread
+                  << " reads, "
+                  << std::fixed << std::setprecision(2)
+                  << (double)elapsed / (threads * readsPerThread)
+                  << " ns/read"
+                  << std::endl;
+    }
+}
+
+TEST(ConfigurationSnapshotBenchmark, readers)
+{
+    ConfigurationSnapshot snapshot(configuration(0), 64);
+    Shared shared;
+    shared.mSnapshot = &snapshot;
+    shared.mLocked = 0;
+    run("structure/snapshot.Configuration.snapshot", &readSnapshot, shared);
+}
+
+TEST(ConfigurationSnapshotBenchmark, lockedReaders)
+{
+    LockedConfiguration locked(configuration(0));
+    Shared shared;
+    shared.mSnapshot = 0;
+    shared.mLocked = &locked;
+    run("structure/snapshot.Configuration.locked", &readLocked, shared);
+}
+
+}
+
+#endif
@@ -0,0 +1,199 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// based on code from Adam Bowen posted on stackoverflow.com
+
+#include "structure/snapshot.h"
+#include "core/compil/snapshot.h"
+
+#include "gtest/gtest.h"
+
+#include <boost/weak_ptr.hpp>
+
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+namespace configuration
+{
+
+static ConfigurationSPtr configuration(long revision)
+{
+    return Configuration::Builder().set_revision(revision).set_limit(revision * 2).finalize();
+}
+
+TEST(StructureSnapshotTest, view)
+{
+    ConfigurationSnapshot holder(configuration(1));
+    ConfigurationSnapshot::reader reader(holder);
+    
+    ConfigurationSnapshot::view first(reader);
+    EXPECT_EQ(1, first->revision());
+    
+    holder.publish(configuration(2));
+    EXPECT_EQ(1, first->revision());
+    EXPECT_EQ(2, holder.current()->revision());
+    
+    // the nested views announce the epoch of the outer view
+    ConfigurationSnapshot::view second(reader);
+    EXPECT_EQ(2, second->revision());
+    EXPECT_EQ(4, (*second).limit());
+}
+
+TEST(StructureSnapshotTest, retiredVersionIsReleasedAfterTheViews)
+{
+    ConfigurationSnapshot holder(configuration(1));
+    ConfigurationSnapshot::reader reader(holder);
+    
+    boost::weak_ptr<Configuration> retired = holder.current();
+    {
+        ConfigurationSnapshot::view view(reader);
+        holder.publish(configuration(2));
+        EXPECT_FALSE(retired.expired());
+        EXPECT_EQ(1, view->revision());
+    }
+    EXPECT_FALSE(retired.expired());
+    
+    holder.reclaim();
+    EXPECT_TRUE(retired.expired());
+    
+    // without views the publish releases the previous version right away
+    retired = holder.current();
+    holder.publish(configuration(3));
+    EXPECT_TRUE(retired.expired());
+}
+
+TEST(StructureSnapshotTest, share)
+{
+    ConfigurationSnapshot holder(configuration(1));
+    ConfigurationSnapshot::reader reader(holder);
+    
+    ConfigurationSPtr shared;
+    {
+        ConfigurationSnapshot::view view(reader);
+        shared = view.share();
+    }
+    holder.publish(configuration(2));
+    holder.reclaim();
+    EXPECT_EQ(1, shared->revision());
+}
+
+TEST(StructureSnapshotTest, readerSlots)
+{
+    ConfigurationSnapshot holder(configuration(1), 2);
+    boost::weak_ptr<Configuration> retired = holder.current();
+    {
+        ConfigurationSnapshot::reader reader1(holder);
+        ConfigurationSnapshot::reader reader2(holder);
+    }
+    
+    // the slots of the destroyed readers are free again
+    ConfigurationSnapshot::reader reader1(holder);
+    ConfigurationSnapshot::reader reader2(holder);
+    ConfigurationSnapshot::view view1(reader1);
+    ConfigurationSnapshot::view view2(reader2);
+    EXPECT_EQ(1, view1->revision());
+    EXPECT_EQ(1, view2->revision());
+}
+
+TEST(StructureSnapshotTest, moreReadersThanSlots)
+{
+    ConfigurationSnapshot holder(configuration(1), 2);
+    ConfigurationSnapshot::reader reader1(holder);
+    {
+        ConfigurationSnapshot::reader reader2(holder);
+        EXPECT_THROW(ConfigurationSnapshot::reader reader3(holder), std::length_error);
+    }
+    
+    // the failed registration takes no slot
+    ConfigurationSnapshot::reader reader3(holder);
+    ConfigurationSnapshot::view view(reader3);
+    EXPECT_EQ(1, view->revision());
+}
+
+#if !defined(_WIN32)
+
+struct Readers
+{
+    ConfigurationSnapshot* mHolder;
+    volatile bool mStop;
+    volatile long mErrors;
+};
+
+static void* read(void* argument)
+{
+    Readers* readers = static_cast<Readers*>(argument);
+    ConfigurationSnapshot::reader reader(*readers->mHolder);
+    long last = 0;
+    while (!readers->mStop)
+    {
+        ConfigurationSnapshot::view view(reader);
+        // the versions are consistent and never go back
+        if (view->limit() != view->revision() * 2 || view->revision() < last)
+            __sync_fetch_and_add(&readers->mErrors, 1);
+        last = view->revision();
+    }
+    return 0;
+}
+
+TEST(StructureSnapshotTest, concurrentReaders)
+{
+    ConfigurationSPtr first = configuration(0);
+    boost::weak_ptr<Configuration> retired = first;
+    
+    ConfigurationSnapshot holder(first);
+    first.reset();
+    
+    Readers readers;
+    readers.mHolder = &holder;
+    readers.mStop = false;
+    readers.mErrors = 0;
+    
+    pthread_t threads[4];
+    for (int i = 0; i < 4; ++i)
+        pthread_create(&threads[i], 0, &read, &readers);
+    for (long revision = 1; revision <= 10000; ++revision)
+        holder.publish(configuration(revision));
+    readers.mStop = true;
+    for (int i = 0; i < 4; ++i)
+        pthread_join(threads[i], 0);
+    
+    EXPECT_EQ(0, readers.mErrors);
+    EXPECT_EQ(10000, holder.current()->revision());
+    
+    holder.reclaim();
+    EXPECT_TRUE(retired.expired());
+}
+
+#endif
+
+}
@@ -0,0 +1,168 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "structure/tracked.h"
+
+#include "gtest/gtest.h"
+
+namespace tracked
+{
+
+TEST(StructureTrackedTest, setterMarksModified)
+{
+    Account account;
+    EXPECT_FALSE(account.isModified());
+
+    account.set_id(1);
+    EXPECT_TRUE(account.isModified());
+    EXPECT_TRUE(account.modified_id());
+    EXPECT_FALSE(account.modified_owner());
+
+    account.checkpoint();
+    EXPECT_FALSE(account.isModified());
+    EXPECT_FALSE(account.modified_id());
+    EXPECT_TRUE(account.valid_id());
+
+    account.clear_owner();
+    EXPECT_TRUE(account.modified_owner());
+    account.checkpoint();
+
+    account.mutable_history().push_back(1);
+    EXPECT_TRUE(account.modified_history());
+    EXPECT_EQ(1U, account.history().size());
+}
+
+TEST(StructureTrackedTest, baseFields)
+{
+    SavingsAccount account;
+    account.set_rate(5);
+    EXPECT_TRUE(account.isModified());
+    EXPECT_FALSE(account.modified_id());
+
+    account.checkpoint();
+    account.set_id(2);
+    EXPECT_TRUE(account.isModified());
+    EXPECT_TRUE(account.modified_id());
+    EXPECT_FALSE(account.modified_rate());
+
+    account.checkpoint();
+    EXPECT_FALSE(account.isModified());
+}
+
+TEST(StructureTrackedTest, diff)
+{
+    Account account1;
+    account1.set_id(1);
+    account1.set_owner("a");
+
+    Account account2(account1);
+    account2.set_limit(200);
+    account2.clear_owner();
+
+    Account delta = Account::diff(account1, account2);
+    EXPECT_FALSE(delta.modified_id());
+    EXPECT_TRUE(delta.modified_owner());
+    EXPECT_TRUE(delta.modified_limit());
+    EXPECT_FALSE(delta.modified_history());
+
+    EXPECT_FALSE(Account::diff(account1, account1).isModified());
+}
+
+TEST(StructureTrackedTest, diffHoldsOnlyTheChanges)
+{
+    Account account1;
+    account1.set_id(1);
+    account1.set_owner("a");
+    account1.set_history(std::vector<long>(1000, 7));
+
+    Account account2(account1);
+    account2.set_limit(200);
+
+    // the unchanged fields are not copied in the delta
+    Account delta = Account::diff(account1, account2);
+    EXPECT_FALSE(delta.valid_id());
+    EXPECT_FALSE(delta.exist_owner());
+    EXPECT_FALSE(delta.exist_history());
+    EXPECT_EQ(200, delta.limit());
+}
+
+TEST(StructureTrackedTest, applyDelta)
+{
+    Account account1;
+    account1.set_id(1);
+    account1.set_owner("a");
+    account1.checkpoint();
+
+    Account account2(account1);
+    account2.set_id(2);
+    account2.clear_owner();
+    account2.mutable_history().push_back(3);
+
+    Account target(account1);
+    target.applyDelta(Account::diff(account1, account2));
+    EXPECT_EQ(2, target.id());
+    EXPECT_FALSE(target.exist_owner());
+    ASSERT_TRUE(target.exist_history());
+    EXPECT_EQ(1U, target.history().size());
+    EXPECT_EQ(100, target.limit());
+    EXPECT_TRUE(target.modified_id());
+
+    // the delta of the modifications since the last checkpoint
+    Account replica(account1);
+    replica.applyDelta(account2);
+    EXPECT_EQ(2, replica.id());
+    EXPECT_FALSE(replica.exist_owner());
+    EXPECT_FALSE(Account::diff(replica, account2).isModified());
+}
+
+TEST(StructureTrackedTest, applyDeltaDerived)
+{
+    SavingsAccount account1;
+    account1.set_id(1);
+    account1.set_rate(5);
+
+    SavingsAccount account2(account1);
+    account2.set_id(2);
+    account2.set_rate(15);
+
+    SavingsAccount delta = SavingsAccount::diff(account1, account2);
+    EXPECT_TRUE(delta.modified_id());
+    EXPECT_TRUE(delta.modified_rate());
+
+    account1.checkpoint();
+    account1.applyDelta(delta);
+    EXPECT_EQ(2, account1.id());
+    EXPECT_EQ(15, account1.rate());
+    EXPECT_TRUE(account1.isModified());
+}
+
+}
@@ -47,4 +47,33 @@ TEST(StructureUpcopyTest, upcopy)
     EXPECT_EQ(2, structure3->i2());
 }
 
+TEST(StructureUpcopyTest, builderSharesTheUnchangedFields)
+{
+    std::vector<long> values(1000, 7);
+    DocumentSPtr document1 = Document::Builder().set_revision(1).set_title("title").set_values(values).finalize();
+    DocumentSPtr document2 = Document::Builder(*document1).set_revision(2).finalize();
+    
+    EXPECT_EQ(1, document1->revision());
+    EXPECT_EQ(2, document2->revision());
+    EXPECT_EQ(&document1->title(), &document2->title());
+    EXPECT_EQ(&document1->values(), &document2->values());
+}
+
+TEST(StructureUpcopyTest, builderCopiesTheChangedFields)
+{
+    DocumentSPtr document1 = Document::Builder().set_title("title1").set_values(std::vector<long>(3, 7)).finalize();
+    
+    Document::Builder builder(*document1);
+    builder.set_title("title2");
+    builder.mutable_values().push_back(8);
+    DocumentSPtr document2 = builder.finalize();
+    
+    EXPECT_EQ("title1", document1->title());
+    EXPECT_EQ("title2", document2->title());
+    ASSERT_EQ(3U, document1->values().size());
+    ASSERT_EQ(4U, document2->values().size());
+    EXPECT_EQ(8, document2->values()[3]);
+    EXPECT_NE(&document1->values(), &document2->values());
+}
+
 }
@@ -0,0 +1,68 @@
+#include "generator/c++/configuration/formatter_pointer_position.h"
+
+namespace config
+{
+
+namespace cpp
+{
+
+EPointerPosition::EPointerPosition()
+        : mValue(kInvalid)
+{
+}
+
+EPointerPosition::EPointerPosition(long value)
+        : mValue(value)
+{
+}
+
+const EPointerPosition EPointerPosition::invalid()
+{
+    return EPointerPosition(kInvalid);
+}
+
+const EPointerPosition EPointerPosition::withTheType()
+{
+    return EPointerPosition(kWithTheType);
+}
+
+const EPointerPosition EPointerPosition::withTheName()
+{
+    return EPointerPosition(kWithTheName);
+}
+
+long EPointerPosition::value() const
+{
+    return mValue;
+}
+
+const char* EPointerPosition::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "withTheType",
+        "withTheName",
+    };
+    return names[(size_t)value];
+}
+
+const char* EPointerPosition::shortName() const
+{
+    return shortName(value());
+}
+
+bool EPointerPosition::operator==(const EPointerPosition& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EPointerPosition::operator!=(const EPointerPosition& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+}
+
+}
+
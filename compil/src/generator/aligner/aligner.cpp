@@ -36,10 +36,14 @@ namespace compil
 {
 
 cpp::frm::ConstructorNameSPtr builderConstructorName = cpp::frm::constructorNameRef("Builder");
+cpp::frm::ConstructorNameSPtr rowConstructorName = cpp::frm::constructorNameRef("Row");
 
 cpp::frm::TypeSPtr bl             = cpp::frm::typeRef() << cpp::frm::typeNameRef("bool");
 cpp::frm::TypeSPtr vd             = cpp::frm::typeRef() << cpp::frm::typeNameRef("void");
 cpp::frm::TypeSPtr st             = cpp::frm::typeRef() << cpp::frm::typeNameRef("size_t");
+cpp::frm::TypeSPtr dbl            = cpp::frm::typeRef() << cpp::frm::typeNameRef("double");
+cpp::frm::TypeSPtr vdPtr          = cpp::frm::typeRef() << cpp::frm::typeNameRef("void")
+                                                        << cpp::frm::ETypeDecoration::pointer();
 cpp::frm::TypeSPtr const_char_ptr = cpp::frm::typeRef() << cpp::frm::ETypeDeclaration::const_()
                                                         << cpp::frm::typeNameRef("char")
                                                         << cpp::frm::ETypeDecoration::pointer();
@@ -62,13 +66,17 @@ cpp::frm::TypeSPtr cstBuilderRef  = cpp::frm::typeRef() << cpp::frm::ETypeDeclar
                                                         << cpp::frm::typeNameRef("Builder")
                                                         << cpp::frm::ETypeDecoration::reference();
 
+cpp::frm::TypeSPtr row            = cpp::frm::typeRef() << cpp::frm::typeNameRef("Row");
+
 cpp::frm::TypeSPtr chr            = cpp::frm::typeRef() << cpp::frm::typeNameRef("char");
 cpp::frm::TypeSPtr integer        = cpp::frm::typeRef() << cpp::frm::typeNameRef("int");
 
 cpp::frm::MethodNameSPtr fnValue                  = cpp::frm::methodNameRef("value");
 cpp::frm::MethodNameSPtr fnShortName              = cpp::frm::methodNameRef("shortName");
+cpp::frm::MethodNameSPtr fnFromString             = cpp::frm::methodNameRef("fromString");
 cpp::frm::MethodNameSPtr fnBuild                  = cpp::frm::methodNameRef("build");
 cpp::frm::MethodNameSPtr fnClone                  = cpp::frm::methodNameRef("clone");
+cpp::frm::MethodNameSPtr fnCloneAll               = cpp::frm::methodNameRef("cloneAll");
 cpp::frm::MethodNameSPtr fnCreate                 = cpp::frm::methodNameRef("create");
 cpp::frm::MethodNameSPtr fnFinalize               = cpp::frm::methodNameRef("finalize");
 
@@ -80,6 +88,35 @@ cpp::frm::MethodNameSPtr fnSharedFromThis         = cpp::frm::methodNameRef("sha
 cpp::frm::MethodNameSPtr fnIsInitialized          = cpp::frm::methodNameRef("isInitialized");
 cpp::frm::MethodNameSPtr fnIsVoid                 = cpp::frm::methodNameRef("isVoid");
 
+cpp::frm::MethodNameSPtr fnInternHash             = cpp::frm::methodNameRef("internHash");
+cpp::frm::MethodNameSPtr fnInternEquals           = cpp::frm::methodNameRef("internEquals");
+cpp::frm::MethodNameSPtr fnInternTable            = cpp::frm::methodNameRef("internTable");
+cpp::frm::MethodNameSPtr fnInternTableSize        = cpp::frm::methodNameRef("internTableSize");
+cpp::frm::MethodNameSPtr fnInternTableLookups     = cpp::frm::methodNameRef("internTableLookups");
+cpp::frm::MethodNameSPtr fnInternTableHits        = cpp::frm::methodNameRef("internTableHits");
+cpp::frm::MethodNameSPtr fnInternTableHitRatio    = cpp::frm::methodNameRef("internTableHitRatio");
+
+cpp::frm::MethodNameSPtr fnOperatorNew            = cpp::frm::methodNameRef("operator new");
+cpp::frm::MethodNameSPtr fnOperatorDelete         = cpp::frm::methodNameRef("operator delete");
+cpp::frm::MethodNameSPtr fnPoolThreads            = cpp::frm::methodNameRef("poolThreads");
+cpp::frm::MethodNameSPtr fnPoolBlocks             = cpp::frm::methodNameRef("poolBlocks");
+cpp::frm::MethodNameSPtr fnPoolAvailable          = cpp::frm::methodNameRef("poolAvailable");
+cpp::frm::MethodNameSPtr fnPoolUsed               = cpp::frm::methodNameRef("poolUsed");
+
+cpp::frm::MethodNameSPtr fnIsModified             = cpp::frm::methodNameRef("isModified");
+cpp::frm::MethodNameSPtr fnCheckpoint             = cpp::frm::methodNameRef("checkpoint");
+cpp::frm::MethodNameSPtr fnDiff                   = cpp::frm::methodNameRef("diff");
+cpp::frm::MethodNameSPtr fnApplyDelta             = cpp::frm::methodNameRef("applyDelta");
+cpp::frm::MethodNameSPtr fnCopyDifferences        = cpp::frm::methodNameRef("copyDifferences");
+
+cpp::frm::MethodNameSPtr fnAccept                 = cpp::frm::methodNameRef("accept");
+cpp::frm::MethodNameSPtr fnVisit                  = cpp::frm::methodNameRef("visit");
+
+cpp::frm::MethodNameSPtr fnDispatch               = cpp::frm::methodNameRef("dispatch");
+cpp::frm::MethodNameSPtr fnPost                   = cpp::frm::methodNameRef("post");
+cpp::frm::MethodNameSPtr fnSend                   = cpp::frm::methodNameRef("send");
+cpp::frm::MethodNameSPtr fnProcess                = cpp::frm::methodNameRef("process");
+
 cpp::frm::MethodNameSPtr fnInprocId               = cpp::frm::methodNameRef("inprocId");
 cpp::frm::MethodNameSPtr fnGet                    = cpp::frm::methodNameRef("get");
 cpp::frm::MethodNameSPtr fnRegisterCloneFunction  = cpp::frm::methodNameRef("registerCloneFunction");
@@ -95,11 +132,13 @@ cpp::frm::MethodNameSPtr fnOperatorStore          = cpp::frm::methodNameRef("ope
 cpp::frm::MethodNameSPtr fnOperatorStoreEq        = cpp::frm::methodNameRef("operator<<=");
 cpp::frm::MethodNameSPtr fnOperatorPlusEq         = cpp::frm::methodNameRef("operator+=");
 cpp::frm::MethodNameSPtr fnOperatorFn             = cpp::frm::methodNameRef("operator()");
+cpp::frm::MethodNameSPtr fnOperatorAt             = cpp::frm::methodNameRef("operator[]");
 cpp::frm::MethodNameSPtr fnOperatorPlus           = cpp::frm::methodNameRef("operator+");
 cpp::frm::MethodNameSPtr fnOperatorMinus          = cpp::frm::methodNameRef("operator-");
 
 cpp::frm::MethodNameSPtr fnFunctionalOperatorEq   = cpp::frm::methodNameRef("isEqual");
 cpp::frm::MethodNameSPtr fnFunctionalOperatorLt   = cpp::frm::methodNameRef("lessThan");
+cpp::frm::MethodNameSPtr fnCompare                = cpp::frm::methodNameRef("compare");
 
 cpp::frm::MethodNameSPtr fnUpdate                 = cpp::frm::methodNameRef("update");
 cpp::frm::MethodNameSPtr fnObtain                 = cpp::frm::methodNameRef("obtain");
@@ -118,17 +157,34 @@ cpp::frm::MethodNameSPtr fnTest                   = cpp::frm::methodNameRef("tes
 cpp::frm::MethodNameSPtr fnIsSet                  = cpp::frm::methodNameRef("isSet");
 cpp::frm::MethodNameSPtr fnIsClear                = cpp::frm::methodNameRef("isClear");
 
+cpp::frm::MethodNameSPtr fnSize                   = cpp::frm::methodNameRef("size");
+cpp::frm::MethodNameSPtr fnEmpty                  = cpp::frm::methodNameRef("empty");
+cpp::frm::MethodNameSPtr fnReserve                = cpp::frm::methodNameRef("reserve");
+cpp::frm::MethodNameSPtr fnPushBack               = cpp::frm::methodNameRef("push_back");
+
 cpp::frm::NamespaceNameSPtr nsBuilder = cpp::frm::namespaceNameRef("Builder");
+cpp::frm::NamespaceNameSPtr nsRow     = cpp::frm::namespaceNameRef("Row");
 
 cpp::frm::VariableNameSPtr bits     = cpp::frm::variableNameRef("bits");
 cpp::frm::VariableNameSPtr child    = cpp::frm::variableNameRef("child");
+cpp::frm::VariableNameSPtr channel  = cpp::frm::variableNameRef("channel");
+cpp::frm::VariableNameSPtr columns  = cpp::frm::variableNameRef("columns");
+cpp::frm::VariableNameSPtr delta    = cpp::frm::variableNameRef("delta");
+cpp::frm::VariableNameSPtr index    = cpp::frm::variableNameRef("index");
 cpp::frm::VariableNameSPtr function = cpp::frm::variableNameRef("function");
 cpp::frm::VariableNameSPtr mask     = cpp::frm::variableNameRef("mask");
+cpp::frm::VariableNameSPtr modified = cpp::frm::variableNameRef("modified");
+cpp::frm::VariableNameSPtr name     = cpp::frm::variableNameRef("name");
 cpp::frm::VariableNameSPtr object   = cpp::frm::variableNameRef("object");
 cpp::frm::VariableNameSPtr object1  = cpp::frm::variableNameRef("object1");
 cpp::frm::VariableNameSPtr object2  = cpp::frm::variableNameRef("object2");
+cpp::frm::VariableNameSPtr objects  = cpp::frm::variableNameRef("objects");
 cpp::frm::VariableNameSPtr parent   = cpp::frm::variableNameRef("parent");
+cpp::frm::VariableNameSPtr queue    = cpp::frm::variableNameRef("queue");
 cpp::frm::VariableNameSPtr rValue   = cpp::frm::variableNameRef("rValue");
+cpp::frm::VariableNameSPtr size     = cpp::frm::variableNameRef("size");
+cpp::frm::VariableNameSPtr stub     = cpp::frm::variableNameRef("stub");
+cpp::frm::VariableNameSPtr target   = cpp::frm::variableNameRef("target");
 cpp::frm::VariableNameSPtr value    = cpp::frm::variableNameRef("value");
 
 
@@ -53,10 +53,13 @@
 namespace compil
 {
 extern cpp::frm::ConstructorNameSPtr builderConstructorName;
+extern cpp::frm::ConstructorNameSPtr rowConstructorName;
 
 extern cpp::frm::TypeSPtr bl;
 extern cpp::frm::TypeSPtr vd;
 extern cpp::frm::TypeSPtr st;
+extern cpp::frm::TypeSPtr dbl;
+extern cpp::frm::TypeSPtr vdPtr;
 extern cpp::frm::TypeSPtr const_char_ptr;
 extern cpp::frm::TypeSPtr cloneFunction;
 
@@ -69,13 +72,16 @@ extern cpp::frm::TypeSPtr cstFRef;
 
 extern cpp::frm::TypeSPtr builder;
 extern cpp::frm::TypeSPtr cstBuilderRef;
+extern cpp::frm::TypeSPtr row;
 extern cpp::frm::TypeSPtr chr;
 extern cpp::frm::TypeSPtr integer;
 
 extern cpp::frm::MethodNameSPtr fnValue;
 extern cpp::frm::MethodNameSPtr fnShortName;
+extern cpp::frm::MethodNameSPtr fnFromString;
 extern cpp::frm::MethodNameSPtr fnBuild;
 extern cpp::frm::MethodNameSPtr fnClone;
+extern cpp::frm::MethodNameSPtr fnCloneAll;
 extern cpp::frm::MethodNameSPtr fnCreate;
 extern cpp::frm::MethodNameSPtr fnFinalize;
 
@@ -85,6 +91,33 @@ extern cpp::frm::MethodNameSPtr fnSharedFromThis;
 
 extern cpp::frm::MethodNameSPtr fnIsInitialized;
 extern cpp::frm::MethodNameSPtr fnIsVoid;
+extern cpp::frm::MethodNameSPtr fnInternHash;
+extern cpp::frm::MethodNameSPtr fnInternEquals;
+extern cpp::frm::MethodNameSPtr fnInternTable;
+extern cpp::frm::MethodNameSPtr fnInternTableSize;
+extern cpp::frm::MethodNameSPtr fnInternTableLookups;
+extern cpp::frm::MethodNameSPtr fnInternTableHits;
+extern cpp::frm::MethodNameSPtr fnInternTableHitRatio;
+extern cpp::frm::MethodNameSPtr fnOperatorNew;
+extern cpp::frm::MethodNameSPtr fnOperatorDelete;
+extern cpp::frm::MethodNameSPtr fnPoolThreads;
+extern cpp::frm::MethodNameSPtr fnPoolBlocks;
+extern cpp::frm::MethodNameSPtr fnPoolAvailable;
+extern cpp::frm::MethodNameSPtr fnPoolUsed;
+
+extern cpp::frm::MethodNameSPtr fnIsModified;
+extern cpp::frm::MethodNameSPtr fnCheckpoint;
+extern cpp::frm::MethodNameSPtr fnDiff;
+extern cpp::frm::MethodNameSPtr fnApplyDelta;
+extern cpp::frm::MethodNameSPtr fnCopyDifferences;
+
+extern cpp::frm::MethodNameSPtr fnAccept;
+extern cpp::frm::MethodNameSPtr fnVisit;
+
+extern cpp::frm::MethodNameSPtr fnDispatch;
+extern cpp::frm::MethodNameSPtr fnPost;
+extern cpp::frm::MethodNameSPtr fnSend;
+extern cpp::frm::MethodNameSPtr fnProcess;
 
 extern cpp::frm::MethodNameSPtr fnInprocId;
 extern cpp::frm::MethodNameSPtr fnGet;
@@ -98,6 +131,7 @@ extern cpp::frm::MethodNameSPtr fnOperatorEq;
 extern cpp::frm::MethodNameSPtr fnOperatorNe;
 extern cpp::frm::MethodNameSPtr fnOperatorLt;
 extern cpp::frm::MethodNameSPtr fnOperatorFn;
+extern cpp::frm::MethodNameSPtr fnOperatorAt;
 extern cpp::frm::MethodNameSPtr fnOperatorStore;
 extern cpp::frm::MethodNameSPtr fnOperatorStoreEq;
 extern cpp::frm::MethodNameSPtr fnOperatorPlusEq;
@@ -106,6 +140,7 @@ extern cpp::frm::MethodNameSPtr fnOperatorMinus;
 
 extern cpp::frm::MethodNameSPtr fnFunctionalOperatorEq;
 extern cpp::frm::MethodNameSPtr fnFunctionalOperatorLt;
+extern cpp::frm::MethodNameSPtr fnCompare;
 
 extern cpp::frm::MethodNameSPtr fnReset;
 extern cpp::frm::MethodNameSPtr fnSet;
@@ -120,18 +155,34 @@ extern cpp::frm::MethodNameSPtr fnFlip;
 extern cpp::frm::MethodNameSPtr fnTest;
 extern cpp::frm::MethodNameSPtr fnIsSet;
 extern cpp::frm::MethodNameSPtr fnIsClear;
+extern cpp::frm::MethodNameSPtr fnSize;
+extern cpp::frm::MethodNameSPtr fnEmpty;
+extern cpp::frm::MethodNameSPtr fnReserve;
+extern cpp::frm::MethodNameSPtr fnPushBack;
 
 extern cpp::frm::NamespaceNameSPtr nsBuilder;
+extern cpp::frm::NamespaceNameSPtr nsRow;
 
 extern cpp::frm::VariableNameSPtr bits;
 extern cpp::frm::VariableNameSPtr child;
+extern cpp::frm::VariableNameSPtr channel;
+extern cpp::frm::VariableNameSPtr columns;
+extern cpp::frm::VariableNameSPtr delta;
+extern cpp::frm::VariableNameSPtr index;
 extern cpp::frm::VariableNameSPtr function;
 extern cpp::frm::VariableNameSPtr mask;
+extern cpp::frm::VariableNameSPtr modified;
+extern cpp::frm::VariableNameSPtr name;
 extern cpp::frm::VariableNameSPtr object;
 extern cpp::frm::VariableNameSPtr object1;
 extern cpp::frm::VariableNameSPtr object2;
+extern cpp::frm::VariableNameSPtr objects;
 extern cpp::frm::VariableNameSPtr parent;
+extern cpp::frm::VariableNameSPtr queue;
 extern cpp::frm::VariableNameSPtr rValue;
+extern cpp::frm::VariableNameSPtr size;
+extern cpp::frm::VariableNameSPtr stub;
+extern cpp::frm::VariableNameSPtr target;
 extern cpp::frm::VariableNameSPtr value;
 
 
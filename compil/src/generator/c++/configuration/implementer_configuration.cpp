@@ -38,6 +38,10 @@ ImplementerConfiguration::ImplementerConfiguration()
     : applicationCppExtension(use_cpp)
     , applicationCppHeaderExtension(use_h)
     , mCppIncludePath(include_path_based_on_import)
+    , mCppAccessors(accessors_out_of_line)
+    , mCppForwardHeader(forward_header_none)
+    , mCppColumns(columns_none)
+    , mCppShmTransport(shm_transport_none)
     , mFlagsEnumeration(flags_enumeration_use_core_template)
     , mIntegerTypes(use_native)
     , mNullOr0(use_null)
@@ -86,6 +90,94 @@ void validate(boost::any& v,
     }
 }
 
+void validate(boost::any& v, 
+              const std::vector<std::string>& values,
+              ImplementerConfiguration::ECppAccessors* target_type, int)
+{
+    boost::program_options::validators::check_first_occurrence(v);
+    const std::string& s = boost::program_options::validators::get_single_string(values);
+    
+    if (boost::iequals(s, "accessors_out_of_line"))
+    {
+        v = boost::any(ImplementerConfiguration::accessors_out_of_line);
+    }
+    else if (boost::iequals(s, "accessors_inline"))
+    {
+        v = boost::any(ImplementerConfiguration::accessors_inline);
+    }
+    else
+    {
+        throw boost::program_options::validation_error(
+                  boost::program_options::validation_error::invalid_option_value);
+    }
+}
+
+void validate(boost::any& v, 
+              const std::vector<std::string>& values,
+              ImplementerConfiguration::ECppForwardHeader* target_type, int)
+{
+    boost::program_options::validators::check_first_occurrence(v);
+    const std::string& s = boost::program_options::validators::get_single_string(values);
+    
+    if (boost::iequals(s, "forward_header_none"))
+    {
+        v = boost::any(ImplementerConfiguration::forward_header_none);
+    }
+    else if (boost::iequals(s, "forward_header_per_document"))
+    {
+        v = boost::any(ImplementerConfiguration::forward_header_per_document);
+    }
+    else
+    {
+        throw boost::program_options::validation_error(
+                  boost::program_options::validation_error::invalid_option_value);
+    }
+}
+
+void validate(boost::any& v, 
+              const std::vector<std::string>& values,
+              ImplementerConfiguration::ECppColumns* target_type, int)
+{
+    boost::program_options::validators::check_first_occurrence(v);
+    const std::string& s = boost::program_options::validators::get_single_string(values);
+    
+    if (boost::iequals(s, "columns_none"))
+    {
+        v = boost::any(ImplementerConfiguration::columns_none);
+    }
+    else if (boost::iequals(s, "columns_per_structure"))
+    {
+        v = boost::any(ImplementerConfiguration::columns_per_structure);
+    }
+    else
+    {
+        throw boost::program_options::validation_error(
+                  boost::program_options::validation_error::invalid_option_value);
+    }
+}
+
+void validate(boost::any& v, 
+              const std::vector<std::string>& values,
+              ImplementerConfiguration::ECppShmTransport* target_type, int)
+{
+    boost::program_options::validators::check_first_occurrence(v);
+    const std::string& s = boost::program_options::validators::get_single_string(values);
+    
+    if (boost::iequals(s, "shm_transport_none"))
+    {
+        v = boost::any(ImplementerConfiguration::shm_transport_none);
+    }
+    else if (boost::iequals(s, "shm_transport_per_interface"))
+    {
+        v = boost::any(ImplementerConfiguration::shm_transport_per_interface);
+    }
+    else
+    {
+        throw boost::program_options::validation_error(
+                  boost::program_options::validation_error::invalid_option_value);
+    }
+}
+
 void ImplementerConfiguration::addCommonOptions(bpo::options_description& options)
 {
     options.add_options()
@@ -94,6 +186,19 @@ void ImplementerConfiguration::addCommonOptions(bpo::options_description& option
                              "package of the core")
         ("cpp.include_path", bpo::value<ECppIncludePath>(&mCppIncludePath),
                              "how to form cpp include paths")
+        ("cpp.accessors",    bpo::value<ECppAccessors>(&mCppAccessors),
+                             "where to define the trivial accessors: "
+                             "accessors_out_of_line or accessors_inline")
+        ("cpp.forward_header", bpo::value<ECppForwardHeader>(&mCppForwardHeader),
+                             "whether to emit <name>-fwd.h forward declaration headers: "
+                             "forward_header_none or forward_header_per_document")
+        ("cpp.columns",      bpo::value<ECppColumns>(&mCppColumns),
+                             "whether to emit <Structure>Columns column-wise containers: "
+                             "columns_none or columns_per_structure")
+        ("cpp.shm_transport", bpo::value<ECppShmTransport>(&mCppShmTransport),
+                             "whether to emit shared memory client and server stubs for the interfaces, "
+                             "the server copies the string and vector arguments out of the ring: "
+                             "shm_transport_none or shm_transport_per_interface")
         ;
 }
 
@@ -76,6 +76,34 @@ public:
         include_path_based_on_package,
     } mCppIncludePath;
     
+    enum ECppAccessors
+    {
+        invalid_cpp_accessors = 0,
+        accessors_out_of_line,
+        accessors_inline,
+    } mCppAccessors;
+    
+    enum ECppForwardHeader
+    {
+        invalid_cpp_forward_header = 0,
+        forward_header_none,
+        forward_header_per_document,
+    } mCppForwardHeader;
+    
+    enum ECppColumns
+    {
+        invalid_cpp_columns = 0,
+        columns_none,
+        columns_per_structure,
+    } mCppColumns;
+    
+    enum ECppShmTransport
+    {
+        invalid_cpp_shm_transport = 0,
+        shm_transport_none,
+        shm_transport_per_interface,
+    } mCppShmTransport;
+    
     std::string corePackage;
     
     enum FlagsEnumeration
@@ -34,6 +34,8 @@
 
 #include "language/compil/all/object_factory.h"
 
+#include <boost/lexical_cast.hpp>
+
 namespace compil
 {
 
@@ -172,9 +174,18 @@ void CompilGenerator::generateStructurePrefix(const StructureSPtr& pStructure)
     if (pStructure->immutable())
         line() << "immutable ";
         
+    if (pStructure->interned())
+        line() << "interned ";
+        
     if (pStructure->partial())
         line() << "partial ";
 
+    if (pStructure->pooled())
+        line() << "pooled ";
+
+    if (pStructure->tracked())
+        line() << "tracked ";
+
     line() << "structure " << pStructure->name()->value();
     
     int indexOffset = 0;
@@ -243,6 +254,9 @@ void CompilGenerator::generateFieldPrefix(const FieldSPtr& pField)
     UnaryTemplateSPtr pTemplate = ObjectFactory::downcastUnaryTemplate(pField->type());
     if (pTemplate)
     {
+        UnaryContainerSPtr pContainer = ObjectFactory::downcastUnaryContainer(pTemplate);
+        if (pContainer && (pContainer->size() == UnaryContainer::ESize::small()))
+            table() << "small ";
         table() << pTemplate->name()->value() << "<";
         UnaryTemplateSPtr pTemplate2 = 
             ObjectFactory::downcastUnaryTemplate(pTemplate->parameterType().lock());
@@ -258,6 +272,8 @@ void CompilGenerator::generateFieldPrefix(const FieldSPtr& pField)
         {
             table() << pTemplate->parameterType().lock()->name()->value();
         }
+        if (pContainer && (pContainer->capacity() > 0))
+            table() << ", " << boost::lexical_cast<std::string>(pContainer->capacity());
         table() << ">";
     }
     else
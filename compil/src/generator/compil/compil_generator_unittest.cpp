@@ -250,6 +250,27 @@ TEST_F(CompilGeneratorTests, controlledImmutableStructure)
         "controlled immutable structure sname\n{\n}\n\n"));
 }
 
+TEST_F(CompilGeneratorTests, immutableInternedStructure)
+{
+    EXPECT_TRUE(checkGeneration(
+        "immutable interned structure sname{}", 
+        "immutable interned structure sname\n{\n}\n\n"));
+}
+
+TEST_F(CompilGeneratorTests, controlledTrackedStructure)
+{
+    EXPECT_TRUE(checkGeneration(
+        "controlled tracked structure sname{}", 
+        "controlled tracked structure sname\n{\n}\n\n"));
+}
+
+TEST_F(CompilGeneratorTests, pooledStructure)
+{
+    EXPECT_TRUE(checkGeneration(
+        "pooled structure sname{}", 
+        "pooled structure sname\n{\n}\n\n"));
+}
+
 TEST_F(CompilGeneratorTests, immutablePartialStructure)
 {
     EXPECT_TRUE(checkGeneration(
@@ -285,6 +306,21 @@ TEST_F(CompilGeneratorTests, structureFields)
         "\n"));
 }
 
+TEST_F(CompilGeneratorTests, structureContainerFields)
+{
+    EXPECT_TRUE(checkGeneration(
+        "structure sname{vector<integer> d; vector<integer, 4> f; small vector<string, 2> s; small i8;}", 
+        
+        "structure sname\n"
+        "{\n"
+        "    vector<integer>         d;\n"
+        "    vector<integer, 4>      f;\n"
+        "    small vector<string, 2> s;\n"
+        "    small                   i8;\n"
+        "}\n"
+        "\n"));
+}
+
 TEST_F(CompilGeneratorTests, structureIdentifications)
 {
     EXPECT_TRUE(checkGeneration(
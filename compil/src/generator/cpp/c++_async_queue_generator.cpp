@@ -0,0 +1,861 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/cpp/c++_async_queue_generator.h"
+
+namespace cf = cpp::frm;
+
+namespace compil
+{
+    
+const int CppAsyncQueueGenerator::declarationStream = 1;
+    
+CppAsyncQueueGenerator::CppAsyncQueueGenerator()
+{
+    for (int i = 0; i <= 1; ++i)
+    {
+        mStreams.push_back(boost::shared_ptr<std::stringstream>(new std::stringstream()));
+        mIndent.push_back(0);
+    }
+}
+
+CppAsyncQueueGenerator::~CppAsyncQueueGenerator()
+{
+}
+
+void CppAsyncQueueGenerator::generatePlatform(bool windows)
+{
+    commentInLine(declarationStream,
+                  "Exchanges the pointer atomically. It is a full memory barrier.");
+    line()  << "inline void* async_exchange(void* volatile* target, void* value)";
+    openBlock(declarationStream);
+    if (windows)
+    {
+        line()  << "return InterlockedExchangePointer(target, value);";
+    }
+    else
+    {
+        line()  << "// the builtin alone is only an acquire barrier";
+        eol(declarationStream);
+        line()  << "__sync_synchronize();";
+        eol(declarationStream);
+        line()  << "return __sync_lock_test_and_set(target, value);";
+    }
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Orders the memory accesses before and after it");
+    line()  << "inline void async_barrier()";
+    openBlock(declarationStream);
+    if (windows)
+        line()  << "MemoryBarrier();";
+    else
+        line()  << "__sync_synchronize();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    cf::VariableNameSPtr memberHandle = frm->memberVariableName(cf::variableNameRef("handle"));
+    cf::VariableNameSPtr memberRoutine = frm->memberVariableName(cf::variableNameRef("routine"));
+    cf::VariableNameSPtr memberArgument = frm->memberVariableName(cf::variableNameRef("argument"));
+    
+    commentInLine(declarationStream,
+                  "Thread that runs the routine with the argument");
+    line()  << "class async_thread";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "typedef void (*routine_type)(void*);";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void start(routine_type routine, void* argument)";
+    openBlock(declarationStream);
+    line()  << memberRoutine
+            << " = routine;";
+    eol(declarationStream);
+    line()  << memberArgument
+            << " = argument;";
+    eol(declarationStream);
+    if (windows)
+        line()  << memberHandle
+                << " = (HANDLE)_beginthreadex(0, 0, &async_thread::run, this, 0, 0);";
+    else
+        line()  << "pthread_create(&"
+                << memberHandle
+                << ", 0, &async_thread::run, this);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void join()";
+    openBlock(declarationStream);
+    if (windows)
+    {
+        line()  << "WaitForSingleObject("
+                << memberHandle
+                << ", INFINITE);";
+        eol(declarationStream);
+        line()  << "CloseHandle("
+                << memberHandle
+                << ");";
+    }
+    else
+    {
+        line()  << "pthread_join("
+                << memberHandle
+                << ", 0);";
+    }
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    if (windows)
+        line()  << "static unsigned __stdcall run(void* thread)";
+    else
+        line()  << "static void* run(void* thread)";
+    openBlock(declarationStream);
+    line()  << "async_thread* self = static_cast<async_thread*>(thread);";
+    eol(declarationStream);
+    line()  << "self->"
+            << memberRoutine
+            << "(self->"
+            << memberArgument
+            << ");";
+    eol(declarationStream);
+    line()  << "return 0;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    table() << TableAligner::row()
+            << (windows ? "HANDLE " : "pthread_t ")
+            << TableAligner::col()
+            << memberHandle
+            << ";";
+    table() << TableAligner::row()
+            << "routine_type "
+            << TableAligner::col()
+            << memberRoutine
+            << ";";
+    table() << TableAligner::row()
+            << "void* "
+            << TableAligner::col()
+            << memberArgument
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    cf::VariableNameSPtr memberMutex = frm->memberVariableName(cf::variableNameRef("mutex"));
+    cf::VariableNameSPtr memberCondition = frm->memberVariableName(cf::variableNameRef("condition"));
+    cf::VariableNameSPtr memberSignaled = frm->memberVariableName(cf::variableNameRef("signaled"));
+    
+    commentInLine(declarationStream,
+                  "Event the idle worker and the callers of the slow sends park on. A "
+                  "signal releases one wait, the signal before the wait is not lost.");
+    line()  << "class async_event";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "async_event()";
+    if (windows)
+    {
+        openBlock(declarationStream);
+        line()  << memberHandle
+                << " = CreateEvent(0, FALSE, FALSE, 0);";
+    }
+    else
+    {
+        eol(declarationStream);
+        line()  << ": " 
+                << (cf::initializationRef() << memberSignaled
+                                            << cf::parameterValueRef("false"));
+        openBlock(declarationStream, 1);
+        line()  << "pthread_mutex_init(&"
+                << memberMutex
+                << ", 0);";
+        eol(declarationStream);
+        line()  << "pthread_cond_init(&"
+                << memberCondition
+                << ", 0);";
+    }
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "~async_event()";
+    openBlock(declarationStream);
+    if (windows)
+    {
+        line()  << "CloseHandle("
+                << memberHandle
+                << ");";
+    }
+    else
+    {
+        line()  << "pthread_cond_destroy(&"
+                << memberCondition
+                << ");";
+        eol(declarationStream);
+        line()  << "pthread_mutex_destroy(&"
+                << memberMutex
+                << ");";
+    }
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void signal()";
+    openBlock(declarationStream);
+    if (windows)
+    {
+        line()  << "SetEvent("
+                << memberHandle
+                << ");";
+    }
+    else
+    {
+        line()  << "pthread_mutex_lock(&"
+                << memberMutex
+                << ");";
+        eol(declarationStream);
+        line()  << memberSignaled
+                << " = true;";
+        eol(declarationStream);
+        line()  << "pthread_cond_signal(&"
+                << memberCondition
+                << ");";
+        eol(declarationStream);
+        line()  << "pthread_mutex_unlock(&"
+                << memberMutex
+                << ");";
+    }
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void wait()";
+    openBlock(declarationStream);
+    if (windows)
+    {
+        line()  << "WaitForSingleObject("
+                << memberHandle
+                << ", INFINITE);";
+    }
+    else
+    {
+        line()  << "pthread_mutex_lock(&"
+                << memberMutex
+                << ");";
+        eol(declarationStream);
+        line()  << "while (!"
+                << memberSignaled
+                << ")";
+        eol(declarationStream);
+        line()  << "pthread_cond_wait(&"
+                << memberCondition
+                << ", &"
+                << memberMutex
+                << ");";
+        eol(declarationStream, 1);
+        line()  << memberSignaled
+                << " = false;";
+        eol(declarationStream);
+        line()  << "pthread_mutex_unlock(&"
+                << memberMutex
+                << ");";
+    }
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "async_event(const async_event&);";
+    eol(declarationStream);
+    line()  << "async_event& operator=(const async_event&);";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    if (windows)
+    {
+        table() << TableAligner::row()
+                << "HANDLE "
+                << TableAligner::col()
+                << memberHandle
+                << ";";
+    }
+    else
+    {
+        table() << TableAligner::row()
+                << "pthread_mutex_t "
+                << TableAligner::col()
+                << memberMutex
+                << ";";
+        table() << TableAligner::row()
+                << "pthread_cond_t "
+                << TableAligner::col()
+                << memberCondition
+                << ";";
+        table() << TableAligner::row()
+                << "bool "
+                << TableAligner::col()
+                << memberSignaled
+                << ";";
+    }
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+void CppAsyncQueueGenerator::generateCall()
+{
+    cf::VariableNameSPtr memberNext = frm->memberVariableName(cf::variableNameRef("next"));
+    cf::VariableNameSPtr memberWaited = frm->memberVariableName(cf::variableNameRef("waited"));
+    cf::VariableNameSPtr memberState = frm->memberVariableName(cf::variableNameRef("state"));
+    
+    commentInLine(declarationStream,
+                  "Call marshalled through an async_queue. The stubs derive from it and "
+                  "keep the arguments of the call until it is dispatched. The state of a "
+                  "sent call is 0 before the dispatch, the call itself after it, or the "
+                  "event its caller parks on.");
+    line()  << "class async_call";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "async_call()";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberNext
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberWaited
+                                        << cf::parameterValueRef("false"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberState
+                                        << cf::parameterValueRef("0"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "virtual ~async_call()";
+    openBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Invokes the call on its target. It is executed on the worker thread.");
+    line()  << "virtual void dispatch() = 0;";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "friend class async_queue;";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    table() << TableAligner::row()
+            << "async_call* volatile "
+            << TableAligner::col()
+            << memberNext
+            << ";";
+    table() << TableAligner::row()
+            << "bool "
+            << TableAligner::col()
+            << memberWaited
+            << ";";
+    table() << TableAligner::row()
+            << "void* volatile "
+            << TableAligner::col()
+            << memberState
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+void CppAsyncQueueGenerator::generateQueue()
+{
+    cf::VariableNameSPtr memberStub = frm->memberVariableName(cf::variableNameRef("stub"));
+    cf::VariableNameSPtr memberHead = frm->memberVariableName(cf::variableNameRef("head"));
+    cf::VariableNameSPtr memberTail = frm->memberVariableName(cf::variableNameRef("tail"));
+    cf::VariableNameSPtr memberStop = frm->memberVariableName(cf::variableNameRef("stop"));
+    cf::VariableNameSPtr memberCalls = frm->memberVariableName(cf::variableNameRef("calls"));
+    cf::VariableNameSPtr memberBatches = frm->memberVariableName(cf::variableNameRef("batches"));
+    cf::VariableNameSPtr memberParked = frm->memberVariableName(cf::variableNameRef("parked"));
+    cf::VariableNameSPtr memberEvent = frm->memberVariableName(cf::variableNameRef("event"));
+    cf::VariableNameSPtr memberThread = frm->memberVariableName(cf::variableNameRef("thread"));
+    
+    commentInLine(declarationStream,
+                  "Multiple producers single consumer queue of calls. The calls are "
+                  "dispatched in order on the worker thread of the queue. Posting a call "
+                  "never takes a lock, the producers only exchange the head of an "
+                  "intrusive list. The worker drains all the pending calls at once, so the "
+                  "consecutive calls are dispatched as one batch. When there are no calls "
+                  "the worker spins for a while and then parks on an event until the "
+                  "next call is posted.");
+    line()  << "class async_queue";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    commentInLine(declarationStream,
+                  "Starts the worker thread");
+    line()  << "async_queue()";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberHead
+                                        << cf::parameterValueRef("&" + memberStub->value()));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberTail
+                                        << cf::parameterValueRef("&" + memberStub->value()));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberStop
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberCalls
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberBatches
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberParked
+                                        << cf::parameterValueRef("0"));
+    openBlock(declarationStream, 1);
+    line()  << memberThread
+            << ".start(&async_queue::run, this);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Dispatches the calls that are still pending and stops the worker thread");
+    line()  << "~async_queue()";
+    openBlock(declarationStream);
+    line()  << "async_barrier();";
+    eol(declarationStream);
+    line()  << memberStop
+            << " = 1;";
+    eol(declarationStream);
+    line()  << "wake();";
+    eol(declarationStream);
+    line()  << memberThread
+            << ".join();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Posts the call without waiting for its dispatch. The queue takes the "
+                  "ownership of the call and deletes it after the dispatch. It could be "
+                  "called from any thread.");
+    line()  << "void post(async_call* call)";
+    openBlock(declarationStream);
+    line()  << "call->mNext = 0;";
+    eol(declarationStream);
+    line()  << "async_call* previous = (async_call*)async_exchange((void* volatile*)&"
+            << memberHead
+            << ", call);";
+    eol(declarationStream);
+    line()  << "previous->mNext = call;";
+    eol(declarationStream);
+    line()  << "// only a parked worker is signaled, posting takes no lock otherwise";
+    eol(declarationStream);
+    line()  << "async_barrier();";
+    eol(declarationStream);
+    line()  << "if ("
+            << memberParked
+            << ") wake();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Posts the call and waits until it is dispatched. The caller spins for "
+                  "a while and then parks on an event until the dispatch. The call stays "
+                  "owned by the caller. It should not be called from a dispatched call, "
+                  "because the worker would wait for itself.");
+    line()  << "void send(async_call* call)";
+    openBlock(declarationStream);
+    line()  << "call->mWaited = true;";
+    eol(declarationStream);
+    line()  << "post(call);";
+    eol(declarationStream);
+    line()  << "for (unsigned k = 0; k < 64; ++k)";
+    openBlock(declarationStream);
+    line()  << "if (call->mState == call)";
+    openBlock(declarationStream);
+    line()  << "async_barrier();";
+    eol(declarationStream);
+    line()  << "return;";
+    closeBlock(declarationStream);
+    line()  << "boost::detail::yield(k);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "// the worker signals the event only if it takes it from the call";
+    eol(declarationStream);
+    line()  << "async_event event;";
+    eol(declarationStream);
+    line()  << "if (!async_exchange(&call->mState, &event))";
+    eol(declarationStream);
+    line()  << "event.wait();";
+    eol(declarationStream, 1);
+    line()  << "async_barrier();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the dispatched calls");
+    line()  << "size_t calls() const";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberCalls
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the batches the calls were dispatched in");
+    line()  << "size_t batches() const";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberBatches
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "async_queue(const async_queue&);";
+    eol(declarationStream);
+    line()  << "async_queue& operator=(const async_queue&);";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Marks the end of the list when all the calls are dispatched");
+    line()  << "class stub_call : public async_call";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "virtual void dispatch()";
+    openBlock(declarationStream);
+    closeBlock(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    line()  << "static void run(void* queue)";
+    openBlock(declarationStream);
+    line()  << "async_queue* self = static_cast<async_queue*>(queue);";
+    eol(declarationStream);
+    line()  << "for (unsigned k = 0; ; ++k)";
+    openBlock(declarationStream);
+    line()  << "// the stop flag is read before the draining, so the calls posted";
+    eol(declarationStream);
+    line()  << "// before the destruction are still dispatched";
+    eol(declarationStream);
+    line()  << "bool stop = self->"
+            << memberStop
+            << " != 0;";
+    eol(declarationStream);
+    line()  << "async_barrier();";
+    eol(declarationStream);
+    line()  << "size_t count = self->process();";
+    eol(declarationStream);
+    line()  << "if (count > 0)";
+    openBlock(declarationStream);
+    line()  << "self->"
+            << memberCalls
+            << " += count;";
+    eol(declarationStream);
+    line()  << "++self->"
+            << memberBatches
+            << ";";
+    eol(declarationStream);
+    line()  << "k = 0;";
+    closeBlock(declarationStream);
+    line()  << "else if (stop)";
+    openBlock(declarationStream);
+    line()  << "break;";
+    closeBlock(declarationStream);
+    line()  << "else if (k < 64)";
+    openBlock(declarationStream);
+    line()  << "boost::detail::yield(k);";
+    closeBlock(declarationStream);
+    line()  << "else";
+    openBlock(declarationStream);
+    line()  << "self->park();";
+    eol(declarationStream);
+    line()  << "k = 0;";
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Waits until a call is posted or the queue is stopped. The flag is "
+                  "raised before the last check, so a producer either sees it or its "
+                  "call is seen by the check.");
+    line()  << "void park()";
+    openBlock(declarationStream);
+    line()  << "async_exchange(&"
+            << memberParked
+            << ", this);";
+    eol(declarationStream);
+    line()  << "if ("
+            << memberStop
+            << " || ("
+            << memberHead
+            << " != "
+            << memberTail
+            << "))";
+    openBlock(declarationStream);
+    line()  << "// a producer that took the flag is signaling, the signal is consumed";
+    eol(declarationStream);
+    line()  << "if (async_exchange(&"
+            << memberParked
+            << ", 0)) return;";
+    closeBlock(declarationStream);
+    line()  << memberEvent
+            << ".wait();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Signals the worker if it is parked. Only the thread that takes the "
+                  "flag signals it.");
+    line()  << "void wake()";
+    openBlock(declarationStream);
+    line()  << "if (async_exchange(&"
+            << memberParked
+            << ", 0))";
+    eol(declarationStream);
+    line()  << memberEvent
+            << ".signal();";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Dispatches all the calls posted so far. Returns their number.");
+    line()  << "size_t process()";
+    openBlock(declarationStream);
+    line()  << "size_t count = 0;";
+    eol(declarationStream);
+    line()  << "for (async_call* call = pop(); call; call = pop())";
+    openBlock(declarationStream);
+    line()  << "call->dispatch();";
+    eol(declarationStream);
+    line()  << "++count;";
+    eol(declarationStream);
+    line()  << "if (call->mWaited)";
+    openBlock(declarationStream);
+    line()  << "// the caller could release the call as soon as it is done";
+    eol(declarationStream);
+    line()  << "void* waiter = async_exchange(&call->mState, call);";
+    eol(declarationStream);
+    line()  << "if (waiter)";
+    eol(declarationStream);
+    line()  << "static_cast<async_event*>(waiter)->signal();";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    line()  << "else";
+    openBlock(declarationStream);
+    line()  << "delete call;";
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    line()  << "return count;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Removes the oldest call from the list. Returns null if there are no "
+                  "calls or if a producer has not linked its call yet.");
+    line()  << "async_call* pop()";
+    openBlock(declarationStream);
+    line()  << "async_call* stub = &"
+            << memberStub
+            << ";";
+    eol(declarationStream);
+    line()  << "async_call* tail = "
+            << memberTail
+            << ";";
+    eol(declarationStream);
+    line()  << "async_call* next = tail->mNext;";
+    eol(declarationStream);
+    line()  << "async_barrier();";
+    eol(declarationStream);
+    line()  << "if (tail == stub)";
+    openBlock(declarationStream);
+    line()  << "if (!next) return 0;";
+    eol(declarationStream);
+    line()  << memberTail
+            << " = next;";
+    eol(declarationStream);
+    line()  << "tail = next;";
+    eol(declarationStream);
+    line()  << "next = next->mNext;";
+    eol(declarationStream);
+    line()  << "async_barrier();";
+    closeBlock(declarationStream);
+    line()  << "if (next)";
+    openBlock(declarationStream);
+    line()  << memberTail
+            << " = next;";
+    eol(declarationStream);
+    line()  << "return tail;";
+    closeBlock(declarationStream);
+    line()  << "if (tail != "
+            << memberHead
+            << ") return 0;";
+    eol(declarationStream);
+    line()  << "// the last call is released only when the stub is behind it";
+    eol(declarationStream);
+    line()  << "post(stub);";
+    eol(declarationStream);
+    line()  << "next = tail->mNext;";
+    eol(declarationStream);
+    line()  << "async_barrier();";
+    eol(declarationStream);
+    line()  << "if (!next) return 0;";
+    eol(declarationStream);
+    line()  << memberTail
+            << " = next;";
+    eol(declarationStream);
+    line()  << "return tail;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    table() << TableAligner::row()
+            << "stub_call "
+            << TableAligner::col()
+            << memberStub
+            << ";";
+    table() << TableAligner::row()
+            << "async_call* volatile "
+            << TableAligner::col()
+            << memberHead
+            << ";";
+    table() << TableAligner::row()
+            << "async_call* "
+            << TableAligner::col()
+            << memberTail
+            << ";";
+    table() << TableAligner::row()
+            << "volatile long "
+            << TableAligner::col()
+            << memberStop
+            << ";";
+    table() << TableAligner::row()
+            << "volatile size_t "
+            << TableAligner::col()
+            << memberCalls
+            << ";";
+    table() << TableAligner::row()
+            << "volatile size_t "
+            << TableAligner::col()
+            << memberBatches
+            << ";";
+    table() << TableAligner::row()
+            << "void* volatile "
+            << TableAligner::col()
+            << memberParked
+            << ";";
+    table() << TableAligner::row()
+            << "async_event "
+            << TableAligner::col()
+            << memberEvent
+            << ";";
+    table() << TableAligner::row()
+            << "async_thread "
+            << TableAligner::col()
+            << memberThread
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+bool CppAsyncQueueGenerator::generate()
+{
+    addDependency(Dependency("boost",
+                             "smart_ptr/detail/yield_k.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Smart Pointers"));
+    addDependency(impl->stddef_dependency());
+    
+    includeHeaders(declarationStream, Dependency::global_section);
+    
+    std::string guard = frm->headerGuard("core/async_queue.hpp");
+    
+    line()  << "#ifndef " 
+            << guard;
+    eol(declarationStream);
+    line()  << "#define " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    includeHeaders(declarationStream, Dependency::private_section);
+    
+    line()  << "#if defined(_WIN32)";
+    eol(declarationStream);
+    line()  << "#include <windows.h>";
+    eol(declarationStream);
+    line()  << "#include <process.h>";
+    eol(declarationStream);
+    eol(declarationStream);
+    generatePlatform(true);
+    line()  << "#else";
+    eol(declarationStream);
+    line()  << "#include <pthread.h>";
+    eol(declarationStream);
+    eol(declarationStream);
+    generatePlatform(false);
+    line()  << "#endif";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    generateCall();
+    generateQueue();
+    
+    line()  << "#endif // " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+
+    return serializeStreams();
+}
+
+}
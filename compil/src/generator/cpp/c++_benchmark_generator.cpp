@@ -0,0 +1,575 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/cpp/c++_benchmark_generator.h"
+
+namespace compil
+{
+
+const int CppBenchmarkGenerator::mainStream = 0;
+
+CppBenchmarkGenerator::CppBenchmarkGenerator()
+{
+    for (int i = 0; i <= 0; ++i)
+    {
+        mStreams.push_back(boost::shared_ptr<std::stringstream>(new std::stringstream()));
+        mIndent.push_back(0);
+    }
+}
+
+CppBenchmarkGenerator::~CppBenchmarkGenerator()
+{
+}
+
+static bool hasInprocIdentification(const StructureSPtr& pStructure)
+{
+    const std::vector<ObjectSPtr>& objects = pStructure->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        IdentificationSPtr pIdentification = ObjectFactory::downcastIdentification(*it);
+        if (pIdentification)
+        if (pIdentification->type() == Identification::EType::inproc())
+            return true;
+    }
+    return false;
+}
+
+void CppBenchmarkGenerator::openBenchmark(const std::string& suite, const std::string& name)
+{
+    line()  << "TEST("
+            << suite
+            << "Benchmark, "
+            << name
+            << ")";
+    openBlock(mainStream);
+}
+
+void CppBenchmarkGenerator::closeBenchmark()
+{
+    closeBlock(mainStream);
+    eol(mainStream);
+}
+
+bool CppBenchmarkGenerator::isInstantiable(const StructureSPtr& structure)
+{
+    if (structure->abstract() || structure->partial())
+        return false;
+
+    // the immutable objects are created by the builder which asserts for
+    // fields without default values
+    if (structure->immutable())
+        return impl->boost_smart_ptr_needed() && structure->isInitializeAlwaysTrue();
+
+    return true;
+}
+
+void CppBenchmarkGenerator::generateEnumerationBenchmark(const EnumerationSPtr& enumeration)
+{
+    const std::string& name = enumeration->name()->value();
+    cpp::frm::TypeSPtr type = impl->cppType(enumeration);
+    std::string names = "names" + name;
+    std::string linearFromString = "linearFromString" + name;
+
+    std::vector<EnumerationValueSPtr> enumerationValues;
+    if (enumeration->flags())
+        enumerationValues.push_back(Document::nilEnumerationValue(enumeration));
+    else
+        enumerationValues.push_back(Document::invalidEnumerationValue(enumeration));
+    enumerationValues.insert(enumerationValues.end(),
+                             enumeration->enumerationValues().begin(),
+                             enumeration->enumerationValues().end());
+    if (enumeration->flags())
+        enumerationValues.push_back(Document::allEnumerationValue(enumeration));
+
+    std::vector<EnumerationValueSPtr>::const_iterator it;
+
+    line()  << "static const char* "
+            << names
+            << "[] =";
+    openBlock(mainStream);
+    for (it = enumerationValues.begin(); it != enumerationValues.end(); ++it)
+    {
+        line()  << "\""
+                << (*it)->name()->value()
+                << "\",";
+        eol(mainStream);
+    }
+    closeBlock(mainStream, "};");
+    eol(mainStream);
+
+    // the naive lookup that fromString is compared against
+    line()  << "static "
+            << type
+            << " "
+            << linearFromString
+            << "(const char* name)";
+    openBlock(mainStream);
+    for (it = enumerationValues.begin(); it != enumerationValues.end(); ++it)
+    {
+        line()  << "if (strcmp(name, \""
+                << (*it)->name()->value()
+                << "\") == 0) return "
+                << type
+                << "::"
+                << frm->methodName((*it)->name()->value())
+                << "();";
+        eol(mainStream);
+    }
+    line()  << "return "
+            << type
+            << "();";
+    closeBlock(mainStream);
+    eol(mainStream);
+
+    std::vector<std::string> benchmarks;
+    benchmarks.push_back("fromString");
+    benchmarks.push_back("linearFromString");
+
+    std::vector<std::string>::const_iterator bit;
+    for (bit = benchmarks.begin(); bit != benchmarks.end(); ++bit)
+    {
+        const std::string& benchmark = *bit;
+        openBenchmark(name, benchmark);
+        line()  << "size_t count = sizeof("
+                << names
+                << ") / sizeof(const char*);";
+        eol(mainStream);
+        line()  << "size_t index = 0;";
+        eol(mainStream);
+        line()  << "plt::Benchmark benchmark(\""
+                << mDocument->name()->value()
+                << "."
+                << name
+                << "."
+                << benchmark
+                << "\");";
+        eol(mainStream);
+        line()  << "while (benchmark.running())";
+        openBlock(mainStream);
+        line()  << "const char* name = "
+                << names
+                << "[index++ % count];";
+        eol(mainStream);
+        line()  << "size_t size = strlen(name);";
+        eol(mainStream);
+        if (benchmark == "fromString")
+        {
+            line()  << "benchmark.consume("
+                    << type
+                    << "::"
+                    << fnFromString->value()
+                    << "(name, size));";
+        }
+        else
+        {
+            line()  << "benchmark.consume(size);";
+            eol(mainStream);
+            line()  << "benchmark.consume("
+                    << linearFromString
+                    << "(name));";
+        }
+        closeBlock(mainStream);
+        closeBenchmark();
+    }
+}
+
+void CppBenchmarkGenerator::generateStructureBenchmark(const StructureSPtr& structure)
+{
+    if (!isInstantiable(structure))
+        return;
+
+    const std::string& name = structure->name()->value();
+    std::string deref = structure->immutable() ? "*" : "";
+
+    openBenchmark(name, "construction");
+    line()  << "plt::Benchmark benchmark(\""
+            << mDocument->name()->value()
+            << "."
+            << name
+            << ".construction\");";
+    eol(mainStream);
+    line()  << "while (benchmark.running())";
+    openBlock(mainStream);
+    if (structure->immutable())
+    {
+        line()  << frm->cppMainClassType(structure)
+                << "::Builder builder;";
+        eol(mainStream);
+        line()  << impl->cppPtrType(structure)
+                << " structure = builder.finalize();";
+        eol(mainStream);
+    }
+    else
+    {
+        line()  << frm->cppMainClassType(structure)
+                << " structure;";
+        eol(mainStream);
+    }
+    line()  << "benchmark.consume(structure);";
+    closeBlock(mainStream);
+    closeBenchmark();
+
+    std::vector<std::string> instances;
+    instances.push_back("structure1");
+    instances.push_back("structure2");
+
+    bool equalTo = structure->hasOperator(EOperatorAction::equalTo(), EOperatorFlags::native());
+    bool lessThan = structure->hasOperator(EOperatorAction::lessThan(), EOperatorFlags::native());
+
+    std::vector<std::string> benchmarks;
+    benchmarks.push_back("copy");
+    if (equalTo)
+        benchmarks.push_back("operatorEqualTo");
+    if (lessThan)
+        benchmarks.push_back("operatorLessThan");
+
+    for (std::vector<std::string>::iterator it = benchmarks.begin(); it != benchmarks.end(); ++it)
+    {
+        const std::string& benchmark = *it;
+        openBenchmark(name, benchmark);
+
+        for (std::vector<std::string>::iterator iit = instances.begin(); iit != instances.end(); ++iit)
+        {
+            if ((benchmark == "copy") && (*iit != "structure1"))
+                continue;
+
+            if (structure->immutable())
+            {
+                line()  << impl->cppPtrType(structure)
+                        << " "
+                        << *iit
+                        << " = "
+                        << frm->cppMainClassType(structure)
+                        << "::Builder().finalize();";
+            }
+            else
+            {
+                line()  << frm->cppMainClassType(structure)
+                        << " "
+                        << *iit
+                        << ";";
+            }
+            eol(mainStream);
+        }
+
+        line()  << "plt::Benchmark benchmark(\""
+                << mDocument->name()->value()
+                << "."
+                << name
+                << "."
+                << benchmark
+                << "\");";
+        eol(mainStream);
+        line()  << "while (benchmark.running())";
+        openBlock(mainStream);
+        if (benchmark == "copy")
+        {
+            if (structure->immutable())
+            {
+                line()  << impl->cppPtrType(structure)
+                        << " structure2 = "
+                        << frm->cppMainClassType(structure)
+                        << "::Builder(*structure1).finalize();";
+            }
+            else
+            {
+                line()  << frm->cppMainClassType(structure)
+                        << " structure2(structure1);";
+            }
+            eol(mainStream);
+            line()  << "benchmark.consume(structure2);";
+        }
+        else
+        {
+            line()  << "bool result = "
+                    << deref
+                    << "structure1 "
+                    << (benchmark == "operatorEqualTo" ? "==" : "<")
+                    << " "
+                    << deref
+                    << "structure2;";
+            eol(mainStream);
+            line()  << "benchmark.consume(result);";
+        }
+        closeBlock(mainStream);
+        closeBenchmark();
+    }
+
+    generateStructureFieldsBenchmark(structure);
+}
+
+void CppBenchmarkGenerator::generateStructureFieldsBenchmark(const StructureSPtr& structure)
+{
+    // the getters of the controlled structures assert the fields are
+    // available, so only the ones with default values are accessed
+    std::vector<FieldSPtr> fields;
+    const std::vector<ObjectSPtr>& objects = structure->objects();
+    for (std::vector<ObjectSPtr>::const_iterator it = objects.begin(); it != objects.end(); ++it)
+    {
+        FieldSPtr field = ObjectFactory::downcastField(*it);
+        if (!field) continue;
+        if (structure->controlled())
+        if (!field->defaultValue() || field->defaultValue()->optional())
+            continue;
+        fields.push_back(field);
+    }
+
+    if (fields.empty())
+        return;
+
+    const std::string& name = structure->name()->value();
+    std::string access = structure->immutable() ? "->" : ".";
+
+    std::vector<std::string> benchmarks;
+    benchmarks.push_back("fieldAccess");
+    if (!structure->immutable())
+        benchmarks.push_back("fieldUpdate");
+
+    for (std::vector<std::string>::iterator it = benchmarks.begin(); it != benchmarks.end(); ++it)
+    {
+        const std::string& benchmark = *it;
+        openBenchmark(name, benchmark);
+        if (structure->immutable())
+        {
+            line()  << impl->cppPtrType(structure)
+                    << " structure = "
+                    << frm->cppMainClassType(structure)
+                    << "::Builder().finalize();";
+        }
+        else
+        {
+            line()  << frm->cppMainClassType(structure)
+                    << " structure;";
+        }
+        eol(mainStream);
+
+        line()  << "plt::Benchmark benchmark(\""
+                << mDocument->name()->value()
+                << "."
+                << name
+                << "."
+                << benchmark
+                << "\");";
+        eol(mainStream);
+        line()  << "while (benchmark.running())";
+        openBlock(mainStream);
+        for (std::vector<FieldSPtr>::iterator fit = fields.begin(); fit != fields.end(); ++fit)
+        {
+            if (benchmark == "fieldAccess")
+            {
+                line()  << "benchmark.consume(structure"
+                        << access
+                        << frm->getMethodName(*fit)
+                        << "());";
+            }
+            else
+            {
+                if (structure->isOverriden(*fit))
+                    continue;
+                line()  << "structure."
+                        << frm->setMethodName(*fit)
+                        << "(structure."
+                        << frm->getMethodName(*fit)
+                        << "());";
+            }
+            eol(mainStream);
+        }
+        if (benchmark == "fieldUpdate")
+            line()  << "benchmark.consume(structure);";
+        closeBlock(mainStream);
+        closeBenchmark();
+    }
+}
+
+void CppBenchmarkGenerator::generateHierarchyFactoryBenchmark(const FactorySPtr& factory)
+{
+    if (!impl->boost_smart_ptr_needed())
+        return;
+
+    TypeSPtr pParameterType = factory->parameterType().lock();
+    StructureSPtr pParameterStructure = ObjectFactory::downcastStructure(pParameterType);
+    std::vector<StructureSPtr> structs = impl->hierarchie(mDocument,
+                                                          pParameterStructure,
+                                                          &Structure::hasRuntimeIdentification);
+
+    std::vector<StructureSPtr>::const_iterator it;
+    for (it = structs.begin(); it != structs.end(); ++it)
+    {
+        StructureSPtr pStructure = *it;
+        if (!isInstantiable(pStructure) || pStructure->immutable())
+            continue;
+
+        const std::string& name = factory->name()->value();
+        openBenchmark(name, "clone" + pStructure->name()->value());
+        line()  << impl->cppPtrType(pParameterType)
+                << " object(new "
+                << frm->cppMainClassType(pStructure)
+                << "());";
+        eol(mainStream);
+        line()  << "plt::Benchmark benchmark(\""
+                << mDocument->name()->value()
+                << "."
+                << name
+                << ".clone"
+                << pStructure->name()->value()
+                << "\");";
+        eol(mainStream);
+        line()  << "while (benchmark.running())";
+        openBlock(mainStream);
+        line()  << impl->cppPtrType(pParameterType)
+                << " clone = "
+                << frm->cppClassType(factory)
+                << "::clone(object);";
+        eol(mainStream);
+        line()  << "benchmark.consume(clone);";
+        closeBlock(mainStream);
+        closeBenchmark();
+    }
+}
+
+void CppBenchmarkGenerator::generatePluginFactoryBenchmark(const FactorySPtr& factory)
+{
+    StructureSPtr pParameterStructure = Structure::downcast(factory->parameterType().lock());
+    std::vector<StructureSPtr> structs = impl->hierarchie(mDocument,
+                                                          pParameterStructure,
+                                                          &hasInprocIdentification);
+
+    std::vector<StructureSPtr>::const_iterator it;
+    for (it = structs.begin(); it != structs.end(); ++it)
+    {
+        StructureSPtr pStructure = *it;
+        if (!isInstantiable(pStructure) || pStructure->immutable())
+            continue;
+
+        const std::string& name = factory->name()->value();
+        openBenchmark(name, "clone" + pStructure->name()->value());
+        line()  << frm->cppMainClassType(pStructure)
+                << " object;";
+        eol(mainStream);
+        line()  << "plt::Benchmark benchmark(\""
+                << mDocument->name()->value()
+                << "."
+                << name
+                << ".clone"
+                << pStructure->name()->value()
+                << "\");";
+        eol(mainStream);
+        line()  << "while (benchmark.running())";
+        openBlock(mainStream);
+        line()  << frm->cppRawPtrName(pParameterStructure)
+                << " clone = "
+                << frm->cppClassType(factory)
+                << "::clone<"
+                << frm->cppMainClassType(pParameterStructure)
+                << ">(object);";
+        eol(mainStream);
+        line()  << "benchmark.consume(clone);";
+        eol(mainStream);
+        line()  << "delete clone;";
+        closeBlock(mainStream);
+        closeBenchmark();
+    }
+}
+
+void CppBenchmarkGenerator::generateObjectBenchmark(const ObjectSPtr& object)
+{
+    switch (object->runtimeObjectId().value())
+    {
+        case EObjectId::kEnumeration:
+        {
+            EnumerationSPtr enumeration = boost::static_pointer_cast<Enumeration>(object);
+            generateEnumerationBenchmark(enumeration);
+            break;
+        }
+        case EObjectId::kStructure:
+        {
+            StructureSPtr structure = boost::static_pointer_cast<Structure>(object);
+            generateStructureBenchmark(structure);
+            break;
+        }
+        case EObjectId::kFactory:
+        {
+            FactorySPtr factory = boost::static_pointer_cast<Factory>(object);
+            if (factory->type() == Factory::EType::hierarchy())
+                generateHierarchyFactoryBenchmark(factory);
+            else
+            if (factory->type() == Factory::EType::plugin())
+                generatePluginFactoryBenchmark(factory);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+bool CppBenchmarkGenerator::generate()
+{
+    addDependency(impl->cppHeaderFileDependency(mDocument->name()->value(),
+                                                mDocument->package()));
+                                                
+    addDependency(Dependency("gtest",
+                             "gtest.h",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Google Test framework"));
+
+    addDependency(impl->cstring_dependency());
+
+    addDependency(Dependency("core/platform",
+                             "benchmark.h",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Compil C++ core"));
+                             
+    includeHeaders(mainStream, Dependency::private_section);
+    
+    openNamespace(mainStream);
+    
+    const std::vector<ObjectSPtr>& objects = mDocument->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        if ((*it)->sourceId() != mDocument->mainFile()->sourceId())
+            continue;
+
+        generateObjectBenchmark(*it);
+    }
+
+    closeNamespace(mainStream);
+
+    return serializeStreams();
+}
+
+}
@@ -0,0 +1,103 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/cpp/c++_fwd_generator.h"
+
+namespace compil
+{
+
+CppForwardHeaderGenerator::CppForwardHeaderGenerator()
+{
+}
+
+CppForwardHeaderGenerator::~CppForwardHeaderGenerator()
+{
+}
+
+bool CppForwardHeaderGenerator::generate()
+{
+    std::vector<CommentSPtr> vComments = mDocument->mainFile()->comments();
+    std::vector<CommentSPtr>::iterator cit;
+    for (cit = vComments.begin(); cit != vComments.end(); ++cit)
+    {
+        commentInLine(copyrightStream, *cit);
+        eol(copyrightStream);
+    }
+
+    openNamespace(forwardDeclarationStream);
+
+    commentInLine(forwardDeclarationStream, "Forward declarations");
+
+    const std::vector<ObjectSPtr>& objects = mDocument->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        if ((*it)->sourceId() != mDocument->mainFile()->sourceId())
+            continue;
+
+        generateObjectDeclaration(*it);
+    }
+
+    closeNamespace(forwardDeclarationStream);
+
+    // only the forward declarations are kept. They need nothing but the
+    // pointer types
+    mStreams[declarationStream]->str("");
+    mStreams[inlineDefinitionStream]->str("");
+    dependencies.clear();
+    addDependencies(impl->classPointerDependencies());
+
+    std::string guard = frm->headerGuard(mDocument->mainFile(), mType);
+
+    // unlike the other headers everything is inside the guard, the
+    // forward header is included many times and has to stay cheap
+    line()  << "#ifndef "
+            << guard;
+    eol(includeStream);
+    line()  << "#define "
+            << guard;
+    eol(includeStream);
+    eol(includeStream);
+
+    includeHeaders(includeStream, Dependency::global_section);
+    includeHeaders(includeStream, Dependency::private_section);
+
+    line()  << "#endif // "
+            << guard;
+    eol(forwardDeclarationStream);
+    eol(forwardDeclarationStream);
+
+    return serializeStreams();
+}
+
+}
+
@@ -0,0 +1,71 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+
+#ifndef _CPP_FORWARD_HEADER_GENERATOR_H__
+#define _CPP_FORWARD_HEADER_GENERATOR_H__
+
+#include "generator/cpp/c++_h_generator.h"
+
+#include <boost/shared_ptr.hpp>
+
+namespace compil
+{
+
+// Generates <name>-fwd.h with the forward declarations and the pointer
+// typedefs of the document. The headers that only refer to the document
+// types by pointer include it instead of the full header
+class CppForwardHeaderGenerator : public CppHeaderGenerator
+{
+public:
+    CppForwardHeaderGenerator();
+    virtual ~CppForwardHeaderGenerator();
+    
+    virtual bool generate();
+};
+
+typedef boost::shared_ptr<CppForwardHeaderGenerator> CppForwardHeaderGeneratorPtr;
+
+}
+
+#else
+
+namespace compil
+{
+
+class CppForwardHeaderGenerator;
+typedef boost::shared_ptr<CppForwardHeaderGenerator> CppForwardHeaderGeneratorPtr;
+
+}
+
+#endif
+
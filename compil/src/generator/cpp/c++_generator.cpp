@@ -34,11 +34,16 @@
 
 #include "library/compil/package.h"
 
+#include "generator/implementer/perfect_hash.h"
+
 #include "language/compil/all/object_factory.h"
 
 #include "boost/lexical_cast.hpp"
 #include "boost/algorithm/string.hpp"
 
+#include <iomanip>
+#include <sstream>
+
 namespace cf = cpp::frm;
 
 namespace compil
@@ -53,6 +58,7 @@ const int CppGenerator::cache1Stream = 3;
 const int CppGenerator::cache2Stream = 4;
 
 CppGenerator::CppGenerator()
+    : mInlineAccessorsOnly(false)
 {
     for (int i = 0; i <= 4; ++i)
     {
@@ -65,6 +71,19 @@ CppGenerator::~CppGenerator()
 {
 }
 
+bool CppGenerator::isAccessorGenerated(const StructureSPtr& pStructure)
+{
+    return impl->inlineAccessors(pStructure) == mInlineAccessorsOnly;
+}
+
+cf::MethodSPtr CppGenerator::accessorRef()
+{
+    cf::MethodSPtr method = cf::methodRef();
+    if (mInlineAccessorsOnly)
+        method << cf::EMethodSpecifier::inline_();
+    return method;
+}
+
 void CppGenerator::generateEnumerationValueDefinition(const EnumerationValueSPtr& pEnumerationValue)
 {
     EnumerationSPtr pEnumeration = pEnumerationValue->enumeration().lock();
@@ -94,6 +113,184 @@ void CppGenerator::generateEnumerationValueDefinition(const EnumerationValueSPtr
     eol(definitionStream);
 }
 
+static std::string hexLiteral(unsigned long value)
+{
+    std::ostringstream literal;
+    literal << "0x" << std::hex << value << "UL";
+    return literal.str();
+}
+
+void CppGenerator::generateEnumerationFromStringDefinition(const EnumerationSPtr& pEnumeration)
+{
+    TypeSPtr pParameterType = pEnumeration->parameterType().lock();
+    cf::TypeSPtr outerType = impl->cppType(pEnumeration);
+
+    addDependency(impl->cstring_dependency());
+
+    std::vector<EnumerationValueSPtr> enumerationValues;
+    if (pEnumeration->flags())
+        enumerationValues.push_back(Document::nilEnumerationValue(pEnumeration));
+    else
+        enumerationValues.push_back(Document::invalidEnumerationValue(pEnumeration));
+    enumerationValues.insert(enumerationValues.end(),
+                             pEnumeration->enumerationValues().begin(),
+                             pEnumeration->enumerationValues().end());
+    if (pEnumeration->flags())
+        enumerationValues.push_back(Document::allEnumerationValue(pEnumeration));
+
+    std::vector<std::string> names;
+    std::vector<EnumerationValueSPtr>::const_iterator it;
+    for (it = enumerationValues.begin(); it != enumerationValues.end(); ++it)
+        names.push_back((*it)->name()->value());
+
+    // the names are stored in the order of the hash slots. If the hash could
+    // not be built they are stored in the declaration order and searched
+    // linearly.
+    PerfectHash hash;
+    bool perfect = hash.build(names);
+    std::vector<size_t> order;
+    for (size_t i = 0; i < names.size(); ++i)
+        order.push_back(perfect ? hash.slots()[i] : i);
+
+    std::string count = boost::lexical_cast<std::string>(names.size());
+
+    fdef()  << (cf::methodRef() << outerType
+                                << frm->cppEnumNamespace(pEnumeration)
+                                << fnFromString
+                                << (cf::argumentRef() << const_char_ptr
+                                                      << name)
+                                << (cf::argumentRef() << st
+                                                      << size));
+    openBlock(definitionStream);
+
+    if (perfect)
+    {
+        line()  << "static const unsigned long displacements[] =";
+        openBlock(definitionStream);
+        const std::vector<unsigned long>& displacements = hash.displacements();
+        for (size_t i = 0; i < displacements.size(); ++i)
+        {
+            line()  << boost::lexical_cast<std::string>(displacements[i])
+                    << ",";
+            if ((i % 16 == 15) || (i + 1 == displacements.size()))
+                eol(definitionStream);
+            else
+                line()  << " ";
+        }
+        closeBlock(definitionStream, "};");
+    }
+
+    line()  << "static const char* names[] =";
+    openBlock(definitionStream);
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        line()  << "\""
+                << names[order[i]]
+                << "\",";
+        eol(definitionStream);
+    }
+    closeBlock(definitionStream, "};");
+
+    // the lengths are compared first, so the names are never read past
+    // their end, even when the argument has a zero inside
+    line()  << "static const size_t lengths[] =";
+    openBlock(definitionStream);
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        line()  << boost::lexical_cast<std::string>(names[order[i]].size())
+                << ",";
+        if ((i % 16 == 15) || (i + 1 == order.size()))
+            eol(definitionStream);
+        else
+            line()  << " ";
+    }
+    closeBlock(definitionStream, "};");
+
+    line()  << "static const "
+            << impl->cppType(pParameterType)
+            << " values[] =";
+    openBlock(definitionStream);
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        line()  << frm->enumValueName(enumerationValues[order[i]])
+                << ",";
+        eol(definitionStream);
+    }
+    closeBlock(definitionStream, "};");
+    eol(definitionStream);
+
+    if (perfect)
+    {
+        line()  << "unsigned long hash = "
+                << boost::lexical_cast<std::string>(PerfectHash::offsetBasis)
+                << "UL;";
+        eol(definitionStream);
+        line()  << "for (size_t i = 0; i < size; ++i)";
+        eol(definitionStream);
+        line()  << "hash = ((hash ^ (unsigned char)name[i]) * "
+                << boost::lexical_cast<std::string>(PerfectHash::prime)
+                << "UL) & "
+                << hexLiteral(PerfectHash::mask)
+                << ";";
+        eol(definitionStream, 1);
+        eol(definitionStream);
+
+        line()  << "unsigned long slot = (hash ^ displacements[hash % "
+                << boost::lexical_cast<std::string>(hash.buckets())
+                << "]) & "
+                << hexLiteral(PerfectHash::mask)
+                << ";";
+        eol(definitionStream);
+        line()  << "slot ^= slot >> 16;";
+        eol(definitionStream);
+        line()  << "slot = (slot * "
+                << hexLiteral(PerfectHash::mixer)
+                << ") & "
+                << hexLiteral(PerfectHash::mask)
+                << ";";
+        eol(definitionStream);
+        line()  << "slot ^= slot >> 16;";
+        eol(definitionStream);
+        line()  << "slot %= "
+                << count
+                << ";";
+        eol(definitionStream);
+        eol(definitionStream);
+
+        line()  << "if ((lengths[slot] != size) || (memcmp(names[slot], name, size) != 0))";
+        eol(definitionStream);
+        line()  << "return "
+                << outerType
+                << "();";
+        eol(definitionStream, 1);
+        line()  << "return "
+                << outerType
+                << "(values[slot]);";
+        eol(definitionStream);
+    }
+    else
+    {
+        line()  << "for (size_t slot = 0; slot < "
+                << count
+                << "; ++slot)";
+        openBlock(definitionStream);
+        line()  << "if ((lengths[slot] == size) && (memcmp(names[slot], name, size) == 0))";
+        eol(definitionStream);
+        line()  << "return "
+                << outerType
+                << "(values[slot]);";
+        eol(definitionStream, 1);
+        closeBlock(definitionStream);
+        line()  << "return "
+                << outerType
+                << "();";
+        eol(definitionStream);
+    }
+
+    closeBlock(definitionStream);
+    eol(definitionStream);
+}
+
 void CppGenerator::generateEnumerationDefinition(const EnumerationSPtr& pEnumeration)
 {
     TypeSPtr pParameterType = pEnumeration->parameterType().lock();
@@ -262,6 +459,8 @@ void CppGenerator::generateEnumerationDefinition(const EnumerationSPtr& pEnumera
     closeBlock(definitionStream);
     eol(definitionStream);
 
+    generateEnumerationFromStringDefinition(pEnumeration);
+
     if (pEnumeration->cast() == CastableType::ECast::strong())
     {
         fdef()  << (cf::methodRef() << bl
@@ -501,6 +700,86 @@ void CppGenerator::generateSpecimenDefinition(const SpecimenSPtr& pSpecimen)
     eol(definitionStream);
 }
 
+void CppGenerator::generateHierarchyFactoryCloneAllDefinition(const FactorySPtr& pFactory,
+                                                              const EnumerationSPtr& pEnumeration,
+                                                              const std::vector<StructureSPtr>& structs)
+{
+    TypeSPtr pParameterType = pFactory->parameterType().lock();
+    StructureSPtr pParameterStructure = ObjectFactory::downcastStructure(pParameterType);
+
+    addDependency(impl->objectSlabDependency());
+
+    line()  << "std::vector<"
+            << impl->cppPtrType(pParameterType)
+            << "> "
+            << frm->cppClassNamespace(pFactory)
+            << "::"
+            << fnCloneAll
+            << "(const std::vector<"
+            << impl->cppPtrType(pParameterType)
+            << ">& "
+            << objects
+            << ")";
+    openBlock(definitionStream);
+
+    line()  << "// the null objects get the invalid identifier and stay null";
+    eol(definitionStream);
+    line()  << "std::vector<long> ids("
+            << objects
+            << ".size(), 0);";
+    eol(definitionStream);
+    line()  << "for (size_t i = 0; i < "
+            << objects
+            << ".size(); ++i)";
+    openBlock(definitionStream);
+    line()  << "if ("
+            << objects
+            << "[i])";
+    eol(definitionStream);
+    line()  << "ids[i] = "
+            << objects
+            << "[i]->"
+            << impl->runtimeIdentificationMethodName(pParameterStructure)
+            << "().value();";
+    eol(definitionStream, 1);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    line()  << "std::vector<"
+            << impl->cppPtrType(pParameterType)
+            << "> result;";
+    eol(definitionStream);
+    line()  << "slab_cloner<"
+            << frm->cppMainClassType(pParameterStructure)
+            << "> cloner("
+            << objects
+            << ", ids, "
+            << boost::lexical_cast<std::string>(structs.size() + 1)
+            << ", result);";
+    eol(definitionStream);
+
+    std::vector<StructureSPtr>::const_iterator it;
+    for (it = structs.begin(); it != structs.end(); ++it)
+    {
+        StructureSPtr pStructure = *it;
+        if (pStructure->abstract()) continue;
+
+        line()  << "cloner.clone<"
+                << frm->cppMainClassType(pStructure)
+                << ">("
+                << frm->cppEnumNamespace(pEnumeration)
+                << "::"
+                << frm->enumValueName(pStructure->name()->value())
+                << ");";
+        eol(definitionStream);
+    }
+    line()  << "return result;";
+    eol(definitionStream);
+
+    closeBlock(definitionStream);
+    eol(definitionStream);
+}
+
 void CppGenerator::generateHierarchyFactoryDefinition(const FactorySPtr& pFactory)
 {
     TypeSPtr pParameterType = pFactory->parameterType().lock();
@@ -611,6 +890,9 @@ void CppGenerator::generateHierarchyFactoryDefinition(const FactorySPtr& pFactor
     closeBlock(definitionStream);
     eol(definitionStream);
 
+    if (impl->slabClone(structs))
+        generateHierarchyFactoryCloneAllDefinition(pFactory, pEnumeration, structs);
+
     for (it = structs.begin(); it != structs.end(); ++it)
     {
         StructureSPtr pStructure = *it;
@@ -945,263 +1227,792 @@ void CppGenerator::generateIdentifierDefinition(const IdentifierSPtr& pIdentifie
     }
 }
 
-void CppGenerator::generateInitialization(const cpp::frm::InitializationSPtr& initialization)
+void CppGenerator::generateInterfaceStubDefinition(const MethodSPtr& pMethod)
 {
-    if (table().isEmpty())
-    {
-        table() << TableAligner::row()
-                << ": ";
-    }
-    else
+    InterfaceSPtr pInterface = pMethod->interface_().lock();
+    cf::TypeSPtr targetType = impl->boost_smart_ptr_needed()
+                            ? cf::typeRef() << cf::typeNameRef(frm->cppSharedPtrName(frm->cppInterfaceClassType(pInterface)->name()->value()))
+                            : cf::typeRef() << cf::typeNameRef(frm->cppRawPtrName(frm->cppInterfaceClassType(pInterface)->name()->value()));
+
+    std::vector<ParameterSPtr> parameters;
+    const std::vector<ObjectSPtr>& objects = pMethod->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
     {
-        table() << TableAligner::row()
-                << ", ";
+        ParameterSPtr pParameter = ObjectFactory::downcastParameter(*it);
+        if (pParameter)
+            parameters.push_back(pParameter);
     }
-    table() << initialization;
-}
+    std::vector<ParameterSPtr>::const_iterator pit;
 
-void CppGenerator::generateStructureFieldMemberInitialization(const FieldSPtr& pField)
-{
-    if (impl->needConstructorInitialization(pField))
+    // the stub keeps the arguments of a single call until the worker
+    // dispatches it to the target
+    line()  << "class "
+            << frm->cppStubClassType(pMethod)
+            << " : public async_call";
+    openBlock(definitionStream);
+    line()  << "public:";
+    eol(definitionStream, -1);
+
+    cf::ConstructorSPtr constructor = cf::constructorRef() << frm->cppStubConstructorName(pMethod)
+                                                           << (cf::argumentRef() << frm->constTypeRef(targetType)
+                                                                                 << target);
+    for (pit = parameters.begin(); pit != parameters.end(); ++pit)
     {
-        generateInitialization(
-            cf::initializationRef() << frm->memberVariableName(frm->cppVariableName(pField))
-                                    << cf::parameterValueRef(frm->defaultMethodName(pField)->value() + "()"));
+        const ParameterSPtr& pParameter = *pit;
+        if (pParameter->direction() == Parameter::EDirection::in())
+            constructor << (cf::argumentRef() << impl->cppParameterDecoratedType(pParameter)
+                                              << frm->cppVariableName(pParameter));
+        else
+            constructor << (cf::argumentRef() << impl->cppStubMemberType(pParameter)
+                                              << frm->cppVariableName(pParameter));
     }
-}
+    fdef()  << constructor;
+    generateInitialization(
+        cf::initializationRef() << frm->memberVariableName(target)
+                                << frm->parameterValue(target));
+    for (pit = parameters.begin(); pit != parameters.end(); ++pit)
+        generateInitialization(
+            cf::initializationRef() << frm->cppMemberVariableName(*pit)
+                                    << frm->parameterValue(frm->cppVariableName(*pit)));
+    eofd(definitionStream);
+    openBlock(definitionStream, 2);
+    closeBlock(definitionStream);
+    eol(definitionStream);
 
-void CppGenerator::generateStructureObjectMemberInitialization(const ObjectSPtr& pObject)
-{
-    switch (pObject->runtimeObjectId().value())
+    line()  << "virtual void "
+            << fnDispatch->value()
+            << "()";
+    openBlock(definitionStream);
+    line()  << frm->memberVariableName(target)
+            << "->"
+            << frm->cppMethodName(pMethod)->value()
+            << "(";
+    for (pit = parameters.begin(); pit != parameters.end(); ++pit)
     {
-        case EObjectId::kField:
-        {
-            FieldSPtr pField = boost::static_pointer_cast<Field>(pObject);
-            generateStructureFieldMemberInitialization(pField);
-            break;
-        }
-        case EObjectId::kIdentification:
-        case EObjectId::kUpcopy:
-        case EObjectId::kOperator:
-        case EObjectId::kEnumeration:
-        case EObjectId::kAlter:
-        case EObjectId::kFieldOverride:
-            break;
-        default:
-            assert(false);
+        if (pit != parameters.begin())
+            line()  << ", ";
+        if ((*pit)->direction() != Parameter::EDirection::in())
+            line()  << "*";
+        line()  << frm->cppMemberVariableName(*pit);
     }
-}
+    line()  << ");";
+    closeBlock(definitionStream);
+    eol(definitionStream);
 
-void CppGenerator::generateStructureFieldWritingDefinition(const StructureSPtr& pStructure, const FieldSPtr& pField)
-{
-    StructureSPtr pBelongStructure = pField->structure().lock();
-    assert(pBelongStructure);
+    line()  << "private:";
+    eol(definitionStream, -1);
+    table() << TableAligner::row()
+            << targetType
+            << " "
+            << TableAligner::col()
+            << frm->memberVariableName(target)
+            << ";";
+    for (pit = parameters.begin(); pit != parameters.end(); ++pit)
+        table() << TableAligner::row()
+                << impl->cppStubMemberType(*pit)
+                << " "
+                << TableAligner::col()
+                << frm->cppMemberVariableName(*pit)
+                << ";";
+    eot(definitionStream);
 
-    cf::NamespaceSPtr classNamesp = frm->cppAutoClassNamespace(pStructure);
-    cf::NamespaceSPtr namesp = boost::make_shared<cf::Namespace>(*classNamesp);
+    closeBlock(definitionStream, "};");
+    eol(definitionStream);
+}
 
-    cf::NamespaceSPtr belongClassBuilderNamesp = frm->cppAutoClassNamespace(pBelongStructure);
-    *belongClassBuilderNamesp << nsBuilder;
+void CppGenerator::generateInterfaceDefinition(const InterfaceSPtr& pInterface)
+{
+    addDependency(impl->asyncQueueDependency());
 
-    std::string accessObject;
-    cf::TypeSPtr resultType = frm->typeRef(impl->cppType(pStructure));
+    cf::TypeSPtr targetType = impl->boost_smart_ptr_needed()
+                            ? cf::typeRef() << cf::typeNameRef(frm->cppSharedPtrName(frm->cppInterfaceClassType(pInterface)->name()->value()))
+                            : cf::typeRef() << cf::typeNameRef(frm->cppRawPtrName(frm->cppInterfaceClassType(pInterface)->name()->value()));
+    cf::NamespaceSPtr proxyNamespace = frm->cppProxyClassNamespace(pInterface);
 
-    std::string returnThis;
-    if (!pStructure->immutable() && pStructure->partial())
-        returnThis = "return *(" + frm->cppClassType(pStructure)->name()->value() + "*)this;";
-    else
-        returnThis = "return *this;";
+    fdef()  << (cf::destructorRef() << frm->cppInterfaceClassNamespace(pInterface)
+                                    << frm->cppInterfaceDestructorName(pInterface));
+    openBlock(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
 
-    if (pStructure->immutable())
+    std::vector<MethodSPtr> methods;
+    const std::vector<ObjectSPtr>& objects = pInterface->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
     {
-        *namesp << nsBuilder;
-        if (pBelongStructure->baseStructure().lock())
-            accessObject = "((" + frm->cppAutoClassType(pStructure)->name()->value() + "*)"
-                           + frm->memberPtrName("object") + ")->";
-        else
-            accessObject = frm->memberPtrName("object") + "->";
-
-        resultType = cf::typeRef() << classNamesp
-                                   << builder->name()
-                                   << cf::ETypeDecoration::reference();
+        MethodSPtr pMethod = ObjectFactory::downcastMethod(*it);
+        if (pMethod)
+            methods.push_back(pMethod);
     }
+    std::vector<MethodSPtr>::const_iterator mit;
 
-    if ((!pStructure->immutable() || pStructure->isBuildable()) && !pStructure->isOverriden(pField))
-    {
-        fdef()  << (cf::methodRef() << resultType
-                                    << namesp
-                                    << frm->setMethodName(pField)
-                                    << (cf::argumentRef() << impl->cppInnerSetDecoratedType(pField->type(), pStructure)
-                                                          << frm->cppVariableName(pField)));
-        openBlock(definitionStream);
+    line()  << "namespace";
+    eol(definitionStream);
+    line()  << "{";
+    eol(definitionStream);
+    eol(definitionStream);
+    for (mit = methods.begin(); mit != methods.end(); ++mit)
+        generateInterfaceStubDefinition(*mit);
+    line()  << "}";
+    eol(definitionStream);
+    eol(definitionStream);
 
-        if (pStructure == pBelongStructure)
-        {
-            table() << TableAligner::row()
-                    << accessObject
-                    << frm->cppMemberName(pField)
-                    << ' '
-                    << TableAligner::col()
-                    << TableAligner::col()
-                    << "= "
-                    << TableAligner::col()
-                    << frm->cppVariableName(pField)
-                    << ";";
+    fdef()  << (cf::constructorRef() << proxyNamespace
+                                     << frm->cppProxyConstructorName(pInterface)
+                                     << (cf::argumentRef() << frm->constTypeRef(targetType)
+                                                           << target)
+                                     << (cf::argumentRef() << impl->asyncQueue()
+                                                           << queue));
+    generateInitialization(
+        cf::initializationRef() << frm->memberVariableName(target)
+                                << frm->parameterValue(target));
+    generateInitialization(
+        cf::initializationRef() << frm->memberVariableName(queue)
+                                << frm->parameterValue(queue));
+    eofd(definitionStream);
+    openBlock(definitionStream, 2);
+    closeBlock(definitionStream);
+    eol(definitionStream);
 
-            if (pStructure->controlled())
+    for (mit = methods.begin(); mit != methods.end(); ++mit)
+    {
+        const MethodSPtr& pMethod = *mit;
+
+        // the calls with results wait for the dispatch, so their stubs
+        // could stay on the stack of the caller
+        bool wait = false;
+        std::vector<cf::VariableNameSPtr> arguments;
+        cf::MethodSPtr method = cf::methodRef() << vd
+                                                << proxyNamespace
+                                                << frm->cppMethodName(pMethod);
+        const std::vector<ObjectSPtr>& parameters = pMethod->objects();
+        for (it = parameters.begin(); it != parameters.end(); ++it)
+        {
+            ParameterSPtr pParameter = ObjectFactory::downcastParameter(*it);
+            if (!pParameter) continue;
+            method << (cf::argumentRef() << impl->cppParameterDecoratedType(pParameter)
+                                         << frm->cppVariableName(pParameter));
+            if (pParameter->direction() != Parameter::EDirection::in())
             {
-                table() << TableAligner::row()
-                        << accessObject
-                        << frm->memberName("bits")
-                        << " "
-                        << TableAligner::col()
-                        << "|"
-                        << TableAligner::col()
-                        << "= "
-                        << TableAligner::col()
-                        << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
-                        << ";";
+                wait = true;
+                arguments.push_back(cf::variableNameRef("&" + frm->cppVariableName(pParameter)->value()));
             }
-            eot(definitionStream);
+            else
+            {
+                arguments.push_back(frm->cppVariableName(pParameter));
+            }
+        }
 
-            line()  << returnThis;
+        fdef()  << method;
+        openBlock(definitionStream);
+        if (wait)
+            line()  << frm->cppStubClassType(pMethod)
+                    << " "
+                    << stub
+                    << "(";
+        else
+            line()  << frm->memberVariableName(queue)
+                    << "."
+                    << fnPost->value()
+                    << "(new "
+                    << frm->cppStubClassType(pMethod)
+                    << "(";
+        line()  << frm->memberVariableName(target);
+        std::vector<cf::VariableNameSPtr>::const_iterator ait;
+        for (ait = arguments.begin(); ait != arguments.end(); ++ait)
+            line()  << ", "
+                    << *ait;
+        if (wait)
+        {
+            line()  << ");";
             eol(definitionStream);
+            line()  << frm->memberVariableName(queue)
+                    << "."
+                    << fnSend->value()
+                    << "(&"
+                    << stub
+                    << ");";
         }
         else
         {
-            if (pStructure->isBuildable())
-            {
-                line()  << "return ("
-                        << (cf::typeRef() << classNamesp
-                                          << builder->name()
-                                          << cf::ETypeDecoration::reference())
-                        << ")"
-                        << (cf::functionCallRef() << belongClassBuilderNamesp
-                                                  << frm->setMethodName(pField)
-                                                  << frm->cppVariableNameAsParameter(pField))
-                        << ";";
-                eol(definitionStream);
-            }
-            else
-            {
-                line()  << (cf::functionCallRef() << frm->cppAutoClassNamespace(pBelongStructure)
-                                                  << frm->setMethodName(pField)
-                                                  << frm->cppVariableNameAsParameter(pField))
-                        << ";";
-                eol(definitionStream);
-
-                line()  << returnThis;
-                eol(definitionStream);
-            }
+            line()  << "));";
         }
         closeBlock(definitionStream);
         eol(definitionStream);
+    }
 
-        if (impl->needMutableMethod(pField, pStructure))
+    if (impl->shmTransport(pInterface))
+        generateInterfaceShmDefinition(pInterface);
+}
+
+void CppGenerator::generateInterfaceShmDefinition(const InterfaceSPtr& pInterface)
+{
+    addDependency(impl->shmChannelDependency());
+
+    cf::TypeSPtr targetType = impl->boost_smart_ptr_needed()
+                            ? cf::typeRef() << cf::typeNameRef(frm->cppSharedPtrName(frm->cppInterfaceClassType(pInterface)->name()->value()))
+                            : cf::typeRef() << cf::typeNameRef(frm->cppRawPtrName(frm->cppInterfaceClassType(pInterface)->name()->value()));
+    cf::TypeSPtr channelType = cf::typeRef() << cf::typeNameRef("shm_channel")
+                                             << cf::ETypeDecoration::reference();
+    cf::NamespaceSPtr clientNamespace = frm->cppShmClientClassNamespace(pInterface);
+    cf::NamespaceSPtr serverNamespace = frm->cppShmServerClassNamespace(pInterface);
+    std::string requests = frm->memberVariableName(channel)->value() + ".requests()";
+    std::string responses = frm->memberVariableName(channel)->value() + ".responses()";
+
+    std::vector<MethodSPtr> methods;
+    const std::vector<ObjectSPtr>& objects = pInterface->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        MethodSPtr pMethod = ObjectFactory::downcastMethod(*it);
+        if (pMethod)
+            methods.push_back(pMethod);
+    }
+
+    fdef()  << (cf::constructorRef() << clientNamespace
+                                     << frm->cppShmClientConstructorName(pInterface)
+                                     << (cf::argumentRef() << channelType
+                                                           << channel));
+    generateInitialization(
+        cf::initializationRef() << frm->memberVariableName(channel)
+                                << frm->parameterValue(channel));
+    eofd(definitionStream);
+    openBlock(definitionStream, 2);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    // the request is the index of the method followed by the in and io
+    // arguments. The response carries the io and out arguments
+    for (size_t i = 0; i < methods.size(); ++i)
+    {
+        const MethodSPtr& pMethod = methods[i];
+
+        std::vector<ParameterSPtr> inputs;
+        std::vector<ParameterSPtr> outputs;
+        cf::MethodSPtr method = cf::methodRef() << vd
+                                                << clientNamespace
+                                                << frm->cppMethodName(pMethod);
+        const std::vector<ObjectSPtr>& parameters = pMethod->objects();
+        for (it = parameters.begin(); it != parameters.end(); ++it)
         {
-            fdef()  << (cf::methodRef() << (frm->typeRef(impl->cppType(pField->type())))
-                                        << namesp
-                                        << frm->mutableMethodName(pField));
-            openBlock(definitionStream);
+            ParameterSPtr pParameter = ObjectFactory::downcastParameter(*it);
+            if (!pParameter) continue;
+            method << (cf::argumentRef() << impl->cppParameterDecoratedType(pParameter)
+                                         << frm->cppVariableName(pParameter));
+            if (pParameter->direction() != Parameter::EDirection::out())
+                inputs.push_back(pParameter);
+            if (pParameter->direction() != Parameter::EDirection::in())
+                outputs.push_back(pParameter);
+        }
+        std::vector<ParameterSPtr>::const_iterator pit;
 
-            if (pStructure->controlled())
+        fdef()  << method;
+        openBlock(definitionStream);
+        line()  << "shm_writer writer("
+                << requests
+                << ".reserve(sizeof(boost::uint32_t)";
+        for (pit = inputs.begin(); pit != inputs.end(); ++pit)
+            line()  << " + shm_writer::size("
+                    << frm->cppVariableName(*pit)
+                    << ")";
+        line()  << "));";
+        eol(definitionStream);
+        line()  << "writer.write(boost::uint32_t("
+                << boost::lexical_cast<std::string>(i)
+                << "));";
+        eol(definitionStream);
+        for (pit = inputs.begin(); pit != inputs.end(); ++pit)
+        {
+            line()  << "writer.write("
+                    << frm->cppVariableName(*pit)
+                    << ");";
+            eol(definitionStream);
+        }
+        line()  << requests
+                << ".commit();";
+        eol(definitionStream);
+
+        if (!outputs.empty())
+        {
+            eol(definitionStream);
+            line()  << "boost::uint32_t frameSize;";
+            eol(definitionStream);
+            line()  << "shm_reader reader("
+                    << responses
+                    << ".wait(frameSize));";
+            eol(definitionStream);
+            for (pit = outputs.begin(); pit != outputs.end(); ++pit)
             {
-                line()  << accessObject
-                        << frm->memberName("bits")
-                        << " |= "
-                        << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
-                        << ";";
+                line()  << "reader.read("
+                        << frm->cppVariableName(*pit)
+                        << ");";
                 eol(definitionStream);
             }
-            line()  << "return "
-                    << accessObject
-                    << frm->cppMemberName(pField)
-                    << ";";
-
-            closeBlock(definitionStream);
+            line()  << responses
+                    << ".release();";
             eol(definitionStream);
         }
+        closeBlock(definitionStream);
+        eol(definitionStream);
+    }
 
-        if (pStructure->streamable())
+    fdef()  << (cf::constructorRef() << serverNamespace
+                                     << frm->cppShmServerConstructorName(pInterface)
+                                     << (cf::argumentRef() << frm->constTypeRef(targetType)
+                                                           << target)
+                                     << (cf::argumentRef() << channelType
+                                                           << channel));
+    generateInitialization(
+        cf::initializationRef() << frm->memberVariableName(target)
+                                << frm->parameterValue(target));
+    generateInitialization(
+        cf::initializationRef() << frm->memberVariableName(channel)
+                                << frm->parameterValue(channel));
+    eofd(definitionStream);
+    openBlock(definitionStream, 2);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    fdef()  << (cf::methodRef() << bl
+                                << serverNamespace
+                                << fnDispatch);
+    openBlock(definitionStream);
+    line()  << "boost::uint32_t frameSize;";
+    eol(definitionStream);
+    line()  << "const char* frame = "
+            << requests
+            << ".peek(frameSize);";
+    eol(definitionStream);
+    line()  << "if (!frame)";
+    eol(definitionStream);
+    line()  << "return false;";
+    eol(definitionStream, 1);
+    eol(definitionStream);
+    line()  << "shm_reader reader(frame);";
+    eol(definitionStream);
+    line()  << "boost::uint32_t methodId;";
+    eol(definitionStream);
+    line()  << "reader.read(methodId);";
+    eol(definitionStream);
+    line()  << "switch (methodId)";
+    openBlock(definitionStream);
+    for (size_t i = 0; i < methods.size(); ++i)
+    {
+        const MethodSPtr& pMethod = methods[i];
+
+        std::vector<ParameterSPtr> arguments;
+        std::vector<ParameterSPtr> outputs;
+        const std::vector<ObjectSPtr>& parameters = pMethod->objects();
+        for (it = parameters.begin(); it != parameters.end(); ++it)
         {
-            cf::TypeSPtr belongType = cf::typeRef();
-            if (pStructure->isBuildable())
-            {
-                belongType << frm->cppAutoClassNamespace(pBelongStructure)
-                           << builder->name();
-            }
-            else
-            {
-                belongType << frm->cppClassType(pBelongStructure)->name();
-            }
+            ParameterSPtr pParameter = ObjectFactory::downcastParameter(*it);
+            if (!pParameter) continue;
+            arguments.push_back(pParameter);
+            if (pParameter->direction() != Parameter::EDirection::in())
+                outputs.push_back(pParameter);
+        }
+        std::vector<ParameterSPtr>::const_iterator pit;
 
-            fdef()  << (cf::methodRef() << resultType
-                                        << namesp
-                                        << fnOperatorStore
-                                        << (cf::argumentRef() << impl->cppInnerSetDecoratedType(pField->type(),
-                                                                                                pStructure)
-                                                              << frm->cppVariableName(pField)));
-            openBlock(definitionStream);
+        line()  << "case "
+                << boost::lexical_cast<std::string>(i)
+                << ":";
+        openBlock(definitionStream);
+        for (pit = arguments.begin(); pit != arguments.end(); ++pit)
+        {
+            cf::TypeSPtr type = impl->cppType((*pit)->type());
+            line()  << type
+                    << " "
+                    << frm->cppVariableName(*pit)
+                    << " = "
+                    << type
+                    << "();";
+            eol(definitionStream);
+        }
+        for (pit = arguments.begin(); pit != arguments.end(); ++pit)
+        {
+            if ((*pit)->direction() == Parameter::EDirection::out()) continue;
+            line()  << "reader.read("
+                    << frm->cppVariableName(*pit)
+                    << ");";
+            eol(definitionStream);
+        }
+        line()  << requests
+                << ".release();";
+        eol(definitionStream);
+        line()  << frm->memberVariableName(target)
+                << "->"
+                << frm->cppMethodName(pMethod)->value()
+                << "(";
+        for (pit = arguments.begin(); pit != arguments.end(); ++pit)
+        {
+            if (pit != arguments.begin())
+                line()  << ", ";
+            line()  << frm->cppVariableName(*pit);
+        }
+        line()  << ");";
+        eol(definitionStream);
 
-            if (pStructure == pBelongStructure)
+        if (!outputs.empty())
+        {
+            line()  << "shm_writer writer("
+                    << responses
+                    << ".reserve(";
+            for (pit = outputs.begin(); pit != outputs.end(); ++pit)
             {
-                line()  << "return "
-                        << frm->setMethodName(pField)
-                        << "("
-                        << frm->cppVariableName(pField)
-                        << ");";
-                eol(definitionStream);
+                if (pit != outputs.begin())
+                    line()  << " + ";
+                line()  << "shm_writer::size("
+                        << frm->cppVariableName(*pit)
+                        << ")";
             }
-            else
+            line()  << "));";
+            eol(definitionStream);
+            for (pit = outputs.begin(); pit != outputs.end(); ++pit)
             {
-                line()  << "*("
-                        << belongType
-                        << "*)this << "
-                        << frm->cppVariableName(pField)
-                        << ";";
-
-                eol(definitionStream);
-
-                line()  << returnThis;
+                line()  << "writer.write("
+                        << frm->cppVariableName(*pit)
+                        << ");";
                 eol(definitionStream);
             }
-
-            closeBlock(definitionStream);
+            line()  << responses
+                    << ".commit();";
             eol(definitionStream);
+        }
+        line()  << "break;";
+        eol(definitionStream);
+        closeBlock(definitionStream);
+    }
+    line()  << "default:";
+    eol(definitionStream);
+    ++mIndent[definitionStream];
+    line()  << requests
+            << ".release();";
+    eol(definitionStream);
+    line()  << "break;";
+    eol(definitionStream);
+    --mIndent[definitionStream];
+    closeBlock(definitionStream);
+    line()  << "return true;";
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
 
-            cf::TypeSPtr reference = impl->cppPtrDecoratedType(pStructure);
+    fdef()  << (cf::methodRef() << st
+                                << serverNamespace
+                                << fnProcess);
+    openBlock(definitionStream);
+    line()  << "size_t count = 0;";
+    eol(definitionStream);
+    line()  << "while ("
+            << fnDispatch->value()
+            << "())";
+    eol(definitionStream);
+    line()  << "++count;";
+    eol(definitionStream, 1);
+    line()  << "return count;";
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+}
 
-            if (!pStructure->immutable())
-            {
-                addDependency(impl->assert_dependency());
+void CppGenerator::generateInitialization(const cpp::frm::InitializationSPtr& initialization)
+{
+    if (table().isEmpty())
+    {
+        table() << TableAligner::row()
+                << ": ";
+    }
+    else
+    {
+        table() << TableAligner::row()
+                << ", ";
+    }
+    table() << initialization;
+}
 
-                fdef()  << (cf::methodRef() << reference
-                                            << fnOperatorStore
-                                            << (cf::argumentRef() << reference
-                                                                  << object)
-                                            << (cf::argumentRef() << impl->cppSetDecoratedType(pField->type())
-                                                                  << frm->cppVariableName(pField)));
-                openBlock(definitionStream);
+void CppGenerator::generateStructureFieldMemberInitialization(const FieldSPtr& pField)
+{
+    if (impl->needConstructorInitialization(pField))
+    {
+        generateInitialization(
+            cf::initializationRef() << frm->memberVariableName(frm->cppVariableName(pField))
+                                    << cf::parameterValueRef(frm->defaultMethodName(pField)->value() + "()"));
+    }
+}
 
-                line()  << impl->assert_method()
-                        << "(object);";
-                eol(definitionStream);
+void CppGenerator::generateStructureObjectMemberInitialization(const ObjectSPtr& pObject)
+{
+    switch (pObject->runtimeObjectId().value())
+    {
+        case EObjectId::kField:
+        {
+            FieldSPtr pField = boost::static_pointer_cast<Field>(pObject);
+            generateStructureFieldMemberInitialization(pField);
+            break;
+        }
+        case EObjectId::kIdentification:
+        case EObjectId::kUpcopy:
+        case EObjectId::kOperator:
+        case EObjectId::kEnumeration:
+        case EObjectId::kAlter:
+        case EObjectId::kFieldOverride:
+            break;
+        default:
+            assert(false);
+    }
+}
 
-                line()  << "*object << "
-                        << frm->cppVariableName(pField)
-                        << ";";
-                eol(definitionStream);
+void CppGenerator::generateStructureFieldWritingDefinition(const StructureSPtr& pStructure, const FieldSPtr& pField)
+{
+    StructureSPtr pBelongStructure = pField->structure().lock();
+    assert(pBelongStructure);
 
-                line()  << "return object;";
-                eol(definitionStream);
+    cf::NamespaceSPtr classNamesp = frm->cppAutoClassNamespace(pStructure);
+    cf::NamespaceSPtr namesp = boost::make_shared<cf::Namespace>(*classNamesp);
 
-                closeBlock(definitionStream);
-                eol(definitionStream);
-            }
+    cf::NamespaceSPtr belongClassBuilderNamesp = frm->cppAutoClassNamespace(pBelongStructure);
+    *belongClassBuilderNamesp << nsBuilder;
 
-            UnaryContainerSPtr pUnaryContainer = ObjectFactory::downcastUnaryContainer(pField->type());
-            if (pUnaryContainer)
-            {
+    std::string accessObject;
+    cf::TypeSPtr resultType = frm->typeRef(impl->cppType(pStructure));
+
+    std::string returnThis;
+    if (!pStructure->immutable() && pStructure->partial())
+        returnThis = "return *(" + frm->cppClassType(pStructure)->name()->value() + "*)this;";
+    else
+        returnThis = "return *this;";
+
+    if (pStructure->immutable())
+    {
+        *namesp << nsBuilder;
+        if (pBelongStructure->baseStructure().lock())
+            accessObject = "((" + frm->cppAutoClassType(pStructure)->name()->value() + "*)"
+                           + frm->memberPtrName("object") + ")->";
+        else
+            accessObject = frm->memberPtrName("object") + "->";
+
+        resultType = cf::typeRef() << classNamesp
+                                   << builder->name()
+                                   << cf::ETypeDecoration::reference();
+    }
+
+    bool bSetter = (!pStructure->immutable() || pStructure->isBuildable()) && !pStructure->isOverriden(pField);
+    if (mInlineAccessorsOnly && !bSetter)
+        return;
+
+    if (bSetter)
+    {
+        // only the setters of the own fields are trivial enough to be inlined
+        bool bGenerated = (pStructure == pBelongStructure)
+                        ? isAccessorGenerated(pStructure)
+                        : !mInlineAccessorsOnly;
+        if (bGenerated)
+        {
+            fdef()  << (accessorRef() << resultType
+                                      << namesp
+                                      << frm->setMethodName(pField)
+                                      << (cf::argumentRef() << impl->cppInnerSetDecoratedType(pField->type(), pStructure)
+                                                            << frm->cppVariableName(pField)));
+            openBlock(definitionStream);
+
+            if (pStructure == pBelongStructure)
+            {
+                table() << TableAligner::row()
+                        << accessObject
+                        << frm->cppMemberName(pField)
+                        << ' '
+                        << TableAligner::col()
+                        << TableAligner::col()
+                        << "= "
+                        << TableAligner::col()
+                        << frm->cppVariableName(pField)
+                        << ";";
+
+                if (pStructure->controlled())
+                {
+                    table() << TableAligner::row()
+                            << accessObject
+                            << frm->memberName("bits")
+                            << " "
+                            << TableAligner::col()
+                            << "|"
+                            << TableAligner::col()
+                            << "= "
+                            << TableAligner::col()
+                            << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
+                            << ";";
+                }
+                if (pStructure->tracked())
+                {
+                    table() << TableAligner::row()
+                            << accessObject
+                            << frm->memberName("modified")
+                            << " "
+                            << TableAligner::col()
+                            << "|"
+                            << TableAligner::col()
+                            << "= "
+                            << TableAligner::col()
+                            << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
+                            << ";";
+                }
+                eot(definitionStream);
+
+                line()  << returnThis;
+                eol(definitionStream);
+            }
+            else
+            {
+                if (pStructure->isBuildable())
+                {
+                    line()  << "return ("
+                            << (cf::typeRef() << classNamesp
+                                              << builder->name()
+                                              << cf::ETypeDecoration::reference())
+                            << ")"
+                            << (cf::functionCallRef() << belongClassBuilderNamesp
+                                                      << frm->setMethodName(pField)
+                                                      << frm->cppVariableNameAsParameter(pField))
+                            << ";";
+                    eol(definitionStream);
+                }
+                else
+                {
+                    line()  << (cf::functionCallRef() << frm->cppAutoClassNamespace(pBelongStructure)
+                                                      << frm->setMethodName(pField)
+                                                      << frm->cppVariableNameAsParameter(pField))
+                            << ";";
+                    eol(definitionStream);
+
+                    line()  << returnThis;
+                    eol(definitionStream);
+                }
+            }
+            closeBlock(definitionStream);
+            eol(definitionStream);
+        }
+
+        if (mInlineAccessorsOnly)
+            return;
+
+        if (impl->needMutableMethod(pField, pStructure))
+        {
+            fdef()  << (cf::methodRef() << (frm->typeRef(impl->cppType(pField->type())))
+                                        << namesp
+                                        << frm->mutableMethodName(pField));
+            openBlock(definitionStream);
+
+            if (pStructure->controlled())
+            {
+                line()  << accessObject
+                        << frm->memberName("bits")
+                        << " |= "
+                        << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
+                        << ";";
+                eol(definitionStream);
+            }
+            if (pStructure->tracked())
+            {
+                // the caller could modify the field through the reference
+                line()  << accessObject
+                        << frm->memberName("modified")
+                        << " |= "
+                        << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
+                        << ";";
+                eol(definitionStream);
+            }
+            line()  << "return "
+                    << accessObject
+                    << frm->cppMemberName(pField)
+                    << (impl->sharedStorage(pField) ? ".mutate()" : "")
+                    << ";";
+
+            closeBlock(definitionStream);
+            eol(definitionStream);
+        }
+
+        if (pStructure->streamable())
+        {
+            cf::TypeSPtr belongType = cf::typeRef();
+            if (pStructure->isBuildable())
+            {
+                belongType << frm->cppAutoClassNamespace(pBelongStructure)
+                           << builder->name();
+            }
+            else
+            {
+                belongType << frm->cppClassType(pBelongStructure)->name();
+            }
+
+            fdef()  << (cf::methodRef() << resultType
+                                        << namesp
+                                        << fnOperatorStore
+                                        << (cf::argumentRef() << impl->cppInnerSetDecoratedType(pField->type(),
+                                                                                                pStructure)
+                                                              << frm->cppVariableName(pField)));
+            openBlock(definitionStream);
+
+            if (pStructure == pBelongStructure)
+            {
+                line()  << "return "
+                        << frm->setMethodName(pField)
+                        << "("
+                        << frm->cppVariableName(pField)
+                        << ");";
+                eol(definitionStream);
+            }
+            else
+            {
+                line()  << "*("
+                        << belongType
+                        << "*)this << "
+                        << frm->cppVariableName(pField)
+                        << ";";
+
+                eol(definitionStream);
+
+                line()  << returnThis;
+                eol(definitionStream);
+            }
+
+            closeBlock(definitionStream);
+            eol(definitionStream);
+
+            cf::TypeSPtr reference = impl->cppPtrDecoratedType(pStructure);
+
+            if (!pStructure->immutable())
+            {
+                addDependency(impl->assert_dependency());
+
+                fdef()  << (cf::methodRef() << reference
+                                            << fnOperatorStore
+                                            << (cf::argumentRef() << reference
+                                                                  << object)
+                                            << (cf::argumentRef() << impl->cppSetDecoratedType(pField->type())
+                                                                  << frm->cppVariableName(pField)));
+                openBlock(definitionStream);
+
+                line()  << impl->assert_method()
+                        << "(object);";
+                eol(definitionStream);
+
+                line()  << "*object << "
+                        << frm->cppVariableName(pField)
+                        << ";";
+                eol(definitionStream);
+
+                line()  << "return object;";
+                eol(definitionStream);
+
+                closeBlock(definitionStream);
+                eol(definitionStream);
+            }
+
+            UnaryContainerSPtr pUnaryContainer = ObjectFactory::downcastUnaryContainer(pField->type());
+            // the fixed containers are not extendable
+            if (pUnaryContainer && (pUnaryContainer->size() != UnaryContainer::ESize::fixed()))
+            {
                 cf::TypeSPtr type = impl->cppInnerSetDecoratedType(pUnaryContainer->parameterType().lock(),
                                                                    pStructure);
                 fdef()  << (cf::methodRef() << resultType
@@ -1222,8 +2033,18 @@ void CppGenerator::generateStructureFieldWritingDefinition(const StructureSPtr&
                                 << ";";
                         eol(definitionStream);
                     }
+                    if (pStructure->tracked())
+                    {
+                        line()  << accessObject
+                                << frm->memberName("modified")
+                                << " |= "
+                                << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
+                                << ";";
+                        eol(definitionStream);
+                    }
                     line()  << accessObject
                             << frm->cppMemberName(pField)
+                            << (impl->sharedStorage(pField) ? ".mutate()" : "")
                             << ".push_back("
                             << frm->cppVariableName(pField)
                             << "Item"
@@ -1479,11 +2300,24 @@ void CppGenerator::generateStructureFieldWritingDefinition(const StructureSPtr&
                         break;
 
                     case EObjectId::kUnaryContainer:
-                        table() << TableAligner::row_line()
-                                << accessObject
-                                << frm->cppMemberName(pField)
-                                << ".clear();";
+                    {
+                        UnaryContainerSPtr pUnaryContainer = ObjectFactory::downcastUnaryContainer(pField->type());
+                        // the fixed containers could not be emptied, their
+                        // elements are reset to the default values instead
+                        if (pUnaryContainer->size() == UnaryContainer::ESize::fixed())
+                            table() << TableAligner::row_line()
+                                    << accessObject
+                                    << frm->cppMemberName(pField)
+                                    << ".assign("
+                                    << impl->cppType(pUnaryContainer->parameterType().lock())
+                                    << "());";
+                        else
+                            table() << TableAligner::row_line()
+                                    << accessObject
+                                    << frm->cppMemberName(pField)
+                                    << ".clear();";
                         break;
+                    }
 
                     default:
                         BOOST_ASSERT(false && "unknown type objId");
@@ -1503,6 +2337,21 @@ void CppGenerator::generateStructureFieldWritingDefinition(const StructureSPtr&
                     << TableAligner::col()
                     << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
                     << ";";
+            if (pStructure->tracked())
+            {
+                table() << TableAligner::row()
+                        << accessObject
+                        << frm->memberName("modified")
+                        << " "
+                        << TableAligner::col()
+                        << "|"
+                        << TableAligner::col()
+                        << "= "
+                        << TableAligner::col()
+                        << TableAligner::col()
+                        << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
+                        << ";";
+            }
             eot(definitionStream);
 
             closeBlock(definitionStream);
@@ -1564,60 +2413,88 @@ void CppGenerator::generateStructureFieldDefinition(const FieldSPtr& pField)
     StructureSPtr pStructure = pField->structure().lock();
     assert(pStructure);
 
-    fdef()  << (cf::methodRef() << impl->cppDecoratedType(pField->type())
-                                << frm->cppAutoClassNamespace(pStructure)
-                                << frm->getMethodName(pField)
-                                << cf::EMethodDeclaration::const_());
-
-    openBlock(definitionStream);
-
-    if (pStructure->controlled())
-    {
-        if (!pField->defaultValue() || pField->defaultValue()->optional())
-        {
-            addDependency(impl->assert_dependency());
-            line() << impl->assert_method()
-                   << "("
-                   << frm->availableMethodName(pField)
-                   << "());";
-            eol(definitionStream);
-        }
-    }
-    line()  << "return "
-            << impl->cppGetReturn(pField)
-            << ";";
-    eol(definitionStream);
-
-    closeBlock(definitionStream);
-    eol(definitionStream);
+    // the header includes only the forward declarations of the types held
+    // by a pointer
+    if (impl->forwardHeaders() && !mInlineAccessorsOnly)
+        addDependencies(impl->dependencies(pField));
 
-    if (pStructure->controlled())
+    if (isAccessorGenerated(pStructure))
     {
-        fdef()  << (cf::methodRef() << bl
-                                    << frm->cppAutoClassNamespace(pStructure)
-                                    << frm->availableMethodName(pField)
-                                    << cf::EMethodDeclaration::const_());
+        fdef()  << (accessorRef() << impl->cppDecoratedType(pField->type())
+                                  << frm->cppAutoClassNamespace(pStructure)
+                                  << frm->getMethodName(pField)
+                                  << cf::EMethodDeclaration::const_());
 
         openBlock(definitionStream);
 
-        line()  << "return ("
-                << frm->memberName("bits")
-                << " & "
-                << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
-                << ") != 0;";
+        if (pStructure->controlled())
+        {
+            if (!pField->defaultValue() || pField->defaultValue()->optional())
+            {
+                addDependency(impl->assert_dependency());
+                line() << impl->assert_method()
+                       << "("
+                       << frm->availableMethodName(pField)
+                       << "());";
+                eol(definitionStream);
+            }
+        }
+        line()  << "return "
+                << impl->cppGetReturn(pField)
+                << ";";
         eol(definitionStream);
 
         closeBlock(definitionStream);
         eol(definitionStream);
-    }
-
-    if (pField->defaultValue() && !pField->defaultValue()->optional())
-    {
-        generateStructureFieldConstantDefinition(pStructure,
-                                                 pField,
-                                                 pField->type()->literal(),
-                                                 pField->defaultValue());
-    }
+
+        if (pStructure->controlled())
+        {
+            fdef()  << (accessorRef() << bl
+                                      << frm->cppAutoClassNamespace(pStructure)
+                                      << frm->availableMethodName(pField)
+                                      << cf::EMethodDeclaration::const_());
+
+            openBlock(definitionStream);
+
+            line()  << "return ("
+                    << frm->memberName("bits")
+                    << " & "
+                    << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
+                    << ") != 0;";
+            eol(definitionStream);
+
+            closeBlock(definitionStream);
+            eol(definitionStream);
+        }
+
+        if (pStructure->tracked())
+        {
+            fdef()  << (accessorRef() << bl
+                                      << frm->cppAutoClassNamespace(pStructure)
+                                      << frm->modifiedMethodName(pField)
+                                      << cf::EMethodDeclaration::const_());
+
+            openBlock(definitionStream);
+
+            line()  << "return ("
+                    << frm->memberName("modified")
+                    << " & "
+                    << (cf::functionCallRef() << frm->bitmaskMethodName(pField))
+                    << ") != 0;";
+            eol(definitionStream);
+
+            closeBlock(definitionStream);
+            eol(definitionStream);
+        }
+    }
+
+    if (pField->defaultValue() && !pField->defaultValue()->optional() && !mInlineAccessorsOnly)
+    {
+        generateStructureFieldConstantDefinition(pStructure,
+                                                 pField,
+                                                 pField->type()->literal(),
+                                                 pField->defaultValue());
+    }
 
     generateStructureFieldWritingDefinition(pStructure, pField);
 }
@@ -1629,6 +2506,11 @@ void CppGenerator::generateStructureFieldOverrideDefinition(const FieldOverrideS
 
     ReferenceSPtr pReference = ObjectFactory::downcastReference(pField->type());
 
+    // the header includes only the forward declarations of the types held
+    // by a pointer
+    if (impl->forwardHeaders())
+        addDependencies(impl->dependencies(pField));
+
     fdef()  << (cf::methodRef() << impl->cppType(pField->type())
                                 << frm->cppAutoClassNamespace(pStructure)
                                 << frm->getMethodName(pField)
@@ -2017,7 +2899,7 @@ bool CppGenerator::generateStructureOperatorAction(
                                                    EOperatorAction::equalTo(),
                                                    flags,
                                                    EOperatorFlags(),
-                                                   "",
+                                                   cast,
                                                    method);
 
         std::string nexpression =
@@ -2025,7 +2907,7 @@ bool CppGenerator::generateStructureOperatorAction(
                                                EOperatorAction::notEqualTo(),
                                                flags,
                                                EOperatorFlags(),
-                                               "",
+                                               cast,
                                                method);
 
         if (expression.empty() && nexpression.empty())
@@ -2068,7 +2950,7 @@ bool CppGenerator::generateStructureOperatorAction(
                                                EOperatorAction::lessThan(),
                                                flags,
                                                EOperatorFlags(),
-                                               "",
+                                               cast,
                                                method);
 
         if (expression.empty())
@@ -2090,16 +2972,16 @@ bool CppGenerator::generateStructureOperatorAction(
                 << ") return true;";
         eol(cache1Stream, mIndent[definitionStream]);
 
-        expression =
+        std::string rexpression =
             computeStructureOperatorExpression(pType,
                                                EOperatorAction::lessThan(),
                                                flags,
                                                EOperatorFlags(),
-                                               "",
+                                               cast,
                                                method,
                                                true);
         line()  << "if ("
-                << expression
+                << rexpression
                 << ") return false;";
         eol(cache1Stream, mIndent[definitionStream]);
 
@@ -2139,269 +3021,1379 @@ void CppGenerator::generateStructureOperatorObjects(
     }
 }
 
-void CppGenerator::generateStructureOperatorBaseStructure(
-                    const StructureSPtr& pStructure,
-                    const OperatorSPtr& pOperator,
-                    const EOperatorFlags& flags)
+void CppGenerator::generateStructureOperatorBaseStructure(
+                    const StructureSPtr& pStructure,
+                    const OperatorSPtr& pOperator,
+                    const EOperatorFlags& flags)
+{
+    StructureSPtr pBaseStructure = pStructure->baseStructure().lock();
+    if (!pBaseStructure)
+        return;
+
+    std::string cast = "(const " + impl->cppType(pBaseStructure)->name()->value() + "&)";
+
+    if (generateStructureOperatorAction(pBaseStructure,
+                                        pOperator->action(),
+                                        flags,
+                                        EOperatorFlags(),
+                                        cast,
+                                        "",
+                                        true))
+    {
+        return;
+    }
+
+    generateStructureOperatorBaseStructure(pBaseStructure, pOperator, flags);
+    generateStructureOperatorObjects(pBaseStructure, pOperator, flags);
+}
+
+static EOperatorFlags compareFlags()
+{
+    EOperatorFlags flags;
+    flags.reset(EOperatorFlags::location(), EOperatorFlags::member());
+    flags.reset(EOperatorFlags::declaration(), EOperatorFlags::native());
+    flags.reset(EOperatorFlags::parameter(), EOperatorFlags::object());
+    return flags;
+}
+
+static bool isTrivialCompareType(const TypeSPtr& pType)
+{
+    if (ObjectFactory::downcastEnumeration(pType))
+        return true;
+    return pType->literal() == Type::ELiteral::integer();
+}
+
+void CppGenerator::computeStructureCompareTerms(
+                    const StructureSPtr& pStructure,
+                    std::vector<std::pair<std::string, bool> >& terms)
+{
+    StructureSPtr pBaseStructure = pStructure->baseStructure().lock();
+    if (pBaseStructure)
+    {
+        if (impl->compareOperator(pBaseStructure))
+        {
+            terms.push_back(std::make_pair(impl->cppType(pBaseStructure)->name()->value()
+                                           + "::" + fnCompare->value() + "(object)",
+                                           false));
+        }
+        else
+        {
+            computeStructureCompareTerms(pBaseStructure, terms);
+        }
+    }
+
+    const std::vector<ObjectSPtr>& objects = pStructure->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        FieldSPtr pField = ObjectFactory::downcastField(*it);
+        if (!pField) continue;
+
+        TypeSPtr pType = pField->type();
+        std::string method = frm->getMethodName(pField)->value() + "()";
+
+        // the strings and the structures with operator < compare in one pass
+        StructureSPtr pFieldStructure = ObjectFactory::downcastStructure(pType);
+        if (   (pFieldStructure && impl->compareOperator(pFieldStructure))
+            || (   (pType->name()->value() == "string")
+                && (impl->mConfiguration->mString == ImplementerConfiguration::use_stl_string)))
+        {
+            terms.push_back(std::make_pair(method + "." + fnCompare->value() + "(object." + method + ")",
+                                           false));
+            continue;
+        }
+
+        std::string expression =
+            computeStructureOperatorExpression(pType,
+                                               EOperatorAction::lessThan(),
+                                               compareFlags(),
+                                               EOperatorFlags(),
+                                               "",
+                                               method);
+        if (expression.empty())
+        {
+            line()  << "// can not compare "
+                    << pType->name()->value();
+            eol(definitionStream);
+            continue;
+        }
+
+        std::string rexpression =
+            computeStructureOperatorExpression(pType,
+                                               EOperatorAction::lessThan(),
+                                               compareFlags(),
+                                               EOperatorFlags(),
+                                               "",
+                                               method,
+                                               true);
+
+        terms.push_back(std::make_pair("(" + rexpression + ") - (" + expression + ")",
+                                       isTrivialCompareType(pType)));
+    }
+}
+
+bool CppGenerator::isStructureCompareEquality(const StructureSPtr& pStructure)
+{
+    // compare() == 0 matches the field by field equality only when every
+    // field that is ordered is also compared for equality and the reverse
+    std::vector<FieldSPtr> fields = pStructure->combinedFields();
+    std::vector<FieldSPtr>::const_iterator it;
+    for (it = fields.begin(); it != fields.end(); ++it)
+    {
+        TypeSPtr pType = (*it)->type();
+        if (pType->literal() == Type::ELiteral::real())
+            return false;
+
+        StructureSPtr pFieldStructure = ObjectFactory::downcastStructure(pType);
+        if (pFieldStructure && impl->compareOperator(pFieldStructure))
+        if (!isStructureCompareEquality(pFieldStructure))
+            return false;
+
+        bool ordered = !computeStructureOperatorExpression(pType,
+                                                           EOperatorAction::lessThan(),
+                                                           compareFlags(),
+                                                           EOperatorFlags(),
+                                                           "",
+                                                           "").empty();
+        bool equal = !computeStructureOperatorExpression(pType,
+                                                         EOperatorAction::equalTo(),
+                                                         compareFlags(),
+                                                         EOperatorFlags(),
+                                                         "",
+                                                         "").empty()
+                  || !computeStructureOperatorExpression(pType,
+                                                         EOperatorAction::notEqualTo(),
+                                                         compareFlags(),
+                                                         EOperatorFlags(),
+                                                         "",
+                                                         "").empty();
+        if (ordered != equal)
+            return false;
+    }
+    return true;
+}
+
+void CppGenerator::generateStructureCompareMethodDefinition(const StructureSPtr& pStructure)
+{
+    fdef()  << (cf::methodRef() << integer
+                                << frm->cppAutoClassNamespace(pStructure)
+                                << fnCompare
+                                << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                      << object)
+                                << cf::EMethodDeclaration::const_());
+    openBlock(definitionStream);
+
+    std::vector<std::pair<std::string, bool> > terms;
+    computeStructureCompareTerms(pStructure, terms);
+
+    // the runs of integer and enumeration fields are folded into one
+    // weighted sum of their branch-free signs, the earlier field weighs more
+    // than all the following fields of the run together
+    static const size_t maxRun = 30;
+
+    bool declared = false;
+    size_t i = 0;
+    while (i < terms.size())
+    {
+        size_t run = 1;
+        if (terms[i].second)
+        {
+            while (   (i + run < terms.size())
+                   && terms[i + run].second
+                   && (run < maxRun))
+                ++run;
+        }
+
+        bool last = (i + run == terms.size());
+        std::string prefix;
+        if (last)
+            prefix = "return ";
+        else
+        if (declared)
+            prefix = "result = ";
+        else
+            prefix = "int result = ";
+
+        if (run == 1)
+        {
+            line()  << prefix
+                    << terms[i].first
+                    << ";";
+            eol(definitionStream);
+        }
+        else
+        {
+            for (size_t j = 0; j < run; ++j)
+            {
+                if (j == 0)
+                    line() << prefix;
+                else
+                    line() << std::string(prefix.size() - 2, ' ')
+                           << "+ ";
+
+                line()  << "("
+                        << terms[i + j].first
+                        << ")";
+                if (j + 1 < run)
+                    line()  << " * "
+                            << boost::lexical_cast<std::string>(1 << (run - j - 1));
+                else
+                    line()  << ";";
+                eol(definitionStream);
+            }
+        }
+
+        if (!last)
+        {
+            line()  << "if (result) return result;";
+            eol(definitionStream);
+        }
+
+        declared = true;
+        i += run;
+    }
+
+    if (terms.empty())
+    {
+        line()  << "return 0;";
+        eol(definitionStream);
+    }
+
+    closeBlock(definitionStream);
+    eol(definitionStream);
+}
+
+void CppGenerator::generateStructureOperatorMethodsDefinition(
+        const OperatorSPtr& pOperator,
+        const EOperatorFlags& flags)
+{
+    if (!pOperator->flags().isSet(flags))
+        return;
+
+    cf::MethodNameSPtr fnOperator;
+    cf::MethodNameSPtr fnFunction;
+    if (pOperator->action() == EOperatorAction::equalTo())
+    {
+        fnOperator = fnOperatorEq;
+        fnFunction = fnFunctionalOperatorEq;
+    }
+    else
+    if (pOperator->action() == EOperatorAction::lessThan())
+    {
+        fnOperator = fnOperatorLt;
+        fnFunction = fnFunctionalOperatorLt;
+    }
+    else
+    {
+        assert(false && "unknown operator action");
+    }
+
+    cf::MethodNameSPtr fnName;
+    if (flags.isSet(EOperatorFlags::functor()))
+    {
+        fnName = fnOperatorFn;
+    }
+    else
+    {
+        if (flags.isSet(EOperatorFlags::native()))
+            fnName = fnOperator;
+        else
+            fnName = fnFunction;
+    }
+
+    StructureSPtr pStructure = pOperator->structure().lock();
+
+    cf::NamespaceSPtr nmspace = frm->cppAutoClassNamespace(pStructure);
+    if (flags.isSet(EOperatorFlags::functor()))
+        *nmspace << cf::namespaceNameRef(fnFunction->value());
+
+    int arguments;
+    if (flags.isClear(EOperatorFlags::member()) || flags.isSet(EOperatorFlags::functor()))
+        arguments = 2;
+    else
+        arguments = 1;
+
+    cf::TypeSPtr type;
+    if (flags.isSet(EOperatorFlags::object()))
+        type = impl->cppDecoratedType(pStructure);
+    else
+    if (flags.isSet(EOperatorFlags::reference()))
+        type = impl->cppPtrDecoratedType(pStructure);
+    else
+        assert(false && "unknown operator parameter");
+
+    cf::EMethodDeclaration declaration;
+    if (flags.isSet(EOperatorFlags::member()) || flags.isSet(EOperatorFlags::functor()))
+        declaration = cf::EMethodDeclaration::const_();
+
+    if (arguments == 1)
+    {
+        fdef()  << (cf::methodRef() << bl
+                                    << nmspace
+                                    << fnName
+                                    << (cf::argumentRef() << type
+                                                          << object)
+                                    << declaration);
+    }
+    else
+    {
+        fdef()  << (cf::methodRef() << bl
+                                    << nmspace
+                                    << fnName
+                                    << (cf::argumentRef() << type
+                                                          << object1)
+                                    << (cf::argumentRef() << type
+                                                          << object2)
+                                    << declaration);
+    }
+
+    openBlock(definitionStream);
+
+    std::string expression =
+        computeStructureOperatorExpression(pStructure,
+                                           pOperator->action(),
+                                           flags,
+                                           flags,
+                                           "",
+                                           "");
+
+    if (expression.empty())
+    {
+        // the interned instances are unique, the same instance is the fast path
+        if (pStructure->interned() && (pOperator->action() == EOperatorAction::equalTo()))
+        {
+            std::string address = flags.isSet(EOperatorFlags::object()) ? "&" : "";
+            std::string get = flags.isSet(EOperatorFlags::object()) ? "" : ".get()";
+            if (arguments == 1)
+            {
+                line()  << "if (this == "
+                        << address
+                        << object
+                        << get
+                        << ") return true;";
+            }
+            else
+            {
+                line()  << "if ("
+                        << address
+                        << object1
+                        << get
+                        << " == "
+                        << address
+                        << object2
+                        << get
+                        << ") return true;";
+            }
+            eol(definitionStream);
+        }
+
+        // the operators build on the three-way compare when it gives the
+        // same answer as the field by field chain
+        if (   impl->compareOperator(pStructure)
+            && (   (pOperator->action() == EOperatorAction::lessThan())
+                || isStructureCompareEquality(pStructure)))
+        {
+            std::string relation = (pOperator->action() == EOperatorAction::lessThan()) ? " < 0;" : " == 0;";
+            std::string dereference = flags.isSet(EOperatorFlags::object()) ? "" : "*";
+            std::string access = flags.isSet(EOperatorFlags::object()) ? "." : "->";
+            if (arguments == 1)
+            {
+                line()  << "return "
+                        << fnCompare->value()
+                        << "("
+                        << dereference
+                        << object
+                        << ")"
+                        << relation;
+            }
+            else
+            {
+                line()  << "return "
+                        << object1
+                        << access
+                        << fnCompare->value()
+                        << "("
+                        << dereference
+                        << object2
+                        << ")"
+                        << relation;
+            }
+        }
+        else
+        {
+            if (pOperator->action() == EOperatorAction::equalTo())
+                line()  << "return true;";
+            else
+            if (pOperator->action() == EOperatorAction::lessThan())
+                line()  << "return false;";
+            eol(cache2Stream, mIndent[definitionStream]);
+
+            generateStructureOperatorBaseStructure(pStructure, pOperator, flags);
+            generateStructureOperatorObjects(pStructure, pOperator, flags);
+            *mStreams[definitionStream] << mStreams[cache2Stream]->str();
+            mStreams[cache1Stream]->str("");
+            mStreams[cache2Stream]->str("");
+        }
+    }
+    else
+    {
+        line()  << "return "
+                << expression
+                << ";";
+    }
+
+    closeBlock(definitionStream);
+    eol(definitionStream);
+}
+
+void CppGenerator::generateStructureOperatorMethodsDefinition(
+        const OperatorSPtr& pOperator)
+{
+    StructureSPtr pStructure = pOperator->structure().lock();
+    if (pOperator == impl->compareOperator(pStructure))
+        generateStructureCompareMethodDefinition(pStructure);
+
+    EOperatorFlags flags;
+    for (int l = 0; l < 3; ++l)
+    {
+        switch (l)
+        {
+            case 0: flags.reset(EOperatorFlags::location(), EOperatorFlags::member()); break;
+            case 1: flags.reset(EOperatorFlags::location(), EOperatorFlags::internal()); break;
+            case 2: flags.reset(EOperatorFlags::location(), EOperatorFlags::external()); break;
+        }
+        for (int d = 0; d < 3; ++d)
+        {
+            switch (d)
+            {
+                case 0: flags.reset(EOperatorFlags::declaration(), EOperatorFlags::native()); break;
+                case 1: flags.reset(EOperatorFlags::declaration(), EOperatorFlags::function()); break;
+                case 2: flags.reset(EOperatorFlags::declaration(), EOperatorFlags::functor()); break;
+            }
+
+            for (int p = 0; p < 2; ++p)
+            {
+                switch (p)
+                {
+                    case 0: flags.reset(EOperatorFlags::parameter(), EOperatorFlags::object()); break;
+                    case 1: flags.reset(EOperatorFlags::parameter(), EOperatorFlags::reference()); break;
+                }
+
+                generateStructureOperatorMethodsDefinition(pOperator, flags);
+            }
+        }
+    }
+}
+
+void CppGenerator::generateStructureObjectDefinition(const StructureSPtr& pStructure,
+                                                     const ObjectSPtr& pObject)
+{
+    switch (pObject->runtimeObjectId().value())
+    {
+        case EObjectId::kField:
+        {
+            FieldSPtr pField = boost::static_pointer_cast<Field>(pObject);
+            generateStructureFieldDefinition(pField);
+            break;
+        }
+        case EObjectId::kFieldOverride:
+        {
+            FieldOverrideSPtr pFieldOverride = boost::static_pointer_cast<FieldOverride>(pObject);
+            generateStructureFieldOverrideDefinition(pFieldOverride);
+            break;
+        }
+        case EObjectId::kIdentification:
+        {
+            IdentificationSPtr pIdentification = boost::static_pointer_cast<Identification>(pObject);
+            generateStructureIdentificationMethodsDefinition(pIdentification);
+            break;
+        }
+        case EObjectId::kUpcopy:
+        {
+            //UpcopySPtr pUpcopy = boost::static_pointer_cast<Upcopy>(pObject);
+            break;
+        }
+        case EObjectId::kOperator:
+        {
+            OperatorSPtr pOperator = boost::static_pointer_cast<Operator>(pObject);
+            generateStructureOperatorMethodsDefinition(pOperator);
+            break;
+        }
+        case EObjectId::kEnumeration:
+        {
+            EnumerationSPtr pEnumeration = boost::static_pointer_cast<Enumeration>(pObject);
+            generateEnumerationDefinition(pEnumeration);
+            break;
+        }
+        case EObjectId::kAlter:
+        {
+            AlterSPtr pAlter = boost::static_pointer_cast<Alter>(pObject);
+            generateStructureFieldConstantDefinition(pStructure,
+                                                     pAlter->field(),
+                                                     pAlter->field()->type()->literal(),
+                                                     pAlter->defaultValue());
+            break;
+        }
+        default:
+            assert(false);
+    }
+}
+
+void CppGenerator::generateBaseStructureDefinition(const StructureSPtr& pStructure,
+                                                   const StructureSPtr& pBaseStructure)
+{
+    if (!pBaseStructure) return;
+
+    generateBaseStructureDefinition(pStructure, pBaseStructure->baseStructure().lock());
+
+    const std::vector<ObjectSPtr>& objects = pBaseStructure->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        const ObjectSPtr& pObject = *it;
+        switch (pObject->runtimeObjectId().value())
+        {
+            case EObjectId::kField:
+            {
+                FieldSPtr pField = boost::static_pointer_cast<Field>(pObject);
+                generateStructureFieldWritingDefinition(pStructure, pField);
+                break;
+            }
+            case EObjectId::kEnumeration:
+            case EObjectId::kFieldOverride:
+            case EObjectId::kIdentification:
+            case EObjectId::kUpcopy:
+            case EObjectId::kOperator:
+                break;
+            default:
+                assert(false);
+        }
+    }
+}
+
+void CppGenerator::generateStructureBitmaskMethodsDefinition(const StructureSPtr& pStructure)
+{
+    if (!pStructure->controlled())
+        return;
+    if (!isAccessorGenerated(pStructure))
+        return;
+
+    const std::vector<ObjectSPtr>& objects = pStructure->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        FieldSPtr pField = ObjectFactory::downcastField(*it);
+        if (!pField) continue;
+
+        fdef()  << (accessorRef() << integer
+                                  << frm->cppAutoClassNamespace(pStructure)
+                                  << frm->bitmaskMethodName(pField));
+        openBlock(definitionStream);
+        line()  << "return "
+                << frm->bitmask(pField->bitmask())
+                << ";";
+        closeBlock(definitionStream);
+        eol(definitionStream);
+    }
+}
+
+void CppGenerator::generateStructureIsInitializedMethodDefinition(const StructureSPtr& pStructure)
+{
+    if (!pStructure->isInitializable())
+        return;
+    if (!isAccessorGenerated(pStructure))
+        return;
+
+    fdef()  << (accessorRef() << bl
+                              << frm->cppAutoClassNamespace(pStructure)
+                              << fnIsInitialized
+                              << cf::EMethodDeclaration::const_());
+    openBlock(definitionStream);
+
+    StructureSPtr pStruct = pStructure->baseStructure().lock();
+    while (pStruct)
+    {
+        if (pStruct->controlled() && pStruct->hasField())
+        {
+            line()  << "if (!"
+                    << (cf::functionCallRef() << frm->cppAutoClassNamespace(pStruct)
+                                              << fnIsInitialized)
+                    << ") return false;";
+            eol(definitionStream);
+            break;
+        }
+        line()  << "// structure "
+                << pStruct->name()->value()
+                << " is not controlled. This function assume it is initilized";
+        eol(definitionStream);
+
+        pStruct = pStruct->baseStructure().lock();
+    }
+
+    const std::vector<ObjectSPtr>& objects = pStructure->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        FieldSPtr pField = ObjectFactory::downcastField(*it);
+        if (!pField) continue;
+        if (pField->defaultValue()) continue;
+
+        line()  << "if (!"
+                << (cf::functionCallRef() << frm->validMethodName(pField))
+                << ") return false;";
+        eol(definitionStream);
+    }
+    line()  << "return true;";
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+}
+
+std::string CppGenerator::computeStructureFieldEqualExpression(const FieldSPtr& pField)
+{
+    TypeSPtr pType = pField->type();
+
+    // compares the field of this instance with the field of the object
+    std::string method = frm->getMethodName(pField)->value() + "()";
+    ReferenceSPtr pReference = ObjectFactory::downcastReference(pType);
+    if (pReference)
+    {
+        std::string lock = pReference->weak() ? ".lock()" : "";
+        return method + lock + " == " + object->value() + "." + method + lock;
+    }
+
+    if (ObjectFactory::downcastUnaryContainer(pType))
+        return method + " == " + object->value() + "." + method;
+
+    EOperatorFlags flags;
+    flags.reset(EOperatorFlags::location(), EOperatorFlags::member());
+    flags.reset(EOperatorFlags::declaration(), EOperatorFlags::native());
+    flags.reset(EOperatorFlags::parameter(), EOperatorFlags::object());
+    return computeStructureOperatorExpression(pType,
+                                              EOperatorAction::equalTo(),
+                                              flags,
+                                              EOperatorFlags(),
+                                              "",
+                                              method);
+}
+
+void CppGenerator::generateStructureInternMethodsDefinition(const StructureSPtr& pStructure)
+{
+    addDependency(impl->internTableDependency());
+    addDependency(impl->hash_dependency());
+
+    std::vector<FieldSPtr> fields = pStructure->combinedFields();
+    std::vector<FieldSPtr>::const_iterator it;
+
+    fdef()  << (cf::methodRef() << st
+                                << frm->cppAutoClassNamespace(pStructure)
+                                << fnInternHash
+                                << cf::EMethodDeclaration::const_());
+    openBlock(definitionStream);
+    line()  << "size_t seed = 0;";
+    eol(definitionStream);
+    for (it = fields.begin(); it != fields.end(); ++it)
+    {
+        const FieldSPtr& pField = *it;
+        TypeSPtr pType = pField->type();
+
+        // the hash could skip fields, the equality can not
+        std::string value = frm->getMethodName(pField)->value() + "()";
+        ReferenceSPtr pReference = ObjectFactory::downcastReference(pType);
+        if (pReference)
+        {
+            if (pReference->weak())
+                value += ".lock()";
+            value += ".get()";
+        }
+        else
+        if (ObjectFactory::downcastEnumeration(pType))
+        {
+            value += ".value()";
+        }
+        else
+        if (  (pType->literal() != Type::ELiteral::boolean())
+           && (pType->literal() != Type::ELiteral::integer())
+           && (pType->literal() != Type::ELiteral::real())
+           && (pType->literal() != Type::ELiteral::string()))
+        {
+            continue;
+        }
+
+        StructureSPtr pFieldStructure = pField->structure().lock();
+        if (  pFieldStructure->controlled()
+           && (!pField->defaultValue() || pField->defaultValue()->optional()))
+        {
+            line()  << "if ("
+                    << (cf::functionCallRef() << frm->availableMethodName(pField))
+                    << ") ";
+        }
+        line()  << "boost::hash_combine(seed, "
+                << value
+                << ");";
+        eol(definitionStream);
+    }
+    line()  << "return seed;";
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    fdef()  << (cf::methodRef() << bl
+                                << frm->cppAutoClassNamespace(pStructure)
+                                << fnInternEquals
+                                << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                      << object)
+                                << cf::EMethodDeclaration::const_());
+    openBlock(definitionStream);
+    line()  << "if (this == &"
+            << object
+            << ") return true;";
+    eol(definitionStream);
+
+    for (it = fields.begin(); it != fields.end(); ++it)
+    {
+        const FieldSPtr& pField = *it;
+        TypeSPtr pType = pField->type();
+
+        std::string expression = computeStructureFieldEqualExpression(pField);
+        if (expression.empty())
+        {
+            line()  << "// can not compare "
+                    << pType->name()->value();
+            eol(definitionStream);
+            continue;
+        }
+
+        StructureSPtr pFieldStructure = pField->structure().lock();
+        if (  pFieldStructure->controlled()
+           && (!pField->defaultValue() || pField->defaultValue()->optional()))
+        {
+            std::string available = frm->availableMethodName(pField)->value() + "()";
+            line()  << "if ("
+                    << available
+                    << " != "
+                    << object
+                    << "."
+                    << available
+                    << ") return false;";
+            eol(definitionStream);
+            line()  << "if ("
+                    << available
+                    << " && !("
+                    << expression
+                    << ")) return false;";
+        }
+        else
+        {
+            line()  << "if (!("
+                    << expression
+                    << ")) return false;";
+        }
+        eol(definitionStream);
+    }
+    line()  << "return true;";
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    fdef()  << (cf::methodRef() << impl->internTable(pStructure)
+                                << frm->cppAutoClassNamespace(pStructure)
+                                << fnInternTable);
+    openBlock(definitionStream);
+    line()  << "static "
+            << impl->internTable(pStructure)->name()->value()
+            << "* table = new "
+            << impl->internTable(pStructure)->name()->value()
+            << "();";
+    eol(definitionStream);
+    line()  << "return *table;";
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    const std::pair<cf::MethodNameSPtr, std::string> statistics[] =
+    {
+        std::make_pair(fnInternTableSize, std::string("size")),
+        std::make_pair(fnInternTableLookups, std::string("lookups")),
+        std::make_pair(fnInternTableHits, std::string("hits")),
+        std::make_pair(fnInternTableHitRatio, std::string("hit_ratio")),
+    };
+    for (size_t i = 0; i < sizeof(statistics) / sizeof(statistics[0]); ++i)
+    {
+        fdef()  << (cf::methodRef() << (statistics[i].first == fnInternTableHitRatio ? dbl : st)
+                                    << frm->cppAutoClassNamespace(pStructure)
+                                    << statistics[i].first);
+        openBlock(definitionStream);
+        line()  << "return "
+                << (cf::functionCallRef() << fnInternTable)
+                << "."
+                << statistics[i].second
+                << "();";
+        eol(definitionStream);
+        closeBlock(definitionStream);
+        eol(definitionStream);
+    }
+}
+
+void CppGenerator::generateStructurePooledMethodsDefinition(const StructureSPtr& pStructure)
 {
-    StructureSPtr pBaseStructure = pStructure->baseStructure().lock();
-    if (!pBaseStructure)
-        return;
+    addDependency(impl->objectPoolDependency());
 
-    std::string cast = "(" + impl->cppType(pBaseStructure)->name()->value() + ")";
+    std::string className = frm->cppMainClassType(pStructure)->name()->value();
+    std::string pool = impl->objectPool(pStructure)->name()->value();
 
-    if (generateStructureOperatorAction(pBaseStructure,
-                                        pOperator->action(),
-                                        flags,
-                                        EOperatorFlags(),
-                                        cast,
-                                        "",
-                                        true))
+    fdef()  << (cf::methodRef() << vdPtr
+                                << frm->cppAutoClassNamespace(pStructure)
+                                << fnOperatorNew
+                                << (cf::argumentRef() << st
+                                                      << size));
+    openBlock(definitionStream);
+    line()  << "// the derived classes inherit the operator";
+    eol(definitionStream);
+    line()  << "if ("
+            << size
+            << " != sizeof("
+            << className
+            << "))";
+    eol(definitionStream);
+    line()  << "    return ::operator new("
+            << size
+            << ");";
+    eol(definitionStream);
+    line()  << "return "
+            << pool
+            << "::allocate();";
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    fdef()  << (cf::methodRef() << vd
+                                << frm->cppAutoClassNamespace(pStructure)
+                                << fnOperatorDelete
+                                << (cf::argumentRef() << vdPtr
+                                                      << object)
+                                << (cf::argumentRef() << st
+                                                      << size));
+    openBlock(definitionStream);
+    line()  << "if ("
+            << size
+            << " != sizeof("
+            << className
+            << "))";
+    eol(definitionStream);
+    line()  << "    ::operator delete("
+            << object
+            << ");";
+    eol(definitionStream);
+    line()  << "else";
+    eol(definitionStream);
+    line()  << "    "
+            << pool
+            << "::deallocate("
+            << object
+            << ");";
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    const std::pair<cf::MethodNameSPtr, std::string> statistics[] =
     {
-        return;
+        std::make_pair(fnPoolThreads, std::string("threads")),
+        std::make_pair(fnPoolBlocks, std::string("blocks")),
+        std::make_pair(fnPoolAvailable, std::string("available")),
+        std::make_pair(fnPoolUsed, std::string("used")),
+    };
+    for (size_t i = 0; i < sizeof(statistics) / sizeof(statistics[0]); ++i)
+    {
+        fdef()  << (cf::methodRef() << st
+                                    << frm->cppAutoClassNamespace(pStructure)
+                                    << statistics[i].first);
+        openBlock(definitionStream);
+        line()  << "return "
+                << pool
+                << "::"
+                << statistics[i].second
+                << "();";
+        eol(definitionStream);
+        closeBlock(definitionStream);
+        eol(definitionStream);
     }
-
-    generateStructureOperatorBaseStructure(pBaseStructure, pOperator, flags);
-    generateStructureOperatorObjects(pBaseStructure, pOperator, flags);
 }
 
-void CppGenerator::generateStructureOperatorMethodsDefinition(
-        const OperatorSPtr& pOperator,
-        const EOperatorFlags& flags)
+void CppGenerator::generateStructureTrackedMethodsDefinition(const StructureSPtr& pStructure)
 {
-    if (!pOperator->flags().isSet(flags))
-        return;
+    StructureSPtr pBaseStructure = pStructure->baseStructure().lock();
 
-    cf::MethodNameSPtr fnOperator;
-    cf::MethodNameSPtr fnFunction;
-    if (pOperator->action() == EOperatorAction::equalTo())
+    const std::vector<ObjectSPtr>& objects = pStructure->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+
+    fdef()  << (cf::methodRef() << bl
+                                << frm->cppAutoClassNamespace(pStructure)
+                                << fnIsModified
+                                << cf::EMethodDeclaration::const_());
+    openBlock(definitionStream);
+    if (pStructure->hasField())
     {
-        fnOperator = fnOperatorEq;
-        fnFunction = fnFunctionalOperatorEq;
+        line()  << "if ("
+                << frm->memberName("modified")
+                << " != 0) return true;";
+        eol(definitionStream);
     }
-    else
-    if (pOperator->action() == EOperatorAction::lessThan())
+    if (pBaseStructure)
     {
-        fnOperator = fnOperatorLt;
-        fnFunction = fnFunctionalOperatorLt;
+        line()  << "return "
+                << (cf::functionCallRef() << frm->cppAutoClassNamespace(pBaseStructure)
+                                          << fnIsModified)
+                << ";";
     }
     else
     {
-        assert(false && "unknown operator action");
+        line()  << "return false;";
     }
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
 
-    cf::MethodNameSPtr fnName;
-    if (flags.isSet(EOperatorFlags::functor()))
+    fdef()  << (cf::methodRef() << vd
+                                << frm->cppAutoClassNamespace(pStructure)
+                                << fnCheckpoint);
+    openBlock(definitionStream);
+    if (pBaseStructure)
     {
-        fnName = fnOperatorFn;
+        line()  << (cf::functionCallRef() << frm->cppAutoClassNamespace(pBaseStructure)
+                                          << fnCheckpoint)
+                << ";";
+        eol(definitionStream);
     }
-    else
+    if (pStructure->hasField())
     {
-        if (flags.isSet(EOperatorFlags::native()))
-            fnName = fnOperator;
-        else
-            fnName = fnFunction;
+        line()  << frm->memberName("modified")
+                << " = 0;";
+        eol(definitionStream);
     }
+    closeBlock(definitionStream);
+    eol(definitionStream);
 
-    StructureSPtr pStructure = pOperator->structure().lock();
-
-    cf::NamespaceSPtr nmspace = frm->cppAutoClassNamespace(pStructure);
-    if (flags.isSet(EOperatorFlags::functor()))
-        *nmspace << cf::namespaceNameRef(fnFunction->value());
-
-    int arguments;
-    if (flags.isClear(EOperatorFlags::member()) || flags.isSet(EOperatorFlags::functor()))
-        arguments = 2;
-    else
-        arguments = 1;
-
-    cf::TypeSPtr type;
-    if (flags.isSet(EOperatorFlags::object()))
-        type = impl->cppDecoratedType(pStructure);
-    else
-    if (flags.isSet(EOperatorFlags::reference()))
-        type = impl->cppPtrDecoratedType(pStructure);
-    else
-        assert(false && "unknown operator parameter");
-
-    cf::EMethodDeclaration declaration;
-    if (flags.isSet(EOperatorFlags::member()) || flags.isSet(EOperatorFlags::functor()))
-        declaration = cf::EMethodDeclaration::const_();
-
-    if (arguments == 1)
-    {
-        fdef()  << (cf::methodRef() << bl
-                                    << nmspace
-                                    << fnName
-                                    << (cf::argumentRef() << type
-                                                          << object)
-                                    << declaration);
-    }
-    else
+    if (!pStructure->abstract())
     {
-        fdef()  << (cf::methodRef() << bl
-                                    << nmspace
-                                    << fnName
-                                    << (cf::argumentRef() << type
+        fdef()  << (cf::methodRef() << impl->cppType(pStructure)
+                                    << frm->cppAutoClassNamespace(pStructure)
+                                    << fnDiff
+                                    << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
                                                           << object1)
-                                    << (cf::argumentRef() << type
-                                                          << object2)
-                                    << declaration);
+                                    << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                          << object2));
+        openBlock(definitionStream);
+        // the delta starts empty, so the unchanged fields are never copied
+        line()  << impl->cppType(pStructure)
+                << " "
+                << delta
+                << ";";
+        eol(definitionStream);
+        line()  << object1
+                << "."
+                << (cf::functionCallRef() << fnCopyDifferences
+                                          << cf::parameterValueRef(object2->value())
+                                          << cf::parameterValueRef(delta->value()))
+                << ";";
+        eol(definitionStream);
+        line()  << "return "
+                << delta
+                << ";";
+        eol(definitionStream);
+        closeBlock(definitionStream);
+        eol(definitionStream);
     }
 
+    fdef()  << (cf::methodRef() << vd
+                                << frm->cppAutoClassNamespace(pStructure)
+                                << fnApplyDelta
+                                << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                      << delta));
     openBlock(definitionStream);
+    if (pBaseStructure)
+    {
+        line()  << (cf::functionCallRef() << frm->cppAutoClassNamespace(pBaseStructure)
+                                          << fnApplyDelta
+                                          << cf::parameterValueRef(delta->value()))
+                << ";";
+        eol(definitionStream);
+    }
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        FieldSPtr pField = ObjectFactory::downcastField(*it);
+        if (!pField) continue;
 
-    std::string expression =
-        computeStructureOperatorExpression(pStructure,
-                                           pOperator->action(),
-                                           flags,
-                                           flags,
-                                           "",
-                                           "");
+        line()  << "if ("
+                << delta
+                << "."
+                << (cf::functionCallRef() << frm->modifiedMethodName(pField))
+                << ")";
+        openBlock(definitionStream);
+        line()  << "if ("
+                << delta
+                << "."
+                << (cf::functionCallRef() << frm->availableMethodName(pField))
+                << ")";
+        eol(definitionStream);
+        line()  << (cf::functionCallRef() << frm->setMethodName(pField)
+                                          << cf::parameterValueRef(delta->value() + "." +
+                                                                   frm->getMethodName(pField)->value() + "()"))
+                << ";";
+        eol(definitionStream, 1);
+        line()  << "else";
+        eol(definitionStream);
+        line()  << (cf::functionCallRef() << frm->destroyMethodName(pField))
+                << ";";
+        eol(definitionStream, 1);
+        closeBlock(definitionStream);
+    }
+    closeBlock(definitionStream);
+    eol(definitionStream);
 
-    if (expression.empty())
+    fdef()  << (cf::methodRef() << vd
+                                << frm->cppAutoClassNamespace(pStructure)
+                                << fnCopyDifferences
+                                << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                      << object)
+                                << (cf::argumentRef() << frm->typeRef(impl->cppType(pStructure))
+                                                      << delta)
+                                << cf::EMethodDeclaration::const_());
+    openBlock(definitionStream);
+    if (pBaseStructure)
     {
-        if (pOperator->action() == EOperatorAction::equalTo())
-            line()  << "return true;";
-        else
-        if (pOperator->action() == EOperatorAction::lessThan())
-            line()  << "return false;";
-        eol(cache2Stream, mIndent[definitionStream]);
+        line()  << (cf::functionCallRef() << frm->cppAutoClassNamespace(pBaseStructure)
+                                          << fnCopyDifferences
+                                          << cf::parameterValueRef(object->value())
+                                          << cf::parameterValueRef(delta->value()))
+                << ";";
+        eol(definitionStream);
+    }
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        FieldSPtr pField = ObjectFactory::downcastField(*it);
+        if (!pField) continue;
 
-        generateStructureOperatorBaseStructure(pStructure, pOperator, flags);
-        generateStructureOperatorObjects(pStructure, pOperator, flags);
-        *mStreams[definitionStream] << mStreams[cache2Stream]->str();
-        mStreams[cache1Stream]->str("");
-        mStreams[cache2Stream]->str("");
+        std::string available = frm->availableMethodName(pField)->value() + "()";
+        std::string expression = computeStructureFieldEqualExpression(pField);
+        if (expression.empty())
+        {
+            // the field is considered modified whenever it is present
+            line()  << "// can not compare "
+                    << pField->type()->name()->value();
+            eol(definitionStream);
+            line()  << "if ("
+                    << available
+                    << " || "
+                    << object
+                    << "."
+                    << available
+                    << ")";
+        }
+        else
+        {
+            line()  << "if ("
+                    << available
+                    << " != "
+                    << object
+                    << "."
+                    << available
+                    << " || ("
+                    << available
+                    << " && !("
+                    << expression
+                    << ")))";
+        }
+        openBlock(definitionStream);
+        // the set and destroy methods mark the field of the delta as modified
+        line()  << "if ("
+                << object
+                << "."
+                << available
+                << ")";
+        eol(definitionStream);
+        line()  << delta
+                << "."
+                << (cf::functionCallRef() << frm->setMethodName(pField)
+                                          << cf::parameterValueRef(object->value() + "." +
+                                                                   frm->getMethodName(pField)->value() + "()"))
+                << ";";
+        eol(definitionStream, 1);
+        line()  << "else";
+        eol(definitionStream);
+        line()  << delta
+                << "."
+                << (cf::functionCallRef() << frm->destroyMethodName(pField))
+                << ";";
+        eol(definitionStream, 1);
+        closeBlock(definitionStream);
     }
-    else
+    closeBlock(definitionStream);
+    eol(definitionStream);
+}
+
+void CppGenerator::generateStructureColumnsDefinition(const StructureSPtr& pStructure)
+{
+    std::vector<FieldSPtr> fields = pStructure->combinedFields();
+    std::vector<FieldSPtr>::const_iterator it;
+
+    cf::NamespaceSPtr columnsNamespace = frm->cppColumnsClassNamespace(pStructure);
+    cf::NamespaceSPtr rowNamespace = frm->cppColumnsClassNamespace(pStructure);
+    *rowNamespace << nsRow;
+
+    fdef()  << (cf::constructorRef() << rowNamespace
+                                     << rowConstructorName
+                                     << (cf::argumentRef() << frm->constTypeRef(frm->cppColumnsClassType(pStructure))
+                                                           << columns)
+                                     << (cf::argumentRef() << st
+                                                           << index));
+    generateInitialization(
+        cf::initializationRef() << frm->memberVariableName(columns)
+                                << frm->parameterValue(columns));
+    generateInitialization(
+        cf::initializationRef() << frm->memberVariableName(index)
+                                << frm->parameterValue(index));
+    eofd(definitionStream);
+    openBlock(definitionStream, 2);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    for (it = fields.begin(); it != fields.end(); ++it)
     {
+        const FieldSPtr& pField = *it;
+
+        fdef()  << (cf::methodRef() << impl->cppDecoratedType(pField->type())
+                                    << rowNamespace
+                                    << frm->getMethodName(pField)
+                                    << cf::EMethodDeclaration::const_());
+        openBlock(definitionStream);
         line()  << "return "
-                << expression
-                << ";";
+                << frm->memberName("columns")
+                << "."
+                << (cf::functionCallRef() << frm->getMethodName(pField))
+                << "["
+                << frm->memberName("index")
+                << "]";
+        TypeSPtr pType = pField->type();
+        if (!pType->package() && (pType->name()->value() == "boolean"))
+            line()  << " != 0";
+        line()  << ";";
+        eol(definitionStream);
+        closeBlock(definitionStream);
+        eol(definitionStream);
+
+        if (impl->columnAvailability(pField))
+        {
+            fdef()  << (cf::methodRef() << bl
+                                        << rowNamespace
+                                        << frm->availableMethodName(pField)
+                                        << cf::EMethodDeclaration::const_());
+            openBlock(definitionStream);
+            line()  << "return "
+                    << frm->memberName("columns")
+                    << "."
+                    << (cf::functionCallRef() << frm->availableMethodName(pField))
+                    << "["
+                    << frm->memberName("index")
+                    << "];";
+            eol(definitionStream);
+            closeBlock(definitionStream);
+            eol(definitionStream);
+        }
     }
 
+    fdef()  << (cf::constructorRef() << columnsNamespace
+                                     << frm->cppColumnsConstructorName(pStructure));
+    openBlock(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    fdef()  << (cf::destructorRef() << columnsNamespace
+                                    << frm->cppColumnsDestructorName(pStructure));
+    openBlock(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    // all the columns have the same size
+    std::string firstColumn = frm->cppMemberName(fields.front());
+
+    fdef()  << (cf::methodRef() << st
+                                << columnsNamespace
+                                << fnSize
+                                << cf::EMethodDeclaration::const_());
+    openBlock(definitionStream);
+    line()  << "return "
+            << firstColumn
+            << ".size();";
+    eol(definitionStream);
     closeBlock(definitionStream);
     eol(definitionStream);
-}
 
-void CppGenerator::generateStructureOperatorMethodsDefinition(
-        const OperatorSPtr& pOperator)
-{
-    EOperatorFlags flags;
-    for (int l = 0; l < 3; ++l)
+    fdef()  << (cf::methodRef() << bl
+                                << columnsNamespace
+                                << fnEmpty
+                                << cf::EMethodDeclaration::const_());
+    openBlock(definitionStream);
+    line()  << "return "
+            << firstColumn
+            << ".empty();";
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
+
+    const std::pair<cf::MethodNameSPtr, std::string> updates[] =
     {
-        switch (l)
-        {
-            case 0: flags.reset(EOperatorFlags::location(), EOperatorFlags::member()); break;
-            case 1: flags.reset(EOperatorFlags::location(), EOperatorFlags::internal()); break;
-            case 2: flags.reset(EOperatorFlags::location(), EOperatorFlags::external()); break;
-        }
-        for (int d = 0; d < 3; ++d)
+        std::make_pair(fnReserve, std::string("reserve(") + size->value() + ")"),
+        std::make_pair(fnClear, std::string("clear()")),
+    };
+    for (size_t i = 0; i < sizeof(updates) / sizeof(updates[0]); ++i)
+    {
+        cf::MethodSPtr method = cf::methodRef() << vd
+                                                << columnsNamespace
+                                                << updates[i].first;
+        if (updates[i].first == fnReserve)
+            method << (cf::argumentRef() << st
+                                         << size);
+        fdef()  << method;
+        openBlock(definitionStream);
+        for (it = fields.begin(); it != fields.end(); ++it)
         {
-            switch (d)
-            {
-                case 0: flags.reset(EOperatorFlags::declaration(), EOperatorFlags::native()); break;
-                case 1: flags.reset(EOperatorFlags::declaration(), EOperatorFlags::function()); break;
-                case 2: flags.reset(EOperatorFlags::declaration(), EOperatorFlags::functor()); break;
-            }
+            const FieldSPtr& pField = *it;
 
-            for (int p = 0; p < 2; ++p)
-            {
-                switch (p)
-                {
-                    case 0: flags.reset(EOperatorFlags::parameter(), EOperatorFlags::object()); break;
-                    case 1: flags.reset(EOperatorFlags::parameter(), EOperatorFlags::reference()); break;
-                }
+            line()  << frm->cppMemberName(pField)
+                    << "."
+                    << updates[i].second
+                    << ";";
+            eol(definitionStream);
 
-                generateStructureOperatorMethodsDefinition(pOperator, flags);
+            if (impl->columnAvailability(pField))
+            {
+                line()  << frm->cppColumnsAvailableMemberName(pField)
+                        << "."
+                        << updates[i].second
+                        << ";";
+                eol(definitionStream);
             }
         }
+        closeBlock(definitionStream);
+        eol(definitionStream);
     }
-}
 
-void CppGenerator::generateStructureObjectDefinition(const StructureSPtr& pStructure,
-                                                     const ObjectSPtr& pObject)
-{
-    switch (pObject->runtimeObjectId().value())
+    fdef()  << (cf::methodRef() << vd
+                                << columnsNamespace
+                                << fnPushBack
+                                << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                      << object));
+    openBlock(definitionStream);
+    for (it = fields.begin(); it != fields.end(); ++it)
     {
-        case EObjectId::kField:
-        {
-            FieldSPtr pField = boost::static_pointer_cast<Field>(pObject);
-            generateStructureFieldDefinition(pField);
-            break;
-        }
-        case EObjectId::kFieldOverride:
-        {
-            FieldOverrideSPtr pFieldOverride = boost::static_pointer_cast<FieldOverride>(pObject);
-            generateStructureFieldOverrideDefinition(pFieldOverride);
-            break;
-        }
-        case EObjectId::kIdentification:
-        {
-            IdentificationSPtr pIdentification = boost::static_pointer_cast<Identification>(pObject);
-            generateStructureIdentificationMethodsDefinition(pIdentification);
-            break;
-        }
-        case EObjectId::kUpcopy:
-        {
-            //UpcopySPtr pUpcopy = boost::static_pointer_cast<Upcopy>(pObject);
-            break;
-        }
-        case EObjectId::kOperator:
-        {
-            OperatorSPtr pOperator = boost::static_pointer_cast<Operator>(pObject);
-            generateStructureOperatorMethodsDefinition(pOperator);
-            break;
-        }
-        case EObjectId::kEnumeration:
+        const FieldSPtr& pField = *it;
+
+        std::string member = frm->cppMemberName(pField);
+        std::string value = object->value() + "." + frm->getMethodName(pField)->value() + "()";
+        if (impl->columnAvailability(pField))
         {
-            EnumerationSPtr pEnumeration = boost::static_pointer_cast<Enumeration>(pObject);
-            generateEnumerationDefinition(pEnumeration);
-            break;
+            // the not available values are default constructed, so that
+            // every column keeps the same row indexes
+            std::string available = frm->cppColumnsAvailableMemberName(pField)->value();
+            line()  << available
+                    << ".push_back("
+                    << object
+                    << "."
+                    << (cf::functionCallRef() << frm->availableMethodName(pField))
+                    << ");";
+            eol(definitionStream);
+            line()  << "if ("
+                    << available
+                    << ".back())";
+            eol(definitionStream);
+            line()  << member
+                    << ".push_back("
+                    << value
+                    << ");";
+            eol(definitionStream, 1);
+            line()  << "else";
+            eol(definitionStream);
+            line()  << member
+                    << ".resize("
+                    << member
+                    << ".size() + 1);";
+            eol(definitionStream, 1);
         }
-        case EObjectId::kAlter:
+        else
         {
-            AlterSPtr pAlter = boost::static_pointer_cast<Alter>(pObject);
-            generateStructureFieldConstantDefinition(pStructure,
-                                                     pAlter->field(),
-                                                     pAlter->field()->type()->literal(),
-                                                     pAlter->defaultValue());
-            break;
+            line()  << member
+                    << ".push_back("
+                    << value
+                    << ");";
+            eol(definitionStream);
         }
-        default:
-            assert(false);
     }
-}
+    closeBlock(definitionStream);
+    eol(definitionStream);
 
-void CppGenerator::generateBaseStructureDefinition(const StructureSPtr& pStructure,
-                                                   const StructureSPtr& pBaseStructure)
-{
-    if (!pBaseStructure) return;
+    if (pStructure->isBuildable() && !pStructure->abstract())
+    {
+        cf::VariableNameSPtr builderVariable = cf::variableNameRef("builder");
+        fdef()  << (cf::methodRef() << vd
+                                    << columnsNamespace
+                                    << fnPushBack
+                                    << (cf::argumentRef() << frm->constTypeRef(cf::typeRef() << frm->cppAutoClassNamespace(pStructure)
+                                                                                             << cf::typeNameRef("Builder"))
+                                                          << builderVariable));
+        openBlock(definitionStream);
+        line()  << (cf::functionCallRef() << fnPushBack
+                                          << (cf::parameterValueRef(builderVariable->value() + "." + fnBuild->value() + "()")))
+                << ";";
+        eol(definitionStream);
+        closeBlock(definitionStream);
+        eol(definitionStream);
+    }
 
-    generateBaseStructureDefinition(pStructure, pBaseStructure->baseStructure().lock());
+    fdef()  << (cf::methodRef() << (cf::typeRef() << columnsNamespace
+                                                  << cf::typeNameRef("Row"))
+                                << columnsNamespace
+                                << fnOperatorAt
+                                << (cf::argumentRef() << st
+                                                      << index)
+                                << cf::EMethodDeclaration::const_());
+    openBlock(definitionStream);
+    line()  << "return Row(*this, "
+            << index
+            << ");";
+    eol(definitionStream);
+    closeBlock(definitionStream);
+    eol(definitionStream);
 
-    const std::vector<ObjectSPtr>& objects = pBaseStructure->objects();
-    std::vector<ObjectSPtr>::const_iterator it;
-    for (it = objects.begin(); it != objects.end(); ++it)
+    for (it = fields.begin(); it != fields.end(); ++it)
     {
-        const ObjectSPtr& pObject = *it;
-        switch (pObject->runtimeObjectId().value())
+        const FieldSPtr& pField = *it;
+
+        fdef()  << (cf::methodRef() << frm->constTypeRef(impl->cppColumnType(pField))
+                                    << columnsNamespace
+                                    << frm->getMethodName(pField)
+                                    << cf::EMethodDeclaration::const_());
+        openBlock(definitionStream);
+        line()  << "return "
+                << frm->cppMemberName(pField)
+                << ";";
+        eol(definitionStream);
+        closeBlock(definitionStream);
+        eol(definitionStream);
+
+        if (impl->columnAvailability(pField))
         {
-            case EObjectId::kField:
-            {
-                FieldSPtr pField = boost::static_pointer_cast<Field>(pObject);
-                generateStructureFieldWritingDefinition(pStructure, pField);
-                break;
-            }
-            case EObjectId::kEnumeration:
-            case EObjectId::kFieldOverride:
-            case EObjectId::kIdentification:
-            case EObjectId::kUpcopy:
-            case EObjectId::kOperator:
-                break;
-            default:
-                assert(false);
+            fdef()  << (cf::methodRef() << frm->constTypeRef(impl->cppAvailabilityColumnType())
+                                        << columnsNamespace
+                                        << frm->availableMethodName(pField)
+                                        << cf::EMethodDeclaration::const_());
+            openBlock(definitionStream);
+            line()  << "return "
+                    << frm->cppColumnsAvailableMemberName(pField)
+                    << ";";
+            eol(definitionStream);
+            closeBlock(definitionStream);
+            eol(definitionStream);
         }
     }
 }
@@ -2412,24 +4404,8 @@ void CppGenerator::generateStructureDefinition(const StructureSPtr& pStructure)
 
     const std::vector<ObjectSPtr>& objects = pStructure->objects();
     std::vector<ObjectSPtr>::const_iterator it;
-    if (pStructure->controlled())
-    {
-        for (it = objects.begin(); it != objects.end(); ++it)
-        {
-            FieldSPtr pField = ObjectFactory::downcastField(*it);
-            if (!pField) continue;
 
-            fdef()  << (cf::methodRef() << integer
-                                        << frm->cppAutoClassNamespace(pStructure)
-                                        << frm->bitmaskMethodName(pField));
-            openBlock(definitionStream);
-            line()  << "return "
-                    << frm->bitmask(pField->bitmask())
-                    << ";";
-            closeBlock(definitionStream);
-            eol(definitionStream);
-        }
-    }
+    generateStructureBitmaskMethodsDefinition(pStructure);
 
     cf::NamespaceSPtr structBuilderNamespace = frm->cppAutoClassNamespace(pStructure);
     *structBuilderNamespace << nsBuilder;
@@ -2665,9 +4641,35 @@ void CppGenerator::generateStructureDefinition(const StructureSPtr& pStructure)
                 << ";";
         eol(definitionStream);
 
-        line()  << "return "
-                << impl->cppConvertRawPtr(pStructure, frm->cppRawPtrName("object"))
-                << ";";
+        if (pStructure->interned())
+        {
+            line()  << "return "
+                    << (cf::functionCallRef() << fnInternTable)
+                    << ".intern("
+                    << frm->cppRawPtrName("object")
+                    << ");";
+        }
+        else if (  pStructure->pooled()
+                && (impl->mConfiguration->mPointer == ImplementerConfiguration::use_boost_pointers))
+        {
+            // the control block comes from the pool too
+            addDependency(impl->objectPoolDependency());
+            line()  << "return "
+                    << frm->cppSharedPtrName(pStructure)
+                    << "("
+                    << frm->cppRawPtrName("object")
+                    << ", boost::checked_deleter<"
+                    << frm->cppMainClassType(pStructure)
+                    << ">(), "
+                    << impl->objectPoolAllocator(pStructure)
+                    << "());";
+        }
+        else
+        {
+            line()  << "return "
+                    << impl->cppConvertRawPtr(pStructure, frm->cppRawPtrName("object"))
+                    << ";";
+        }
         eol(definitionStream);
 
         closeBlock(definitionStream);
@@ -2714,6 +4716,11 @@ void CppGenerator::generateStructureDefinition(const StructureSPtr& pStructure)
             cf::initializationRef() << frm->memberVariableName(bits)
                                     << cf::parameterValueRef("0"));
 
+    if (pStructure->tracked() && pStructure->hasField())
+        generateInitialization(
+            cf::initializationRef() << frm->memberVariableName(modified)
+                                    << cf::parameterValueRef("0"));
+
     for (it = objects.begin(); it != objects.end(); ++it)
     {
         generateStructureObjectMemberInitialization(*it);
@@ -2830,50 +4837,7 @@ void CppGenerator::generateStructureDefinition(const StructureSPtr& pStructure)
         }
     }
 
-    if (pStructure->isInitializable())
-    {
-        fdef()  << (cf::methodRef() << bl
-                                    << frm->cppAutoClassNamespace(pStructure)
-                                    << fnIsInitialized
-                                    << cf::EMethodDeclaration::const_());
-        openBlock(definitionStream);
-
-        StructureSPtr pStruct = pBaseStructure;
-        while (pStruct)
-        {
-            if (pStruct->controlled() && pStruct->hasField())
-            {
-                line()  << "if (!"
-                        << (cf::functionCallRef() << frm->cppAutoClassNamespace(pStruct)
-                                                  << fnIsInitialized)
-                        << ") return false;";
-                eol(definitionStream);
-                break;
-            }
-            line()  << "// structure "
-                    << pStruct->name()->value()
-                    << " is not controlled. This function assume it is initilized";
-            eol(definitionStream);
-
-            pStruct = pStruct->baseStructure().lock();
-        }
-
-        for (it = objects.begin(); it != objects.end(); ++it)
-        {
-            FieldSPtr pField = ObjectFactory::downcastField(*it);
-            if (!pField) continue;
-            if (pField->defaultValue()) continue;
-
-            line()  << "if (!"
-                    << (cf::functionCallRef() << frm->validMethodName(pField))
-                    << ") return false;";
-            eol(definitionStream);
-        }
-        line()  << "return true;";
-        eol(definitionStream);
-        closeBlock(definitionStream);
-        eol(definitionStream);
-    }
+    generateStructureIsInitializedMethodDefinition(pStructure);
 
     if (pStructure->isOptional())
     {
@@ -2928,6 +4892,18 @@ void CppGenerator::generateStructureDefinition(const StructureSPtr& pStructure)
 
     if (!pStructure->immutable())
         generateBaseStructureDefinition(pStructure, pBaseStructure);
+
+    if (pStructure->interned())
+        generateStructureInternMethodsDefinition(pStructure);
+
+    if (pStructure->pooled())
+        generateStructurePooledMethodsDefinition(pStructure);
+
+    if (pStructure->tracked())
+        generateStructureTrackedMethodsDefinition(pStructure);
+
+    if (impl->columns(pStructure))
+        generateStructureColumnsDefinition(pStructure);
 }
 
 void CppGenerator::generateObjectDefinition(const ObjectSPtr& pObject)
@@ -2967,11 +4943,49 @@ void CppGenerator::generateObjectDefinition(const ObjectSPtr& pObject)
             generateStructureDefinition(pStructure);
             break;
         }
+        case EObjectId::kInterface:
+        {
+            InterfaceSPtr pInterface = boost::static_pointer_cast<Interface>(pObject);
+            generateInterfaceDefinition(pInterface);
+            break;
+        }
         default:
             assert(false);
     }
 }
 
+bool CppGenerator::generateInlineAccessors()
+{
+    mInlineAccessorsOnly = true;
+
+    const std::vector<ObjectSPtr>& objects = mDocument->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        if ((*it)->sourceId() != mDocument->mainFile()->sourceId())
+            continue;
+        StructureSPtr pStructure = ObjectFactory::downcastStructure(*it);
+        if (!pStructure) continue;
+        if (!impl->inlineAccessors(pStructure)) continue;
+
+        generateStructureBitmaskMethodsDefinition(pStructure);
+        generateStructureIsInitializedMethodDefinition(pStructure);
+
+        const std::vector<ObjectSPtr>& structureObjects = pStructure->objects();
+        std::vector<ObjectSPtr>::const_iterator sit;
+        for (sit = structureObjects.begin(); sit != structureObjects.end(); ++sit)
+        {
+            FieldSPtr pField = ObjectFactory::downcastField(*sit);
+            if (!pField) continue;
+
+            generateStructureFieldDefinition(pField);
+        }
+    }
+
+    mInlineAccessorsOnly = false;
+    return serializeStreams();
+}
+
 bool CppGenerator::generate()
 {
     addDependency(impl->cppHeaderFileDependency(mDocument->sourceId()->original(),
@@ -52,18 +52,30 @@ public:
     
     virtual bool generate();
     
+    // generates only the trivial accessors of the structures as inline
+    // definitions. Used for the header when the accessors are inlined
+    virtual bool generateInlineAccessors();
+    
     virtual void generateEnumerationValueDefinition(const EnumerationValueSPtr& pEnumerationValue);
+    virtual void generateEnumerationFromStringDefinition(const EnumerationSPtr& pEnumeration);
     virtual void generateEnumerationDefinition(const EnumerationSPtr& pEnumeration);
     
     virtual void generateSpecimenDefinition(const SpecimenSPtr& pSpecimen);
     
     virtual void generateFactoryDefinition(const FactorySPtr& pFactory);
+    virtual void generateHierarchyFactoryCloneAllDefinition(const FactorySPtr& pFactory,
+                                                            const EnumerationSPtr& pEnumeration,
+                                                            const std::vector<StructureSPtr>& structs);
     virtual void generateHierarchyFactoryDefinition(const FactorySPtr& pFactory);
     virtual void generateObjectFactoryDefinition(const FactorySPtr& pFactory);
     virtual void generatePluginFactoryDefinition(const FactorySPtr& pFactory);
     
     virtual void generateIdentifierDefinition(const IdentifierSPtr& pIdentifier);
     
+    virtual void generateInterfaceStubDefinition(const MethodSPtr& pMethod);
+    virtual void generateInterfaceDefinition(const InterfaceSPtr& pInterface);
+    virtual void generateInterfaceShmDefinition(const InterfaceSPtr& pInterface);
+    
     virtual void generateInitialization(const cpp::frm::InitializationSPtr& initialization);
     
     virtual void generateStructureFieldMemberInitialization(const FieldSPtr& pField);
@@ -93,6 +105,7 @@ public:
                     const std::string& cast,
                     const std::string& method,
                     bool reverse = false);
+    virtual std::string computeStructureFieldEqualExpression(const FieldSPtr& pField);
     virtual bool generateStructureOperatorAction(
                     const TypeSPtr& pType,
                     const EOperatorAction& action,
@@ -109,6 +122,11 @@ public:
                     const StructureSPtr& pStructure,
                     const OperatorSPtr& pOperator,
                     const EOperatorFlags& flags);
+    virtual void computeStructureCompareTerms(
+                    const StructureSPtr& pStructure,
+                    std::vector<std::pair<std::string, bool> >& terms);
+    virtual bool isStructureCompareEquality(const StructureSPtr& pStructure);
+    virtual void generateStructureCompareMethodDefinition(const StructureSPtr& pStructure);
     virtual void generateStructureOperatorMethodsDefinition(
                     const OperatorSPtr& pOperator,
                     const EOperatorFlags& flags);
@@ -118,6 +136,13 @@ public:
                     
     virtual void generateStructureObjectDefinition(const StructureSPtr& pStructure, const ObjectSPtr& pObject);
     
+    virtual void generateStructureBitmaskMethodsDefinition(const StructureSPtr& pStructure);
+    virtual void generateStructureIsInitializedMethodDefinition(const StructureSPtr& pStructure);
+    virtual void generateStructureInternMethodsDefinition(const StructureSPtr& pStructure);
+    virtual void generateStructurePooledMethodsDefinition(const StructureSPtr& pStructure);
+    virtual void generateStructureTrackedMethodsDefinition(const StructureSPtr& pStructure);
+    virtual void generateStructureColumnsDefinition(const StructureSPtr& pStructure);
+    
     virtual void generateBaseStructureDefinition(const StructureSPtr& pStructure,
                                                  const StructureSPtr& pBaseStructure);
     virtual void generateStructureDefinition(const StructureSPtr& pStructure);
@@ -125,6 +150,11 @@ public:
     virtual void generateObjectDefinition(const ObjectSPtr& pObject);
     
 protected:
+    bool isAccessorGenerated(const StructureSPtr& pStructure);
+    cpp::frm::MethodSPtr accessorRef();
+
+    bool mInlineAccessorsOnly;
+
     static const int copyrightStream;
     static const int includeStream;
     static const int definitionStream;
@@ -31,6 +31,7 @@
 //
 
 #include "generator/cpp/c++_h_generator.h"
+#include "generator/cpp/c++_generator.h"
 #include "generator/c++/implementer_stream.h"
 
 #include "library/c++/boost/exception.h"
@@ -55,6 +56,7 @@ const int CppHeaderGenerator::inlineDefinitionStream = 3;
 const int CppHeaderGenerator::forwardDeclarationStream = 4;
 
 CppHeaderGenerator::CppHeaderGenerator()
+    : mSnapshotDeclaration(false)
 {
     for (int i = 0; i <= 4; ++i)
     {
@@ -93,12 +95,22 @@ void CppHeaderGenerator::generateImport(const ImportSPtr& pImport)
 {
 }
 
-void CppHeaderGenerator::generateForwardClassDeclarations(const TypeSPtr& pType)
+bool CppHeaderGenerator::generateForwardClassDeclaration(const cpp::frm::TypeSPtr& type)
 {
+    // the same class is often needed by several objects of the document
+    if (!mForwardDeclarations.insert(type->name()->value()).second)
+        return false;
+
     line()  << "class "
-            << frm->cppClassType(pType)
+            << type
             << ";";
     eol(forwardDeclarationStream);
+    return true;
+}
+
+void CppHeaderGenerator::generateForwardClassDeclarations(const TypeSPtr& pType)
+{
+    generateForwardClassDeclaration(frm->cppClassType(pType));
 
     table() << TableAligner::row()
             << "typedef "
@@ -230,6 +242,7 @@ void CppHeaderGenerator::generateEnumerationDeclaration(const EnumerationSPtr& p
     addDependencies(impl->dependencies(pEnumeration));
     addDependencies(impl->dependencies(pParameterType));
     addDependencies(impl->classPointerDependencies());
+    addDependency(impl->stddef_dependency());
 
     if (!pEnumeration->structure().lock())
     {
@@ -316,6 +329,21 @@ void CppHeaderGenerator::generateEnumerationDeclaration(const EnumerationSPtr& p
                                 << cf::EMethodDeclaration::const_())
             << ";";
 
+    if (pEnumeration->flags())
+        commentInTable("Returns the enum value with a specified short name or nil if none "
+                       "of the values has this name. The lookup is a perfect hash.");
+    else
+        commentInTable("Returns the enum value with a specified short name or invalid if none "
+                       "of the values has this name. The lookup is a perfect hash.");
+    table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                << innerType
+                                << fnFromString
+                                << (cf::argumentRef() << const_char_ptr
+                                                      << name)
+                                << (cf::argumentRef() << st
+                                                      << size))
+            << ";";
+
     if (pEnumeration->cast() == CastableType::ECast::strong())
     {
         commentInTable("returns true if the value of the enum is equal to the value of the argument");
@@ -786,11 +814,8 @@ void CppHeaderGenerator::generateHierarchyFactoryDeclaration(const FactorySPtr&
     EnumerationSPtr pEnumeration = impl->objectEnumeration(mDocument, pFactory);
     generateEnumerationDeclaration(pEnumeration);
 
-    line()  << "class "
-            << frm->cppClassType(pFactory)
-            << ";";
-    eol(forwardDeclarationStream);
-    eol(forwardDeclarationStream);
+    if (generateForwardClassDeclaration(frm->cppClassType(pFactory)))
+        eol(forwardDeclarationStream);
 
     line()  << "class "
             << frm->cppClassType(pFactory);
@@ -827,6 +852,167 @@ void CppHeaderGenerator::generateHierarchyFactoryDeclaration(const FactorySPtr&
 
     eot(declarationStream);
 
+    if (impl->slabClone(structs))
+    {
+        addDependency(impl->vector_dependency());
+
+        eol(declarationStream);
+        commentInLine(declarationStream,
+                      "Clones all the objects, preserving their order. The objects of the same "
+                      "type are copied together in a contiguous slab. The slab and all its "
+                      "clones are released with the last of them, a surviving clone keeps "
+                      "its siblings alive without running their destructors.");
+        line()  << "static std::vector<"
+                << impl->cppPtrType(pParameterType)
+                << "> "
+                << fnCloneAll
+                << "(const std::vector<"
+                << impl->cppPtrType(pParameterType)
+                << ">& "
+                << objects
+                << ");";
+        eol(declarationStream);
+    }
+
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+
+    generateHierarchyVisitorDeclaration(pFactory);
+}
+
+void CppHeaderGenerator::generateHierarchyVisitorDeclaration(const FactorySPtr& pFactory)
+{
+    StructureSPtr pParameterStructure = ObjectFactory::downcastStructure(pFactory->parameterType().lock());
+    std::vector<StructureSPtr> structs = impl->hierarchie(mDocument,
+                                                          pParameterStructure,
+                                                          &Structure::hasRuntimeIdentification);
+
+    cf::TypeSPtr visitorType = frm->cppVisitorClassType(pParameterStructure);
+    cf::TypeSPtr parameterPtrType = impl->cppPtrDecoratedType(pParameterStructure);
+
+    commentInLine(declarationStream,
+                  "Static visitor of the " + pParameterStructure->name()->value() + " hierarchy. "
+                  "The accept method dispatches the object with a single indirect call through "
+                  "a table indexed by its runtime identification. The derived visitor overrides "
+                  "visit for the structures it handles and brings the rest in scope with a "
+                  "using declaration. The visits it does not override fall back to the visit "
+                  "of the nearest identified base structure.");
+    line()  << "template<class Derived, class Result = void>";
+    eol(declarationStream);
+    line()  << "class "
+            << visitorType;
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+
+    line()  << "Result "
+            << fnAccept->value()
+            << "("
+            << parameterPtrType
+            << " "
+            << object
+            << ")";
+    openBlock(declarationStream);
+    line()  << "typedef Result (*Thunk)(Derived&, "
+            << parameterPtrType
+            << ");";
+    eol(declarationStream);
+    line()  << "// the table follows the values of the identification enumeration";
+    eol(declarationStream);
+    line()  << "static const Thunk thunks[] =";
+    openBlock(declarationStream);
+    line()  << "&thunk<"
+            << frm->cppMainClassType(pParameterStructure)
+            << ">,";
+    eol(declarationStream);
+    std::vector<StructureSPtr>::const_iterator it;
+    for (it = structs.begin(); it != structs.end(); ++it)
+    {
+        line()  << "&thunk<"
+                << frm->cppMainClassType(*it)
+                << ">,";
+        eol(declarationStream);
+    }
+    closeBlock(declarationStream, "};");
+    line()  << "return thunks["
+            << object
+            << "->"
+            << impl->runtimeIdentificationMethodName(pParameterStructure)
+            << "().value()](static_cast<Derived&>(*this), "
+            << object
+            << ");";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "Result "
+            << fnVisit->value()
+            << "("
+            << parameterPtrType
+            << ")";
+    openBlock(declarationStream);
+    line()  << "return Result();";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    for (it = structs.begin(); it != structs.end(); ++it)
+    {
+        StructureSPtr pStructure = *it;
+        if (pStructure == pParameterStructure) continue;
+
+        StructureSPtr pBase = pStructure->baseStructure().lock();
+        while (pBase && (std::find(structs.begin(), structs.end(), pBase) == structs.end()))
+            pBase = pBase->baseStructure().lock();
+        if (!pBase)
+            pBase = pParameterStructure;
+
+        line()  << "Result "
+                << fnVisit->value()
+                << "("
+                << impl->cppPtrDecoratedType(pStructure)
+                << " "
+                << object
+                << ")";
+        openBlock(declarationStream);
+        line()  << "return static_cast<Derived*>(this)->"
+                << fnVisit->value()
+                << "("
+                << impl->cppPtrType(pBase)
+                << "("
+                << object
+                << "));";
+        eol(declarationStream);
+        closeBlock(declarationStream);
+        eol(declarationStream);
+    }
+
+    line()  << "protected:";
+    eol(declarationStream, -1);
+    line()  << "~"
+            << visitorType
+            << "()";
+    openBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "static Result thunk(Derived& visitor, "
+            << parameterPtrType
+            << " "
+            << object
+            << ")";
+    openBlock(declarationStream);
+    line()  << "return visitor."
+            << fnVisit->value()
+            << "(boost::static_pointer_cast<T>("
+            << object
+            << "));";
+    eol(declarationStream);
+    closeBlock(declarationStream);
     closeBlock(declarationStream, "};");
     eol(declarationStream);
 }
@@ -837,11 +1023,8 @@ void CppHeaderGenerator::generateObjectFactoryDeclaration(const FactorySPtr& pFa
 
     if (!pFactory->function())
     {
-        line()  << "class "
-                << frm->cppClassType(pFactory)
-                << ";";
-        eol(forwardDeclarationStream);
-        eol(forwardDeclarationStream);
+        if (generateForwardClassDeclaration(frm->cppClassType(pFactory)))
+            eol(forwardDeclarationStream);
 
         line()  << "class "
                 << frm->cppClassType(pFactory);
@@ -1123,11 +1306,8 @@ void CppHeaderGenerator::generateIdentifierDeclaration(const IdentifierSPtr& pId
 
     addDependencies(impl->dependencies(pParameterType));
 
-    line()  << "class "
-            << frm->cppClassType(pIdentifier)
-            << ";";
-    eol(forwardDeclarationStream);
-    eol(forwardDeclarationStream);
+    if (generateForwardClassDeclaration(frm->cppClassType(pIdentifier)))
+        eol(forwardDeclarationStream);
 
     line()  << "class "
             << frm->cppClassType(pIdentifier);
@@ -1192,120 +1372,428 @@ void CppHeaderGenerator::generateIdentifierDeclaration(const IdentifierSPtr& pId
     eol(declarationStream);
 }
 
-void CppHeaderGenerator::generateStructureIdentificationMethodsDeclaration(
-        const IdentificationSPtr& pIdentification)
+void CppHeaderGenerator::generateInterfaceDeclaration(const InterfaceSPtr& pInterface)
 {
-    switch (pIdentification->type().value())
+    addDependencies(impl->classPointerDependencies());
+    addDependency(impl->asyncQueueDependency());
+
+    cf::TypeSPtr interfaceType = frm->cppInterfaceClassType(pInterface);
+    cf::TypeSPtr proxyType = frm->cppProxyClassType(pInterface);
+
+    std::vector<cf::TypeSPtr> types;
+    types.push_back(interfaceType);
+    types.push_back(proxyType);
+    if (impl->shmTransport(pInterface))
     {
-        case Identification::EType::kRuntime:
-            generateStructureRuntimeIdentificationMethodsDeclaration(pIdentification);
-            break;
-        case Identification::EType::kInproc:
-            generateStructureInprocIdentificationMethodsDeclaration(pIdentification);
-            break;
-        default:
-            assert(false);
+        types.push_back(frm->cppShmClientClassType(pInterface));
+        types.push_back(frm->cppShmServerClassType(pInterface));
     }
-}
+    for (size_t i = 0; i < types.size(); ++i)
+    {
+        generateForwardClassDeclaration(types[i]);
 
-void CppHeaderGenerator::generateStructureRuntimeIdentificationMethodsDeclaration(
-        const IdentificationSPtr& pIdentification)
-{
-    StructureSPtr pStructure = pIdentification->structure().lock();
-    StructureSPtr pBaseStructure = pStructure->recursivelyBaseStructure();
+        table() << TableAligner::row()
+                << "typedef "
+                << TableAligner::col()
+                << (cf::typeRef() << types[i]->name()
+                                  << cf::ETypeDecoration::pointer())
+                << " "
+                << TableAligner::col()
+                << frm->cppRawPtrName(types[i]->name()->value())
+                << ";";
 
-    line()  << "class "
-            << impl->identificationEnum(pBaseStructure)
-            << ";";
-    eol(forwardDeclarationStream);
-    eol(forwardDeclarationStream);
+        if (impl->boost_smart_ptr_needed())
+        {
+            table() << TableAligner::row()
+                    << "typedef "
+                    << TableAligner::col()
+                    << impl->boost_shared_ptr(types[i])
+                    << " "
+                    << TableAligner::col()
+                    << frm->cppSharedPtrName(types[i]->name()->value())
+                    << ";";
 
-    table() << TableAligner::row();
+            table() << TableAligner::row()
+                    << "typedef "
+                    << TableAligner::col()
+                    << impl->boost_weak_ptr(types[i])
+                    << " "
+                    << TableAligner::col()
+                    << frm->cppWeakPtrName(types[i]->name()->value())
+                    << ";";
+        }
+        eot(forwardDeclarationStream);
+        eol(forwardDeclarationStream);
+    }
 
-    commentInTable(
-            "Identifier for the objects from " + frm->cppMainClassType(pStructure)->name()->value() + " class.");
-    commentInTable(
-            "Note: it is not defined in the "
-            "respective cpp file. Instead it is defined in the factory class together with "
-            "all the other identifiers of the other class objects. This allows all identifiers "
-            "to be maintained from a single place, which reduces the risk of value collisions");
+    std::vector<MethodSPtr> methods;
+    const std::vector<ObjectSPtr>& objects = pInterface->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        MethodSPtr pMethod = ObjectFactory::downcastMethod(*it);
+        if (pMethod)
+            methods.push_back(pMethod);
+    }
 
-    table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
-                                << impl->identificationEnum(pBaseStructure)
-                                << impl->staticIdentificationMethodName(pBaseStructure))
-            << ";";
+    std::vector<MethodSPtr>::const_iterator mit;
+    for (mit = methods.begin(); mit != methods.end(); ++mit)
+    {
+        const std::vector<ObjectSPtr>& parameters = (*mit)->objects();
+        for (it = parameters.begin(); it != parameters.end(); ++it)
+        {
+            ParameterSPtr pParameter = ObjectFactory::downcastParameter(*it);
+            if (pParameter)
+                addDependencies(impl->dependencies(pParameter->type()));
+        }
+    }
 
-    commentInTable(
-            "This virtual method provides runtime object identification based on the polymorphic "
-            "behavior of the virtual methods. Allows having a RTTI like mechanism significantly "
-            "cheaper than the RTTI provided by the compilers themselves.");
+    if (pInterface->comment())
+        commentInLine(declarationStream, pInterface->comment());
+    line()  << "class "
+            << interfaceType;
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
 
-    table() << (cf::methodRef() << cf::EMethodSpecifier::virtual_()
-                                << impl->identificationEnum(pBaseStructure)
-                                << impl->runtimeIdentificationMethodName(pBaseStructure)
-                                << cf::EMethodDeclaration::const_())
+    commentInTable("Destructor");
+    table() << (cf::destructorRef() << cf::EDestructorSpecifier::virtual_()
+                                    << frm->cppInterfaceDestructorName(pInterface))
             << ";";
-}
-
-void CppHeaderGenerator::generateStructureInprocIdentificationMethodsDeclaration(
-        const IdentificationSPtr& pIdentification)
-{
-    StructureSPtr pStructure = pIdentification->structure().lock();
-
-    table() << TableAligner::row();
 
-    if (!pStructure->abstract())
+    for (mit = methods.begin(); mit != methods.end(); ++mit)
     {
-        std::vector<FactorySPtr> factories = mDocument->findPluginFactories(pStructure);
-        for (std::vector<FactorySPtr>::iterator it = factories.begin(); it != factories.end(); ++it)
-        {
-            const FactorySPtr& factory = *it;
-            StructureSPtr pParameterType = Structure::downcast(factory->parameterType().lock());
+        const MethodSPtr& pMethod = *mit;
 
-            commentInTable(
-                "Static clone method that implements the plugin factory " + factory->name()->value() +
-                " clone function prototype. It will be registered in the factory for potential use from its"
-                " clone method. Most likely you will never need to use this method from anywhere else.");
-            table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
-                                        << frm->cppRawPtrDecoratedType(pParameterType)
-                                        << fnClone
-                                        << (cf::argumentRef() << impl->cppDecoratedType(pParameterType)
-                                                              << object))
-                    << ";";
+        table() << TableAligner::row();
+        if (pMethod->comment())
+            commentInTable(pMethod->comment());
+        cf::MethodSPtr method = cf::methodRef() << cf::EMethodSpecifier::virtual_()
+                                                << vd
+                                                << frm->cppMethodName(pMethod);
+        const std::vector<ObjectSPtr>& parameters = pMethod->objects();
+        for (it = parameters.begin(); it != parameters.end(); ++it)
+        {
+            ParameterSPtr pParameter = ObjectFactory::downcastParameter(*it);
+            if (!pParameter) continue;
+            method << (cf::argumentRef() << impl->cppParameterDecoratedType(pParameter)
+                                         << frm->cppVariableName(pParameter));
         }
+        table() << method
+                << " = 0;";
     }
+    eot(declarationStream);
 
-    commentInTable(
-            "Inproc identifier for the objects from " +
-            frm->cppMainClassType(pStructure)->name()->value() + " class.");
-    commentInTable(
-            "Note: this identificator is unique just for the process session. "
-            "There is no guarantee that the id will be the same from session to session. "
-            "Do not use for serialization.");
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
 
-    table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
-                                << st
-                                << impl->staticMethodName(fnInprocId->value()))
+    cf::TypeSPtr targetType = impl->boost_smart_ptr_needed()
+                            ? cf::typeRef() << cf::typeNameRef(frm->cppSharedPtrName(interfaceType->name()->value()))
+                            : cf::typeRef() << cf::typeNameRef(frm->cppRawPtrName(interfaceType->name()->value()));
+
+    commentInLine(declarationStream,
+                  "Proxy of the " + interfaceType->name()->value() + " interface. The calls are "
+                  "marshalled into the queue and dispatched on its worker thread in the order "
+                  "they are made. The methods with out or io parameters wait for the dispatch, "
+                  "the rest return as soon as the call is queued.");
+    line()  << "class "
+            << proxyType
+            << " : public "
+            << interfaceType;
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+
+    commentInTable("Constructor. The calls are dispatched to the target on the worker of the queue");
+    table() << (cf::constructorRef() << frm->cppProxyConstructorName(pInterface)
+                                     << (cf::argumentRef() << frm->constTypeRef(targetType)
+                                                           << target)
+                                     << (cf::argumentRef() << impl->asyncQueue()
+                                                           << queue))
             << ";";
 
-    commentInTable(
-            "This virtual method provides runtime inproc object identification based on the polymorphic "
-            "behavior of the virtual methods. Allows having a RTTI like mechanism significantly "
-            "cheaper than the RTTI provided by the compilers themselves.");
-    table() << (cf::methodRef() << cf::EMethodSpecifier::virtual_()
-                                << st
-                                << impl->runtimeMethodName(fnInprocId->value())
-                                << cf::EMethodDeclaration::const_())
+    for (mit = methods.begin(); mit != methods.end(); ++mit)
+    {
+        const MethodSPtr& pMethod = *mit;
+
+        table() << TableAligner::row();
+        cf::MethodSPtr method = cf::methodRef() << cf::EMethodSpecifier::virtual_()
+                                                << vd
+                                                << frm->cppMethodName(pMethod);
+        const std::vector<ObjectSPtr>& parameters = pMethod->objects();
+        for (it = parameters.begin(); it != parameters.end(); ++it)
+        {
+            ParameterSPtr pParameter = ObjectFactory::downcastParameter(*it);
+            if (!pParameter) continue;
+            method << (cf::argumentRef() << impl->cppParameterDecoratedType(pParameter)
+                                         << frm->cppVariableName(pParameter));
+        }
+        table() << method
+                << ";";
+    }
+    eot(declarationStream);
+
+    line()  << "private:";
+    eol(declarationStream, -1);
+    table() << TableAligner::row()
+            << targetType
+            << " "
+            << TableAligner::col()
+            << frm->memberVariableName(target)
+            << ";";
+    table() << TableAligner::row()
+            << impl->asyncQueue()
+            << " "
+            << TableAligner::col()
+            << frm->memberVariableName(queue)
             << ";";
+    eot(declarationStream);
+
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+
+    if (impl->shmTransport(pInterface))
+        generateInterfaceShmDeclaration(pInterface);
 }
 
-void CppHeaderGenerator::generateStructureOperatorMethodsDeclaration(
-                    const OperatorSPtr& pOperator,
-                    const EOperatorFlags& flags,
-                    bool& declaredFunctor)
+void CppHeaderGenerator::generateInterfaceShmDeclaration(const InterfaceSPtr& pInterface)
 {
-    if (!pOperator->flags().isSet(flags))
-        return;
+    addDependency(impl->shmChannelDependency());
+
+    cf::TypeSPtr interfaceType = frm->cppInterfaceClassType(pInterface);
+    cf::TypeSPtr clientType = frm->cppShmClientClassType(pInterface);
+    cf::TypeSPtr serverType = frm->cppShmServerClassType(pInterface);
+    cf::TypeSPtr channelType = cf::typeRef() << cf::typeNameRef("shm_channel")
+                                             << cf::ETypeDecoration::reference();
+
+    commentInLine(declarationStream,
+                  "Client of the " + interfaceType->name()->value() + " interface in another "
+                  "process. The arguments of the calls are written directly in the request ring "
+                  "of the channel. The methods with out or io parameters wait for the response "
+                  "of the server, the rest return as soon as the request is committed. The waits "
+                  "throw shm_timeout_error after the timeout of the channel.");
+    line()  << "class "
+            << clientType
+            << " : public "
+            << interfaceType;
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+
+    commentInTable("Constructor. The channel should be opened on the client side");
+    table() << (cf::constructorRef() << frm->cppShmClientConstructorName(pInterface)
+                                     << (cf::argumentRef() << channelType
+                                                           << channel))
+            << ";";
+
+    const std::vector<ObjectSPtr>& objects = pInterface->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        MethodSPtr pMethod = ObjectFactory::downcastMethod(*it);
+        if (!pMethod) continue;
+
+        table() << TableAligner::row();
+        cf::MethodSPtr method = cf::methodRef() << cf::EMethodSpecifier::virtual_()
+                                                << vd
+                                                << frm->cppMethodName(pMethod);
+        const std::vector<ObjectSPtr>& parameters = pMethod->objects();
+        std::vector<ObjectSPtr>::const_iterator pit;
+        for (pit = parameters.begin(); pit != parameters.end(); ++pit)
+        {
+            ParameterSPtr pParameter = ObjectFactory::downcastParameter(*pit);
+            if (!pParameter) continue;
+            method << (cf::argumentRef() << impl->cppParameterDecoratedType(pParameter)
+                                         << frm->cppVariableName(pParameter));
+        }
+        table() << method
+                << ";";
+    }
+    eot(declarationStream);
+
+    line()  << "private:";
+    eol(declarationStream, -1);
+    table() << TableAligner::row()
+            << channelType
+            << " "
+            << TableAligner::col()
+            << frm->memberVariableName(channel)
+            << ";";
+    eot(declarationStream);
+
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+
+    cf::TypeSPtr targetType = impl->boost_smart_ptr_needed()
+                            ? cf::typeRef() << cf::typeNameRef(frm->cppSharedPtrName(interfaceType->name()->value()))
+                            : cf::typeRef() << cf::typeNameRef(frm->cppRawPtrName(interfaceType->name()->value()));
+
+    commentInLine(declarationStream,
+                  "Server of the " + interfaceType->name()->value() + " interface for a client "
+                  "in another process. It reads the requests from the channel and dispatches "
+                  "them to the target on the thread that calls it. The string and vector "
+                  "arguments are copied out of the ring once, because the methods of the "
+                  "interface take them as std::string and std::vector.");
+    line()  << "class "
+            << serverType;
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+
+    commentInTable("Constructor. The channel should be opened on the server side");
+    table() << (cf::constructorRef() << frm->cppShmServerConstructorName(pInterface)
+                                     << (cf::argumentRef() << frm->constTypeRef(targetType)
+                                                           << target)
+                                     << (cf::argumentRef() << channelType
+                                                           << channel))
+            << ";";
+    eot(declarationStream);
+    eol(declarationStream);
+
+    commentInTable("Dispatches the oldest request. Returns false if there is none");
+    table() << (cf::methodRef() << bl
+                                << fnDispatch)
+            << ";";
+    eot(declarationStream);
+    eol(declarationStream);
+
+    commentInTable("Dispatches the pending requests. Returns the count of the dispatched ones");
+    table() << (cf::methodRef() << st
+                                << fnProcess)
+            << ";";
+    eot(declarationStream);
+
+    line()  << "private:";
+    eol(declarationStream, -1);
+    table() << TableAligner::row()
+            << targetType
+            << " "
+            << TableAligner::col()
+            << frm->memberVariableName(target)
+            << ";";
+    table() << TableAligner::row()
+            << channelType
+            << " "
+            << TableAligner::col()
+            << frm->memberVariableName(channel)
+            << ";";
+    eot(declarationStream);
+
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+void CppHeaderGenerator::generateStructureIdentificationMethodsDeclaration(
+        const IdentificationSPtr& pIdentification)
+{
+    switch (pIdentification->type().value())
+    {
+        case Identification::EType::kRuntime:
+            generateStructureRuntimeIdentificationMethodsDeclaration(pIdentification);
+            break;
+        case Identification::EType::kInproc:
+            generateStructureInprocIdentificationMethodsDeclaration(pIdentification);
+            break;
+        default:
+            assert(false);
+    }
+}
+
+void CppHeaderGenerator::generateStructureRuntimeIdentificationMethodsDeclaration(
+        const IdentificationSPtr& pIdentification)
+{
+    StructureSPtr pStructure = pIdentification->structure().lock();
+    StructureSPtr pBaseStructure = pStructure->recursivelyBaseStructure();
+
+    if (generateForwardClassDeclaration(impl->identificationEnum(pBaseStructure)))
+        eol(forwardDeclarationStream);
+
+    table() << TableAligner::row();
+
+    commentInTable(
+            "Identifier for the objects from " + frm->cppMainClassType(pStructure)->name()->value() + " class.");
+    commentInTable(
+            "Note: it is not defined in the "
+            "respective cpp file. Instead it is defined in the factory class together with "
+            "all the other identifiers of the other class objects. This allows all identifiers "
+            "to be maintained from a single place, which reduces the risk of value collisions");
+
+    table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                << impl->identificationEnum(pBaseStructure)
+                                << impl->staticIdentificationMethodName(pBaseStructure))
+            << ";";
+
+    commentInTable(
+            "This virtual method provides runtime object identification based on the polymorphic "
+            "behavior of the virtual methods. Allows having a RTTI like mechanism significantly "
+            "cheaper than the RTTI provided by the compilers themselves.");
+
+    table() << (cf::methodRef() << cf::EMethodSpecifier::virtual_()
+                                << impl->identificationEnum(pBaseStructure)
+                                << impl->runtimeIdentificationMethodName(pBaseStructure)
+                                << cf::EMethodDeclaration::const_())
+            << ";";
+}
+
+void CppHeaderGenerator::generateStructureInprocIdentificationMethodsDeclaration(
+        const IdentificationSPtr& pIdentification)
+{
+    StructureSPtr pStructure = pIdentification->structure().lock();
+
+    table() << TableAligner::row();
+
+    if (!pStructure->abstract())
+    {
+        std::vector<FactorySPtr> factories = mDocument->findPluginFactories(pStructure);
+        for (std::vector<FactorySPtr>::iterator it = factories.begin(); it != factories.end(); ++it)
+        {
+            const FactorySPtr& factory = *it;
+            StructureSPtr pParameterType = Structure::downcast(factory->parameterType().lock());
+
+            commentInTable(
+                "Static clone method that implements the plugin factory " + factory->name()->value() +
+                " clone function prototype. It will be registered in the factory for potential use from its"
+                " clone method. Most likely you will never need to use this method from anywhere else.");
+            table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                        << frm->cppRawPtrDecoratedType(pParameterType)
+                                        << fnClone
+                                        << (cf::argumentRef() << impl->cppDecoratedType(pParameterType)
+                                                              << object))
+                    << ";";
+        }
+    }
+
+    commentInTable(
+            "Inproc identifier for the objects from " +
+            frm->cppMainClassType(pStructure)->name()->value() + " class.");
+    commentInTable(
+            "Note: this identificator is unique just for the process session. "
+            "There is no guarantee that the id will be the same from session to session. "
+            "Do not use for serialization.");
+
+    table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                << st
+                                << impl->staticMethodName(fnInprocId->value()))
+            << ";";
+
+    commentInTable(
+            "This virtual method provides runtime inproc object identification based on the polymorphic "
+            "behavior of the virtual methods. Allows having a RTTI like mechanism significantly "
+            "cheaper than the RTTI provided by the compilers themselves.");
+    table() << (cf::methodRef() << cf::EMethodSpecifier::virtual_()
+                                << st
+                                << impl->runtimeMethodName(fnInprocId->value())
+                                << cf::EMethodDeclaration::const_())
+            << ";";
+}
+
+void CppHeaderGenerator::generateStructureOperatorMethodsDeclaration(
+                    const OperatorSPtr& pOperator,
+                    const EOperatorFlags& flags,
+                    bool& declaredFunctor)
+{
+    if (!pOperator->flags().isSet(flags))
+        return;
 
     table() << TableAligner::row();
 
@@ -1398,6 +1886,21 @@ void CppHeaderGenerator::generateStructureOperatorMethodsDeclaration(
 void CppHeaderGenerator::generateStructureOperatorMethodsDeclaration(
                     const OperatorSPtr& pOperator)
 {
+    StructureSPtr pStructure = pOperator->structure().lock();
+    if (pOperator == impl->compareOperator(pStructure))
+    {
+        table() << TableAligner::row();
+        commentInTable("Three-way comparison of the fields. Returns a negative value, zero or a "
+                       "positive value if this object is less than, equal to or greater than the "
+                       "given one. The comparison operators of the structure are built on it.");
+        table() << (cf::methodRef() << integer
+                                    << fnCompare
+                                    << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                          << object)
+                                    << cf::EMethodDeclaration::const_())
+                << ";";
+    }
+
     EOperatorFlags flags;
     for (int l = 0; l < 3; ++l)
     {
@@ -1442,12 +1945,19 @@ void CppHeaderGenerator::generateStructureFieldMemberDeclaration(const FieldSPtr
 {
     StructureSPtr pStructure = pField->structure().lock();
 
-    addDependencies(impl->dependencies(pField));
+    addDependencies(impl->declarationDependencies(pField));
+
+    cf::TypeSPtr type = impl->cppInnerType(pField->type(), pStructure);
+    if (impl->sharedStorage(pField))
+    {
+        addDependency(impl->sharedValueDependency());
+        type = impl->sharedValue(type);
+    }
 
     commentInTable("variable for the data field " + pField->name()->value());
 
     table() << TableAligner::row()
-            << impl->cppInnerType(pField->type(), pStructure)
+            << type
             << ' '
             << TableAligner::col()
             << frm->cppMemberName(pField)
@@ -1534,6 +2044,17 @@ void CppHeaderGenerator::generateStructureFieldMethodsDeclaration(const Structur
                     << ";";
         }
 
+        if (pStructure->tracked())
+        {
+            commentInTable(
+                "Returns true if the data field " + pField->name()->value() +
+                " was modified since the last " + fnCheckpoint->value() + "()");
+            table() << (cf::methodRef() << bl
+                                        << frm->modifiedMethodName(pField)
+                                        << cf::EMethodDeclaration::const_())
+                    << ";";
+        }
+
         if (pField->defaultValue() && !pField->defaultValue()->optional())
         {
             commentInTable(
@@ -1598,7 +2119,8 @@ void CppHeaderGenerator::generateStructureFieldMethodsDeclaration(const Structur
                     << ";";
 
             UnaryContainerSPtr pUnaryContainer = ObjectFactory::downcastUnaryContainer(pField->type());
-            if (pUnaryContainer)
+            // the fixed containers are not extendable
+            if (pUnaryContainer && (pUnaryContainer->size() != UnaryContainer::ESize::fixed()))
             {
                 cf::TypeSPtr type = impl->cppInnerSetDecoratedType(pUnaryContainer->parameterType().lock(),
                                                                    pCurrStructure);
@@ -1655,7 +2177,7 @@ void CppHeaderGenerator::generateStructureFieldOverrideMethodsDeclaration(const
     const FieldSPtr& pField = pFieldOverride->field();
     StructureSPtr pStructure = pField->structure().lock();
 
-    addDependencies(impl->dependencies(pField));
+    addDependencies(impl->declarationDependencies(pField));
 
 
     if (mg.isSet(EMethodGroup::reading()) && mg.isClear(EMethodGroup::special()))
@@ -2040,6 +2562,14 @@ void CppHeaderGenerator::generateStructureDeclaration(const StructureSPtr& pStru
             "the builder status. Once " + fnFinalize->value() + "() is called, the builder can not be used again. "
             "Use " + fnFinalize->value() + "() when you no longer are going to use this builder.");
 
+        if (pStructure->interned())
+        {
+            commentInTable(
+                "Note: " + frm->cppMainClassType(pStructure)->name()->value() + " is interned - " +
+                fnFinalize->value() + "() provides the already interned instance with the same fields "
+                "if there is one.");
+        }
+
         table() << (cf::methodRef() << impl->cppPtrType(pStructure)
                                     << fnFinalize)
                 << ";";
@@ -2193,9 +2723,192 @@ void CppHeaderGenerator::generateStructureDeclaration(const StructureSPtr& pStru
     }
 
     generateBaseStructureDeclaration(pStructure, pBaseStructure, EMethodGroup::nil());
+
+    if (pStructure->interned())
+    {
+        encapsulateInTable("public");
+        table() << TableAligner::row();
+
+        commentInTable("Returns hash of all the fields. Used by the intern table.");
+        table() << (cf::methodRef() << st
+                                    << fnInternHash
+                                    << cf::EMethodDeclaration::const_())
+                << ";";
+
+        commentInTable(
+            "Returns true if all the fields are equal. Used by the intern table. "
+            "Note: The interned instances are unique, so two instances provided by " +
+            fnFinalize->value() + "() are equal only if they are the same instance.");
+        table() << (cf::methodRef() << bl
+                                    << fnInternEquals
+                                    << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                          << object)
+                                    << cf::EMethodDeclaration::const_())
+                << ";";
+
+        table() << TableAligner::row();
+
+        commentInTable("Returns the number of the interned instances that are still referenced");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << st
+                                    << fnInternTableSize)
+                << ";";
+
+        commentInTable("Returns the number of the " + fnFinalize->value() + "() calls");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << st
+                                    << fnInternTableLookups)
+                << ";";
+
+        commentInTable(
+            "Returns the number of the " + fnFinalize->value() + "() calls that provided "
+            "an already interned instance");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << st
+                                    << fnInternTableHits)
+                << ";";
+
+        commentInTable("Returns the ratio between the hits and the lookups of the intern table");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << dbl
+                                    << fnInternTableHitRatio)
+                << ";";
+    }
+
+    if (pStructure->pooled())
+    {
+        encapsulateInTable("public");
+        table() << TableAligner::row();
+
+        commentInTable(
+            "Allocates the instances from the per-thread free list pool of the class. "
+            "The instances of the derived classes that have other size come from the heap.");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << vdPtr
+                                    << fnOperatorNew
+                                    << (cf::argumentRef() << st
+                                                          << size))
+                << ";";
+
+        commentInTable(
+            "Returns the instance to the pool of the thread that allocated it");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << vd
+                                    << fnOperatorDelete
+                                    << (cf::argumentRef() << vdPtr
+                                                          << object)
+                                    << (cf::argumentRef() << st
+                                                          << size))
+                << ";";
+
+        table() << TableAligner::row();
+
+        commentInTable("Returns the number of the running threads that allocated instances");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << st
+                                    << fnPoolThreads)
+                << ";";
+
+        commentInTable("Returns the number of the pool blocks taken from the heap");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << st
+                                    << fnPoolBlocks)
+                << ";";
+
+        commentInTable("Returns the number of the pool blocks that are free for reuse");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << st
+                                    << fnPoolAvailable)
+                << ";";
+
+        commentInTable(
+            "Returns the number of the pool blocks that hold instances. It is approximate "
+            "while other threads allocate or release instances.");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << st
+                                    << fnPoolUsed)
+                << ";";
+    }
+
+    if (pStructure->tracked())
+    {
+        encapsulateInTable("public");
+        table() << TableAligner::row();
+
+        commentInTable("Returns true if any of the fields was modified since the last " +
+                       fnCheckpoint->value() + "()");
+        table() << (cf::methodRef() << bl
+                                    << fnIsModified
+                                    << cf::EMethodDeclaration::const_())
+                << ";";
+
+        commentInTable("Forgets the modifications of the fields recorded so far");
+        table() << (cf::methodRef() << vd
+                                    << fnCheckpoint)
+                << ";";
+
+        if (!pStructure->abstract())
+        {
+            commentInTable(
+                "Returns a delta that holds only the fields of " + object2->value() +
+                " that differ from " + object1->value() + ". They are marked as modified");
+            table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                        << impl->cppType(pStructure)
+                                        << fnDiff
+                                        << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                              << object1)
+                                        << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                              << object2))
+                    << ";";
+        }
+
+        commentInTable(
+            "Sets or clears the fields marked as modified in the " + delta->value() + ". "
+            "The other fields are not touched");
+        table() << (cf::methodRef() << vd
+                                    << fnApplyDelta
+                                    << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                          << delta))
+                << ";";
+    }
+
     if (!table().isEmpty())
         eot(declarationStream);
 
+    if (pStructure->tracked())
+    {
+        eol(declarationStream);
+        encapsulateInTable("protected");
+        commentInTable("Sets in the " + delta->value() + " only the fields of the " + object->value() +
+                       " that differ from this instance");
+        table() << (cf::methodRef() << vd
+                                    << fnCopyDifferences
+                                    << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                          << object)
+                                    << (cf::argumentRef() << frm->typeRef(impl->cppType(pStructure))
+                                                          << delta)
+                                    << cf::EMethodDeclaration::const_())
+                << ";";
+        eot(declarationStream);
+    }
+
+    if (pStructure->interned())
+    {
+        addDependency(impl->internTableDependency());
+
+        eol(declarationStream);
+        encapsulateInTable("private");
+        commentInTable(
+            "Holds the canonical instances provided by " + fnFinalize->value() + "(). "
+            "The table is never destroyed, because the instances could outlive the "
+            "static objects.");
+        table() << (cf::methodRef() << cf::EMethodSpecifier::static_()
+                                    << impl->internTable(pStructure)
+                                    << fnInternTable)
+                << ";";
+        eot(declarationStream);
+    }
+
     if (pStructure->hasField())
     {
         eol(declarationStream);
@@ -2226,6 +2939,17 @@ void CppHeaderGenerator::generateStructureDeclaration(const StructureSPtr& pStru
                     << TableAligner::col()
                     << frm->memberName("bits")
                     << ";";
+
+            if (pStructure->tracked())
+            {
+                commentInTable("Stores the fields modified since the last " + fnCheckpoint->value() + "()");
+
+                table() << TableAligner::row()
+                        <<  "int "
+                        << TableAligner::col()
+                        << frm->memberName("modified")
+                        << ";";
+            }
             table() << TableAligner::row();
         }
 
@@ -2249,9 +2973,26 @@ void CppHeaderGenerator::generateStructureDeclaration(const StructureSPtr& pStru
                                     << frm->cppSharedPtrName(pStructure)
                                     << frm->methodName(frm->cppRefName(pStructure->name()->value())));
         openBlock(inlineDefinitionStream);
-        line()  << "return boost::make_shared<"
-                << frm->cppMainClassType(pStructure)
-                << ">();";
+        if (pStructure->pooled())
+        {
+            // the object comes from the pool of the class, the control block from its own pool
+            addDependency(impl->objectPoolDependency());
+            line()  << "return "
+                    << frm->cppSharedPtrName(pStructure)
+                    << "(new "
+                    << frm->cppMainClassType(pStructure)
+                    << "(), boost::checked_deleter<"
+                    << frm->cppMainClassType(pStructure)
+                    << ">(), "
+                    << impl->objectPoolAllocator(pStructure)
+                    << "());";
+        }
+        else
+        {
+            line()  << "return boost::make_shared<"
+                    << frm->cppMainClassType(pStructure)
+                    << ">();";
+        }
         closeBlock(inlineDefinitionStream);
         eol(inlineDefinitionStream);
 
@@ -2273,7 +3014,8 @@ void CppHeaderGenerator::generateStructureDeclaration(const StructureSPtr& pStru
                     << ";";
 
             UnaryContainerSPtr pUnaryContainer = ObjectFactory::downcastUnaryContainer(pField->type());
-            if (pUnaryContainer)
+            // the fixed containers are not extendable
+            if (pUnaryContainer && (pUnaryContainer->size() != UnaryContainer::ESize::fixed()))
             {
                 cf::TypeSPtr type = impl->cppSetDecoratedType(pUnaryContainer->parameterType().lock());
                 commentInTable("Reference store operator for an item of data field " + pField->name()->value());
@@ -2287,6 +3029,236 @@ void CppHeaderGenerator::generateStructureDeclaration(const StructureSPtr& pStru
         eot(declarationStream);
         eol(declarationStream);
     }
+
+    if (pStructure->immutable())
+    if (impl->mConfiguration->mPointer == ImplementerConfiguration::use_boost_pointers)
+    {
+        // the template is only declared, the header of the core template
+        // is included where the holder is used. It is still a dependency,
+        // so the core template is generated.
+        addDependency(impl->snapshotDependency());
+        excludeDependency(impl->snapshotDependency());
+        mSnapshotDeclaration = true;
+
+        commentInLine(declarationStream,
+            "Holder of the current " + frm->cppClassType(pStructure)->name()->value() + " "
+            "shared between threads. The readers get the current object wait-free through "
+            "a view, the writers publish the results of Builder::finalize(). It needs the "
+            "core snapshot header.");
+        line()  << "typedef snapshot<"
+                << frm->cppClassType(pStructure)
+                << "> "
+                << frm->cppSnapshotClassType(pStructure)
+                << ";";
+        eol(declarationStream);
+        eol(declarationStream);
+    }
+
+    if (impl->columns(pStructure))
+        generateStructureColumnsDeclaration(pStructure);
+}
+
+void CppHeaderGenerator::generateStructureColumnsDeclaration(const StructureSPtr& pStructure)
+{
+    addDependency(impl->vector_dependency());
+
+    std::vector<FieldSPtr> fields = pStructure->combinedFields();
+    std::vector<FieldSPtr>::const_iterator it;
+
+    std::string structureName = frm->cppMainClassType(pStructure)->name()->value();
+    std::string columnsName = frm->cppColumnsClassType(pStructure)->name()->value();
+
+    commentInLine(declarationStream,
+        columnsName + " holds " + structureName + " objects column by column - one contiguous "
+        "array per data field. Use it for large collections that are scanned one or two "
+        "fields at a time. Such scan touches only the memory of the columns it reads.");
+    eol(declarationStream);
+    commentInLine(declarationStream,
+        "The availability of the optional fields is kept in packed bitmaps with one bit "
+        "per row. The boolean fields are kept as bytes, so that every column is contiguous.");
+    eol(declarationStream);
+
+    line()  << "class "
+            << frm->cppColumnsClassType(pStructure);
+    openBlock(declarationStream);
+
+    mEncapsulation.clear();
+    encapsulateInLine(declarationStream, "public");
+
+    commentInLine(declarationStream, "Read only proxy of a single row");
+    line()  << "class Row";
+    openBlock(declarationStream);
+
+    table() << TableAligner::row_line(-1)
+            << "public:";
+
+    commentInTable("Proxy of the row index of the columns");
+    table() << (cf::constructorRef() << rowConstructorName
+                                     << (cf::argumentRef() << frm->constTypeRef(frm->cppColumnsClassType(pStructure))
+                                                           << columns)
+                                     << (cf::argumentRef() << st
+                                                           << index))
+            << ";";
+
+    for (it = fields.begin(); it != fields.end(); ++it)
+    {
+        const FieldSPtr& pField = *it;
+
+        table() << TableAligner::row();
+        commentInTable("Getter method for the data field " + pField->name()->value());
+        table() << (cf::methodRef() << impl->cppDecoratedType(pField->type())
+                                    << frm->getMethodName(pField)
+                                    << cf::EMethodDeclaration::const_())
+                << ";";
+
+        if (impl->columnAvailability(pField))
+        {
+            commentInTable("Returns true if the data field " + pField->name()->value() +
+                           " is available in the row");
+            table() << (cf::methodRef() << bl
+                                        << frm->availableMethodName(pField)
+                                        << cf::EMethodDeclaration::const_())
+                    << ";";
+        }
+    }
+
+    table() << TableAligner::row_line(-1)
+            << "private:";
+    table() << TableAligner::row()
+            << frm->constTypeRef(frm->cppColumnsClassType(pStructure))
+            << ' '
+            << TableAligner::col()
+            << frm->memberName("columns")
+            << ";";
+    table() << TableAligner::row()
+            << st
+            << ' '
+            << TableAligner::col()
+            << frm->memberName("index")
+            << ";";
+    eot(declarationStream);
+
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+
+    commentInTable("Default constructor");
+    table() << (cf::constructorRef() << frm->cppColumnsConstructorName(pStructure))
+            << ";";
+
+    commentInTable("Destructor");
+    table() << (cf::destructorRef() << frm->cppColumnsDestructorName(pStructure))
+            << ";";
+
+    table() << TableAligner::row();
+
+    commentInTable("Returns the number of the rows");
+    table() << (cf::methodRef() << st
+                                << fnSize
+                                << cf::EMethodDeclaration::const_())
+            << ";";
+
+    commentInTable("Returns true if there are no rows");
+    table() << (cf::methodRef() << bl
+                                << fnEmpty
+                                << cf::EMethodDeclaration::const_())
+            << ";";
+
+    commentInTable("Reserves memory for size rows in every column");
+    table() << (cf::methodRef() << vd
+                                << fnReserve
+                                << (cf::argumentRef() << st
+                                                      << size))
+            << ";";
+
+    commentInTable("Removes all the rows");
+    table() << (cf::methodRef() << vd
+                                << fnClear)
+            << ";";
+
+    table() << TableAligner::row();
+
+    commentInTable("Appends a row with the data fields of the object");
+    table() << (cf::methodRef() << vd
+                                << fnPushBack
+                                << (cf::argumentRef() << impl->cppDecoratedType(pStructure)
+                                                      << object))
+            << ";";
+
+    if (pStructure->isBuildable() && !pStructure->abstract())
+    {
+        commentInTable("Appends a row with the data fields of the object instantiated by the builder");
+        table() << (cf::methodRef() << vd
+                                    << fnPushBack
+                                    << (cf::argumentRef() << frm->constTypeRef(cf::typeRef() << frm->cppAutoClassNamespace(pStructure)
+                                                                                             << cf::typeNameRef("Builder"))
+                                                          << cf::variableNameRef("builder")))
+                << ";";
+    }
+
+    table() << TableAligner::row();
+
+    commentInTable("Returns proxy of the row index");
+    table() << (cf::methodRef() << row
+                                << fnOperatorAt
+                                << (cf::argumentRef() << st
+                                                      << index)
+                                << cf::EMethodDeclaration::const_())
+            << ";";
+
+    for (it = fields.begin(); it != fields.end(); ++it)
+    {
+        const FieldSPtr& pField = *it;
+
+        table() << TableAligner::row();
+        commentInTable("Column of the data field " + pField->name()->value());
+        table() << (cf::methodRef() << frm->constTypeRef(impl->cppColumnType(pField))
+                                    << frm->getMethodName(pField)
+                                    << cf::EMethodDeclaration::const_())
+                << ";";
+
+        if (impl->columnAvailability(pField))
+        {
+            commentInTable("Availability bitmap of the data field " + pField->name()->value());
+            table() << (cf::methodRef() << frm->constTypeRef(impl->cppAvailabilityColumnType())
+                                        << frm->availableMethodName(pField)
+                                        << cf::EMethodDeclaration::const_())
+                    << ";";
+        }
+    }
+    eot(declarationStream);
+
+    if (!fields.empty())
+    {
+        eol(declarationStream);
+        encapsulateInTable("private");
+        for (it = fields.begin(); it != fields.end(); ++it)
+        {
+            const FieldSPtr& pField = *it;
+
+            commentInTable("column of the data field " + pField->name()->value());
+            table() << TableAligner::row()
+                    << impl->cppColumnType(pField)
+                    << ' '
+                    << TableAligner::col()
+                    << frm->cppMemberName(pField)
+                    << ";";
+
+            if (impl->columnAvailability(pField))
+            {
+                commentInTable("availability bitmap of the data field " + pField->name()->value());
+                table() << TableAligner::row()
+                        << impl->cppAvailabilityColumnType()
+                        << ' '
+                        << TableAligner::col()
+                        << frm->cppColumnsAvailableMemberName(pField)
+                        << ";";
+            }
+        }
+        eot(declarationStream);
+    }
+
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
 }
 
 void CppHeaderGenerator::generateObjectDeclaration(const ObjectSPtr& pObject)
@@ -2329,11 +3301,31 @@ void CppHeaderGenerator::generateObjectDeclaration(const ObjectSPtr& pObject)
             generateStructureDeclaration(pStructure);
             break;
         }
+        case EObjectId::kInterface:
+        {
+            InterfaceSPtr pInterface = boost::static_pointer_cast<Interface>(pObject);
+            generateInterfaceDeclaration(pInterface);
+            break;
+        }
         default:
             assert(false);
     }
 }
 
+void CppHeaderGenerator::generateInlineAccessorsDefinition()
+{
+    // the accessors are the same definitions the source file would have
+    // had, only marked inline
+    boost::shared_ptr<std::stringstream> accessors(new std::stringstream());
+
+    CppGenerator generator;
+    generator.init(mType, mpAlignerConfiguration, frm, impl, accessors, mDocument);
+    generator.generateInlineAccessors();
+
+    addDependencies(generator.getDependencies());
+    *mStreams[inlineDefinitionStream] << accessors->str();
+}
+
 bool CppHeaderGenerator::generate()
 {
     std::vector<CommentSPtr> vComments = mDocument->mainFile()->comments();
@@ -2362,6 +3354,13 @@ bool CppHeaderGenerator::generate()
         excludeDependency(impl->cppHeaderFileDependency(mDocument->name()->value(),
                                                         mDocument->package()));
     }
+    else if (impl->forwardHeaders())
+    {
+        addDependency(impl->cppForwardHeaderFileDependency(mDocument->name()->value(),
+                                                           mDocument->package()));
+        excludeDependency(impl->cppHeaderFileDependency(mDocument->name()->value(),
+                                                        mDocument->package()));
+    }
     else
     {
         addDependency(impl->cppHeaderFileDependency(mDocument->name()->value(),
@@ -2378,9 +3377,15 @@ bool CppHeaderGenerator::generate()
         generateObjectDeclaration(*it);
     }
 
+    if (impl->inlineAccessors())
+        generateInlineAccessorsDefinition();
+
     closeNamespace(inlineDefinitionStream);
     closeNamespace(forwardDeclarationStream);
 
+    // the forward declarations are in the forward header
+    if ((mType != "partial") && impl->forwardHeaders())
+        mStreams[forwardDeclarationStream]->str("");
 
     includeHeaders(includeStream, Dependency::global_section);
 
@@ -2394,6 +3399,13 @@ bool CppHeaderGenerator::generate()
 
     includeHeaders(includeStream, Dependency::private_section);
 
+    if (mSnapshotDeclaration)
+    {
+        line()  << "template<class T> class snapshot;";
+        eol(includeStream);
+        eol(includeStream);
+    }
+
     line()  << "#endif // "
             << guard;
     eol(forwardDeclarationStream);
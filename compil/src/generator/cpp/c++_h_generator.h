@@ -39,6 +39,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <set>
 #include <string>
 
 namespace compil
@@ -63,11 +64,15 @@ public:
     
     virtual void generateFactoryDeclaration(const FactorySPtr& pFactory);
     virtual void generateHierarchyFactoryDeclaration(const FactorySPtr& pFactory);
+    virtual void generateHierarchyVisitorDeclaration(const FactorySPtr& pFactory);
     virtual void generateObjectFactoryDeclaration(const FactorySPtr& pFactory);
     virtual void generatePluginFactoryDeclaration(const FactorySPtr& pFactory);
 
     virtual void generateIdentifierDeclaration(const IdentifierSPtr& pIdentifier);
     
+    virtual void generateInterfaceDeclaration(const InterfaceSPtr& pInterface);
+    virtual void generateInterfaceShmDeclaration(const InterfaceSPtr& pInterface);
+    
     virtual void generateStructureFieldMemberDeclaration(const FieldSPtr& pField);
     
     virtual void generateStructureIdentificationMethodsDeclaration(
@@ -103,14 +108,22 @@ public:
                                                   const EMethodGroup& overridden);
                                                                   
     virtual void generateStructureDeclaration(const StructureSPtr& pStructure);
+    virtual void generateStructureColumnsDeclaration(const StructureSPtr& pStructure);
     
     virtual void generateObjectDeclaration(const ObjectSPtr& pObject);
+    
+    virtual void generateInlineAccessorsDefinition();
 
 protected:
     void encapsulateInLine(int streamIndex, const std::string& encapsulation);
     void encapsulateInTable(const std::string& encapsulation);
 
+    // returns false when the class is already declared
+    bool generateForwardClassDeclaration(const cpp::frm::TypeSPtr& type);
+
     std::string mEncapsulation;
+    std::set<std::string> mForwardDeclarations;
+    bool mSnapshotDeclaration;
 
     static const int copyrightStream;
     static const int includeStream;
@@ -0,0 +1,357 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/cpp/c++_intern_table_generator.h"
+
+namespace cf = cpp::frm;
+
+namespace compil
+{
+    
+const int CppInternTableGenerator::declarationStream = 1;
+    
+CppInternTableGenerator::CppInternTableGenerator()
+{
+    for (int i = 0; i <= 1; ++i)
+    {
+        mStreams.push_back(boost::shared_ptr<std::stringstream>(new std::stringstream()));
+        mIndent.push_back(0);
+    }
+}
+
+CppInternTableGenerator::~CppInternTableGenerator()
+{
+}
+
+bool CppInternTableGenerator::generate()
+{
+    addDependency(Dependency("boost",
+                             "detail/lightweight_mutex.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Smart Pointers"));
+    addDependency(Dependency("boost",
+                             "shared_ptr.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Smart Pointers"));
+    addDependency(Dependency("boost",
+                             "weak_ptr.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Smart Pointers"));
+    addDependency(impl->unordered_map_dependency());
+    addDependency(Dependency("",
+                             "vector",
+                             Dependency::system_type,
+                             Dependency::stl_level,
+                             Dependency::private_section,
+                             "Standard Template Library"));
+    
+    includeHeaders(declarationStream, Dependency::global_section);
+    
+    std::string guard = frm->headerGuard("core/intern_table.hpp");
+    
+    line()  << "#ifndef " 
+            << guard;
+    eol(declarationStream);
+    line()  << "#define " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    includeHeaders(declarationStream, Dependency::private_section);
+    
+    cf::ConstructorNameSPtr class_name = cf::constructorNameRef("intern_table");
+    cf::VariableNameSPtr memberMutex = frm->memberVariableName(cf::variableNameRef("mutex"));
+    cf::VariableNameSPtr memberEntries = frm->memberVariableName(cf::variableNameRef("entries"));
+    cf::VariableNameSPtr memberLookups = frm->memberVariableName(cf::variableNameRef("lookups"));
+    cf::VariableNameSPtr memberHits = frm->memberVariableName(cf::variableNameRef("hits"));
+    
+    line()  << "template<class "
+            << T->name()->value()
+            << ">";
+    eol(declarationStream);
+    
+    line()  << "class "
+            << class_name;
+    openBlock(declarationStream);
+
+    line()  << "public:";
+    eol(declarationStream, -1);
+
+    fdef()  << (cf::constructorRef() << class_name);
+    eofd(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberLookups
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberHits
+                                        << cf::parameterValueRef("0"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the canonical instance equal to the object. The table takes the "
+                  "ownership of the object and deletes it if an equal instance is already "
+                  "interned. The canonical instances are removed from the table when their "
+                  "last reference is released.");
+    line()  << "boost::shared_ptr<T> intern(T* object)";
+    openBlock(declarationStream);
+    line()  << "// the candidates are released after the lock, because releasing the";
+    eol(declarationStream);
+    line()  << "// last reference of an instance erases it from the table";
+    eol(declarationStream);
+    line()  << "std::vector<boost::shared_ptr<T> > candidates;";
+    eol(declarationStream);
+    line()  << "boost::shared_ptr<T> canonical = insert(object, candidates);";
+    eol(declarationStream);
+    line()  << "if (canonical.get() != object)";
+    eol(declarationStream);
+    line()  << "delete object;";
+    eol(declarationStream, 1);
+    line()  << "return canonical;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the canonical instances in the table");
+    fdef()  << (cf::methodRef() << st
+                                << cf::methodNameRef("size")
+                                << cf::EMethodDeclaration::const_());
+    openBlock(declarationStream);
+    line()  << "boost::detail::lightweight_mutex::scoped_lock lock("
+            << memberMutex
+            << ");";
+    eol(declarationStream);
+    line()  << "return "
+            << memberEntries
+            << ".size();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the intern requests");
+    fdef()  << (cf::methodRef() << st
+                                << cf::methodNameRef("lookups")
+                                << cf::EMethodDeclaration::const_());
+    openBlock(declarationStream);
+    line()  << "boost::detail::lightweight_mutex::scoped_lock lock("
+            << memberMutex
+            << ");";
+    eol(declarationStream);
+    line()  << "return "
+            << memberLookups
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the intern requests served with an already "
+                  "interned instance");
+    fdef()  << (cf::methodRef() << st
+                                << cf::methodNameRef("hits")
+                                << cf::EMethodDeclaration::const_());
+    openBlock(declarationStream);
+    line()  << "boost::detail::lightweight_mutex::scoped_lock lock("
+            << memberMutex
+            << ");";
+    eol(declarationStream);
+    line()  << "return "
+            << memberHits
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the ratio between the hits and the lookups");
+    fdef()  << (cf::methodRef() << dbl
+                                << cf::methodNameRef("hit_ratio")
+                                << cf::EMethodDeclaration::const_());
+    openBlock(declarationStream);
+    line()  << "boost::detail::lightweight_mutex::scoped_lock lock("
+            << memberMutex
+            << ");";
+    eol(declarationStream);
+    line()  << "if ("
+            << memberLookups
+            << " == 0) return 0.0;";
+    eol(declarationStream);
+    line()  << "return (double)"
+            << memberHits
+            << " / "
+            << memberLookups
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "private:";
+    eol(declarationStream, -1);
+    
+    line()  << "typedef std::pair<T*, boost::weak_ptr<T> > entry;";
+    eol(declarationStream);
+    line()  << "typedef boost::unordered_multimap<size_t, entry> map;";
+    eol(declarationStream);
+    line()  << "typedef typename map::iterator iterator;";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "boost::shared_ptr<T> insert(T* object, std::vector<boost::shared_ptr<T> >& candidates)";
+    openBlock(declarationStream);
+    line()  << "size_t hash = object->internHash();";
+    eol(declarationStream);
+    line()  << "boost::detail::lightweight_mutex::scoped_lock lock("
+            << memberMutex
+            << ");";
+    eol(declarationStream);
+    line()  << "++"
+            << memberLookups
+            << ";";
+    eol(declarationStream);
+    eol(declarationStream);
+    line()  << "std::pair<iterator, iterator> range = "
+            << memberEntries
+            << ".equal_range(hash);";
+    eol(declarationStream);
+    line()  << "for (iterator it = range.first; it != range.second; ++it)";
+    openBlock(declarationStream);
+    line()  << "candidates.push_back(it->second.second.lock());";
+    eol(declarationStream);
+    line()  << "if (candidates.back() && candidates.back()->internEquals(*object))";
+    openBlock(declarationStream);
+    line()  << "++"
+            << memberHits
+            << ";";
+    eol(declarationStream);
+    line()  << "return candidates.back();";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "boost::shared_ptr<T> canonical(object, deleter(this, hash));";
+    eol(declarationStream);
+    line()  << memberEntries
+            << ".insert(std::make_pair(hash, entry(object, canonical)));";
+    eol(declarationStream);
+    line()  << "return canonical;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Erases the canonical instance from the table when its last reference "
+                  "is released");
+    line()  << "class deleter";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "deleter(intern_table* table, size_t hash)";
+    eol(declarationStream);
+    line()  << ": mTable(table)";
+    eol(declarationStream, 1);
+    line()  << ", mHash(hash)";
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "void operator()(T* object) const";
+    openBlock(declarationStream);
+    line()  << "mTable->erase(mHash, object);";
+    eol(declarationStream);
+    line()  << "delete object;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "intern_table* mTable;";
+    eol(declarationStream);
+    line()  << "size_t mHash;";
+    eol(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    line()  << "void erase(size_t hash, T* object)";
+    openBlock(declarationStream);
+    line()  << "boost::detail::lightweight_mutex::scoped_lock lock("
+            << memberMutex
+            << ");";
+    eol(declarationStream);
+    line()  << "std::pair<iterator, iterator> range = "
+            << memberEntries
+            << ".equal_range(hash);";
+    eol(declarationStream);
+    line()  << "for (iterator it = range.first; it != range.second; ++it)";
+    openBlock(declarationStream);
+    line()  << "if (it->second.first != object) continue;";
+    eol(declarationStream);
+    line()  << memberEntries
+            << ".erase(it);";
+    eol(declarationStream);
+    line()  << "break;";
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "mutable boost::detail::lightweight_mutex "
+            << memberMutex
+            << ";";
+    eol(declarationStream);
+    line()  << "map "
+            << memberEntries
+            << ";";
+    eol(declarationStream);
+    line()  << "size_t "
+            << memberLookups
+            << ";";
+    eol(declarationStream);
+    line()  << "size_t "
+            << memberHits
+            << ";";
+    eol(declarationStream);
+
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    line()  << "#endif // " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+
+    return serializeStreams();
+}
+
+}
@@ -0,0 +1,893 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/cpp/c++_object_pool_generator.h"
+
+namespace cf = cpp::frm;
+
+namespace compil
+{
+    
+const int CppObjectPoolGenerator::declarationStream = 1;
+    
+CppObjectPoolGenerator::CppObjectPoolGenerator()
+{
+    for (int i = 0; i <= 1; ++i)
+    {
+        mStreams.push_back(boost::shared_ptr<std::stringstream>(new std::stringstream()));
+        mIndent.push_back(0);
+    }
+}
+
+CppObjectPoolGenerator::~CppObjectPoolGenerator()
+{
+}
+
+void CppObjectPoolGenerator::generatePlatform(bool windows)
+{
+    commentInLine(declarationStream,
+                  "Sets the target to the value if it is equal to the expected one. It is "
+                  "a full memory barrier.");
+    line()  << "inline bool pool_compare_exchange(void* volatile* target, void* expected, void* value)";
+    openBlock(declarationStream);
+    if (windows)
+        line()  << "return InterlockedCompareExchangePointer(target, value, expected) == expected;";
+    else
+        line()  << "return __sync_bool_compare_and_swap(target, expected, value);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Exchanges the pointer atomically. It is a full memory barrier.");
+    line()  << "inline void* pool_exchange(void* volatile* target, void* value)";
+    openBlock(declarationStream);
+    if (windows)
+    {
+        line()  << "return InterlockedExchangePointer(target, value);";
+    }
+    else
+    {
+        line()  << "// the builtin alone is only an acquire barrier";
+        eol(declarationStream);
+        line()  << "__sync_synchronize();";
+        eol(declarationStream);
+        line()  << "return __sync_lock_test_and_set(target, value);";
+    }
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Adds the delta to the target atomically");
+    line()  << "inline void pool_add(volatile long* target, long delta)";
+    openBlock(declarationStream);
+    if (windows)
+        line()  << "InterlockedExchangeAdd(target, delta);";
+    else
+        line()  << "__sync_fetch_and_add(target, delta);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Called with the cache of a thread when the thread exits");
+    line()  << "inline void pool_thread_exit(void* cache);";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    if (windows)
+    {
+        commentInLine(declarationStream,
+                      "Adapts pool_thread_exit to the fiber local storage callback");
+        line()  << "inline VOID NTAPI pool_thread_exit_callback(PVOID cache)";
+        openBlock(declarationStream);
+        line()  << "pool_thread_exit(cache);";
+        closeBlock(declarationStream);
+        eol(declarationStream);
+    }
+    
+    commentInLine(declarationStream,
+                  "Key of the thread local caches of a pool");
+    line()  << "typedef "
+            << (windows ? "DWORD" : "pthread_key_t")
+            << " pool_key;";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Creates a key of the thread local caches. The cache of an exiting "
+                  "thread is passed to pool_thread_exit.");
+    line()  << "inline pool_key pool_key_create()";
+    openBlock(declarationStream);
+    if (windows)
+    {
+        line()  << "return FlsAlloc(&pool_thread_exit_callback);";
+    }
+    else
+    {
+        line()  << "pool_key key;";
+        eol(declarationStream);
+        line()  << "pthread_key_create(&key, &pool_thread_exit);";
+        eol(declarationStream);
+        line()  << "return key;";
+    }
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "inline void* pool_key_get(pool_key key)";
+    openBlock(declarationStream);
+    if (windows)
+        line()  << "return FlsGetValue(key);";
+    else
+        line()  << "return pthread_getspecific(key);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "inline void pool_key_set(pool_key key, void* value)";
+    openBlock(declarationStream);
+    if (windows)
+        line()  << "FlsSetValue(key, value);";
+    else
+        line()  << "pthread_setspecific(key, value);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+}
+
+void CppObjectPoolGenerator::generateCache()
+{
+    cf::VariableNameSPtr memberOwner = frm->memberVariableName(cf::variableNameRef("owner"));
+    cf::VariableNameSPtr memberAlignment = frm->memberVariableName(cf::variableNameRef("alignment"));
+    cf::VariableNameSPtr memberNext = frm->memberVariableName(cf::variableNameRef("next"));
+    cf::VariableNameSPtr memberSize = frm->memberVariableName(cf::variableNameRef("size"));
+    cf::VariableNameSPtr memberLocal = frm->memberVariableName(cf::variableNameRef("local"));
+    cf::VariableNameSPtr memberRemote = frm->memberVariableName(cf::variableNameRef("remote"));
+    cf::VariableNameSPtr memberBlocks = frm->memberVariableName(cf::variableNameRef("blocks"));
+    cf::VariableNameSPtr memberAvailable = frm->memberVariableName(cf::variableNameRef("available"));
+    
+    line()  << "class pool_cache;";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Header of a pool block. It keeps the cache of the thread that allocated "
+                  "the block and keeps the object that follows it aligned.");
+    line()  << "union pool_header";
+    openBlock(declarationStream);
+    table() << TableAligner::row()
+            << "pool_cache* "
+            << TableAligner::col()
+            << memberOwner
+            << ";";
+    table() << TableAligner::row()
+            << "long double "
+            << TableAligner::col()
+            << memberAlignment
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Free pool block. The link takes the place of the object.");
+    line()  << "struct pool_link";
+    openBlock(declarationStream);
+    line()  << "pool_link* "
+            << memberNext
+            << ";";
+    eol(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Free list of one thread for the objects of one size. The owner thread "
+                  "allocates and releases its blocks without synchronization. The other "
+                  "threads push the blocks they release on the remote list, which the owner "
+                  "takes over at once when its own list is empty.");
+    line()  << "class pool_cache";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "explicit pool_cache(size_t size)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberSize
+                                        << cf::parameterValueRef("size"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberLocal
+                                        << cf::parameterValueRef("NULL"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberRemote
+                                        << cf::parameterValueRef("NULL"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberNext
+                                        << cf::parameterValueRef("NULL"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberBlocks
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberAvailable
+                                        << cf::parameterValueRef("0"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    // attach
+    commentInLine(declarationStream,
+                  "Adds the cache to the registry of its pool");
+    line()  << "void attach(pool_cache* volatile* registry)";
+    openBlock(declarationStream);
+    line()  << "for (;;)";
+    openBlock(declarationStream);
+    line()  << memberNext
+            << " = *registry;";
+    eol(declarationStream);
+    line()  << "if (pool_compare_exchange((void* volatile*)registry, "
+            << memberNext
+            << ", this))";
+    eol(declarationStream);
+    line()  << "    return;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    // allocate
+    commentInLine(declarationStream,
+                  "Returns a block. Called by the owner thread only.");
+    line()  << "void* allocate()";
+    openBlock(declarationStream);
+    line()  << "if (!"
+            << memberLocal
+            << " && "
+            << memberRemote
+            << ")";
+    eol(declarationStream);
+    line()  << "    adopt();";
+    eol(declarationStream);
+    line()  << "if ("
+            << memberLocal
+            << ")";
+    openBlock(declarationStream);
+    line()  << "pool_link* link = "
+            << memberLocal
+            << ";";
+    eol(declarationStream);
+    line()  << memberLocal
+            << " = link->"
+            << memberNext
+            << ";";
+    eol(declarationStream);
+    line()  << "--"
+            << memberAvailable
+            << ";";
+    eol(declarationStream);
+    line()  << "return link;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "pool_header* header = (pool_header*)::operator new(sizeof(pool_header) + "
+            << memberSize
+            << ");";
+    eol(declarationStream);
+    line()  << "header->"
+            << memberOwner
+            << " = this;";
+    eol(declarationStream);
+    line()  << "pool_add(&"
+            << memberBlocks
+            << ", 1);";
+    eol(declarationStream);
+    line()  << "return header + 1;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    // release
+    commentInLine(declarationStream,
+                  "Returns a block to the free list. Called by the owner thread only.");
+    line()  << "void release(void* object)";
+    openBlock(declarationStream);
+    line()  << "pool_link* link = (pool_link*)object;";
+    eol(declarationStream);
+    line()  << "link->"
+            << memberNext
+            << " = "
+            << memberLocal
+            << ";";
+    eol(declarationStream);
+    line()  << memberLocal
+            << " = link;";
+    eol(declarationStream);
+    line()  << "++"
+            << memberAvailable
+            << ";";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    // releaseRemote
+    commentInLine(declarationStream,
+                  "Pushes a block on the remote list. Called by the other threads. The "
+                  "block is freed if the owner thread has already exited.");
+    line()  << "void releaseRemote(void* object)";
+    openBlock(declarationStream);
+    line()  << "pool_link* link = (pool_link*)object;";
+    eol(declarationStream);
+    line()  << "for (;;)";
+    openBlock(declarationStream);
+    line()  << "pool_link* head = "
+            << memberRemote
+            << ";";
+    eol(declarationStream);
+    line()  << "if (head == orphan())";
+    openBlock(declarationStream);
+    line()  << "dispose(link);";
+    eol(declarationStream);
+    line()  << "return;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    line()  << "link->"
+            << memberNext
+            << " = head;";
+    eol(declarationStream);
+    line()  << "if (pool_compare_exchange((void* volatile*)&"
+            << memberRemote
+            << ", head, link))";
+    eol(declarationStream);
+    line()  << "    return;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    // detach
+    commentInLine(declarationStream,
+                  "Frees the free blocks. The blocks released after that are freed at "
+                  "once. Called when the owner thread exits.");
+    line()  << "void detach()";
+    openBlock(declarationStream);
+    line()  << "pool_link* remote = (pool_link*)pool_exchange((void* volatile*)&"
+            << memberRemote
+            << ", orphan());";
+    eol(declarationStream);
+    line()  << "pool_link* lists[] = { remote, "
+            << memberLocal
+            << " };";
+    eol(declarationStream);
+    line()  << "for (size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); ++i)";
+    openBlock(declarationStream);
+    line()  << "pool_link* link = lists[i];";
+    eol(declarationStream);
+    line()  << "while (link)";
+    openBlock(declarationStream);
+    line()  << "pool_link* next = link->"
+            << memberNext
+            << ";";
+    eol(declarationStream);
+    line()  << "dispose(link);";
+    eol(declarationStream);
+    line()  << "link = next;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    line()  << memberLocal
+            << " = NULL;";
+    eol(declarationStream);
+    line()  << memberAvailable
+            << " = 0;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the next cache in the registry of the pool");
+    line()  << "pool_cache* next() const";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberNext
+            << ";";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns true until the owner thread exits");
+    line()  << "bool attached() const";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberRemote
+            << " != orphan();";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the blocks taken from the heap and not freed yet");
+    line()  << "long blocks() const";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberBlocks
+            << ";";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the blocks in the free list");
+    line()  << "long available() const";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberAvailable
+            << ";";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    
+    commentInLine(declarationStream,
+                  "Marks the remote list of a cache whose owner thread has exited");
+    line()  << "static pool_link* orphan()";
+    openBlock(declarationStream);
+    line()  << "static pool_link link;";
+    eol(declarationStream);
+    line()  << "return &link;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Takes over the blocks released by the other threads");
+    line()  << "void adopt()";
+    openBlock(declarationStream);
+    line()  << memberLocal
+            << " = (pool_link*)pool_exchange((void* volatile*)&"
+            << memberRemote
+            << ", NULL);";
+    eol(declarationStream);
+    line()  << "for (pool_link* link = "
+            << memberLocal
+            << "; link; link = link->"
+            << memberNext
+            << ")";
+    eol(declarationStream);
+    line()  << "    ++"
+            << memberAvailable
+            << ";";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns a block to the heap");
+    line()  << "void dispose(pool_link* link)";
+    openBlock(declarationStream);
+    line()  << "::operator delete((pool_header*)link - 1);";
+    eol(declarationStream);
+    line()  << "pool_add(&"
+            << memberBlocks
+            << ", -1);";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "pool_cache(const pool_cache&);";
+    eol(declarationStream);
+    line()  << "pool_cache& operator=(const pool_cache&);";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    table() << TableAligner::row()
+            << "size_t "
+            << TableAligner::col()
+            << memberSize
+            << ";";
+    table() << TableAligner::row()
+            << "pool_link* "
+            << TableAligner::col()
+            << memberLocal
+            << ";";
+    table() << TableAligner::row()
+            << "pool_link* volatile "
+            << TableAligner::col()
+            << memberRemote
+            << ";";
+    table() << TableAligner::row()
+            << "pool_cache* "
+            << TableAligner::col()
+            << memberNext
+            << ";";
+    table() << TableAligner::row()
+            << "volatile long "
+            << TableAligner::col()
+            << memberBlocks
+            << ";";
+    table() << TableAligner::row()
+            << "volatile long "
+            << TableAligner::col()
+            << memberAvailable
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    line()  << "inline void pool_thread_exit(void* cache)";
+    openBlock(declarationStream);
+    line()  << "((pool_cache*)cache)->detach();";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+}
+
+void CppObjectPoolGenerator::generatePool()
+{
+    cf::VariableNameSPtr memberOwner = frm->memberVariableName(cf::variableNameRef("owner"));
+    
+    commentInLine(declarationStream,
+                  "Per-thread free list pool of the objects of type T. Every thread "
+                  "allocates from its own cache without synchronization. A block released "
+                  "by another thread returns to the cache of the thread that allocated it. "
+                  "The free blocks of a thread are kept until the thread exits.");
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "class object_pool";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    
+    commentInLine(declarationStream,
+                  "Returns storage for one T");
+    line()  << "static void* allocate()";
+    openBlock(declarationStream);
+    line()  << "pool_cache* cache = (pool_cache*)pool_key_get(key());";
+    eol(declarationStream);
+    line()  << "if (!cache)";
+    openBlock(declarationStream);
+    line()  << "cache = new pool_cache(sizeof(T));";
+    eol(declarationStream);
+    line()  << "cache->attach(&registry());";
+    eol(declarationStream);
+    line()  << "pool_key_set(key(), cache);";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    line()  << "return cache->allocate();";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the storage provided by allocate to the pool");
+    line()  << "static void deallocate(void* object)";
+    openBlock(declarationStream);
+    line()  << "if (!object)";
+    eol(declarationStream);
+    line()  << "    return;";
+    eol(declarationStream);
+    line()  << "pool_cache* owner = ((pool_header*)object - 1)->"
+            << memberOwner
+            << ";";
+    eol(declarationStream);
+    line()  << "if (owner == pool_key_get(key()))";
+    eol(declarationStream);
+    line()  << "    owner->release(object);";
+    eol(declarationStream);
+    line()  << "else";
+    eol(declarationStream);
+    line()  << "    owner->releaseRemote(object);";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the running threads that allocated from the pool");
+    line()  << "static size_t threads()";
+    openBlock(declarationStream);
+    line()  << "size_t result = 0;";
+    eol(declarationStream);
+    line()  << "for (pool_cache* cache = registry(); cache; cache = cache->next())";
+    eol(declarationStream);
+    line()  << "    if (cache->attached()) ++result;";
+    eol(declarationStream);
+    line()  << "return result;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the blocks taken from the heap and not freed yet");
+    line()  << "static size_t blocks()";
+    openBlock(declarationStream);
+    line()  << "long result = 0;";
+    eol(declarationStream);
+    line()  << "for (pool_cache* cache = registry(); cache; cache = cache->next())";
+    eol(declarationStream);
+    line()  << "    result += cache->blocks();";
+    eol(declarationStream);
+    line()  << "return (size_t)result;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the free blocks in the caches of the threads. The "
+                  "blocks released by other threads are counted once the thread that "
+                  "allocated them takes them over.");
+    line()  << "static size_t available()";
+    openBlock(declarationStream);
+    line()  << "long result = 0;";
+    eol(declarationStream);
+    line()  << "for (pool_cache* cache = registry(); cache; cache = cache->next())";
+    eol(declarationStream);
+    line()  << "    result += cache->available();";
+    eol(declarationStream);
+    line()  << "return (size_t)result;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the number of the blocks that are not available. The counters "
+                  "of the running threads are read without synchronization, so the "
+                  "statistics are approximate while the pool is in use.");
+    line()  << "static size_t used()";
+    openBlock(declarationStream);
+    line()  << "size_t total = blocks();";
+    eol(declarationStream);
+    line()  << "size_t spare = available();";
+    eol(declarationStream);
+    line()  << "return total > spare ? total - spare : 0;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "static pool_key key()";
+    openBlock(declarationStream);
+    line()  << "static pool_key key = pool_key_create();";
+    eol(declarationStream);
+    line()  << "return key;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "The caches of all the threads that allocated from the pool. The caches "
+                  "are never removed, the blocks of an exited thread may be still in use.");
+    line()  << "static pool_cache* volatile& registry()";
+    openBlock(declarationStream);
+    line()  << "static pool_cache* volatile head = NULL;";
+    eol(declarationStream);
+    line()  << "return head;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+void CppObjectPoolGenerator::generateAllocator()
+{
+    commentInLine(declarationStream,
+                  "Standard allocator on top of the object pools. The shared pointers use "
+                  "it to take their control blocks from the pool of the control block type.");
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "class object_pool_allocator";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    
+    const char* types[][2] =
+    {
+        {"T",         "value_type"},
+        {"T*",        "pointer"},
+        {"const T*",  "const_pointer"},
+        {"T&",        "reference"},
+        {"const T&",  "const_reference"},
+        {"size_t",    "size_type"},
+        {"ptrdiff_t", "difference_type"},
+    };
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); ++i)
+    {
+        table() << TableAligner::row()
+                << "typedef "
+                << types[i][0]
+                << " "
+                << TableAligner::col()
+                << types[i][1]
+                << ";";
+    }
+    eot(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "template<class U>";
+    eol(declarationStream);
+    line()  << "struct rebind";
+    openBlock(declarationStream);
+    line()  << "typedef object_pool_allocator<U> other;";
+    eol(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    line()  << "object_pool_allocator()";
+    openBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "template<class U>";
+    eol(declarationStream);
+    line()  << "object_pool_allocator(const object_pool_allocator<U>&)";
+    openBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "pointer address(reference value) const";
+    openBlock(declarationStream);
+    line()  << "return &value;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "const_pointer address(const_reference value) const";
+    openBlock(declarationStream);
+    line()  << "return &value;";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Only the single objects come from the pool");
+    line()  << "pointer allocate(size_type count, const void* = NULL)";
+    openBlock(declarationStream);
+    line()  << "if (count == 1)";
+    eol(declarationStream);
+    line()  << "    return (pointer)object_pool<T>::allocate();";
+    eol(declarationStream);
+    line()  << "return (pointer)::operator new(count * sizeof(T));";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void deallocate(pointer object, size_type count)";
+    openBlock(declarationStream);
+    line()  << "if (count == 1)";
+    eol(declarationStream);
+    line()  << "    object_pool<T>::deallocate(object);";
+    eol(declarationStream);
+    line()  << "else";
+    eol(declarationStream);
+    line()  << "    ::operator delete(object);";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void construct(pointer object, const T& value)";
+    openBlock(declarationStream);
+    line()  << "new (object) T(value);";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void destroy(pointer object)";
+    openBlock(declarationStream);
+    line()  << "object->~T();";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "size_type max_size() const";
+    openBlock(declarationStream);
+    line()  << "return size_type(-1) / sizeof(T);";
+    eol(declarationStream);
+    closeBlock(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    const char* operators[][2] =
+    {
+        {"==", "true"},
+        {"!=", "false"},
+    };
+    for (size_t i = 0; i < sizeof(operators) / sizeof(operators[0]); ++i)
+    {
+        line()  << "template<class T, class U>";
+        eol(declarationStream);
+        line()  << "inline bool operator"
+                << operators[i][0]
+                << "(const object_pool_allocator<T>&, const object_pool_allocator<U>&)";
+        openBlock(declarationStream);
+        line()  << "return "
+                << operators[i][1]
+                << ";";
+        eol(declarationStream);
+        closeBlock(declarationStream);
+        eol(declarationStream);
+    }
+}
+
+bool CppObjectPoolGenerator::generate()
+{
+    addDependency(Dependency("",
+                             "new",
+                             Dependency::system_type,
+                             Dependency::stl_level,
+                             Dependency::private_section,
+                             "Standard Template Library"));
+    addDependency(impl->stddef_dependency());
+    
+    includeHeaders(declarationStream, Dependency::global_section);
+    
+    std::string guard = frm->headerGuard("core/object_pool.hpp");
+    
+    line()  << "#ifndef " 
+            << guard;
+    eol(declarationStream);
+    line()  << "#define " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    includeHeaders(declarationStream, Dependency::private_section);
+    
+    line()  << "#if defined(_WIN32)";
+    eol(declarationStream);
+    line()  << "#include <windows.h>";
+    eol(declarationStream);
+    eol(declarationStream);
+    generatePlatform(true);
+    line()  << "#else";
+    eol(declarationStream);
+    line()  << "#include <pthread.h>";
+    eol(declarationStream);
+    eol(declarationStream);
+    generatePlatform(false);
+    line()  << "#endif";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    generateCache();
+    generatePool();
+    generateAllocator();
+    
+    line()  << "#endif // " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+
+    return serializeStreams();
+}
+
+}
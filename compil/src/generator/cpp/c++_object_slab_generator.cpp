@@ -0,0 +1,354 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/cpp/c++_object_slab_generator.h"
+
+namespace cf = cpp::frm;
+
+namespace compil
+{
+    
+const int CppObjectSlabGenerator::declarationStream = 1;
+    
+CppObjectSlabGenerator::CppObjectSlabGenerator()
+{
+    for (int i = 0; i <= 1; ++i)
+    {
+        mStreams.push_back(boost::shared_ptr<std::stringstream>(new std::stringstream()));
+        mIndent.push_back(0);
+    }
+}
+
+CppObjectSlabGenerator::~CppObjectSlabGenerator()
+{
+}
+
+void CppObjectSlabGenerator::generateSlab()
+{
+    cf::VariableNameSPtr memberObjects = frm->memberVariableName(cf::variableNameRef("objects"));
+    cf::VariableNameSPtr memberSize = frm->memberVariableName(cf::variableNameRef("size"));
+    
+    commentInLine(declarationStream,
+                  "Contiguous storage for the clones of objects of the same type. The "
+                  "pointers to the objects share the ownership of the whole slab, so it "
+                  "is destroyed together with the last of them.");
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "class object_slab";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "explicit object_slab(size_t capacity)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberObjects
+                                        << cf::parameterValueRef("static_cast<T*>(::operator new(capacity * sizeof(T)))"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberSize
+                                        << cf::parameterValueRef("0"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "~object_slab()";
+    openBlock(declarationStream);
+    line()  << "while ("
+            << memberSize
+            << ")";
+    eol(declarationStream);
+    line()  << memberObjects
+            << "[--"
+            << memberSize
+            << "].~T();";
+    eol(declarationStream, 1);
+    line()  << "::operator delete("
+            << memberObjects
+            << ");";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Copy constructs the object at the end of the slab. The slab should "
+                  "have room for it.");
+    line()  << "T* push_back(const T& object)";
+    openBlock(declarationStream);
+    line()  << "T* place = "
+            << memberObjects
+            << " + "
+            << memberSize
+            << ";";
+    eol(declarationStream);
+    line()  << "new (place) T(object);";
+    eol(declarationStream);
+    line()  << "++"
+            << memberSize
+            << ";";
+    eol(declarationStream);
+    line()  << "return place;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "object_slab(const object_slab&);";
+    eol(declarationStream);
+    line()  << "object_slab& operator=(const object_slab&);";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    table() << TableAligner::row()
+            << "T* "
+            << TableAligner::col()
+            << memberObjects
+            << ";";
+    table() << TableAligner::row()
+            << "size_t "
+            << TableAligner::col()
+            << memberSize
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+void CppObjectSlabGenerator::generateCloner()
+{
+    cf::VariableNameSPtr memberObjects = frm->memberVariableName(cf::variableNameRef("objects"));
+    cf::VariableNameSPtr memberResult = frm->memberVariableName(cf::variableNameRef("result"));
+    cf::VariableNameSPtr memberOrder = frm->memberVariableName(cf::variableNameRef("order"));
+    cf::VariableNameSPtr memberStarts = frm->memberVariableName(cf::variableNameRef("starts"));
+    
+    commentInLine(declarationStream,
+                  "Clones a vector of polymorphic objects group by group. The objects are "
+                  "ordered by the identifiers of their types with a counting sort, then "
+                  "each group is copied into its own slab without a virtual call per "
+                  "object. The clones are placed at the positions of the originals. The "
+                  "null objects should have the identifier 0, they stay null. Every "
+                  "clone shares the ownership of its whole slab, so the slab and the "
+                  "destructors of all its objects wait for the last of its clones. The "
+                  "clones could not use enable_shared_from_this, their weak pointer is "
+                  "never set.");
+    line()  << "template<class Base>";
+    eol(declarationStream);
+    line()  << "class slab_cloner";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "typedef boost::shared_ptr<Base> pointer;";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "The identifiers should be less than the count of the groups");
+    line()  << "slab_cloner(const std::vector<pointer>& objects,";
+    eol(declarationStream);
+    line()  << "            const std::vector<long>& ids,";
+    eol(declarationStream);
+    line()  << "            size_t groups,";
+    eol(declarationStream);
+    line()  << "            std::vector<pointer>& result)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberObjects
+                                        << cf::parameterValueRef("objects"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberResult
+                                        << cf::parameterValueRef("result"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberOrder
+                                        << cf::parameterValueRef("ids.size()"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberStarts
+                                        << cf::parameterValueRef("groups + 1, 0"));
+    openBlock(declarationStream, 1);
+    line()  << memberResult
+            << ".assign(ids.size(), pointer());";
+    eol(declarationStream);
+    line()  << "for (size_t i = 0; i < ids.size(); ++i)";
+    openBlock(declarationStream);
+    line()  << "BOOST_ASSERT((size_t)ids[i] < groups);";
+    eol(declarationStream);
+    line()  << "++"
+            << memberStarts
+            << "[ids[i] + 1];";
+    closeBlock(declarationStream);
+    line()  << "for (size_t g = 0; g < groups; ++g)";
+    eol(declarationStream);
+    line()  << memberStarts
+            << "[g + 1] += "
+            << memberStarts
+            << "[g];";
+    eol(declarationStream, 1);
+    line()  << "std::vector<size_t> next("
+            << memberStarts
+            << ".begin(), "
+            << memberStarts
+            << ".end() - 1);";
+    eol(declarationStream);
+    line()  << "for (size_t i = 0; i < ids.size(); ++i)";
+    eol(declarationStream);
+    line()  << memberOrder
+            << "[next[ids[i]]++] = i;";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Clones the group of the objects with the identifier of T");
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "void clone(long id)";
+    openBlock(declarationStream);
+    line()  << "size_t begin = "
+            << memberStarts
+            << "[id];";
+    eol(declarationStream);
+    line()  << "size_t end = "
+            << memberStarts
+            << "[id + 1];";
+    eol(declarationStream);
+    line()  << "if (begin == end)";
+    eol(declarationStream);
+    line()  << "return;";
+    eol(declarationStream, 1);
+    eol(declarationStream);
+    line()  << "boost::shared_ptr<object_slab<T> > slab(new object_slab<T>(end - begin));";
+    eol(declarationStream);
+    line()  << "for (size_t i = begin; i < end; ++i)";
+    openBlock(declarationStream);
+    line()  << "size_t index = "
+            << memberOrder
+            << "[i];";
+    eol(declarationStream);
+    line()  << "T* clone = slab->push_back(static_cast<const T&>(*"
+            << memberObjects
+            << "[index]));";
+    eol(declarationStream);
+    line()  << "// the clone shares the ownership of the slab";
+    eol(declarationStream);
+    line()  << memberResult
+            << "[index] = pointer(slab, clone);";
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "slab_cloner(const slab_cloner&);";
+    eol(declarationStream);
+    line()  << "slab_cloner& operator=(const slab_cloner&);";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    table() << TableAligner::row()
+            << "const std::vector<pointer>& "
+            << TableAligner::col()
+            << memberObjects
+            << ";";
+    table() << TableAligner::row()
+            << "std::vector<pointer>& "
+            << TableAligner::col()
+            << memberResult
+            << ";";
+    table() << TableAligner::row()
+            << "std::vector<size_t> "
+            << TableAligner::col()
+            << memberOrder
+            << ";";
+    table() << TableAligner::row()
+            << "std::vector<size_t> "
+            << TableAligner::col()
+            << memberStarts
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+bool CppObjectSlabGenerator::generate()
+{
+    addDependency(Dependency("boost",
+                             "assert.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Utility"));
+    addDependency(Dependency("boost",
+                             "shared_ptr.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Smart Pointers"));
+    addDependency(Dependency("",
+                             "new",
+                             Dependency::system_type,
+                             Dependency::stl_level,
+                             Dependency::private_section,
+                             "Standard Template Library"));
+    addDependency(Dependency("",
+                             "vector",
+                             Dependency::system_type,
+                             Dependency::stl_level,
+                             Dependency::private_section,
+                             "Standard Template Library"));
+    addDependency(impl->stddef_dependency());
+    
+    includeHeaders(declarationStream, Dependency::global_section);
+    
+    std::string guard = frm->headerGuard("core/object_slab.hpp");
+    
+    line()  << "#ifndef " 
+            << guard;
+    eol(declarationStream);
+    line()  << "#define " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    includeHeaders(declarationStream, Dependency::private_section);
+    
+    generateSlab();
+    generateCloner();
+    
+    line()  << "#endif // " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+
+    return serializeStreams();
+}
+
+}
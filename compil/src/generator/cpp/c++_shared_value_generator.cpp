@@ -0,0 +1,226 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/cpp/c++_shared_value_generator.h"
+
+namespace cf = cpp::frm;
+
+namespace compil
+{
+    
+const int CppSharedValueGenerator::declarationStream = 1;
+    
+CppSharedValueGenerator::CppSharedValueGenerator()
+{
+    for (int i = 0; i <= 1; ++i)
+    {
+        mStreams.push_back(boost::shared_ptr<std::stringstream>(new std::stringstream()));
+        mIndent.push_back(0);
+    }
+}
+
+CppSharedValueGenerator::~CppSharedValueGenerator()
+{
+}
+
+bool CppSharedValueGenerator::generate()
+{
+    addDependency(Dependency("boost",
+                             "make_shared.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Smart Pointers"));
+    addDependency(Dependency("boost",
+                             "shared_ptr.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Smart Pointers"));
+    
+    includeHeaders(declarationStream, Dependency::global_section);
+    
+    std::string guard = frm->headerGuard("core/shared_value.hpp");
+    
+    line()  << "#ifndef " 
+            << guard;
+    eol(declarationStream);
+    line()  << "#define " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    includeHeaders(declarationStream, Dependency::private_section);
+    
+    cf::VariableNameSPtr memberValue = frm->memberVariableName(cf::variableNameRef("value"));
+    
+    commentInLine(declarationStream,
+                  "Field storage shared between the copies of an immutable object. "
+                  "Copying a shared_value only shares the storage, the storage is copied "
+                  "when a shared value is changed. So a Builder derived from an existing "
+                  "object copies only the fields it changes.");
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "class shared_value";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    
+    line()  << "shared_value()";
+    openBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "shared_value(const T& value)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberValue
+                                        << cf::parameterValueRef("boost::make_shared<T>(value)"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Reuses the storage if it is not shared");
+    line()  << "shared_value& operator=(const T& value)";
+    openBlock(declarationStream);
+    line()  << "if ("
+            << memberValue
+            << " && "
+            << memberValue
+            << ".unique())";
+    eol(declarationStream);
+    line()  << "*"
+            << memberValue
+            << " = value;";
+    eol(declarationStream, 1);
+    line()  << "else";
+    eol(declarationStream);
+    line()  << memberValue
+            << " = boost::make_shared<T>(value);";
+    eol(declarationStream, 1);
+    line()  << "return *this;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "operator const T&() const";
+    openBlock(declarationStream);
+    line()  << "return get();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "const T& get() const";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberValue
+            << " ? *"
+            << memberValue
+            << " : empty();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Provides mutable access to the value. The storage is copied first if it "
+                  "is shared with another object.");
+    line()  << "T& mutate()";
+    openBlock(declarationStream);
+    line()  << "if (!"
+            << memberValue
+            << ")";
+    eol(declarationStream);
+    line()  << memberValue
+            << " = boost::make_shared<T>();";
+    eol(declarationStream, 1);
+    line()  << "else if (!"
+            << memberValue
+            << ".unique())";
+    eol(declarationStream);
+    line()  << memberValue
+            << " = boost::make_shared<T>(*"
+            << memberValue
+            << ");";
+    eol(declarationStream, 1);
+    line()  << "return *"
+            << memberValue
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Resets the value to the default one without an allocation");
+    line()  << "void clear()";
+    openBlock(declarationStream);
+    line()  << memberValue
+            << ".reset();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns true if both values use the same storage");
+    line()  << "bool shares(const shared_value& other) const";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberValue
+            << " && "
+            << memberValue
+            << " == other."
+            << memberValue
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "static const T& empty()";
+    openBlock(declarationStream);
+    line()  << "static const T value = T();";
+    eol(declarationStream);
+    line()  << "return value;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "boost::shared_ptr<T> "
+            << memberValue
+            << ";";
+    eol(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    line()  << "#endif // " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+
+    return serializeStreams();
+}
+
+}
@@ -0,0 +1,926 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/cpp/c++_shm_channel_generator.h"
+
+namespace cf = cpp::frm;
+
+namespace compil
+{
+    
+const int CppShmChannelGenerator::declarationStream = 1;
+    
+CppShmChannelGenerator::CppShmChannelGenerator()
+{
+    for (int i = 0; i <= 1; ++i)
+    {
+        mStreams.push_back(boost::shared_ptr<std::stringstream>(new std::stringstream()));
+        mIndent.push_back(0);
+    }
+}
+
+CppShmChannelGenerator::~CppShmChannelGenerator()
+{
+}
+
+void CppShmChannelGenerator::generatePlatform(bool windows)
+{
+    commentInLine(declarationStream,
+                  "Orders the memory accesses before and after it. The rings are shared "
+                  "between processes, so it has to be a hardware barrier too.");
+    line()  << "inline void shm_barrier()";
+    openBlock(declarationStream);
+    if (windows)
+        line()  << "MemoryBarrier();";
+    else
+        line()  << "__sync_synchronize();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    commentInLine(declarationStream,
+                  "Monotonic time in milliseconds. It wraps around, but the difference "
+                  "of two readings is right.");
+    line()  << "inline boost::uint32_t shm_milliseconds()";
+    openBlock(declarationStream);
+    if (windows)
+    {
+        line()  << "return GetTickCount();";
+    }
+    else
+    {
+        line()  << "timespec now;";
+        eol(declarationStream);
+        line()  << "clock_gettime(CLOCK_MONOTONIC, &now);";
+        eol(declarationStream);
+        line()  << "return (boost::uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);";
+    }
+    closeBlock(declarationStream);
+    eol(declarationStream);
+}
+
+void CppShmChannelGenerator::generateRing()
+{
+    cf::VariableNameSPtr memberHeader = frm->memberVariableName(cf::variableNameRef("header"));
+    cf::VariableNameSPtr memberData = frm->memberVariableName(cf::variableNameRef("data"));
+    cf::VariableNameSPtr memberCapacity = frm->memberVariableName(cf::variableNameRef("capacity"));
+    cf::VariableNameSPtr memberReserved = frm->memberVariableName(cf::variableNameRef("reserved"));
+    cf::VariableNameSPtr memberReleased = frm->memberVariableName(cf::variableNameRef("released"));
+    cf::VariableNameSPtr memberWrite = frm->memberVariableName(cf::variableNameRef("write"));
+    cf::VariableNameSPtr memberRead = frm->memberVariableName(cf::variableNameRef("read"));
+    cf::VariableNameSPtr memberTimeout = frm->memberVariableName(cf::variableNameRef("timeout"));
+    
+    commentInLine(declarationStream,
+                  "Thrown when the peer of a ring does not respond within the timeout, for "
+                  "example because its process has died or has never started. The channel "
+                  "should not be used after it.");
+    line()  << "class shm_timeout_error : public std::runtime_error";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "explicit shm_timeout_error(const std::string& message)";
+    eol(declarationStream);
+    line()  << ": std::runtime_error(message)";
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Single producer single consumer ring of messages placed in a shared "
+                  "memory. Each message is a 32 bit size followed by the payload and it is "
+                  "always contiguous, so it could be written and read in place. The "
+                  "positions are free running counters, their difference is the used space.");
+    line()  << "class shm_ring";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    commentInLine(declarationStream,
+                  "The positions of the ring. They are in separate cache lines, because "
+                  "the producer and the consumer update them from different processes.");
+    line()  << "struct header";
+    openBlock(declarationStream);
+    table() << TableAligner::row()
+            << "volatile boost::uint32_t "
+            << TableAligner::col()
+            << memberWrite
+            << ";";
+    table() << TableAligner::row()
+            << "char "
+            << TableAligner::col()
+            << "mWritePadding[60];";
+    table() << TableAligner::row()
+            << "volatile boost::uint32_t "
+            << TableAligner::col()
+            << memberRead
+            << ";";
+    table() << TableAligner::row()
+            << "char "
+            << TableAligner::col()
+            << "mReadPadding[60];";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    line()  << "shm_ring()";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberHeader
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberData
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberCapacity
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberReserved
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberReleased
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberTimeout
+                                        << cf::parameterValueRef("0"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "The capacity should be a power of two. The waits for the peer throw "
+                  "shm_timeout_error after the timeout in milliseconds, 0 waits forever.");
+    line()  << "shm_ring(header* ring, char* data, boost::uint32_t capacity, boost::uint32_t timeout)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberHeader
+                                        << cf::parameterValueRef("ring"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberData
+                                        << cf::parameterValueRef("data"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberCapacity
+                                        << cf::parameterValueRef("capacity"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberReserved
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberReleased
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberTimeout
+                                        << cf::parameterValueRef("timeout"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the place of a message with the size of the payload. It waits "
+                  "while the ring is full, up to the timeout. The message is visible to the consumer only "
+                  "after the commit. It could not be larger than the half of the ring, "
+                  "so it always fits after the skipped space at the end. Throws "
+                  "std::length_error for a larger message, it would never fit.");
+    line()  << "char* reserve(boost::uint32_t size)";
+    openBlock(declarationStream);
+    line()  << "boost::uint32_t frame = align(sizeof(boost::uint32_t) + size);";
+    eol(declarationStream);
+    line()  << "if ((size > "
+            << memberCapacity
+            << " / 2) || (frame > "
+            << memberCapacity
+            << " / 2))";
+    eol(declarationStream);
+    line()  << "throw std::length_error(\"shm_ring: the message is larger than the half of the ring\");";
+    eol(declarationStream, 1);
+    line()  << "boost::uint32_t start = 0;";
+    eol(declarationStream);
+    line()  << "boost::uint32_t write = "
+            << memberHeader
+            << "->"
+            << memberWrite
+            << ";";
+    eol(declarationStream);
+    line()  << "boost::uint32_t offset = write & ("
+            << memberCapacity
+            << " - 1);";
+    eol(declarationStream);
+    line()  << "// the message does not fit before the end, the rest of the ring is skipped";
+    eol(declarationStream);
+    line()  << "boost::uint32_t skip = "
+            << memberCapacity
+            << " - offset < frame ? "
+            << memberCapacity
+            << " - offset : 0;";
+    eol(declarationStream);
+    line()  << "for (unsigned k = 0; write + skip + frame - load(&"
+            << memberHeader
+            << "->"
+            << memberRead
+            << ") > "
+            << memberCapacity
+            << "; ++k)";
+    eol(declarationStream);
+    line()  << "pause(k, start);";
+    eol(declarationStream, 1);
+    line()  << "if (skip)";
+    openBlock(declarationStream);
+    line()  << "boost::uint32_t marker = skipMarker;";
+    eol(declarationStream);
+    line()  << "memcpy("
+            << memberData
+            << " + offset, &marker, sizeof(boost::uint32_t));";
+    eol(declarationStream);
+    line()  << "write += skip;";
+    eol(declarationStream);
+    line()  << "offset = 0;";
+    closeBlock(declarationStream);
+    line()  << memberReserved
+            << " = write + frame;";
+    eol(declarationStream);
+    line()  << "memcpy("
+            << memberData
+            << " + offset, &size, sizeof(boost::uint32_t));";
+    eol(declarationStream);
+    line()  << "return "
+            << memberData
+            << " + offset + sizeof(boost::uint32_t);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Publishes the reserved message to the consumer");
+    line()  << "void commit()";
+    openBlock(declarationStream);
+    line()  << "store(&"
+            << memberHeader
+            << "->"
+            << memberWrite
+            << ", "
+            << memberReserved
+            << ");";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the payload of the oldest message and its size, or null if the "
+                  "ring is empty. The payload stays in place until the release.");
+    line()  << "const char* peek(boost::uint32_t& size)";
+    openBlock(declarationStream);
+    line()  << "boost::uint32_t read = "
+            << memberHeader
+            << "->"
+            << memberRead
+            << ";";
+    eol(declarationStream);
+    line()  << "if (load(&"
+            << memberHeader
+            << "->"
+            << memberWrite
+            << ") == read) return 0;";
+    eol(declarationStream);
+    line()  << "boost::uint32_t offset = read & ("
+            << memberCapacity
+            << " - 1);";
+    eol(declarationStream);
+    line()  << "memcpy(&size, "
+            << memberData
+            << " + offset, sizeof(boost::uint32_t));";
+    eol(declarationStream);
+    line()  << "if (size == skipMarker)";
+    openBlock(declarationStream);
+    line()  << "// the producer always writes a message after the skipped space";
+    eol(declarationStream);
+    line()  << "read += "
+            << memberCapacity
+            << " - offset;";
+    eol(declarationStream);
+    line()  << "offset = 0;";
+    eol(declarationStream);
+    line()  << "memcpy(&size, "
+            << memberData
+            << ", sizeof(boost::uint32_t));";
+    closeBlock(declarationStream);
+    line()  << memberReleased
+            << " = read + align(sizeof(boost::uint32_t) + size);";
+    eol(declarationStream);
+    line()  << "return "
+            << memberData
+            << " + offset + sizeof(boost::uint32_t);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Waits for a message, up to the timeout, and returns its payload");
+    line()  << "const char* wait(boost::uint32_t& size)";
+    openBlock(declarationStream);
+    line()  << "boost::uint32_t start = 0;";
+    eol(declarationStream);
+    line()  << "const char* payload = peek(size);";
+    eol(declarationStream);
+    line()  << "for (unsigned k = 0; !payload; ++k)";
+    openBlock(declarationStream);
+    line()  << "pause(k, start);";
+    eol(declarationStream);
+    line()  << "payload = peek(size);";
+    closeBlock(declarationStream);
+    line()  << "return payload;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the space of the peeked message to the producer");
+    line()  << "void release()";
+    openBlock(declarationStream);
+    line()  << "store(&"
+            << memberHeader
+            << "->"
+            << memberRead
+            << ", "
+            << memberReleased
+            << ");";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "static const boost::uint32_t skipMarker = 0xFFFFFFFF;";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "The messages are 8 bytes aligned, so the size of the next one always "
+                  "fits before the end");
+    line()  << "static boost::uint32_t align(boost::uint32_t size)";
+    openBlock(declarationStream);
+    line()  << "return (size + 7) & ~7;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Yields in the k-th round of a wait for the peer. Throws "
+                  "shm_timeout_error when the wait, started in the first round, is longer "
+                  "than the timeout");
+    line()  << "void pause(unsigned k, boost::uint32_t& start)";
+    openBlock(declarationStream);
+    line()  << "boost::detail::yield(k);";
+    eol(declarationStream);
+    line()  << "if (!"
+            << memberTimeout
+            << ") return;";
+    eol(declarationStream);
+    line()  << "boost::uint32_t now = shm_milliseconds();";
+    eol(declarationStream);
+    line()  << "if (k == 0)";
+    eol(declarationStream);
+    line()  << "start = now;";
+    eol(declarationStream, 1);
+    line()  << "else if (now - start > "
+            << memberTimeout
+            << ")";
+    eol(declarationStream);
+    line()  << "throw shm_timeout_error(\"shm_ring: the peer did not respond within the timeout\");";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "static boost::uint32_t load(volatile boost::uint32_t* position)";
+    openBlock(declarationStream);
+    line()  << "boost::uint32_t value = *position;";
+    eol(declarationStream);
+    line()  << "shm_barrier();";
+    eol(declarationStream);
+    line()  << "return value;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "static void store(volatile boost::uint32_t* position, boost::uint32_t value)";
+    openBlock(declarationStream);
+    line()  << "shm_barrier();";
+    eol(declarationStream);
+    line()  << "*position = value;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    table() << TableAligner::row()
+            << "header* "
+            << TableAligner::col()
+            << memberHeader
+            << ";";
+    table() << TableAligner::row()
+            << "char* "
+            << TableAligner::col()
+            << memberData
+            << ";";
+    table() << TableAligner::row()
+            << "boost::uint32_t "
+            << TableAligner::col()
+            << memberCapacity
+            << ";";
+    table() << TableAligner::row()
+            << "boost::uint32_t "
+            << TableAligner::col()
+            << memberReserved
+            << ";";
+    table() << TableAligner::row()
+            << "boost::uint32_t "
+            << TableAligner::col()
+            << memberReleased
+            << ";";
+    table() << TableAligner::row()
+            << "boost::uint32_t "
+            << TableAligner::col()
+            << memberTimeout
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+void CppShmChannelGenerator::generateMarshalling()
+{
+    cf::VariableNameSPtr memberData = frm->memberVariableName(cf::variableNameRef("data"));
+    
+    commentInLine(declarationStream,
+                  "Writes the arguments of a call directly in the place reserved in the "
+                  "ring. The plain values are copied as they are, the strings and the "
+                  "vectors are prefixed with their size.");
+    line()  << "class shm_writer";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "explicit shm_writer(char* data)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberData
+                                        << cf::parameterValueRef("data"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "static boost::uint32_t size(const T&)";
+    openBlock(declarationStream);
+    line()  << "return sizeof(T);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "static boost::uint32_t size(const std::string& value)";
+    openBlock(declarationStream);
+    line()  << "return sizeof(boost::uint32_t) + (boost::uint32_t)value.size();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "static boost::uint32_t size(const std::vector<T>& value)";
+    openBlock(declarationStream);
+    line()  << "return sizeof(boost::uint32_t) + (boost::uint32_t)(value.size() * sizeof(T));";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "void write(const T& value)";
+    openBlock(declarationStream);
+    line()  << "memcpy("
+            << memberData
+            << ", &value, sizeof(T));";
+    eol(declarationStream);
+    line()  << memberData
+            << " += sizeof(T);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void write(const std::string& value)";
+    openBlock(declarationStream);
+    line()  << "write((boost::uint32_t)value.size());";
+    eol(declarationStream);
+    line()  << "memcpy("
+            << memberData
+            << ", value.data(), value.size());";
+    eol(declarationStream);
+    line()  << memberData
+            << " += value.size();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "void write(const std::vector<T>& value)";
+    openBlock(declarationStream);
+    line()  << "write((boost::uint32_t)value.size());";
+    eol(declarationStream);
+    line()  << "if (value.empty()) return;";
+    eol(declarationStream);
+    line()  << "memcpy("
+            << memberData
+            << ", &value[0], value.size() * sizeof(T));";
+    eol(declarationStream);
+    line()  << memberData
+            << " += value.size() * sizeof(T);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    table() << TableAligner::row()
+            << "char* "
+            << TableAligner::col()
+            << memberData
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Reads the arguments of a call from the message in the ring");
+    line()  << "class shm_reader";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "explicit shm_reader(const char* data)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberData
+                                        << cf::parameterValueRef("data"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "void read(T& value)";
+    openBlock(declarationStream);
+    line()  << "memcpy(&value, "
+            << memberData
+            << ", sizeof(T));";
+    eol(declarationStream);
+    line()  << memberData
+            << " += sizeof(T);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void read(std::string& value)";
+    openBlock(declarationStream);
+    line()  << "boost::uint32_t size;";
+    eol(declarationStream);
+    line()  << "const char* data = view(size);";
+    eol(declarationStream);
+    line()  << "value.assign(data, size);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "void read(std::vector<T>& value)";
+    openBlock(declarationStream);
+    line()  << "boost::uint32_t size;";
+    eol(declarationStream);
+    line()  << "read(size);";
+    eol(declarationStream);
+    line()  << "value.resize(size);";
+    eol(declarationStream);
+    line()  << "if (value.empty()) return;";
+    eol(declarationStream);
+    line()  << "memcpy(&value[0], "
+            << memberData
+            << ", size * sizeof(T));";
+    eol(declarationStream);
+    line()  << memberData
+            << " += size * sizeof(T);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the bytes of a string or a vector in place, without copying "
+                  "them out of the ring. They are valid until the message is released.");
+    line()  << "const char* view(boost::uint32_t& size)";
+    openBlock(declarationStream);
+    line()  << "read(size);";
+    eol(declarationStream);
+    line()  << "const char* data = "
+            << memberData
+            << ";";
+    eol(declarationStream);
+    line()  << memberData
+            << " += size;";
+    eol(declarationStream);
+    line()  << "return data;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    table() << TableAligner::row()
+            << "const char* "
+            << TableAligner::col()
+            << memberData
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+void CppShmChannelGenerator::generateChannel()
+{
+    cf::VariableNameSPtr memberName = frm->memberVariableName(cf::variableNameRef("name"));
+    cf::VariableNameSPtr memberSide = frm->memberVariableName(cf::variableNameRef("side"));
+    cf::VariableNameSPtr memberRegion = frm->memberVariableName(cf::variableNameRef("region"));
+    cf::VariableNameSPtr memberRequests = frm->memberVariableName(cf::variableNameRef("requests"));
+    cf::VariableNameSPtr memberResponses = frm->memberVariableName(cf::variableNameRef("responses"));
+    
+    commentInLine(declarationStream,
+                  "Pair of rings in a named shared memory that connects a client and a "
+                  "server in different processes of the same host. The client writes the "
+                  "requests and reads the responses, the server does the opposite. Each "
+                  "side should be used from a single thread.");
+    line()  << "class shm_channel";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "enum side";
+    openBlock(declarationStream);
+    line()  << "server_side,";
+    eol(declarationStream);
+    line()  << "client_side";
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "The server creates the shared memory and the client opens it. The "
+                  "capacity of each ring is rounded up to a power of two. Throws "
+                  "boost::interprocess::interprocess_exception if the shared memory "
+                  "could not be created or opened. The waits for the other side throw "
+                  "shm_timeout_error after the timeout in milliseconds, 0 waits forever. "
+                  "A call of the client waits for the server as long as the method runs, "
+                  "so the timeout should be longer than the slowest method.");
+    line()  << "shm_channel(const char* name,";
+    eol(declarationStream);
+    line()  << "            side side,";
+    eol(declarationStream);
+    line()  << "            boost::uint32_t capacity = 1 << 20,";
+    eol(declarationStream);
+    line()  << "            boost::uint32_t timeout = 10000)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberName
+                                        << cf::parameterValueRef("name"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberSide
+                                        << cf::parameterValueRef("side"));
+    openBlock(declarationStream, 1);
+    line()  << "using namespace boost::interprocess;";
+    eol(declarationStream);
+    line()  << "if (side == server_side)";
+    openBlock(declarationStream);
+    line()  << "boost::uint32_t size = 64;";
+    eol(declarationStream);
+    line()  << "while (size < capacity)";
+    eol(declarationStream);
+    line()  << "size <<= 1;";
+    eol(declarationStream, 1);
+    line()  << "shared_memory_object::remove(name);";
+    eol(declarationStream);
+    line()  << "shared_memory_object memory(create_only, name, read_write);";
+    eol(declarationStream);
+    line()  << "memory.truncate(2 * (sizeof(shm_ring::header) + size));";
+    eol(declarationStream);
+    line()  << "mapped_region region(memory, read_write);";
+    eol(declarationStream);
+    line()  << memberRegion
+            << ".swap(region);";
+    closeBlock(declarationStream);
+    line()  << "else";
+    openBlock(declarationStream);
+    line()  << "shared_memory_object memory(open_only, name, read_write);";
+    eol(declarationStream);
+    line()  << "mapped_region region(memory, read_write);";
+    eol(declarationStream);
+    line()  << memberRegion
+            << ".swap(region);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "// the new shared memory is zero filled, so both rings start empty";
+    eol(declarationStream);
+    line()  << "char* base = static_cast<char*>("
+            << memberRegion
+            << ".get_address());";
+    eol(declarationStream);
+    line()  << "boost::uint32_t size = (boost::uint32_t)("
+            << memberRegion
+            << ".get_size() / 2 - sizeof(shm_ring::header));";
+    eol(declarationStream);
+    line()  << "char* second = base + sizeof(shm_ring::header) + size;";
+    eol(declarationStream);
+    line()  << memberRequests
+            << " = shm_ring((shm_ring::header*)base, base + sizeof(shm_ring::header), size, timeout);";
+    eol(declarationStream);
+    line()  << memberResponses
+            << " = shm_ring((shm_ring::header*)second, second + sizeof(shm_ring::header), size, timeout);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "The server removes the name of the shared memory");
+    line()  << "~shm_channel()";
+    openBlock(declarationStream);
+    line()  << "if ("
+            << memberSide
+            << " == server_side)";
+    eol(declarationStream);
+    line()  << "boost::interprocess::shared_memory_object::remove("
+            << memberName
+            << ".c_str());";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "shm_ring& requests()";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberRequests
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "shm_ring& responses()";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberResponses
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "shm_channel(const shm_channel&);";
+    eol(declarationStream);
+    line()  << "shm_channel& operator=(const shm_channel&);";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    table() << TableAligner::row()
+            << "std::string "
+            << TableAligner::col()
+            << memberName
+            << ";";
+    table() << TableAligner::row()
+            << "side "
+            << TableAligner::col()
+            << memberSide
+            << ";";
+    table() << TableAligner::row()
+            << "boost::interprocess::mapped_region "
+            << TableAligner::col()
+            << memberRegion
+            << ";";
+    table() << TableAligner::row()
+            << "shm_ring "
+            << TableAligner::col()
+            << memberRequests
+            << ";";
+    table() << TableAligner::row()
+            << "shm_ring "
+            << TableAligner::col()
+            << memberResponses
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+bool CppShmChannelGenerator::generate()
+{
+    addDependency(Dependency("boost",
+                             "cstdint.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Integer"));
+    // mapped_region.hpp of boost 1.52 uses assert without including it
+    addDependency(Dependency("",
+                             "assert.h",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Interprocess"));
+    addDependency(Dependency("boost",
+                             "interprocess/mapped_region.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Interprocess"));
+    addDependency(Dependency("boost",
+                             "interprocess/shared_memory_object.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Interprocess"));
+    addDependency(Dependency("boost",
+                             "smart_ptr/detail/yield_k.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Smart Pointers"));
+    addDependency(impl->cstring_dependency());
+    addDependency(Dependency("",
+                             "stdexcept",
+                             Dependency::system_type,
+                             Dependency::stl_level,
+                             Dependency::private_section,
+                             "Standard Template Library"));
+    addDependency(Dependency("",
+                             "string",
+                             Dependency::system_type,
+                             Dependency::stl_level,
+                             Dependency::private_section,
+                             "Standard Template Library"));
+    addDependency(Dependency("",
+                             "vector",
+                             Dependency::system_type,
+                             Dependency::stl_level,
+                             Dependency::private_section,
+                             "Standard Template Library"));
+    
+    includeHeaders(declarationStream, Dependency::global_section);
+    
+    std::string guard = frm->headerGuard("core/shm_channel.hpp");
+    
+    line()  << "#ifndef " 
+            << guard;
+    eol(declarationStream);
+    line()  << "#define " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    includeHeaders(declarationStream, Dependency::private_section);
+    
+    line()  << "#if defined(_WIN32)";
+    eol(declarationStream);
+    line()  << "#include <windows.h>";
+    eol(declarationStream);
+    eol(declarationStream);
+    generatePlatform(true);
+    line()  << "#else";
+    eol(declarationStream);
+    line()  << "#include <time.h>";
+    eol(declarationStream);
+    eol(declarationStream);
+    generatePlatform(false);
+    line()  << "#endif";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    generateRing();
+    generateMarshalling();
+    generateChannel();
+    
+    line()  << "#endif // " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+
+    return serializeStreams();
+}
+
+}
@@ -0,0 +1,473 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/cpp/c++_small_vector_generator.h"
+
+namespace cf = cpp::frm;
+
+namespace compil
+{
+    
+const int CppSmallVectorGenerator::declarationStream = 1;
+    
+CppSmallVectorGenerator::CppSmallVectorGenerator()
+{
+    for (int i = 0; i <= 1; ++i)
+    {
+        mStreams.push_back(boost::shared_ptr<std::stringstream>(new std::stringstream()));
+        mIndent.push_back(0);
+    }
+}
+
+CppSmallVectorGenerator::~CppSmallVectorGenerator()
+{
+}
+
+bool CppSmallVectorGenerator::generate()
+{
+    addDependency(Dependency("boost",
+                             "aligned_storage.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Type Traits"));
+    addDependency(Dependency("boost",
+                             "type_traits/alignment_of.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Type Traits"));
+    addDependency(Dependency("",
+                             "algorithm",
+                             Dependency::system_type,
+                             Dependency::stl_level,
+                             Dependency::private_section,
+                             "Standard Template Library"));
+    addDependency(Dependency("",
+                             "new",
+                             Dependency::system_type,
+                             Dependency::stl_level,
+                             Dependency::private_section,
+                             "Standard Template Library"));
+    
+    includeHeaders(declarationStream, Dependency::global_section);
+    
+    std::string guard = frm->headerGuard("core/small_vector.hpp");
+    
+    line()  << "#ifndef " 
+            << guard;
+    eol(declarationStream);
+    line()  << "#define " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    includeHeaders(declarationStream, Dependency::private_section);
+    
+    cf::ConstructorNameSPtr class_name = cf::constructorNameRef("small_vector");
+    cf::VariableNameSPtr memberBegin = frm->memberVariableName(cf::variableNameRef("begin"));
+    cf::VariableNameSPtr memberSize = frm->memberVariableName(cf::variableNameRef("size"));
+    cf::VariableNameSPtr memberCapacity = frm->memberVariableName(cf::variableNameRef("capacity"));
+    cf::VariableNameSPtr memberStorage = frm->memberVariableName(cf::variableNameRef("storage"));
+    
+    commentInLine(declarationStream,
+                  "Vector that keeps up to N elements inline in the object and allocates "
+                  "heap memory only when it grows beyond N elements. It implements the "
+                  "subset of the std::vector interface used by the generated code.");
+    line()  << "template<class "
+            << T->name()->value()
+            << ", size_t N>";
+    eol(declarationStream);
+    
+    line()  << "class "
+            << class_name;
+    openBlock(declarationStream);
+
+    line()  << "public:";
+    eol(declarationStream, -1);
+
+    line()  << "typedef T value_type;";
+    eol(declarationStream);
+    line()  << "typedef T& reference;";
+    eol(declarationStream);
+    line()  << "typedef const T& const_reference;";
+    eol(declarationStream);
+    line()  << "typedef T* iterator;";
+    eol(declarationStream);
+    line()  << "typedef const T* const_iterator;";
+    eol(declarationStream);
+    line()  << "typedef size_t size_type;";
+    eol(declarationStream);
+    eol(declarationStream);
+
+    fdef()  << (cf::constructorRef() << class_name);
+    eofd(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberBegin
+                                        << cf::parameterValueRef("inline_data()"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberSize
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberCapacity
+                                        << cf::parameterValueRef("N"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "small_vector(const small_vector& other)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberBegin
+                                        << cf::parameterValueRef("inline_data()"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberSize
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberCapacity
+                                        << cf::parameterValueRef("N"));
+    openBlock(declarationStream, 1);
+    line()  << "append(other.begin(), other.end());";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "~small_vector()";
+    openBlock(declarationStream);
+    line()  << "clear();";
+    eol(declarationStream);
+    line()  << "release();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "small_vector& operator=(const small_vector& other)";
+    openBlock(declarationStream);
+    line()  << "if (this != &other)";
+    openBlock(declarationStream);
+    line()  << "clear();";
+    eol(declarationStream);
+    line()  << "append(other.begin(), other.end());";
+    closeBlock(declarationStream);
+    line()  << "return *this;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "iterator begin() { return "
+            << memberBegin
+            << "; }";
+    eol(declarationStream);
+    line()  << "const_iterator begin() const { return "
+            << memberBegin
+            << "; }";
+    eol(declarationStream);
+    line()  << "iterator end() { return "
+            << memberBegin
+            << " + "
+            << memberSize
+            << "; }";
+    eol(declarationStream);
+    line()  << "const_iterator end() const { return "
+            << memberBegin
+            << " + "
+            << memberSize
+            << "; }";
+    eol(declarationStream);
+    eol(declarationStream);
+
+    line()  << "size_type size() const { return "
+            << memberSize
+            << "; }";
+    eol(declarationStream);
+    line()  << "size_type capacity() const { return "
+            << memberCapacity
+            << "; }";
+    eol(declarationStream);
+    line()  << "bool empty() const { return "
+            << memberSize
+            << " == 0; }";
+    eol(declarationStream);
+    eol(declarationStream);
+
+    commentInLine(declarationStream,
+                  "Returns true while the elements are stored inline in the object");
+    line()  << "bool is_inline() const { return "
+            << memberBegin
+            << " == inline_data(); }";
+    eol(declarationStream);
+    eol(declarationStream);
+
+    line()  << "reference operator[](size_type index) { return "
+            << memberBegin
+            << "[index]; }";
+    eol(declarationStream);
+    line()  << "const_reference operator[](size_type index) const { return "
+            << memberBegin
+            << "[index]; }";
+    eol(declarationStream);
+    line()  << "reference front() { return "
+            << memberBegin
+            << "[0]; }";
+    eol(declarationStream);
+    line()  << "const_reference front() const { return "
+            << memberBegin
+            << "[0]; }";
+    eol(declarationStream);
+    line()  << "reference back() { return "
+            << memberBegin
+            << "["
+            << memberSize
+            << " - 1]; }";
+    eol(declarationStream);
+    line()  << "const_reference back() const { return "
+            << memberBegin
+            << "["
+            << memberSize
+            << " - 1]; }";
+    eol(declarationStream);
+    eol(declarationStream);
+
+    line()  << "void push_back(const T& value)";
+    openBlock(declarationStream);
+    line()  << "if ("
+            << memberSize
+            << " == "
+            << memberCapacity
+            << ")";
+    openBlock(declarationStream);
+    line()  << "// the value could be an element of the vector";
+    eol(declarationStream);
+    line()  << "T copy(value);";
+    eol(declarationStream);
+    line()  << "reserve(2 * "
+            << memberCapacity
+            << ");";
+    eol(declarationStream);
+    line()  << "new ("
+            << memberBegin
+            << " + "
+            << memberSize
+            << ") T(copy);";
+    closeBlock(declarationStream);
+    line()  << "else";
+    eol(declarationStream);
+    line()  << "new ("
+            << memberBegin
+            << " + "
+            << memberSize
+            << ") T(value);";
+    eol(declarationStream, 1);
+    line()  << "++"
+            << memberSize
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "void pop_back()";
+    openBlock(declarationStream);
+    line()  << "--"
+            << memberSize
+            << ";";
+    eol(declarationStream);
+    line()  << "("
+            << memberBegin
+            << " + "
+            << memberSize
+            << ")->~T();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "void clear()";
+    openBlock(declarationStream);
+    line()  << "while ("
+            << memberSize
+            << " > 0)";
+    eol(declarationStream);
+    line()  << "pop_back();";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    commentInLine(declarationStream,
+                  "Moves the elements to the heap when the capacity grows beyond the "
+                  "inline capacity. The inline storage is not reused after that.");
+    line()  << "void reserve(size_type capacity)";
+    openBlock(declarationStream);
+    line()  << "if (capacity <= "
+            << memberCapacity
+            << ") return;";
+    eol(declarationStream);
+    line()  << "T* begin = static_cast<T*>(::operator new(capacity * sizeof(T)));";
+    eol(declarationStream);
+    line()  << "for (size_type i = 0; i < "
+            << memberSize
+            << "; ++i)";
+    openBlock(declarationStream);
+    line()  << "new (begin + i) T("
+            << memberBegin
+            << "[i]);";
+    eol(declarationStream);
+    line()  << "("
+            << memberBegin
+            << " + i)->~T();";
+    closeBlock(declarationStream);
+    line()  << "release();";
+    eol(declarationStream);
+    line()  << memberBegin
+            << " = begin;";
+    eol(declarationStream);
+    line()  << memberCapacity
+            << " = capacity;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "void resize(size_type size, const T& value = T())";
+    openBlock(declarationStream);
+    line()  << "while ("
+            << memberSize
+            << " > size)";
+    eol(declarationStream);
+    line()  << "pop_back();";
+    eol(declarationStream, 1);
+    line()  << "reserve(size);";
+    eol(declarationStream);
+    line()  << "for (; "
+            << memberSize
+            << " < size; ++"
+            << memberSize
+            << ")";
+    eol(declarationStream);
+    line()  << "new ("
+            << memberBegin
+            << " + "
+            << memberSize
+            << ") T(value);";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "bool operator==(const small_vector& other) const";
+    openBlock(declarationStream);
+    line()  << "return "
+            << memberSize
+            << " == other."
+            << memberSize
+            << " && std::equal(begin(), end(), other.begin());";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "bool operator!=(const small_vector& other) const";
+    openBlock(declarationStream);
+    line()  << "return !operator==(other);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "bool operator<(const small_vector& other) const";
+    openBlock(declarationStream);
+    line()  << "return std::lexicographical_compare(begin(), end(), other.begin(), other.end());";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "private:";
+    eol(declarationStream, -1);
+
+    line()  << "T* inline_data() { return static_cast<T*>("
+            << memberStorage
+            << ".address()); }";
+    eol(declarationStream);
+    line()  << "const T* inline_data() const { return static_cast<const T*>("
+            << memberStorage
+            << ".address()); }";
+    eol(declarationStream);
+    eol(declarationStream);
+
+    line()  << "void release()";
+    openBlock(declarationStream);
+    line()  << "if (!is_inline())";
+    eol(declarationStream);
+    line()  << "::operator delete("
+            << memberBegin
+            << ");";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "void append(const_iterator first, const_iterator last)";
+    openBlock(declarationStream);
+    line()  << "reserve("
+            << memberSize
+            << " + (last - first));";
+    eol(declarationStream);
+    line()  << "for (; first != last; ++first, ++"
+            << memberSize
+            << ")";
+    eol(declarationStream);
+    line()  << "new ("
+            << memberBegin
+            << " + "
+            << memberSize
+            << ") T(*first);";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+
+    line()  << "T* "
+            << memberBegin
+            << ";";
+    eol(declarationStream);
+    line()  << "size_type "
+            << memberSize
+            << ";";
+    eol(declarationStream);
+    line()  << "size_type "
+            << memberCapacity
+            << ";";
+    eol(declarationStream);
+    line()  << "boost::aligned_storage<N * sizeof(T), boost::alignment_of<T>::value> "
+            << memberStorage
+            << ";";
+    eol(declarationStream);
+
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    line()  << "#endif // " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+
+    return serializeStreams();
+}
+
+}
@@ -0,0 +1,755 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/cpp/c++_snapshot_generator.h"
+
+namespace cf = cpp::frm;
+
+namespace compil
+{
+    
+const int CppSnapshotGenerator::declarationStream = 1;
+    
+CppSnapshotGenerator::CppSnapshotGenerator()
+{
+    for (int i = 0; i <= 1; ++i)
+    {
+        mStreams.push_back(boost::shared_ptr<std::stringstream>(new std::stringstream()));
+        mIndent.push_back(0);
+    }
+}
+
+CppSnapshotGenerator::~CppSnapshotGenerator()
+{
+}
+
+void CppSnapshotGenerator::generatePlatform(bool windows)
+{
+    commentInLine(declarationStream,
+                  "Exchanges the pointer atomically. It is a full memory barrier.");
+    line()  << "inline void* snapshot_exchange(void* volatile* target, void* value)";
+    openBlock(declarationStream);
+    if (windows)
+    {
+        line()  << "return InterlockedExchangePointer(target, value);";
+    }
+    else
+    {
+        line()  << "// the builtin alone is only an acquire barrier";
+        eol(declarationStream);
+        line()  << "__sync_synchronize();";
+        eol(declarationStream);
+        line()  << "return __sync_lock_test_and_set(target, value);";
+    }
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Sets the target to the value if it is equal to the expected one. It is "
+                  "a full memory barrier.");
+    line()  << "inline bool snapshot_compare_exchange(volatile long* target, long expected, long value)";
+    openBlock(declarationStream);
+    if (windows)
+        line()  << "return InterlockedCompareExchange(target, value, expected) == expected;";
+    else
+        line()  << "return __sync_bool_compare_and_swap(target, expected, value);";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Orders the memory accesses before and after it");
+    line()  << "inline void snapshot_barrier()";
+    openBlock(declarationStream);
+    if (windows)
+        line()  << "MemoryBarrier();";
+    else
+        line()  << "__sync_synchronize();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+}
+
+void CppSnapshotGenerator::generateSlot()
+{
+    cf::VariableNameSPtr memberUsed = frm->memberVariableName(cf::variableNameRef("used"));
+    cf::VariableNameSPtr memberEpoch = frm->memberVariableName(cf::variableNameRef("epoch"));
+    cf::VariableNameSPtr memberDepth = frm->memberVariableName(cf::variableNameRef("depth"));
+    cf::VariableNameSPtr memberPadding = frm->memberVariableName(cf::variableNameRef("padding"));
+    
+    commentInLine(declarationStream,
+                  "Epoch announced by a reader of a snapshot. The epoch is 0 when the "
+                  "reader is not in a view. The slots are 64 bytes long and the snapshot "
+                  "aligns them to 64 bytes, so every slot takes its own cache line and the "
+                  "readers do not write to shared memory.");
+    line()  << "struct snapshot_slot";
+    openBlock(declarationStream);
+    table() << TableAligner::row()
+            << "volatile long "
+            << TableAligner::col()
+            << memberUsed
+            << ";";
+    table() << TableAligner::row()
+            << "volatile long "
+            << TableAligner::col()
+            << memberEpoch
+            << ";";
+    table() << TableAligner::row()
+            << "long "
+            << TableAligner::col()
+            << memberDepth
+            << ";";
+    table() << TableAligner::row()
+            << "char "
+            << TableAligner::col()
+            << memberPadding
+            << "[64 - 3 * sizeof(long)];";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+void CppSnapshotGenerator::generateSnapshot()
+{
+    cf::VariableNameSPtr memberUsed = frm->memberVariableName(cf::variableNameRef("used"));
+    cf::VariableNameSPtr memberEpoch = frm->memberVariableName(cf::variableNameRef("epoch"));
+    cf::VariableNameSPtr memberDepth = frm->memberVariableName(cf::variableNameRef("depth"));
+    cf::VariableNameSPtr memberObject = frm->memberVariableName(cf::variableNameRef("object"));
+    cf::VariableNameSPtr memberNext = frm->memberVariableName(cf::variableNameRef("next"));
+    cf::VariableNameSPtr memberHolder = frm->memberVariableName(cf::variableNameRef("holder"));
+    cf::VariableNameSPtr memberSlot = frm->memberVariableName(cf::variableNameRef("slot"));
+    cf::VariableNameSPtr memberVersion = frm->memberVariableName(cf::variableNameRef("version"));
+    cf::VariableNameSPtr memberCurrent = frm->memberVariableName(cf::variableNameRef("current"));
+    cf::VariableNameSPtr memberRetired = frm->memberVariableName(cf::variableNameRef("retired"));
+    cf::VariableNameSPtr memberLock = frm->memberVariableName(cf::variableNameRef("lock"));
+    cf::VariableNameSPtr memberMemory = frm->memberVariableName(cf::variableNameRef("memory"));
+    cf::VariableNameSPtr memberSlots = frm->memberVariableName(cf::variableNameRef("slots"));
+    cf::VariableNameSPtr memberSlotCount = frm->memberVariableName(cf::variableNameRef("slotCount"));
+    
+    commentInLine(declarationStream,
+                  "Holder of the current version of an immutable object. The readers get "
+                  "the current version wait-free - a view only announces the epoch of its "
+                  "reader and loads a pointer, it never takes a lock and never touches a "
+                  "reference count. The writers publish the new versions under a spin "
+                  "lock. A replaced version is retired with the epoch of its replacement "
+                  "and released once no reader announces that or an earlier epoch.");
+    line()  << "template<class T>";
+    eol(declarationStream);
+    line()  << "class snapshot";
+    openBlock(declarationStream);
+    line()  << "struct version;";
+    eol(declarationStream);
+    eol(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "typedef boost::shared_ptr<T> pointer;";
+    eol(declarationStream);
+    eol(declarationStream);
+    line()  << "class view;";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    // reader
+    commentInLine(declarationStream,
+                  "Registration of a reader thread. It holds one of the reader slots of "
+                  "the snapshot and should not be shared between threads. Throws "
+                  "std::length_error when all the slots are taken.");
+    line()  << "class reader";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "explicit reader(snapshot& holder)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberHolder
+                                        << cf::parameterValueRef("holder"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberSlot
+                                        << cf::parameterValueRef("holder.acquire()"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "~reader()";
+    openBlock(declarationStream);
+    line()  << memberHolder
+            << ".release("
+            << memberSlot
+            << ");";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "friend class snapshot<T>::view;";
+    eol(declarationStream);
+    eol(declarationStream);
+    line()  << "reader(const reader&);";
+    eol(declarationStream);
+    line()  << "reader& operator=(const reader&);";
+    eol(declarationStream);
+    eol(declarationStream);
+    table() << TableAligner::row()
+            << "snapshot& "
+            << TableAligner::col()
+            << memberHolder
+            << ";";
+    table() << TableAligner::row()
+            << "snapshot_slot* "
+            << TableAligner::col()
+            << memberSlot
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    // view
+    commentInLine(declarationStream,
+                  "Read section of a reader. The version seen by the view is not released "
+                  "before the view is destroyed. The views of a reader can be nested.");
+    line()  << "class view";
+    openBlock(declarationStream);
+    line()  << "public:";
+    eol(declarationStream, -1);
+    line()  << "explicit view(reader& owner)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberSlot
+                                        << cf::parameterValueRef("owner." + memberSlot->value()));
+    openBlock(declarationStream, 1);
+    line()  << "if (!"
+            << memberSlot
+            << "->"
+            << memberDepth
+            << "++)";
+    openBlock(declarationStream);
+    line()  << memberSlot
+            << "->"
+            << memberEpoch
+            << " = owner."
+            << memberHolder
+            << "."
+            << memberEpoch
+            << ";";
+    eol(declarationStream);
+    line()  << "// the epoch should be visible before the version is loaded";
+    eol(declarationStream);
+    line()  << "snapshot_barrier();";
+    closeBlock(declarationStream);
+    line()  << memberVersion
+            << " = owner."
+            << memberHolder
+            << "."
+            << memberCurrent
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "~view()";
+    openBlock(declarationStream);
+    line()  << "if (!--"
+            << memberSlot
+            << "->"
+            << memberDepth
+            << ")";
+    openBlock(declarationStream);
+    line()  << "// the version should not be used after the epoch is cleared";
+    eol(declarationStream);
+    line()  << "snapshot_barrier();";
+    eol(declarationStream);
+    line()  << memberSlot
+            << "->"
+            << memberEpoch
+            << " = 0;";
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "const T* get() const { return "
+            << memberVersion
+            << "->"
+            << memberObject
+            << ".get(); }";
+    eol(declarationStream);
+    line()  << "const T& operator*() const { return *get(); }";
+    eol(declarationStream);
+    line()  << "const T* operator->() const { return get(); }";
+    eol(declarationStream);
+    eol(declarationStream);
+    commentInLine(declarationStream,
+                  "Shares the ownership of the version beyond the view");
+    line()  << "pointer share() const { return "
+            << memberVersion
+            << "->"
+            << memberObject
+            << "; }";
+    eol(declarationStream);
+    eol(declarationStream);
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "view(const view&);";
+    eol(declarationStream);
+    line()  << "view& operator=(const view&);";
+    eol(declarationStream);
+    eol(declarationStream);
+    table() << TableAligner::row()
+            << "snapshot_slot* "
+            << TableAligner::col()
+            << memberSlot
+            << ";";
+    table() << TableAligner::row()
+            << "version* "
+            << TableAligner::col()
+            << memberVersion
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    // snapshot
+    commentInLine(declarationStream,
+                  "The readers registered at the same time could not exceed the number "
+                  "of the slots");
+    line()  << "explicit snapshot(const pointer& object = pointer(), size_t readers = 64)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberCurrent
+                                        << cf::parameterValueRef("new version(object)"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberRetired
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberEpoch
+                                        << cf::parameterValueRef("1"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberLock
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberMemory
+                                        << cf::parameterValueRef("new char[readers * sizeof(snapshot_slot) + 63]"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberSlots
+                                        << cf::parameterValueRef("(snapshot_slot*)(((size_t)" + memberMemory->value() + " + 63) & ~(size_t)63)"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberSlotCount
+                                        << cf::parameterValueRef("readers"));
+    openBlock(declarationStream, 1);
+    line()  << "for (size_t i = 0; i < readers; ++i)";
+    openBlock(declarationStream);
+    line()  << memberSlots
+            << "[i]."
+            << memberUsed
+            << " = 0;";
+    eol(declarationStream);
+    line()  << memberSlots
+            << "[i]."
+            << memberEpoch
+            << " = 0;";
+    eol(declarationStream);
+    line()  << memberSlots
+            << "[i]."
+            << memberDepth
+            << " = 0;";
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "There should be no readers left");
+    line()  << "~snapshot()";
+    openBlock(declarationStream);
+    line()  << "delete "
+            << memberCurrent
+            << ";";
+    eol(declarationStream);
+    line()  << "while ("
+            << memberRetired
+            << ")";
+    openBlock(declarationStream);
+    line()  << "version* retired = "
+            << memberRetired
+            << ";";
+    eol(declarationStream);
+    line()  << memberRetired
+            << " = retired->"
+            << memberNext
+            << ";";
+    eol(declarationStream);
+    line()  << "delete retired;";
+    closeBlock(declarationStream);
+    line()  << "delete[] "
+            << memberMemory
+            << ";";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Publishes a new version, e.g. the result of Builder::finalize(). The "
+                  "views see either the previous or the new version. The versions that no "
+                  "reader can see anymore are released.");
+    line()  << "void publish(const pointer& object)";
+    openBlock(declarationStream);
+    line()  << "version* fresh = new version(object);";
+    eol(declarationStream);
+    line()  << "lock();";
+    eol(declarationStream);
+    line()  << "version* previous = (version*)snapshot_exchange((void* volatile*)&"
+            << memberCurrent
+            << ", fresh);";
+    eol(declarationStream);
+    line()  << "previous->"
+            << memberEpoch
+            << " = "
+            << memberEpoch
+            << ";";
+    eol(declarationStream);
+    line()  << "previous->"
+            << memberNext
+            << " = "
+            << memberRetired
+            << ";";
+    eol(declarationStream);
+    line()  << memberRetired
+            << " = previous;";
+    eol(declarationStream);
+    line()  << memberEpoch
+            << " = "
+            << memberEpoch
+            << " + 1;";
+    eol(declarationStream);
+    line()  << "collect();";
+    eol(declarationStream);
+    line()  << "unlock();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Returns the current version. It takes the lock of the writers, the "
+                  "readers should use a view instead.");
+    line()  << "pointer current()";
+    openBlock(declarationStream);
+    line()  << "lock();";
+    eol(declarationStream);
+    line()  << "pointer object = "
+            << memberCurrent
+            << "->"
+            << memberObject
+            << ";";
+    eol(declarationStream);
+    line()  << "unlock();";
+    eol(declarationStream);
+    line()  << "return object;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "Releases the retired versions that no reader can see anymore");
+    line()  << "void reclaim()";
+    openBlock(declarationStream);
+    line()  << "lock();";
+    eol(declarationStream);
+    line()  << "snapshot_barrier();";
+    eol(declarationStream);
+    line()  << "collect();";
+    eol(declarationStream);
+    line()  << "unlock();";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "private:";
+    eol(declarationStream, -1);
+    line()  << "friend class reader;";
+    eol(declarationStream);
+    line()  << "friend class view;";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "struct version";
+    openBlock(declarationStream);
+    line()  << "explicit version(const pointer& object)";
+    eol(declarationStream);
+    line()  << ": " 
+            << (cf::initializationRef() << memberObject
+                                        << cf::parameterValueRef("object"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberEpoch
+                                        << cf::parameterValueRef("0"));
+    eol(declarationStream, 1);
+    line()  << ", " 
+            << (cf::initializationRef() << memberNext
+                                        << cf::parameterValueRef("0"));
+    openBlock(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    table() << TableAligner::row()
+            << "pointer "
+            << TableAligner::col()
+            << memberObject
+            << ";";
+    table() << TableAligner::row()
+            << "long "
+            << TableAligner::col()
+            << memberEpoch
+            << ";";
+    table() << TableAligner::row()
+            << "version* "
+            << TableAligner::col()
+            << memberNext
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+    
+    line()  << "snapshot(const snapshot&);";
+    eol(declarationStream);
+    line()  << "snapshot& operator=(const snapshot&);";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "snapshot_slot* acquire()";
+    openBlock(declarationStream);
+    line()  << "for (size_t i = 0; i < "
+            << memberSlotCount
+            << "; ++i)";
+    openBlock(declarationStream);
+    line()  << "if (snapshot_compare_exchange(&"
+            << memberSlots
+            << "[i]."
+            << memberUsed
+            << ", 0, 1))";
+    eol(declarationStream);
+    line()  << "return &"
+            << memberSlots
+            << "[i];";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    line()  << "throw std::length_error(\"snapshot: there are more readers than slots\");";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void release(snapshot_slot* slot)";
+    openBlock(declarationStream);
+    line()  << "BOOST_ASSERT(!slot->"
+            << memberDepth
+            << " && \"the reader has views\");";
+    eol(declarationStream);
+    line()  << "snapshot_barrier();";
+    eol(declarationStream);
+    line()  << "slot->"
+            << memberUsed
+            << " = 0;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    commentInLine(declarationStream,
+                  "A version retired in an epoch is visible only to the readers that "
+                  "announced the same or an earlier epoch");
+    line()  << "void collect()";
+    openBlock(declarationStream);
+    line()  << "long oldest = "
+            << memberEpoch
+            << ";";
+    eol(declarationStream);
+    line()  << "for (size_t i = 0; i < "
+            << memberSlotCount
+            << "; ++i)";
+    openBlock(declarationStream);
+    line()  << "long epoch = "
+            << memberSlots
+            << "[i]."
+            << memberEpoch
+            << ";";
+    eol(declarationStream);
+    line()  << "if (epoch && epoch < oldest)";
+    eol(declarationStream);
+    line()  << "oldest = epoch;";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    line()  << "version** link = &"
+            << memberRetired
+            << ";";
+    eol(declarationStream);
+    line()  << "while (*link)";
+    openBlock(declarationStream);
+    line()  << "version* retired = *link;";
+    eol(declarationStream);
+    line()  << "if (retired->"
+            << memberEpoch
+            << " < oldest)";
+    openBlock(declarationStream);
+    line()  << "*link = retired->"
+            << memberNext
+            << ";";
+    eol(declarationStream);
+    line()  << "delete retired;";
+    closeBlock(declarationStream);
+    line()  << "else";
+    openBlock(declarationStream);
+    line()  << "link = &retired->"
+            << memberNext
+            << ";";
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void lock()";
+    openBlock(declarationStream);
+    line()  << "for (unsigned k = 0; !snapshot_compare_exchange(&"
+            << memberLock
+            << ", 0, 1); ++k)";
+    eol(declarationStream);
+    line()  << "boost::detail::yield(k);";
+    eol(declarationStream, 1);
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    line()  << "void unlock()";
+    openBlock(declarationStream);
+    line()  << "snapshot_barrier();";
+    eol(declarationStream);
+    line()  << memberLock
+            << " = 0;";
+    closeBlock(declarationStream);
+    eol(declarationStream);
+    
+    table() << TableAligner::row()
+            << "version* volatile "
+            << TableAligner::col()
+            << memberCurrent
+            << ";";
+    table() << TableAligner::row()
+            << "version* "
+            << TableAligner::col()
+            << memberRetired
+            << ";";
+    table() << TableAligner::row()
+            << "volatile long "
+            << TableAligner::col()
+            << memberEpoch
+            << ";";
+    table() << TableAligner::row()
+            << "volatile long "
+            << TableAligner::col()
+            << memberLock
+            << ";";
+    table() << TableAligner::row()
+            << "char* "
+            << TableAligner::col()
+            << memberMemory
+            << ";";
+    table() << TableAligner::row()
+            << "snapshot_slot* "
+            << TableAligner::col()
+            << memberSlots
+            << ";";
+    table() << TableAligner::row()
+            << "size_t "
+            << TableAligner::col()
+            << memberSlotCount
+            << ";";
+    eot(declarationStream);
+    closeBlock(declarationStream, "};");
+    eol(declarationStream);
+}
+
+bool CppSnapshotGenerator::generate()
+{
+    addDependency(Dependency("boost",
+                             "assert.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Utility"));
+    addDependency(Dependency("boost",
+                             "shared_ptr.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Smart Pointers"));
+    addDependency(Dependency("boost",
+                             "smart_ptr/detail/yield_k.hpp",
+                             Dependency::system_type,
+                             Dependency::thirdparty_level,
+                             Dependency::private_section,
+                             "Boost C++ Smart Pointers"));
+    addDependency(impl->stddef_dependency());
+    addDependency(Dependency("",
+                             "stdexcept",
+                             Dependency::system_type,
+                             Dependency::stl_level,
+                             Dependency::private_section,
+                             "Standard Template Library"));
+    
+    includeHeaders(declarationStream, Dependency::global_section);
+    
+    std::string guard = frm->headerGuard("core/snapshot.hpp");
+    
+    line()  << "#ifndef " 
+            << guard;
+    eol(declarationStream);
+    line()  << "#define " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    includeHeaders(declarationStream, Dependency::private_section);
+    
+    line()  << "#if defined(_WIN32)";
+    eol(declarationStream);
+    line()  << "#include <windows.h>";
+    eol(declarationStream);
+    eol(declarationStream);
+    generatePlatform(true);
+    line()  << "#else";
+    eol(declarationStream);
+    eol(declarationStream);
+    generatePlatform(false);
+    line()  << "#endif";
+    eol(declarationStream);
+    eol(declarationStream);
+    
+    generateSlot();
+    generateSnapshot();
+    
+    line()  << "#endif // " 
+            << guard;
+    eol(declarationStream);
+    eol(declarationStream);
+
+    return serializeStreams();
+}
+
+}
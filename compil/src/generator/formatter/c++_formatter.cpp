@@ -417,6 +417,145 @@ cpp::frm::TypeSPtr CppFormatter::cppPartialClassType(const StructureSPtr& pStruc
     return cpp::frm::typeRef() << cpp::frm::typeNameRef(cppClassName(pStructure->name()->value() + "Partial"));
 }
 
+cpp::frm::TypeSPtr CppFormatter::cppColumnsClassType(const StructureSPtr& pStructure)
+{
+    return cpp::frm::typeRef() << cppPackageNamespace(pStructure->package())
+                               << cpp::frm::typeNameRef(cppClassName(pStructure->name()->value() + "Columns"));
+}
+
+cpp::frm::NamespaceSPtr CppFormatter::cppColumnsClassNamespace(const StructureSPtr& pStructure)
+{
+    cpp::frm::NamespaceSPtr nmspace = cpp::frm::namespaceRef();
+    nmspace << cpp::frm::namespaceNameRef(cppColumnsClassType(pStructure)->name()->value());
+    return nmspace;
+}
+
+cpp::frm::ConstructorNameSPtr CppFormatter::cppColumnsConstructorName(const StructureSPtr& pStructure)
+{
+    return cpp::frm::constructorNameRef(cppColumnsClassType(pStructure)->name()->value());
+}
+
+cpp::frm::DestructorNameSPtr CppFormatter::cppColumnsDestructorName(const StructureSPtr& pStructure)
+{
+    return cpp::frm::destructorNameRef(cppColumnsClassType(pStructure)->name()->value());
+}
+
+cpp::frm::VariableNameSPtr CppFormatter::cppColumnsAvailableMemberName(const FieldSPtr& pField)
+{
+    return cpp::frm::variableNameRef(memberName(pField->name()->value() + "Availability"));
+}
+
+cpp::frm::TypeSPtr CppFormatter::cppVisitorClassType(const StructureSPtr& pStructure)
+{
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef(cppClassName(pStructure->name()->value() + "Visitor"));
+}
+
+cpp::frm::TypeSPtr CppFormatter::cppSnapshotClassType(const StructureSPtr& pStructure)
+{
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef(cppClassName(pStructure->name()->value() + "Snapshot"));
+}
+
+cpp::frm::DestructorNameSPtr CppFormatter::cppVisitorDestructorName(const StructureSPtr& pStructure)
+{
+    return cpp::frm::destructorNameRef(cppVisitorClassType(pStructure)->name()->value());
+}
+
+cpp::frm::TypeSPtr CppFormatter::cppInterfaceClassType(const InterfaceSPtr& pInterface)
+{
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef(cppClassName(pInterface->name()->value()));
+}
+
+cpp::frm::NamespaceSPtr CppFormatter::cppInterfaceClassNamespace(const InterfaceSPtr& pInterface)
+{
+    cpp::frm::NamespaceSPtr nmspace = cpp::frm::namespaceRef();
+    nmspace << cpp::frm::namespaceNameRef(cppInterfaceClassType(pInterface)->name()->value());
+    return nmspace;
+}
+
+cpp::frm::DestructorNameSPtr CppFormatter::cppInterfaceDestructorName(const InterfaceSPtr& pInterface)
+{
+    return cpp::frm::destructorNameRef(cppInterfaceClassType(pInterface)->name()->value());
+}
+
+cpp::frm::TypeSPtr CppFormatter::cppProxyClassType(const InterfaceSPtr& pInterface)
+{
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef(cppClassName(pInterface->name()->value() + "Proxy"));
+}
+
+cpp::frm::NamespaceSPtr CppFormatter::cppProxyClassNamespace(const InterfaceSPtr& pInterface)
+{
+    cpp::frm::NamespaceSPtr nmspace = cpp::frm::namespaceRef();
+    nmspace << cpp::frm::namespaceNameRef(cppProxyClassType(pInterface)->name()->value());
+    return nmspace;
+}
+
+cpp::frm::ConstructorNameSPtr CppFormatter::cppProxyConstructorName(const InterfaceSPtr& pInterface)
+{
+    return cpp::frm::constructorNameRef(cppProxyClassType(pInterface)->name()->value());
+}
+
+cpp::frm::TypeSPtr CppFormatter::cppShmClientClassType(const InterfaceSPtr& pInterface)
+{
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef(cppClassName(pInterface->name()->value() + "ShmClient"));
+}
+
+cpp::frm::NamespaceSPtr CppFormatter::cppShmClientClassNamespace(const InterfaceSPtr& pInterface)
+{
+    cpp::frm::NamespaceSPtr nmspace = cpp::frm::namespaceRef();
+    nmspace << cpp::frm::namespaceNameRef(cppShmClientClassType(pInterface)->name()->value());
+    return nmspace;
+}
+
+cpp::frm::ConstructorNameSPtr CppFormatter::cppShmClientConstructorName(const InterfaceSPtr& pInterface)
+{
+    return cpp::frm::constructorNameRef(cppShmClientClassType(pInterface)->name()->value());
+}
+
+cpp::frm::TypeSPtr CppFormatter::cppShmServerClassType(const InterfaceSPtr& pInterface)
+{
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef(cppClassName(pInterface->name()->value() + "ShmServer"));
+}
+
+cpp::frm::NamespaceSPtr CppFormatter::cppShmServerClassNamespace(const InterfaceSPtr& pInterface)
+{
+    cpp::frm::NamespaceSPtr nmspace = cpp::frm::namespaceRef();
+    nmspace << cpp::frm::namespaceNameRef(cppShmServerClassType(pInterface)->name()->value());
+    return nmspace;
+}
+
+cpp::frm::ConstructorNameSPtr CppFormatter::cppShmServerConstructorName(const InterfaceSPtr& pInterface)
+{
+    return cpp::frm::constructorNameRef(cppShmServerClassType(pInterface)->name()->value());
+}
+
+cpp::frm::TypeSPtr CppFormatter::cppStubClassType(const MethodSPtr& pMethod)
+{
+    InterfaceSPtr pInterface = pMethod->interface_().lock();
+    std::string method = pMethod->name()->value();
+    std::transform(method.begin() + 0, method.begin() + 1, method.begin() + 0, toupper);
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef(cppClassName(pInterface->name()->value() + method + "Stub"));
+}
+
+cpp::frm::ConstructorNameSPtr CppFormatter::cppStubConstructorName(const MethodSPtr& pMethod)
+{
+    return cpp::frm::constructorNameRef(cppStubClassType(pMethod)->name()->value());
+}
+
+cpp::frm::MethodNameSPtr CppFormatter::cppMethodName(const MethodSPtr& pMethod)
+{
+    return methodName(pMethod->name()->value());
+}
+
+cpp::frm::VariableNameSPtr CppFormatter::cppVariableName(const ParameterSPtr& pParameter)
+{
+    return cpp::frm::variableNameRef(name(pParameter->name()->value()));
+}
+
+cpp::frm::VariableNameSPtr CppFormatter::cppMemberVariableName(const ParameterSPtr& pParameter)
+{
+    return cpp::frm::variableNameRef(memberName(pParameter->name()->value()));
+}
+
 std::string CppFormatter::constValueName(const EnumerationValueSPtr& pEnumerationValue)
 {
     return constName(pEnumerationValue->name()->value() + "_value");
@@ -584,6 +723,11 @@ cpp::frm::MethodNameSPtr CppFormatter::changedMethodName(const FieldSPtr& pField
     return methodName("changed_" + pField->name()->value());
 }
 
+cpp::frm::MethodNameSPtr CppFormatter::modifiedMethodName(const FieldSPtr& pField)
+{
+    return methodName("modified_" + pField->name()->value());
+}
+
 cpp::frm::MethodNameSPtr CppFormatter::validMethodName(const FieldSPtr& pField)
 {
     return methodName("valid_" + pField->name()->value());
@@ -127,6 +127,39 @@ public:
     
     virtual cpp::frm::TypeSPtr cppPartialClassType(const StructureSPtr& pStructure);
     
+    virtual cpp::frm::TypeSPtr cppColumnsClassType(const StructureSPtr& pStructure);
+    virtual cpp::frm::NamespaceSPtr cppColumnsClassNamespace(const StructureSPtr& pStructure);
+    virtual cpp::frm::ConstructorNameSPtr cppColumnsConstructorName(const StructureSPtr& pStructure);
+    virtual cpp::frm::DestructorNameSPtr cppColumnsDestructorName(const StructureSPtr& pStructure);
+    virtual cpp::frm::VariableNameSPtr cppColumnsAvailableMemberName(const FieldSPtr& pField);
+    
+    virtual cpp::frm::TypeSPtr cppVisitorClassType(const StructureSPtr& pStructure);
+    virtual cpp::frm::TypeSPtr cppSnapshotClassType(const StructureSPtr& pStructure);
+    virtual cpp::frm::DestructorNameSPtr cppVisitorDestructorName(const StructureSPtr& pStructure);
+    
+    virtual cpp::frm::TypeSPtr cppInterfaceClassType(const InterfaceSPtr& pInterface);
+    virtual cpp::frm::NamespaceSPtr cppInterfaceClassNamespace(const InterfaceSPtr& pInterface);
+    virtual cpp::frm::DestructorNameSPtr cppInterfaceDestructorName(const InterfaceSPtr& pInterface);
+    
+    virtual cpp::frm::TypeSPtr cppProxyClassType(const InterfaceSPtr& pInterface);
+    virtual cpp::frm::NamespaceSPtr cppProxyClassNamespace(const InterfaceSPtr& pInterface);
+    virtual cpp::frm::ConstructorNameSPtr cppProxyConstructorName(const InterfaceSPtr& pInterface);
+    
+    virtual cpp::frm::TypeSPtr cppShmClientClassType(const InterfaceSPtr& pInterface);
+    virtual cpp::frm::NamespaceSPtr cppShmClientClassNamespace(const InterfaceSPtr& pInterface);
+    virtual cpp::frm::ConstructorNameSPtr cppShmClientConstructorName(const InterfaceSPtr& pInterface);
+    
+    virtual cpp::frm::TypeSPtr cppShmServerClassType(const InterfaceSPtr& pInterface);
+    virtual cpp::frm::NamespaceSPtr cppShmServerClassNamespace(const InterfaceSPtr& pInterface);
+    virtual cpp::frm::ConstructorNameSPtr cppShmServerConstructorName(const InterfaceSPtr& pInterface);
+    
+    virtual cpp::frm::TypeSPtr cppStubClassType(const MethodSPtr& pMethod);
+    virtual cpp::frm::ConstructorNameSPtr cppStubConstructorName(const MethodSPtr& pMethod);
+    
+    virtual cpp::frm::MethodNameSPtr cppMethodName(const MethodSPtr& pMethod);
+    virtual cpp::frm::VariableNameSPtr cppVariableName(const ParameterSPtr& pParameter);
+    virtual cpp::frm::VariableNameSPtr cppMemberVariableName(const ParameterSPtr& pParameter);
+    
     virtual std::string constValueName(const EnumerationValueSPtr& pEnumerationValue);
     virtual std::string enumValueName(const EnumerationValueSPtr& pEnumerationValue);
     
@@ -162,6 +195,7 @@ public:
     virtual cpp::frm::MethodNameSPtr existMethodName(const FieldSPtr& pField);
     virtual cpp::frm::MethodNameSPtr validMethodName(const FieldSPtr& pField);
     virtual cpp::frm::MethodNameSPtr changedMethodName(const FieldSPtr& pField);
+    virtual cpp::frm::MethodNameSPtr modifiedMethodName(const FieldSPtr& pField);
     
     virtual cpp::frm::MethodNameSPtr bitmaskMethodName(const FieldSPtr& pField);
     
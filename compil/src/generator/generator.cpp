@@ -326,6 +326,11 @@ std::vector<Dependency> Generator::getCoreDependencies() const
     return result;
 }
 
+std::vector<Dependency> Generator::getDependencies() const
+{
+    return std::vector<Dependency>(dependencies.begin(), dependencies.end());
+}
+
 
 }
 
@@ -73,6 +73,7 @@ public:
 		      const DocumentSPtr& document);
               
     std::vector<Dependency> getCoreDependencies() const;
+    std::vector<Dependency> getDependencies() const;
 
 protected:
     std::vector<int> mIndent;
@@ -34,6 +34,14 @@
 
 
 GeneratorConfiguration::GeneratorConfiguration()
+    : noComments(false)
+    , streaming(false)
+    , profile(false)
+    , listOutputs(false)
+    , unity(false)
+    , unityFiles(1)
+    , jobs(1)
+    , languageServer(false)
 {
 }
 
@@ -61,7 +69,17 @@ void GeneratorConfiguration::addCommonOptions(bpo::options_description& options)
         ("flat-core-output", bpo::value<bool>(&flatCoreOutput), "flat core output (write the files directly in the output directory)")
         ("project-file", bpo::value<std::string>(&projectFile), "project file")
         ("project-directory", bpo::value<std::string>(&projectDirectory), "project directory")
-        ("import-path,I", bpo::value<string_vector>(&importDirectories)->composing(), "import compil path");
+        ("import-path,I", bpo::value<string_vector>(&importDirectories)->composing(), "import compil path")
+        ("cache-directory", bpo::value<std::string>(&cacheDirectory), "directory for the precompiled (.compilc) token cache")
+        ("no-comments", bpo::value<bool>(&noComments), "skip the comments of the documents (they are not carried to the generated code)")
+        ("streaming", bpo::value<bool>(&streaming), "parse, generate and release one document at a time to bound the peak memory (the imports are parsed again for every document)")
+        ("profile", bpo::value<bool>(&profile), "report the time of the generation phases and the peak memory")
+        ("depfile", bpo::value<std::string>(&depfile), "write Makefile/Ninja depfile with the sources every output depends on")
+        ("manifest", bpo::value<std::string>(&manifest), "write the list of the outputs per section")
+        ("list-outputs", bpo::value<bool>(&listOutputs), "print the outputs parsing only the project file and the document packages")
+        ("unity", bpo::value<bool>(&unity), "also amalgamate the definitions of every package in unity translation units")
+        ("unity-files", bpo::value<int>(&unityFiles), "number of size balanced unity translation units per package")
+        ("jobs,j", bpo::value<int>(&jobs), "number of the documents parsed and validated in parallel, 0 for the number of the hardware threads");
 }
 
 bpo::options_description GeneratorConfiguration::commandLineOptions()
@@ -70,6 +88,7 @@ bpo::options_description GeneratorConfiguration::commandLineOptions()
     options.add_options()
         ("type,t", bpo::value<std::string>(&type), "output type")
         ("source-file", bpo::value(&sourceFiles), "source compil file")
+        ("language-server", bpo::value<bool>(&languageServer), "serve the diagnostics of the edited documents over the language server protocol on the standard input and output")
         ;
     addCommonOptions(options);
     return options;
@@ -64,6 +64,17 @@ public:
     std::string projectFile;
     std::string projectDirectory;
     string_vector importDirectories;
+    std::string cacheDirectory;
+    bool noComments;
+    bool streaming;
+    bool profile;
+    std::string depfile;
+    std::string manifest;
+    bool listOutputs;
+    bool unity;
+    int unityFiles;
+    int jobs;
+    bool languageServer;
     
     string_vector sourceFiles;
 };
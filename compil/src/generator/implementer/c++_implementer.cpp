@@ -106,6 +106,46 @@ bool CppImplementer::needConstructorInitialization(const FieldSPtr& pField)
     return true;
 }
 
+bool CppImplementer::inlineAccessors()
+{
+    return mConfiguration->mCppAccessors == ImplementerConfiguration::accessors_inline;
+}
+
+bool CppImplementer::inlineAccessors(const StructureSPtr& pStructure)
+{
+    if (!inlineAccessors())
+        return false;
+    // the setters of the partial structures return the complete class,
+    // which is not declared in the header that defines them
+    if (pStructure->partial())
+        return false;
+    return true;
+}
+
+bool CppImplementer::forwardHeaders()
+{
+    return mConfiguration->mCppForwardHeader == ImplementerConfiguration::forward_header_per_document;
+}
+
+bool CppImplementer::columns()
+{
+    return mConfiguration->mCppColumns == ImplementerConfiguration::columns_per_structure;
+}
+
+bool CppImplementer::columns(const StructureSPtr& pStructure)
+{
+    if (!columns())
+        return false;
+    // the complete class of the partial structures is not declared
+    // in the header that defines them
+    if (pStructure->partial())
+        return false;
+    // the rows are counted by the columns
+    if (pStructure->combinedFields().empty())
+        return false;
+    return true;
+}
+
 cpp::frm::TypeSPtr CppImplementer::cppDecoratedType(const TypeSPtr& pType)
 {
     switch (pType->kind().value())
@@ -274,17 +314,29 @@ cpp::frm::TypeSPtr CppImplementer::cppType(const TypeSPtr& pType)
         {
             UnaryContainerSPtr pUnaryContainer = boost::static_pointer_cast<UnaryContainer>(pType);
             cpp::frm::TypeSPtr simpleType = cppType(pUnaryContainer->parameterType().lock());
-            std::string result = "vector<";
+            std::string parameter;
             if (simpleType->namespace_())
             if (!simpleType->namespace_()->isVoid())
             {
                 const std::vector<cpp::frm::NamespaceNameSPtr>& names = simpleType->namespace_()->names();
                 for (size_t i = 0; i < names.size(); ++i)
-                    result += names[i]->value() + "::";
+                    parameter += names[i]->value() + "::";
             }
-            result += simpleType->name()->value() + ">";
+            parameter += simpleType->name()->value();
+
+            // the fixed and the small containers keep their elements inline
+            // in the object, the small ones spill to the heap beyond the capacity
+            std::ostringstream capacity;
+            capacity << pUnaryContainer->capacity();
+            if (pUnaryContainer->size() == UnaryContainer::ESize::fixed())
+                return cpp::frm::typeRef() << nsBoost
+                                           << cpp::frm::typeNameRef("array<" + parameter + ", "
+                                                                    + capacity.str() + ">");
+            if (pUnaryContainer->size() == UnaryContainer::ESize::small())
+                return cpp::frm::typeRef() << cpp::frm::typeNameRef("small_vector<" + parameter + ", "
+                                                                    + capacity.str() + ">");
             return cpp::frm::typeRef() << nsStd
-                                       << cpp::frm::typeNameRef(result);
+                                       << cpp::frm::typeNameRef("vector<" + parameter + ">");
         }
     }
 
@@ -413,15 +465,7 @@ std::vector<Dependency> CppImplementer::dependencies(const TypeSPtr& pType)
         if (pEnumeration->flags())
         if (mConfiguration->mFlagsEnumeration == ImplementerConfiguration::flags_enumeration_use_core_template)
         {
-            // todo: we should report an error here mCorePackage is null
-                
-            dep.push_back(
-                Dependency(cppFilepath(mCorePackage),
-                           "flags_enumeration" + applicationExtension(declaration),
-                           Dependency::quote_type,
-                           Dependency::core_level,
-                           Dependency::private_section,
-                           "Compil C++ Template Library"));
+            dep.push_back(coreTemplateDependency("flags_enumeration"));
         }
     }
 
@@ -445,15 +489,9 @@ std::vector<Dependency> CppImplementer::dependencies(const TypeSPtr& pType)
         else
         if (name == "vector")
         {
-            dep.push_back(
-                Dependency("",
-                           "vector",
-                           Dependency::system_type,
-                           Dependency::stl_level,
-                           Dependency::global_section,
-                           "Standard Template Library"));
-
             UnaryContainerSPtr pUnaryContainer = boost::static_pointer_cast<UnaryContainer>(pType);
+            dep.push_back(containerDependency(pUnaryContainer));
+
             std::vector<Dependency> subdep = dependencies(pUnaryContainer->parameterType().lock());
 
             dep.insert(dep.begin(), subdep.begin(), subdep.end());
@@ -481,6 +519,39 @@ std::vector<Dependency> CppImplementer::dependencies(const FieldSPtr& pField)
     return dependencies(pField->type());
 }
 
+std::vector<Dependency> CppImplementer::declarationDependencies(const TypeSPtr& pType)
+{
+    if (!forwardHeaders())
+        return dependencies(pType);
+
+    ReferenceSPtr pReference = ObjectFactory::downcastReference(pType);
+    if (pReference)
+    {
+        std::vector<Dependency> dep = classPointerDependencies();
+        dep.push_back(cppForwardHeaderFileDependency(pReference->parameterType().lock()));
+        return dep;
+    }
+
+    if (!pType->package() && (pType->name()->value() == "vector"))
+    {
+        UnaryContainerSPtr pUnaryContainer = boost::static_pointer_cast<UnaryContainer>(pType);
+        std::vector<Dependency> dep;
+        dep.push_back(containerDependency(pUnaryContainer));
+
+        std::vector<Dependency> subdep = declarationDependencies(pUnaryContainer->parameterType().lock());
+
+        dep.insert(dep.begin(), subdep.begin(), subdep.end());
+        return dep;
+    }
+
+    return dependencies(pType);
+}
+
+std::vector<Dependency> CppImplementer::declarationDependencies(const FieldSPtr& pField)
+{
+    return declarationDependencies(pField->type());
+}
+
 cpp::frm::TypeSPtr CppImplementer::cppPtrType(const TypeSPtr& pType)
 {
     switch (mConfiguration->mPointer)
@@ -612,6 +683,314 @@ Dependency CppImplementer::unordered_map_dependency()
                       "Boost C++ Unordered");
 }
 
+Dependency CppImplementer::hash_dependency()
+{
+    return Dependency("boost",
+                      "functional/hash.hpp",
+                      Dependency::system_type,
+                      Dependency::thirdparty_level,
+                      Dependency::private_section,
+                      "Boost C++ Hash");
+}
+
+Dependency CppImplementer::stddef_dependency()
+{
+    return Dependency("",
+                      "stddef.h",
+                      Dependency::system_type,
+                      Dependency::system_level,
+                      Dependency::private_section,
+                      "Standard C Library");
+}
+
+Dependency CppImplementer::cstring_dependency()
+{
+    return Dependency("",
+                      "string.h",
+                      Dependency::system_type,
+                      Dependency::system_level,
+                      Dependency::private_section,
+                      "Standard C Library");
+}
+
+OperatorSPtr CppImplementer::compareOperator(const StructureSPtr& pStructure)
+{
+    const std::vector<ObjectSPtr>& objects = pStructure->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        OperatorSPtr pOperator = ObjectFactory::downcastOperator(*it);
+        if (pOperator)
+        if (pOperator->action() == EOperatorAction::lessThan())
+            return pOperator;
+    }
+    return OperatorSPtr();
+}
+
+Dependency CppImplementer::coreTemplateDependency(const std::string& name)
+{
+    // todo: we should report an error here mCorePackage is null
+    return Dependency(cppFilepath(mCorePackage),
+                      name + applicationExtension(declaration),
+                      Dependency::quote_type,
+                      Dependency::core_level,
+                      Dependency::private_section,
+                      "Compil C++ Template Library");
+}
+
+cpp::frm::TypeSPtr CppImplementer::internTable(const StructureSPtr& pStructure)
+{
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef("intern_table<"
+                                                        + mpFrm->cppMainClassType(pStructure)->name()->value()
+                                                        + ">")
+                               << cpp::frm::ETypeDecoration::reference();
+}
+
+Dependency CppImplementer::internTableDependency()
+{
+    return coreTemplateDependency("intern_table");
+}
+
+cpp::frm::TypeSPtr CppImplementer::objectPool(const StructureSPtr& pStructure)
+{
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef("object_pool<"
+                                                        + mpFrm->cppMainClassType(pStructure)->name()->value()
+                                                        + ">");
+}
+
+cpp::frm::TypeSPtr CppImplementer::objectPoolAllocator(const StructureSPtr& pStructure)
+{
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef("object_pool_allocator<"
+                                                        + mpFrm->cppMainClassType(pStructure)->name()->value()
+                                                        + ">");
+}
+
+Dependency CppImplementer::objectPoolDependency()
+{
+    return coreTemplateDependency("object_pool");
+}
+
+bool CppImplementer::slabClone(const std::vector<StructureSPtr>& structs)
+{
+    if (mConfiguration->mPointer != ImplementerConfiguration::use_boost_pointers)
+        return false;
+
+    // the clones in a slab share the ownership of the slab, so the weak
+    // pointer of enable_shared_from_this is never set for them
+    std::vector<StructureSPtr>::const_iterator it;
+    for (it = structs.begin(); it != structs.end(); ++it)
+    {
+        if ((*it)->sharable())
+            return false;
+    }
+    return true;
+}
+
+Dependency CppImplementer::objectSlabDependency()
+{
+    return coreTemplateDependency("object_slab");
+}
+
+bool CppImplementer::sharedStorage(const FieldSPtr& pField)
+{
+    StructureSPtr pStructure = pField->structure().lock();
+    if (!pStructure || !pStructure->immutable())
+        return false;
+    if (mConfiguration->mPointer != ImplementerConfiguration::use_boost_pointers)
+        return false;
+
+    TypeSPtr pType = pField->type();
+    // the fixed and the small containers keep their elements inline
+    UnaryContainerSPtr pUnaryContainer = ObjectFactory::downcastUnaryContainer(pType);
+    if (pUnaryContainer)
+        return pUnaryContainer->size() == UnaryContainer::ESize::dynamic();
+    if (pType->name()->value() == "string")
+        return mConfiguration->mString == ImplementerConfiguration::use_stl_string;
+    return false;
+}
+
+cpp::frm::TypeSPtr CppImplementer::sharedValue(const cpp::frm::TypeSPtr& type)
+{
+    std::string parameter;
+    if (type->namespace_())
+    if (!type->namespace_()->isVoid())
+    {
+        const std::vector<cpp::frm::NamespaceNameSPtr>& names = type->namespace_()->names();
+        for (size_t i = 0; i < names.size(); ++i)
+            parameter += names[i]->value() + "::";
+    }
+    parameter += type->name()->value();
+    // the closing brackets of the nested templates are separated for C++98
+    if (*parameter.rbegin() == '>')
+        parameter += " ";
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef("shared_value<" + parameter + ">");
+}
+
+Dependency CppImplementer::sharedValueDependency()
+{
+    return coreTemplateDependency("shared_value");
+}
+
+Dependency CppImplementer::snapshotDependency()
+{
+    return coreTemplateDependency("snapshot");
+}
+
+cpp::frm::TypeSPtr CppImplementer::asyncQueue()
+{
+    return cpp::frm::typeRef() << cpp::frm::typeNameRef("async_queue")
+                               << cpp::frm::ETypeDecoration::reference();
+}
+
+Dependency CppImplementer::asyncQueueDependency()
+{
+    return coreTemplateDependency("async_queue");
+}
+
+bool CppImplementer::shmTransport()
+{
+    return mConfiguration->mCppShmTransport == ImplementerConfiguration::shm_transport_per_interface;
+}
+
+bool CppImplementer::shmTransport(const InterfaceSPtr& pInterface)
+{
+    if (!shmTransport())
+        return false;
+    // the stubs are emitted only if every argument could be marshalled
+    const std::vector<ObjectSPtr>& objects = pInterface->objects();
+    std::vector<ObjectSPtr>::const_iterator it;
+    for (it = objects.begin(); it != objects.end(); ++it)
+    {
+        MethodSPtr pMethod = ObjectFactory::downcastMethod(*it);
+        if (!pMethod) continue;
+        const std::vector<ObjectSPtr>& parameters = pMethod->objects();
+        std::vector<ObjectSPtr>::const_iterator pit;
+        for (pit = parameters.begin(); pit != parameters.end(); ++pit)
+        {
+            ParameterSPtr pParameter = ObjectFactory::downcastParameter(*pit);
+            if (!pParameter) continue;
+            if (!shmMarshallable(pParameter->type()))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool CppImplementer::shmMarshallable(const TypeSPtr& pType)
+{
+    if (ObjectFactory::downcastInteger(pType))
+        return true;
+    if (pType->package())
+        return false;
+    
+    std::string name = pType->name()->value();
+    if (name == "boolean")
+        return true;
+    if (name == "string")
+        return mConfiguration->mString == ImplementerConfiguration::use_stl_string;
+    if (name == "vector")
+    {
+        // only the std::vector of plain values is written as a single block
+        UnaryContainerSPtr pUnaryContainer = ObjectFactory::downcastUnaryContainer(pType);
+        if (!pUnaryContainer)
+            return false;
+        if (pUnaryContainer->size() != UnaryContainer::ESize::dynamic())
+            return false;
+        if (ObjectFactory::downcastInteger(pUnaryContainer->parameterType().lock()))
+            return true;
+    }
+    return false;
+}
+
+Dependency CppImplementer::shmChannelDependency()
+{
+    return coreTemplateDependency("shm_channel");
+}
+
+cpp::frm::TypeSPtr CppImplementer::cppParameterDecoratedType(const ParameterSPtr& pParameter)
+{
+    if (pParameter->direction() == Parameter::EDirection::in())
+        return cppSetDecoratedType(pParameter->type());
+    return mpFrm->typeRef(cppType(pParameter->type()));
+}
+
+cpp::frm::TypeSPtr CppImplementer::cppStubMemberType(const ParameterSPtr& pParameter)
+{
+    if (pParameter->direction() == Parameter::EDirection::in())
+        return cppType(pParameter->type());
+    cpp::frm::TypeSPtr type = cppType(pParameter->type());
+    return cpp::frm::typeRef() << type->namespace_()
+                               << type->name()
+                               << cpp::frm::ETypeDecoration::pointer();
+}
+
+cpp::frm::TypeSPtr CppImplementer::cppColumnType(const FieldSPtr& pField)
+{
+    const TypeSPtr& pType = pField->type();
+
+    // std::vector<bool> is not contiguous, the booleans are stored as bytes
+    cpp::frm::TypeSPtr itemType;
+    if (!pType->package() && (pType->name()->value() == "boolean"))
+        itemType = cpp::frm::typeRef() << cpp::frm::typeNameRef("unsigned char");
+    else
+        itemType = cppType(pType);
+
+    std::string result = "vector<";
+    if (itemType->namespace_())
+    if (!itemType->namespace_()->isVoid())
+    {
+        const std::vector<cpp::frm::NamespaceNameSPtr>& names = itemType->namespace_()->names();
+        for (size_t i = 0; i < names.size(); ++i)
+            result += names[i]->value() + "::";
+    }
+    result += itemType->name()->value();
+    if (result[result.size() - 1] == '>')
+        result += " ";
+    result += ">";
+    return cpp::frm::typeRef() << nsStd
+                               << cpp::frm::typeNameRef(result);
+}
+
+cpp::frm::TypeSPtr CppImplementer::cppAvailabilityColumnType()
+{
+    return cpp::frm::typeRef() << nsStd
+                               << cpp::frm::typeNameRef("vector<bool>");
+}
+
+bool CppImplementer::columnAvailability(const FieldSPtr& pField)
+{
+    // only the required and the optional fields of the controlled
+    // structures could be not available
+    StructureSPtr pStructure = pField->structure().lock();
+    if (!pStructure->controlled())
+        return false;
+    return !pField->defaultValue() || pField->defaultValue()->optional();
+}
+
+Dependency CppImplementer::vector_dependency()
+{
+    return Dependency("",
+                      "vector",
+                      Dependency::system_type,
+                      Dependency::stl_level,
+                      Dependency::global_section,
+                      "Standard Template Library");
+}
+
+Dependency CppImplementer::containerDependency(const UnaryContainerSPtr& pUnaryContainer)
+{
+    if (pUnaryContainer->size() == UnaryContainer::ESize::fixed())
+        return Dependency("boost",
+                          "array.hpp",
+                          Dependency::system_type,
+                          Dependency::thirdparty_level,
+                          Dependency::private_section,
+                          "Boost C++ Array");
+    if (pUnaryContainer->size() == UnaryContainer::ESize::small())
+        return coreTemplateDependency("small_vector");
+    return vector_dependency();
+}
+
 bool CppImplementer::alphabeticByName(const StructureSPtr& pStructure1, const StructureSPtr& pStructure2)
 {
     return pStructure1->name()->value() < pStructure2->name()->value();
@@ -911,6 +1290,28 @@ Dependency CppImplementer::cppHeaderFileDependency(const std::string filename,
                       Dependency::application_level);
 }
 
+Dependency CppImplementer::cppForwardHeaderFileDependency(const std::string filename,
+                                                          const PackageSPtr& package)
+{
+    boost::filesystem::path path(filename);
+    if (!path.has_stem())
+        return Dependency();
+
+    return cppHeaderFileDependency(path.stem().generic_string() + "-fwd", package);
+}
+
+Dependency CppImplementer::cppForwardHeaderFileDependency(const TypeSPtr& type)
+{
+    if (!type)
+        return Dependency();
+
+    SourceIdSPtr sourceId = type->sourceId();
+    if (!sourceId)
+        return Dependency();
+
+    return cppForwardHeaderFileDependency(sourceId->original(), type->package());
+}
+
 Dependency CppImplementer::cppHeaderFileDependency(const TypeSPtr& type)
 {
     if (!type)
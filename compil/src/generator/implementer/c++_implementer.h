@@ -62,6 +62,14 @@ public:
     virtual bool needMutableMethod(const FieldSPtr& pField, const StructureSPtr& pCurrentStructure);
     virtual bool needConstructorInitialization(const FieldSPtr& pField);
     
+    virtual bool inlineAccessors();
+    virtual bool inlineAccessors(const StructureSPtr& pStructure);
+    
+    virtual bool forwardHeaders();
+    
+    virtual bool columns();
+    virtual bool columns(const StructureSPtr& pStructure);
+    
     virtual cpp::frm::TypeSPtr cppType(const TypeSPtr& pType);
     virtual cpp::frm::TypeSPtr cppInnerType(const TypeSPtr& pType,
                                             const StructureSPtr& pStructure);
@@ -81,6 +89,11 @@ public:
     virtual std::vector<Dependency> dependencies(const TypeSPtr& pType);
     virtual std::vector<Dependency> dependencies(const FieldSPtr& pField);
     
+    // dependencies needed to declare a field. With forward headers the
+    // types held by a pointer need only their forward declarations
+    virtual std::vector<Dependency> declarationDependencies(const TypeSPtr& pType);
+    virtual std::vector<Dependency> declarationDependencies(const FieldSPtr& pField);
+    
     virtual cpp::frm::TypeSPtr cppPtrType(const TypeSPtr& pType);
     virtual cpp::frm::TypeSPtr cppPtrDecoratedType(const TypeSPtr& pType);
     
@@ -95,6 +108,62 @@ public:
     
     virtual Dependency unordered_set_dependency();
     virtual Dependency unordered_map_dependency();
+    virtual Dependency hash_dependency();
+    virtual Dependency stddef_dependency();
+    virtual Dependency cstring_dependency();
+    
+    // the std::vector, boost::array or small_vector of the unary containers
+    virtual Dependency containerDependency(const UnaryContainerSPtr& pUnaryContainer);
+    
+    // the first less than operator of the structure, the three-way compare
+    // method all the operators of the structure build on goes with it
+    virtual OperatorSPtr compareOperator(const StructureSPtr& pStructure);
+
+    // the header of the core template with the name, e.g. object_pool
+    virtual Dependency coreTemplateDependency(const std::string& name);
+
+    // the core template of the interned structures
+    virtual cpp::frm::TypeSPtr internTable(const StructureSPtr& pStructure);
+    virtual Dependency internTableDependency();
+    
+    // the core template of the pooled structures
+    virtual cpp::frm::TypeSPtr objectPool(const StructureSPtr& pStructure);
+    virtual cpp::frm::TypeSPtr objectPoolAllocator(const StructureSPtr& pStructure);
+    virtual Dependency objectPoolDependency();
+    
+    // the core template of the batched clone of the hierarchy factories
+    virtual bool slabClone(const std::vector<StructureSPtr>& structs);
+    virtual Dependency objectSlabDependency();
+    
+    // the core template of the field storage shared between the copies of
+    // the immutable structures
+    virtual bool sharedStorage(const FieldSPtr& pField);
+    virtual cpp::frm::TypeSPtr sharedValue(const cpp::frm::TypeSPtr& type);
+    virtual Dependency sharedValueDependency();
+    
+    // the core template of the snapshot holders of the immutable structures
+    virtual Dependency snapshotDependency();
+    
+    // the core template of the interface proxies
+    virtual cpp::frm::TypeSPtr asyncQueue();
+    virtual Dependency asyncQueueDependency();
+    
+    // the core template of the shared memory client and server stubs
+    virtual bool shmTransport();
+    virtual bool shmTransport(const InterfaceSPtr& pInterface);
+    virtual bool shmMarshallable(const TypeSPtr& pType);
+    virtual Dependency shmChannelDependency();
+    
+    // the in parameters are passed by value, the out and io by reference.
+    // The stubs keep the values of the in parameters and pointers to the rest
+    virtual cpp::frm::TypeSPtr cppParameterDecoratedType(const ParameterSPtr& pParameter);
+    virtual cpp::frm::TypeSPtr cppStubMemberType(const ParameterSPtr& pParameter);
+    
+    // the column of a field in the <Structure>Columns containers
+    virtual cpp::frm::TypeSPtr cppColumnType(const FieldSPtr& pField);
+    virtual cpp::frm::TypeSPtr cppAvailabilityColumnType();
+    virtual bool columnAvailability(const FieldSPtr& pField);
+    virtual Dependency vector_dependency();
     
     static bool alphabeticByName(const StructureSPtr& pStructure1, const StructureSPtr& pStructure2);
     
@@ -145,6 +214,9 @@ public:
     virtual PackageSPtr cppHeaderPackage(const PackageSPtr& package);
     virtual Dependency cppHeaderFileDependency(const std::string filename,
                                                const PackageSPtr& package);
+    virtual Dependency cppForwardHeaderFileDependency(const std::string filename,
+                                                      const PackageSPtr& package);
+    virtual Dependency cppForwardHeaderFileDependency(const TypeSPtr& type);
     virtual Dependency cppHeaderFileDependency(const TypeSPtr& type);
     
     ImplementerConfigurationSPtr mConfiguration;
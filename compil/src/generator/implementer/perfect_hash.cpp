@@ -0,0 +1,156 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/implementer/perfect_hash.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace compil
+{
+
+const unsigned long PerfectHash::offsetBasis = 2166136261UL;
+const unsigned long PerfectHash::prime = 16777619UL;
+const unsigned long PerfectHash::mixer = 0x45d9f3bUL;
+const unsigned long PerfectHash::mask = 0xffffffffUL;
+
+// the displacement search is bounded, because keys with equal hashes
+// could not be separated by any displacement
+static const unsigned long maxDisplacement = 1UL << 20;
+
+PerfectHash::PerfectHash()
+{
+}
+
+bool PerfectHash::build(const std::vector<std::string>& keys)
+{
+    mKeys = keys;
+    size_t size = mKeys.size();
+    mDisplacements.assign(size / 2 + 1, 0);
+    mSlots.assign(size, size);
+
+    std::vector<unsigned long> hashes(size);
+    std::vector<std::vector<size_t> > bucketKeys(buckets());
+    for (size_t i = 0; i < size; ++i)
+    {
+        hashes[i] = hash(mKeys[i]);
+        bucketKeys[hashes[i] % buckets()].push_back(i);
+    }
+
+    // the largest buckets are placed first while most of the slots are free
+    std::vector<std::pair<size_t, size_t> > order;
+    for (size_t b = 0; b < buckets(); ++b)
+    {
+        if (!bucketKeys[b].empty())
+            order.push_back(std::make_pair(bucketKeys[b].size(), b));
+    }
+    std::sort(order.begin(), order.end(), std::greater<std::pair<size_t, size_t> >());
+
+    std::vector<std::pair<size_t, size_t> >::const_iterator it;
+    for (it = order.begin(); it != order.end(); ++it)
+    {
+        const std::vector<size_t>& bucket = bucketKeys[it->second];
+        std::vector<size_t> taken;
+        unsigned long displacement;
+        for (displacement = 0; displacement < maxDisplacement; ++displacement)
+        {
+            taken.clear();
+            std::vector<size_t>::const_iterator kit;
+            for (kit = bucket.begin(); kit != bucket.end(); ++kit)
+            {
+                size_t s = slot(hashes[*kit], displacement, size);
+                if (mSlots[s] != size)
+                    break;
+                if (std::find(taken.begin(), taken.end(), s) != taken.end())
+                    break;
+                taken.push_back(s);
+            }
+            if (kit == bucket.end())
+                break;
+        }
+
+        if (displacement == maxDisplacement)
+            return false;
+
+        mDisplacements[it->second] = displacement;
+        for (size_t i = 0; i < bucket.size(); ++i)
+            mSlots[taken[i]] = bucket[i];
+    }
+    return true;
+}
+
+size_t PerfectHash::buckets() const
+{
+    return mDisplacements.size();
+}
+
+const std::vector<unsigned long>& PerfectHash::displacements() const
+{
+    return mDisplacements;
+}
+
+const std::vector<size_t>& PerfectHash::slots() const
+{
+    return mSlots;
+}
+
+size_t PerfectHash::lookup(const std::string& key) const
+{
+    if (mKeys.empty())
+        return 0;
+
+    unsigned long h = hash(key);
+    size_t s = slot(h, mDisplacements[h % buckets()], mKeys.size());
+    if (mKeys[mSlots[s]] != key)
+        return mKeys.size();
+    return s;
+}
+
+unsigned long PerfectHash::hash(const std::string& key)
+{
+    // 32 bits FNV-1a
+    unsigned long result = offsetBasis;
+    for (std::string::const_iterator it = key.begin(); it != key.end(); ++it)
+        result = ((result ^ (unsigned char)*it) * prime) & mask;
+    return result;
+}
+
+unsigned long PerfectHash::slot(unsigned long hash, unsigned long displacement, size_t size)
+{
+    unsigned long result = (hash ^ displacement) & mask;
+    result ^= result >> 16;
+    result = (result * mixer) & mask;
+    result ^= result >> 16;
+    return result % size;
+}
+
+}
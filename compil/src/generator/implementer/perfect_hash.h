@@ -0,0 +1,104 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+
+#ifndef _CPP_PERFECT_HASH_H__
+#define _CPP_PERFECT_HASH_H__
+
+#include <boost/shared_ptr.hpp>
+
+#include <string>
+#include <vector>
+
+namespace compil
+{
+
+// Minimal perfect hash over a set of distinct keys, computed with the hash
+// and displace method. The keys are distributed in buckets by their hash.
+// For every bucket a displacement is searched that moves all the keys of
+// the bucket into free slots. The lookup is then
+//
+//     hash = PerfectHash::hash(key)
+//     slot = PerfectHash::slot(hash, displacements[hash % buckets], size)
+//
+// The generated code repeats the same arithmetic, so both are kept in
+// 32 bits regardless of the size of unsigned long.
+class PerfectHash
+{
+public:
+    PerfectHash();
+
+    // Returns false if a displacement could not be found for some bucket
+    bool build(const std::vector<std::string>& keys);
+
+    // the number of the buckets
+    size_t buckets() const;
+    // the displacement of every bucket
+    const std::vector<unsigned long>& displacements() const;
+    // the index of the key stored in every slot
+    const std::vector<size_t>& slots() const;
+
+    // Returns the slot of a key or the number of the keys if the key is
+    // not one of them
+    size_t lookup(const std::string& key) const;
+
+    static unsigned long hash(const std::string& key);
+    static unsigned long slot(unsigned long hash, unsigned long displacement, size_t size);
+
+    // the constants of the hash functions
+    static const unsigned long offsetBasis;
+    static const unsigned long prime;
+    static const unsigned long mixer;
+    static const unsigned long mask;
+
+private:
+    std::vector<std::string> mKeys;
+    std::vector<unsigned long> mDisplacements;
+    std::vector<size_t> mSlots;
+};
+
+typedef boost::shared_ptr<PerfectHash> PerfectHashSPtr;
+
+}
+
+#else
+
+namespace compil
+{
+
+class PerfectHash;
+typedef boost::shared_ptr<PerfectHash> PerfectHashSPtr;
+
+}
+
+#endif
+
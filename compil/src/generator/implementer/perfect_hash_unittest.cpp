@@ -0,0 +1,106 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+#include "generator/implementer/perfect_hash.h"
+
+#include "gtest/gtest.h"
+
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+
+static void checkPerfectHash(const std::vector<std::string>& keys)
+{
+    compil::PerfectHash hash;
+    ASSERT_TRUE(hash.build(keys));
+
+    // every key has its own slot
+    std::vector<size_t> slots = hash.slots();
+    std::sort(slots.begin(), slots.end());
+    for (size_t i = 0; i < slots.size(); ++i)
+        EXPECT_EQ(i, slots[i]);
+
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        size_t slot = hash.lookup(keys[i]);
+        ASSERT_LT(slot, keys.size());
+        EXPECT_EQ(i, hash.slots()[slot]);
+    }
+}
+
+TEST(PerfectHashTests, empty)
+{
+    compil::PerfectHash hash;
+    ASSERT_TRUE(hash.build(std::vector<std::string>()));
+    EXPECT_EQ(0U, hash.lookup("key"));
+}
+
+TEST(PerfectHashTests, keys)
+{
+    std::vector<std::string> keys;
+    keys.push_back("invalid");
+    keys.push_back("value1");
+    keys.push_back("value2");
+    keys.push_back("value3");
+    checkPerfectHash(keys);
+}
+
+TEST(PerfectHashTests, manyKeys)
+{
+    std::vector<std::string> keys;
+    for (int i = 0; i < 2000; ++i)
+        keys.push_back("value" + boost::lexical_cast<std::string>(i));
+    checkPerfectHash(keys);
+}
+
+TEST(PerfectHashTests, unknownKeys)
+{
+    std::vector<std::string> keys;
+    keys.push_back("nil");
+    keys.push_back("flag1");
+    keys.push_back("flag2");
+    keys.push_back("all");
+
+    compil::PerfectHash hash;
+    ASSERT_TRUE(hash.build(keys));
+    EXPECT_EQ(keys.size(), hash.lookup(""));
+    EXPECT_EQ(keys.size(), hash.lookup("flag"));
+    EXPECT_EQ(keys.size(), hash.lookup("flag12"));
+    EXPECT_EQ(keys.size(), hash.lookup("All"));
+}
+
+TEST(PerfectHashTests, hash)
+{
+    // the 32 bits FNV-1a reference values
+    EXPECT_EQ(2166136261UL, compil::PerfectHash::hash(""));
+    EXPECT_EQ(0xe40c292cUL, compil::PerfectHash::hash("a"));
+    EXPECT_EQ(0xbf9cf968UL, compil::PerfectHash::hash("foobar"));
+}
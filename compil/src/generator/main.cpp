@@ -1,5 +1,6 @@
 #include "generator/project/generator_project.h"
 #include "generator/project/file_source_provider.h"
+#include "generator/server/language_server.h"
 #include "generator/general_configuration.h"
 #include "generator/generator_configuration.h"
 #include "generator/c++/configuration/formatter_configuration.h"
@@ -12,15 +13,29 @@
 
 #include "core/boost/boost_path.h"
 #include "core/configuration/configuration_manager.h"
+#include "core/platform/application.h"
+#include "core/platform/benchmark.h"
+#include "core/platform/thread.h"
 
 #include "boost/make_shared.hpp"
 #include "boost/algorithm/string.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
 #include <stdio.h>
 
+static void printProfile(long long initTime, long long parseTime, long long generateTime)
+{
+    const long long ms = 1000000;
+    std::cout << "profile:" << std::endl
+              << "    initialization: " << initTime / ms << " ms" << std::endl
+              << "    parsing:        " << parseTime / ms << " ms" << std::endl
+              << "    generation:     " << generateTime / ms << " ms" << std::endl
+              << "    peak memory:    " << plt::getPeakMemoryUsage() / 1024 << " KB" << std::endl;
+}
+
 int main(int argc, const char **argv)
 {
     compil::ConfigurationManagerPtr pConfigurationManager(new compil::ConfigurationManager());
@@ -59,6 +74,29 @@ int main(int argc, const char **argv)
         return 0;
     }
 
+    if (pGeneratorConfiguration->languageServer)
+    {
+        compil::FileSourceProviderPtr pFileSourceProvider(new compil::FileSourceProvider());
+        std::vector<boost::filesystem::path> importDirectories;
+        for (string_vector::const_iterator it = pGeneratorConfiguration->importDirectories.begin();
+             it != pGeneratorConfiguration->importDirectories.end(); ++it)
+            importDirectories.push_back(boost::filesystem::resolve(*it));
+        pFileSourceProvider->setImportDirectories(importDirectories);
+
+        // the protocol owns the standard output, the messages printed by
+        // the parsers go to the standard error
+        std::ostream protocol(std::cout.rdbuf());
+        std::cout.rdbuf(std::cerr.rdbuf());
+
+        compil::LanguageServer server(pFileSourceProvider);
+        int result = server.run(std::cin, protocol);
+
+        std::cout.rdbuf(protocol.rdbuf());
+        return result;
+    }
+
+    long long start = plt::getMonotonicTime();
+
     compil::FileSourceProviderPtr pFileSourceProvider(new compil::FileSourceProvider());
     
     compil::GeneratorProject project(pFileSourceProvider);
@@ -69,7 +107,36 @@ int main(int argc, const char **argv)
                       pGeneratorConfiguration->sourceFiles,
                       pGeneratorConfiguration->importDirectories))
         return 1;
+
+    project.setStreaming(pGeneratorConfiguration->streaming);
+    project.setDiscardComments(pGeneratorConfiguration->noComments);
+    project.setJobs(pGeneratorConfiguration->jobs > 0 ? pGeneratorConfiguration->jobs
+                                                      : plt::getHardwareConcurrency());
+    if (pGeneratorConfiguration->unity)
+        project.setUnityFiles(std::max(pGeneratorConfiguration->unityFiles, 1));
+
+    if (!pGeneratorConfiguration->cacheDirectory.empty())
+    {
+        project.setTokenCache(boost::make_shared<compil::TokenCache>(
+            boost::filesystem::resolve(pGeneratorConfiguration->cacheDirectory)));
+    }
         
+    if (pGeneratorConfiguration->listOutputs)
+    {
+        if (!project.listOutputs(boost::filesystem::resolve(pGeneratorConfiguration->outputDirectory),
+                                 pGeneratorConfiguration->flatOutput,
+                                 pConfigurationManager->getConfiguration<FormatterConfiguration>(),
+                                 pConfigurationManager->getConfiguration<ImplementerConfiguration>()))
+            return 1;
+
+        const std::vector<compil::OutputData>& outputs = project.outputs();
+        for (std::vector<compil::OutputData>::const_iterator it = outputs.begin(); it != outputs.end(); ++it)
+            std::cout << it->path.generic_string() << std::endl;
+        return 0;
+    }
+
+    long long initialized = plt::getMonotonicTime();
+
     if (!project.parseDocuments())
         return 1;
         
@@ -82,6 +149,21 @@ int main(int argc, const char **argv)
                           pConfigurationManager->getConfiguration<ImplementerConfiguration>()))
         return 1;
 
+    if (   !pGeneratorConfiguration->depfile.empty()
+        && !project.writeDepfile(boost::filesystem::resolve(pGeneratorConfiguration->depfile)))
+        return 1;
+
+    if (   !pGeneratorConfiguration->manifest.empty()
+        && !project.writeManifest(boost::filesystem::resolve(pGeneratorConfiguration->manifest)))
+        return 1;
+
+    if (pGeneratorConfiguration->profile)
+    {
+        // in streaming mode the parsing is interleaved with the generation
+        long long total = plt::getMonotonicTime() - initialized;
+        printProfile(initialized - start, project.parseTime(), total - project.parseTime());
+    }
+
     return 0;
 }
 
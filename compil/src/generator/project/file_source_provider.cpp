@@ -56,44 +56,56 @@ FileSourceProvider::~FileSourceProvider()
 
 SourceIdSPtr FileSourceProvider::sourceId(const SourceIdSPtr& pCurrentSourceId, const std::string& source)
 {
+    path source_location = resolveSource(pCurrentSourceId, source);
+    if (source_location.empty())
+        return SourceIdSPtr();
+
     SourceId::Builder builder;
     builder.set_original(source)
            .set_parent(pCurrentSourceId);
+    fillSourceFields(source_location, builder);
+    return builder.finalize();
+}
 
-    // first check the current source location
+boost::filesystem::path FileSourceProvider::resolveSource(const SourceIdSPtr& pCurrentSourceId, const std::string& source)
+{
+    path current_location;
     if (pCurrentSourceId)
     {
         path current(pCurrentSourceId->value());
-        path current_location = current.remove_filename();
+        current_location = current.remove_filename();
+    }
+
+    std::string key = current_location.generic_string() + '\n' + source;
+    unordered_map<std::string, path>::const_iterator rit = mResolved.find(key);
+    if (rit != mResolved.end())
+        return rit->second;
+
+    path& result = mResolved[key];
+
+    // first check the current source location
+    if (pCurrentSourceId)
+    {
         path source_location = current_location / source;
-        if (exists(source_location))
-        {
-            fillSourceFields(source_location, builder);
-            return builder.finalize();
-        }
+        if (isExists(source_location))
+            return result = source_location;
     }
     
     boost::filesystem::path source_location = isAbsolute(source)
                                             ? source
                                             : mWorkingDirectory / source;
-    if (exists(source_location))
-    {
-        fillSourceFields(source_location, builder);
-        return builder.finalize();
-    }
+    if (isExists(source_location))
+        return result = source_location;
 
     std::vector<path>::const_iterator it;
     for (it = mImportDirectories.begin(); it != mImportDirectories.end(); ++it)
     {
         path source_location = *it / source;
-        if (exists(source_location))
-        {
-            fillSourceFields(source_location, builder);
-            return builder.finalize();
-        }
+        if (isExists(source_location))
+            return result = source_location;
     }
 
-    return SourceIdSPtr();
+    return result;
 }
 
 StreamPtr FileSourceProvider::openInputStream(const SourceIdSPtr& pSourceId)
@@ -106,6 +118,7 @@ StreamPtr FileSourceProvider::openInputStream(const SourceIdSPtr& pSourceId)
 void FileSourceProvider::setImportDirectories(const std::vector<boost::filesystem::path>& importDirectories)
 {
     mImportDirectories = importDirectories;
+    mResolved.clear();
 }
 
 boost::filesystem::path FileSourceProvider::workingDirectory()
@@ -116,6 +129,8 @@ boost::filesystem::path FileSourceProvider::workingDirectory()
 void FileSourceProvider::setWorkingDirectory(const boost::filesystem::path& directory)
 {
     mWorkingDirectory = directory;
+    mResolved.clear();
+    mSourceFields.clear();
 }
 
 bool FileSourceProvider::isAbsolute(const boost::filesystem::path& file)
@@ -125,17 +140,31 @@ bool FileSourceProvider::isAbsolute(const boost::filesystem::path& file)
 
 bool FileSourceProvider::isExists(const boost::filesystem::path& file)
 {
-    return exists(file);
+    std::string key = file.generic_string();
+    unordered_map<std::string, bool>::const_iterator it = mExists.find(key);
+    if (it != mExists.end())
+        return it->second;
+
+    boost::system::error_code ec;
+    bool result = exists(file, ec);
+    mExists[key] = result;
+    return result;
 }
 
 std::time_t FileSourceProvider::fileTime(const boost::filesystem::path& file)
 {
+    std::string key = file.generic_string();
+    unordered_map<std::string, std::time_t>::const_iterator it = mFileTimes.find(key);
+    if (it != mFileTimes.end())
+        return it->second;
+
     boost::system::error_code ec;
     std::time_t time = last_write_time(file, ec);
     
     // if we are unable to take the time we better assume the file is modified
     if (ec)
-        return std::numeric_limits<std::time_t>::max();
+        time = std::numeric_limits<std::time_t>::max();
+    mFileTimes[key] = time;
     return time;
 }
 
@@ -151,6 +180,14 @@ boost::filesystem::path FileSourceProvider::absolute(const boost::filesystem::pa
     return workingDirectory() / file;
 }
 
+void FileSourceProvider::refresh()
+{
+    // the source fields depend only on the paths, they stay valid
+    mExists.clear();
+    mFileTimes.clear();
+    mResolved.clear();
+}
+
 std::string FileSourceProvider::getUniquePresentationString(const boost::filesystem::path& source)
 {
     path src_path = absolute(source);
@@ -199,9 +236,20 @@ std::vector<PackageElementSPtr> FileSourceProvider::getExternalElements(const bo
 
 void FileSourceProvider::fillSourceFields(const boost::filesystem::path& source, SourceId::Builder& builder)
 {
-    builder.set_value(source.generic_string())
-           .set_uniquePresentation(getUniquePresentationString(source))
-           .set_externalElements(getExternalElements(source));
+    std::string key = source.generic_string();
+    unordered_map<std::string, SourceFields>::iterator it = mSourceFields.find(key);
+    if (it == mSourceFields.end())
+    {
+        SourceFields fields;
+        fields.value = key;
+        fields.uniquePresentation = getUniquePresentationString(source);
+        fields.externalElements = getExternalElements(source);
+        it = mSourceFields.insert(std::make_pair(key, fields)).first;
+    }
+
+    builder.set_value(it->second.value)
+           .set_uniquePresentation(it->second.uniquePresentation)
+           .set_externalElements(it->second.externalElements);
 }
 
 }
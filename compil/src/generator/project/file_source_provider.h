@@ -39,10 +39,14 @@
 #include <boost/filesystem.hpp>
 
 #include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
 
 namespace compil
 {
 
+// The file system metadata (existence, modification time) and the
+// resolved imports are cached until the next refresh, so every file is
+// checked only once per run. The misses are cached as well.
 class FileSourceProvider : public ISourceProvider
 {
 public:
@@ -63,9 +67,27 @@ public:
     virtual boost::filesystem::path directory(const boost::filesystem::path& file);
     virtual boost::filesystem::path absolute(const boost::filesystem::path& file);
 
+    virtual void refresh();
+
 private:
     boost::filesystem::path mWorkingDirectory;
     std::vector<boost::filesystem::path> mImportDirectories;
+
+    struct SourceFields
+    {
+        std::string value;
+        std::string uniquePresentation;
+        std::vector<PackageElementSPtr> externalElements;
+    };
+
+    boost::unordered_map<std::string, bool> mExists;
+    boost::unordered_map<std::string, std::time_t> mFileTimes;
+    // (importer directory, import) -> resolved source or empty path if
+    // the source is not found
+    boost::unordered_map<std::string, boost::filesystem::path> mResolved;
+    boost::unordered_map<std::string, SourceFields> mSourceFields;
+
+    boost::filesystem::path resolveSource(const SourceIdSPtr& pCurrentSourceId, const std::string& source);
     
     void fillSourceFields(const boost::filesystem::path& source, SourceId::Builder& builder);
     std::string getUniquePresentationString(const boost::filesystem::path& source);
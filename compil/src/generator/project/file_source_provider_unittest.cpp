@@ -0,0 +1,123 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/project/file_source_provider.h"
+
+#include "gtest/gtest.h"
+
+#include <fstream>
+
+namespace compil
+{
+
+class FileSourceProviderTests : public testing::Test
+{
+public:
+    virtual void SetUp()
+    {
+        mDirectory = boost::filesystem::temp_directory_path()
+                   / boost::filesystem::unique_path("compil-%%%%-%%%%-%%%%");
+        boost::filesystem::create_directories(mDirectory / "import");
+        mProvider.reset(new FileSourceProvider());
+        mProvider->setWorkingDirectory(mDirectory);
+    }
+
+    virtual void TearDown()
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(mDirectory, ec);
+    }
+
+protected:
+    void file(const boost::filesystem::path& path)
+    {
+        std::ofstream stream(path.string().c_str());
+        stream << "compil {}\n";
+    }
+
+    boost::filesystem::path mDirectory;
+    FileSourceProviderPtr mProvider;
+};
+
+TEST_F(FileSourceProviderTests, sourceId)
+{
+    file(mDirectory / "a.compil");
+    file(mDirectory / "import" / "b.compil");
+
+    std::vector<boost::filesystem::path> imports;
+    imports.push_back(mDirectory / "import");
+    mProvider->setImportDirectories(imports);
+
+    SourceIdSPtr a = mProvider->sourceId(SourceIdSPtr(), "a.compil");
+    ASSERT_TRUE(a);
+    EXPECT_EQ((mDirectory / "a.compil").generic_string(), a->value());
+    EXPECT_EQ("a.compil", a->uniquePresentation());
+
+    SourceIdSPtr b = mProvider->sourceId(a, "b.compil");
+    ASSERT_TRUE(b);
+    EXPECT_EQ((mDirectory / "import" / "b.compil").generic_string(), b->value());
+    EXPECT_EQ(a, b->parent());
+
+    EXPECT_FALSE(mProvider->sourceId(a, "c.compil"));
+}
+
+TEST_F(FileSourceProviderTests, cache)
+{
+    file(mDirectory / "a.compil");
+
+    SourceIdSPtr a = mProvider->sourceId(SourceIdSPtr(), "a.compil");
+    ASSERT_TRUE(a);
+    EXPECT_FALSE(mProvider->sourceId(SourceIdSPtr(), "b.compil"));
+    std::time_t time = mProvider->fileTime(mDirectory / "a.compil");
+
+    // the results are taken from the cache
+    boost::filesystem::remove(mDirectory / "a.compil");
+    file(mDirectory / "b.compil");
+
+    SourceIdSPtr cached = mProvider->sourceId(SourceIdSPtr(), "a.compil");
+    ASSERT_TRUE(cached);
+    EXPECT_NE(a, cached);
+    EXPECT_EQ(a->value(), cached->value());
+    EXPECT_TRUE(mProvider->isExists(mDirectory / "a.compil"));
+    EXPECT_EQ(time, mProvider->fileTime(mDirectory / "a.compil"));
+    EXPECT_FALSE(mProvider->sourceId(SourceIdSPtr(), "b.compil"));
+    EXPECT_FALSE(mProvider->isExists(mDirectory / "b.compil"));
+
+    // the refresh forgets them
+    mProvider->refresh();
+    EXPECT_FALSE(mProvider->sourceId(SourceIdSPtr(), "a.compil"));
+    EXPECT_FALSE(mProvider->isExists(mDirectory / "a.compil"));
+    EXPECT_TRUE(mProvider->sourceId(SourceIdSPtr(), "b.compil"));
+    EXPECT_TRUE(mProvider->isExists(mDirectory / "b.compil"));
+}
+
+}
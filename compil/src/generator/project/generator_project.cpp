@@ -32,10 +32,20 @@
 
 #include "generator/project/generator_project.h"
 #include "generator/project/hook_source_provider.h"
+#include "generator/cpp/c++_async_queue_generator.h"
+#include "generator/cpp/c++_benchmark_generator.h"
 #include "generator/cpp/c++_generator.h"
 #include "generator/cpp/c++_h_generator.h"
+#include "generator/cpp/c++_fwd_generator.h"
 #include "generator/cpp/c++_test_generator.h"
 #include "generator/cpp/c++_flags_enumeration_generator.h"
+#include "generator/cpp/c++_intern_table_generator.h"
+#include "generator/cpp/c++_object_pool_generator.h"
+#include "generator/cpp/c++_object_slab_generator.h"
+#include "generator/cpp/c++_small_vector_generator.h"
+#include "generator/cpp/c++_snapshot_generator.h"
+#include "generator/cpp/c++_shared_value_generator.h"
+#include "generator/cpp/c++_shm_channel_generator.h"
 #include "generator/implementer/c++_implementer.h"
 #include "generator/formatter/c++_formatter.h"
 
@@ -44,18 +54,27 @@
 #include "compiler/parser.h"
 
 #include "core/platform/application.h"
+#include "core/platform/benchmark.h"
 
 #include "boost/algorithm/string.hpp"
+#include "boost/lexical_cast.hpp"
 #include "boost/unordered_set.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <limits>
+#include <sstream>
 
 namespace compil
 {
 
 GeneratorProject::GeneratorProject(const ISourceProviderSPtr& sourceProvider)
     : mSourceProvider(sourceProvider)
+    , mDiscardComments(false)
+    , mStreaming(false)
+    , mUnityFiles(0)
+    , mJobs(1)
+    , mParseTime(0)
 {
 }
 
@@ -146,6 +165,7 @@ bool GeneratorProject::init(const bool force,
         if (!pParser->parseProject(sourceId, pInput, mProject))
             return false;
         
+        mProjectFile = sourceId->value();
         mProjectDirectory = mSourceProvider->directory(projectPath);
         mSourceProvider->setWorkingDirectory(mProjectDirectory);
         return true;
@@ -185,8 +205,54 @@ const boost::filesystem::path& GeneratorProject::projectDirectory() const
     return mProjectDirectory;
 }
 
+void GeneratorProject::setTokenCache(const TokenCacheSPtr& tokenCache)
+{
+    mTokenCache = tokenCache;
+}
+
+void GeneratorProject::setDiscardComments(bool discard)
+{
+    mDiscardComments = discard;
+}
+
+void GeneratorProject::setStreaming(bool streaming)
+{
+    mStreaming = streaming;
+}
+
+void GeneratorProject::setUnityFiles(int unityFiles)
+{
+    mUnityFiles = unityFiles;
+}
+
+void GeneratorProject::setJobs(int jobs)
+{
+    mJobs = std::max(jobs, 1);
+}
+
+// The documents are taken in order by the workers. The parsing stops
+// after the first failure. The messages of every document are printed
+// after the workers join, in the order of the documents
+struct ParseJobs
+{
+    GeneratorProject* project;
+    std::vector<std::string> files;
+    std::vector<SourceData> data;
+    std::vector<std::string> messages;
+    boost::shared_ptr<plt::Mutex> providerMutex;
+    TokenCacheSPtr tokenCache;
+
+    plt::Mutex mutex;
+    size_t next;
+    bool failed;
+};
+
 bool GeneratorProject::parseDocuments()
 {
+    // in streaming mode every document is parsed just before its generation
+    if (mStreaming)
+        return true;
+
     boost::unordered_set<std::string> files;
     
     const std::vector<SectionSPtr>& sections = mProject->sections();
@@ -202,39 +268,137 @@ bool GeneratorProject::parseDocuments()
         }
     }
     
-    SourceIdSPtr parent;
-    for (boost::unordered_set<std::string>::iterator it = files.begin(); it != files.end(); ++it)
+    if ((mJobs == 1) || (files.size() < 2))
     {
-        const std::string& sourceFile = *it;
-        ParserPtr parser = boost::make_shared<Parser>();
-    
-        DocumentSPtr document;
-        SourceIdSPtr sourceId = mSourceProvider->sourceId(parent, sourceFile);
-        if (!sourceId)
+        for (boost::unordered_set<std::string>::iterator it = files.begin(); it != files.end(); ++it)
         {
-            std::cout << "ERROR: missing source compil file: " << sourceFile << std::endl;
-            // TODO dump the list of the directories it looks into
-            return false;
+            if (!parseDocument(*it))
+                return false;
+        }
+        return true;
+    }
+
+    long long start = plt::getMonotonicTime();
+
+    Parser::initialize();
+
+    ParseJobs jobs;
+    jobs.project = this;
+    jobs.files.assign(files.begin(), files.end());
+    jobs.data.resize(jobs.files.size());
+    jobs.messages.resize(jobs.files.size());
+    jobs.providerMutex = boost::make_shared<plt::Mutex>();
+    jobs.tokenCache = mTokenCache;
+    jobs.next = 0;
+    jobs.failed = false;
+    {
+        std::vector<boost::shared_ptr<plt::Thread> > threads;
+        for (size_t i = 0; i < std::min((size_t)mJobs, jobs.files.size()); ++i)
+            threads.push_back(boost::make_shared<plt::Thread>(&GeneratorProject::parseJobs, &jobs));
+    }
+    for (size_t i = 0; i < jobs.messages.size(); ++i)
+        std::cout << jobs.messages[i];
+    std::cout.flush();
+
+    if (jobs.failed)
+        return false;
+
+    for (size_t i = 0; i < jobs.files.size(); ++i)
+        mDocuments[jobs.files[i]] = jobs.data[i];
+
+    mParseTime += plt::getMonotonicTime() - start;
+    return true;
+}
+
+void GeneratorProject::parseJobs(void* argument)
+{
+    ParseJobs* jobs = static_cast<ParseJobs*>(argument);
+
+    // every worker counts its own cache hits, the cache files are written
+    // atomically
+    TokenCacheSPtr tokenCache;
+    if (jobs->tokenCache)
+        tokenCache = boost::make_shared<TokenCache>(jobs->tokenCache->directory());
+
+    for (;;)
+    {
+        size_t index;
+        {
+            plt::Lock lock(jobs->mutex);
+            if (jobs->failed || (jobs->next == jobs->files.size()))
+                return;
+            index = jobs->next++;
         }
-        HookSourceProviderSPtr hook = boost::make_shared<HookSourceProvider>(mSourceProvider, mInitTime);
+
+        std::ostringstream messages;
+        bool parsed = jobs->project->parseSource(jobs->files[index], jobs->providerMutex, tokenCache,
+                                                 messages, jobs->data[index]);
+        jobs->messages[index] = messages.str();
+        if (!parsed)
+        {
+            plt::Lock lock(jobs->mutex);
+            jobs->failed = true;
+        }
+    }
+}
+
+bool GeneratorProject::parseDocument(const std::string& sourceFile)
+{
+    long long start = plt::getMonotonicTime();
+
+    SourceData data;
+    if (!parseSource(sourceFile, boost::shared_ptr<plt::Mutex>(), mTokenCache, std::cout, data))
+        return false;
+    mDocuments[sourceFile] = data;
+
+    mParseTime += plt::getMonotonicTime() - start;
+    return true;
+}
+
+bool GeneratorProject::parseSource(const std::string& sourceFile,
+                                   const boost::shared_ptr<plt::Mutex>& pMutex,
+                                   const TokenCacheSPtr& tokenCache,
+                                   std::ostream& messages,
+                                   SourceData& data)
+{
+    ParserPtr parser = boost::make_shared<Parser>();
+    parser->setMessageStream(messages);
+    if (tokenCache)
+        parser->setTokenCache(tokenCache);
+    if (mDiscardComments)
+        parser->setDiscardComments(true);
+
+    HookSourceProviderSPtr hook = boost::make_shared<HookSourceProvider>(mSourceProvider, mInitTime, pMutex);
+
+    DocumentSPtr document;
+    SourceIdSPtr sourceId = hook->sourceId(SourceIdSPtr(), sourceFile);
+    if (!sourceId)
+    {
+        messages << "ERROR: missing source compil file: " << sourceFile << std::endl;
+        // TODO dump the list of the directories it looks into
+        return false;
+    }
+    
+    if (!parser->parseDocument(hook, sourceId, document))
+        return false;
         
-        if (!parser->parseDocument(hook, sourceId, document))
-            return false;
-            
-        SourceData data;
-        data.updateTime = hook->getUpdateTime();
-        data.becauseOf = hook->getBecauseOf();
-        data.document = document;
+    data.updateTime = hook->getUpdateTime();
+    data.becauseOf = hook->getBecauseOf();
+    data.document = document;
+    data.sources = hook->getSources();
 #if 0
-        struct tm* ts = localtime(&data.updateTime);
-        char cBuffer[128];
-        strftime(cBuffer, sizeof(cBuffer), "%Y-%m-%d %H:%M:%S", ts);  
+    struct tm* ts = localtime(&data.updateTime);
+    char cBuffer[128];
+    strftime(cBuffer, sizeof(cBuffer), "%Y-%m-%d %H:%M:%S", ts);  
 #endif
-        mDocuments[sourceFile] = data;
-    }
     return true;
 }
 
+long long GeneratorProject::parseTime() const
+{
+    return mParseTime;
+}
+
 static void closeStream(std::ofstream* pOutputStream)
 {
     pOutputStream->flush();
@@ -258,6 +422,79 @@ static std::string getFileStem(const std::string& type,
     return result + "-" + type;
 }
 
+static boost::filesystem::path documentOutputPath(const std::string& type,
+                                                  const std::string& documentName,
+                                                  const PackageSPtr& package,
+                                                  const CppImplementerPtr& implementer,
+                                                  const CppImplementer::EExtensionType& extensionType,
+                                                  const boost::filesystem::path& outputDirectory,
+                                                  const bool flatOutput)
+{
+    boost::filesystem::path output = outputDirectory;
+    
+    if (!flatOutput)
+    {
+        PackageSPtr headerPackage = implementer->cppHeaderPackage(package);
+        if (headerPackage)
+            output /= CppImplementer::cppFilepath(headerPackage);
+    }
+        
+    output /= getFileStem(type, documentName) + implementer->applicationExtension(extensionType);
+    return output;
+}
+
+// The unity files of a package are next to its definitions. The name
+// contains the whole package so the packages do not collide in a flat output
+static boost::filesystem::path unityOutputBase(const PackageSPtr& package,
+                                               const CppImplementerPtr& implementer,
+                                               const boost::filesystem::path& outputDirectory,
+                                               const bool flatOutput)
+{
+    boost::filesystem::path output = outputDirectory;
+    
+    if (!flatOutput)
+    {
+        PackageSPtr headerPackage = implementer->cppHeaderPackage(package);
+        if (headerPackage)
+            output /= CppImplementer::cppFilepath(headerPackage);
+    }
+    
+    std::string name = CppImplementer::cppFilepath(package);
+    std::replace(name.begin(), name.end(), '/', '_');
+    output /= name.empty() ? "unity" : name + "-unity";
+    return output;
+}
+
+static std::vector<boost::filesystem::path> unityOutputPaths(const std::string& base,
+                                                             const std::string& extension,
+                                                             const int files)
+{
+    std::vector<boost::filesystem::path> paths;
+    if (files == 1)
+    {
+        paths.push_back(base + extension);
+        return paths;
+    }
+    for (int i = 1; i <= files; ++i)
+        paths.push_back(base + "-" + boost::lexical_cast<std::string>(i) + extension);
+    return paths;
+}
+
+static std::vector<CppImplementer::EExtensionType> sectionExtensions(const std::string& type)
+{
+    std::vector<CppImplementer::EExtensionType> extensions;
+    if (type == "main" || type == "partial")
+    {
+        extensions.push_back(CppImplementer::definition);
+        extensions.push_back(CppImplementer::declaration);
+    }
+    if (type == "test" || type == "benchmark")
+    {
+        extensions.push_back(CppImplementer::definition);
+    }
+    return extensions;
+}
+
 bool GeneratorProject::executeGenerator(const std::string& type,
                                         const FilePathSPtr& path,
                                         const CppImplementer::EExtensionType& extensionType,
@@ -275,16 +512,18 @@ bool GeneratorProject::executeGenerator(const std::string& type,
     CppImplementerPtr implementer = boost::make_shared<CppImplementer>
         (implementerConfiguration, formatter, mCorePackage);
         
-    boost::filesystem::path output = outputDirectory;
-    
-    if (!flatOutput)
-    {
-        PackageSPtr package = implementer->cppHeaderPackage(data.document->package());
-        if (package)
-            output /= CppImplementer::cppFilepath(package);
-    }
-        
-    output /= getFileStem(type, data.document->name()->value()) + implementer->applicationExtension(extensionType);
+    boost::filesystem::path output = documentOutputPath(type, data.document->name()->value(),
+                                                        data.document->package(), implementer,
+                                                        extensionType, outputDirectory, flatOutput);
+
+    OutputData outputData;
+    outputData.section = type;
+    outputData.path = output;
+    outputData.sources = data.sources;
+    mOutputs.push_back(outputData);
+
+    addUnitySource(type, data.document->package(), implementer, extensionType,
+                   outputDirectory, flatOutput, output);
     
     if (   !mSourceProvider->isExists(output)
         || (mSourceProvider->fileTime(output) <= data.updateTime))
@@ -343,6 +582,11 @@ bool GeneratorProject::executeCoreGenerator(const std::string& name,
     }
     
     output /= getFileStem("core", name) + implementer->applicationExtension(extensionType);
+
+    OutputData outputData;
+    outputData.section = "core";
+    outputData.path = output;
+    mOutputs.push_back(outputData);
     
     {
         std::cout << "#" << output.generic_string() << std::endl;
@@ -398,18 +642,70 @@ bool GeneratorProject::executeCoreGenerator(const std::string& name,
     return true;
 }
 
+bool GeneratorProject::generateDocument(const std::string& type,
+                                        const FilePathSPtr& path,
+                                        const boost::filesystem::path& outputDirectory,
+                                        const bool flatOutput,
+                                        const AlignerConfigurationSPtr& alignerConfiguration,
+                                        const FormatterConfigurationSPtr& formatterConfiguration,
+                                        const ImplementerConfigurationSPtr& implementerConfiguration)
+{
+    if (type == "main" || type == "partial")
+    {
+        {
+            CppGenerator generator;
+            if (!executeGenerator(type, path, CppImplementer::definition, outputDirectory, flatOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+                return false;
+        }
+        
+        {
+            CppHeaderGenerator generator;
+            if (!executeGenerator(type, path, CppImplementer::declaration, outputDirectory, flatOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+                return false;
+        }
+        
+        if ((type == "main") &&
+            (implementerConfiguration->mCppForwardHeader == ImplementerConfiguration::forward_header_per_document))
+        {
+            CppForwardHeaderGenerator generator;
+            if (!executeGenerator("fwd", path, CppImplementer::declaration, outputDirectory, flatOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+                return false;
+        }
+    }
+    
+    if (type == "test")
+    {
+        CppTestGenerator generator;
+        if (!executeGenerator(type, path, CppImplementer::definition, outputDirectory, flatOutput,
+                              alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                              generator))
+            return false;
+    }
+    
+    if (type == "benchmark")
+    {
+        CppBenchmarkGenerator generator;
+        if (!executeGenerator(type, path, CppImplementer::definition, outputDirectory, flatOutput,
+                              alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                              generator))
+            return false;
+    }
+    
+    return true;
+}
+
 static bool isDot(char ch)
 {
     return ch == '.';
 }
 
-bool GeneratorProject::generate(const boost::filesystem::path& outputDirectory,
-                                const bool flatOutput,
-                                const boost::filesystem::path& outputCoreDirectory,
-                                const bool flatCoreOutput,
-                                const AlignerConfigurationSPtr& alignerConfiguration,
-                                const FormatterConfigurationSPtr& formatterConfiguration,
-                                const ImplementerConfigurationSPtr& implementerConfiguration)
+void GeneratorProject::initCorePackage(const ImplementerConfigurationSPtr& implementerConfiguration)
 {
     mCorePackage = mProject->corePackage();
     
@@ -429,51 +725,71 @@ bool GeneratorProject::generate(const boost::filesystem::path& outputDirectory,
             mCorePackage->set_levels(packageElements);
         }
     }
+}
+
+bool GeneratorProject::generate(const boost::filesystem::path& outputDirectory,
+                                const bool flatOutput,
+                                const boost::filesystem::path& outputCoreDirectory,
+                                const bool flatCoreOutput,
+                                const AlignerConfigurationSPtr& alignerConfiguration,
+                                const FormatterConfigurationSPtr& formatterConfiguration,
+                                const ImplementerConfigurationSPtr& implementerConfiguration)
+{
+    initCorePackage(implementerConfiguration);
+    mOutputs.clear();
+    mUnitySources.clear();
 
     const std::vector<SectionSPtr>& sections = mProject->sections();
-    for (std::vector<SectionSPtr>::const_iterator it = sections.begin(); it != sections.end(); ++it)
+    if (mStreaming)
     {
-        const SectionSPtr& section = *it;
-        
-        const std::string& type = section->name()->value();
-        const std::vector<FilePathSPtr>& paths = section->paths();
-        
-        if (type == "main" || type == "partial")
+        // parse, generate and release one document at a time. Only the
+        // summary of the core dependencies is kept between the documents
+        std::vector<std::string> files;
+        boost::unordered_set<std::string> visited;
+        for (std::vector<SectionSPtr>::const_iterator it = sections.begin(); it != sections.end(); ++it)
         {
+            const std::vector<FilePathSPtr>& paths = (*it)->paths();
             for (std::vector<FilePathSPtr>::const_iterator pit = paths.begin(); pit != paths.end(); ++pit)
             {
-                const FilePathSPtr& path = *pit;
-                
-                {
-                    CppGenerator generator;
-                    if (!executeGenerator(type, path, CppImplementer::definition, outputDirectory, flatOutput,
-                                          alignerConfiguration, formatterConfiguration, implementerConfiguration,
-                                          generator))
-                        return false;
-                }
-                
+                if (visited.insert((*pit)->path()).second)
+                    files.push_back((*pit)->path());
+            }
+        }
+
+        for (std::vector<std::string>::const_iterator fit = files.begin(); fit != files.end(); ++fit)
+        {
+            const std::string& file = *fit;
+            if (!parseDocument(file))
+                return false;
+
+            for (std::vector<SectionSPtr>::const_iterator it = sections.begin(); it != sections.end(); ++it)
+            {
+                const SectionSPtr& section = *it;
+                const std::vector<FilePathSPtr>& paths = section->paths();
+                for (std::vector<FilePathSPtr>::const_iterator pit = paths.begin(); pit != paths.end(); ++pit)
                 {
-                    CppHeaderGenerator generator;
-                    if (!executeGenerator(type, path, CppImplementer::declaration, outputDirectory, flatOutput,
-                                          alignerConfiguration, formatterConfiguration, implementerConfiguration,
-                                          generator))
+                    if ((*pit)->path() != file)
+                        continue;
+                    if (!generateDocument(section->name()->value(), *pit, outputDirectory, flatOutput,
+                                          alignerConfiguration, formatterConfiguration, implementerConfiguration))
                         return false;
                 }
             }
+
+            mDocuments.erase(file);
         }
-        
-        if (type == "test")
+    }
+    else
+    {
+        for (std::vector<SectionSPtr>::const_iterator it = sections.begin(); it != sections.end(); ++it)
         {
+            const SectionSPtr& section = *it;
+            const std::vector<FilePathSPtr>& paths = section->paths();
             for (std::vector<FilePathSPtr>::const_iterator pit = paths.begin(); pit != paths.end(); ++pit)
             {
-                const FilePathSPtr& path = *pit;
-                {
-                    CppTestGenerator generator;
-                    if (!executeGenerator(type, path, CppImplementer::definition, outputDirectory, flatOutput,
-                                          alignerConfiguration, formatterConfiguration, implementerConfiguration,
-                                          generator))
-                        return false;
-                }
+                if (!generateDocument(section->name()->value(), *pit, outputDirectory, flatOutput,
+                                      alignerConfiguration, formatterConfiguration, implementerConfiguration))
+                    return false;
             }
         }
     }
@@ -487,7 +803,367 @@ bool GeneratorProject::generate(const boost::filesystem::path& outputDirectory,
             return false;
     }
 
+    if (mCoreDependencies.count(getFileStem("core", "intern_table")))
+    {
+        CppInternTableGenerator generator;
+        if (!executeCoreGenerator("intern_table", CppImplementer::declaration, outputCoreDirectory, flatCoreOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+            return false;
+    }
+
+    if (mCoreDependencies.count(getFileStem("core", "async_queue")))
+    {
+        CppAsyncQueueGenerator generator;
+        if (!executeCoreGenerator("async_queue", CppImplementer::declaration, outputCoreDirectory, flatCoreOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+            return false;
+    }
+
+    if (mCoreDependencies.count(getFileStem("core", "object_pool")))
+    {
+        CppObjectPoolGenerator generator;
+        if (!executeCoreGenerator("object_pool", CppImplementer::declaration, outputCoreDirectory, flatCoreOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+            return false;
+    }
+
+    if (mCoreDependencies.count(getFileStem("core", "object_slab")))
+    {
+        CppObjectSlabGenerator generator;
+        if (!executeCoreGenerator("object_slab", CppImplementer::declaration, outputCoreDirectory, flatCoreOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+            return false;
+    }
+
+    if (mCoreDependencies.count(getFileStem("core", "shm_channel")))
+    {
+        CppShmChannelGenerator generator;
+        if (!executeCoreGenerator("shm_channel", CppImplementer::declaration, outputCoreDirectory, flatCoreOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+            return false;
+    }
+
+    if (mCoreDependencies.count(getFileStem("core", "snapshot")))
+    {
+        CppSnapshotGenerator generator;
+        if (!executeCoreGenerator("snapshot", CppImplementer::declaration, outputCoreDirectory, flatCoreOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+            return false;
+    }
+
+    if (mCoreDependencies.count(getFileStem("core", "shared_value")))
+    {
+        CppSharedValueGenerator generator;
+        if (!executeCoreGenerator("shared_value", CppImplementer::declaration, outputCoreDirectory, flatCoreOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+            return false;
+    }
+
+    if (mCoreDependencies.count(getFileStem("core", "small_vector")))
+    {
+        CppSmallVectorGenerator generator;
+        if (!executeCoreGenerator("small_vector", CppImplementer::declaration, outputCoreDirectory, flatCoreOutput,
+                                  alignerConfiguration, formatterConfiguration, implementerConfiguration,
+                                  generator))
+            return false;
+    }
+
+    return writeUnityFiles();
+}
+
+bool GeneratorProject::listOutputs(const boost::filesystem::path& outputDirectory,
+                                   const bool flatOutput,
+                                   const FormatterConfigurationSPtr& formatterConfiguration,
+                                   const ImplementerConfigurationSPtr& implementerConfiguration)
+{
+    initCorePackage(implementerConfiguration);
+    mOutputs.clear();
+    mUnitySources.clear();
+
+    boost::unordered_map<std::string, PackageSPtr> packages;
+
+    const std::vector<SectionSPtr>& sections = mProject->sections();
+    for (std::vector<SectionSPtr>::const_iterator it = sections.begin(); it != sections.end(); ++it)
+    {
+        const SectionSPtr& section = *it;
+        const std::string& type = section->name()->value();
+        std::vector<CppImplementer::EExtensionType> extensions = sectionExtensions(type);
+        
+        const std::vector<FilePathSPtr>& paths = section->paths();
+        for (std::vector<FilePathSPtr>::const_iterator pit = paths.begin(); pit != paths.end(); ++pit)
+        {
+            const FilePathSPtr& path = *pit;
+            
+            SourceIdSPtr sourceId = mSourceProvider->sourceId(SourceIdSPtr(), path->path());
+            if (!sourceId)
+            {
+                std::cout << "ERROR: missing source compil file: " << path->path() << std::endl;
+                return false;
+            }
+
+            if (!packages.count(path->path()))
+            {
+                Parser parser;
+                PackageSPtr package;
+                if (!parser.parseDocumentPackage(mSourceProvider, sourceId, package))
+                    return false;
+                packages[path->path()] = package;
+            }
+            const PackageSPtr& package = packages[path->path()];
+
+            CppFormatterPtr formatter = boost::make_shared<CppFormatter>
+                (formatterConfiguration, package);
+            CppImplementerPtr implementer = boost::make_shared<CppImplementer>
+                (implementerConfiguration, formatter, mCorePackage);
+
+            for (std::vector<CppImplementer::EExtensionType>::const_iterator eit = extensions.begin();
+                 eit != extensions.end(); ++eit)
+            {
+                OutputData outputData;
+                outputData.section = type;
+                outputData.path = documentOutputPath(type, sourceId->original(), package, implementer,
+                                                     *eit, outputDirectory, flatOutput);
+                outputData.sources.push_back(sourceId->value());
+                mOutputs.push_back(outputData);
+
+                addUnitySource(type, package, implementer, *eit, outputDirectory, flatOutput, outputData.path);
+            }
+
+            if ((type == "main") && implementer->forwardHeaders())
+            {
+                OutputData outputData;
+                outputData.section = "fwd";
+                outputData.path = documentOutputPath("fwd", sourceId->original(), package, implementer,
+                                                     CppImplementer::declaration, outputDirectory, flatOutput);
+                outputData.sources.push_back(sourceId->value());
+                mOutputs.push_back(outputData);
+            }
+        }
+    }
+
+    listUnityOutputs();
     return true;
 }
 
+void GeneratorProject::addUnitySource(const std::string& type,
+                                      const PackageSPtr& package,
+                                      const CppImplementerPtr& implementer,
+                                      const CppImplementer::EExtensionType& extensionType,
+                                      const boost::filesystem::path& outputDirectory,
+                                      const bool flatOutput,
+                                      const boost::filesystem::path& output)
+{
+    if (mUnityFiles <= 0)
+        return;
+    if (extensionType != CppImplementer::definition)
+        return;
+    if ((type != "main") && (type != "partial"))
+        return;
+
+    boost::filesystem::path base = unityOutputBase(package, implementer, outputDirectory, flatOutput);
+    mUnitySources[base.generic_string()].push_back(output);
+}
+
+// the sources of all the outputs with the given paths
+static std::vector<std::string> outputSources(const std::vector<OutputData>& outputs,
+                                              const std::vector<boost::filesystem::path>& paths)
+{
+    std::vector<std::string> sources;
+    boost::unordered_set<std::string> visited;
+    for (std::vector<OutputData>::const_iterator it = outputs.begin(); it != outputs.end(); ++it)
+    {
+        if (std::find(paths.begin(), paths.end(), it->path) == paths.end())
+            continue;
+        for (std::vector<std::string>::const_iterator sit = it->sources.begin(); sit != it->sources.end(); ++sit)
+        {
+            if (visited.insert(*sit).second)
+                sources.push_back(*sit);
+        }
+    }
+    return sources;
+}
+
+void GeneratorProject::listUnityOutputs()
+{
+    // the distribution depends on the size of the generated definitions,
+    // so every unity file is assumed to depend on the whole package
+    std::map<std::string, std::vector<boost::filesystem::path> >::const_iterator it;
+    for (it = mUnitySources.begin(); it != mUnitySources.end(); ++it)
+    {
+        const std::vector<boost::filesystem::path>& definitions = it->second;
+        std::vector<std::string> sources = outputSources(mOutputs, definitions);
+
+        std::vector<boost::filesystem::path> paths =
+            unityOutputPaths(it->first, definitions.front().extension().string(), mUnityFiles);
+        for (std::vector<boost::filesystem::path>::const_iterator pit = paths.begin(); pit != paths.end(); ++pit)
+        {
+            OutputData outputData;
+            outputData.section = "unity";
+            outputData.path = *pit;
+            outputData.sources = sources;
+            mOutputs.push_back(outputData);
+        }
+    }
+}
+
+static bool isLargerDefinition(const std::pair<boost::uintmax_t, size_t>& definition1,
+                               const std::pair<boost::uintmax_t, size_t>& definition2)
+{
+    if (definition1.first != definition2.first)
+        return definition1.first > definition2.first;
+    return definition1.second < definition2.second;
+}
+
+bool GeneratorProject::writeUnityFiles()
+{
+    std::map<std::string, std::vector<boost::filesystem::path> >::const_iterator it;
+    for (it = mUnitySources.begin(); it != mUnitySources.end(); ++it)
+    {
+        const std::vector<boost::filesystem::path>& definitions = it->second;
+        std::vector<boost::filesystem::path> paths =
+            unityOutputPaths(it->first, definitions.front().extension().string(), mUnityFiles);
+
+        // the largest definitions go first, each to the least loaded unit
+        std::vector<std::pair<boost::uintmax_t, size_t> > sizes;
+        for (size_t i = 0; i < definitions.size(); ++i)
+        {
+            boost::system::error_code ec;
+            boost::uintmax_t size = boost::filesystem::file_size(definitions[i], ec);
+            sizes.push_back(std::make_pair(ec ? 0 : size, i));
+        }
+        std::sort(sizes.begin(), sizes.end(), isLargerDefinition);
+
+        std::vector<boost::uintmax_t> loads(paths.size(), 0);
+        std::vector<std::vector<size_t> > units(paths.size());
+        for (size_t i = 0; i < sizes.size(); ++i)
+        {
+            size_t unit = std::min_element(loads.begin(), loads.end()) - loads.begin();
+            loads[unit] += sizes[i].first;
+            units[unit].push_back(sizes[i].second);
+        }
+
+        for (size_t u = 0; u < paths.size(); ++u)
+        {
+            const boost::filesystem::path& path = paths[u];
+
+            // keep the order of the project in the unit
+            std::vector<size_t>& unit = units[u];
+            std::sort(unit.begin(), unit.end());
+
+            std::string package = boost::filesystem::path(it->first).filename().string();
+            package = boost::algorithm::erase_last_copy(package, "unity");
+            boost::algorithm::trim_right_if(package, boost::algorithm::is_any_of("-"));
+            std::replace(package.begin(), package.end(), '_', '.');
+
+            std::ostringstream content;
+            content << "// Unity translation unit";
+            if (!package.empty())
+                content << " of the package " << package;
+            if (paths.size() > 1)
+                content << " (" << (u + 1) << " of " << paths.size() << ")";
+            content << "\n\n";
+
+            std::vector<boost::filesystem::path> included;
+            for (std::vector<size_t>::const_iterator uit = unit.begin(); uit != unit.end(); ++uit)
+            {
+                const boost::filesystem::path& definition = definitions[*uit];
+                content << "#include \"" << definition.filename().string() << "\"\n";
+                included.push_back(definition);
+            }
+
+            OutputData outputData;
+            outputData.section = "unity";
+            outputData.path = path;
+            outputData.sources = outputSources(mOutputs, included);
+            mOutputs.push_back(outputData);
+
+            // rewriting an unchanged unity file would rebuild the whole package
+            std::ifstream existing(path.string().c_str());
+            std::stringstream existingContent;
+            existingContent << existing.rdbuf();
+            if (existing.is_open() && (existingContent.str() == content.str()))
+                continue;
+            existing.close();
+
+            std::cout << "#" << path.generic_string() << std::endl;
+            boost::shared_ptr<std::ostream> stream = openStream(path);
+            *stream << content.str();
+            if (!stream->good())
+            {
+                std::cout << "ERROR: could not write the unity file: " << path.generic_string() << std::endl;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+const std::vector<OutputData>& GeneratorProject::outputs() const
+{
+    return mOutputs;
+}
+
+static std::string escapeMakePath(const std::string& path)
+{
+    std::string result;
+    for (std::string::const_iterator it = path.begin(); it != path.end(); ++it)
+    {
+        if ((*it == ' ') || (*it == '#'))
+            result += '\\';
+        else if (*it == '$')
+            result += '$';
+        result += *it;
+    }
+    return result;
+}
+
+bool GeneratorProject::writeDepfile(const boost::filesystem::path& path) const
+{
+    boost::shared_ptr<std::ostream> stream = openStream(path);
+    if (!stream->good())
+    {
+        std::cout << "ERROR: could not write the depfile: " << path.generic_string() << std::endl;
+        return false;
+    }
+
+    for (std::vector<OutputData>::const_iterator it = mOutputs.begin(); it != mOutputs.end(); ++it)
+    {
+        const OutputData& output = *it;
+        *stream << escapeMakePath(output.path.generic_string()) << ":";
+
+        boost::unordered_set<std::string> written;
+        for (std::vector<std::string>::const_iterator sit = output.sources.begin(); sit != output.sources.end(); ++sit)
+        {
+            if (written.insert(*sit).second)
+                *stream << " \\\n    " << escapeMakePath(*sit);
+        }
+        // the sections and the options of the outputs come from the project
+        if (!mProjectFile.empty() && written.insert(mProjectFile).second)
+            *stream << " \\\n    " << escapeMakePath(mProjectFile);
+        *stream << "\n";
+    }
+    return stream->good();
+}
+
+bool GeneratorProject::writeManifest(const boost::filesystem::path& path) const
+{
+    boost::shared_ptr<std::ostream> stream = openStream(path);
+    if (!stream->good())
+    {
+        std::cout << "ERROR: could not write the manifest: " << path.generic_string() << std::endl;
+        return false;
+    }
+
+    for (std::vector<OutputData>::const_iterator it = mOutputs.begin(); it != mOutputs.end(); ++it)
+        *stream << it->section << " " << it->path.generic_string() << "\n";
+    return stream->good();
+}
+
 }
@@ -39,16 +39,20 @@
 #include "generator/generator.h"
 
 #include "compiler/i_source_provider.h"
+#include "compiler/tokenizer/token_cache.h"
 
 #include "language/compil/project/project.h"
 #include "language/compil/document/document.h"
 
 #include "core/boost/boost_path.h"
+#include "core/platform/thread.h"
 
 #include "boost/unordered_map.hpp"
 #include "boost/unordered_set.hpp"
 #include "boost/filesystem.hpp"
 
+#include <map>
+#include <ostream>
 #include <vector>
 
 namespace compil
@@ -59,6 +63,15 @@ struct SourceData
     std::time_t updateTime;
     std::string becauseOf;
     DocumentSPtr document;
+    // the document and all its transitive imports
+    std::vector<std::string> sources;
+};
+
+struct OutputData
+{
+    std::string section;
+    boost::filesystem::path path;
+    std::vector<std::string> sources;
 };
 
 typedef std::vector<std::string> string_vector;
@@ -76,6 +89,27 @@ public:
               const string_vector& sourceFiles,
               const string_vector& importDirectories);
               
+    // if set the tokenized sources are reused between the runs
+    void setTokenCache(const TokenCacheSPtr& tokenCache);
+
+    // if set the documents are parsed without their comments, so none
+    // of them reaches the generated code
+    void setDiscardComments(bool discard);
+
+    // in the streaming mode every document is parsed, generated and
+    // released before the next one, so the peak memory does not grow
+    // with the size of the project. No parsed import is kept, so every
+    // document parses again the imports it shares with the others
+    void setStreaming(bool streaming);
+
+    // if not 0 the definitions of every package are also amalgamated in
+    // that many size balanced unity translation units
+    void setUnityFiles(int unityFiles);
+
+    // the number of the documents parsed and validated in parallel. The
+    // streaming mode parses one document at a time
+    void setJobs(int jobs);
+
     bool parseDocuments();
     
     bool generate(const boost::filesystem::path& outputDirectory,
@@ -86,9 +120,58 @@ public:
                   const FormatterConfigurationSPtr& formatterConfiguration,
                   const ImplementerConfigurationSPtr& implementerConfiguration);
     
+    // Determines the outputs of all the sections parsing only the head
+    // of the documents. The core outputs depend on the content of the
+    // documents and they are not listed.
+    bool listOutputs(const boost::filesystem::path& outputDirectory,
+                     const bool flatOutput,
+                     const FormatterConfigurationSPtr& formatterConfiguration,
+                     const ImplementerConfigurationSPtr& implementerConfiguration);
+
+    // the outputs from the last generate or listOutputs
+    const std::vector<OutputData>& outputs() const;
+
+    // Makefile depfile with a rule for every output and all the sources it
+    // depends on, the project file included
+    bool writeDepfile(const boost::filesystem::path& path) const;
+    // the list of all the outputs with the sections they come from
+    bool writeManifest(const boost::filesystem::path& path) const;
+
     const boost::filesystem::path& projectDirectory() const;
+
+    // the total time spent in parsing in nanoseconds
+    long long parseTime() const;
     
 private:
+    void initCorePackage(const ImplementerConfigurationSPtr& implementerConfiguration);
+
+    bool parseDocument(const std::string& sourceFile);
+    bool parseSource(const std::string& sourceFile,
+                     const boost::shared_ptr<plt::Mutex>& pMutex,
+                     const TokenCacheSPtr& tokenCache,
+                     std::ostream& messages,
+                     SourceData& data);
+    static void parseJobs(void* jobs);
+
+    void addUnitySource(const std::string& type,
+                        const PackageSPtr& package,
+                        const CppImplementerPtr& implementer,
+                        const CppImplementer::EExtensionType& extensionType,
+                        const boost::filesystem::path& outputDirectory,
+                        const bool flatOutput,
+                        const boost::filesystem::path& output);
+    void listUnityOutputs();
+    bool writeUnityFiles();
+
+    bool generateDocument(const std::string& type,
+                          const FilePathSPtr& path,
+                          const boost::filesystem::path& outputDirectory,
+                          const bool flatOutput,
+                          const AlignerConfigurationSPtr& alignerConfiguration,
+                          const FormatterConfigurationSPtr& formatterConfiguration,
+                          const ImplementerConfigurationSPtr& implementerConfiguration);
+
+
     bool executeGenerator(const std::string& type,
                           const FilePathSPtr& path,
                           const CppImplementer::EExtensionType& extensionType,
@@ -113,7 +196,15 @@ private:
                               boost::filesystem::path& projectPath);
 
     ISourceProviderSPtr mSourceProvider;
+    TokenCacheSPtr mTokenCache;
+    bool mDiscardComments;
+    bool mStreaming;
+    int mUnityFiles;
+    int mJobs;
+    long long mParseTime;
     boost::filesystem::path mProjectDirectory;
+    // empty if the sources are given without a project file
+    std::string mProjectFile;
     ProjectSPtr mProject;
     PackageSPtr mCorePackage;
     // this time is used as minimum modification time for all documents.
@@ -124,6 +215,11 @@ private:
     boost::unordered_map<boost::filesystem::path, SourceData> mDocuments;
     
     boost::unordered_set<std::string> mCoreDependencies;
+
+    std::vector<OutputData> mOutputs;
+
+    // the definitions of every package by the base path of its unity files
+    std::map<std::string, std::vector<boost::filesystem::path> > mUnitySources;
 };
 
 }
@@ -31,12 +31,17 @@
 //
 
 #include "generator/project/generator_project.h"
+#include "generator/project/file_source_provider.h"
 #include "generator/project/test_source_provider.h"
 
 #include "gtest/gtest.h"
 
+#include "boost/algorithm/string.hpp"
 #include "boost/make_shared.hpp"
 
+#include <fstream>
+#include <sstream>
+
 namespace compil
 {
 
@@ -61,6 +66,33 @@ static std::string document2 =
 static std::string documentError =
 "blah\n";
 
+static std::string documentShared =
+"compil {}\n"
+"\n"
+"structure Shared\n"
+"{\n"
+"    integer value;\n"
+"}\n";
+
+static std::string documentImportingShared1 =
+"compil {}\n"
+"import \"shared.compil\";\n"
+"\n"
+"structure A\n"
+"{\n"
+"    Shared shared;\n"
+"}\n";
+
+static std::string documentImportingShared2 =
+"compil {}\n"
+"import \"shared.compil\";\n"
+"\n"
+"structure B\n"
+"{\n"
+"    Shared shared;\n"
+"    integer count;\n"
+"}\n";
+
 TEST(GeneratorProjectTests, initProjectFile)
 {
     TestSourceProviderSPtr provider = boost::make_shared<TestSourceProvider>();
@@ -175,5 +207,261 @@ TEST(GeneratorProjectTests, parseDocumentsNegative)
     EXPECT_FALSE(project.parseDocuments());
 }
 
+TEST(GeneratorProjectTests, parseDocumentsParallel)
+{
+    TestSourceProviderSPtr provider = boost::make_shared<TestSourceProvider>();
+    provider->setWorkingDirectory("/foo/");
+    provider->file("/foo/a.compilprj", project1);
+    provider->file("/foo/a.compil", document1);
+    provider->file("/foo/b.compil", document2);
+
+    string_vector sources;
+    string_vector imports;
+    
+    GeneratorProject project(provider);
+    project.setJobs(4);
+    EXPECT_TRUE(project.init(false, "/foo/a.compilprj", "", "main", sources, imports));
+    EXPECT_TRUE(project.parseDocuments());
+    EXPECT_LT(0, project.parseTime());
+}
+
+TEST(GeneratorProjectTests, parseDocumentsParallelNegative)
+{
+    TestSourceProviderSPtr provider = boost::make_shared<TestSourceProvider>();
+    provider->setWorkingDirectory("/foo/");
+    provider->file("/foo/a.compilprj", project1);
+    provider->file("/foo/a.compil", documentError);
+    provider->file("/foo/b.compil", document2);
+
+    string_vector sources;
+    string_vector imports;
+    
+    GeneratorProject project(provider);
+    project.setJobs(4);
+    EXPECT_TRUE(project.init(false, "/foo/a.compilprj", "", "main", sources, imports));
+    EXPECT_FALSE(project.parseDocuments());
+}
+
+TEST(GeneratorProjectTests, parseDocumentsStreaming)
+{
+    TestSourceProviderSPtr provider = boost::make_shared<TestSourceProvider>();
+    provider->setWorkingDirectory("/foo/");
+    provider->file("/foo/a.compilprj", project1);
+    provider->file("/foo/a.compil", documentError);
+    provider->file("/foo/b.compil", document2);
+
+    string_vector sources;
+    string_vector imports;
+    
+    // the documents are parsed in the generation
+    GeneratorProject project(provider);
+    project.setStreaming(true);
+    EXPECT_TRUE(project.init(false, "/foo/a.compilprj", "", "main", sources, imports));
+    EXPECT_TRUE(project.parseDocuments());
+    EXPECT_EQ(0, project.parseTime());
+}
+
+TEST(GeneratorProjectTests, listOutputs)
+{
+    TestSourceProviderSPtr provider = boost::make_shared<TestSourceProvider>();
+    provider->setWorkingDirectory("/foo/");
+    provider->file("/foo/a.compilprj", project1);
+    provider->file("/foo/a.compil", document1);
+    provider->file("/foo/b.compil", document2);
+
+    string_vector sources;
+    string_vector imports;
+    
+    GeneratorProject project(provider);
+    EXPECT_TRUE(project.init(false, "/foo/a.compilprj", "", "main", sources, imports));
+    ASSERT_TRUE(project.listOutputs("/out", false,
+                                    boost::make_shared<FormatterConfiguration>(),
+                                    boost::make_shared<ImplementerConfiguration>()));
+
+    const std::vector<OutputData>& outputs = project.outputs();
+    ASSERT_EQ(4U, outputs.size());
+    EXPECT_STREQ("main", outputs[0].section.c_str());
+    EXPECT_STREQ("/out/a.cpp", outputs[0].path.generic_string().c_str());
+    EXPECT_STREQ("/out/a.h", outputs[1].path.generic_string().c_str());
+    EXPECT_STREQ("/out/b.cpp", outputs[2].path.generic_string().c_str());
+    EXPECT_STREQ("/out/b.h", outputs[3].path.generic_string().c_str());
+}
+
+TEST(GeneratorProjectTests, listOutputsForwardHeaders)
+{
+    TestSourceProviderSPtr provider = boost::make_shared<TestSourceProvider>();
+    provider->setWorkingDirectory("/foo/");
+    provider->file("/foo/a.compilprj", project1);
+    provider->file("/foo/a.compil", document1);
+    provider->file("/foo/b.compil", document2);
+
+    string_vector sources;
+    string_vector imports;
+    
+    ImplementerConfigurationSPtr implementerConfiguration = boost::make_shared<ImplementerConfiguration>();
+    implementerConfiguration->mCppForwardHeader = ImplementerConfiguration::forward_header_per_document;
+
+    GeneratorProject project(provider);
+    EXPECT_TRUE(project.init(false, "/foo/a.compilprj", "", "main", sources, imports));
+    ASSERT_TRUE(project.listOutputs("/out", false,
+                                    boost::make_shared<FormatterConfiguration>(),
+                                    implementerConfiguration));
+
+    const std::vector<OutputData>& outputs = project.outputs();
+    ASSERT_EQ(6U, outputs.size());
+    EXPECT_STREQ("/out/a.h", outputs[1].path.generic_string().c_str());
+    EXPECT_STREQ("fwd", outputs[2].section.c_str());
+    EXPECT_STREQ("/out/a-fwd.h", outputs[2].path.generic_string().c_str());
+    EXPECT_STREQ("/out/b-fwd.h", outputs[5].path.generic_string().c_str());
 }
 
+TEST(GeneratorProjectTests, listOutputsUnity)
+{
+    TestSourceProviderSPtr provider = boost::make_shared<TestSourceProvider>();
+    provider->setWorkingDirectory("/foo/");
+    provider->file("/foo/a.compilprj", project1);
+    provider->file("/foo/a.compil", document1);
+    provider->file("/foo/b.compil", document2);
+
+    string_vector sources;
+    string_vector imports;
+
+    GeneratorProject project(provider);
+    project.setUnityFiles(2);
+    EXPECT_TRUE(project.init(false, "/foo/a.compilprj", "", "main", sources, imports));
+    ASSERT_TRUE(project.listOutputs("/out", false,
+                                    boost::make_shared<FormatterConfiguration>(),
+                                    boost::make_shared<ImplementerConfiguration>()));
+
+    const std::vector<OutputData>& outputs = project.outputs();
+    ASSERT_EQ(6U, outputs.size());
+    EXPECT_STREQ("unity", outputs[4].section.c_str());
+    EXPECT_STREQ("/out/unity-1.cpp", outputs[4].path.generic_string().c_str());
+    EXPECT_STREQ("/out/unity-2.cpp", outputs[5].path.generic_string().c_str());
+    EXPECT_EQ(2U, outputs[4].sources.size());
+}
+
+
+class GeneratorProjectFileTests : public testing::Test
+{
+public:
+    virtual void SetUp()
+    {
+        mDirectory = boost::filesystem::temp_directory_path()
+                   / boost::filesystem::unique_path("compil-%%%%-%%%%-%%%%");
+        boost::filesystem::create_directories(mDirectory);
+        file("a.compilprj", project1);
+        file("a.compil", documentImportingShared1);
+        file("b.compil", documentImportingShared2);
+        file("shared.compil", documentShared);
+    }
+
+    virtual void TearDown()
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(mDirectory, ec);
+    }
+
+protected:
+    void file(const std::string& name, const std::string& content)
+    {
+        std::ofstream stream((mDirectory / name).string().c_str());
+        stream << content;
+    }
+
+    // generates the project, its depfile and its manifest in the mode
+    // directory
+    bool generate(const std::string& mode, bool streaming)
+    {
+        boost::filesystem::path directory = mDirectory / mode;
+        FileSourceProviderPtr provider(new FileSourceProvider());
+        provider->setWorkingDirectory(mDirectory);
+
+        string_vector sources;
+        string_vector imports;
+
+        GeneratorProject project(provider);
+        project.setStreaming(streaming);
+        if (!project.init(false, (mDirectory / "a.compilprj").string(), "", "main", sources, imports))
+            return false;
+        if (!project.parseDocuments())
+            return false;
+        if (!project.generate(directory / "out", false, directory / "core", false,
+                              boost::make_shared<AlignerConfiguration>(),
+                              boost::make_shared<FormatterConfiguration>(),
+                              boost::make_shared<ImplementerConfiguration>()))
+            return false;
+        return project.writeDepfile(directory / "a.d")
+            && project.writeManifest(directory / "a.manifest");
+    }
+
+    // the content of the file in the mode directory, with the directory
+    // replaced by <output>
+    std::string output(const std::string& mode, const std::string& name)
+    {
+        std::ifstream stream((mDirectory / mode / name).string().c_str());
+        std::stringstream content;
+        content << stream.rdbuf();
+        std::string result = content.str();
+        boost::replace_all(result, (mDirectory / mode).generic_string(), "<output>");
+        return result;
+    }
+
+    boost::filesystem::path mDirectory;
+};
+
+TEST_F(GeneratorProjectFileTests, streamingGeneratesTheSameAsBatch)
+{
+    ASSERT_TRUE(generate("batch", false));
+    ASSERT_TRUE(generate("streaming", true));
+
+    std::string manifest = output("batch", "a.manifest");
+    EXPECT_EQ(manifest, output("streaming", "a.manifest"));
+    std::string depfile = output("batch", "a.d");
+    EXPECT_EQ(depfile, output("streaming", "a.d"));
+
+    std::vector<std::string> lines;
+    boost::split(lines, manifest, boost::is_any_of("\n"));
+    size_t compared = 0;
+    for (std::vector<std::string>::const_iterator it = lines.begin(); it != lines.end(); ++it)
+    {
+        std::string::size_type position = it->find("<output>/");
+        if (position == std::string::npos)
+            continue;
+        std::string name = it->substr(position + std::string("<output>/").size());
+        EXPECT_EQ(output("batch", name), output("streaming", name)) << name;
+        ++compared;
+    }
+    EXPECT_EQ(4U, compared);
+
+    // every output depends on the shared import
+    std::string shared = (mDirectory / "shared.compil").generic_string();
+    size_t count = 0;
+    for (std::string::size_type position = depfile.find(shared); position != std::string::npos;
+         position = depfile.find(shared, position + 1))
+        ++count;
+    EXPECT_EQ(4U, count);
+}
+
+
+TEST_F(GeneratorProjectFileTests, depfileListsTheProjectFile)
+{
+    ASSERT_TRUE(generate("batch", false));
+
+    std::string depfile = output("batch", "a.d");
+    std::string rule = "<output>/out/a.h: \\\n"
+                       "    " + (mDirectory / "a.compil").generic_string() + " \\\n"
+                       "    " + (mDirectory / "shared.compil").generic_string() + " \\\n"
+                       "    " + (mDirectory / "a.compilprj").generic_string() + "\n";
+    EXPECT_NE(std::string::npos, depfile.find(rule)) << depfile;
+
+    // a change of the project could change every output
+    std::string project = (mDirectory / "a.compilprj").generic_string();
+    size_t count = 0;
+    for (std::string::size_type position = depfile.find(project); position != std::string::npos;
+         position = depfile.find(project, position + 1))
+        ++count;
+    EXPECT_EQ(4U, count);
+}
+
+}
@@ -40,10 +40,33 @@
 namespace compil
 {
 
-HookSourceProvider::HookSourceProvider(const ISourceProviderSPtr& sourceProvider, const std::time_t& initTime)
+// holds the mutex of the provider locked if there is one
+class ProviderLock
+{
+public:
+    ProviderLock(const boost::shared_ptr<plt::Mutex>& pMutex)
+        : mpMutex(pMutex.get())
+    {
+        if (mpMutex)
+            mpMutex->lock();
+    }
+
+    ~ProviderLock()
+    {
+        if (mpMutex)
+            mpMutex->unlock();
+    }
+
+private:
+    plt::Mutex* mpMutex;
+};
+
+HookSourceProvider::HookSourceProvider(const ISourceProviderSPtr& sourceProvider, const std::time_t& initTime,
+                                       const boost::shared_ptr<plt::Mutex>& pMutex)
     : mUpdateTime(initTime)
     , mBecauseOf("the generator")
     , mSourceProvider(sourceProvider)
+    , mpMutex(pMutex)
 {
 }
 
@@ -53,6 +76,7 @@ HookSourceProvider::~HookSourceProvider()
 
 SourceIdSPtr HookSourceProvider::sourceId(const SourceIdSPtr& pCurrentSourceId, const std::string& source)
 {
+    ProviderLock lock(mpMutex);
     return mSourceProvider->sourceId(pCurrentSourceId, source);
 }
 
@@ -64,49 +88,65 @@ StreamPtr HookSourceProvider::openInputStream(const SourceIdSPtr& pSourceId)
         mBecauseOf = pSourceId->original();
         mUpdateTime = sourceTime;
     }
+    mSources.push_back(pSourceId->value());
+    ProviderLock lock(mpMutex);
     return mSourceProvider->openInputStream(pSourceId);
 }
 
 void HookSourceProvider::setImportDirectories(const std::vector<boost::filesystem::path>& importDirectories)
 {
+    ProviderLock lock(mpMutex);
     mSourceProvider->setImportDirectories(importDirectories);
 }
 
 boost::filesystem::path HookSourceProvider::workingDirectory()
 {
+    ProviderLock lock(mpMutex);
     return mSourceProvider->workingDirectory();
 }
 
 void HookSourceProvider::setWorkingDirectory(const boost::filesystem::path& directory)
 {
+    ProviderLock lock(mpMutex);
     return mSourceProvider->setWorkingDirectory(directory);
 }
 
 bool HookSourceProvider::isAbsolute(const boost::filesystem::path& file)
 {
+    ProviderLock lock(mpMutex);
     return mSourceProvider->isAbsolute(file);
 }
 
 bool HookSourceProvider::isExists(const boost::filesystem::path& file)
 {
+    ProviderLock lock(mpMutex);
     return mSourceProvider->isExists(file);
 }
 
 std::time_t HookSourceProvider::fileTime(const boost::filesystem::path& file)
 {
+    ProviderLock lock(mpMutex);
     return mSourceProvider->fileTime(file);
 }
 
 boost::filesystem::path HookSourceProvider::directory(const boost::filesystem::path& file)
 {
+    ProviderLock lock(mpMutex);
     return mSourceProvider->directory(file);
 }
 
 boost::filesystem::path HookSourceProvider::absolute(const boost::filesystem::path& file)
 {
+    ProviderLock lock(mpMutex);
     return mSourceProvider->absolute(file);
 }
 
+void HookSourceProvider::refresh()
+{
+    ProviderLock lock(mpMutex);
+    mSourceProvider->refresh();
+}
+
 std::time_t HookSourceProvider::getUpdateTime()
 {
     return mUpdateTime;
@@ -117,5 +157,10 @@ std::string HookSourceProvider::getBecauseOf()
     return mBecauseOf;
 }
 
+const std::vector<std::string>& HookSourceProvider::getSources()
+{
+    return mSources;
+}
+
 }
 
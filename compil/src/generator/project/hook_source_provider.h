@@ -35,16 +35,24 @@
 
 #include "compiler/i_source_provider.h"
 
+#include "core/platform/thread.h"
+
 #include <boost/shared_ptr.hpp>
 #include <boost/unordered_map.hpp>
 
+#include <vector>
+
 namespace compil
 {
 
+// Records the sources opened for a document. If there is a mutex the
+// calls to the source provider are serialized with it, so the documents
+// parsed in parallel could share one provider
 class HookSourceProvider : public ISourceProvider
 {
 public:
-    HookSourceProvider(const ISourceProviderSPtr& sourceProvider, const std::time_t& initTime);
+    HookSourceProvider(const ISourceProviderSPtr& sourceProvider, const std::time_t& initTime,
+                       const boost::shared_ptr<plt::Mutex>& pMutex = boost::shared_ptr<plt::Mutex>());
     virtual ~HookSourceProvider();
 
     virtual SourceIdSPtr sourceId(const SourceIdSPtr& pCurrentSourceId, const std::string& source);
@@ -60,14 +68,20 @@ public:
 
     virtual boost::filesystem::path directory(const boost::filesystem::path& file);
     virtual boost::filesystem::path absolute(const boost::filesystem::path& file);
+
+    virtual void refresh();
     
     std::time_t getUpdateTime();
     std::string getBecauseOf();
+    // all the opened sources - the document and its transitive imports
+    const std::vector<std::string>& getSources();
 
 private:
     std::time_t mUpdateTime;
     std::string mBecauseOf;
+    std::vector<std::string> mSources;
     ISourceProviderSPtr mSourceProvider;
+    boost::shared_ptr<plt::Mutex> mpMutex;
 };
 
 typedef boost::shared_ptr<HookSourceProvider> HookSourceProviderSPtr;
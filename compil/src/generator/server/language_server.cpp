@@ -0,0 +1,481 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/server/language_server.h"
+
+#include "compiler/tokenizer/tokenizer.h"
+
+#include <boost/make_shared.hpp>
+#include <boost/optional.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace compil
+{
+
+static const char* jsonrpc = "{\"jsonrpc\":\"2.0\"";
+
+static std::string quote(const std::string& text)
+{
+    std::string result = "\"";
+    for (std::string::const_iterator it = text.begin(); it != text.end(); ++it)
+    {
+        unsigned char ch = *it;
+        switch (ch)
+        {
+            case '"':  result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default:
+                if (ch < 0x20)
+                {
+                    char escaped[8];
+                    sprintf(escaped, "\\u%04x", ch);
+                    result += escaped;
+                }
+                else
+                {
+                    result += ch;
+                }
+        }
+    }
+    return result + "\"";
+}
+
+// the end of the JSON string that opens at the position
+static size_t stringEnd(const std::string& message, size_t position)
+{
+    for (++position; position < message.size(); ++position)
+    {
+        if (message[position] == '\\')
+            ++position;
+        else if (message[position] == '"')
+            return position + 1;
+    }
+    return message.size();
+}
+
+// the property tree keeps all the values as strings and would lose whether
+// the id was a number or a string, so the raw token of the top level id is
+// echoed back as it was sent
+static std::string identifier(const std::string& message)
+{
+    int depth = 0;
+    for (size_t position = 0; position < message.size(); ++position)
+    {
+        char ch = message[position];
+        if (ch == '{' || ch == '[')
+        {
+            ++depth;
+        }
+        else if (ch == '}' || ch == ']')
+        {
+            --depth;
+        }
+        else if (ch == '"')
+        {
+            size_t end = stringEnd(message, position);
+            size_t value = message.find_first_not_of(" \t\r\n", end);
+            if (depth != 1 || message.compare(position, end - position, "\"id\"") != 0
+                || value == std::string::npos || message[value] != ':')
+            {
+                position = end - 1;
+                continue;
+            }
+
+            value = message.find_first_not_of(" \t\r\n", value + 1);
+            if (value == std::string::npos)
+                break;
+            if (message[value] == '"')
+                return message.substr(value, stringEnd(message, value) - value);
+            end = message.find_first_of(",} \t\r\n", value);
+            if (end == std::string::npos)
+                break;
+            return message.substr(value, end - value);
+        }
+    }
+    return "null";
+}
+
+static std::string response(const std::string& message, const std::string& result)
+{
+    return jsonrpc + std::string(",\"id\":") + identifier(message) + ",\"result\":" + result + "}";
+}
+
+static std::string error(const std::string& id, int code, const std::string& text)
+{
+    std::ostringstream stream;
+    stream << jsonrpc << ",\"id\":" << id
+           << ",\"error\":{\"code\":" << code << ",\"message\":" << quote(text) << "}}";
+    return stream.str();
+}
+
+// the length of the UTF-8 sequence from its first byte
+static size_t sequenceLength(unsigned char ch)
+{
+    if ((ch >> 5) == 0x6)
+        return 2;
+    if ((ch >> 4) == 0xE)
+        return 3;
+    if ((ch >> 3) == 0x1E)
+        return 4;
+    return 1;
+}
+
+// the protocol counts the characters in UTF-16 code units
+static size_t codeUnits(size_t sequence)
+{
+    return sequence == 4 ? 2 : 1;
+}
+
+static bool isEOL(char ch)
+{
+    return ch == '\n' || ch == '\r';
+}
+
+static size_t lineBegin(const std::string& text, size_t line)
+{
+    size_t position = 0;
+    for (; line > 0 && position < text.size(); ++position)
+    {
+        char ch = text[position];
+        if (ch == '\r' && position + 1 < text.size() && text[position + 1] == '\n')
+            ++position;
+        if (isEOL(ch))
+            --line;
+    }
+    return position;
+}
+
+LanguageServer::LanguageServer(const ISourceProviderSPtr& pSourceProvider)
+    : mpSourceProvider(pSourceProvider)
+    , mShutdown(false)
+    , mExit(false)
+{
+}
+
+LanguageServer::~LanguageServer()
+{
+}
+
+int LanguageServer::run(std::istream& input, std::ostream& output)
+{
+    std::string message;
+    while (readMessage(input, message))
+    {
+        if (!handle(message, output))
+            break;
+    }
+    return mExit && mShutdown ? 0 : 1;
+}
+
+bool LanguageServer::handle(const std::string& message, std::ostream& output)
+{
+    Tree tree;
+    try
+    {
+        std::istringstream stream(message);
+        boost::property_tree::read_json(stream, tree);
+    }
+    catch (const boost::property_tree::json_parser_error& e)
+    {
+        writeMessage(output, error("null", -32700, e.message()));
+        return true;
+    }
+
+    static const Tree empty;
+    const std::string method = tree.get<std::string>("method", "");
+    const Tree& params = tree.get_child("params", empty);
+    const bool request = tree.get_child_optional("id");
+
+    try
+    {
+        if (method == "initialize")
+        {
+            writeMessage(output, response(message,
+                "{\"capabilities\":{\"textDocumentSync\":{\"openClose\":true,\"change\":2}},"
+                "\"serverInfo\":{\"name\":\"compil\"}}"));
+        }
+        else if (method == "shutdown")
+        {
+            mShutdown = true;
+            writeMessage(output, response(message, "null"));
+        }
+        else if (method == "exit")
+        {
+            mExit = true;
+            return false;
+        }
+        else if (method == "textDocument/didOpen")
+        {
+            didOpen(params, output);
+        }
+        else if (method == "textDocument/didChange")
+        {
+            didChange(params, output);
+        }
+        else if (method == "textDocument/didClose")
+        {
+            didClose(params, output);
+        }
+        else if (request)
+        {
+            writeMessage(output, error(identifier(message), -32601, "unknown method " + method));
+        }
+    }
+    catch (const boost::property_tree::ptree_error& e)
+    {
+        if (request)
+            writeMessage(output, error(identifier(message), -32602, e.what()));
+    }
+    return true;
+}
+
+bool LanguageServer::readMessage(std::istream& input, std::string& message)
+{
+    static const std::string contentLength = "Content-Length:";
+
+    size_t length = 0;
+    bool hasLength = false;
+    std::string header;
+    while (std::getline(input, header))
+    {
+        if (!header.empty() && header[header.size() - 1] == '\r')
+            header.erase(header.size() - 1);
+
+        if (!header.empty())
+        {
+            if (header.compare(0, contentLength.size(), contentLength) == 0)
+            {
+                length = strtoul(header.c_str() + contentLength.size(), NULL, 10);
+                hasLength = true;
+            }
+            continue;
+        }
+
+        if (!hasLength)
+            continue;
+
+        message.resize(length);
+        if (length > 0)
+            input.read(&message[0], length);
+        return (size_t)input.gcount() == length || length == 0;
+    }
+    return false;
+}
+
+void LanguageServer::writeMessage(std::ostream& output, const std::string& message)
+{
+    output << "Content-Length: " << message.size() << "\r\n\r\n" << message << std::flush;
+}
+
+size_t LanguageServer::offset(const std::string& text, size_t line, size_t character)
+{
+    size_t position = lineBegin(text, line);
+    while (character > 0 && position < text.size() && !isEOL(text[position]))
+    {
+        size_t sequence = sequenceLength(text[position]);
+        if (codeUnits(sequence) > character)
+            break;
+        character -= codeUnits(sequence);
+        position = std::min(position + sequence, text.size());
+    }
+    return position;
+}
+
+size_t LanguageServer::character(const std::string& text, size_t line, size_t column)
+{
+    // the tokenizer columns start from 1, count the bytes and align the
+    // tabs (see Tokenizer::absorbed)
+    size_t position = lineBegin(text, line);
+    size_t current = 1;
+    size_t result = 0;
+    while (current < column && position < text.size() && !isEOL(text[position]))
+    {
+        size_t sequence = sequenceLength(text[position]);
+        if (text[position] == '\t')
+            current += Tokenizer::nTabSize - (current - 1) % Tokenizer::nTabSize;
+        else
+            current += sequence;
+        result += codeUnits(sequence);
+        position += sequence;
+    }
+    return result;
+}
+
+std::string LanguageServer::path(const std::string& uri)
+{
+    static const std::string scheme = "file://";
+
+    std::string encoded = uri;
+    if (encoded.compare(0, scheme.size(), scheme) == 0)
+        encoded.erase(0, scheme.size());
+
+    std::string result;
+    for (size_t i = 0; i < encoded.size(); ++i)
+    {
+        if (encoded[i] == '%' && i + 2 < encoded.size())
+        {
+            result += (char)strtol(encoded.substr(i + 1, 2).c_str(), NULL, 16);
+            i += 2;
+            continue;
+        }
+        result += encoded[i];
+    }
+
+    // file:///c:/path
+    if (result.size() > 2 && result[0] == '/' && result[2] == ':')
+        result.erase(0, 1);
+    return result;
+}
+
+void LanguageServer::didOpen(const Tree& params, std::ostream& output)
+{
+    const std::string uri = params.get<std::string>("textDocument.uri");
+    const std::string file = path(uri);
+
+    // the imports could have been created or changed since the last parse
+    mpSourceProvider->refresh();
+
+    // a new document could be not saved yet
+    SourceIdSPtr pSourceId = mpSourceProvider->sourceId(SourceIdSPtr(), file);
+    if (!pSourceId)
+        pSourceId = SourceId::Builder().set_value(file).set_original(file).finalize();
+
+    DocumentSessionSPtr session = boost::make_shared<DocumentSession>(mpSourceProvider, pSourceId);
+    session->open(params.get<std::string>("textDocument.text"));
+    mSessions[uri] = session;
+    publishDiagnostics(uri, output);
+}
+
+void LanguageServer::didChange(const Tree& params, std::ostream& output)
+{
+    const std::string uri = params.get<std::string>("textDocument.uri");
+    std::map<std::string, DocumentSessionSPtr>::iterator found = mSessions.find(uri);
+    if (found == mSessions.end())
+        return;
+
+    const DocumentSessionSPtr& session = found->second;
+    const Tree& changes = params.get_child("contentChanges");
+    for (Tree::const_iterator it = changes.begin(); it != changes.end(); ++it)
+    {
+        const Tree& change = it->second;
+        const std::string text = change.get<std::string>("text");
+
+        boost::optional<const Tree&> range = change.get_child_optional("range");
+        if (!range)
+        {
+            mpSourceProvider->refresh();
+            session->open(text);
+            continue;
+        }
+
+        size_t begin = offset(session->text(),
+                              range->get<size_t>("start.line"),
+                              range->get<size_t>("start.character"));
+        size_t end = offset(session->text(),
+                            range->get<size_t>("end.line"),
+                            range->get<size_t>("end.character"));
+        session->edit(begin, std::max(begin, end), text);
+    }
+    publishDiagnostics(uri, output);
+}
+
+void LanguageServer::didClose(const Tree& params, std::ostream& output)
+{
+    const std::string uri = params.get<std::string>("textDocument.uri");
+    mSessions.erase(uri);
+    publishDiagnostics(uri, output);
+}
+
+void LanguageServer::publishDiagnostics(const std::string& uri, std::ostream& output)
+{
+    std::ostringstream diagnostics;
+
+    std::map<std::string, DocumentSessionSPtr>::const_iterator found = mSessions.find(uri);
+    if (found != mSessions.end())
+    {
+        const DocumentSessionSPtr& session = found->second;
+        const std::vector<Message>& messages = session->messages();
+        for (std::vector<Message>::const_iterator it = messages.begin(); it != messages.end(); ++it)
+        {
+            size_t line = 0;
+            size_t character = 0;
+            std::string text = it->text();
+
+            SourceIdSPtr pSourceId = it->sourceId();
+            if (!pSourceId || pSourceId->value() == session->sourceId()->value())
+            {
+                line = std::max(it->line().value(), 1L) - 1;
+                character = LanguageServer::character(session->text(), line, it->column().value());
+            }
+            else
+            {
+                // the messages of the imported documents are shown at the
+                // beginning of the document
+                std::ostringstream prefixed;
+                prefixed << pSourceId->value() << ":"
+                         << it->line().value() << ":"
+                         << it->column().value() << " "
+                         << text;
+                text = prefixed.str();
+            }
+
+            int severity = 3;
+            if (it->severity() == Message::SEVERITY_ERROR)
+                severity = 1;
+            else if (it->severity() == Message::SEVERITY_WARNING)
+                severity = 2;
+
+            if (it != messages.begin())
+                diagnostics << ",";
+            diagnostics << "{\"range\":{"
+                        << "\"start\":{\"line\":" << line << ",\"character\":" << character << "},"
+                        << "\"end\":{\"line\":" << line << ",\"character\":" << character << "}},"
+                        << "\"severity\":" << severity << ","
+                        << "\"source\":\"compil\","
+                        << "\"message\":" << quote(text) << "}";
+        }
+    }
+
+    writeMessage(output, jsonrpc + std::string(",\"method\":\"textDocument/publishDiagnostics\",")
+                       + "\"params\":{\"uri\":" + quote(uri) + ",\"diagnostics\":[" + diagnostics.str() + "]}}");
+}
+
+}
@@ -0,0 +1,106 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+
+#ifndef _LANGUAGE_SERVER_H__
+#define _LANGUAGE_SERVER_H__
+
+#include "compiler/document_session.h"
+#include "compiler/i_source_provider.h"
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace compil
+{
+
+// Serves the diagnostics of the documents opened in an editor over the
+// language server protocol. Every open document is kept in a
+// DocumentSession, so an edit is tokenized and parsed incrementally.
+// The messages are read and written with their Content-Length headers
+class LanguageServer
+{
+public:
+    LanguageServer(const ISourceProviderSPtr& pSourceProvider);
+    ~LanguageServer();
+
+    // serves the messages from the input until the exit notification or
+    // the end of the input. Returns the exit code of the process
+    int run(std::istream& input, std::ostream& output);
+
+    // handles one message. Returns false after the exit notification
+    bool handle(const std::string& message, std::ostream& output);
+
+    static bool readMessage(std::istream& input, std::string& message);
+    static void writeMessage(std::ostream& output, const std::string& message);
+
+    // converts between the protocol positions (line and character from 0)
+    // and the source offsets or the tokenizer columns
+    static size_t offset(const std::string& text, size_t line, size_t character);
+    static size_t character(const std::string& text, size_t line, size_t column);
+
+    static std::string path(const std::string& uri);
+
+private:
+    typedef boost::property_tree::ptree Tree;
+
+    void didOpen(const Tree& params, std::ostream& output);
+    void didChange(const Tree& params, std::ostream& output);
+    void didClose(const Tree& params, std::ostream& output);
+
+    void publishDiagnostics(const std::string& uri, std::ostream& output);
+
+    ISourceProviderSPtr mpSourceProvider;
+    std::map<std::string, DocumentSessionSPtr> mSessions;
+    bool mShutdown;
+    bool mExit;
+};
+
+typedef boost::shared_ptr<LanguageServer> LanguageServerSPtr;
+
+}
+
+#else
+
+namespace compil
+{
+
+class LanguageServer;
+typedef boost::shared_ptr<LanguageServer> LanguageServerSPtr;
+
+}
+
+#endif // _LANGUAGE_SERVER_H__
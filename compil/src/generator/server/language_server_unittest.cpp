@@ -0,0 +1,273 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * The name of George Georgiev can not be used to endorse or 
+// promote products derived from this software without specific prior 
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+//
+
+#include "generator/server/language_server.h"
+#include "generator/project/file_source_provider.h"
+#include "generator/project/test_source_provider.h"
+
+#include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+
+#include <fstream>
+#include <sstream>
+
+namespace compil
+{
+
+class LanguageServerTests : public testing::Test
+{
+public:
+    virtual void SetUp()
+    {
+        mpServer.reset(new LanguageServer(boost::make_shared<TestSourceProvider>()));
+    }
+
+    // handles the message and returns the messages written by the server
+    std::vector<std::string> handle(const std::string& message)
+    {
+        std::ostringstream output;
+        EXPECT_TRUE(mpServer->handle(message, output));
+
+        std::vector<std::string> messages;
+        std::istringstream input(output.str());
+        std::string written;
+        while (LanguageServer::readMessage(input, written))
+            messages.push_back(written);
+        return messages;
+    }
+
+    static std::string change(int line, int character, int endLine, int endCharacter,
+                              const std::string& text)
+    {
+        std::ostringstream stream;
+        stream << "{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/didChange\",\"params\":{"
+               << "\"textDocument\":{\"uri\":\"file:///project/a%20b.compil\",\"version\":2},"
+               << "\"contentChanges\":[{\"range\":{"
+               << "\"start\":{\"line\":" << line << ",\"character\":" << character << "},"
+               << "\"end\":{\"line\":" << endLine << ",\"character\":" << endCharacter << "}},"
+               << "\"text\":\"" << text << "\"}]}}";
+        return stream.str();
+    }
+
+protected:
+    LanguageServerSPtr mpServer;
+};
+
+static const char* gOpen =
+    "{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/didOpen\",\"params\":{\"textDocument\":{"
+    "\"uri\":\"file:///project/a%20b.compil\",\"languageId\":\"compil\",\"version\":1,"
+    "\"text\":\"compil { }\\n\\nstructure S\\n{\\n\\tinteger i = 1;\\n\\tT t;\\n}\\n\"}}}";
+
+TEST_F(LanguageServerTests, readMessage)
+{
+    std::ostringstream output;
+    LanguageServer::writeMessage(output, "{\"a\":1}");
+    LanguageServer::writeMessage(output, "{}");
+    EXPECT_EQ("Content-Length: 7\r\n\r\n{\"a\":1}Content-Length: 2\r\n\r\n{}", output.str());
+
+    std::istringstream input(output.str());
+    std::string message;
+    ASSERT_TRUE(LanguageServer::readMessage(input, message));
+    EXPECT_EQ("{\"a\":1}", message);
+    ASSERT_TRUE(LanguageServer::readMessage(input, message));
+    EXPECT_EQ("{}", message);
+    EXPECT_FALSE(LanguageServer::readMessage(input, message));
+}
+
+TEST_F(LanguageServerTests, positions)
+{
+    const std::string text = "a\r\n\tb\xc3\xa9" "c\n\xf0\x9f\x98\x80x";
+    EXPECT_EQ(0U, LanguageServer::offset(text, 0, 0));
+    EXPECT_EQ(1U, LanguageServer::offset(text, 0, 5));
+    EXPECT_EQ(3U, LanguageServer::offset(text, 1, 0));
+    EXPECT_EQ(5U, LanguageServer::offset(text, 1, 2));
+    EXPECT_EQ(7U, LanguageServer::offset(text, 1, 3));
+    EXPECT_EQ(13U, LanguageServer::offset(text, 2, 2));
+    EXPECT_EQ(text.size(), LanguageServer::offset(text, 5, 0));
+
+    // the tokenizer aligns the tabs to 4 and counts the bytes
+    EXPECT_EQ(0U, LanguageServer::character(text, 1, 1));
+    EXPECT_EQ(1U, LanguageServer::character(text, 1, 5));
+    EXPECT_EQ(2U, LanguageServer::character(text, 1, 6));
+    EXPECT_EQ(3U, LanguageServer::character(text, 1, 8));
+    EXPECT_EQ(2U, LanguageServer::character(text, 2, 5));
+}
+
+TEST_F(LanguageServerTests, path)
+{
+    EXPECT_EQ("/project/a b.compil", LanguageServer::path("file:///project/a%20b.compil"));
+    EXPECT_EQ("c:/project/a.compil", LanguageServer::path("file:///c%3A/project/a.compil"));
+}
+
+TEST_F(LanguageServerTests, initialize)
+{
+    std::vector<std::string> messages =
+        handle("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"initialize\",\"params\":{\"capabilities\":{}}}");
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("\"id\":1,"));
+    EXPECT_NE(std::string::npos, messages[0].find("\"change\":2"));
+
+    EXPECT_TRUE(handle("{\"jsonrpc\":\"2.0\",\"method\":\"initialized\",\"params\":{}}").empty());
+
+    messages = handle("{\"jsonrpc\":\"2.0\",\"id\":\"x\",\"method\":\"textDocument/hover\",\"params\":{}}");
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("\"id\":\"x\""));
+    EXPECT_NE(std::string::npos, messages[0].find("-32601"));
+
+    messages = handle("{\"jsonrpc\":\"2.0\",\"params\":{\"id\":7},\"id\" : \"42\",\"method\":\"shutdown\"}");
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("\"id\":\"42\","));
+
+    messages = handle("{\"jsonrpc\":\"2.0\",\"id\":-3,\"method\":\"textDocument/hover\"}");
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("\"id\":-3,"));
+
+    messages = handle("{\"jsonrpc\":");
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("-32700"));
+}
+
+TEST_F(LanguageServerTests, diagnostics)
+{
+    std::vector<std::string> messages = handle(gOpen);
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("\"method\":\"textDocument/publishDiagnostics\""));
+    EXPECT_NE(std::string::npos, messages[0].find("\"uri\":\"file:///project/a%20b.compil\""));
+    EXPECT_NE(std::string::npos, messages[0].find(
+        "\"range\":{\"start\":{\"line\":5,\"character\":1},\"end\":{\"line\":5,\"character\":1}},"
+        "\"severity\":1,\"source\":\"compil\",\"message\":\"Unknown field type T\""));
+
+    // T -> integer
+    messages = handle(change(5, 1, 5, 2, "integer"));
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("\"diagnostics\":[]"));
+
+    // = 1 -> = x
+    messages = handle(change(4, 13, 4, 14, "x"));
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("\"line\":4"));
+    EXPECT_NE(std::string::npos, messages[0].find("\"severity\":1"));
+
+    messages = handle("{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/didClose\",\"params\":{"
+                      "\"textDocument\":{\"uri\":\"file:///project/a%20b.compil\"}}}");
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("\"diagnostics\":[]"));
+}
+
+TEST_F(LanguageServerTests, run)
+{
+    std::ostringstream input;
+    LanguageServer::writeMessage(input, "{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"initialize\",\"params\":{}}");
+    LanguageServer::writeMessage(input, gOpen);
+    LanguageServer::writeMessage(input, "{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"shutdown\"}");
+    LanguageServer::writeMessage(input, "{\"jsonrpc\":\"2.0\",\"method\":\"exit\"}");
+
+    std::istringstream stream(input.str());
+    std::ostringstream output;
+    EXPECT_EQ(0, mpServer->run(stream, output));
+    EXPECT_NE(std::string::npos, output.str().find("{\"jsonrpc\":\"2.0\",\"id\":2,\"result\":null}"));
+}
+
+class LanguageServerFileTests : public LanguageServerTests
+{
+public:
+    virtual void SetUp()
+    {
+        mDirectory = boost::filesystem::temp_directory_path()
+                   / boost::filesystem::unique_path("compil-%%%%-%%%%-%%%%");
+        boost::filesystem::create_directories(mDirectory);
+        FileSourceProviderPtr pSourceProvider(new FileSourceProvider());
+        pSourceProvider->setWorkingDirectory(mDirectory);
+        mpServer.reset(new LanguageServer(pSourceProvider));
+    }
+
+    virtual void TearDown()
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(mDirectory, ec);
+    }
+
+protected:
+    void file(const std::string& name, const std::string& text)
+    {
+        std::ofstream stream((mDirectory / name).string().c_str());
+        stream << text;
+    }
+
+    std::string uri(const std::string& name)
+    {
+        return "file://" + (mDirectory / name).generic_string();
+    }
+
+    boost::filesystem::path mDirectory;
+};
+
+// the text of a.compil that imports b.compil, escaped for JSON
+static const char* gImportText = "compil { }\\n\\nimport \\\"b.compil\\\";\\n";
+
+TEST_F(LanguageServerFileTests, importCreatedAfterTheFirstParse)
+{
+    file("a.compil", "compil { }\n\nimport \"b.compil\";\n");
+    const std::string open =
+        "{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/didOpen\",\"params\":{\"textDocument\":{"
+        "\"uri\":\"" + uri("a.compil") + "\",\"languageId\":\"compil\",\"version\":1,"
+        "\"text\":\"" + gImportText + "\"}}}";
+    const std::string change =
+        "{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/didChange\",\"params\":{"
+        "\"textDocument\":{\"uri\":\"" + uri("a.compil") + "\",\"version\":2},"
+        "\"contentChanges\":[{\"text\":\"" + gImportText + "\"}]}}";
+
+    std::vector<std::string> messages = handle(open);
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("source not found"));
+
+    // the missing import is not remembered by a new open
+    file("b.compil", "compil { }\n");
+    messages = handle(open);
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("\"diagnostics\":[]"));
+
+    // nor by a change of the whole text
+    boost::filesystem::remove(mDirectory / "b.compil");
+    messages = handle(change);
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("source not found"));
+
+    file("b.compil", "compil { }\n");
+    messages = handle(change);
+    ASSERT_EQ(1U, messages.size());
+    EXPECT_NE(std::string::npos, messages[0].find("\"diagnostics\":[]"));
+}
+
+}
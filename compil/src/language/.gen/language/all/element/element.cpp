@@ -0,0 +1,20 @@
+#include "language/all/element/element.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+Element::Element()
+{
+}
+
+Element::~Element()
+{
+}
+
+}
+
+}
+
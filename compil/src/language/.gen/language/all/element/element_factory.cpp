@@ -0,0 +1,375 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/all/element/element_factory.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+EElementId::EElementId()
+        : mValue(kInvalid)
+{
+}
+
+EElementId::EElementId(long value)
+        : mValue(value)
+{
+}
+
+const EElementId EElementId::invalid()
+{
+    return EElementId(kInvalid);
+}
+
+const EElementId EElementId::element()
+{
+    return EElementId(kElement);
+}
+
+const EElementId EElementId::endOfLine()
+{
+    return EElementId(kEndOfLine);
+}
+
+const EElementId EElementId::level()
+{
+    return EElementId(kLevel);
+}
+
+const EElementId EElementId::line()
+{
+    return EElementId(kLine);
+}
+
+const EElementId EElementId::lineDelimiter()
+{
+    return EElementId(kLineDelimiter);
+}
+
+const EElementId EElementId::list()
+{
+    return EElementId(kList);
+}
+
+const EElementId EElementId::mold()
+{
+    return EElementId(kMold);
+}
+
+const EElementId EElementId::passage()
+{
+    return EElementId(kPassage);
+}
+
+const EElementId EElementId::scope()
+{
+    return EElementId(kScope);
+}
+
+const EElementId EElementId::string()
+{
+    return EElementId(kString);
+}
+
+long EElementId::value() const
+{
+    return mValue;
+}
+
+const char* EElementId::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "Element",
+        "EndOfLine",
+        "Level",
+        "Line",
+        "LineDelimiter",
+        "List",
+        "Mold",
+        "Passage",
+        "Scope",
+        "String",
+    };
+    return names[(size_t)value];
+}
+
+const char* EElementId::shortName() const
+{
+    return shortName(value());
+}
+
+bool EElementId::operator==(const EElementId& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EElementId::operator!=(const EElementId& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EElementId Element::staticElementId()
+{
+    return EElementId::element();
+}
+
+EElementId Element::runtimeElementId() const
+{
+    return staticElementId();
+}
+
+EElementId EndOfLine::staticElementId()
+{
+    return EElementId::endOfLine();
+}
+
+EElementId EndOfLine::runtimeElementId() const
+{
+    return staticElementId();
+}
+
+EElementId Level::staticElementId()
+{
+    return EElementId::level();
+}
+
+EElementId Level::runtimeElementId() const
+{
+    return staticElementId();
+}
+
+EElementId Line::staticElementId()
+{
+    return EElementId::line();
+}
+
+EElementId Line::runtimeElementId() const
+{
+    return staticElementId();
+}
+
+EElementId LineDelimiter::staticElementId()
+{
+    return EElementId::lineDelimiter();
+}
+
+EElementId LineDelimiter::runtimeElementId() const
+{
+    return staticElementId();
+}
+
+EElementId List::staticElementId()
+{
+    return EElementId::list();
+}
+
+EElementId List::runtimeElementId() const
+{
+    return staticElementId();
+}
+
+EElementId Mold::staticElementId()
+{
+    return EElementId::mold();
+}
+
+EElementId Mold::runtimeElementId() const
+{
+    return staticElementId();
+}
+
+EElementId Passage::staticElementId()
+{
+    return EElementId::passage();
+}
+
+EElementId Passage::runtimeElementId() const
+{
+    return staticElementId();
+}
+
+EElementId Scope::staticElementId()
+{
+    return EElementId::scope();
+}
+
+EElementId Scope::runtimeElementId() const
+{
+    return staticElementId();
+}
+
+EElementId String::staticElementId()
+{
+    return EElementId::string();
+}
+
+EElementId String::runtimeElementId() const
+{
+    return staticElementId();
+}
+
+ElementSPtr ElementFactory::clone(const ElementSPtr& pObject)
+{
+    switch (pObject->runtimeElementId().value())
+    {
+        case EElementId::kElement:
+        {
+            ElementSPtr pClone(new Element());
+            *pClone = *pObject;
+            return pClone;
+        }
+        case EElementId::kEndOfLine:
+        {
+            EndOfLineSPtr pClone(new EndOfLine());
+            *pClone = *downcastEndOfLine(pObject);
+            return pClone;
+        }
+        case EElementId::kLevel:
+        {
+            LevelSPtr pClone(new Level());
+            *pClone = *downcastLevel(pObject);
+            return pClone;
+        }
+        case EElementId::kLine:
+        {
+            LineSPtr pClone(new Line());
+            *pClone = *downcastLine(pObject);
+            return pClone;
+        }
+        case EElementId::kLineDelimiter:
+        {
+            LineDelimiterSPtr pClone(new LineDelimiter());
+            *pClone = *downcastLineDelimiter(pObject);
+            return pClone;
+        }
+        case EElementId::kList:
+        {
+            ListSPtr pClone(new List());
+            *pClone = *downcastList(pObject);
+            return pClone;
+        }
+        case EElementId::kMold:
+        {
+            MoldSPtr pClone(new Mold());
+            *pClone = *downcastMold(pObject);
+            return pClone;
+        }
+        case EElementId::kPassage:
+        {
+            PassageSPtr pClone(new Passage());
+            *pClone = *downcastPassage(pObject);
+            return pClone;
+        }
+        case EElementId::kScope:
+        {
+            ScopeSPtr pClone(new Scope());
+            *pClone = *downcastScope(pObject);
+            return pClone;
+        }
+        case EElementId::kString:
+        {
+            StringSPtr pClone(new String());
+            *pClone = *downcastString(pObject);
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return ElementSPtr();
+}
+
+EndOfLineSPtr ElementFactory::downcastEndOfLine(const ElementSPtr& pObject)
+{
+    bool b = (pObject->runtimeElementId() == EndOfLine::staticElementId());
+
+    if (b)
+        return boost::static_pointer_cast<EndOfLine>(pObject);
+    return EndOfLineSPtr();
+}
+
+LevelSPtr ElementFactory::downcastLevel(const ElementSPtr& pObject)
+{
+    bool b = (pObject->runtimeElementId() == Level::staticElementId());
+
+    if (b)
+        return boost::static_pointer_cast<Level>(pObject);
+    return LevelSPtr();
+}
+
+LineSPtr ElementFactory::downcastLine(const ElementSPtr& pObject)
+{
+    bool b = (pObject->runtimeElementId() == Line::staticElementId());
+
+    if (b)
+        return boost::static_pointer_cast<Line>(pObject);
+    return LineSPtr();
+}
+
+LineDelimiterSPtr ElementFactory::downcastLineDelimiter(const ElementSPtr& pObject)
+{
+    bool b = (pObject->runtimeElementId() == LineDelimiter::staticElementId());
+
+    if (b)
+        return boost::static_pointer_cast<LineDelimiter>(pObject);
+    return LineDelimiterSPtr();
+}
+
+ListSPtr ElementFactory::downcastList(const ElementSPtr& pObject)
+{
+    bool b = (pObject->runtimeElementId() == List::staticElementId());
+
+    if (b)
+        return boost::static_pointer_cast<List>(pObject);
+    return ListSPtr();
+}
+
+MoldSPtr ElementFactory::downcastMold(const ElementSPtr& pObject)
+{
+    bool b = (pObject->runtimeElementId() == Mold::staticElementId())
+          // or any of the derived classes
+          || (pObject->runtimeElementId() == Level::staticElementId())
+          || (pObject->runtimeElementId() == Line::staticElementId())
+          || (pObject->runtimeElementId() == List::staticElementId())
+          || (pObject->runtimeElementId() == Scope::staticElementId());
+
+    if (b)
+        return boost::static_pointer_cast<Mold>(pObject);
+    return MoldSPtr();
+}
+
+PassageSPtr ElementFactory::downcastPassage(const ElementSPtr& pObject)
+{
+    bool b = (pObject->runtimeElementId() == Passage::staticElementId());
+
+    if (b)
+        return boost::static_pointer_cast<Passage>(pObject);
+    return PassageSPtr();
+}
+
+ScopeSPtr ElementFactory::downcastScope(const ElementSPtr& pObject)
+{
+    bool b = (pObject->runtimeElementId() == Scope::staticElementId());
+
+    if (b)
+        return boost::static_pointer_cast<Scope>(pObject);
+    return ScopeSPtr();
+}
+
+StringSPtr ElementFactory::downcastString(const ElementSPtr& pObject)
+{
+    bool b = (pObject->runtimeElementId() == String::staticElementId());
+
+    if (b)
+        return boost::static_pointer_cast<String>(pObject);
+    return StringSPtr();
+}
+
+}
+
+}
+
@@ -0,0 +1,173 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __ALL_ELEMENT_ELEMENT_FACTORY_SCOMPIL_H_
+#define __ALL_ELEMENT_ELEMENT_FACTORY_SCOMPIL_H_
+
+#include "language/all/element/element.h"
+#include "language/all/element/element_factory.h"
+#include "language/all/element/end_of_line.h"
+#include "language/all/element/line_delimiter.h"
+#include "language/all/element/list.h"
+#include "language/all/element/passage.h"
+#include "language/all/element/string.h"
+#include "language/all/mold/level.h"
+#include "language/all/mold/line.h"
+#include "language/all/mold/mold.h"
+#include "language/all/mold/scope.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EElementId
+{
+public:
+    // Default constructor - sets the value to invalid
+                         EElementId();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit             EElementId(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long        value     ()                         const;
+    // Returns short name for a specified enum value
+    static   const char* shortName (long value);
+    // Returns short name of the enum value
+             const char* shortName ()                         const;
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool        operator==(const EElementId& rValue) const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool        operator!=(const EElementId& rValue) const;
+
+    // static methods for enum class objects
+    static const EElementId invalid      ();
+    static const EElementId element      ();
+    static const EElementId endOfLine    ();
+    static const EElementId level        ();
+    static const EElementId line         ();
+    static const EElementId lineDelimiter();
+    static const EElementId list         ();
+    static const EElementId mold         ();
+    static const EElementId passage      ();
+    static const EElementId scope        ();
+    static const EElementId string       ();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid       = 0,
+        kElement       = 1,
+        kEndOfLine     = 2,
+        kLevel         = 3,
+        kLine          = 4,
+        kLineDelimiter = 5,
+        kList          = 6,
+        kMold          = 7,
+        kPassage       = 8,
+        kScope         = 9,
+        kString        = 10,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class ElementFactory
+{
+public:
+    static ElementSPtr       clone                (const ElementSPtr& object);
+    static EndOfLineSPtr     downcastEndOfLine    (const ElementSPtr& object);
+    static LevelSPtr         downcastLevel        (const ElementSPtr& object);
+    static LineSPtr          downcastLine         (const ElementSPtr& object);
+    static LineDelimiterSPtr downcastLineDelimiter(const ElementSPtr& object);
+    static ListSPtr          downcastList         (const ElementSPtr& object);
+    static MoldSPtr          downcastMold         (const ElementSPtr& object);
+    static PassageSPtr       downcastPassage      (const ElementSPtr& object);
+    static ScopeSPtr         downcastScope        (const ElementSPtr& object);
+    static StringSPtr        downcastString       (const ElementSPtr& object);
+};
+
+}
+
+}
+
+#else // __ALL_ELEMENT_ELEMENT_FACTORY_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace all
+{
+
+// Forward declarations
+class ElementFactory;
+typedef ElementFactory*                         ElementFactoryRPtr;
+typedef boost::shared_ptr<ElementFactory>       ElementFactorySPtr;
+typedef boost::shared_ptr<const ElementFactory> ElementFactorySCPtr;
+typedef boost::weak_ptr<ElementFactory>         ElementFactoryWPtr;
+
+class EElementId;
+typedef EElementId*                         EElementIdRPtr;
+typedef boost::shared_ptr<EElementId>       EElementIdSPtr;
+typedef boost::shared_ptr<const EElementId> EElementIdSCPtr;
+typedef boost::weak_ptr<EElementId>         EElementIdWPtr;
+
+class ElementFactory;
+
+}
+
+}
+
+#endif // __ALL_ELEMENT_ELEMENT_FACTORY_SCOMPIL_H_
+
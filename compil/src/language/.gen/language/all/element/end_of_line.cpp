@@ -0,0 +1,25 @@
+#include "language/all/element/end_of_line.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+EndOfLine::EndOfLine()
+{
+}
+
+EndOfLine::~EndOfLine()
+{
+}
+
+EndOfLineSPtr EndOfLine::downcast(const ElementSPtr& object)
+{
+    return boost::static_pointer_cast<EndOfLine>(object);
+}
+
+}
+
+}
+
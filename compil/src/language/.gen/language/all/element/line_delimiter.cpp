@@ -0,0 +1,25 @@
+#include "language/all/element/line_delimiter.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+LineDelimiter::LineDelimiter()
+{
+}
+
+LineDelimiter::~LineDelimiter()
+{
+}
+
+LineDelimiterSPtr LineDelimiter::downcast(const ElementSPtr& object)
+{
+    return boost::static_pointer_cast<LineDelimiter>(object);
+}
+
+}
+
+}
+
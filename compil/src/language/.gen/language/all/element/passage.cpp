@@ -0,0 +1,69 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/all/element/passage.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+Passage::Passage()
+{
+}
+
+Passage::~Passage()
+{
+}
+
+PassageSPtr Passage::downcast(const ElementSPtr& object)
+{
+    return boost::static_pointer_cast<Passage>(object);
+}
+
+const std::vector<ElementSPtr>& Passage::elements() const
+{
+    return mElements;
+}
+
+Passage& Passage::set_elements(const std::vector<ElementSPtr>& elements)
+{
+    mElements = elements;
+    return *this;
+}
+
+std::vector<ElementSPtr>& Passage::mutable_elements()
+{
+    return mElements;
+}
+
+Passage& Passage::operator<<(const std::vector<ElementSPtr>& elements)
+{
+    return set_elements(elements);
+}
+
+const PassageSPtr& operator<<(const PassageSPtr& object, const std::vector<ElementSPtr>& elements)
+{
+    BOOST_ASSERT(object);
+    *object << elements;
+    return object;
+}
+
+Passage& Passage::operator<<(const ElementSPtr& elementsItem)
+{
+    mElements.push_back(elementsItem);
+    return *this;
+}
+
+const PassageSPtr& operator<<(const PassageSPtr& object, const ElementSPtr& elementsItem)
+{
+    BOOST_ASSERT(object);
+    *object << elementsItem;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,56 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/all/element/string.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+String::String()
+{
+}
+
+String::~String()
+{
+}
+
+StringSPtr String::downcast(const ElementSPtr& object)
+{
+    return boost::static_pointer_cast<String>(object);
+}
+
+const std::string& String::value() const
+{
+    return mValue;
+}
+
+String& String::set_value(const std::string& value)
+{
+    mValue = value;
+    return *this;
+}
+
+std::string& String::mutable_value()
+{
+    return mValue;
+}
+
+String& String::operator<<(const std::string& value)
+{
+    return set_value(value);
+}
+
+const StringSPtr& operator<<(const StringSPtr& object, const std::string& value)
+{
+    BOOST_ASSERT(object);
+    *object << value;
+    return object;
+}
+
+}
+
+}
+
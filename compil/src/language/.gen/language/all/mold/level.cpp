@@ -0,0 +1,51 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/all/mold/level.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+Level::Level()
+{
+}
+
+Level::~Level()
+{
+}
+
+LevelSPtr Level::downcast(const ElementSPtr& object)
+{
+    return boost::static_pointer_cast<Level>(object);
+}
+
+long Level::value() const
+{
+    return mValue;
+}
+
+Level& Level::set_value(long value)
+{
+    mValue = value;
+    return *this;
+}
+
+Level& Level::operator<<(long value)
+{
+    return set_value(value);
+}
+
+const LevelSPtr& operator<<(const LevelSPtr& object, long value)
+{
+    BOOST_ASSERT(object);
+    *object << value;
+    return object;
+}
+
+}
+
+}
+
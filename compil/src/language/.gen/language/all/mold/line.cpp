@@ -0,0 +1,69 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/all/mold/line.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+Line::Line()
+{
+}
+
+Line::~Line()
+{
+}
+
+LineSPtr Line::downcast(const ElementSPtr& object)
+{
+    return boost::static_pointer_cast<Line>(object);
+}
+
+const std::vector<ElementSPtr>& Line::elements() const
+{
+    return mElements;
+}
+
+Line& Line::set_elements(const std::vector<ElementSPtr>& elements)
+{
+    mElements = elements;
+    return *this;
+}
+
+std::vector<ElementSPtr>& Line::mutable_elements()
+{
+    return mElements;
+}
+
+Line& Line::operator<<(const std::vector<ElementSPtr>& elements)
+{
+    return set_elements(elements);
+}
+
+const LineSPtr& operator<<(const LineSPtr& object, const std::vector<ElementSPtr>& elements)
+{
+    BOOST_ASSERT(object);
+    *object << elements;
+    return object;
+}
+
+Line& Line::operator<<(const ElementSPtr& elementsItem)
+{
+    mElements.push_back(elementsItem);
+    return *this;
+}
+
+const LineSPtr& operator<<(const LineSPtr& object, const ElementSPtr& elementsItem)
+{
+    BOOST_ASSERT(object);
+    *object << elementsItem;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,131 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <vector>
+
+#ifndef __ALL_MOLD_LINE_SCOMPIL_H_
+#define __ALL_MOLD_LINE_SCOMPIL_H_
+
+#include "language/all/element/element.h"
+#include "language/all/mold/line.h"
+#include "language/all/mold/mold.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+class Line : public Mold
+{
+public:
+    // Default constructor
+                                            Line            ();
+    // Destructor
+    virtual                                 ~Line           ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  LineSPtr                        downcast        (const ElementSPtr& object);
+
+    // Identifier for the objects from Line class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EElementId                      staticElementId ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EElementId                      runtimeElementId()                                         const;
+
+    // Getter method for the data field elements
+            const std::vector<ElementSPtr>& elements        ()                                         const;
+    // Setter method for the data field elements
+            Line&                           set_elements    (const std::vector<ElementSPtr>& elements);
+    // Provides mutable access to field elements
+            std::vector<ElementSPtr>&       mutable_elements();
+    // Store operator for the data field elements
+            Line&                           operator<<      (const std::vector<ElementSPtr>& elements);
+    // Store operator for an item of data field elements
+            Line&                           operator<<      (const ElementSPtr& elementsItem);
+
+private:
+    // variable for the data field elements
+    std::vector<ElementSPtr> mElements;
+};
+
+// Reference store operator for the data field elements
+const LineSPtr& operator<<(const LineSPtr& , const std::vector<ElementSPtr>& );
+// Reference store operator for an item of data field elements
+const LineSPtr& operator<<(const LineSPtr& , const ElementSPtr& );
+
+inline LineSPtr lineRef()
+{
+    return boost::make_shared<Line>();
+}
+
+}
+
+}
+
+#else // __ALL_MOLD_LINE_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace all
+{
+
+// Forward declarations
+class Line;
+typedef Line*                         LineRPtr;
+typedef boost::shared_ptr<Line>       LineSPtr;
+typedef boost::shared_ptr<const Line> LineSCPtr;
+typedef boost::weak_ptr<Line>         LineWPtr;
+
+class EElementId;
+
+}
+
+}
+
+#endif // __ALL_MOLD_LINE_SCOMPIL_H_
+
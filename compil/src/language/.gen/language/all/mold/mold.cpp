@@ -0,0 +1,25 @@
+#include "language/all/mold/mold.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+Mold::Mold()
+{
+}
+
+Mold::~Mold()
+{
+}
+
+MoldSPtr Mold::downcast(const ElementSPtr& object)
+{
+    return boost::static_pointer_cast<Mold>(object);
+}
+
+}
+
+}
+
@@ -0,0 +1,181 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/all/mold/scope.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+Scope::Scope()
+{
+}
+
+Scope::~Scope()
+{
+}
+
+ScopeSPtr Scope::downcast(const ElementSPtr& object)
+{
+    return boost::static_pointer_cast<Scope>(object);
+}
+
+Scope::ESquiggles::ESquiggles()
+        : mValue(kInvalid)
+{
+}
+
+Scope::ESquiggles::ESquiggles(long value)
+        : mValue(value)
+{
+}
+
+const Scope::ESquiggles Scope::ESquiggles::invalid()
+{
+    return ESquiggles(kInvalid);
+}
+
+const Scope::ESquiggles Scope::ESquiggles::none()
+{
+    return ESquiggles(kNone);
+}
+
+const Scope::ESquiggles Scope::ESquiggles::brackets()
+{
+    return ESquiggles(kBrackets);
+}
+
+long Scope::ESquiggles::value() const
+{
+    return mValue;
+}
+
+const char* Scope::ESquiggles::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "none",
+        "brackets",
+    };
+    return names[(size_t)value];
+}
+
+const char* Scope::ESquiggles::shortName() const
+{
+    return shortName(value());
+}
+
+bool Scope::ESquiggles::operator==(const ESquiggles& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool Scope::ESquiggles::operator!=(const ESquiggles& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+const Scope::ESquiggles& Scope::squiggles() const
+{
+    return mSquiggles;
+}
+
+Scope& Scope::set_squiggles(const ESquiggles& squiggles)
+{
+    mSquiggles = squiggles;
+    return *this;
+}
+
+Scope::ESquiggles& Scope::mutable_squiggles()
+{
+    return mSquiggles;
+}
+
+Scope& Scope::operator<<(const ESquiggles& squiggles)
+{
+    return set_squiggles(squiggles);
+}
+
+const ScopeSPtr& operator<<(const ScopeSPtr& object, const Scope::ESquiggles& squiggles)
+{
+    BOOST_ASSERT(object);
+    *object << squiggles;
+    return object;
+}
+
+const std::vector<ElementSPtr>& Scope::elements() const
+{
+    return mElements;
+}
+
+Scope& Scope::set_elements(const std::vector<ElementSPtr>& elements)
+{
+    mElements = elements;
+    return *this;
+}
+
+std::vector<ElementSPtr>& Scope::mutable_elements()
+{
+    return mElements;
+}
+
+Scope& Scope::operator<<(const std::vector<ElementSPtr>& elements)
+{
+    return set_elements(elements);
+}
+
+const ScopeSPtr& operator<<(const ScopeSPtr& object, const std::vector<ElementSPtr>& elements)
+{
+    BOOST_ASSERT(object);
+    *object << elements;
+    return object;
+}
+
+Scope& Scope::operator<<(const ElementSPtr& elementsItem)
+{
+    mElements.push_back(elementsItem);
+    return *this;
+}
+
+const ScopeSPtr& operator<<(const ScopeSPtr& object, const ElementSPtr& elementsItem)
+{
+    BOOST_ASSERT(object);
+    *object << elementsItem;
+    return object;
+}
+
+const std::string& Scope::close() const
+{
+    return mClose;
+}
+
+Scope& Scope::set_close(const std::string& close)
+{
+    mClose = close;
+    return *this;
+}
+
+std::string& Scope::mutable_close()
+{
+    return mClose;
+}
+
+Scope& Scope::operator<<(const std::string& close)
+{
+    return set_close(close);
+}
+
+const ScopeSPtr& operator<<(const ScopeSPtr& object, const std::string& close)
+{
+    BOOST_ASSERT(object);
+    *object << close;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,211 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+#include <vector>
+
+#ifndef __ALL_MOLD_SCOPE_SCOMPIL_H_
+#define __ALL_MOLD_SCOPE_SCOMPIL_H_
+
+#include "language/all/element/element.h"
+#include "language/all/mold/mold.h"
+#include "language/all/mold/scope.h"
+
+namespace lang
+{
+
+namespace all
+{
+
+class Scope : public Mold
+{
+public:
+    // Default constructor
+                       Scope           ();
+    // Destructor
+    virtual            ~Scope          ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  ScopeSPtr  downcast        (const ElementSPtr& object);
+
+    // Identifier for the objects from Scope class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EElementId staticElementId ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EElementId runtimeElementId()                          const;
+
+    // This enumeration class provides namespaced set of constant values.
+    // It is designed to provide type control over operations with enum
+    // values without need to wait all compilers you are going to use for
+    // this project to support C++0x standard. The type control do not
+    // prevent the variables to be used in switch statements.
+    class ESquiggles
+    {
+    public:
+        // Default constructor - sets the value to invalid
+                             ESquiggles();
+        // Constructor from an integer value.
+        // Note: Avoid using this constructor if possible. It is
+        // appropriate only in case of importing value from components that
+        // you do not have control over (such as 3rd party libraries or
+        // serialization functionality).
+        explicit             ESquiggles(long value);
+
+        // Returns the integer value of the enum.
+        // Note: Avoid using this method if possible. It is appropriate
+        // only in case of exporting value to components that you do not
+        // have control over (such as 3rd party libraries or serialization
+        // functionality).
+                 long        value     ()                         const;
+        // Returns short name for a specified enum value
+        static   const char* shortName (long value);
+        // Returns short name of the enum value
+                 const char* shortName ()                         const;
+        // returns true if the value of the enum is equal to the value of
+        // the argument
+                 bool        operator==(const ESquiggles& rValue) const;
+        // returns true if the value of the enum is not equal to the value
+        // of the argument
+                 bool        operator!=(const ESquiggles& rValue) const;
+
+        // static methods for enum class objects
+        static const ESquiggles invalid ();
+        static const ESquiggles none    ();
+        static const ESquiggles brackets();
+
+        // This enum provides static constants that could be used in a
+        // switch statements
+        enum
+        {
+            kInvalid  = 0,
+            kNone     = 1,
+            kBrackets = 2,
+        };
+
+    private:
+        // Member variable that holds the enum value
+        long mValue;
+    };
+
+    // Getter method for the data field squiggles
+    const ESquiggles&               squiggles        ()                                         const;
+    // Setter method for the data field squiggles
+    Scope&                          set_squiggles    (const ESquiggles& squiggles);
+    // Provides mutable access to field squiggles
+    ESquiggles&                     mutable_squiggles();
+    // Store operator for the data field squiggles
+    Scope&                          operator<<       (const ESquiggles& squiggles);
+
+    // Getter method for the data field elements
+    const std::vector<ElementSPtr>& elements         ()                                         const;
+    // Setter method for the data field elements
+    Scope&                          set_elements     (const std::vector<ElementSPtr>& elements);
+    // Provides mutable access to field elements
+    std::vector<ElementSPtr>&       mutable_elements ();
+    // Store operator for the data field elements
+    Scope&                          operator<<       (const std::vector<ElementSPtr>& elements);
+    // Store operator for an item of data field elements
+    Scope&                          operator<<       (const ElementSPtr& elementsItem);
+
+    // Getter method for the data field close
+    const std::string&              close            ()                                         const;
+    // Setter method for the data field close
+    Scope&                          set_close        (const std::string& close);
+    // Provides mutable access to field close
+    std::string&                    mutable_close    ();
+    // Store operator for the data field close
+    Scope&                          operator<<       (const std::string& close);
+
+private:
+    // variable for the data field squiggles
+    ESquiggles               mSquiggles;
+    // variable for the data field elements
+    std::vector<ElementSPtr> mElements;
+    // variable for the data field close
+    std::string              mClose;
+};
+
+// Reference store operator for the data field squiggles
+const ScopeSPtr& operator<<(const ScopeSPtr& , const Scope::ESquiggles& );
+// Reference store operator for the data field elements
+const ScopeSPtr& operator<<(const ScopeSPtr& , const std::vector<ElementSPtr>& );
+// Reference store operator for an item of data field elements
+const ScopeSPtr& operator<<(const ScopeSPtr& , const ElementSPtr& );
+// Reference store operator for the data field close
+const ScopeSPtr& operator<<(const ScopeSPtr& , const std::string& );
+
+inline ScopeSPtr scopeRef()
+{
+    return boost::make_shared<Scope>();
+}
+
+}
+
+}
+
+#else // __ALL_MOLD_SCOPE_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace all
+{
+
+// Forward declarations
+class Scope;
+typedef Scope*                         ScopeRPtr;
+typedef boost::shared_ptr<Scope>       ScopeSPtr;
+typedef boost::shared_ptr<const Scope> ScopeSCPtr;
+typedef boost::weak_ptr<Scope>         ScopeWPtr;
+
+class EElementId;
+
+}
+
+}
+
+#endif // __ALL_MOLD_SCOPE_SCOMPIL_H_
+
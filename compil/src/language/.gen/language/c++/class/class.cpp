@@ -0,0 +1,272 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/class.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+Class::Class()
+        : mClassKey(default_classKey())
+{
+}
+
+Class::~Class()
+{
+}
+
+const NamespaceSPtr& Class::namespace_() const
+{
+    return mNamespace;
+}
+
+Class& Class::set_namespace(const NamespaceSPtr& namespace_)
+{
+    mNamespace = namespace_;
+    return *this;
+}
+
+Class& Class::operator<<(const NamespaceSPtr& namespace_)
+{
+    return set_namespace(namespace_);
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const NamespaceSPtr& namespace_)
+{
+    BOOST_ASSERT(object);
+    *object << namespace_;
+    return object;
+}
+
+const ClassSPtr& Class::containerClass() const
+{
+    return mContainerClass;
+}
+
+Class& Class::set_containerClass(const ClassSPtr& containerClass)
+{
+    mContainerClass = containerClass;
+    return *this;
+}
+
+Class& Class::operator<<(const ClassSPtr& containerClass)
+{
+    return set_containerClass(containerClass);
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const ClassSPtr& containerClass)
+{
+    BOOST_ASSERT(object);
+    *object << containerClass;
+    return object;
+}
+
+const EClassKey& Class::classKey() const
+{
+    return mClassKey;
+}
+
+EClassKey Class::default_classKey()
+{
+    return EClassKey::struct_();
+}
+
+Class& Class::set_classKey(const EClassKey& classKey)
+{
+    mClassKey = classKey;
+    return *this;
+}
+
+EClassKey& Class::mutable_classKey()
+{
+    return mClassKey;
+}
+
+Class& Class::operator<<(const EClassKey& classKey)
+{
+    return set_classKey(classKey);
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const EClassKey& classKey)
+{
+    BOOST_ASSERT(object);
+    *object << classKey;
+    return object;
+}
+
+const ClassNameSPtr& Class::name() const
+{
+    return mName;
+}
+
+Class& Class::set_name(const ClassNameSPtr& name)
+{
+    mName = name;
+    return *this;
+}
+
+Class& Class::operator<<(const ClassNameSPtr& name)
+{
+    return set_name(name);
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const ClassNameSPtr& name)
+{
+    BOOST_ASSERT(object);
+    *object << name;
+    return object;
+}
+
+const std::vector<ConstructorSPtr>& Class::constructors() const
+{
+    return mConstructors;
+}
+
+Class& Class::set_constructors(const std::vector<ConstructorSPtr>& constructors)
+{
+    mConstructors = constructors;
+    return *this;
+}
+
+std::vector<ConstructorSPtr>& Class::mutable_constructors()
+{
+    return mConstructors;
+}
+
+Class& Class::operator<<(const std::vector<ConstructorSPtr>& constructors)
+{
+    return set_constructors(constructors);
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const std::vector<ConstructorSPtr>& constructors)
+{
+    BOOST_ASSERT(object);
+    *object << constructors;
+    return object;
+}
+
+Class& Class::operator<<(const ConstructorSPtr& constructorsItem)
+{
+    mConstructors.push_back(constructorsItem);
+    return *this;
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const ConstructorSPtr& constructorsItem)
+{
+    BOOST_ASSERT(object);
+    *object << constructorsItem;
+    return object;
+}
+
+const DestructorSPtr& Class::destructor() const
+{
+    return mDestructor;
+}
+
+Class& Class::set_destructor(const DestructorSPtr& destructor)
+{
+    mDestructor = destructor;
+    return *this;
+}
+
+Class& Class::operator<<(const DestructorSPtr& destructor)
+{
+    return set_destructor(destructor);
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const DestructorSPtr& destructor)
+{
+    BOOST_ASSERT(object);
+    *object << destructor;
+    return object;
+}
+
+const std::vector<MethodSPtr>& Class::methods() const
+{
+    return mMethods;
+}
+
+Class& Class::set_methods(const std::vector<MethodSPtr>& methods)
+{
+    mMethods = methods;
+    return *this;
+}
+
+std::vector<MethodSPtr>& Class::mutable_methods()
+{
+    return mMethods;
+}
+
+Class& Class::operator<<(const std::vector<MethodSPtr>& methods)
+{
+    return set_methods(methods);
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const std::vector<MethodSPtr>& methods)
+{
+    BOOST_ASSERT(object);
+    *object << methods;
+    return object;
+}
+
+Class& Class::operator<<(const MethodSPtr& methodsItem)
+{
+    mMethods.push_back(methodsItem);
+    return *this;
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const MethodSPtr& methodsItem)
+{
+    BOOST_ASSERT(object);
+    *object << methodsItem;
+    return object;
+}
+
+const std::vector<MemberVariableSPtr>& Class::members() const
+{
+    return mMembers;
+}
+
+Class& Class::set_members(const std::vector<MemberVariableSPtr>& members)
+{
+    mMembers = members;
+    return *this;
+}
+
+std::vector<MemberVariableSPtr>& Class::mutable_members()
+{
+    return mMembers;
+}
+
+Class& Class::operator<<(const std::vector<MemberVariableSPtr>& members)
+{
+    return set_members(members);
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const std::vector<MemberVariableSPtr>& members)
+{
+    BOOST_ASSERT(object);
+    *object << members;
+    return object;
+}
+
+Class& Class::operator<<(const MemberVariableSPtr& membersItem)
+{
+    mMembers.push_back(membersItem);
+    return *this;
+}
+
+const ClassSPtr& operator<<(const ClassSPtr& object, const MemberVariableSPtr& membersItem)
+{
+    BOOST_ASSERT(object);
+    *object << membersItem;
+    return object;
+}
+
+}
+
+}
+
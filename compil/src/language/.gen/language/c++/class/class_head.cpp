@@ -0,0 +1,74 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/class_head.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ClassHead::ClassHead()
+{
+}
+
+ClassHead::~ClassHead()
+{
+}
+
+const EClassKey& ClassHead::key() const
+{
+    return mKey;
+}
+
+ClassHead& ClassHead::set_key(const EClassKey& key)
+{
+    mKey = key;
+    return *this;
+}
+
+EClassKey& ClassHead::mutable_key()
+{
+    return mKey;
+}
+
+ClassHead& ClassHead::operator<<(const EClassKey& key)
+{
+    return set_key(key);
+}
+
+const ClassHeadSPtr& operator<<(const ClassHeadSPtr& object, const EClassKey& key)
+{
+    BOOST_ASSERT(object);
+    *object << key;
+    return object;
+}
+
+const ClassNameSPtr& ClassHead::name() const
+{
+    return mName;
+}
+
+ClassHead& ClassHead::set_name(const ClassNameSPtr& name)
+{
+    mName = name;
+    return *this;
+}
+
+ClassHead& ClassHead::operator<<(const ClassNameSPtr& name)
+{
+    return set_name(name);
+}
+
+const ClassHeadSPtr& operator<<(const ClassHeadSPtr& object, const ClassNameSPtr& name)
+{
+    BOOST_ASSERT(object);
+    *object << name;
+    return object;
+}
+
+}
+
+}
+
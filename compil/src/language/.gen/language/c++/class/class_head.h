@@ -0,0 +1,116 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __CPP_CLASS_CLASS_HEAD_SCOMPIL_H_
+#define __CPP_CLASS_CLASS_HEAD_SCOMPIL_H_
+
+#include "language/c++/class/class_head.h"
+#include "language/c++/class/class_key.h"
+#include "language/c++/class/class_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+class ClassHead
+{
+public:
+    // Default constructor
+                                 ClassHead  ();
+    // Destructor
+    /*lax*/                      ~ClassHead ();
+
+    // Getter method for the data field key
+            const EClassKey&     key        ()                          const;
+    // Setter method for the data field key
+            ClassHead&           set_key    (const EClassKey& key);
+    // Provides mutable access to field key
+            EClassKey&           mutable_key();
+    // Store operator for the data field key
+            ClassHead&           operator<< (const EClassKey& key);
+
+    // Getter method for the data field name
+            const ClassNameSPtr& name       ()                          const;
+    // Setter method for the data field name
+            ClassHead&           set_name   (const ClassNameSPtr& name);
+    // Store operator for the data field name
+            ClassHead&           operator<< (const ClassNameSPtr& name);
+
+private:
+    // variable for the data field key
+    EClassKey     mKey;
+    // variable for the data field name
+    ClassNameSPtr mName;
+};
+
+// Reference store operator for the data field key
+const ClassHeadSPtr& operator<<(const ClassHeadSPtr& , const EClassKey& );
+// Reference store operator for the data field name
+const ClassHeadSPtr& operator<<(const ClassHeadSPtr& , const ClassNameSPtr& );
+
+inline ClassHeadSPtr classHeadRef()
+{
+    return boost::make_shared<ClassHead>();
+}
+
+}
+
+}
+
+#else // __CPP_CLASS_CLASS_HEAD_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// Forward declarations
+class ClassHead;
+typedef ClassHead*                         ClassHeadRPtr;
+typedef boost::shared_ptr<ClassHead>       ClassHeadSPtr;
+typedef boost::shared_ptr<const ClassHead> ClassHeadSCPtr;
+typedef boost::weak_ptr<ClassHead>         ClassHeadWPtr;
+
+}
+
+}
+
+#endif // __CPP_CLASS_CLASS_HEAD_SCOMPIL_H_
+
@@ -0,0 +1,74 @@
+#include "language/c++/class/class_key.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+EClassKey::EClassKey()
+        : mValue(kInvalid)
+{
+}
+
+EClassKey::EClassKey(long value)
+        : mValue(value)
+{
+}
+
+const EClassKey EClassKey::invalid()
+{
+    return EClassKey(kInvalid);
+}
+
+const EClassKey EClassKey::class_()
+{
+    return EClassKey(kClass);
+}
+
+const EClassKey EClassKey::struct_()
+{
+    return EClassKey(kStruct_);
+}
+
+const EClassKey EClassKey::union_()
+{
+    return EClassKey(kUnion);
+}
+
+long EClassKey::value() const
+{
+    return mValue;
+}
+
+const char* EClassKey::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "class",
+        "struct_",
+        "union",
+    };
+    return names[(size_t)value];
+}
+
+const char* EClassKey::shortName() const
+{
+    return shortName(value());
+}
+
+bool EClassKey::operator==(const EClassKey& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EClassKey::operator!=(const EClassKey& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+}
+
+}
+
@@ -0,0 +1,20 @@
+#include "language/c++/class/class_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ClassName::ClassName()
+{
+}
+
+ClassName::~ClassName()
+{
+}
+
+}
+
+}
+
@@ -0,0 +1,69 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/class_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ClassSpecifier::ClassSpecifier()
+{
+}
+
+ClassSpecifier::~ClassSpecifier()
+{
+}
+
+const ClassHeadSPtr& ClassSpecifier::head() const
+{
+    return mHead;
+}
+
+ClassSpecifier& ClassSpecifier::set_head(const ClassHeadSPtr& head)
+{
+    mHead = head;
+    return *this;
+}
+
+ClassSpecifier& ClassSpecifier::operator<<(const ClassHeadSPtr& head)
+{
+    return set_head(head);
+}
+
+const ClassSpecifierSPtr& operator<<(const ClassSpecifierSPtr& object, const ClassHeadSPtr& head)
+{
+    BOOST_ASSERT(object);
+    *object << head;
+    return object;
+}
+
+const MemberSpecificationSPtr& ClassSpecifier::members() const
+{
+    return mMembers;
+}
+
+ClassSpecifier& ClassSpecifier::set_members(const MemberSpecificationSPtr& members)
+{
+    mMembers = members;
+    return *this;
+}
+
+ClassSpecifier& ClassSpecifier::operator<<(const MemberSpecificationSPtr& members)
+{
+    return set_members(members);
+}
+
+const ClassSpecifierSPtr& operator<<(const ClassSpecifierSPtr& object, const MemberSpecificationSPtr& members)
+{
+    BOOST_ASSERT(object);
+    *object << members;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,114 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __CPP_CLASS_CLASS_SPECIFIER_SCOMPIL_H_
+#define __CPP_CLASS_CLASS_SPECIFIER_SCOMPIL_H_
+
+#include "language/c++/class/class_head.h"
+#include "language/c++/class/class_specifier.h"
+#include "language/c++/class/member_specification.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+class ClassSpecifier
+{
+public:
+    // Default constructor
+                                           ClassSpecifier ();
+    // Destructor
+    /*lax*/                                ~ClassSpecifier();
+
+    // Getter method for the data field head
+            const ClassHeadSPtr&           head           ()                                       const;
+    // Setter method for the data field head
+            ClassSpecifier&                set_head       (const ClassHeadSPtr& head);
+    // Store operator for the data field head
+            ClassSpecifier&                operator<<     (const ClassHeadSPtr& head);
+
+    // Getter method for the data field members
+            const MemberSpecificationSPtr& members        ()                                       const;
+    // Setter method for the data field members
+            ClassSpecifier&                set_members    (const MemberSpecificationSPtr& members);
+    // Store operator for the data field members
+            ClassSpecifier&                operator<<     (const MemberSpecificationSPtr& members);
+
+private:
+    // variable for the data field head
+    ClassHeadSPtr           mHead;
+    // variable for the data field members
+    MemberSpecificationSPtr mMembers;
+};
+
+// Reference store operator for the data field head
+const ClassSpecifierSPtr& operator<<(const ClassSpecifierSPtr& , const ClassHeadSPtr& );
+// Reference store operator for the data field members
+const ClassSpecifierSPtr& operator<<(const ClassSpecifierSPtr& , const MemberSpecificationSPtr& );
+
+inline ClassSpecifierSPtr classSpecifierRef()
+{
+    return boost::make_shared<ClassSpecifier>();
+}
+
+}
+
+}
+
+#else // __CPP_CLASS_CLASS_SPECIFIER_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// Forward declarations
+class ClassSpecifier;
+typedef ClassSpecifier*                         ClassSpecifierRPtr;
+typedef boost::shared_ptr<ClassSpecifier>       ClassSpecifierSPtr;
+typedef boost::shared_ptr<const ClassSpecifier> ClassSpecifierSCPtr;
+typedef boost::weak_ptr<ClassSpecifier>         ClassSpecifierWPtr;
+
+}
+
+}
+
+#endif // __CPP_CLASS_CLASS_SPECIFIER_SCOMPIL_H_
+
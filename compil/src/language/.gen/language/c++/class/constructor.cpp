@@ -0,0 +1,154 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/constructor.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+Constructor::Constructor()
+        : mSpecifier(default_specifier())
+{
+}
+
+Constructor::~Constructor()
+{
+}
+
+const ClassWPtr& Constructor::class_() const
+{
+    return mClass;
+}
+
+Constructor& Constructor::set_class(const ClassSPtr& class_)
+{
+    mClass = class_;
+    return *this;
+}
+
+Constructor& Constructor::operator<<(const ClassSPtr& class_)
+{
+    return set_class(class_);
+}
+
+const ConstructorSPtr& operator<<(const ConstructorSPtr& object, const ClassSPtr& class_)
+{
+    BOOST_ASSERT(object);
+    *object << class_;
+    return object;
+}
+
+const EAccessSpecifier& Constructor::accessSpecifier() const
+{
+    return mAccessSpecifier;
+}
+
+Constructor& Constructor::set_accessSpecifier(const EAccessSpecifier& accessSpecifier)
+{
+    mAccessSpecifier = accessSpecifier;
+    return *this;
+}
+
+EAccessSpecifier& Constructor::mutable_accessSpecifier()
+{
+    return mAccessSpecifier;
+}
+
+Constructor& Constructor::operator<<(const EAccessSpecifier& accessSpecifier)
+{
+    return set_accessSpecifier(accessSpecifier);
+}
+
+const ConstructorSPtr& operator<<(const ConstructorSPtr& object, const EAccessSpecifier& accessSpecifier)
+{
+    BOOST_ASSERT(object);
+    *object << accessSpecifier;
+    return object;
+}
+
+const EMethodSpecifier& Constructor::specifier() const
+{
+    return mSpecifier;
+}
+
+EMethodSpecifier Constructor::default_specifier()
+{
+    return EMethodSpecifier::nil();
+}
+
+Constructor& Constructor::set_specifier(const EMethodSpecifier& specifier)
+{
+    mSpecifier = specifier;
+    return *this;
+}
+
+EMethodSpecifier& Constructor::mutable_specifier()
+{
+    return mSpecifier;
+}
+
+Constructor& Constructor::operator<<(const EMethodSpecifier& specifier)
+{
+    return set_specifier(specifier);
+}
+
+const ConstructorSPtr& operator<<(const ConstructorSPtr& object, const EMethodSpecifier& specifier)
+{
+    BOOST_ASSERT(object);
+    *object << specifier;
+    return object;
+}
+
+const ClassNameSPtr& Constructor::name() const
+{
+    return mName;
+}
+
+Constructor& Constructor::set_name(const ClassNameSPtr& name)
+{
+    mName = name;
+    return *this;
+}
+
+Constructor& Constructor::operator<<(const ClassNameSPtr& name)
+{
+    return set_name(name);
+}
+
+const ConstructorSPtr& operator<<(const ConstructorSPtr& object, const ClassNameSPtr& name)
+{
+    BOOST_ASSERT(object);
+    *object << name;
+    return object;
+}
+
+const ParameterDeclarationClauseSPtr& Constructor::parameters() const
+{
+    return mParameters;
+}
+
+Constructor& Constructor::set_parameters(const ParameterDeclarationClauseSPtr& parameters)
+{
+    mParameters = parameters;
+    return *this;
+}
+
+Constructor& Constructor::operator<<(const ParameterDeclarationClauseSPtr& parameters)
+{
+    return set_parameters(parameters);
+}
+
+const ConstructorSPtr& operator<<(const ConstructorSPtr& object, const ParameterDeclarationClauseSPtr& parameters)
+{
+    BOOST_ASSERT(object);
+    *object << parameters;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,51 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/constructor_method_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ConstructorMethodName::ConstructorMethodName()
+{
+}
+
+ConstructorMethodName::~ConstructorMethodName()
+{
+}
+
+ConstructorMethodNameSPtr ConstructorMethodName::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<ConstructorMethodName>(object);
+}
+
+const ClassNameSPtr& ConstructorMethodName::className() const
+{
+    return mClassName;
+}
+
+ConstructorMethodName& ConstructorMethodName::set_className(const ClassNameSPtr& className)
+{
+    mClassName = className;
+    return *this;
+}
+
+ConstructorMethodName& ConstructorMethodName::operator<<(const ClassNameSPtr& className)
+{
+    return set_className(className);
+}
+
+const ConstructorMethodNameSPtr& operator<<(const ConstructorMethodNameSPtr& object, const ClassNameSPtr& className)
+{
+    BOOST_ASSERT(object);
+    *object << className;
+    return object;
+}
+
+}
+
+}
+
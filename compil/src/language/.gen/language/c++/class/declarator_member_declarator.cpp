@@ -0,0 +1,52 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/declarator_member_declarator.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+DeclaratorMemberDeclarator::DeclaratorMemberDeclarator()
+{
+}
+
+DeclaratorMemberDeclarator::~DeclaratorMemberDeclarator()
+{
+}
+
+DeclaratorMemberDeclaratorSPtr DeclaratorMemberDeclarator::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<DeclaratorMemberDeclarator>(object);
+}
+
+const DeclaratorSPtr& DeclaratorMemberDeclarator::declarator() const
+{
+    return mDeclarator;
+}
+
+DeclaratorMemberDeclarator& DeclaratorMemberDeclarator::set_declarator(const DeclaratorSPtr& declarator)
+{
+    mDeclarator = declarator;
+    return *this;
+}
+
+DeclaratorMemberDeclarator& DeclaratorMemberDeclarator::operator<<(const DeclaratorSPtr& declarator)
+{
+    return set_declarator(declarator);
+}
+
+const DeclaratorMemberDeclaratorSPtr& operator<<(const DeclaratorMemberDeclaratorSPtr& object,
+                                                 const DeclaratorSPtr& declarator)
+{
+    BOOST_ASSERT(object);
+    *object << declarator;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,97 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/destructor.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+Destructor::Destructor()
+{
+}
+
+Destructor::~Destructor()
+{
+}
+
+const ClassWPtr& Destructor::class_() const
+{
+    return mClass;
+}
+
+Destructor& Destructor::set_class(const ClassSPtr& class_)
+{
+    mClass = class_;
+    return *this;
+}
+
+Destructor& Destructor::operator<<(const ClassSPtr& class_)
+{
+    return set_class(class_);
+}
+
+const DestructorSPtr& operator<<(const DestructorSPtr& object, const ClassSPtr& class_)
+{
+    BOOST_ASSERT(object);
+    *object << class_;
+    return object;
+}
+
+const EAccessSpecifier& Destructor::accessSpecifier() const
+{
+    return mAccessSpecifier;
+}
+
+Destructor& Destructor::set_accessSpecifier(const EAccessSpecifier& accessSpecifier)
+{
+    mAccessSpecifier = accessSpecifier;
+    return *this;
+}
+
+EAccessSpecifier& Destructor::mutable_accessSpecifier()
+{
+    return mAccessSpecifier;
+}
+
+Destructor& Destructor::operator<<(const EAccessSpecifier& accessSpecifier)
+{
+    return set_accessSpecifier(accessSpecifier);
+}
+
+const DestructorSPtr& operator<<(const DestructorSPtr& object, const EAccessSpecifier& accessSpecifier)
+{
+    BOOST_ASSERT(object);
+    *object << accessSpecifier;
+    return object;
+}
+
+const ClassNameSPtr& Destructor::name() const
+{
+    return mName;
+}
+
+Destructor& Destructor::set_name(const ClassNameSPtr& name)
+{
+    mName = name;
+    return *this;
+}
+
+Destructor& Destructor::operator<<(const ClassNameSPtr& name)
+{
+    return set_name(name);
+}
+
+const DestructorSPtr& operator<<(const DestructorSPtr& object, const ClassNameSPtr& name)
+{
+    BOOST_ASSERT(object);
+    *object << name;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,128 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __CPP_CLASS_DESTRUCTOR_SCOMPIL_H_
+#define __CPP_CLASS_DESTRUCTOR_SCOMPIL_H_
+
+#include "language/c++/class/class.h"
+#include "language/c++/class/class_name.h"
+#include "language/c++/class/destructor.h"
+#include "language/c++/derieved_class/access_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+class Destructor
+{
+public:
+    // Default constructor
+                                    Destructor             ();
+    // Destructor
+    /*lax*/                         ~Destructor            ();
+
+    // Getter method for the data field class
+            const ClassWPtr&        class_                 ()                                        const;
+    // Setter method for the data field class
+            Destructor&             set_class              (const ClassSPtr& class_);
+    // Store operator for the data field class
+            Destructor&             operator<<             (const ClassSPtr& class_);
+
+    // Getter method for the data field accessSpecifier
+            const EAccessSpecifier& accessSpecifier        ()                                        const;
+    // Setter method for the data field accessSpecifier
+            Destructor&             set_accessSpecifier    (const EAccessSpecifier& accessSpecifier);
+    // Provides mutable access to field accessSpecifier
+            EAccessSpecifier&       mutable_accessSpecifier();
+    // Store operator for the data field accessSpecifier
+            Destructor&             operator<<             (const EAccessSpecifier& accessSpecifier);
+
+    // Getter method for the data field name
+            const ClassNameSPtr&    name                   ()                                        const;
+    // Setter method for the data field name
+            Destructor&             set_name               (const ClassNameSPtr& name);
+    // Store operator for the data field name
+            Destructor&             operator<<             (const ClassNameSPtr& name);
+
+private:
+    // variable for the data field class
+    ClassWPtr        mClass;
+    // variable for the data field accessSpecifier
+    EAccessSpecifier mAccessSpecifier;
+    // variable for the data field name
+    ClassNameSPtr    mName;
+};
+
+// Reference store operator for the data field class
+const DestructorSPtr& operator<<(const DestructorSPtr& , const ClassSPtr& );
+// Reference store operator for the data field accessSpecifier
+const DestructorSPtr& operator<<(const DestructorSPtr& , const EAccessSpecifier& );
+// Reference store operator for the data field name
+const DestructorSPtr& operator<<(const DestructorSPtr& , const ClassNameSPtr& );
+
+inline DestructorSPtr destructorRef()
+{
+    return boost::make_shared<Destructor>();
+}
+
+}
+
+}
+
+#else // __CPP_CLASS_DESTRUCTOR_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// Forward declarations
+class Destructor;
+typedef Destructor*                         DestructorRPtr;
+typedef boost::shared_ptr<Destructor>       DestructorSPtr;
+typedef boost::shared_ptr<const Destructor> DestructorSCPtr;
+typedef boost::weak_ptr<Destructor>         DestructorWPtr;
+
+}
+
+}
+
+#endif // __CPP_CLASS_DESTRUCTOR_SCOMPIL_H_
+
@@ -0,0 +1,51 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/destructor_method_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+DestructorMethodName::DestructorMethodName()
+{
+}
+
+DestructorMethodName::~DestructorMethodName()
+{
+}
+
+DestructorMethodNameSPtr DestructorMethodName::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<DestructorMethodName>(object);
+}
+
+const ClassNameSPtr& DestructorMethodName::className() const
+{
+    return mClassName;
+}
+
+DestructorMethodName& DestructorMethodName::set_className(const ClassNameSPtr& className)
+{
+    mClassName = className;
+    return *this;
+}
+
+DestructorMethodName& DestructorMethodName::operator<<(const ClassNameSPtr& className)
+{
+    return set_className(className);
+}
+
+const DestructorMethodNameSPtr& operator<<(const DestructorMethodNameSPtr& object, const ClassNameSPtr& className)
+{
+    BOOST_ASSERT(object);
+    *object << className;
+    return object;
+}
+
+}
+
+}
+
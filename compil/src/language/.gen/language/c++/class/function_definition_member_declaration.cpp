@@ -0,0 +1,52 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/function_definition_member_declaration.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+FunctionDefinitionMemberDeclaration::FunctionDefinitionMemberDeclaration()
+{
+}
+
+FunctionDefinitionMemberDeclaration::~FunctionDefinitionMemberDeclaration()
+{
+}
+
+FunctionDefinitionMemberDeclarationSPtr FunctionDefinitionMemberDeclaration::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<FunctionDefinitionMemberDeclaration>(object);
+}
+
+const FunctionDefinitionSPtr& FunctionDefinitionMemberDeclaration::definition() const
+{
+    return mDefinition;
+}
+
+FunctionDefinitionMemberDeclaration& FunctionDefinitionMemberDeclaration::set_definition(const FunctionDefinitionSPtr& definition)
+{
+    mDefinition = definition;
+    return *this;
+}
+
+FunctionDefinitionMemberDeclaration& FunctionDefinitionMemberDeclaration::operator<<(const FunctionDefinitionSPtr& definition)
+{
+    return set_definition(definition);
+}
+
+const FunctionDefinitionMemberDeclarationSPtr& operator<<(const FunctionDefinitionMemberDeclarationSPtr& object,
+                                                          const FunctionDefinitionSPtr& definition)
+{
+    BOOST_ASSERT(object);
+    *object << definition;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,48 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/identifier_destructor_method_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+IdentifierDestructorMethodName::IdentifierDestructorMethodName()
+{
+}
+
+IdentifierDestructorMethodName::~IdentifierDestructorMethodName()
+{
+}
+
+IdentifierDestructorMethodNameSPtr IdentifierDestructorMethodName::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<IdentifierDestructorMethodName>(object);
+}
+
+IdentifierDestructorMethodName& IdentifierDestructorMethodName::set_identifier(const IdentifierSPtr& identifier)
+{
+    IdentifierMethodName::set_identifier(identifier);
+    return *this;
+}
+
+IdentifierDestructorMethodName& IdentifierDestructorMethodName::operator<<(const IdentifierSPtr& identifier)
+{
+    *(IdentifierMethodName*)this << identifier;
+    return *this;
+}
+
+const IdentifierDestructorMethodNameSPtr& operator<<(const IdentifierDestructorMethodNameSPtr& object,
+                                                     const IdentifierSPtr& identifier)
+{
+    BOOST_ASSERT(object);
+    *object << identifier;
+    return object;
+}
+
+}
+
+}
+
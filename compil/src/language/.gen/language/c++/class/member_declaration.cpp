@@ -0,0 +1,25 @@
+#include "language/c++/class/member_declaration.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+MemberDeclaration::MemberDeclaration()
+{
+}
+
+MemberDeclaration::~MemberDeclaration()
+{
+}
+
+MemberDeclarationSPtr MemberDeclaration::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<MemberDeclaration>(object);
+}
+
+}
+
+}
+
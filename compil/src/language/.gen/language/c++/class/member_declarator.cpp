@@ -0,0 +1,25 @@
+#include "language/c++/class/member_declarator.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+MemberDeclarator::MemberDeclarator()
+{
+}
+
+MemberDeclarator::~MemberDeclarator()
+{
+}
+
+MemberDeclaratorSPtr MemberDeclarator::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<MemberDeclarator>(object);
+}
+
+}
+
+}
+
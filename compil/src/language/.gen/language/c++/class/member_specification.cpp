@@ -0,0 +1,146 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/member_specification.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+MemberSpecificationSection::MemberSpecificationSection()
+{
+}
+
+MemberSpecificationSection::~MemberSpecificationSection()
+{
+}
+
+const EAccessSpecifier& MemberSpecificationSection::accessSpecifier() const
+{
+    return mAccessSpecifier;
+}
+
+MemberSpecificationSection& MemberSpecificationSection::set_accessSpecifier(const EAccessSpecifier& accessSpecifier)
+{
+    mAccessSpecifier = accessSpecifier;
+    return *this;
+}
+
+EAccessSpecifier& MemberSpecificationSection::mutable_accessSpecifier()
+{
+    return mAccessSpecifier;
+}
+
+MemberSpecificationSection& MemberSpecificationSection::operator<<(const EAccessSpecifier& accessSpecifier)
+{
+    return set_accessSpecifier(accessSpecifier);
+}
+
+const MemberSpecificationSectionSPtr& operator<<(const MemberSpecificationSectionSPtr& object,
+                                                 const EAccessSpecifier& accessSpecifier)
+{
+    BOOST_ASSERT(object);
+    *object << accessSpecifier;
+    return object;
+}
+
+const std::vector<MemberDeclarationSPtr>& MemberSpecificationSection::declarations() const
+{
+    return mDeclarations;
+}
+
+MemberSpecificationSection& MemberSpecificationSection::set_declarations(const std::vector<MemberDeclarationSPtr>& declarations)
+{
+    mDeclarations = declarations;
+    return *this;
+}
+
+std::vector<MemberDeclarationSPtr>& MemberSpecificationSection::mutable_declarations()
+{
+    return mDeclarations;
+}
+
+MemberSpecificationSection& MemberSpecificationSection::operator<<(const std::vector<MemberDeclarationSPtr>& declarations)
+{
+    return set_declarations(declarations);
+}
+
+const MemberSpecificationSectionSPtr& operator<<(const MemberSpecificationSectionSPtr& object,
+                                                 const std::vector<MemberDeclarationSPtr>& declarations)
+{
+    BOOST_ASSERT(object);
+    *object << declarations;
+    return object;
+}
+
+MemberSpecificationSection& MemberSpecificationSection::operator<<(const MemberDeclarationSPtr& declarationsItem)
+{
+    mDeclarations.push_back(declarationsItem);
+    return *this;
+}
+
+const MemberSpecificationSectionSPtr& operator<<(const MemberSpecificationSectionSPtr& object,
+                                                 const MemberDeclarationSPtr& declarationsItem)
+{
+    BOOST_ASSERT(object);
+    *object << declarationsItem;
+    return object;
+}
+
+MemberSpecification::MemberSpecification()
+{
+}
+
+MemberSpecification::~MemberSpecification()
+{
+}
+
+const std::vector<MemberSpecificationSectionSPtr>& MemberSpecification::sections() const
+{
+    return mSections;
+}
+
+MemberSpecification& MemberSpecification::set_sections(const std::vector<MemberSpecificationSectionSPtr>& sections)
+{
+    mSections = sections;
+    return *this;
+}
+
+std::vector<MemberSpecificationSectionSPtr>& MemberSpecification::mutable_sections()
+{
+    return mSections;
+}
+
+MemberSpecification& MemberSpecification::operator<<(const std::vector<MemberSpecificationSectionSPtr>& sections)
+{
+    return set_sections(sections);
+}
+
+const MemberSpecificationSPtr& operator<<(const MemberSpecificationSPtr& object,
+                                          const std::vector<MemberSpecificationSectionSPtr>& sections)
+{
+    BOOST_ASSERT(object);
+    *object << sections;
+    return object;
+}
+
+MemberSpecification& MemberSpecification::operator<<(const MemberSpecificationSectionSPtr& sectionsItem)
+{
+    mSections.push_back(sectionsItem);
+    return *this;
+}
+
+const MemberSpecificationSPtr& operator<<(const MemberSpecificationSPtr& object,
+                                          const MemberSpecificationSectionSPtr& sectionsItem)
+{
+    BOOST_ASSERT(object);
+    *object << sectionsItem;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,166 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <vector>
+
+#ifndef __CPP_CLASS_MEMBER_SPECIFICATION_SCOMPIL_H_
+#define __CPP_CLASS_MEMBER_SPECIFICATION_SCOMPIL_H_
+
+#include "language/c++/class/member_declaration.h"
+#include "language/c++/class/member_specification.h"
+#include "language/c++/derieved_class/access_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+class MemberSpecificationSection
+{
+public:
+    // Default constructor
+                                                      MemberSpecificationSection ();
+    // Destructor
+    /*lax*/                                           ~MemberSpecificationSection();
+
+    // Getter method for the data field accessSpecifier
+            const EAccessSpecifier&                   accessSpecifier            ()                                                       const;
+    // Setter method for the data field accessSpecifier
+            MemberSpecificationSection&               set_accessSpecifier        (const EAccessSpecifier& accessSpecifier);
+    // Provides mutable access to field accessSpecifier
+            EAccessSpecifier&                         mutable_accessSpecifier    ();
+    // Store operator for the data field accessSpecifier
+            MemberSpecificationSection&               operator<<                 (const EAccessSpecifier& accessSpecifier);
+
+    // Getter method for the data field declarations
+            const std::vector<MemberDeclarationSPtr>& declarations               ()                                                       const;
+    // Setter method for the data field declarations
+            MemberSpecificationSection&               set_declarations           (const std::vector<MemberDeclarationSPtr>& declarations);
+    // Provides mutable access to field declarations
+            std::vector<MemberDeclarationSPtr>&       mutable_declarations       ();
+    // Store operator for the data field declarations
+            MemberSpecificationSection&               operator<<                 (const std::vector<MemberDeclarationSPtr>& declarations);
+    // Store operator for an item of data field declarations
+            MemberSpecificationSection&               operator<<                 (const MemberDeclarationSPtr& declarationsItem);
+
+private:
+    // variable for the data field accessSpecifier
+    EAccessSpecifier                   mAccessSpecifier;
+    // variable for the data field declarations
+    std::vector<MemberDeclarationSPtr> mDeclarations;
+};
+
+// Reference store operator for the data field accessSpecifier
+const MemberSpecificationSectionSPtr& operator<<(const MemberSpecificationSectionSPtr& , const EAccessSpecifier& );
+// Reference store operator for the data field declarations
+const MemberSpecificationSectionSPtr& operator<<(const MemberSpecificationSectionSPtr& ,
+                                                 const std::vector<MemberDeclarationSPtr>& );
+// Reference store operator for an item of data field declarations
+const MemberSpecificationSectionSPtr& operator<<(const MemberSpecificationSectionSPtr& , const MemberDeclarationSPtr& );
+
+class MemberSpecification
+{
+public:
+    // Default constructor
+                                                               MemberSpecification ();
+    // Destructor
+    /*lax*/                                                    ~MemberSpecification();
+
+    // Getter method for the data field sections
+            const std::vector<MemberSpecificationSectionSPtr>& sections            ()                                                            const;
+    // Setter method for the data field sections
+            MemberSpecification&                               set_sections        (const std::vector<MemberSpecificationSectionSPtr>& sections);
+    // Provides mutable access to field sections
+            std::vector<MemberSpecificationSectionSPtr>&       mutable_sections    ();
+    // Store operator for the data field sections
+            MemberSpecification&                               operator<<          (const std::vector<MemberSpecificationSectionSPtr>& sections);
+    // Store operator for an item of data field sections
+            MemberSpecification&                               operator<<          (const MemberSpecificationSectionSPtr& sectionsItem);
+
+private:
+    // variable for the data field sections
+    std::vector<MemberSpecificationSectionSPtr> mSections;
+};
+
+// Reference store operator for the data field sections
+const MemberSpecificationSPtr& operator<<(const MemberSpecificationSPtr& ,
+                                          const std::vector<MemberSpecificationSectionSPtr>& );
+// Reference store operator for an item of data field sections
+const MemberSpecificationSPtr& operator<<(const MemberSpecificationSPtr& , const MemberSpecificationSectionSPtr& );
+
+inline MemberSpecificationSectionSPtr memberSpecificationSectionRef()
+{
+    return boost::make_shared<MemberSpecificationSection>();
+}
+
+inline MemberSpecificationSPtr memberSpecificationRef()
+{
+    return boost::make_shared<MemberSpecification>();
+}
+
+}
+
+}
+
+#else // __CPP_CLASS_MEMBER_SPECIFICATION_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// Forward declarations
+class MemberSpecificationSection;
+typedef MemberSpecificationSection*                         MemberSpecificationSectionRPtr;
+typedef boost::shared_ptr<MemberSpecificationSection>       MemberSpecificationSectionSPtr;
+typedef boost::shared_ptr<const MemberSpecificationSection> MemberSpecificationSectionSCPtr;
+typedef boost::weak_ptr<MemberSpecificationSection>         MemberSpecificationSectionWPtr;
+
+class MemberSpecification;
+typedef MemberSpecification*                         MemberSpecificationRPtr;
+typedef boost::shared_ptr<MemberSpecification>       MemberSpecificationSPtr;
+typedef boost::shared_ptr<const MemberSpecification> MemberSpecificationSCPtr;
+typedef boost::weak_ptr<MemberSpecification>         MemberSpecificationWPtr;
+
+}
+
+}
+
+#endif // __CPP_CLASS_MEMBER_SPECIFICATION_SCOMPIL_H_
+
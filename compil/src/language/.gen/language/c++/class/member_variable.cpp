@@ -0,0 +1,120 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/member_variable.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+MemberVariable::MemberVariable()
+{
+}
+
+MemberVariable::~MemberVariable()
+{
+}
+
+const ClassWPtr& MemberVariable::class_() const
+{
+    return mClass;
+}
+
+MemberVariable& MemberVariable::set_class(const ClassSPtr& class_)
+{
+    mClass = class_;
+    return *this;
+}
+
+MemberVariable& MemberVariable::operator<<(const ClassSPtr& class_)
+{
+    return set_class(class_);
+}
+
+const MemberVariableSPtr& operator<<(const MemberVariableSPtr& object, const ClassSPtr& class_)
+{
+    BOOST_ASSERT(object);
+    *object << class_;
+    return object;
+}
+
+const EAccessSpecifier& MemberVariable::accessSpecifier() const
+{
+    return mAccessSpecifier;
+}
+
+MemberVariable& MemberVariable::set_accessSpecifier(const EAccessSpecifier& accessSpecifier)
+{
+    mAccessSpecifier = accessSpecifier;
+    return *this;
+}
+
+EAccessSpecifier& MemberVariable::mutable_accessSpecifier()
+{
+    return mAccessSpecifier;
+}
+
+MemberVariable& MemberVariable::operator<<(const EAccessSpecifier& accessSpecifier)
+{
+    return set_accessSpecifier(accessSpecifier);
+}
+
+const MemberVariableSPtr& operator<<(const MemberVariableSPtr& object, const EAccessSpecifier& accessSpecifier)
+{
+    BOOST_ASSERT(object);
+    *object << accessSpecifier;
+    return object;
+}
+
+const DeclarationSpecifierSPtr& MemberVariable::type() const
+{
+    return mType;
+}
+
+MemberVariable& MemberVariable::set_type(const DeclarationSpecifierSPtr& type)
+{
+    mType = type;
+    return *this;
+}
+
+MemberVariable& MemberVariable::operator<<(const DeclarationSpecifierSPtr& type)
+{
+    return set_type(type);
+}
+
+const MemberVariableSPtr& operator<<(const MemberVariableSPtr& object, const DeclarationSpecifierSPtr& type)
+{
+    BOOST_ASSERT(object);
+    *object << type;
+    return object;
+}
+
+const MemberVariableNameSPtr& MemberVariable::name() const
+{
+    return mName;
+}
+
+MemberVariable& MemberVariable::set_name(const MemberVariableNameSPtr& name)
+{
+    mName = name;
+    return *this;
+}
+
+MemberVariable& MemberVariable::operator<<(const MemberVariableNameSPtr& name)
+{
+    return set_name(name);
+}
+
+const MemberVariableSPtr& operator<<(const MemberVariableSPtr& object, const MemberVariableNameSPtr& name)
+{
+    BOOST_ASSERT(object);
+    *object << name;
+    return object;
+}
+
+}
+
+}
+
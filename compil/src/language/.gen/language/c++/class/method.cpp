@@ -0,0 +1,223 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/method.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+Method::Method()
+        : mMethodSpecifier(default_methodSpecifier())
+{
+}
+
+Method::~Method()
+{
+}
+
+const ClassWPtr& Method::class_() const
+{
+    return mClass;
+}
+
+Method& Method::set_class(const ClassSPtr& class_)
+{
+    mClass = class_;
+    return *this;
+}
+
+Method& Method::operator<<(const ClassSPtr& class_)
+{
+    return set_class(class_);
+}
+
+const MethodSPtr& operator<<(const MethodSPtr& object, const ClassSPtr& class_)
+{
+    BOOST_ASSERT(object);
+    *object << class_;
+    return object;
+}
+
+const EAccessSpecifier& Method::accessSpecifier() const
+{
+    return mAccessSpecifier;
+}
+
+Method& Method::set_accessSpecifier(const EAccessSpecifier& accessSpecifier)
+{
+    mAccessSpecifier = accessSpecifier;
+    return *this;
+}
+
+EAccessSpecifier& Method::mutable_accessSpecifier()
+{
+    return mAccessSpecifier;
+}
+
+Method& Method::operator<<(const EAccessSpecifier& accessSpecifier)
+{
+    return set_accessSpecifier(accessSpecifier);
+}
+
+const MethodSPtr& operator<<(const MethodSPtr& object, const EAccessSpecifier& accessSpecifier)
+{
+    BOOST_ASSERT(object);
+    *object << accessSpecifier;
+    return object;
+}
+
+const EMethodSpecifier& Method::methodSpecifier() const
+{
+    return mMethodSpecifier;
+}
+
+EMethodSpecifier Method::default_methodSpecifier()
+{
+    return EMethodSpecifier::nil();
+}
+
+Method& Method::set_methodSpecifier(const EMethodSpecifier& methodSpecifier)
+{
+    mMethodSpecifier = methodSpecifier;
+    return *this;
+}
+
+EMethodSpecifier& Method::mutable_methodSpecifier()
+{
+    return mMethodSpecifier;
+}
+
+Method& Method::operator<<(const EMethodSpecifier& methodSpecifier)
+{
+    return set_methodSpecifier(methodSpecifier);
+}
+
+const MethodSPtr& operator<<(const MethodSPtr& object, const EMethodSpecifier& methodSpecifier)
+{
+    BOOST_ASSERT(object);
+    *object << methodSpecifier;
+    return object;
+}
+
+const DeclarationSpecifierSPtr& Method::returnType() const
+{
+    return mReturnType;
+}
+
+Method& Method::set_returnType(const DeclarationSpecifierSPtr& returnType)
+{
+    mReturnType = returnType;
+    return *this;
+}
+
+Method& Method::operator<<(const DeclarationSpecifierSPtr& returnType)
+{
+    return set_returnType(returnType);
+}
+
+const MethodSPtr& operator<<(const MethodSPtr& object, const DeclarationSpecifierSPtr& returnType)
+{
+    BOOST_ASSERT(object);
+    *object << returnType;
+    return object;
+}
+
+const MethodNameSPtr& Method::name() const
+{
+    return mName;
+}
+
+Method& Method::set_name(const MethodNameSPtr& name)
+{
+    mName = name;
+    return *this;
+}
+
+Method& Method::operator<<(const MethodNameSPtr& name)
+{
+    return set_name(name);
+}
+
+const MethodSPtr& operator<<(const MethodSPtr& object, const MethodNameSPtr& name)
+{
+    BOOST_ASSERT(object);
+    *object << name;
+    return object;
+}
+
+const ParameterDeclarationClauseSPtr& Method::parameters() const
+{
+    return mParameters;
+}
+
+Method& Method::set_parameters(const ParameterDeclarationClauseSPtr& parameters)
+{
+    mParameters = parameters;
+    return *this;
+}
+
+Method& Method::operator<<(const ParameterDeclarationClauseSPtr& parameters)
+{
+    return set_parameters(parameters);
+}
+
+const MethodSPtr& operator<<(const MethodSPtr& object, const ParameterDeclarationClauseSPtr& parameters)
+{
+    BOOST_ASSERT(object);
+    *object << parameters;
+    return object;
+}
+
+const CVQualifierSequenceSPtr& Method::qualifier() const
+{
+    return mQualifier;
+}
+
+Method& Method::set_qualifier(const CVQualifierSequenceSPtr& qualifier)
+{
+    mQualifier = qualifier;
+    return *this;
+}
+
+Method& Method::operator<<(const CVQualifierSequenceSPtr& qualifier)
+{
+    return set_qualifier(qualifier);
+}
+
+const MethodSPtr& operator<<(const MethodSPtr& object, const CVQualifierSequenceSPtr& qualifier)
+{
+    BOOST_ASSERT(object);
+    *object << qualifier;
+    return object;
+}
+
+const FunctionBodySPtr& Method::body() const
+{
+    return mBody;
+}
+
+Method& Method::set_body(const FunctionBodySPtr& body)
+{
+    mBody = body;
+    return *this;
+}
+
+Method& Method::operator<<(const FunctionBodySPtr& body)
+{
+    return set_body(body);
+}
+
+const MethodSPtr& operator<<(const MethodSPtr& object, const FunctionBodySPtr& body)
+{
+    BOOST_ASSERT(object);
+    *object << body;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,194 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __CPP_CLASS_METHOD_SCOMPIL_H_
+#define __CPP_CLASS_METHOD_SCOMPIL_H_
+
+#include "language/c++/class/class.h"
+#include "language/c++/class/method.h"
+#include "language/c++/class/method_name.h"
+#include "language/c++/class/method_specifier.h"
+#include "language/c++/declaration/declaration_specifier.h"
+#include "language/c++/declarator/cv_qualifier_sequence.h"
+#include "language/c++/declarator/function_body.h"
+#include "language/c++/declarator/parameter_declaratoin_clause.h"
+#include "language/c++/derieved_class/access_specifier.h"
+// Compil C++ Template Library
+#include "core/compil/flags_enumeration.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+class Method
+{
+public:
+    // Default constructor
+                                                  Method                 ();
+    // Destructor
+    /*lax*/                                       ~Method                ();
+
+    // Getter method for the data field class
+            const ClassWPtr&                      class_                 ()                                                 const;
+    // Setter method for the data field class
+            Method&                               set_class              (const ClassSPtr& class_);
+    // Store operator for the data field class
+            Method&                               operator<<             (const ClassSPtr& class_);
+
+    // Getter method for the data field accessSpecifier
+            const EAccessSpecifier&               accessSpecifier        ()                                                 const;
+    // Setter method for the data field accessSpecifier
+            Method&                               set_accessSpecifier    (const EAccessSpecifier& accessSpecifier);
+    // Provides mutable access to field accessSpecifier
+            EAccessSpecifier&                     mutable_accessSpecifier();
+    // Store operator for the data field accessSpecifier
+            Method&                               operator<<             (const EAccessSpecifier& accessSpecifier);
+
+    // Getter method for the data field methodSpecifier
+            const EMethodSpecifier&               methodSpecifier        ()                                                 const;
+    // Returns the default value nil of the field methodSpecifier
+    static  EMethodSpecifier                      default_methodSpecifier();
+    // Setter method for the data field methodSpecifier
+            Method&                               set_methodSpecifier    (const EMethodSpecifier& methodSpecifier);
+    // Provides mutable access to field methodSpecifier
+            EMethodSpecifier&                     mutable_methodSpecifier();
+    // Store operator for the data field methodSpecifier
+            Method&                               operator<<             (const EMethodSpecifier& methodSpecifier);
+
+    // Getter method for the data field returnType
+            const DeclarationSpecifierSPtr&       returnType             ()                                                 const;
+    // Setter method for the data field returnType
+            Method&                               set_returnType         (const DeclarationSpecifierSPtr& returnType);
+    // Store operator for the data field returnType
+            Method&                               operator<<             (const DeclarationSpecifierSPtr& returnType);
+
+    // Getter method for the data field name
+            const MethodNameSPtr&                 name                   ()                                                 const;
+    // Setter method for the data field name
+            Method&                               set_name               (const MethodNameSPtr& name);
+    // Store operator for the data field name
+            Method&                               operator<<             (const MethodNameSPtr& name);
+
+    // Getter method for the data field parameters
+            const ParameterDeclarationClauseSPtr& parameters             ()                                                 const;
+    // Setter method for the data field parameters
+            Method&                               set_parameters         (const ParameterDeclarationClauseSPtr& parameters);
+    // Store operator for the data field parameters
+            Method&                               operator<<             (const ParameterDeclarationClauseSPtr& parameters);
+
+    // Getter method for the data field qualifier
+            const CVQualifierSequenceSPtr&        qualifier              ()                                                 const;
+    // Setter method for the data field qualifier
+            Method&                               set_qualifier          (const CVQualifierSequenceSPtr& qualifier);
+    // Store operator for the data field qualifier
+            Method&                               operator<<             (const CVQualifierSequenceSPtr& qualifier);
+
+    // Getter method for the data field body
+            const FunctionBodySPtr&               body                   ()                                                 const;
+    // Setter method for the data field body
+            Method&                               set_body               (const FunctionBodySPtr& body);
+    // Store operator for the data field body
+            Method&                               operator<<             (const FunctionBodySPtr& body);
+
+private:
+    // variable for the data field class
+    ClassWPtr                      mClass;
+    // variable for the data field accessSpecifier
+    EAccessSpecifier               mAccessSpecifier;
+    // variable for the data field methodSpecifier
+    EMethodSpecifier               mMethodSpecifier;
+    // variable for the data field returnType
+    DeclarationSpecifierSPtr       mReturnType;
+    // variable for the data field name
+    MethodNameSPtr                 mName;
+    // variable for the data field parameters
+    ParameterDeclarationClauseSPtr mParameters;
+    // variable for the data field qualifier
+    CVQualifierSequenceSPtr        mQualifier;
+    // variable for the data field body
+    FunctionBodySPtr               mBody;
+};
+
+// Reference store operator for the data field class
+const MethodSPtr& operator<<(const MethodSPtr& , const ClassSPtr& );
+// Reference store operator for the data field accessSpecifier
+const MethodSPtr& operator<<(const MethodSPtr& , const EAccessSpecifier& );
+// Reference store operator for the data field methodSpecifier
+const MethodSPtr& operator<<(const MethodSPtr& , const EMethodSpecifier& );
+// Reference store operator for the data field returnType
+const MethodSPtr& operator<<(const MethodSPtr& , const DeclarationSpecifierSPtr& );
+// Reference store operator for the data field name
+const MethodSPtr& operator<<(const MethodSPtr& , const MethodNameSPtr& );
+// Reference store operator for the data field parameters
+const MethodSPtr& operator<<(const MethodSPtr& , const ParameterDeclarationClauseSPtr& );
+// Reference store operator for the data field qualifier
+const MethodSPtr& operator<<(const MethodSPtr& , const CVQualifierSequenceSPtr& );
+// Reference store operator for the data field body
+const MethodSPtr& operator<<(const MethodSPtr& , const FunctionBodySPtr& );
+
+inline MethodSPtr methodRef()
+{
+    return boost::make_shared<Method>();
+}
+
+}
+
+}
+
+#else // __CPP_CLASS_METHOD_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// Forward declarations
+class Method;
+typedef Method*                         MethodRPtr;
+typedef boost::shared_ptr<Method>       MethodSPtr;
+typedef boost::shared_ptr<const Method> MethodSCPtr;
+typedef boost::weak_ptr<Method>         MethodWPtr;
+
+}
+
+}
+
+#endif // __CPP_CLASS_METHOD_SCOMPIL_H_
+
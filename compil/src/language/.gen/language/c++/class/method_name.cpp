@@ -0,0 +1,25 @@
+#include "language/c++/class/method_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+MethodName::MethodName()
+{
+}
+
+MethodName::~MethodName()
+{
+}
+
+MethodNameSPtr MethodName::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<MethodName>(object);
+}
+
+}
+
+}
+
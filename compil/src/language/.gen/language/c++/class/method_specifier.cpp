@@ -0,0 +1,90 @@
+#include "language/c++/class/method_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+EMethodSpecifier::EMethodSpecifier()
+        : flags_enumeration<long, EMethodSpecifier>(0)
+{
+}
+
+EMethodSpecifier::EMethodSpecifier(long value)
+        : flags_enumeration<long, EMethodSpecifier>(value)
+{
+}
+
+const EMethodSpecifier EMethodSpecifier::nil()
+{
+    return EMethodSpecifier(kNil);
+}
+
+const EMethodSpecifier EMethodSpecifier::inline_()
+{
+    return EMethodSpecifier(kInline);
+}
+
+const EMethodSpecifier EMethodSpecifier::virtual_()
+{
+    return EMethodSpecifier(kVirtual);
+}
+
+const EMethodSpecifier EMethodSpecifier::explicit_()
+{
+    return EMethodSpecifier(kExplicit);
+}
+
+const EMethodSpecifier EMethodSpecifier::inline_explicit()
+{
+    return EMethodSpecifier(kInline_explicit);
+}
+
+const EMethodSpecifier EMethodSpecifier::inline_virtual()
+{
+    return EMethodSpecifier(kInline_virtual);
+}
+
+const EMethodSpecifier EMethodSpecifier::all()
+{
+    return EMethodSpecifier(kAll);
+}
+
+long EMethodSpecifier::value() const
+{
+    return mValue;
+}
+
+const char* EMethodSpecifier::shortName(long value)
+{
+    switch (value)
+    {
+        case kInline         : return "inline";
+        case kVirtual        : return "virtual";
+        case kExplicit       : return "explicit";
+        case kInline_explicit: return "inline_explicit";
+        case kInline_virtual : return "inline_virtual";
+        default              : return "custom";
+    }
+}
+
+const char* EMethodSpecifier::shortName() const
+{
+    return shortName(value());
+}
+
+bool EMethodSpecifier::operator==(const EMethodSpecifier& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EMethodSpecifier::operator!=(const EMethodSpecifier& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+}
+
+}
+
@@ -0,0 +1,131 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __CPP_CLASS_METHOD_SPECIFIER_SCOMPIL_H_
+#define __CPP_CLASS_METHOD_SPECIFIER_SCOMPIL_H_
+
+#include "language/c++/class/method_specifier.h"
+// Compil C++ Template Library
+#include "core/compil/flags_enumeration.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EMethodSpecifier : public flags_enumeration<long, EMethodSpecifier>
+{
+public:
+    // Default constructor - sets the value to nil
+                         EMethodSpecifier();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit             EMethodSpecifier(long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long        value           ()                               const;
+    // Returns short name for a specified enum value
+    static   const char* shortName       (long value);
+    // Returns short name of the enum value
+             const char* shortName       ()                               const;
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool        operator==      (const EMethodSpecifier& rValue) const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool        operator!=      (const EMethodSpecifier& rValue) const;
+
+    // static methods for enum class objects
+    static const EMethodSpecifier nil            ();
+    static const EMethodSpecifier inline_        ();
+    static const EMethodSpecifier virtual_       ();
+    static const EMethodSpecifier explicit_      ();
+    static const EMethodSpecifier inline_explicit();
+    static const EMethodSpecifier inline_virtual ();
+    static const EMethodSpecifier all            ();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kNil             = 0,
+        kInline          = 1 << 0,
+        kVirtual         = 1 << 1,
+        kExplicit        = 1 << 2,
+        kInline_explicit = kInline | kExplicit,
+        kInline_virtual  = kInline | kVirtual,
+        kAll             = 0x7,
+    };
+
+};
+
+}
+
+}
+
+#else // __CPP_CLASS_METHOD_SPECIFIER_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// Forward declarations
+class EMethodSpecifier;
+typedef EMethodSpecifier*                         EMethodSpecifierRPtr;
+typedef boost::shared_ptr<EMethodSpecifier>       EMethodSpecifierSPtr;
+typedef boost::shared_ptr<const EMethodSpecifier> EMethodSpecifierSCPtr;
+typedef boost::weak_ptr<EMethodSpecifier>         EMethodSpecifierWPtr;
+
+}
+
+}
+
+#endif // __CPP_CLASS_METHOD_SPECIFIER_SCOMPIL_H_
+
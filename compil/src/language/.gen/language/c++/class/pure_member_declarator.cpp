@@ -0,0 +1,74 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/pure_member_declarator.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+PureMemberDeclarator::PureMemberDeclarator()
+{
+}
+
+PureMemberDeclarator::~PureMemberDeclarator()
+{
+}
+
+PureMemberDeclaratorSPtr PureMemberDeclarator::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<PureMemberDeclarator>(object);
+}
+
+const DeclaratorSPtr& PureMemberDeclarator::declarator() const
+{
+    return mDeclarator;
+}
+
+PureMemberDeclarator& PureMemberDeclarator::set_declarator(const DeclaratorSPtr& declarator)
+{
+    mDeclarator = declarator;
+    return *this;
+}
+
+PureMemberDeclarator& PureMemberDeclarator::operator<<(const DeclaratorSPtr& declarator)
+{
+    return set_declarator(declarator);
+}
+
+const PureMemberDeclaratorSPtr& operator<<(const PureMemberDeclaratorSPtr& object, const DeclaratorSPtr& declarator)
+{
+    BOOST_ASSERT(object);
+    *object << declarator;
+    return object;
+}
+
+const PureSpecifierSPtr& PureMemberDeclarator::pure() const
+{
+    return mPure;
+}
+
+PureMemberDeclarator& PureMemberDeclarator::set_pure(const PureSpecifierSPtr& pure)
+{
+    mPure = pure;
+    return *this;
+}
+
+PureMemberDeclarator& PureMemberDeclarator::operator<<(const PureSpecifierSPtr& pure)
+{
+    return set_pure(pure);
+}
+
+const PureMemberDeclaratorSPtr& operator<<(const PureMemberDeclaratorSPtr& object, const PureSpecifierSPtr& pure)
+{
+    BOOST_ASSERT(object);
+    *object << pure;
+    return object;
+}
+
+}
+
+}
+
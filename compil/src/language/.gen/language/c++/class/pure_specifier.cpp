@@ -0,0 +1,20 @@
+#include "language/c++/class/pure_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+PureSpecifier::PureSpecifier()
+{
+}
+
+PureSpecifier::~PureSpecifier()
+{
+}
+
+}
+
+}
+
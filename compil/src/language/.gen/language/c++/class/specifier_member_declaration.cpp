@@ -0,0 +1,76 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/class/specifier_member_declaration.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+SpecifierMemberDeclaration::SpecifierMemberDeclaration()
+{
+}
+
+SpecifierMemberDeclaration::~SpecifierMemberDeclaration()
+{
+}
+
+SpecifierMemberDeclarationSPtr SpecifierMemberDeclaration::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<SpecifierMemberDeclaration>(object);
+}
+
+const DeclarationSpecifierSequenceSPtr& SpecifierMemberDeclaration::specifier() const
+{
+    return mSpecifier;
+}
+
+SpecifierMemberDeclaration& SpecifierMemberDeclaration::set_specifier(const DeclarationSpecifierSequenceSPtr& specifier)
+{
+    mSpecifier = specifier;
+    return *this;
+}
+
+SpecifierMemberDeclaration& SpecifierMemberDeclaration::operator<<(const DeclarationSpecifierSequenceSPtr& specifier)
+{
+    return set_specifier(specifier);
+}
+
+const SpecifierMemberDeclarationSPtr& operator<<(const SpecifierMemberDeclarationSPtr& object,
+                                                 const DeclarationSpecifierSequenceSPtr& specifier)
+{
+    BOOST_ASSERT(object);
+    *object << specifier;
+    return object;
+}
+
+const MemberDeclaratorSPtr& SpecifierMemberDeclaration::declarator() const
+{
+    return mDeclarator;
+}
+
+SpecifierMemberDeclaration& SpecifierMemberDeclaration::set_declarator(const MemberDeclaratorSPtr& declarator)
+{
+    mDeclarator = declarator;
+    return *this;
+}
+
+SpecifierMemberDeclaration& SpecifierMemberDeclaration::operator<<(const MemberDeclaratorSPtr& declarator)
+{
+    return set_declarator(declarator);
+}
+
+const SpecifierMemberDeclarationSPtr& operator<<(const SpecifierMemberDeclarationSPtr& object,
+                                                 const MemberDeclaratorSPtr& declarator)
+{
+    BOOST_ASSERT(object);
+    *object << declarator;
+    return object;
+}
+
+}
+
+}
+
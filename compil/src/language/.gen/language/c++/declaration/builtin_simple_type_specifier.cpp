@@ -0,0 +1,173 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declaration/builtin_simple_type_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+BuiltinSimpleTypeSpecifier::BuiltinSimpleTypeSpecifier()
+{
+}
+
+BuiltinSimpleTypeSpecifier::~BuiltinSimpleTypeSpecifier()
+{
+}
+
+BuiltinSimpleTypeSpecifierSPtr BuiltinSimpleTypeSpecifier::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<BuiltinSimpleTypeSpecifier>(object);
+}
+
+BuiltinSimpleTypeSpecifier::EType::EType()
+        : mValue(kInvalid)
+{
+}
+
+BuiltinSimpleTypeSpecifier::EType::EType(long value)
+        : mValue(value)
+{
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::invalid()
+{
+    return EType(kInvalid);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::bool_()
+{
+    return EType(kBool);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::size()
+{
+    return EType(kSize);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::signedChar()
+{
+    return EType(kSignedChar);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::unsignedChar()
+{
+    return EType(kUnsignedChar);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::signedShort()
+{
+    return EType(kSignedShort);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::unsignedShort()
+{
+    return EType(kUnsignedShort);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::signedInt()
+{
+    return EType(kSignedInt);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::unsignedInt()
+{
+    return EType(kUnsignedInt);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::signedLong()
+{
+    return EType(kSignedLong);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::unsignedLong()
+{
+    return EType(kUnsignedLong);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::signedLongLong()
+{
+    return EType(kSignedLongLong);
+}
+
+const BuiltinSimpleTypeSpecifier::EType BuiltinSimpleTypeSpecifier::EType::unsignedLongLong()
+{
+    return EType(kUnsignedLongLong);
+}
+
+long BuiltinSimpleTypeSpecifier::EType::value() const
+{
+    return mValue;
+}
+
+const char* BuiltinSimpleTypeSpecifier::EType::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "bool",
+        "size",
+        "signedChar",
+        "unsignedChar",
+        "signedShort",
+        "unsignedShort",
+        "signedInt",
+        "unsignedInt",
+        "signedLong",
+        "unsignedLong",
+        "signedLongLong",
+        "unsignedLongLong",
+    };
+    return names[(size_t)value];
+}
+
+const char* BuiltinSimpleTypeSpecifier::EType::shortName() const
+{
+    return shortName(value());
+}
+
+bool BuiltinSimpleTypeSpecifier::EType::operator==(const EType& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool BuiltinSimpleTypeSpecifier::EType::operator!=(const EType& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+const BuiltinSimpleTypeSpecifier::EType& BuiltinSimpleTypeSpecifier::type() const
+{
+    return mType;
+}
+
+BuiltinSimpleTypeSpecifier& BuiltinSimpleTypeSpecifier::set_type(const EType& type)
+{
+    mType = type;
+    return *this;
+}
+
+BuiltinSimpleTypeSpecifier::EType& BuiltinSimpleTypeSpecifier::mutable_type()
+{
+    return mType;
+}
+
+BuiltinSimpleTypeSpecifier& BuiltinSimpleTypeSpecifier::operator<<(const EType& type)
+{
+    return set_type(type);
+}
+
+const BuiltinSimpleTypeSpecifierSPtr& operator<<(const BuiltinSimpleTypeSpecifierSPtr& object,
+                                                 const BuiltinSimpleTypeSpecifier::EType& type)
+{
+    BOOST_ASSERT(object);
+    *object << type;
+    return object;
+}
+
+}
+
+}
+
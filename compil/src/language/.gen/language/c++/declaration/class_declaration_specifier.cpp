@@ -0,0 +1,51 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declaration/class_declaration_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ClassDeclarationSpecifier::ClassDeclarationSpecifier()
+{
+}
+
+ClassDeclarationSpecifier::~ClassDeclarationSpecifier()
+{
+}
+
+ClassDeclarationSpecifierSPtr ClassDeclarationSpecifier::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<ClassDeclarationSpecifier>(object);
+}
+
+const ClassSPtr& ClassDeclarationSpecifier::class_() const
+{
+    return mClass;
+}
+
+ClassDeclarationSpecifier& ClassDeclarationSpecifier::set_class(const ClassSPtr& class_)
+{
+    mClass = class_;
+    return *this;
+}
+
+ClassDeclarationSpecifier& ClassDeclarationSpecifier::operator<<(const ClassSPtr& class_)
+{
+    return set_class(class_);
+}
+
+const ClassDeclarationSpecifierSPtr& operator<<(const ClassDeclarationSpecifierSPtr& object, const ClassSPtr& class_)
+{
+    BOOST_ASSERT(object);
+    *object << class_;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,51 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declaration/class_type_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ClassTypeName::ClassTypeName()
+{
+}
+
+ClassTypeName::~ClassTypeName()
+{
+}
+
+ClassTypeNameSPtr ClassTypeName::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<ClassTypeName>(object);
+}
+
+const ClassNameSPtr& ClassTypeName::className() const
+{
+    return mClassName;
+}
+
+ClassTypeName& ClassTypeName::set_className(const ClassNameSPtr& className)
+{
+    mClassName = className;
+    return *this;
+}
+
+ClassTypeName& ClassTypeName::operator<<(const ClassNameSPtr& className)
+{
+    return set_className(className);
+}
+
+const ClassTypeNameSPtr& operator<<(const ClassTypeNameSPtr& object, const ClassNameSPtr& className)
+{
+    BOOST_ASSERT(object);
+    *object << className;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,57 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declaration/cv_qualifier_type_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+CVQualifierTypeSpecifier::CVQualifierTypeSpecifier()
+{
+}
+
+CVQualifierTypeSpecifier::~CVQualifierTypeSpecifier()
+{
+}
+
+CVQualifierTypeSpecifierSPtr CVQualifierTypeSpecifier::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<CVQualifierTypeSpecifier>(object);
+}
+
+const ECVQualifier& CVQualifierTypeSpecifier::qualifier() const
+{
+    return mQualifier;
+}
+
+CVQualifierTypeSpecifier& CVQualifierTypeSpecifier::set_qualifier(const ECVQualifier& qualifier)
+{
+    mQualifier = qualifier;
+    return *this;
+}
+
+ECVQualifier& CVQualifierTypeSpecifier::mutable_qualifier()
+{
+    return mQualifier;
+}
+
+CVQualifierTypeSpecifier& CVQualifierTypeSpecifier::operator<<(const ECVQualifier& qualifier)
+{
+    return set_qualifier(qualifier);
+}
+
+const CVQualifierTypeSpecifierSPtr& operator<<(const CVQualifierTypeSpecifierSPtr& object,
+                                               const ECVQualifier& qualifier)
+{
+    BOOST_ASSERT(object);
+    *object << qualifier;
+    return object;
+}
+
+}
+
+}
+
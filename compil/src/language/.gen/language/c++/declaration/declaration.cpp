@@ -0,0 +1,20 @@
+#include "language/c++/declaration/declaration.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+Declaration::Declaration()
+{
+}
+
+Declaration::~Declaration()
+{
+}
+
+}
+
+}
+
@@ -0,0 +1,932 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declaration/declaration_factory.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+EDeclarationId::EDeclarationId()
+        : mValue(kInvalid)
+{
+}
+
+EDeclarationId::EDeclarationId(long value)
+        : mValue(value)
+{
+}
+
+const EDeclarationId EDeclarationId::invalid()
+{
+    return EDeclarationId(kInvalid);
+}
+
+const EDeclarationId EDeclarationId::blockDeclaration()
+{
+    return EDeclarationId(kBlockDeclaration);
+}
+
+const EDeclarationId EDeclarationId::builtinSimpleTypeSpecifier()
+{
+    return EDeclarationId(kBuiltinSimpleTypeSpecifier);
+}
+
+const EDeclarationId EDeclarationId::cVQualifierTypeSpecifier()
+{
+    return EDeclarationId(kCVQualifierTypeSpecifier);
+}
+
+const EDeclarationId EDeclarationId::classDeclarationSpecifier()
+{
+    return EDeclarationId(kClassDeclarationSpecifier);
+}
+
+const EDeclarationId EDeclarationId::classTypeName()
+{
+    return EDeclarationId(kClassTypeName);
+}
+
+const EDeclarationId EDeclarationId::constructorMethodName()
+{
+    return EDeclarationId(kConstructorMethodName);
+}
+
+const EDeclarationId EDeclarationId::declaration()
+{
+    return EDeclarationId(kDeclaration);
+}
+
+const EDeclarationId EDeclarationId::declarationSpecifier()
+{
+    return EDeclarationId(kDeclarationSpecifier);
+}
+
+const EDeclarationId EDeclarationId::declarationSpecifierSequence()
+{
+    return EDeclarationId(kDeclarationSpecifierSequence);
+}
+
+const EDeclarationId EDeclarationId::destructorMethodName()
+{
+    return EDeclarationId(kDestructorMethodName);
+}
+
+const EDeclarationId EDeclarationId::functionDeclarationSpecifier()
+{
+    return EDeclarationId(kFunctionDeclarationSpecifier);
+}
+
+const EDeclarationId EDeclarationId::functionDefinitionMemberDeclaration()
+{
+    return EDeclarationId(kFunctionDefinitionMemberDeclaration);
+}
+
+const EDeclarationId EDeclarationId::functionName()
+{
+    return EDeclarationId(kFunctionName);
+}
+
+const EDeclarationId EDeclarationId::genericDeclarationSpecifier()
+{
+    return EDeclarationId(kGenericDeclarationSpecifier);
+}
+
+const EDeclarationId EDeclarationId::identifierDestructorMethodName()
+{
+    return EDeclarationId(kIdentifierDestructorMethodName);
+}
+
+const EDeclarationId EDeclarationId::identifierMethodName()
+{
+    return EDeclarationId(kIdentifierMethodName);
+}
+
+const EDeclarationId EDeclarationId::memberDeclaration()
+{
+    return EDeclarationId(kMemberDeclaration);
+}
+
+const EDeclarationId EDeclarationId::methodName()
+{
+    return EDeclarationId(kMethodName);
+}
+
+const EDeclarationId EDeclarationId::operatorMethodName()
+{
+    return EDeclarationId(kOperatorMethodName);
+}
+
+const EDeclarationId EDeclarationId::simpleBlockDeclaration()
+{
+    return EDeclarationId(kSimpleBlockDeclaration);
+}
+
+const EDeclarationId EDeclarationId::simpleDeclaration()
+{
+    return EDeclarationId(kSimpleDeclaration);
+}
+
+const EDeclarationId EDeclarationId::simpleTypeSpecifier()
+{
+    return EDeclarationId(kSimpleTypeSpecifier);
+}
+
+const EDeclarationId EDeclarationId::specifierMemberDeclaration()
+{
+    return EDeclarationId(kSpecifierMemberDeclaration);
+}
+
+const EDeclarationId EDeclarationId::typeDeclarationSpecifier()
+{
+    return EDeclarationId(kTypeDeclarationSpecifier);
+}
+
+const EDeclarationId EDeclarationId::typeName()
+{
+    return EDeclarationId(kTypeName);
+}
+
+const EDeclarationId EDeclarationId::typeNameSimpleTypeSpecifier()
+{
+    return EDeclarationId(kTypeNameSimpleTypeSpecifier);
+}
+
+const EDeclarationId EDeclarationId::typeSpecifier()
+{
+    return EDeclarationId(kTypeSpecifier);
+}
+
+long EDeclarationId::value() const
+{
+    return mValue;
+}
+
+const char* EDeclarationId::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "BlockDeclaration",
+        "BuiltinSimpleTypeSpecifier",
+        "CVQualifierTypeSpecifier",
+        "ClassDeclarationSpecifier",
+        "ClassTypeName",
+        "ConstructorMethodName",
+        "Declaration",
+        "DeclarationSpecifier",
+        "DeclarationSpecifierSequence",
+        "DestructorMethodName",
+        "FunctionDeclarationSpecifier",
+        "FunctionDefinitionMemberDeclaration",
+        "FunctionName",
+        "GenericDeclarationSpecifier",
+        "IdentifierDestructorMethodName",
+        "IdentifierMethodName",
+        "MemberDeclaration",
+        "MethodName",
+        "OperatorMethodName",
+        "SimpleBlockDeclaration",
+        "SimpleDeclaration",
+        "SimpleTypeSpecifier",
+        "SpecifierMemberDeclaration",
+        "TypeDeclarationSpecifier",
+        "TypeName",
+        "TypeNameSimpleTypeSpecifier",
+        "TypeSpecifier",
+    };
+    return names[(size_t)value];
+}
+
+const char* EDeclarationId::shortName() const
+{
+    return shortName(value());
+}
+
+bool EDeclarationId::operator==(const EDeclarationId& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EDeclarationId::operator!=(const EDeclarationId& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EDeclarationId BlockDeclaration::staticDeclarationId()
+{
+    return EDeclarationId::blockDeclaration();
+}
+
+EDeclarationId BlockDeclaration::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId BuiltinSimpleTypeSpecifier::staticDeclarationId()
+{
+    return EDeclarationId::builtinSimpleTypeSpecifier();
+}
+
+EDeclarationId BuiltinSimpleTypeSpecifier::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId CVQualifierTypeSpecifier::staticDeclarationId()
+{
+    return EDeclarationId::cVQualifierTypeSpecifier();
+}
+
+EDeclarationId CVQualifierTypeSpecifier::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId ClassDeclarationSpecifier::staticDeclarationId()
+{
+    return EDeclarationId::classDeclarationSpecifier();
+}
+
+EDeclarationId ClassDeclarationSpecifier::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId ClassTypeName::staticDeclarationId()
+{
+    return EDeclarationId::classTypeName();
+}
+
+EDeclarationId ClassTypeName::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId ConstructorMethodName::staticDeclarationId()
+{
+    return EDeclarationId::constructorMethodName();
+}
+
+EDeclarationId ConstructorMethodName::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId Declaration::staticDeclarationId()
+{
+    return EDeclarationId::declaration();
+}
+
+EDeclarationId Declaration::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId DeclarationSpecifier::staticDeclarationId()
+{
+    return EDeclarationId::declarationSpecifier();
+}
+
+EDeclarationId DeclarationSpecifier::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId DeclarationSpecifierSequence::staticDeclarationId()
+{
+    return EDeclarationId::declarationSpecifierSequence();
+}
+
+EDeclarationId DeclarationSpecifierSequence::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId DestructorMethodName::staticDeclarationId()
+{
+    return EDeclarationId::destructorMethodName();
+}
+
+EDeclarationId DestructorMethodName::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId FunctionDeclarationSpecifier::staticDeclarationId()
+{
+    return EDeclarationId::functionDeclarationSpecifier();
+}
+
+EDeclarationId FunctionDeclarationSpecifier::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId FunctionDefinitionMemberDeclaration::staticDeclarationId()
+{
+    return EDeclarationId::functionDefinitionMemberDeclaration();
+}
+
+EDeclarationId FunctionDefinitionMemberDeclaration::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId FunctionName::staticDeclarationId()
+{
+    return EDeclarationId::functionName();
+}
+
+EDeclarationId FunctionName::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId GenericDeclarationSpecifier::staticDeclarationId()
+{
+    return EDeclarationId::genericDeclarationSpecifier();
+}
+
+EDeclarationId GenericDeclarationSpecifier::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId IdentifierDestructorMethodName::staticDeclarationId()
+{
+    return EDeclarationId::identifierDestructorMethodName();
+}
+
+EDeclarationId IdentifierDestructorMethodName::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId IdentifierMethodName::staticDeclarationId()
+{
+    return EDeclarationId::identifierMethodName();
+}
+
+EDeclarationId IdentifierMethodName::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId MemberDeclaration::staticDeclarationId()
+{
+    return EDeclarationId::memberDeclaration();
+}
+
+EDeclarationId MemberDeclaration::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId MethodName::staticDeclarationId()
+{
+    return EDeclarationId::methodName();
+}
+
+EDeclarationId MethodName::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId OperatorMethodName::staticDeclarationId()
+{
+    return EDeclarationId::operatorMethodName();
+}
+
+EDeclarationId OperatorMethodName::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId SimpleBlockDeclaration::staticDeclarationId()
+{
+    return EDeclarationId::simpleBlockDeclaration();
+}
+
+EDeclarationId SimpleBlockDeclaration::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId SimpleDeclaration::staticDeclarationId()
+{
+    return EDeclarationId::simpleDeclaration();
+}
+
+EDeclarationId SimpleDeclaration::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId SimpleTypeSpecifier::staticDeclarationId()
+{
+    return EDeclarationId::simpleTypeSpecifier();
+}
+
+EDeclarationId SimpleTypeSpecifier::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId SpecifierMemberDeclaration::staticDeclarationId()
+{
+    return EDeclarationId::specifierMemberDeclaration();
+}
+
+EDeclarationId SpecifierMemberDeclaration::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId TypeDeclarationSpecifier::staticDeclarationId()
+{
+    return EDeclarationId::typeDeclarationSpecifier();
+}
+
+EDeclarationId TypeDeclarationSpecifier::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId TypeName::staticDeclarationId()
+{
+    return EDeclarationId::typeName();
+}
+
+EDeclarationId TypeName::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId TypeNameSimpleTypeSpecifier::staticDeclarationId()
+{
+    return EDeclarationId::typeNameSimpleTypeSpecifier();
+}
+
+EDeclarationId TypeNameSimpleTypeSpecifier::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+EDeclarationId TypeSpecifier::staticDeclarationId()
+{
+    return EDeclarationId::typeSpecifier();
+}
+
+EDeclarationId TypeSpecifier::runtimeDeclarationId() const
+{
+    return staticDeclarationId();
+}
+
+DeclarationSPtr DeclarationFactory::clone(const DeclarationSPtr& pObject)
+{
+    switch (pObject->runtimeDeclarationId().value())
+    {
+        case EDeclarationId::kBlockDeclaration:
+        {
+            BlockDeclarationSPtr pClone(new BlockDeclaration());
+            *pClone = *downcastBlockDeclaration(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kBuiltinSimpleTypeSpecifier:
+        {
+            BuiltinSimpleTypeSpecifierSPtr pClone(new BuiltinSimpleTypeSpecifier());
+            *pClone = *downcastBuiltinSimpleTypeSpecifier(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kCVQualifierTypeSpecifier:
+        {
+            CVQualifierTypeSpecifierSPtr pClone(new CVQualifierTypeSpecifier());
+            *pClone = *downcastCVQualifierTypeSpecifier(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kClassDeclarationSpecifier:
+        {
+            ClassDeclarationSpecifierSPtr pClone(new ClassDeclarationSpecifier());
+            *pClone = *downcastClassDeclarationSpecifier(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kClassTypeName:
+        {
+            ClassTypeNameSPtr pClone(new ClassTypeName());
+            *pClone = *downcastClassTypeName(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kConstructorMethodName:
+        {
+            ConstructorMethodNameSPtr pClone(new ConstructorMethodName());
+            *pClone = *downcastConstructorMethodName(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kDeclaration:
+        {
+            DeclarationSPtr pClone(new Declaration());
+            *pClone = *pObject;
+            return pClone;
+        }
+        case EDeclarationId::kDeclarationSpecifier:
+        {
+            DeclarationSpecifierSPtr pClone(new DeclarationSpecifier());
+            *pClone = *downcastDeclarationSpecifier(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kDeclarationSpecifierSequence:
+        {
+            DeclarationSpecifierSequenceSPtr pClone(new DeclarationSpecifierSequence());
+            *pClone = *downcastDeclarationSpecifierSequence(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kDestructorMethodName:
+        {
+            DestructorMethodNameSPtr pClone(new DestructorMethodName());
+            *pClone = *downcastDestructorMethodName(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kFunctionDeclarationSpecifier:
+        {
+            FunctionDeclarationSpecifierSPtr pClone(new FunctionDeclarationSpecifier());
+            *pClone = *downcastFunctionDeclarationSpecifier(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kFunctionDefinitionMemberDeclaration:
+        {
+            FunctionDefinitionMemberDeclarationSPtr pClone(new FunctionDefinitionMemberDeclaration());
+            *pClone = *downcastFunctionDefinitionMemberDeclaration(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kFunctionName:
+        {
+            FunctionNameSPtr pClone(new FunctionName());
+            *pClone = *downcastFunctionName(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kGenericDeclarationSpecifier:
+        {
+            GenericDeclarationSpecifierSPtr pClone(new GenericDeclarationSpecifier());
+            *pClone = *downcastGenericDeclarationSpecifier(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kIdentifierDestructorMethodName:
+        {
+            IdentifierDestructorMethodNameSPtr pClone(new IdentifierDestructorMethodName());
+            *pClone = *downcastIdentifierDestructorMethodName(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kIdentifierMethodName:
+        {
+            IdentifierMethodNameSPtr pClone(new IdentifierMethodName());
+            *pClone = *downcastIdentifierMethodName(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kMemberDeclaration:
+        {
+            MemberDeclarationSPtr pClone(new MemberDeclaration());
+            *pClone = *downcastMemberDeclaration(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kMethodName:
+        {
+            MethodNameSPtr pClone(new MethodName());
+            *pClone = *downcastMethodName(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kOperatorMethodName:
+        {
+            OperatorMethodNameSPtr pClone(new OperatorMethodName());
+            *pClone = *downcastOperatorMethodName(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kSimpleBlockDeclaration:
+        {
+            SimpleBlockDeclarationSPtr pClone(new SimpleBlockDeclaration());
+            *pClone = *downcastSimpleBlockDeclaration(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kSimpleDeclaration:
+        {
+            SimpleDeclarationSPtr pClone(new SimpleDeclaration());
+            *pClone = *downcastSimpleDeclaration(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kSimpleTypeSpecifier:
+        {
+            SimpleTypeSpecifierSPtr pClone(new SimpleTypeSpecifier());
+            *pClone = *downcastSimpleTypeSpecifier(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kSpecifierMemberDeclaration:
+        {
+            SpecifierMemberDeclarationSPtr pClone(new SpecifierMemberDeclaration());
+            *pClone = *downcastSpecifierMemberDeclaration(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kTypeDeclarationSpecifier:
+        {
+            TypeDeclarationSpecifierSPtr pClone(new TypeDeclarationSpecifier());
+            *pClone = *downcastTypeDeclarationSpecifier(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kTypeName:
+        {
+            TypeNameSPtr pClone(new TypeName());
+            *pClone = *downcastTypeName(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kTypeNameSimpleTypeSpecifier:
+        {
+            TypeNameSimpleTypeSpecifierSPtr pClone(new TypeNameSimpleTypeSpecifier());
+            *pClone = *downcastTypeNameSimpleTypeSpecifier(pObject);
+            return pClone;
+        }
+        case EDeclarationId::kTypeSpecifier:
+        {
+            TypeSpecifierSPtr pClone(new TypeSpecifier());
+            *pClone = *downcastTypeSpecifier(pObject);
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return DeclarationSPtr();
+}
+
+BlockDeclarationSPtr DeclarationFactory::downcastBlockDeclaration(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == BlockDeclaration::staticDeclarationId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclarationId() == SimpleBlockDeclaration::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<BlockDeclaration>(pObject);
+    return BlockDeclarationSPtr();
+}
+
+BuiltinSimpleTypeSpecifierSPtr DeclarationFactory::downcastBuiltinSimpleTypeSpecifier(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == BuiltinSimpleTypeSpecifier::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<BuiltinSimpleTypeSpecifier>(pObject);
+    return BuiltinSimpleTypeSpecifierSPtr();
+}
+
+CVQualifierTypeSpecifierSPtr DeclarationFactory::downcastCVQualifierTypeSpecifier(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == CVQualifierTypeSpecifier::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<CVQualifierTypeSpecifier>(pObject);
+    return CVQualifierTypeSpecifierSPtr();
+}
+
+ClassDeclarationSpecifierSPtr DeclarationFactory::downcastClassDeclarationSpecifier(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == ClassDeclarationSpecifier::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<ClassDeclarationSpecifier>(pObject);
+    return ClassDeclarationSpecifierSPtr();
+}
+
+ClassTypeNameSPtr DeclarationFactory::downcastClassTypeName(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == ClassTypeName::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<ClassTypeName>(pObject);
+    return ClassTypeNameSPtr();
+}
+
+ConstructorMethodNameSPtr DeclarationFactory::downcastConstructorMethodName(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == ConstructorMethodName::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<ConstructorMethodName>(pObject);
+    return ConstructorMethodNameSPtr();
+}
+
+DeclarationSpecifierSPtr DeclarationFactory::downcastDeclarationSpecifier(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == DeclarationSpecifier::staticDeclarationId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclarationId() == ClassDeclarationSpecifier::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == FunctionDeclarationSpecifier::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == GenericDeclarationSpecifier::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == TypeDeclarationSpecifier::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<DeclarationSpecifier>(pObject);
+    return DeclarationSpecifierSPtr();
+}
+
+DeclarationSpecifierSequenceSPtr DeclarationFactory::downcastDeclarationSpecifierSequence(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == DeclarationSpecifierSequence::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<DeclarationSpecifierSequence>(pObject);
+    return DeclarationSpecifierSequenceSPtr();
+}
+
+DestructorMethodNameSPtr DeclarationFactory::downcastDestructorMethodName(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == DestructorMethodName::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<DestructorMethodName>(pObject);
+    return DestructorMethodNameSPtr();
+}
+
+FunctionDeclarationSpecifierSPtr DeclarationFactory::downcastFunctionDeclarationSpecifier(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == FunctionDeclarationSpecifier::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<FunctionDeclarationSpecifier>(pObject);
+    return FunctionDeclarationSpecifierSPtr();
+}
+
+FunctionDefinitionMemberDeclarationSPtr DeclarationFactory::downcastFunctionDefinitionMemberDeclaration(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == FunctionDefinitionMemberDeclaration::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<FunctionDefinitionMemberDeclaration>(pObject);
+    return FunctionDefinitionMemberDeclarationSPtr();
+}
+
+FunctionNameSPtr DeclarationFactory::downcastFunctionName(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == FunctionName::staticDeclarationId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclarationId() == ConstructorMethodName::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == DestructorMethodName::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == IdentifierDestructorMethodName::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == IdentifierMethodName::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == MethodName::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == OperatorMethodName::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<FunctionName>(pObject);
+    return FunctionNameSPtr();
+}
+
+GenericDeclarationSpecifierSPtr DeclarationFactory::downcastGenericDeclarationSpecifier(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == GenericDeclarationSpecifier::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<GenericDeclarationSpecifier>(pObject);
+    return GenericDeclarationSpecifierSPtr();
+}
+
+IdentifierDestructorMethodNameSPtr DeclarationFactory::downcastIdentifierDestructorMethodName(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == IdentifierDestructorMethodName::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<IdentifierDestructorMethodName>(pObject);
+    return IdentifierDestructorMethodNameSPtr();
+}
+
+IdentifierMethodNameSPtr DeclarationFactory::downcastIdentifierMethodName(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == IdentifierMethodName::staticDeclarationId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclarationId() == IdentifierDestructorMethodName::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<IdentifierMethodName>(pObject);
+    return IdentifierMethodNameSPtr();
+}
+
+MemberDeclarationSPtr DeclarationFactory::downcastMemberDeclaration(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == MemberDeclaration::staticDeclarationId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclarationId() == FunctionDefinitionMemberDeclaration::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == SpecifierMemberDeclaration::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<MemberDeclaration>(pObject);
+    return MemberDeclarationSPtr();
+}
+
+MethodNameSPtr DeclarationFactory::downcastMethodName(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == MethodName::staticDeclarationId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclarationId() == ConstructorMethodName::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == DestructorMethodName::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == IdentifierDestructorMethodName::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == IdentifierMethodName::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == OperatorMethodName::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<MethodName>(pObject);
+    return MethodNameSPtr();
+}
+
+OperatorMethodNameSPtr DeclarationFactory::downcastOperatorMethodName(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == OperatorMethodName::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<OperatorMethodName>(pObject);
+    return OperatorMethodNameSPtr();
+}
+
+SimpleBlockDeclarationSPtr DeclarationFactory::downcastSimpleBlockDeclaration(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == SimpleBlockDeclaration::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<SimpleBlockDeclaration>(pObject);
+    return SimpleBlockDeclarationSPtr();
+}
+
+SimpleDeclarationSPtr DeclarationFactory::downcastSimpleDeclaration(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == SimpleDeclaration::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<SimpleDeclaration>(pObject);
+    return SimpleDeclarationSPtr();
+}
+
+SimpleTypeSpecifierSPtr DeclarationFactory::downcastSimpleTypeSpecifier(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == SimpleTypeSpecifier::staticDeclarationId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclarationId() == BuiltinSimpleTypeSpecifier::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == TypeNameSimpleTypeSpecifier::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<SimpleTypeSpecifier>(pObject);
+    return SimpleTypeSpecifierSPtr();
+}
+
+SpecifierMemberDeclarationSPtr DeclarationFactory::downcastSpecifierMemberDeclaration(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == SpecifierMemberDeclaration::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<SpecifierMemberDeclaration>(pObject);
+    return SpecifierMemberDeclarationSPtr();
+}
+
+TypeDeclarationSpecifierSPtr DeclarationFactory::downcastTypeDeclarationSpecifier(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == TypeDeclarationSpecifier::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<TypeDeclarationSpecifier>(pObject);
+    return TypeDeclarationSpecifierSPtr();
+}
+
+TypeNameSPtr DeclarationFactory::downcastTypeName(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == TypeName::staticDeclarationId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclarationId() == ClassTypeName::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<TypeName>(pObject);
+    return TypeNameSPtr();
+}
+
+TypeNameSimpleTypeSpecifierSPtr DeclarationFactory::downcastTypeNameSimpleTypeSpecifier(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == TypeNameSimpleTypeSpecifier::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<TypeNameSimpleTypeSpecifier>(pObject);
+    return TypeNameSimpleTypeSpecifierSPtr();
+}
+
+TypeSpecifierSPtr DeclarationFactory::downcastTypeSpecifier(const DeclarationSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclarationId() == TypeSpecifier::staticDeclarationId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclarationId() == BuiltinSimpleTypeSpecifier::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == CVQualifierTypeSpecifier::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == SimpleTypeSpecifier::staticDeclarationId())
+          || (pObject->runtimeDeclarationId() == TypeNameSimpleTypeSpecifier::staticDeclarationId());
+
+    if (b)
+        return boost::static_pointer_cast<TypeSpecifier>(pObject);
+    return TypeSpecifierSPtr();
+}
+
+}
+
+}
+
@@ -0,0 +1,57 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declaration/function_declaration_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+FunctionDeclarationSpecifier::FunctionDeclarationSpecifier()
+{
+}
+
+FunctionDeclarationSpecifier::~FunctionDeclarationSpecifier()
+{
+}
+
+FunctionDeclarationSpecifierSPtr FunctionDeclarationSpecifier::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<FunctionDeclarationSpecifier>(object);
+}
+
+const EFunctionSpecifier& FunctionDeclarationSpecifier::specifier() const
+{
+    return mSpecifier;
+}
+
+FunctionDeclarationSpecifier& FunctionDeclarationSpecifier::set_specifier(const EFunctionSpecifier& specifier)
+{
+    mSpecifier = specifier;
+    return *this;
+}
+
+EFunctionSpecifier& FunctionDeclarationSpecifier::mutable_specifier()
+{
+    return mSpecifier;
+}
+
+FunctionDeclarationSpecifier& FunctionDeclarationSpecifier::operator<<(const EFunctionSpecifier& specifier)
+{
+    return set_specifier(specifier);
+}
+
+const FunctionDeclarationSpecifierSPtr& operator<<(const FunctionDeclarationSpecifierSPtr& object,
+                                                   const EFunctionSpecifier& specifier)
+{
+    BOOST_ASSERT(object);
+    *object << specifier;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,25 @@
+#include "language/c++/declaration/function_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+FunctionName::FunctionName()
+{
+}
+
+FunctionName::~FunctionName()
+{
+}
+
+FunctionNameSPtr FunctionName::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<FunctionName>(object);
+}
+
+}
+
+}
+
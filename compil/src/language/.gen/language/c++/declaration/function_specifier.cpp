@@ -0,0 +1,74 @@
+#include "language/c++/declaration/function_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+EFunctionSpecifier::EFunctionSpecifier()
+        : mValue(kInvalid)
+{
+}
+
+EFunctionSpecifier::EFunctionSpecifier(long value)
+        : mValue(value)
+{
+}
+
+const EFunctionSpecifier EFunctionSpecifier::invalid()
+{
+    return EFunctionSpecifier(kInvalid);
+}
+
+const EFunctionSpecifier EFunctionSpecifier::inline_()
+{
+    return EFunctionSpecifier(kInline);
+}
+
+const EFunctionSpecifier EFunctionSpecifier::virtual_()
+{
+    return EFunctionSpecifier(kVirtual);
+}
+
+const EFunctionSpecifier EFunctionSpecifier::explicit_()
+{
+    return EFunctionSpecifier(kExplicit);
+}
+
+long EFunctionSpecifier::value() const
+{
+    return mValue;
+}
+
+const char* EFunctionSpecifier::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "inline",
+        "virtual",
+        "explicit",
+    };
+    return names[(size_t)value];
+}
+
+const char* EFunctionSpecifier::shortName() const
+{
+    return shortName(value());
+}
+
+bool EFunctionSpecifier::operator==(const EFunctionSpecifier& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EFunctionSpecifier::operator!=(const EFunctionSpecifier& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+}
+
+}
+
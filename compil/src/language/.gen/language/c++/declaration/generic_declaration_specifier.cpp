@@ -0,0 +1,57 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declaration/generic_declaration_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+GenericDeclarationSpecifier::GenericDeclarationSpecifier()
+{
+}
+
+GenericDeclarationSpecifier::~GenericDeclarationSpecifier()
+{
+}
+
+GenericDeclarationSpecifierSPtr GenericDeclarationSpecifier::downcast(const DeclarationSPtr& object)
+{
+    return boost::static_pointer_cast<GenericDeclarationSpecifier>(object);
+}
+
+const EGeneric& GenericDeclarationSpecifier::generic() const
+{
+    return mGeneric;
+}
+
+GenericDeclarationSpecifier& GenericDeclarationSpecifier::set_generic(const EGeneric& generic)
+{
+    mGeneric = generic;
+    return *this;
+}
+
+EGeneric& GenericDeclarationSpecifier::mutable_generic()
+{
+    return mGeneric;
+}
+
+GenericDeclarationSpecifier& GenericDeclarationSpecifier::operator<<(const EGeneric& generic)
+{
+    return set_generic(generic);
+}
+
+const GenericDeclarationSpecifierSPtr& operator<<(const GenericDeclarationSpecifierSPtr& object,
+                                                  const EGeneric& generic)
+{
+    BOOST_ASSERT(object);
+    *object << generic;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,98 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/body_function_definition.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+BodyFunctionDefinition::BodyFunctionDefinition()
+{
+}
+
+BodyFunctionDefinition::~BodyFunctionDefinition()
+{
+}
+
+BodyFunctionDefinitionSPtr BodyFunctionDefinition::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<BodyFunctionDefinition>(object);
+}
+
+const DeclarationSpecifierSequenceSPtr& BodyFunctionDefinition::specifier() const
+{
+    return mSpecifier;
+}
+
+BodyFunctionDefinition& BodyFunctionDefinition::set_specifier(const DeclarationSpecifierSequenceSPtr& specifier)
+{
+    mSpecifier = specifier;
+    return *this;
+}
+
+BodyFunctionDefinition& BodyFunctionDefinition::operator<<(const DeclarationSpecifierSequenceSPtr& specifier)
+{
+    return set_specifier(specifier);
+}
+
+const BodyFunctionDefinitionSPtr& operator<<(const BodyFunctionDefinitionSPtr& object,
+                                             const DeclarationSpecifierSequenceSPtr& specifier)
+{
+    BOOST_ASSERT(object);
+    *object << specifier;
+    return object;
+}
+
+const DeclaratorSPtr& BodyFunctionDefinition::declarator() const
+{
+    return mDeclarator;
+}
+
+BodyFunctionDefinition& BodyFunctionDefinition::set_declarator(const DeclaratorSPtr& declarator)
+{
+    mDeclarator = declarator;
+    return *this;
+}
+
+BodyFunctionDefinition& BodyFunctionDefinition::operator<<(const DeclaratorSPtr& declarator)
+{
+    return set_declarator(declarator);
+}
+
+const BodyFunctionDefinitionSPtr& operator<<(const BodyFunctionDefinitionSPtr& object, const DeclaratorSPtr& declarator)
+{
+    BOOST_ASSERT(object);
+    *object << declarator;
+    return object;
+}
+
+const FunctionBodySPtr& BodyFunctionDefinition::body() const
+{
+    return mBody;
+}
+
+BodyFunctionDefinition& BodyFunctionDefinition::set_body(const FunctionBodySPtr& body)
+{
+    mBody = body;
+    return *this;
+}
+
+BodyFunctionDefinition& BodyFunctionDefinition::operator<<(const FunctionBodySPtr& body)
+{
+    return set_body(body);
+}
+
+const BodyFunctionDefinitionSPtr& operator<<(const BodyFunctionDefinitionSPtr& object, const FunctionBodySPtr& body)
+{
+    BOOST_ASSERT(object);
+    *object << body;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,148 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __CPP_DECLARATOR_BODY_FUNCTION_DEFINITION_SCOMPIL_H_
+#define __CPP_DECLARATOR_BODY_FUNCTION_DEFINITION_SCOMPIL_H_
+
+#include "language/c++/declaration/declaration_specifier_sequence.h"
+#include "language/c++/declarator/body_function_definition.h"
+#include "language/c++/declarator/declarator.h"
+#include "language/c++/declarator/function_body.h"
+#include "language/c++/declarator/function_definition.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+class BodyFunctionDefinition : public FunctionDefinition
+{
+public:
+    // Default constructor
+                                                    BodyFunctionDefinition ();
+    // Destructor
+    virtual                                         ~BodyFunctionDefinition();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  BodyFunctionDefinitionSPtr              downcast               (const DeclaratorSPtr& object);
+
+    // Identifier for the objects from BodyFunctionDefinition class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EDeclaratorId                           staticDeclaratorId     ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EDeclaratorId                           runtimeDeclaratorId    ()                                                  const;
+
+    // Getter method for the data field specifier
+            const DeclarationSpecifierSequenceSPtr& specifier              ()                                                  const;
+    // Setter method for the data field specifier
+            BodyFunctionDefinition&                 set_specifier          (const DeclarationSpecifierSequenceSPtr& specifier);
+    // Store operator for the data field specifier
+            BodyFunctionDefinition&                 operator<<             (const DeclarationSpecifierSequenceSPtr& specifier);
+
+    // Getter method for the data field declarator
+            const DeclaratorSPtr&                   declarator             ()                                                  const;
+    // Setter method for the data field declarator
+            BodyFunctionDefinition&                 set_declarator         (const DeclaratorSPtr& declarator);
+    // Store operator for the data field declarator
+            BodyFunctionDefinition&                 operator<<             (const DeclaratorSPtr& declarator);
+
+    // Getter method for the data field body
+            const FunctionBodySPtr&                 body                   ()                                                  const;
+    // Setter method for the data field body
+            BodyFunctionDefinition&                 set_body               (const FunctionBodySPtr& body);
+    // Store operator for the data field body
+            BodyFunctionDefinition&                 operator<<             (const FunctionBodySPtr& body);
+
+private:
+    // variable for the data field specifier
+    DeclarationSpecifierSequenceSPtr mSpecifier;
+    // variable for the data field declarator
+    DeclaratorSPtr                   mDeclarator;
+    // variable for the data field body
+    FunctionBodySPtr                 mBody;
+};
+
+// Reference store operator for the data field specifier
+const BodyFunctionDefinitionSPtr& operator<<(const BodyFunctionDefinitionSPtr& ,
+                                             const DeclarationSpecifierSequenceSPtr& );
+// Reference store operator for the data field declarator
+const BodyFunctionDefinitionSPtr& operator<<(const BodyFunctionDefinitionSPtr& , const DeclaratorSPtr& );
+// Reference store operator for the data field body
+const BodyFunctionDefinitionSPtr& operator<<(const BodyFunctionDefinitionSPtr& , const FunctionBodySPtr& );
+
+inline BodyFunctionDefinitionSPtr bodyFunctionDefinitionRef()
+{
+    return boost::make_shared<BodyFunctionDefinition>();
+}
+
+}
+
+}
+
+#else // __CPP_DECLARATOR_BODY_FUNCTION_DEFINITION_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// Forward declarations
+class BodyFunctionDefinition;
+typedef BodyFunctionDefinition*                         BodyFunctionDefinitionRPtr;
+typedef boost::shared_ptr<BodyFunctionDefinition>       BodyFunctionDefinitionSPtr;
+typedef boost::shared_ptr<const BodyFunctionDefinition> BodyFunctionDefinitionSCPtr;
+typedef boost::weak_ptr<BodyFunctionDefinition>         BodyFunctionDefinitionWPtr;
+
+class EDeclaratorId;
+
+}
+
+}
+
+#endif // __CPP_DECLARATOR_BODY_FUNCTION_DEFINITION_SCOMPIL_H_
+
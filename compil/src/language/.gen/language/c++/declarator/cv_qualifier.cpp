@@ -0,0 +1,68 @@
+#include "language/c++/declarator/cv_qualifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ECVQualifier::ECVQualifier()
+        : mValue(kInvalid)
+{
+}
+
+ECVQualifier::ECVQualifier(long value)
+        : mValue(value)
+{
+}
+
+const ECVQualifier ECVQualifier::invalid()
+{
+    return ECVQualifier(kInvalid);
+}
+
+const ECVQualifier ECVQualifier::const_()
+{
+    return ECVQualifier(kConst);
+}
+
+const ECVQualifier ECVQualifier::volatile_()
+{
+    return ECVQualifier(kVolatile);
+}
+
+long ECVQualifier::value() const
+{
+    return mValue;
+}
+
+const char* ECVQualifier::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "const",
+        "volatile",
+    };
+    return names[(size_t)value];
+}
+
+const char* ECVQualifier::shortName() const
+{
+    return shortName(value());
+}
+
+bool ECVQualifier::operator==(const ECVQualifier& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool ECVQualifier::operator!=(const ECVQualifier& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+}
+
+}
+
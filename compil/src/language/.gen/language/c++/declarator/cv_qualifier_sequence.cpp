@@ -0,0 +1,70 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/cv_qualifier_sequence.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+CVQualifierSequence::CVQualifierSequence()
+{
+}
+
+CVQualifierSequence::~CVQualifierSequence()
+{
+}
+
+CVQualifierSequenceSPtr CVQualifierSequence::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<CVQualifierSequence>(object);
+}
+
+const std::vector<ECVQualifier>& CVQualifierSequence::qualifiers() const
+{
+    return mQualifiers;
+}
+
+CVQualifierSequence& CVQualifierSequence::set_qualifiers(const std::vector<ECVQualifier>& qualifiers)
+{
+    mQualifiers = qualifiers;
+    return *this;
+}
+
+std::vector<ECVQualifier>& CVQualifierSequence::mutable_qualifiers()
+{
+    return mQualifiers;
+}
+
+CVQualifierSequence& CVQualifierSequence::operator<<(const std::vector<ECVQualifier>& qualifiers)
+{
+    return set_qualifiers(qualifiers);
+}
+
+const CVQualifierSequenceSPtr& operator<<(const CVQualifierSequenceSPtr& object,
+                                          const std::vector<ECVQualifier>& qualifiers)
+{
+    BOOST_ASSERT(object);
+    *object << qualifiers;
+    return object;
+}
+
+CVQualifierSequence& CVQualifierSequence::operator<<(const ECVQualifier& qualifiersItem)
+{
+    mQualifiers.push_back(qualifiersItem);
+    return *this;
+}
+
+const CVQualifierSequenceSPtr& operator<<(const CVQualifierSequenceSPtr& object, const ECVQualifier& qualifiersItem)
+{
+    BOOST_ASSERT(object);
+    *object << qualifiersItem;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,20 @@
+#include "language/c++/declarator/declarator.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+Declarator::Declarator()
+{
+}
+
+Declarator::~Declarator()
+{
+}
+
+}
+
+}
+
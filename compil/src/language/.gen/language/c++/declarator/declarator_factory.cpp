@@ -0,0 +1,788 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/declarator_factory.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+EDeclaratorId::EDeclaratorId()
+        : mValue(kInvalid)
+{
+}
+
+EDeclaratorId::EDeclaratorId(long value)
+        : mValue(value)
+{
+}
+
+const EDeclaratorId EDeclaratorId::invalid()
+{
+    return EDeclaratorId(kInvalid);
+}
+
+const EDeclaratorId EDeclaratorId::bodyFunctionDefinition()
+{
+    return EDeclaratorId(kBodyFunctionDefinition);
+}
+
+const EDeclaratorId EDeclaratorId::cVQualifierSequence()
+{
+    return EDeclaratorId(kCVQualifierSequence);
+}
+
+const EDeclaratorId EDeclaratorId::declarator()
+{
+    return EDeclaratorId(kDeclarator);
+}
+
+const EDeclaratorId EDeclaratorId::declaratorId()
+{
+    return EDeclaratorId(kDeclaratorId);
+}
+
+const EDeclaratorId EDeclaratorId::declaratorIdDirectDeclarator()
+{
+    return EDeclaratorId(kDeclaratorIdDirectDeclarator);
+}
+
+const EDeclaratorId EDeclaratorId::declaratorMemberDeclarator()
+{
+    return EDeclaratorId(kDeclaratorMemberDeclarator);
+}
+
+const EDeclaratorId EDeclaratorId::declaratorParameterDeclaration()
+{
+    return EDeclaratorId(kDeclaratorParameterDeclaration);
+}
+
+const EDeclaratorId EDeclaratorId::directDeclarator()
+{
+    return EDeclaratorId(kDirectDeclarator);
+}
+
+const EDeclaratorId EDeclaratorId::functionBody()
+{
+    return EDeclaratorId(kFunctionBody);
+}
+
+const EDeclaratorId EDeclaratorId::functionDefinition()
+{
+    return EDeclaratorId(kFunctionDefinition);
+}
+
+const EDeclaratorId EDeclaratorId::functionNameDeclaratorId()
+{
+    return EDeclaratorId(kFunctionNameDeclaratorId);
+}
+
+const EDeclaratorId EDeclaratorId::initDeclarator()
+{
+    return EDeclaratorId(kInitDeclarator);
+}
+
+const EDeclaratorId EDeclaratorId::memberDeclarator()
+{
+    return EDeclaratorId(kMemberDeclarator);
+}
+
+const EDeclaratorId EDeclaratorId::parameterDeclaration()
+{
+    return EDeclaratorId(kParameterDeclaration);
+}
+
+const EDeclaratorId EDeclaratorId::parameterDeclarationClause()
+{
+    return EDeclaratorId(kParameterDeclarationClause);
+}
+
+const EDeclaratorId EDeclaratorId::parameterDeclarationList()
+{
+    return EDeclaratorId(kParameterDeclarationList);
+}
+
+const EDeclaratorId EDeclaratorId::parametersDirectDeclarator()
+{
+    return EDeclaratorId(kParametersDirectDeclarator);
+}
+
+const EDeclaratorId EDeclaratorId::pointerDeclarator()
+{
+    return EDeclaratorId(kPointerDeclarator);
+}
+
+const EDeclaratorId EDeclaratorId::pointerOperator()
+{
+    return EDeclaratorId(kPointerOperator);
+}
+
+const EDeclaratorId EDeclaratorId::pureMemberDeclarator()
+{
+    return EDeclaratorId(kPureMemberDeclarator);
+}
+
+const EDeclaratorId EDeclaratorId::referencePointerOperator()
+{
+    return EDeclaratorId(kReferencePointerOperator);
+}
+
+const EDeclaratorId EDeclaratorId::typeNameDeclaratorId()
+{
+    return EDeclaratorId(kTypeNameDeclaratorId);
+}
+
+const EDeclaratorId EDeclaratorId::variableNameDeclarator()
+{
+    return EDeclaratorId(kVariableNameDeclarator);
+}
+
+long EDeclaratorId::value() const
+{
+    return mValue;
+}
+
+const char* EDeclaratorId::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "BodyFunctionDefinition",
+        "CVQualifierSequence",
+        "Declarator",
+        "DeclaratorId",
+        "DeclaratorIdDirectDeclarator",
+        "DeclaratorMemberDeclarator",
+        "DeclaratorParameterDeclaration",
+        "DirectDeclarator",
+        "FunctionBody",
+        "FunctionDefinition",
+        "FunctionNameDeclaratorId",
+        "InitDeclarator",
+        "MemberDeclarator",
+        "ParameterDeclaration",
+        "ParameterDeclarationClause",
+        "ParameterDeclarationList",
+        "ParametersDirectDeclarator",
+        "PointerDeclarator",
+        "PointerOperator",
+        "PureMemberDeclarator",
+        "ReferencePointerOperator",
+        "TypeNameDeclaratorId",
+        "VariableNameDeclarator",
+    };
+    return names[(size_t)value];
+}
+
+const char* EDeclaratorId::shortName() const
+{
+    return shortName(value());
+}
+
+bool EDeclaratorId::operator==(const EDeclaratorId& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EDeclaratorId::operator!=(const EDeclaratorId& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EDeclaratorId BodyFunctionDefinition::staticDeclaratorId()
+{
+    return EDeclaratorId::bodyFunctionDefinition();
+}
+
+EDeclaratorId BodyFunctionDefinition::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId CVQualifierSequence::staticDeclaratorId()
+{
+    return EDeclaratorId::cVQualifierSequence();
+}
+
+EDeclaratorId CVQualifierSequence::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId Declarator::staticDeclaratorId()
+{
+    return EDeclaratorId::declarator();
+}
+
+EDeclaratorId Declarator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId DeclaratorId::staticDeclaratorId()
+{
+    return EDeclaratorId::declaratorId();
+}
+
+EDeclaratorId DeclaratorId::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId DeclaratorIdDirectDeclarator::staticDeclaratorId()
+{
+    return EDeclaratorId::declaratorIdDirectDeclarator();
+}
+
+EDeclaratorId DeclaratorIdDirectDeclarator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId DeclaratorMemberDeclarator::staticDeclaratorId()
+{
+    return EDeclaratorId::declaratorMemberDeclarator();
+}
+
+EDeclaratorId DeclaratorMemberDeclarator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId DeclaratorParameterDeclaration::staticDeclaratorId()
+{
+    return EDeclaratorId::declaratorParameterDeclaration();
+}
+
+EDeclaratorId DeclaratorParameterDeclaration::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId DirectDeclarator::staticDeclaratorId()
+{
+    return EDeclaratorId::directDeclarator();
+}
+
+EDeclaratorId DirectDeclarator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId FunctionBody::staticDeclaratorId()
+{
+    return EDeclaratorId::functionBody();
+}
+
+EDeclaratorId FunctionBody::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId FunctionDefinition::staticDeclaratorId()
+{
+    return EDeclaratorId::functionDefinition();
+}
+
+EDeclaratorId FunctionDefinition::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId FunctionNameDeclaratorId::staticDeclaratorId()
+{
+    return EDeclaratorId::functionNameDeclaratorId();
+}
+
+EDeclaratorId FunctionNameDeclaratorId::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId InitDeclarator::staticDeclaratorId()
+{
+    return EDeclaratorId::initDeclarator();
+}
+
+EDeclaratorId InitDeclarator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId MemberDeclarator::staticDeclaratorId()
+{
+    return EDeclaratorId::memberDeclarator();
+}
+
+EDeclaratorId MemberDeclarator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId ParameterDeclaration::staticDeclaratorId()
+{
+    return EDeclaratorId::parameterDeclaration();
+}
+
+EDeclaratorId ParameterDeclaration::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId ParameterDeclarationClause::staticDeclaratorId()
+{
+    return EDeclaratorId::parameterDeclarationClause();
+}
+
+EDeclaratorId ParameterDeclarationClause::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId ParameterDeclarationList::staticDeclaratorId()
+{
+    return EDeclaratorId::parameterDeclarationList();
+}
+
+EDeclaratorId ParameterDeclarationList::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId ParametersDirectDeclarator::staticDeclaratorId()
+{
+    return EDeclaratorId::parametersDirectDeclarator();
+}
+
+EDeclaratorId ParametersDirectDeclarator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId PointerDeclarator::staticDeclaratorId()
+{
+    return EDeclaratorId::pointerDeclarator();
+}
+
+EDeclaratorId PointerDeclarator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId PointerOperator::staticDeclaratorId()
+{
+    return EDeclaratorId::pointerOperator();
+}
+
+EDeclaratorId PointerOperator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId PureMemberDeclarator::staticDeclaratorId()
+{
+    return EDeclaratorId::pureMemberDeclarator();
+}
+
+EDeclaratorId PureMemberDeclarator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId ReferencePointerOperator::staticDeclaratorId()
+{
+    return EDeclaratorId::referencePointerOperator();
+}
+
+EDeclaratorId ReferencePointerOperator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId TypeNameDeclaratorId::staticDeclaratorId()
+{
+    return EDeclaratorId::typeNameDeclaratorId();
+}
+
+EDeclaratorId TypeNameDeclaratorId::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+EDeclaratorId VariableNameDeclarator::staticDeclaratorId()
+{
+    return EDeclaratorId::variableNameDeclarator();
+}
+
+EDeclaratorId VariableNameDeclarator::runtimeDeclaratorId() const
+{
+    return staticDeclaratorId();
+}
+
+DeclaratorSPtr DeclaratorFactory::clone(const DeclaratorSPtr& pObject)
+{
+    switch (pObject->runtimeDeclaratorId().value())
+    {
+        case EDeclaratorId::kBodyFunctionDefinition:
+        {
+            BodyFunctionDefinitionSPtr pClone(new BodyFunctionDefinition());
+            *pClone = *downcastBodyFunctionDefinition(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kCVQualifierSequence:
+        {
+            CVQualifierSequenceSPtr pClone(new CVQualifierSequence());
+            *pClone = *downcastCVQualifierSequence(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kDeclarator:
+        {
+            DeclaratorSPtr pClone(new Declarator());
+            *pClone = *pObject;
+            return pClone;
+        }
+        case EDeclaratorId::kDeclaratorId:
+        {
+            DeclaratorIdSPtr pClone(new DeclaratorId());
+            *pClone = *downcastDeclaratorId(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kDeclaratorIdDirectDeclarator:
+        {
+            DeclaratorIdDirectDeclaratorSPtr pClone(new DeclaratorIdDirectDeclarator());
+            *pClone = *downcastDeclaratorIdDirectDeclarator(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kDeclaratorMemberDeclarator:
+        {
+            DeclaratorMemberDeclaratorSPtr pClone(new DeclaratorMemberDeclarator());
+            *pClone = *downcastDeclaratorMemberDeclarator(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kDeclaratorParameterDeclaration:
+        {
+            DeclaratorParameterDeclarationSPtr pClone(new DeclaratorParameterDeclaration());
+            *pClone = *downcastDeclaratorParameterDeclaration(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kDirectDeclarator:
+        {
+            DirectDeclaratorSPtr pClone(new DirectDeclarator());
+            *pClone = *downcastDirectDeclarator(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kFunctionBody:
+        {
+            FunctionBodySPtr pClone(new FunctionBody());
+            *pClone = *downcastFunctionBody(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kFunctionDefinition:
+        {
+            FunctionDefinitionSPtr pClone(new FunctionDefinition());
+            *pClone = *downcastFunctionDefinition(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kFunctionNameDeclaratorId:
+        {
+            FunctionNameDeclaratorIdSPtr pClone(new FunctionNameDeclaratorId());
+            *pClone = *downcastFunctionNameDeclaratorId(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kInitDeclarator:
+        {
+            InitDeclaratorSPtr pClone(new InitDeclarator());
+            *pClone = *downcastInitDeclarator(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kMemberDeclarator:
+        {
+            MemberDeclaratorSPtr pClone(new MemberDeclarator());
+            *pClone = *downcastMemberDeclarator(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kParameterDeclaration:
+        {
+            ParameterDeclarationSPtr pClone(new ParameterDeclaration());
+            *pClone = *downcastParameterDeclaration(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kParameterDeclarationClause:
+        {
+            ParameterDeclarationClauseSPtr pClone(new ParameterDeclarationClause());
+            *pClone = *downcastParameterDeclarationClause(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kParameterDeclarationList:
+        {
+            ParameterDeclarationListSPtr pClone(new ParameterDeclarationList());
+            *pClone = *downcastParameterDeclarationList(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kParametersDirectDeclarator:
+        {
+            ParametersDirectDeclaratorSPtr pClone(new ParametersDirectDeclarator());
+            *pClone = *downcastParametersDirectDeclarator(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kPointerDeclarator:
+        {
+            PointerDeclaratorSPtr pClone(new PointerDeclarator());
+            *pClone = *downcastPointerDeclarator(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kPointerOperator:
+        {
+            PointerOperatorSPtr pClone(new PointerOperator());
+            *pClone = *downcastPointerOperator(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kPureMemberDeclarator:
+        {
+            PureMemberDeclaratorSPtr pClone(new PureMemberDeclarator());
+            *pClone = *downcastPureMemberDeclarator(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kReferencePointerOperator:
+        {
+            ReferencePointerOperatorSPtr pClone(new ReferencePointerOperator());
+            *pClone = *downcastReferencePointerOperator(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kTypeNameDeclaratorId:
+        {
+            TypeNameDeclaratorIdSPtr pClone(new TypeNameDeclaratorId());
+            *pClone = *downcastTypeNameDeclaratorId(pObject);
+            return pClone;
+        }
+        case EDeclaratorId::kVariableNameDeclarator:
+        {
+            VariableNameDeclaratorSPtr pClone(new VariableNameDeclarator());
+            *pClone = *downcastVariableNameDeclarator(pObject);
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return DeclaratorSPtr();
+}
+
+BodyFunctionDefinitionSPtr DeclaratorFactory::downcastBodyFunctionDefinition(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == BodyFunctionDefinition::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<BodyFunctionDefinition>(pObject);
+    return BodyFunctionDefinitionSPtr();
+}
+
+CVQualifierSequenceSPtr DeclaratorFactory::downcastCVQualifierSequence(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == CVQualifierSequence::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<CVQualifierSequence>(pObject);
+    return CVQualifierSequenceSPtr();
+}
+
+DeclaratorIdSPtr DeclaratorFactory::downcastDeclaratorId(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == DeclaratorId::staticDeclaratorId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclaratorId() == FunctionNameDeclaratorId::staticDeclaratorId())
+          || (pObject->runtimeDeclaratorId() == TypeNameDeclaratorId::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<DeclaratorId>(pObject);
+    return DeclaratorIdSPtr();
+}
+
+DeclaratorIdDirectDeclaratorSPtr DeclaratorFactory::downcastDeclaratorIdDirectDeclarator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == DeclaratorIdDirectDeclarator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<DeclaratorIdDirectDeclarator>(pObject);
+    return DeclaratorIdDirectDeclaratorSPtr();
+}
+
+DeclaratorMemberDeclaratorSPtr DeclaratorFactory::downcastDeclaratorMemberDeclarator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == DeclaratorMemberDeclarator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<DeclaratorMemberDeclarator>(pObject);
+    return DeclaratorMemberDeclaratorSPtr();
+}
+
+DeclaratorParameterDeclarationSPtr DeclaratorFactory::downcastDeclaratorParameterDeclaration(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == DeclaratorParameterDeclaration::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<DeclaratorParameterDeclaration>(pObject);
+    return DeclaratorParameterDeclarationSPtr();
+}
+
+DirectDeclaratorSPtr DeclaratorFactory::downcastDirectDeclarator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == DirectDeclarator::staticDeclaratorId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclaratorId() == DeclaratorIdDirectDeclarator::staticDeclaratorId())
+          || (pObject->runtimeDeclaratorId() == ParametersDirectDeclarator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<DirectDeclarator>(pObject);
+    return DirectDeclaratorSPtr();
+}
+
+FunctionBodySPtr DeclaratorFactory::downcastFunctionBody(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == FunctionBody::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<FunctionBody>(pObject);
+    return FunctionBodySPtr();
+}
+
+FunctionDefinitionSPtr DeclaratorFactory::downcastFunctionDefinition(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == FunctionDefinition::staticDeclaratorId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclaratorId() == BodyFunctionDefinition::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<FunctionDefinition>(pObject);
+    return FunctionDefinitionSPtr();
+}
+
+FunctionNameDeclaratorIdSPtr DeclaratorFactory::downcastFunctionNameDeclaratorId(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == FunctionNameDeclaratorId::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<FunctionNameDeclaratorId>(pObject);
+    return FunctionNameDeclaratorIdSPtr();
+}
+
+InitDeclaratorSPtr DeclaratorFactory::downcastInitDeclarator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == InitDeclarator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<InitDeclarator>(pObject);
+    return InitDeclaratorSPtr();
+}
+
+MemberDeclaratorSPtr DeclaratorFactory::downcastMemberDeclarator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == MemberDeclarator::staticDeclaratorId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclaratorId() == DeclaratorMemberDeclarator::staticDeclaratorId())
+          || (pObject->runtimeDeclaratorId() == PureMemberDeclarator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<MemberDeclarator>(pObject);
+    return MemberDeclaratorSPtr();
+}
+
+ParameterDeclarationSPtr DeclaratorFactory::downcastParameterDeclaration(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == ParameterDeclaration::staticDeclaratorId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclaratorId() == DeclaratorParameterDeclaration::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<ParameterDeclaration>(pObject);
+    return ParameterDeclarationSPtr();
+}
+
+ParameterDeclarationClauseSPtr DeclaratorFactory::downcastParameterDeclarationClause(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == ParameterDeclarationClause::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<ParameterDeclarationClause>(pObject);
+    return ParameterDeclarationClauseSPtr();
+}
+
+ParameterDeclarationListSPtr DeclaratorFactory::downcastParameterDeclarationList(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == ParameterDeclarationList::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<ParameterDeclarationList>(pObject);
+    return ParameterDeclarationListSPtr();
+}
+
+ParametersDirectDeclaratorSPtr DeclaratorFactory::downcastParametersDirectDeclarator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == ParametersDirectDeclarator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<ParametersDirectDeclarator>(pObject);
+    return ParametersDirectDeclaratorSPtr();
+}
+
+PointerDeclaratorSPtr DeclaratorFactory::downcastPointerDeclarator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == PointerDeclarator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<PointerDeclarator>(pObject);
+    return PointerDeclaratorSPtr();
+}
+
+PointerOperatorSPtr DeclaratorFactory::downcastPointerOperator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == PointerOperator::staticDeclaratorId())
+          // or any of the derived classes
+          || (pObject->runtimeDeclaratorId() == ReferencePointerOperator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<PointerOperator>(pObject);
+    return PointerOperatorSPtr();
+}
+
+PureMemberDeclaratorSPtr DeclaratorFactory::downcastPureMemberDeclarator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == PureMemberDeclarator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<PureMemberDeclarator>(pObject);
+    return PureMemberDeclaratorSPtr();
+}
+
+ReferencePointerOperatorSPtr DeclaratorFactory::downcastReferencePointerOperator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == ReferencePointerOperator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<ReferencePointerOperator>(pObject);
+    return ReferencePointerOperatorSPtr();
+}
+
+TypeNameDeclaratorIdSPtr DeclaratorFactory::downcastTypeNameDeclaratorId(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == TypeNameDeclaratorId::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<TypeNameDeclaratorId>(pObject);
+    return TypeNameDeclaratorIdSPtr();
+}
+
+VariableNameDeclaratorSPtr DeclaratorFactory::downcastVariableNameDeclarator(const DeclaratorSPtr& pObject)
+{
+    bool b = (pObject->runtimeDeclaratorId() == VariableNameDeclarator::staticDeclaratorId());
+
+    if (b)
+        return boost::static_pointer_cast<VariableNameDeclarator>(pObject);
+    return VariableNameDeclaratorSPtr();
+}
+
+}
+
+}
+
@@ -0,0 +1,25 @@
+#include "language/c++/declarator/declarator_id.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+DeclaratorId::DeclaratorId()
+{
+}
+
+DeclaratorId::~DeclaratorId()
+{
+}
+
+DeclaratorIdSPtr DeclaratorId::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<DeclaratorId>(object);
+}
+
+}
+
+}
+
@@ -0,0 +1,76 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/declarator_parameter_declaratoin.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+DeclaratorParameterDeclaration::DeclaratorParameterDeclaration()
+{
+}
+
+DeclaratorParameterDeclaration::~DeclaratorParameterDeclaration()
+{
+}
+
+DeclaratorParameterDeclarationSPtr DeclaratorParameterDeclaration::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<DeclaratorParameterDeclaration>(object);
+}
+
+const DeclarationSpecifierSequenceSPtr& DeclaratorParameterDeclaration::declaration() const
+{
+    return mDeclaration;
+}
+
+DeclaratorParameterDeclaration& DeclaratorParameterDeclaration::set_declaration(const DeclarationSpecifierSequenceSPtr& declaration)
+{
+    mDeclaration = declaration;
+    return *this;
+}
+
+DeclaratorParameterDeclaration& DeclaratorParameterDeclaration::operator<<(const DeclarationSpecifierSequenceSPtr& declaration)
+{
+    return set_declaration(declaration);
+}
+
+const DeclaratorParameterDeclarationSPtr& operator<<(const DeclaratorParameterDeclarationSPtr& object,
+                                                     const DeclarationSpecifierSequenceSPtr& declaration)
+{
+    BOOST_ASSERT(object);
+    *object << declaration;
+    return object;
+}
+
+const DeclaratorSPtr& DeclaratorParameterDeclaration::declarator() const
+{
+    return mDeclarator;
+}
+
+DeclaratorParameterDeclaration& DeclaratorParameterDeclaration::set_declarator(const DeclaratorSPtr& declarator)
+{
+    mDeclarator = declarator;
+    return *this;
+}
+
+DeclaratorParameterDeclaration& DeclaratorParameterDeclaration::operator<<(const DeclaratorSPtr& declarator)
+{
+    return set_declarator(declarator);
+}
+
+const DeclaratorParameterDeclarationSPtr& operator<<(const DeclaratorParameterDeclarationSPtr& object,
+                                                     const DeclaratorSPtr& declarator)
+{
+    BOOST_ASSERT(object);
+    *object << declarator;
+    return object;
+}
+
+}
+
+}
+
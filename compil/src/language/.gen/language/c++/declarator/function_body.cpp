@@ -0,0 +1,51 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/function_body.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+FunctionBody::FunctionBody()
+{
+}
+
+FunctionBody::~FunctionBody()
+{
+}
+
+FunctionBodySPtr FunctionBody::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<FunctionBody>(object);
+}
+
+const CompoundStatementSPtr& FunctionBody::statement() const
+{
+    return mStatement;
+}
+
+FunctionBody& FunctionBody::set_statement(const CompoundStatementSPtr& statement)
+{
+    mStatement = statement;
+    return *this;
+}
+
+FunctionBody& FunctionBody::operator<<(const CompoundStatementSPtr& statement)
+{
+    return set_statement(statement);
+}
+
+const FunctionBodySPtr& operator<<(const FunctionBodySPtr& object, const CompoundStatementSPtr& statement)
+{
+    BOOST_ASSERT(object);
+    *object << statement;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,25 @@
+#include "language/c++/declarator/function_definition.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+FunctionDefinition::FunctionDefinition()
+{
+}
+
+FunctionDefinition::~FunctionDefinition()
+{
+}
+
+FunctionDefinitionSPtr FunctionDefinition::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<FunctionDefinition>(object);
+}
+
+}
+
+}
+
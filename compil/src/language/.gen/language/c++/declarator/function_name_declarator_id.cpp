@@ -0,0 +1,52 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/function_name_declarator_id.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+FunctionNameDeclaratorId::FunctionNameDeclaratorId()
+{
+}
+
+FunctionNameDeclaratorId::~FunctionNameDeclaratorId()
+{
+}
+
+FunctionNameDeclaratorIdSPtr FunctionNameDeclaratorId::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<FunctionNameDeclaratorId>(object);
+}
+
+const FunctionNameSPtr& FunctionNameDeclaratorId::functionName() const
+{
+    return mFunctionName;
+}
+
+FunctionNameDeclaratorId& FunctionNameDeclaratorId::set_functionName(const FunctionNameSPtr& functionName)
+{
+    mFunctionName = functionName;
+    return *this;
+}
+
+FunctionNameDeclaratorId& FunctionNameDeclaratorId::operator<<(const FunctionNameSPtr& functionName)
+{
+    return set_functionName(functionName);
+}
+
+const FunctionNameDeclaratorIdSPtr& operator<<(const FunctionNameDeclaratorIdSPtr& object,
+                                               const FunctionNameSPtr& functionName)
+{
+    BOOST_ASSERT(object);
+    *object << functionName;
+    return object;
+}
+
+}
+
+}
+
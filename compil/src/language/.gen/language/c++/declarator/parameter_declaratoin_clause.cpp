@@ -0,0 +1,52 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/parameter_declaratoin_clause.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ParameterDeclarationClause::ParameterDeclarationClause()
+{
+}
+
+ParameterDeclarationClause::~ParameterDeclarationClause()
+{
+}
+
+ParameterDeclarationClauseSPtr ParameterDeclarationClause::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<ParameterDeclarationClause>(object);
+}
+
+const ParameterDeclarationListSPtr& ParameterDeclarationClause::list() const
+{
+    return mList;
+}
+
+ParameterDeclarationClause& ParameterDeclarationClause::set_list(const ParameterDeclarationListSPtr& list)
+{
+    mList = list;
+    return *this;
+}
+
+ParameterDeclarationClause& ParameterDeclarationClause::operator<<(const ParameterDeclarationListSPtr& list)
+{
+    return set_list(list);
+}
+
+const ParameterDeclarationClauseSPtr& operator<<(const ParameterDeclarationClauseSPtr& object,
+                                                 const ParameterDeclarationListSPtr& list)
+{
+    BOOST_ASSERT(object);
+    *object << list;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,100 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/parameters_direct_declarator.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ParametersDirectDeclarator::ParametersDirectDeclarator()
+{
+}
+
+ParametersDirectDeclarator::~ParametersDirectDeclarator()
+{
+}
+
+ParametersDirectDeclaratorSPtr ParametersDirectDeclarator::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<ParametersDirectDeclarator>(object);
+}
+
+const DirectDeclaratorSPtr& ParametersDirectDeclarator::declarator() const
+{
+    return mDeclarator;
+}
+
+ParametersDirectDeclarator& ParametersDirectDeclarator::set_declarator(const DirectDeclaratorSPtr& declarator)
+{
+    mDeclarator = declarator;
+    return *this;
+}
+
+ParametersDirectDeclarator& ParametersDirectDeclarator::operator<<(const DirectDeclaratorSPtr& declarator)
+{
+    return set_declarator(declarator);
+}
+
+const ParametersDirectDeclaratorSPtr& operator<<(const ParametersDirectDeclaratorSPtr& object,
+                                                 const DirectDeclaratorSPtr& declarator)
+{
+    BOOST_ASSERT(object);
+    *object << declarator;
+    return object;
+}
+
+const ParameterDeclarationClauseSPtr& ParametersDirectDeclarator::parameters() const
+{
+    return mParameters;
+}
+
+ParametersDirectDeclarator& ParametersDirectDeclarator::set_parameters(const ParameterDeclarationClauseSPtr& parameters)
+{
+    mParameters = parameters;
+    return *this;
+}
+
+ParametersDirectDeclarator& ParametersDirectDeclarator::operator<<(const ParameterDeclarationClauseSPtr& parameters)
+{
+    return set_parameters(parameters);
+}
+
+const ParametersDirectDeclaratorSPtr& operator<<(const ParametersDirectDeclaratorSPtr& object,
+                                                 const ParameterDeclarationClauseSPtr& parameters)
+{
+    BOOST_ASSERT(object);
+    *object << parameters;
+    return object;
+}
+
+const CVQualifierSequenceSPtr& ParametersDirectDeclarator::qualifier() const
+{
+    return mQualifier;
+}
+
+ParametersDirectDeclarator& ParametersDirectDeclarator::set_qualifier(const CVQualifierSequenceSPtr& qualifier)
+{
+    mQualifier = qualifier;
+    return *this;
+}
+
+ParametersDirectDeclarator& ParametersDirectDeclarator::operator<<(const CVQualifierSequenceSPtr& qualifier)
+{
+    return set_qualifier(qualifier);
+}
+
+const ParametersDirectDeclaratorSPtr& operator<<(const ParametersDirectDeclaratorSPtr& object,
+                                                 const CVQualifierSequenceSPtr& qualifier)
+{
+    BOOST_ASSERT(object);
+    *object << qualifier;
+    return object;
+}
+
+}
+
+}
+
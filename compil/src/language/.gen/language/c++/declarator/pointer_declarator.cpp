@@ -0,0 +1,74 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/pointer_declarator.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+PointerDeclarator::PointerDeclarator()
+{
+}
+
+PointerDeclarator::~PointerDeclarator()
+{
+}
+
+PointerDeclaratorSPtr PointerDeclarator::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<PointerDeclarator>(object);
+}
+
+const DeclaratorSPtr& PointerDeclarator::declarator() const
+{
+    return mDeclarator;
+}
+
+PointerDeclarator& PointerDeclarator::set_declarator(const DeclaratorSPtr& declarator)
+{
+    mDeclarator = declarator;
+    return *this;
+}
+
+PointerDeclarator& PointerDeclarator::operator<<(const DeclaratorSPtr& declarator)
+{
+    return set_declarator(declarator);
+}
+
+const PointerDeclaratorSPtr& operator<<(const PointerDeclaratorSPtr& object, const DeclaratorSPtr& declarator)
+{
+    BOOST_ASSERT(object);
+    *object << declarator;
+    return object;
+}
+
+const PointerOperatorSPtr& PointerDeclarator::operator_() const
+{
+    return mOperator;
+}
+
+PointerDeclarator& PointerDeclarator::set_operator(const PointerOperatorSPtr& operator_)
+{
+    mOperator = operator_;
+    return *this;
+}
+
+PointerDeclarator& PointerDeclarator::operator<<(const PointerOperatorSPtr& operator_)
+{
+    return set_operator(operator_);
+}
+
+const PointerDeclaratorSPtr& operator<<(const PointerDeclaratorSPtr& object, const PointerOperatorSPtr& operator_)
+{
+    BOOST_ASSERT(object);
+    *object << operator_;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,25 @@
+#include "language/c++/declarator/pointer_operator.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+PointerOperator::PointerOperator()
+{
+}
+
+PointerOperator::~PointerOperator()
+{
+}
+
+PointerOperatorSPtr PointerOperator::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<PointerOperator>(object);
+}
+
+}
+
+}
+
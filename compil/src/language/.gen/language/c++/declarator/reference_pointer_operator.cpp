@@ -0,0 +1,25 @@
+#include "language/c++/declarator/reference_pointer_operator.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ReferencePointerOperator::ReferencePointerOperator()
+{
+}
+
+ReferencePointerOperator::~ReferencePointerOperator()
+{
+}
+
+ReferencePointerOperatorSPtr ReferencePointerOperator::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<ReferencePointerOperator>(object);
+}
+
+}
+
+}
+
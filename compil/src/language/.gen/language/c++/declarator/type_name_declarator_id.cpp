@@ -0,0 +1,75 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/type_name_declarator_id.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+TypeNameDeclaratorId::TypeNameDeclaratorId()
+{
+}
+
+TypeNameDeclaratorId::~TypeNameDeclaratorId()
+{
+}
+
+TypeNameDeclaratorIdSPtr TypeNameDeclaratorId::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<TypeNameDeclaratorId>(object);
+}
+
+const NestedNameSpecifierSPtr& TypeNameDeclaratorId::spacifier() const
+{
+    return mSpacifier;
+}
+
+TypeNameDeclaratorId& TypeNameDeclaratorId::set_spacifier(const NestedNameSpecifierSPtr& spacifier)
+{
+    mSpacifier = spacifier;
+    return *this;
+}
+
+TypeNameDeclaratorId& TypeNameDeclaratorId::operator<<(const NestedNameSpecifierSPtr& spacifier)
+{
+    return set_spacifier(spacifier);
+}
+
+const TypeNameDeclaratorIdSPtr& operator<<(const TypeNameDeclaratorIdSPtr& object,
+                                           const NestedNameSpecifierSPtr& spacifier)
+{
+    BOOST_ASSERT(object);
+    *object << spacifier;
+    return object;
+}
+
+const TypeNameSPtr& TypeNameDeclaratorId::typeName() const
+{
+    return mTypeName;
+}
+
+TypeNameDeclaratorId& TypeNameDeclaratorId::set_typeName(const TypeNameSPtr& typeName)
+{
+    mTypeName = typeName;
+    return *this;
+}
+
+TypeNameDeclaratorId& TypeNameDeclaratorId::operator<<(const TypeNameSPtr& typeName)
+{
+    return set_typeName(typeName);
+}
+
+const TypeNameDeclaratorIdSPtr& operator<<(const TypeNameDeclaratorIdSPtr& object, const TypeNameSPtr& typeName)
+{
+    BOOST_ASSERT(object);
+    *object << typeName;
+    return object;
+}
+
+}
+
+}
+
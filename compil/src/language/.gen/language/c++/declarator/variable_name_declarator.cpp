@@ -0,0 +1,51 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/declarator/variable_name_declarator.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+VariableNameDeclarator::VariableNameDeclarator()
+{
+}
+
+VariableNameDeclarator::~VariableNameDeclarator()
+{
+}
+
+VariableNameDeclaratorSPtr VariableNameDeclarator::downcast(const DeclaratorSPtr& object)
+{
+    return boost::static_pointer_cast<VariableNameDeclarator>(object);
+}
+
+const VariableNameSPtr& VariableNameDeclarator::variable() const
+{
+    return mVariable;
+}
+
+VariableNameDeclarator& VariableNameDeclarator::set_variable(const VariableNameSPtr& variable)
+{
+    mVariable = variable;
+    return *this;
+}
+
+VariableNameDeclarator& VariableNameDeclarator::operator<<(const VariableNameSPtr& variable)
+{
+    return set_variable(variable);
+}
+
+const VariableNameDeclaratorSPtr& operator<<(const VariableNameDeclaratorSPtr& object, const VariableNameSPtr& variable)
+{
+    BOOST_ASSERT(object);
+    *object << variable;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,74 @@
+#include "language/c++/derieved_class/access_specifier.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+EAccessSpecifier::EAccessSpecifier()
+        : mValue(kInvalid)
+{
+}
+
+EAccessSpecifier::EAccessSpecifier(long value)
+        : mValue(value)
+{
+}
+
+const EAccessSpecifier EAccessSpecifier::invalid()
+{
+    return EAccessSpecifier(kInvalid);
+}
+
+const EAccessSpecifier EAccessSpecifier::private_()
+{
+    return EAccessSpecifier(kPrivate);
+}
+
+const EAccessSpecifier EAccessSpecifier::protected_()
+{
+    return EAccessSpecifier(kProtected);
+}
+
+const EAccessSpecifier EAccessSpecifier::public_()
+{
+    return EAccessSpecifier(kPublic);
+}
+
+long EAccessSpecifier::value() const
+{
+    return mValue;
+}
+
+const char* EAccessSpecifier::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "private",
+        "protected",
+        "public",
+    };
+    return names[(size_t)value];
+}
+
+const char* EAccessSpecifier::shortName() const
+{
+    return shortName(value());
+}
+
+bool EAccessSpecifier::operator==(const EAccessSpecifier& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EAccessSpecifier::operator!=(const EAccessSpecifier& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+}
+
+}
+
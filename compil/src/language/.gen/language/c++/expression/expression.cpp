@@ -0,0 +1,20 @@
+#include "language/c++/expression/expression.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+Expression::Expression()
+{
+}
+
+Expression::~Expression()
+{
+}
+
+}
+
+}
+
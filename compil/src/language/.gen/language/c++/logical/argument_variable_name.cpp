@@ -0,0 +1,47 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/logical/argument_variable_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ArgumentVariableName::ArgumentVariableName()
+{
+}
+
+ArgumentVariableName::~ArgumentVariableName()
+{
+}
+
+ArgumentVariableNameSPtr ArgumentVariableName::downcast(const VariableNameSPtr& object)
+{
+    return boost::static_pointer_cast<ArgumentVariableName>(object);
+}
+
+ArgumentVariableName& ArgumentVariableName::set_value(const std::string& value)
+{
+    VariableName::set_value(value);
+    return *this;
+}
+
+ArgumentVariableName& ArgumentVariableName::operator<<(const std::string& value)
+{
+    *(VariableName*)this << value;
+    return *this;
+}
+
+const ArgumentVariableNameSPtr& operator<<(const ArgumentVariableNameSPtr& object, const std::string& value)
+{
+    BOOST_ASSERT(object);
+    *object << value;
+    return object;
+}
+
+}
+
+}
+
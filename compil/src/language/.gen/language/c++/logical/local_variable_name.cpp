@@ -0,0 +1,47 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/logical/local_variable_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+LocalVariableName::LocalVariableName()
+{
+}
+
+LocalVariableName::~LocalVariableName()
+{
+}
+
+LocalVariableNameSPtr LocalVariableName::downcast(const VariableNameSPtr& object)
+{
+    return boost::static_pointer_cast<LocalVariableName>(object);
+}
+
+LocalVariableName& LocalVariableName::set_value(const std::string& value)
+{
+    VariableName::set_value(value);
+    return *this;
+}
+
+LocalVariableName& LocalVariableName::operator<<(const std::string& value)
+{
+    *(VariableName*)this << value;
+    return *this;
+}
+
+const LocalVariableNameSPtr& operator<<(const LocalVariableNameSPtr& object, const std::string& value)
+{
+    BOOST_ASSERT(object);
+    *object << value;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,47 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/logical/member_variable_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+MemberVariableName::MemberVariableName()
+{
+}
+
+MemberVariableName::~MemberVariableName()
+{
+}
+
+MemberVariableNameSPtr MemberVariableName::downcast(const VariableNameSPtr& object)
+{
+    return boost::static_pointer_cast<MemberVariableName>(object);
+}
+
+MemberVariableName& MemberVariableName::set_value(const std::string& value)
+{
+    VariableName::set_value(value);
+    return *this;
+}
+
+MemberVariableName& MemberVariableName::operator<<(const std::string& value)
+{
+    *(VariableName*)this << value;
+    return *this;
+}
+
+const MemberVariableNameSPtr& operator<<(const MemberVariableNameSPtr& object, const std::string& value)
+{
+    BOOST_ASSERT(object);
+    *object << value;
+    return object;
+}
+
+}
+
+}
+
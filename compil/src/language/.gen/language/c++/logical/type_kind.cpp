@@ -0,0 +1,191 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/logical/type_kind.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+EGeneric::EGeneric()
+        : mValue(kInvalid)
+{
+}
+
+EGeneric::EGeneric(long value)
+        : mValue(value)
+{
+}
+
+const EGeneric EGeneric::invalid()
+{
+    return EGeneric(kInvalid);
+}
+
+const EGeneric EGeneric::string()
+{
+    return EGeneric(kString);
+}
+
+long EGeneric::value() const
+{
+    return mValue;
+}
+
+const char* EGeneric::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "string",
+    };
+    return names[(size_t)value];
+}
+
+const char* EGeneric::shortName() const
+{
+    return shortName(value());
+}
+
+bool EGeneric::operator==(const EGeneric& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EGeneric::operator!=(const EGeneric& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EKind::EKind()
+        : mValue(kInvalid)
+{
+}
+
+EKind::EKind(long value)
+        : mValue(value)
+{
+}
+
+const EKind EKind::invalid()
+{
+    return EKind(kInvalid);
+}
+
+const EKind EKind::builtin()
+{
+    return EKind(kBuiltin);
+}
+
+const EKind EKind::class_()
+{
+    return EKind(kClass);
+}
+
+const EKind EKind::generic()
+{
+    return EKind(kGeneric);
+}
+
+long EKind::value() const
+{
+    return mValue;
+}
+
+const char* EKind::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "builtin",
+        "class",
+        "generic",
+    };
+    return names[(size_t)value];
+}
+
+const char* EKind::shortName() const
+{
+    return shortName(value());
+}
+
+bool EKind::operator==(const EKind& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EKind::operator!=(const EKind& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+TypeKind::TypeKind()
+{
+}
+
+TypeKind::~TypeKind()
+{
+}
+
+const EKind& TypeKind::kind() const
+{
+    return mKind;
+}
+
+TypeKind& TypeKind::set_kind(const EKind& kind)
+{
+    mKind = kind;
+    return *this;
+}
+
+EKind& TypeKind::mutable_kind()
+{
+    return mKind;
+}
+
+TypeKind& TypeKind::operator<<(const EKind& kind)
+{
+    return set_kind(kind);
+}
+
+const TypeKindSPtr& operator<<(const TypeKindSPtr& object, const EKind& kind)
+{
+    BOOST_ASSERT(object);
+    *object << kind;
+    return object;
+}
+
+const EGeneric& TypeKind::generic() const
+{
+    return mGeneric;
+}
+
+TypeKind& TypeKind::set_generic(const EGeneric& generic)
+{
+    mGeneric = generic;
+    return *this;
+}
+
+EGeneric& TypeKind::mutable_generic()
+{
+    return mGeneric;
+}
+
+TypeKind& TypeKind::operator<<(const EGeneric& generic)
+{
+    return set_generic(generic);
+}
+
+const TypeKindSPtr& operator<<(const TypeKindSPtr& object, const EGeneric& generic)
+{
+    BOOST_ASSERT(object);
+    *object << generic;
+    return object;
+}
+
+}
+
+}
+
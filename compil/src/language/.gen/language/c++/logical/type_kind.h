@@ -0,0 +1,241 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifndef __CPP_LOGICAL_TYPE_KIND_SCOMPIL_H_
+#define __CPP_LOGICAL_TYPE_KIND_SCOMPIL_H_
+
+#include "language/c++/logical/type_kind.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EGeneric
+{
+public:
+    // Default constructor - sets the value to invalid
+                         EGeneric  ();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit             EGeneric  (long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long        value     ()                       const;
+    // Returns short name for a specified enum value
+    static   const char* shortName (long value);
+    // Returns short name of the enum value
+             const char* shortName ()                       const;
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool        operator==(const EGeneric& rValue) const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool        operator!=(const EGeneric& rValue) const;
+
+    // static methods for enum class objects
+    static const EGeneric invalid();
+    // There is no builtin string type in c++. C++ string manipulation fuctions
+    // work with pointer to a char. This though is very error prone form memory
+    // ownership perespective. This is why almost every big c++ library uses
+    // stl string or defines its own
+    static const EGeneric string ();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid = 0,
+        kString  = 1,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+// This enumeration class provides namespaced set of constant values.
+// It is designed to provide type control over operations with enum values
+// without need to wait all compilers you are going to use for this project
+// to support C++0x standard. The type control do not prevent the variables
+// to be used in switch statements.
+class EKind
+{
+public:
+    // Default constructor - sets the value to invalid
+                         EKind     ();
+    // Constructor from an integer value.
+    // Note: Avoid using this constructor if possible. It is appropriate
+    // only in case of importing value from components that you do not have
+    // control over (such as 3rd party libraries or serialization
+    // functionality).
+    explicit             EKind     (long value);
+
+    // Returns the integer value of the enum.
+    // Note: Avoid using this method if possible. It is appropriate only in
+    // case of exporting value to components that you do not have control
+    // over (such as 3rd party libraries or serialization functionality).
+             long        value     ()                    const;
+    // Returns short name for a specified enum value
+    static   const char* shortName (long value);
+    // Returns short name of the enum value
+             const char* shortName ()                    const;
+    // returns true if the value of the enum is equal to the value of the
+    // argument
+             bool        operator==(const EKind& rValue) const;
+    // returns true if the value of the enum is not equal to the value of
+    // the argument
+             bool        operator!=(const EKind& rValue) const;
+
+    // static methods for enum class objects
+    static const EKind invalid();
+    // this type is a builtin in the cpp language
+    static const EKind builtin();
+    // this type is a class defined form the code
+    static const EKind class_ ();
+    // generic type is a type that could be resolved as
+    // builtin or class depending on implementation
+    // parameters chosen for the generation
+    static const EKind generic();
+
+    // This enum provides static constants that could be used in a switch
+    // statements
+    enum
+    {
+        kInvalid = 0,
+        kBuiltin = 1,
+        kClass   = 2,
+        kGeneric = 3,
+    };
+
+private:
+    // Member variable that holds the enum value
+    long mValue;
+};
+
+class TypeKind
+{
+public:
+    // Default constructor
+                            TypeKind       ();
+    // Destructor
+    /*lax*/                 ~TypeKind      ();
+
+    // Getter method for the data field kind
+            const EKind&    kind           ()                        const;
+    // Setter method for the data field kind
+            TypeKind&       set_kind       (const EKind& kind);
+    // Provides mutable access to field kind
+            EKind&          mutable_kind   ();
+    // Store operator for the data field kind
+            TypeKind&       operator<<     (const EKind& kind);
+
+    // Getter method for the data field generic
+            const EGeneric& generic        ()                        const;
+    // Setter method for the data field generic
+            TypeKind&       set_generic    (const EGeneric& generic);
+    // Provides mutable access to field generic
+            EGeneric&       mutable_generic();
+    // Store operator for the data field generic
+            TypeKind&       operator<<     (const EGeneric& generic);
+
+private:
+    // variable for the data field kind
+    EKind    mKind;
+    // variable for the data field generic
+    EGeneric mGeneric;
+};
+
+// Reference store operator for the data field kind
+const TypeKindSPtr& operator<<(const TypeKindSPtr& , const EKind& );
+// Reference store operator for the data field generic
+const TypeKindSPtr& operator<<(const TypeKindSPtr& , const EGeneric& );
+
+inline TypeKindSPtr typeKindRef()
+{
+    return boost::make_shared<TypeKind>();
+}
+
+}
+
+}
+
+#else // __CPP_LOGICAL_TYPE_KIND_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// Forward declarations
+class EGeneric;
+typedef EGeneric*                         EGenericRPtr;
+typedef boost::shared_ptr<EGeneric>       EGenericSPtr;
+typedef boost::shared_ptr<const EGeneric> EGenericSCPtr;
+typedef boost::weak_ptr<EGeneric>         EGenericWPtr;
+
+class EKind;
+typedef EKind*                         EKindRPtr;
+typedef boost::shared_ptr<EKind>       EKindSPtr;
+typedef boost::shared_ptr<const EKind> EKindSCPtr;
+typedef boost::weak_ptr<EKind>         EKindWPtr;
+
+class TypeKind;
+typedef TypeKind*                         TypeKindRPtr;
+typedef boost::shared_ptr<TypeKind>       TypeKindSPtr;
+typedef boost::shared_ptr<const TypeKind> TypeKindSCPtr;
+typedef boost::weak_ptr<TypeKind>         TypeKindWPtr;
+
+}
+
+}
+
+#endif // __CPP_LOGICAL_TYPE_KIND_SCOMPIL_H_
+
@@ -0,0 +1,20 @@
+#include "language/c++/namespace/namespace_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+NamespaceName::NamespaceName()
+{
+}
+
+NamespaceName::~NamespaceName()
+{
+}
+
+}
+
+}
+
@@ -0,0 +1,52 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/preprocessor/declaration_macro_argument.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+DeclarationMacroArgument::DeclarationMacroArgument()
+{
+}
+
+DeclarationMacroArgument::~DeclarationMacroArgument()
+{
+}
+
+DeclarationMacroArgumentSPtr DeclarationMacroArgument::downcast(const MacroArgumentSPtr& object)
+{
+    return boost::static_pointer_cast<DeclarationMacroArgument>(object);
+}
+
+const DeclarationSPtr& DeclarationMacroArgument::declaration() const
+{
+    return mDeclaration;
+}
+
+DeclarationMacroArgument& DeclarationMacroArgument::set_declaration(const DeclarationSPtr& declaration)
+{
+    mDeclaration = declaration;
+    return *this;
+}
+
+DeclarationMacroArgument& DeclarationMacroArgument::operator<<(const DeclarationSPtr& declaration)
+{
+    return set_declaration(declaration);
+}
+
+const DeclarationMacroArgumentSPtr& operator<<(const DeclarationMacroArgumentSPtr& object,
+                                               const DeclarationSPtr& declaration)
+{
+    BOOST_ASSERT(object);
+    *object << declaration;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,52 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/preprocessor/expression_macro_argument.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ExpressionMacroArgument::ExpressionMacroArgument()
+{
+}
+
+ExpressionMacroArgument::~ExpressionMacroArgument()
+{
+}
+
+ExpressionMacroArgumentSPtr ExpressionMacroArgument::downcast(const MacroArgumentSPtr& object)
+{
+    return boost::static_pointer_cast<ExpressionMacroArgument>(object);
+}
+
+const ExpressionSPtr& ExpressionMacroArgument::expression() const
+{
+    return mExpression;
+}
+
+ExpressionMacroArgument& ExpressionMacroArgument::set_expression(const ExpressionSPtr& expression)
+{
+    mExpression = expression;
+    return *this;
+}
+
+ExpressionMacroArgument& ExpressionMacroArgument::operator<<(const ExpressionSPtr& expression)
+{
+    return set_expression(expression);
+}
+
+const ExpressionMacroArgumentSPtr& operator<<(const ExpressionMacroArgumentSPtr& object,
+                                              const ExpressionSPtr& expression)
+{
+    BOOST_ASSERT(object);
+    *object << expression;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,20 @@
+#include "language/c++/preprocessor/macro_argument.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+MacroArgument::MacroArgument()
+{
+}
+
+MacroArgument::~MacroArgument()
+{
+}
+
+}
+
+}
+
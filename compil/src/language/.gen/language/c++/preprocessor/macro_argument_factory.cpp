@@ -0,0 +1,153 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/preprocessor/macro_argument_factory.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+EMacroArgumentId::EMacroArgumentId()
+        : mValue(kInvalid)
+{
+}
+
+EMacroArgumentId::EMacroArgumentId(long value)
+        : mValue(value)
+{
+}
+
+const EMacroArgumentId EMacroArgumentId::invalid()
+{
+    return EMacroArgumentId(kInvalid);
+}
+
+const EMacroArgumentId EMacroArgumentId::declarationMacroArgument()
+{
+    return EMacroArgumentId(kDeclarationMacroArgument);
+}
+
+const EMacroArgumentId EMacroArgumentId::expressionMacroArgument()
+{
+    return EMacroArgumentId(kExpressionMacroArgument);
+}
+
+const EMacroArgumentId EMacroArgumentId::macroArgument()
+{
+    return EMacroArgumentId(kMacroArgument);
+}
+
+long EMacroArgumentId::value() const
+{
+    return mValue;
+}
+
+const char* EMacroArgumentId::shortName(long value)
+{
+    static const char* names[] =
+    {
+        "", // alignment
+        "DeclarationMacroArgument",
+        "ExpressionMacroArgument",
+        "MacroArgument",
+    };
+    return names[(size_t)value];
+}
+
+const char* EMacroArgumentId::shortName() const
+{
+    return shortName(value());
+}
+
+bool EMacroArgumentId::operator==(const EMacroArgumentId& rValue) const
+{
+    return mValue == rValue.mValue;
+}
+
+bool EMacroArgumentId::operator!=(const EMacroArgumentId& rValue) const
+{
+    return mValue != rValue.mValue;
+}
+
+EMacroArgumentId DeclarationMacroArgument::staticMacroArgumentId()
+{
+    return EMacroArgumentId::declarationMacroArgument();
+}
+
+EMacroArgumentId DeclarationMacroArgument::runtimeMacroArgumentId() const
+{
+    return staticMacroArgumentId();
+}
+
+EMacroArgumentId ExpressionMacroArgument::staticMacroArgumentId()
+{
+    return EMacroArgumentId::expressionMacroArgument();
+}
+
+EMacroArgumentId ExpressionMacroArgument::runtimeMacroArgumentId() const
+{
+    return staticMacroArgumentId();
+}
+
+EMacroArgumentId MacroArgument::staticMacroArgumentId()
+{
+    return EMacroArgumentId::macroArgument();
+}
+
+EMacroArgumentId MacroArgument::runtimeMacroArgumentId() const
+{
+    return staticMacroArgumentId();
+}
+
+MacroArgumentSPtr MacroArgumentFactory::clone(const MacroArgumentSPtr& pObject)
+{
+    switch (pObject->runtimeMacroArgumentId().value())
+    {
+        case EMacroArgumentId::kDeclarationMacroArgument:
+        {
+            DeclarationMacroArgumentSPtr pClone(new DeclarationMacroArgument());
+            *pClone = *downcastDeclarationMacroArgument(pObject);
+            return pClone;
+        }
+        case EMacroArgumentId::kExpressionMacroArgument:
+        {
+            ExpressionMacroArgumentSPtr pClone(new ExpressionMacroArgument());
+            *pClone = *downcastExpressionMacroArgument(pObject);
+            return pClone;
+        }
+        case EMacroArgumentId::kMacroArgument:
+        {
+            MacroArgumentSPtr pClone(new MacroArgument());
+            *pClone = *pObject;
+            return pClone;
+        }
+        default:
+            BOOST_ASSERT(false && "unknown objId");
+    }
+    return MacroArgumentSPtr();
+}
+
+DeclarationMacroArgumentSPtr MacroArgumentFactory::downcastDeclarationMacroArgument(const MacroArgumentSPtr& pObject)
+{
+    bool b = (pObject->runtimeMacroArgumentId() == DeclarationMacroArgument::staticMacroArgumentId());
+
+    if (b)
+        return boost::static_pointer_cast<DeclarationMacroArgument>(pObject);
+    return DeclarationMacroArgumentSPtr();
+}
+
+ExpressionMacroArgumentSPtr MacroArgumentFactory::downcastExpressionMacroArgument(const MacroArgumentSPtr& pObject)
+{
+    bool b = (pObject->runtimeMacroArgumentId() == ExpressionMacroArgument::staticMacroArgumentId());
+
+    if (b)
+        return boost::static_pointer_cast<ExpressionMacroArgument>(pObject);
+    return ExpressionMacroArgumentSPtr();
+}
+
+}
+
+}
+
@@ -0,0 +1,47 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/statement/jump_statement.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+JumpStatement::JumpStatement()
+{
+}
+
+JumpStatement::~JumpStatement()
+{
+}
+
+JumpStatementSPtr JumpStatement::downcast(const StatementSPtr& object)
+{
+    return boost::static_pointer_cast<JumpStatement>(object);
+}
+
+JumpStatement& JumpStatement::set_close(const EClose& close)
+{
+    Statement::set_close(close);
+    return *this;
+}
+
+JumpStatement& JumpStatement::operator<<(const EClose& close)
+{
+    *(Statement*)this << close;
+    return *this;
+}
+
+const JumpStatementSPtr& operator<<(const JumpStatementSPtr& object, const Statement::EClose& close)
+{
+    BOOST_ASSERT(object);
+    *object << close;
+    return object;
+}
+
+}
+
+}
+
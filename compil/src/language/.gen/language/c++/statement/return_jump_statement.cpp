@@ -0,0 +1,70 @@
+// Boost C++ Utility
+#include <boost/assert.hpp>
+
+#include "language/c++/statement/return_jump_statement.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+ReturnJumpStatement::ReturnJumpStatement()
+{
+}
+
+ReturnJumpStatement::~ReturnJumpStatement()
+{
+}
+
+ReturnJumpStatementSPtr ReturnJumpStatement::downcast(const StatementSPtr& object)
+{
+    return boost::static_pointer_cast<ReturnJumpStatement>(object);
+}
+
+const ExpressionSPtr& ReturnJumpStatement::expression() const
+{
+    return mExpression;
+}
+
+ReturnJumpStatement& ReturnJumpStatement::set_expression(const ExpressionSPtr& expression)
+{
+    mExpression = expression;
+    return *this;
+}
+
+ReturnJumpStatement& ReturnJumpStatement::operator<<(const ExpressionSPtr& expression)
+{
+    return set_expression(expression);
+}
+
+const ReturnJumpStatementSPtr& operator<<(const ReturnJumpStatementSPtr& object, const ExpressionSPtr& expression)
+{
+    BOOST_ASSERT(object);
+    *object << expression;
+    return object;
+}
+
+ReturnJumpStatement& ReturnJumpStatement::set_close(const EClose& close)
+{
+    Statement::set_close(close);
+    return *this;
+}
+
+ReturnJumpStatement& ReturnJumpStatement::operator<<(const EClose& close)
+{
+    *(Statement*)this << close;
+    return *this;
+}
+
+const ReturnJumpStatementSPtr& operator<<(const ReturnJumpStatementSPtr& object, const Statement::EClose& close)
+{
+    BOOST_ASSERT(object);
+    *object << close;
+    return object;
+}
+
+}
+
+}
+
@@ -0,0 +1,22 @@
+#include "language/c++/test/test_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+TestName::TestName()
+        : mValue()
+{
+}
+
+TestName::TestName(const std::string& value)
+        : mValue(value)
+{
+}
+
+}
+
+}
+
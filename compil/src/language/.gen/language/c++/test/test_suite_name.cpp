@@ -0,0 +1,22 @@
+#include "language/c++/test/test_suite_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+TestSuiteName::TestSuiteName()
+        : mValue()
+{
+}
+
+TestSuiteName::TestSuiteName(const std::string& value)
+        : mValue(value)
+{
+}
+
+}
+
+}
+
@@ -0,0 +1,119 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <string>
+
+#ifndef __CPP_TEST_TEST_SUITE_NAME_SCOMPIL_H_
+#define __CPP_TEST_TEST_SUITE_NAME_SCOMPIL_H_
+
+#include "language/c++/test/test_suite_name.h"
+
+namespace lang
+{
+
+namespace cpp
+{
+
+class TestSuiteName
+{
+public:
+                         TestSuiteName();
+    explicit             TestSuiteName(const std::string& value);
+
+    inline   std::string value        ()                            const;
+    inline   bool        operator==   (const TestSuiteName& rValue) const;
+    inline   bool        operator!=   (const TestSuiteName& rValue) const;
+    inline   bool        operator<    (const TestSuiteName& rValue) const;
+private:
+    std::string mValue;
+};
+
+inline TestSuiteNameSPtr testSuiteNameRef()
+{
+    return boost::make_shared<TestSuiteName>();
+}
+
+inline TestSuiteNameSPtr testSuiteNameRef(const std::string& value)
+{
+    return boost::make_shared<TestSuiteName>(value);
+}
+
+inline std::string TestSuiteName::value() const
+{
+    return mValue;
+}
+
+inline bool TestSuiteName::operator==(const TestSuiteName& rValue) const
+{
+    return value() == rValue.value();
+}
+
+inline bool TestSuiteName::operator!=(const TestSuiteName& rValue) const
+{
+    return value() != rValue.value();
+}
+
+inline bool TestSuiteName::operator<(const TestSuiteName& rValue) const
+{
+    return value() < rValue.value();
+}
+
+}
+
+}
+
+#else // __CPP_TEST_TEST_SUITE_NAME_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace cpp
+{
+
+// Forward declarations
+class TestSuiteName;
+typedef TestSuiteName*                         TestSuiteNameRPtr;
+typedef boost::shared_ptr<TestSuiteName>       TestSuiteNameSPtr;
+typedef boost::shared_ptr<const TestSuiteName> TestSuiteNameSCPtr;
+typedef boost::weak_ptr<TestSuiteName>         TestSuiteNameWPtr;
+
+}
+
+}
+
+#endif // __CPP_TEST_TEST_SUITE_NAME_SCOMPIL_H_
+
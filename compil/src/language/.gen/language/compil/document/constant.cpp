@@ -0,0 +1,70 @@
+#include "language/compil/document/constant.h"
+
+namespace lang
+{
+
+namespace compil
+{
+
+Constant::Constant()
+{
+}
+
+Constant::~Constant()
+{
+}
+
+ConstantSPtr Constant::downcast(const ObjectSPtr& object)
+{
+    return boost::static_pointer_cast<Constant>(object);
+}
+
+const NameSPtr& Constant::name() const
+{
+    return mName;
+}
+
+Constant& Constant::set_name(const NameSPtr& name)
+{
+    mName = name;
+    return *this;
+}
+
+const std::string& Constant::value() const
+{
+    return mValue;
+}
+
+Constant& Constant::set_value(const std::string& value)
+{
+    mValue = value;
+    return *this;
+}
+
+std::string& Constant::mutable_value()
+{
+    return mValue;
+}
+
+Constant& Constant::set_sourceId(const SourceIdSPtr& sourceId)
+{
+    Object::set_sourceId(sourceId);
+    return *this;
+}
+
+Constant& Constant::set_line(const Line& line)
+{
+    Object::set_line(line);
+    return *this;
+}
+
+Constant& Constant::set_column(const Column& column)
+{
+    Object::set_column(column);
+    return *this;
+}
+
+}
+
+}
+
@@ -0,0 +1,148 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <vector>
+
+#ifndef __COMPIL_DOCUMENT_METHOD_SCOMPIL_H_
+#define __COMPIL_DOCUMENT_METHOD_SCOMPIL_H_
+
+#include "language/compil/all/comment.h"
+#include "language/compil/all/name.h"
+#include "language/compil/all/object.h"
+#include "language/compil/document/interface.h"
+#include "language/compil/document/method.h"
+
+namespace lang
+{
+
+namespace compil
+{
+
+class Method : public Object
+{
+public:
+    // Default constructor
+                                           Method         ();
+    // Destructor
+    virtual                                ~Method        ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  MethodSPtr                     downcast       (const ObjectSPtr& object);
+
+    // Identifier for the objects from Method class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EObjectId                      staticObjectId ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EObjectId                      runtimeObjectId()                                       const;
+
+    // Getter method for the data field interface
+            const InterfaceWPtr&           interface_     ()                                       const;
+    // Setter method for the data field interface
+            Method&                        set_interface  (const InterfaceSPtr& interface_);
+
+    // Getter method for the data field comment
+            const CommentSPtr&             comment        ()                                       const;
+    // Setter method for the data field comment
+            Method&                        set_comment    (const CommentSPtr& comment);
+
+    // Getter method for the data field name
+            const NameSPtr&                name           ()                                       const;
+    // Setter method for the data field name
+            Method&                        set_name       (const NameSPtr& name);
+
+    // Getter method for the data field objects
+            const std::vector<ObjectSPtr>& objects        ()                                       const;
+    // Setter method for the data field objects
+            Method&                        set_objects    (const std::vector<ObjectSPtr>& objects);
+    // Provides mutable access to field objects
+            std::vector<ObjectSPtr>&       mutable_objects();
+
+    // Setter method for the data field sourceId
+            Method&                        set_sourceId   (const SourceIdSPtr& sourceId);
+
+    // Setter method for the data field line
+            Method&                        set_line       (const Line& line);
+
+    // Setter method for the data field column
+            Method&                        set_column     (const Column& column);
+
+private:
+    // variable for the data field interface
+    InterfaceWPtr           mInterface;
+    // variable for the data field comment
+    CommentSPtr             mComment;
+    // variable for the data field name
+    NameSPtr                mName;
+    // variable for the data field objects
+    std::vector<ObjectSPtr> mObjects;
+};
+
+}
+
+}
+
+#else // __COMPIL_DOCUMENT_METHOD_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace compil
+{
+
+// Forward declarations
+class Method;
+typedef Method*                         MethodRPtr;
+typedef boost::shared_ptr<Method>       MethodSPtr;
+typedef boost::shared_ptr<const Method> MethodSCPtr;
+typedef boost::weak_ptr<Method>         MethodWPtr;
+
+class EObjectId;
+
+}
+
+}
+
+#endif // __COMPIL_DOCUMENT_METHOD_SCOMPIL_H_
+
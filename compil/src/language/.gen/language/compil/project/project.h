@@ -0,0 +1,176 @@
+// CompIL - Component Interface Language
+// Copyright 2011 George Georgiev.  All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+// * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// * The name of George Georgiev can not be used to endorse or
+// promote products derived from this software without specific prior
+// written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Author: george.georgiev@hotmail.com (George Georgiev)
+// 
+
+// Boost C++ Smart Pointers
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+// Standard Template Library
+#include <vector>
+
+#ifndef __COMPIL_PROJECT_PROJECT_SCOMPIL_H_
+#define __COMPIL_PROJECT_PROJECT_SCOMPIL_H_
+
+#include "language/compil/all/file.h"
+#include "language/compil/all/object.h"
+#include "language/compil/all/package.h"
+#include "language/compil/project/project.h"
+#include "language/compil/project/section.h"
+
+namespace lang
+{
+
+namespace compil
+{
+
+class Project : public Object
+{
+public:
+    // Default constructor
+                                            Project         ();
+    // Destructor
+    virtual                                 ~Project        ();
+
+    // Downcast method is syntactic sugar for boost::static_pointer_cast.
+    // Note that it does not provide any type checks. Use it on your own
+    // risk.
+    static  ProjectSPtr                     downcast        (const ObjectSPtr& object);
+
+    // Identifier for the objects from Project class.
+    // Note: it is not defined in the respective cpp file. Instead it is
+    // defined in the factory class together with all the other identifiers
+    // of the other class objects. This allows all identifiers to be
+    // maintained from a single place, which reduces the risk of value
+    // collisions
+    static  EObjectId                       staticObjectId  ();
+    // This virtual method provides runtime object identification based on
+    // the polymorphic behavior of the virtual methods. Allows having a
+    // RTTI like mechanism significantly cheaper than the RTTI provided by
+    // the compilers themselves.
+    virtual EObjectId                       runtimeObjectId ()                                         const;
+
+    // Getter method for the data field mainFile
+            const FileSPtr&                 mainFile        ()                                         const;
+    // Setter method for the data field mainFile
+            Project&                        set_mainFile    (const FileSPtr& mainFile);
+    // Store operator for the data field mainFile
+            Project&                        operator<<      (const FileSPtr& mainFile);
+
+    // Getter method for the data field corePackage
+            const PackageSPtr&              corePackage     ()                                         const;
+    // Setter method for the data field corePackage
+            Project&                        set_corePackage (const PackageSPtr& corePackage);
+    // Store operator for the data field corePackage
+            Project&                        operator<<      (const PackageSPtr& corePackage);
+
+    // Getter method for the data field sections
+            const std::vector<SectionSPtr>& sections        ()                                         const;
+    // Setter method for the data field sections
+            Project&                        set_sections    (const std::vector<SectionSPtr>& sections);
+    // Provides mutable access to field sections
+            std::vector<SectionSPtr>&       mutable_sections();
+    // Store operator for the data field sections
+            Project&                        operator<<      (const std::vector<SectionSPtr>& sections);
+    // Store operator for an item of data field sections
+            Project&                        operator<<      (const SectionSPtr& sectionsItem);
+
+    // Setter method for the data field sourceId
+            Project&                        set_sourceId    (const SourceIdSPtr& sourceId);
+    // Store operator for the data field sourceId
+            Project&                        operator<<      (const SourceIdSPtr& sourceId);
+
+    // Setter method for the data field line
+            Project&                        set_line        (const Line& line);
+    // Store operator for the data field line
+            Project&                        operator<<      (const Line& line);
+
+    // Setter method for the data field column
+            Project&                        set_column      (const Column& column);
+    // Store operator for the data field column
+            Project&                        operator<<      (const Column& column);
+
+private:
+    // variable for the data field mainFile
+    FileSPtr                 mMainFile;
+    // variable for the data field corePackage
+    PackageSPtr              mCorePackage;
+    // variable for the data field sections
+    std::vector<SectionSPtr> mSections;
+};
+
+// Reference store operator for the data field sourceId
+const ProjectSPtr& operator<<(const ProjectSPtr& , const SourceIdSPtr& );
+// Reference store operator for the data field line
+const ProjectSPtr& operator<<(const ProjectSPtr& , const Line& );
+// Reference store operator for the data field column
+const ProjectSPtr& operator<<(const ProjectSPtr& , const Column& );
+// Reference store operator for the data field mainFile
+const ProjectSPtr& operator<<(const ProjectSPtr& , const FileSPtr& );
+// Reference store operator for the data field corePackage
+const ProjectSPtr& operator<<(const ProjectSPtr& , const PackageSPtr& );
+// Reference store operator for the data field sections
+const ProjectSPtr& operator<<(const ProjectSPtr& , const std::vector<SectionSPtr>& );
+// Reference store operator for an item of data field sections
+const ProjectSPtr& operator<<(const ProjectSPtr& , const SectionSPtr& );
+
+inline ProjectSPtr projectRef()
+{
+    return boost::make_shared<Project>();
+}
+
+}
+
+}
+
+#else // __COMPIL_PROJECT_PROJECT_SCOMPIL_H_
+
+namespace lang
+{
+
+namespace compil
+{
+
+// Forward declarations
+class Project;
+typedef Project*                         ProjectRPtr;
+typedef boost::shared_ptr<Project>       ProjectSPtr;
+typedef boost::shared_ptr<const Project> ProjectSCPtr;
+typedef boost::weak_ptr<Project>         ProjectWPtr;
+
+class EObjectId;
+
+}
+
+}
+
+#endif // __COMPIL_PROJECT_PROJECT_SCOMPIL_H_
+
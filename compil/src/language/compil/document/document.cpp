@@ -125,13 +125,16 @@ TypeSPtr Document::findType(const PackageSPtr& pPackage,
                             const std::vector<PackageElementSPtr>& package_elements,
                             const std::string& name) const
 {
-    std::vector<TypeSPtr>::const_iterator it;
-    for (it = mTypes.begin(); it != mTypes.end(); ++it)
+    std::map<std::string, std::vector<size_t> >::const_iterator found = mTypeIndex.find(name);
+    if (found == mTypeIndex.end())
+        return TypeSPtr();
+
+    std::vector<size_t>::const_iterator it;
+    for (it = found->second.begin(); it != found->second.end(); ++it)
     {
-        const TypeSPtr& pType = *it;
-        if ((*it)->name()->value() == name)
+        const TypeSPtr& pType = mTypes[*it];
         if (isVisible(pType->package(), pPackage, package_elements))
-            return *it;
+            return pType;
     }
     return TypeSPtr();
 }
@@ -156,6 +159,7 @@ TypeSPtr Document::findType(const PackageSPtr& pPackage,
 
 void Document::addType(const TypeSPtr& pType)
 {
+    mTypeIndex[pType->name()->value()].push_back(mTypes.size());
     mTypes.push_back(pType);
 }
 
@@ -268,6 +272,36 @@ void Document::cache(const ObjectSPtr& pObject)
     mCache.push_back(pObject);
 }
 
+Document::Mark Document::mark() const
+{
+    Mark mark;
+    mark.types = mTypes.size();
+    mark.objects = mObjects.size();
+    mark.unfinishedUnaryTemplates = mUnfinishedUnaryTemplates.size();
+    mark.cache = mCache.size();
+    return mark;
+}
+
+void Document::rollback(const Mark& mark)
+{
+    while (mark.types < mTypes.size())
+    {
+        std::map<std::string, std::vector<size_t> >::iterator it =
+            mTypeIndex.find(mTypes.back()->name()->value());
+        it->second.pop_back();
+        if (it->second.empty())
+            mTypeIndex.erase(it);
+        mTypes.pop_back();
+    }
+    if (mark.objects < mObjects.size())
+        mObjects.erase(mObjects.begin() + mark.objects, mObjects.end());
+    if (mark.unfinishedUnaryTemplates < mUnfinishedUnaryTemplates.size())
+        mUnfinishedUnaryTemplates.erase(mUnfinishedUnaryTemplates.begin() + mark.unfinishedUnaryTemplates,
+                                        mUnfinishedUnaryTemplates.end());
+    if (mark.cache < mCache.size())
+        mCache.erase(mCache.begin() + mark.cache, mCache.end());
+}
+
 }
 
 }
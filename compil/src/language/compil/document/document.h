@@ -60,6 +60,8 @@
 #include "language/compil/document/unary_template.h"
 #include "language/compil/document/upcopy.h"
 
+#include <map>
+
 namespace lang
 {
 
@@ -106,6 +108,18 @@ public:
     
     void cache(const ObjectSPtr& pObject);
     
+    // The sizes of the document collections. Everything added after a
+    // mark is dropped by rolling back to it
+    struct Mark
+    {
+        size_t types;
+        size_t objects;
+        size_t unfinishedUnaryTemplates;
+        size_t cache;
+    };
+    Mark mark() const;
+    void rollback(const Mark& mark);
+    
     static bool compareElementValues(const std::vector<PackageElementSPtr>& v1,
                                      const std::vector<PackageElementSPtr>& v2);
     
@@ -115,6 +129,8 @@ private:
     NameSPtr mpName;
     
     std::vector<TypeSPtr> mTypes;
+    // the positions in mTypes of the types with a given name
+    std::map<std::string, std::vector<size_t> > mTypeIndex;
     std::vector<ObjectSPtr> mObjects;
     
     std::vector<UnaryTemplateSPtr> mUnfinishedUnaryTemplates;
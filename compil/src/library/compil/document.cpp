@@ -72,7 +72,7 @@ DocumentSPtr CompilDocument::create()
     static TypeSPtr pTimeDirationType(new Type());
 
     static UnaryTemplateSPtr pReference(new Reference());
-    static UnaryTemplateSPtr pVector(new UnaryContainer());
+    static UnaryContainerSPtr pVector(new UnaryContainer());
 
     if (!bInit)
     {
@@ -221,6 +221,7 @@ DocumentSPtr CompilDocument::create()
         pVector->set_literal(Type::ELiteral::binary());
         pVector->set_kind(Type::EKind::object());
         pVector->set_cast(CastableType::ECast::weak());
+        pVector->set_size(UnaryContainer::ESize::dynamic());
     }
 
     DocumentSPtr document = boost::make_shared<Document>();